@@ -479,6 +479,19 @@ EGLAPI void EGLAPIENTRY eglSetValidationEnabledANGLE(EGLBoolean validationState)
 #define EGL_CONTEXT_PASSTHROUGH_SHADERS_ANGLE 0x3463
 #endif /* EGL_ANGLE_create_context_passthrough_shaders */
 
+#ifndef EGL_ANGLE_surface_present_statistics
+#define EGL_ANGLE_surface_present_statistics 1
+#define EGL_SURFACE_ACQUIRE_LATENCY_ANGLE 0x34E1
+#define EGL_SURFACE_THROTTLE_WAIT_TIME_ANGLE 0x34E2
+#define EGL_SURFACE_PRESENT_LATENCY_ANGLE 0x34E3
+#define EGL_SURFACE_PRESENT_QUEUE_DEPTH_ANGLE 0x34E4
+#endif /* EGL_ANGLE_surface_present_statistics */
+
+#ifndef EGL_ANGLE_surface_low_latency
+#define EGL_ANGLE_surface_low_latency 1
+#define EGL_SURFACE_LOW_LATENCY_ANGLE 0x34E5
+#endif /* EGL_ANGLE_surface_low_latency */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
@@ -572,6 +572,7 @@ GL_APICALL void GL_APIENTRY glReleaseTexturesANGLE(GLuint numTexture, const GLui
 #ifndef GL_ANGLE_get_serialized_context_string
 #define GL_ANGLE_get_serialized_context_string
 #define GL_SERIALIZED_CONTEXT_STRING_ANGLE 0x96B0
+#define GL_SERIALIZED_CONTEXT_DIGEST_ANGLE 0x96BC
 #endif /* GL_ANGLE_get_serialized_context_string */
 
 #ifndef GL_ANGLE_robust_fragment_shader_output
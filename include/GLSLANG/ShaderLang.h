@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 412
+#define ANGLE_SH_VERSION 414
 
 enum ShShaderSpec
 {
@@ -213,6 +213,11 @@ struct ShCompileOptions
     // an array vec234, or mat234 type.
     uint64_t clampIndirectArrayBounds : 1;
 
+    // With clampIndirectArrayBounds, don't clamp the indices of arrays in uniform and storage
+    // blocks, leaving them to the robust buffer access of the backend.  Arrays of blocks and of
+    // opaque types are still clamped, as they are not indexed in buffer memory.
+    uint64_t skipClampingIndirectIndicesInBufferBlocks : 1;
+
     // This flag limits the complexity of an expression.
     uint64_t limitExpressionComplexity : 1;
 
@@ -444,6 +449,14 @@ struct ShCompileOptions
     // Whether SPIR-V 1.4 can be emitted.  If not set, SPIR-V 1.3 is emitted.
     uint64_t emitSPIRV14 : 1;
 
+    // Optimize the generated SPIR-V with spirv-tools (dead branch elimination, constant folding,
+    // load/store elimination and block merging).  The size mode sticks to transformations that
+    // never grow the code, the performance mode additionally rewrites function-local variables to
+    // SSA form and eliminates redundant computations.  If both are set, the performance mode is
+    // used.
+    uint64_t optimizeSPIRVForSize : 1;
+    uint64_t optimizeSPIRVForPerformance : 1;
+
     // Reject shaders with obvious undefined behavior:
     //
     // - Shader contains easy-to-detect infinite loops
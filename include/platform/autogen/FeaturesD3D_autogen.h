@@ -164,6 +164,18 @@ struct FeaturesD3D : FeatureSetBase
         &members,
     };
 
+    FeatureInfo warmUpRenderStateCache = {
+        "warmUpRenderStateCache",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
+    FeatureInfo cacheCompiledHlsl = {
+        "cacheCompiledHlsl",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
 };
 
 inline FeaturesD3D::FeaturesD3D()  = default;
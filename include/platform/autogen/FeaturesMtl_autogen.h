@@ -272,6 +272,24 @@ struct FeaturesMtl : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useRenderPipelineBinaryArchive = {
+        "useRenderPipelineBinaryArchive",
+        FeatureCategory::MetalFeatures,
+        &members,
+    };
+
+    FeatureInfo enableParallelRenderEncoding = {
+        "enableParallelRenderEncoding",
+        FeatureCategory::MetalFeatures,
+        &members,
+    };
+
+    FeatureInfo allocateStreamingBuffersFromHeap = {
+        "allocateStreamingBuffersFromHeap",
+        FeatureCategory::MetalFeatures,
+        &members,
+    };
+
     FeatureInfo alwaysPreferStagedTextureUploads = {
         "alwaysPreferStagedTextureUploads",
         FeatureCategory::MetalFeatures,
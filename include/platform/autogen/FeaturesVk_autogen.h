@@ -518,6 +518,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo preferLoadOpForScissoredClear = {
+        "preferLoadOpForScissoredClear",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo emulatedPrerotation90 = {
         "emulatedPrerotation90",
         FeatureCategory::VulkanFeatures,
@@ -584,6 +590,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsConditionalRendering = {
+        "supportsConditionalRendering",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsPipelineCreationFeedback = {
         "supportsPipelineCreationFeedback",
         FeatureCategory::VulkanFeatures,
@@ -728,12 +740,24 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo warmUpRecordedGraphicsPipelines = {
+        "warmUpRecordedGraphicsPipelines",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferDeviceLocalMemoryHostVisible = {
         "preferDeviceLocalMemoryHostVisible",
         FeatureCategory::VulkanFeatures,
         &members,
     };
 
+    FeatureInfo preferDeviceLocalMemoryForPersistentWriteBuffers = {
+        "preferDeviceLocalMemoryForPersistentWriteBuffers",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsExtendedDynamicState = {
         "supportsExtendedDynamicState",
         FeatureCategory::VulkanFeatures,
@@ -824,6 +848,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useColorBlendEquationDynamicState = {
+        "useColorBlendEquationDynamicState",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsFragmentShadingRate = {
         "supportsFragmentShadingRate",
         FeatureCategory::VulkanFeatures,
@@ -938,6 +968,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo preferRobustBufferAccessToIndexClamping = {
+        "preferRobustBufferAccessToIndexClamping",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsVertexInputDynamicState = {
         "supportsVertexInputDynamicState",
         FeatureCategory::VulkanFeatures,
@@ -962,12 +998,42 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo transcodeEtcToBc = {
+        "transcodeEtcToBc",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo decodeAstcUploadsAsynchronously = {
+        "decodeAstcUploadsAsynchronously",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo expandRgbUploadsWithCompute = {
+        "expandRgbUploadsWithCompute",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo batchSubImageUpdates = {
+        "batchSubImageUpdates",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsGraphicsPipelineLibrary = {
         "supportsGraphicsPipelineLibrary",
         FeatureCategory::VulkanFeatures,
         &members,
     };
 
+    FeatureInfo supportsShaderObject = {
+        "supportsShaderObject",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferMonolithicPipelinesOverLibraries = {
         "preferMonolithicPipelinesOverLibraries",
         FeatureCategory::VulkanWorkarounds,
@@ -980,6 +1046,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo prewarmMonolithicPipelineTransitions = {
+        "prewarmMonolithicPipelineTransitions",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo disablePipelineCacheLoadForTesting = {
         "disablePipelineCacheLoadForTesting",
         FeatureCategory::VulkanWorkarounds,
@@ -1208,6 +1280,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo recycleExternalBufferImports = {
+        "recycleExternalBufferImports",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo avoidOpSelectWithMismatchingRelaxedPrecision = {
         "avoidOpSelectWithMismatchingRelaxedPrecision",
         FeatureCategory::VulkanWorkarounds,
@@ -1250,6 +1328,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo shareStreamedVertexBufferAcrossAttribs = {
+        "shareStreamedVertexBufferAcrossAttribs",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsShaderNonSemanticInfo = {
         "supportsShaderNonSemanticInfo",
         FeatureCategory::VulkanFeatures,
@@ -1472,12 +1556,30 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo cacheFormatPropertiesInBlobCache = {
+        "cacheFormatPropertiesInBlobCache",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo initializeFormatTableInParallel = {
+        "initializeFormatTableInParallel",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo descriptorSetCache = {
         "descriptorSetCache",
         FeatureCategory::VulkanFeatures,
         &members,
     };
 
+    FeatureInfo useImmutableSamplersForTextures = {
+        "useImmutableSamplersForTextures",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsImageCompressionControl = {
         "supportsImageCompressionControl",
         FeatureCategory::VulkanFeatures,
@@ -1628,6 +1730,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo preferFramebufferFetchPixelLocalStorage = {
+        "preferFramebufferFetchPixelLocalStorage",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo debugClDumpCommandStream = {
         "debugClDumpCommandStream",
         FeatureCategory::VulkanFeatures,
@@ -1712,6 +1820,84 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsPushDescriptor = {
+        "supportsPushDescriptor",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo usePushDescriptorsForTextures = {
+        "usePushDescriptorsForTextures",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo usePushDescriptorsForUniformBuffers = {
+        "usePushDescriptorsForUniformBuffers",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo usePushDescriptorsForStorageBuffers = {
+        "usePushDescriptorsForStorageBuffers",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo trimMemoryOnBudgetPressure = {
+        "trimMemoryOnBudgetPressure",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo limitGarbageCleanupPerFrame = {
+        "limitGarbageCleanupPerFrame",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo batchOutsideRenderPassImageBarriers = {
+        "batchOutsideRenderPassImageBarriers",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo useTimelineSemaphoreForQueueSerials = {
+        "useTimelineSemaphoreForQueueSerials",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo useSmallImageMemoryPools = {
+        "useSmallImageMemoryPools",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo copyOcclusionQueryResultsToBuffer = {
+        "copyOcclusionQueryResultsToBuffer",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
+    FeatureInfo measurePassGpuTime = {
+        "measurePassGpuTime",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo profileDirtyBitHandlers = {
+        "profileDirtyBitHandlers",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo deferExternalSemaphoreSignal = {
+        "deferExternalSemaphoreSignal",
+        FeatureCategory::VulkanPerformance,
+        &members,
+    };
+
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
@@ -57,6 +57,12 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo parallelImageLoads = {
+        "parallelImageLoads",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
     FeatureInfo forceDepthAttachmentInitOnClear = {
         "forceDepthAttachmentInitOnClear",
         FeatureCategory::FrontendWorkarounds,
@@ -231,6 +237,18 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo precompileGLES1NeighborVariants = {
+        "precompileGLES1NeighborVariants",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo elideShareContextLockForUnsharedContexts = {
+        "elideShareContextLockForUnsharedContexts",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
@@ -3512,9 +3512,21 @@ def get_implicit_pls_disable(cmd_name):
            "}"
 
 
+def get_make_current_no_op_check(api, cmd_name):
+    if cmd_name != "eglMakeCurrent":
+        return ""
+
+    # Rebinding what is already current is done without taking any locks.
+    return "if (egl::IsMakeCurrentNoOp(egl::GetCurrentThread(), dpy, draw, read, ctx))" \
+           "{"                                                                         \
+           "    return EGL_TRUE;"                                                      \
+           "}"
+
+
 def get_preamble(api, cmd_name, params):
     preamble = ""
     preamble += get_prepare_swap_buffers_call(api, cmd_name, params)
+    preamble += get_make_current_no_op_check(api, cmd_name)
     # TODO: others?
     return preamble
 
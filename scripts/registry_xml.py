@@ -181,6 +181,7 @@ gles_requestable_extensions = [
     "GL_KHR_texture_compression_astc_ldr",
     "GL_KHR_texture_compression_astc_sliced_3d",
     "GL_MESA_framebuffer_flip_y",
+    "GL_NV_conditional_render",
     "GL_NV_EGL_stream_consumer_external",
     "GL_NV_framebuffer_blit",
     "GL_NV_pack_subimage",
@@ -378,6 +379,8 @@ supported_egl_extensions = [
     "EGL_ANGLE_query_surface_pointer",
     "EGL_ANGLE_stream_producer_d3d_texture",
     "EGL_ANGLE_surface_d3d_texture_2d_share_handle",
+    "EGL_ANGLE_surface_low_latency",
+    "EGL_ANGLE_surface_present_statistics",
     "EGL_ANGLE_sync_control_rate",
     "EGL_ANGLE_vulkan_image",
     "EGL_ANGLE_wait_until_work_scheduled",
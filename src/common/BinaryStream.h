@@ -12,10 +12,12 @@
 #include <stdint.h>
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "common/MemoryBuffer.h"
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
 #include "common/span.h"
@@ -36,6 +38,12 @@ class BinaryInputStream : angle::NonCopyable
 {
   public:
     BinaryInputStream(angle::Span<const uint8_t> data) : mData(data) {}
+    // |data| is owned by |storage|.  Readers can keep a reference to the storage to use parts of
+    // the stream in place instead of copying them out (see readBytesInPlace).
+    BinaryInputStream(angle::Span<const uint8_t> data,
+                      std::shared_ptr<const angle::MemoryBuffer> storage)
+        : mData(data), mStorage(std::move(storage))
+    {}
 
     // readInt will generate an error for bool types
     template <class IntT>
@@ -106,6 +114,25 @@ class BinaryInputStream : angle::NonCopyable
 
     void readBytes(angle::Span<uint8_t> outArray) { read(outArray); }
 
+    // Returns the next |length| bytes of the stream without copying them.  The result is only valid
+    // as long as the stream's data is; if the stream has a storage, holding on to it keeps the
+    // result valid.
+    angle::Span<const uint8_t> readBytesInPlace(size_t length)
+    {
+        angle::CheckedNumeric<size_t> checkedOffset(mOffset);
+        checkedOffset += length;
+
+        if (!checkedOffset.IsValid() || checkedOffset.ValueOrDie() > mData.size())
+        {
+            mError = true;
+            return {};
+        }
+
+        angle::Span<const uint8_t> bytes = mData.subspan(mOffset, length);
+        mOffset                          = checkedOffset.ValueOrDie();
+        return bytes;
+    }
+
     std::string readString()
     {
         std::string outString;
@@ -166,6 +193,9 @@ class BinaryInputStream : angle::NonCopyable
 
     angle::Span<const uint8_t> remainingSpan() const { return mData.subspan(mOffset); }
 
+    // The owner of the stream's data, if any.
+    const std::shared_ptr<const angle::MemoryBuffer> &getStorage() const { return mStorage; }
+
   private:
     void read(angle::Span<uint8_t> dstSpan)
     {
@@ -186,6 +216,7 @@ class BinaryInputStream : angle::NonCopyable
     bool mError    = false;
     size_t mOffset = 0;
     angle::Span<const uint8_t> mData;
+    std::shared_ptr<const angle::MemoryBuffer> mStorage;
 };
 
 class BinaryOutputStream : angle::NonCopyable
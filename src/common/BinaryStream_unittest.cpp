@@ -10,6 +10,8 @@
 
 #include <stdint.h>
 
+#include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -291,4 +293,41 @@ TEST(BinaryStream, Skip)
     EXPECT_TRUE(in.endOfStream());
 }
 
+// Test that bytes read in place point into the stream's storage, which readers can keep alive.
+TEST(BinaryStream, BytesInPlace)
+{
+    const std::vector<uint8_t> writeData = {1, 2, 3, 4, 5};
+
+    gl::BinaryOutputStream out;
+    out.writeInt<size_t>(writeData.size());
+    out.writeBytes(writeData);
+
+    auto storage = std::make_shared<MemoryBuffer>();
+    ASSERT_TRUE(storage->resize(out.size()));
+    memcpy(storage->data(), out.data(), out.size());
+
+    Span<const uint8_t> bytes;
+    std::shared_ptr<const MemoryBuffer> heldStorage;
+    {
+        gl::BinaryInputStream in(*storage, storage);
+        size_t size = in.readInt<size_t>();
+        bytes       = in.readBytesInPlace(size);
+        heldStorage = in.getStorage();
+
+        EXPECT_FALSE(in.error());
+        EXPECT_TRUE(in.endOfStream());
+    }
+    storage.reset();
+
+    ASSERT_EQ(writeData.size(), bytes.size());
+    EXPECT_GE(bytes.data(), heldStorage->data());
+    EXPECT_EQ(Span<const uint8_t>(writeData), bytes);
+
+    // Reading past the end is an error.
+    gl::BinaryInputStream in(*heldStorage);
+    in.readInt<size_t>();
+    EXPECT_TRUE(in.readBytesInPlace(writeData.size() + 1).empty());
+    EXPECT_TRUE(in.error());
+}
+
 }  // namespace angle
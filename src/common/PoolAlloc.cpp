@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <algorithm>
 #include <utility>
 
 #include <utility>
@@ -157,8 +158,8 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mPageSize(growthIncrement),
       mFreeList(nullptr),
       mInUseList(nullptr),
-      mNumCalls(0),
-      mTotalBytes(0),
+      mInUseListTail(nullptr),
+      mMultiPageList(nullptr),
 #endif
       mAlignment(allocationAlignment)
 {
@@ -234,40 +235,55 @@ void Allocation::checkGuardBlock(unsigned char *blockMem,
 
 void PoolAllocator::reset()
 {
-#if !defined(ANGLE_DISABLE_POOL_ALLOC)
-    mNumCalls   = 0;
-    mTotalBytes = 0;
+    mStatistics.peakAllocatedBytes =
+        std::max(mStatistics.peakAllocatedBytes, mStatistics.allocatedBytes);
+    mStatistics.allocationCount = 0;
+    mStatistics.allocatedBytes  = 0;
+    mStatistics.pagesInUse      = 0;
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
     mCurrentPageOffset = mPageSize;
-    PageHeader *page   = std::exchange(mInUseList, nullptr);
-    while (page)
-    {
-        const size_t pageCount = page->pageCount;
-        PageHeader *nextInUse  = page->nextPage;
 
-#    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
+#    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS) || defined(ANGLE_WITH_ASAN)
+    for (PageHeader *page = mInUseList; page != nullptr; page = page->nextPage)
+    {
+#        if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
         if (page->lastAllocation)
         {
             Allocation *allocations = std::exchange(page->lastAllocation, nullptr);
             allocations->checkAllocList();
         }
+#        endif
+#        if defined(ANGLE_WITH_ASAN)
+        // Clear any container annotations left over from when the memory
+        // was last used. (crbug.com/1419798)
+        __asan_unpoison_memory_region(page, mPageSize);
+#        endif
+    }
 #    endif
 
-        if (pageCount > 1)
+    // Single pages are all returned to the free list in one go.
+    if (mInUseList)
+    {
+        mInUseListTail->nextPage = mFreeList;
+        mFreeList                = std::exchange(mInUseList, nullptr);
+        mInUseListTail           = nullptr;
+    }
+
+    PageHeader *page = std::exchange(mMultiPageList, nullptr);
+    while (page)
+    {
+        PageHeader *next = page->nextPage;
+
+#    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
+        if (page->lastAllocation)
         {
-            delete[] reinterpret_cast<uint8_t *>(page);
+            page->lastAllocation->checkAllocList();
         }
-        else
-        {
-#    if defined(ANGLE_WITH_ASAN)
-            // Clear any container annotations left over from when the memory
-            // was last used. (crbug.com/1419798)
-            __asan_unpoison_memory_region(page, mPageSize);
 #    endif
-            page->nextPage = mFreeList;
-            mFreeList      = page;
-        }
-        page = nextInUse;
+
+        delete[] reinterpret_cast<uint8_t *>(page);
+        page = next;
     }
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     mStack.clear();
@@ -276,13 +292,10 @@ void PoolAllocator::reset()
 
 void *PoolAllocator::allocate(size_t numBytes)
 {
-#if !defined(ANGLE_DISABLE_POOL_ALLOC)
-    //
-    // Just keep some interesting statistics.
-    //
-    ++mNumCalls;
-    mTotalBytes += numBytes;
+    ++mStatistics.allocationCount;
+    mStatistics.allocatedBytes += numBytes;
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
     uint8_t *currentPagePtr = reinterpret_cast<uint8_t *>(mInUseList) + mCurrentPageOffset;
 
     size_t preAllocationPadding = 0;
@@ -299,13 +312,14 @@ void *PoolAllocator::allocate(size_t numBytes)
         uint8_t *memory = currentPagePtr + preAllocationPadding;
         mCurrentPageOffset += allocationSize;
 
-        return initializeAllocation(memory, numBytes);
+        return initializeAllocation(mInUseList, memory, numBytes);
     }
 
     if (allocationSize > mPageSize - mPageHeaderSkip)
     {
         // If the allocation is larger than a whole page, do a multi-page allocation.  These are not
-        // mixed with the others.  The OS is efficient in allocating and freeing multiple pages.
+        // mixed with the others, so the current page can continue to be allocated from.  The OS is
+        // efficient in allocating and freeing multiple pages.
 
         // We don't know what the alignment of the new allocated memory will be, so conservatively
         // allocate enough memory for up to alignment extra bytes being needed.
@@ -322,21 +336,23 @@ void *PoolAllocator::allocate(size_t numBytes)
         {
             return nullptr;
         }
-        mInUseList =
-            new (memory) PageHeader(mInUseList, (numBytesToAlloc + mPageSize - 1) / mPageSize);
-
-        // Make next allocation come from a new page
-        mCurrentPageOffset = mPageSize;
+        mMultiPageList =
+            new (memory) PageHeader(mMultiPageList, (numBytesToAlloc + mPageSize - 1) / mPageSize);
+        ++mStatistics.multiPageAllocations;
 
         // Now that we actually have the pointer, make sure the data pointer will be aligned.
-        currentPagePtr = reinterpret_cast<uint8_t *>(mInUseList) + mPageHeaderSkip;
-        Allocation::AllocationSize(currentPagePtr, numBytes, mAlignment, &preAllocationPadding);
+        uint8_t *dataPtr = memory + mPageHeaderSkip;
+        Allocation::AllocationSize(dataPtr, numBytes, mAlignment, &preAllocationPadding);
 
-        return initializeAllocation(currentPagePtr + preAllocationPadding, numBytes);
+        return initializeAllocation(mMultiPageList, dataPtr + preAllocationPadding, numBytes);
     }
 
     uint8_t *newPageAddr = allocateNewPage(numBytes);
-    return initializeAllocation(newPageAddr, numBytes);
+    if (newPageAddr == nullptr)
+    {
+        return nullptr;
+    }
+    return initializeAllocation(mInUseList, newPageAddr, numBytes);
 
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
 
@@ -354,12 +370,13 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
 {
     // Need a simple page to allocate from.  Pick a page from the free list, if any.  Otherwise need
     // to make the allocation.
+    PageHeader *page = nullptr;
     if (mFreeList)
     {
-        PageHeader *page = mFreeList;
-        mFreeList = mFreeList->nextPage;
-        page->nextPage   = mInUseList;
-        mInUseList       = page;
+        page           = mFreeList;
+        mFreeList      = mFreeList->nextPage;
+        page->nextPage = mInUseList;
+        ++mStatistics.pagesRecycled;
     }
     else
     {
@@ -368,9 +385,19 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
         {
             return nullptr;
         }
-        mInUseList = new (memory) PageHeader(mInUseList, 1);
+        page = new (memory) PageHeader(mInUseList, 1);
+        ++mStatistics.pagesCreated;
     }
 
+    if (mInUseList == nullptr)
+    {
+        mInUseListTail = page;
+    }
+    mInUseList = page;
+
+    ++mStatistics.pagesInUse;
+    mStatistics.peakPagesInUse = std::max(mStatistics.peakPagesInUse, mStatistics.pagesInUse);
+
     // Leave room for the page header.
     mCurrentPageOffset      = mPageHeaderSkip;
     uint8_t *currentPagePtr = reinterpret_cast<uint8_t *>(mInUseList) + mCurrentPageOffset;
@@ -385,11 +412,10 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     return reinterpret_cast<uint8_t *>(mInUseList) + mPageHeaderSkip + preAllocationPadding;
 }
 
-void *PoolAllocator::initializeAllocation(uint8_t *memory, size_t numBytes)
+void *PoolAllocator::initializeAllocation(PageHeader *page, uint8_t *memory, size_t numBytes)
 {
 #    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
-    mInUseList->lastAllocation =
-        new (memory) Allocation(numBytes, memory, mInUseList->lastAllocation);
+    page->lastAllocation = new (memory) Allocation(numBytes, memory, page->lastAllocation);
 #    endif
 
     return Allocation::GetDataPointer(memory, mAlignment);
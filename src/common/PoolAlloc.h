@@ -49,6 +49,25 @@ namespace angle
 {
 class PageHeader;
 
+// Allocation statistics, useful for tuning the page size of an allocator that is reset and reused.
+struct PoolAllocatorStatistics
+{
+    // Number and total size of allocate() calls since the last reset().
+    size_t allocationCount = 0;
+    size_t allocatedBytes  = 0;
+    // The largest allocatedBytes seen by reset().
+    size_t peakAllocatedBytes = 0;
+    // Single pages currently in use, and the most that were ever in use between two resets.
+    size_t pagesInUse     = 0;
+    size_t peakPagesInUse = 0;
+    // Over the lifetime of the allocator, single pages obtained from the OS and single pages
+    // recycled from the free list.
+    size_t pagesCreated  = 0;
+    size_t pagesRecycled = 0;
+    // Over the lifetime of the allocator, allocations too large to fit in a single page.
+    size_t multiPageAllocations = 0;
+};
+
 // Pages are linked together with a simple header at the beginning
 // of each allocation obtained from the underlying OS.
 // The "page size" used is not, nor must it match, the underlying OS
@@ -67,9 +86,14 @@ class PoolAllocator : angle::NonCopyable
     PoolAllocator(int growthIncrement = 8 * 1024, int allocationAlignment = kDefaultAlignment);
     ~PoolAllocator();
 
-    // Marks all allocated memory as unused. The memory will be reused.
+    // Marks all allocated memory as unused. The memory will be reused.  Single pages are kept on
+    // the free list, so an allocator that is reset between uses settles at the high-water mark of
+    // its users and stops going back to the OS.  Unless guard blocks or ASAN are enabled, this is
+    // O(1) in the number of pages in use.
     void reset();
 
+    const PoolAllocatorStatistics &getStatistics() const { return mStatistics; }
+
     // Call allocate() to actually acquire memory.  Returns 0 if no memory
     // available, otherwise a properly aligned pointer to 'numBytes' of memory.
     //
@@ -111,7 +135,7 @@ class PoolAllocator : angle::NonCopyable
     // Slow path of allocation when we have to get a new page.
     uint8_t *allocateNewPage(size_t numBytes);
     // Track allocations if and only if we're using guard blocks
-    void *initializeAllocation(uint8_t *memory, size_t numBytes);
+    void *initializeAllocation(PageHeader *page, uint8_t *memory, size_t numBytes);
 
     // Granularity of allocation from the OS
     size_t mPageSize;
@@ -125,17 +149,20 @@ class PoolAllocator : angle::NonCopyable
     size_t mCurrentPageOffset;
     // List of unused memory.
     PageHeader *mFreeList;
-    // List of all memory currently being used.  The head of this list is where allocations are
-    // currently being made from.
+    // List of all single pages currently being used.  The head of this list is where allocations
+    // are currently being made from.  The tail is tracked so that reset() can splice the whole list
+    // into mFreeList at once.
     PageHeader *mInUseList;
-
-    int mNumCalls;       // just an interesting statistic
-    size_t mTotalBytes;  // just an interesting statistic
+    PageHeader *mInUseListTail;
+    // List of multi-page allocations, which are freed on reset().
+    PageHeader *mMultiPageList;
 
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::unique_ptr<uint8_t[]>> mStack;
 #endif
 
+    PoolAllocatorStatistics mStatistics;
+
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
 };
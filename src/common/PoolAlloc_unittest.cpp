@@ -53,6 +53,52 @@ TEST(PoolAllocatorTest, Interface)
     }
 }
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+// Verify that pages are recycled across resets, so that a reused allocator stops creating pages
+// once it reaches the high-water mark of its users.
+TEST(PoolAllocatorTest, ResetRecyclesPages)
+{
+    constexpr size_t kSmallAllocationSize    = 1000;
+    constexpr size_t kLargeAllocationSize    = 20 * 1024;
+    constexpr uint32_t kSmallAllocationCount = 100;
+
+    PoolAllocator poolAllocator;
+    auto allocateAll = [&]() {
+        for (uint32_t i = 0; i < kSmallAllocationCount; ++i)
+        {
+            void *allocation = poolAllocator.allocate(kSmallAllocationSize);
+            ASSERT_NE(nullptr, allocation);
+            memset(allocation, 0xb8, kSmallAllocationSize);
+        }
+        void *allocation = poolAllocator.allocate(kLargeAllocationSize);
+        ASSERT_NE(nullptr, allocation);
+        memset(allocation, 0xb8, kLargeAllocationSize);
+    };
+
+    allocateAll();
+    const PoolAllocatorStatistics first = poolAllocator.getStatistics();
+    EXPECT_EQ(kSmallAllocationCount + 1, first.allocationCount);
+    EXPECT_EQ(kSmallAllocationCount * kSmallAllocationSize + kLargeAllocationSize,
+              first.allocatedBytes);
+    EXPECT_GT(first.pagesCreated, 0u);
+    EXPECT_EQ(0u, first.pagesRecycled);
+    EXPECT_EQ(first.pagesCreated, first.pagesInUse);
+    EXPECT_EQ(1u, first.multiPageAllocations);
+
+    poolAllocator.reset();
+    EXPECT_EQ(0u, poolAllocator.getStatistics().allocationCount);
+    EXPECT_EQ(0u, poolAllocator.getStatistics().pagesInUse);
+    EXPECT_EQ(first.allocatedBytes, poolAllocator.getStatistics().peakAllocatedBytes);
+
+    allocateAll();
+    const PoolAllocatorStatistics second = poolAllocator.getStatistics();
+    EXPECT_EQ(first.pagesCreated, second.pagesCreated);
+    EXPECT_EQ(first.pagesInUse, second.pagesRecycled);
+    EXPECT_EQ(first.pagesInUse, second.peakPagesInUse);
+    EXPECT_EQ(2u, second.multiPageAllocations);
+}
+#endif
+
 #if !defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
 // Verify allocations are correctly aligned for different alignments
 class PoolAllocatorAlignmentTest : public testing::TestWithParam<int>
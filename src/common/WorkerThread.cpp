@@ -20,6 +20,7 @@
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS) && & !defined(ANGLE_ENABLE_WINDOWS_UWP)
 
 #if ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
+#    include <atomic>
 #    include <future>
 #    include <queue>
 #    include <thread>
@@ -70,13 +71,16 @@ WorkerThreadPool::~WorkerThreadPool() = default;
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    using WorkerThreadPool::postWorkerTask;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
     // Thread safety: This function is thread-safe because the task is run on the calling thread
     // itself.
@@ -91,6 +95,14 @@ bool SingleThreadedWorkerPool::isAsync()
 
 #if ANGLE_STD_ASYNC_WORKERS
 
+// A work-stealing pool.  Every worker thread has its own queue, with one lane per priority, so
+// that posting and picking tasks rarely contend on the same lock.  Tasks posted from outside the
+// pool are spread over the queues round-robin, while tasks posted by a worker go to its own queue.
+// A worker takes tasks from the front of its own queue and steals from the back of the others'.
+//
+// Latency critical tasks in any queue are picked before background tasks.  Additionally, unless
+// the pool has a single thread, background tasks never occupy all the workers, so a latency
+// critical task does not wait behind a long series of background tasks.
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
@@ -98,45 +110,82 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     ~AsyncWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    using WorkerThreadPool::postWorkerTask;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
     size_t getEnqueuedTaskCount() override;
 
   private:
-    void createThreads();
+    static constexpr size_t kPriorityCount = static_cast<size_t>(WorkerTaskPriority::EnumCount);
 
-    using Task = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
+    struct Task
+    {
+        std::shared_ptr<AsyncWaitableEvent> waitable;
+        std::shared_ptr<Closure> closure;
+    };
 
-    // Thread's main loop
-    void threadLoop();
+    struct WorkerQueue
+    {
+        std::mutex mutex;  // Protects |lanes|
+        std::array<std::deque<Task>, kPriorityCount> lanes;
+    };
 
-    bool mTerminated = false;
-    std::mutex mMutex;                 // Protects access to the fields in this class
-    std::condition_variable mCondVar;  // Signals when work is available in the queue
-    std::queue<Task> mTaskQueue;
+    void createThreads();
+
+    // Thread's main loop
+    void threadLoop(size_t workerIndex);
+
+    bool hasRunnableTask() const;
+    bool tryPopTask(size_t workerIndex, WorkerTaskPriority priority, Task *taskOut);
+    bool tryAcquireBackgroundSlot();
+
+    std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+    std::atomic<size_t> mNextQueue;
+    // The number of tasks in all the queues, per lane.
+    std::array<std::atomic<size_t>, kPriorityCount> mPendingTaskCounts;
+    std::atomic<size_t> mRunningBackgroundTaskCount;
+    size_t mMaxRunningBackgroundTaskCount;
+
+    std::atomic<bool> mTerminated;
+    std::mutex mMutex;                 // Protects |mThreads| and changes to |mTerminated|
+    std::condition_variable mCondVar;  // Signals when work is available in the queues
     std::deque<std::thread> mThreads;
     size_t mDesiredThreadCount;
 };
 
+namespace
+{
+// The pool and queue of the current thread, if it is a worker thread.
+thread_local const AsyncWorkerPool *tCurrentWorkerPool = nullptr;
+thread_local size_t tCurrentWorkerIndex                = 0;
+}  // anonymous namespace
+
 // AsyncWorkerPool implementation.
 
-AsyncWorkerPool::AsyncWorkerPool(size_t numThreads) : mDesiredThreadCount(numThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t numThreads)
+    : mNextQueue(0),
+      mPendingTaskCounts{},
+      mRunningBackgroundTaskCount(0),
+      mMaxRunningBackgroundTaskCount(numThreads > 1 ? numThreads - 1 : 1),
+      mTerminated(false),
+      mDesiredThreadCount(numThreads)
 {
     ASSERT(mDesiredThreadCount != 0);
+
+    mQueues.reserve(mDesiredThreadCount);
+    for (size_t i = 0; i < mDesiredThreadCount; ++i)
+    {
+        mQueues.push_back(std::make_unique<WorkerQueue>());
+    }
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
     {
         std::unique_lock<std::mutex> lock(mMutex);
-        // Mark each task's AsyncWaitableEvent as aborted and drain the task queue
-        for (; !mTaskQueue.empty(); mTaskQueue.pop())
-        {
-            auto task = mTaskQueue.front();
-            task.first->markAsAborted();
-        }
         mTerminated = true;
     }
     mCondVar.notify_all();
@@ -145,6 +194,18 @@ AsyncWorkerPool::~AsyncWorkerPool()
         ASSERT(thread.get_id() != std::this_thread::get_id());
         thread.join();
     }
+
+    // Mark each remaining task's AsyncWaitableEvent as aborted
+    for (std::unique_ptr<WorkerQueue> &queue : mQueues)
+    {
+        for (std::deque<Task> &lane : queue->lanes)
+        {
+            for (Task &task : lane)
+            {
+                task.waitable->markAsAborted();
+            }
+        }
+    }
 }
 
 void AsyncWorkerPool::createThreads()
@@ -157,57 +218,143 @@ void AsyncWorkerPool::createThreads()
 
     for (size_t i = 0; i < mDesiredThreadCount; ++i)
     {
-        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this, i);
     }
 }
 
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task)
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                               WorkerTaskPriority priority)
 {
-    // Thread safety: This function is thread-safe because access to |mTaskQueue| is protected by
-    // |mMutex|.
-    auto waitable = std::make_shared<AsyncWaitableEvent>();
+    // Thread safety: This function is thread-safe because access to each queue is protected by
+    // its own mutex, and the thread creation by |mMutex|.
+    auto waitable     = std::make_shared<AsyncWaitableEvent>();
+    const size_t lane = static_cast<size_t>(priority);
+    const size_t workerIndex =
+        tCurrentWorkerPool == this
+            ? tCurrentWorkerIndex
+            : mNextQueue.fetch_add(1, std::memory_order_relaxed) % mQueues.size();
+    WorkerQueue &queue = *mQueues[workerIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.lanes[lane].push_back({waitable, task});
+        mPendingTaskCounts[lane].fetch_add(1);
+    }
+
     {
+        // Lazily create the threads on first task.  Taking the lock also makes sure a worker that
+        // found no task has either started waiting or will see the new count.
         std::lock_guard<std::mutex> lock(mMutex);
         ASSERT(!mTerminated);
-
-        // Lazily create the threads on first task
         createThreads();
-
-        mTaskQueue.push(std::make_pair(waitable, task));
     }
     mCondVar.notify_one();
     return waitable;
 }
 
-void AsyncWorkerPool::threadLoop()
+bool AsyncWorkerPool::hasRunnableTask() const
+{
+    constexpr size_t kLatencyCritical = static_cast<size_t>(WorkerTaskPriority::LatencyCritical);
+    constexpr size_t kBackground      = static_cast<size_t>(WorkerTaskPriority::Background);
+    return mPendingTaskCounts[kLatencyCritical] > 0 ||
+           (mPendingTaskCounts[kBackground] > 0 &&
+            mRunningBackgroundTaskCount < mMaxRunningBackgroundTaskCount);
+}
+
+bool AsyncWorkerPool::tryPopTask(size_t workerIndex, WorkerTaskPriority priority, Task *taskOut)
+{
+    const size_t lane = static_cast<size_t>(priority);
+    if (mPendingTaskCounts[lane] == 0)
+    {
+        return false;
+    }
+
+    // Start with the worker's own queue, then steal from the others.
+    for (size_t offset = 0; offset < mQueues.size(); ++offset)
+    {
+        const bool isOwnQueue = offset == 0;
+        WorkerQueue &queue    = *mQueues[(workerIndex + offset) % mQueues.size()];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        std::deque<Task> &tasks = queue.lanes[lane];
+        if (tasks.empty())
+        {
+            continue;
+        }
+
+        if (isOwnQueue)
+        {
+            *taskOut = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        else
+        {
+            *taskOut = std::move(tasks.back());
+            tasks.pop_back();
+        }
+        mPendingTaskCounts[lane].fetch_sub(1);
+        return true;
+    }
+
+    return false;
+}
+
+bool AsyncWorkerPool::tryAcquireBackgroundSlot()
+{
+    size_t runningCount = mRunningBackgroundTaskCount;
+    while (runningCount < mMaxRunningBackgroundTaskCount)
+    {
+        if (mRunningBackgroundTaskCount.compare_exchange_weak(runningCount, runningCount + 1))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AsyncWorkerPool::threadLoop(size_t workerIndex)
 {
     angle::SetCurrentThreadName("ANGLE-Worker");
+    tCurrentWorkerPool  = this;
+    tCurrentWorkerIndex = workerIndex;
 
-    while (true)
+    while (!mTerminated)
     {
         Task task;
+        bool isBackgroundTask = false;
+        if (!tryPopTask(workerIndex, WorkerTaskPriority::LatencyCritical, &task))
         {
-            std::unique_lock<std::mutex> lock(mMutex);
-            mCondVar.wait(lock, [this] { return !mTaskQueue.empty() || mTerminated; });
-            if (mTerminated)
+            isBackgroundTask = tryAcquireBackgroundSlot();
+            if (isBackgroundTask && !tryPopTask(workerIndex, WorkerTaskPriority::Background, &task))
             {
-                ASSERT(mTaskQueue.empty());
-                return;
+                mRunningBackgroundTaskCount.fetch_sub(1);
+                isBackgroundTask = false;
             }
-            task = mTaskQueue.front();
-            mTaskQueue.pop();
         }
 
-        auto &waitable = task.first;
-        auto &closure  = task.second;
+        if (!task.closure)
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondVar.wait(lock, [this] { return hasRunnableTask() || mTerminated; });
+            continue;
+        }
 
         // Note: always add an ANGLE_TRACE_EVENT* macro in the closure.  Then the job will show up
         // in traces.
-        (*closure)();
+        (*task.closure)();
         // Release shared_ptr<Closure> before notifying the event to allow for destructor based
         // dependencies (example: anglebug.com/42267099)
-        task.second.reset();
-        waitable->markAsReady();
+        task.closure.reset();
+        task.waitable->markAsReady();
+
+        if (isBackgroundTask)
+        {
+            // Another background task may have been waiting for this slot.
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mRunningBackgroundTaskCount.fetch_sub(1);
+            }
+            mCondVar.notify_one();
+        }
     }
 }
 
@@ -218,8 +365,12 @@ bool AsyncWorkerPool::isAsync()
 
 size_t AsyncWorkerPool::getEnqueuedTaskCount()
 {
-    std::unique_lock<std::mutex> lock(mMutex);
-    return mTaskQueue.size();
+    size_t count = 0;
+    for (const std::atomic<size_t> &laneCount : mPendingTaskCounts)
+    {
+        count += laneCount;
+    }
+    return count;
 }
 
 #endif  // ANGLE_STD_ASYNC_WORKERS
@@ -232,7 +383,9 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool(PlatformMethods *platform) : mPlatform(platform) {}
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    using WorkerThreadPool::postWorkerTask;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
@@ -271,7 +424,8 @@ class DelegateWorkerTask
 
 ANGLE_NO_SANITIZE_CFI_ICALL
 std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
     if (mPlatform->postWorkerTask == nullptr)
     {
@@ -284,6 +438,8 @@ std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(
     // Thread safety: This function is thread-safe because the |postWorkerTask| platform method is
     // expected to be thread safe.  For Chromium, that forwards the call to the |TaskTracker| class
     // in base/task/thread_pool/task_tracker.h which is thread-safe.
+    //
+    // The platform method has no notion of priority, so |priority| is ignored.
     auto waitable = std::make_shared<AsyncWaitableEvent>();
 
     // The task will be deleted by DelegateWorkerTask::RunTask(...) after its execution.
@@ -12,6 +12,7 @@
 #define COMMON_WORKER_THREAD_H_
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -33,6 +34,20 @@ class Closure
     virtual void operator()() = 0;
 };
 
+// Lets the owner of a posted task tell it that its result is no longer needed.  Tasks check the
+// token at convenient points and skip the rest of their work.  Cancellation is only a hint; the
+// task's event is still signaled when it returns, and whoever waits on it must expect the result
+// of a task that stopped early.
+class CancellationToken final : angle::NonCopyable
+{
+  public:
+    void cancel() { mCancelled.store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return mCancelled.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<bool> mCancelled{false};
+};
+
 // An event that we can wait on, useful for joining worker threads.
 class WaitableEvent : angle::NonCopyable
 {
@@ -102,12 +117,64 @@ class AsyncWaitableEvent final : public WaitableEvent
     std::condition_variable mCondition;
 };
 
+// A signal that any number of threads can raise to wake up a single consumer thread, such as a
+// dedicated clean up thread.  Raising the signal while the consumer is busy or already signaled is
+// a single atomic operation.  The consumer only blocks (on a futex on most platforms) when there is
+// nothing to do.
+class WorkSignal final : angle::NonCopyable
+{
+  public:
+    // Wakes the consumer up, or makes its next wait() return immediately.
+    void raise()
+    {
+        if (mState.fetch_or(kRaised, std::memory_order_release) == kClear)
+        {
+            mState.notify_one();
+        }
+    }
+
+    // Wakes the consumer up for good; wait() returns false from then on.
+    void terminate()
+    {
+        mState.fetch_or(kTerminated, std::memory_order_release);
+        mState.notify_one();
+    }
+
+    // Must only be called by the consumer.  Blocks until the signal is raised or terminated, and
+    // clears it.  Returns false if terminated.
+    bool wait()
+    {
+        mState.wait(kClear, std::memory_order_acquire);
+        const uint32_t state = mState.fetch_and(~kRaised, std::memory_order_acq_rel);
+        return (state & kTerminated) == 0;
+    }
+
+  private:
+    static constexpr uint32_t kClear      = 0;
+    static constexpr uint32_t kRaised     = 1;
+    static constexpr uint32_t kTerminated = 2;
+
+    std::atomic<uint32_t> mState{kClear};
+};
+
 enum class ThreadPoolType
 {
     Asynchronous = 0,
     Synchronous  = 1,
 };
 
+// The lane a task is queued in.  Queued latency critical tasks, such as compile and link jobs that
+// the application may be waiting on, are always picked before background tasks, such as pipeline
+// warm-up and pipeline cache compression.
+enum class WorkerTaskPriority
+{
+    LatencyCritical = 0,
+    Background      = 1,
+
+    InvalidEnum = 2,
+    EnumCount   = 2,
+};
+
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
 // we avoid the costly spin up and spin down time.
 class WorkerThreadPool : angle::NonCopyable
@@ -133,7 +200,12 @@ class WorkerThreadPool : angle::NonCopyable
 
     // Returns an event to wait on for the task to finish.  If the pool fails to create the task,
     // returns null.  This function is thread-safe.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) = 0;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task)
+    {
+        return postWorkerTask(task, WorkerTaskPriority::LatencyCritical);
+    }
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                          WorkerTaskPriority priority) = 0;
 
     virtual bool isAsync() = 0;
 
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <thread>
 
 #include "common/WorkerThread.h"
 
@@ -122,4 +123,138 @@ TEST(WorkerPoolTest, AsyncPoolWithOneThreadTest)
     EXPECT_EQ(callCount, kTaskCount * kCallbackSteps);
 }
 
+// A task that waits for a gate to open, then records its id.
+class GatedTask : public Closure
+{
+  public:
+    GatedTask(std::shared_ptr<AsyncWaitableEvent> gate,
+              std::mutex *mutex,
+              std::vector<int> *order,
+              int id)
+        : mGate(gate), mMutex(mutex), mOrder(order), mId(id)
+    {}
+    void operator()() override
+    {
+        if (mGate)
+        {
+            mGate->wait();
+        }
+        std::lock_guard<std::mutex> lock(*mMutex);
+        mOrder->push_back(mId);
+    }
+
+  private:
+    std::shared_ptr<AsyncWaitableEvent> mGate;
+    std::mutex *mMutex;
+    std::vector<int> *mOrder;
+    int mId;
+};
+
+// Tests that queued latency critical tasks run before queued background tasks.
+TEST(WorkerPoolTest, AsyncPoolPriorityTest)
+{
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 1, ANGLEPlatformCurrent());
+
+    auto gate = std::make_shared<AsyncWaitableEvent>();
+    std::mutex mutex;
+    std::vector<int> order;
+
+    // Keep the only worker busy while the other tasks are queued.
+    std::array<std::shared_ptr<WaitableEvent>, 4> waitables = {
+        {pool->postWorkerTask(std::make_shared<GatedTask>(gate, &mutex, &order, 0)),
+         pool->postWorkerTask(std::make_shared<GatedTask>(nullptr, &mutex, &order, 1),
+                              WorkerTaskPriority::Background),
+         pool->postWorkerTask(std::make_shared<GatedTask>(nullptr, &mutex, &order, 2),
+                              WorkerTaskPriority::Background),
+         pool->postWorkerTask(std::make_shared<GatedTask>(nullptr, &mutex, &order, 3),
+                              WorkerTaskPriority::LatencyCritical)}};
+    gate->markAsReady();
+
+    WaitableEvent::WaitMany(&waitables);
+
+    EXPECT_EQ(order, (std::vector<int>{0, 3, 1, 2}));
+}
+
+// Tests that background tasks don't keep latency critical tasks from running.
+TEST(WorkerPoolTest, AsyncPoolBackgroundTasksLeaveWorkerFree)
+{
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 2, ANGLEPlatformCurrent());
+
+    auto gate = std::make_shared<AsyncWaitableEvent>();
+    std::mutex mutex;
+    std::vector<int> order;
+
+    std::array<std::shared_ptr<WaitableEvent>, 2> backgroundWaitables = {
+        {pool->postWorkerTask(std::make_shared<GatedTask>(gate, &mutex, &order, 0),
+                              WorkerTaskPriority::Background),
+         pool->postWorkerTask(std::make_shared<GatedTask>(gate, &mutex, &order, 1),
+                              WorkerTaskPriority::Background)}};
+
+    // Would never finish if both workers were blocked in background tasks.
+    pool->postWorkerTask(std::make_shared<GatedTask>(nullptr, &mutex, &order, 2))->wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        EXPECT_EQ(order, std::vector<int>{2});
+    }
+
+    gate->markAsReady();
+    WaitableEvent::WaitMany(&backgroundWaitables);
+    EXPECT_EQ(order.size(), 3u);
+}
+
+// Tests that WorkSignal::wait returns right away if the signal was raised or terminated earlier.
+TEST(WorkerPoolTest, WorkSignalRaiseBeforeWait)
+{
+    WorkSignal signal;
+
+    signal.raise();
+    signal.raise();
+    EXPECT_TRUE(signal.wait());
+
+    signal.raise();
+    signal.terminate();
+    EXPECT_FALSE(signal.wait());
+    EXPECT_FALSE(signal.wait());
+}
+
+// Tests that no wake up is lost when many threads raise a WorkSignal concurrently.
+TEST(WorkerPoolTest, WorkSignalConcurrentRaise)
+{
+    constexpr uint32_t kProducerCount   = 4;
+    constexpr uint32_t kRaisesPerThread = 10000;
+
+    WorkSignal signal;
+    std::atomic<uint32_t> produced = 0;
+
+    std::thread consumer([&]() {
+        // Every item produced before a raise must be visible after the wait that consumes it.
+        while (produced.load() < kProducerCount * kRaisesPerThread)
+        {
+            ASSERT_TRUE(signal.wait());
+        }
+    });
+
+    std::array<std::thread, kProducerCount> producers;
+    for (std::thread &producer : producers)
+    {
+        producer = std::thread([&]() {
+            for (uint32_t i = 0; i < kRaisesPerThread; ++i)
+            {
+                produced.fetch_add(1);
+                signal.raise();
+            }
+        });
+    }
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    // A lost wake up would leave the consumer blocked forever.
+    consumer.join();
+    EXPECT_EQ(produced.load(), kProducerCount * kRaisesPerThread);
+}
+
 }  // anonymous namespace
@@ -102,6 +102,8 @@ struct PerfMonitorTriplet
     FN(vkQueueSubmitCallsPerFrame)                 \
     FN(commandQueueWaitSemaphoresTotal)            \
     FN(renderPasses)                               \
+    FN(renderPassesExecutedInline)                 \
+    FN(renderPassesExecutedFromSecondaries)        \
     FN(writeDescriptorSets)                        \
     FN(flushedOutsideRenderPassCommandBuffers)     \
     FN(swapchainCreate)                            \
@@ -133,11 +135,23 @@ struct PerfMonitorTriplet
     FN(depthAttachmentResolves)                    \
     FN(stencilAttachmentResolves)                  \
     FN(readOnlyDepthStencilRenderPasses)           \
+    FN(attachmentLoadBytes)                        \
+    FN(attachmentStoreBytes)                       \
+    FN(attachmentResolveBytes)                     \
+    FN(attachmentUnresolveBytes)                   \
     FN(pipelineCreationCacheHits)                  \
     FN(pipelineCreationCacheMisses)                \
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
     FN(monolithicPipelineCreation)                 \
+    FN(monolithicPipelinePrewarms)                 \
+    FN(completeGraphicsPipelineCreations)          \
+    FN(shadersGraphicsPipelineCreations)           \
+    FN(graphicsPipelineWarmUpHits)                 \
+    FN(maxGraphicsPipelinesPerProgram)             \
+    FN(spirvTransforms)                            \
+    FN(shaderModuleCreations)                      \
+    FN(shaderModuleCacheHits)                      \
     FN(descriptorSetAllocations)                   \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
@@ -158,14 +172,43 @@ struct PerfMonitorTriplet
     FN(fallbackFromTileMemory)                     \
     FN(mutableTexturesUploaded)                    \
     FN(fullImageClears)                            \
+    FN(bufferToImageCopyCommands)                  \
+    FN(bufferToImageCopyRegions)                   \
     FN(buffersGhosted)                             \
+    FN(bufferGhostBytesPerFrame)                   \
     FN(vertexArraySyncStateCalls)                  \
     FN(allocateNewBufferBlockCalls)                \
     FN(bufferSuballocationCalls)                   \
     FN(dynamicBufferAllocations)                   \
     FN(framebufferCacheSize)                       \
+    FN(framebufferCompletenessCacheHits)           \
+    FN(framebufferCompletenessCacheMisses)         \
     FN(pendingSubmissionGarbageObjects)            \
-    FN(graphicsDriverUniformsUpdated)
+    FN(graphicsDriverUniformsUpdated)              \
+    FN(appRenderPassGpuTimeNs)                     \
+    FN(internalRenderPassGpuTimeNs)                \
+    FN(outsideRenderPassGpuTimeNs)
+
+#define ANGLE_D3D11_PERF_COUNTERS_X(FN) \
+    FN(blendStateCacheHits)             \
+    FN(blendStateCacheMisses)           \
+    FN(rasterizerStateCacheHits)        \
+    FN(rasterizerStateCacheMisses)      \
+    FN(depthStencilStateCacheHits)      \
+    FN(depthStencilStateCacheMisses)    \
+    FN(samplerStateCacheHits)           \
+    FN(samplerStateCacheMisses)         \
+    FN(inputLayoutCacheHits)            \
+    FN(inputLayoutCacheMisses)          \
+    FN(prewarmedRenderStates)
+
+// Calls into StateManagerGL, and how many of those were not filtered as redundant and reached the
+// driver.
+#define ANGLE_GL_PERF_COUNTERS_X(FN) \
+    FN(bindingCalls)                 \
+    FN(bindingCallsIssued)           \
+    FN(stateCalls)                   \
+    FN(stateCallsIssued)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
@@ -174,6 +217,16 @@ struct VulkanPerfCounters
     ANGLE_VK_PERF_COUNTERS_X(ANGLE_DECLARE_PERF_COUNTER)
 };
 
+struct D3D11PerfCounters
+{
+    ANGLE_D3D11_PERF_COUNTERS_X(ANGLE_DECLARE_PERF_COUNTER)
+};
+
+struct GLPerfCounters
+{
+    ANGLE_GL_PERF_COUNTERS_X(ANGLE_DECLARE_PERF_COUNTER)
+};
+
 #undef ANGLE_DECLARE_PERF_COUNTER
 
 }  // namespace angle
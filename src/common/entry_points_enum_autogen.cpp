@@ -506,6 +506,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glAlphaFuncx";
         case EntryPoint::GLAttachShader:
             return "glAttachShader";
+        case EntryPoint::GLBeginConditionalRenderNV:
+            return "glBeginConditionalRenderNV";
         case EntryPoint::GLBeginPerfMonitorAMD:
             return "glBeginPerfMonitorAMD";
         case EntryPoint::GLBeginPixelLocalStorageANGLE:
@@ -894,6 +896,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glEnableiEXT";
         case EntryPoint::GLEnableiOES:
             return "glEnableiOES";
+        case EntryPoint::GLEndConditionalRenderNV:
+            return "glEndConditionalRenderNV";
         case EntryPoint::GLEndPerfMonitorAMD:
             return "glEndPerfMonitorAMD";
         case EntryPoint::GLEndPixelLocalStorageANGLE:
@@ -259,6 +259,7 @@ enum class EntryPoint
     GLAlphaFunc,
     GLAlphaFuncx,
     GLAttachShader,
+    GLBeginConditionalRenderNV,
     GLBeginPerfMonitorAMD,
     GLBeginPixelLocalStorageANGLE,
     GLBeginQuery,
@@ -453,6 +454,7 @@ enum class EntryPoint
     GLEnablei,
     GLEnableiEXT,
     GLEnableiOES,
+    GLEndConditionalRenderNV,
     GLEndPerfMonitorAMD,
     GLEndPixelLocalStorageANGLE,
     GLEndPixelLocalStorageImplicitANGLE,
@@ -6,11 +6,252 @@
 
 #include "common/debug.h"
 
+#if defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
+#    include <array>
+#    include <atomic>
+#    include <chrono>
+#    include <cstddef>
+#    include <cstdio>
+#    include <cstring>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <vector>
+
+#    include "common/base/anglebase/trace_event/trace_event.h"
+#    include "common/string_utils.h"
+#    include "common/system_utils.h"
+#    include "common/unsafe_buffers.h"
+#endif  // defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
+
 namespace angle
 {
+#if defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
+namespace
+{
+// With native trace events, the events are recorded by ANGLE itself instead of going through
+// PlatformMethods, and are written at exit to the file named by ANGLE_TRACE_EVENTS_FILE in the
+// JSON trace event format, which Perfetto's UI and chrome://tracing load.  Recording an event only
+// takes a timestamp and stores a few words in a buffer owned by the calling thread.  Event names
+// are string literals, so they are stored by pointer and only formatted when the file is
+// written.  Event arguments are dropped.
+struct NativeTraceCategory
+{
+    // The address of |enabled| is the category enabled flag given to the trace event macros, which
+    // identifies the category when an event is added.
+    unsigned char enabled;
+    const char *name;
+};
+
+// The categories are known at compile time.  The ones listed in ANGLE_TRACE_CATEGORIES (with
+// wildcards, separated by ':') are enabled, or all of them if that's not set.
+NativeTraceCategory gNativeTraceCategories[] = {
+    {0, "gpu.angle"},
+};
+
+struct NativeTraceEvent
+{
+    uint64_t timestampNs;
+    unsigned long long id;
+    const char *name;
+    uint8_t categoryIndex;
+    char phase;
+    unsigned char flags;
+};
+
+// The number of events each thread keeps.  Once full, the oldest events are overwritten, so a
+// long run keeps its last few seconds.
+constexpr size_t kNativeTraceEventsPerThread = 16384;
+
+struct NativeTraceThreadBuffer
+{
+    uint32_t threadIndex = 0;
+    // The number of events ever added, only written by the owning thread.
+    std::atomic<uint64_t> eventCount = 0;
+    std::array<NativeTraceEvent, kNativeTraceEventsPerThread> events;
+};
+
+void WriteJSONString(FILE *file, const char *str)
+{
+    fputc('"', file);
+    for (const char *ch = str; *ch != '\0'; ANGLE_UNSAFE_TODO(++ch))
+    {
+        if (*ch == '"' || *ch == '\\')
+        {
+            fputc('\\', file);
+        }
+        fputc(*ch, file);
+    }
+    fputc('"', file);
+}
+
+class NativeTracer final : angle::NonCopyable
+{
+  public:
+    NativeTracer() : mStartTime(std::chrono::steady_clock::now())
+    {
+        mOutputFile = GetEnvironmentVar("ANGLE_TRACE_EVENTS_FILE");
+        if (mOutputFile.empty())
+        {
+            return;
+        }
+
+        std::vector<std::string> enabledCategories = GetStringsFromEnvironmentVarOrAndroidProperty(
+            "ANGLE_TRACE_CATEGORIES", "debug.angle.trace_categories", ":");
+        for (NativeTraceCategory &category : gNativeTraceCategories)
+        {
+            category.enabled = enabledCategories.empty() ? 1 : 0;
+            for (const std::string &enabledCategory : enabledCategories)
+            {
+                if (NamesMatchWithWildcard(enabledCategory.c_str(), category.name))
+                {
+                    category.enabled = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    ~NativeTracer()
+    {
+        if (!mOutputFile.empty())
+        {
+            writeEvents();
+        }
+    }
+
+    uint64_t getTimestampNs() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - mStartTime)
+            .count();
+    }
+
+    NativeTraceThreadBuffer *getThreadBuffer()
+    {
+        thread_local NativeTraceThreadBuffer *tThreadBuffer = nullptr;
+        if (tThreadBuffer == nullptr)
+        {
+            // The buffers outlive their threads so that their events can be written at exit.
+            std::lock_guard<std::mutex> lock(mMutex);
+            mThreadBuffers.push_back(std::make_unique<NativeTraceThreadBuffer>());
+            tThreadBuffer              = mThreadBuffers.back().get();
+            tThreadBuffer->threadIndex = static_cast<uint32_t>(mThreadBuffers.size());
+        }
+        return tThreadBuffer;
+    }
+
+  private:
+    void writeEvents()
+    {
+        FILE *file = fopen(mOutputFile.c_str(), "w");
+        if (file == nullptr)
+        {
+            return;
+        }
+
+        fputs("{\"traceEvents\":[", file);
+        bool first = true;
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (const std::unique_ptr<NativeTraceThreadBuffer> &buffer : mThreadBuffers)
+        {
+            const uint64_t eventCount = buffer->eventCount.load(std::memory_order_acquire);
+            const uint64_t firstEvent =
+                eventCount > kNativeTraceEventsPerThread ? eventCount - kNativeTraceEventsPerThread
+                                                         : 0;
+            for (uint64_t eventIndex = firstEvent; eventIndex < eventCount; ++eventIndex)
+            {
+                const NativeTraceEvent &event =
+                    buffer->events[eventIndex % kNativeTraceEventsPerThread];
+
+                fputs(first ? "\n{\"name\":" : ",\n{\"name\":", file);
+                first = false;
+                WriteJSONString(file, event.name);
+                fputs(",\"cat\":", file);
+                WriteJSONString(file, gNativeTraceCategories[event.categoryIndex].name);
+                fprintf(file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u", event.phase,
+                        static_cast<double>(event.timestampNs) / 1000.0, buffer->threadIndex);
+                if ((event.flags & TRACE_EVENT_FLAG_HAS_ID) != 0)
+                {
+                    fprintf(file, ",\"id\":\"0x%llx\"", event.id);
+                }
+                if (event.phase == TRACE_EVENT_PHASE_INSTANT)
+                {
+                    fputs(",\"s\":\"t\"", file);
+                }
+                fputc('}', file);
+            }
+        }
+
+        fputs("\n]}\n", file);
+        fclose(file);
+    }
+
+    const std::chrono::steady_clock::time_point mStartTime;
+    std::string mOutputFile;
+
+    std::mutex mMutex;
+    std::vector<std::unique_ptr<NativeTraceThreadBuffer>> mThreadBuffers;
+};
+
+NativeTracer &GetNativeTracer()
+{
+    static NativeTracer tracer;
+    return tracer;
+}
+
+const unsigned char *GetNativeTraceCategoryEnabledFlag(const char *name)
+{
+    // Make sure the categories are enabled from the environment before they are returned.
+    GetNativeTracer();
+
+    for (const NativeTraceCategory &category : gNativeTraceCategories)
+    {
+        if (ANGLE_UNSAFE_TODO(strcmp(category.name, name)) == 0)
+        {
+            return &category.enabled;
+        }
+    }
+
+    static unsigned char disabled = 0;
+    return &disabled;
+}
+
+void AddNativeTraceEvent(char phase,
+                         const unsigned char *categoryGroupEnabled,
+                         const char *name,
+                         unsigned long long id,
+                         unsigned char flags)
+{
+    static_assert(offsetof(NativeTraceCategory, enabled) == 0,
+                  "|enabled| must be the first field of NativeTraceCategory");
+    const NativeTraceCategory *category =
+        reinterpret_cast<const NativeTraceCategory *>(categoryGroupEnabled);
+    const ptrdiff_t categoryIndex = ANGLE_UNSAFE_TODO(category - gNativeTraceCategories);
+    ASSERT(categoryIndex >= 0 &&
+           static_cast<size_t>(categoryIndex) < ArraySize(gNativeTraceCategories));
+
+    NativeTracer &tracer            = GetNativeTracer();
+    NativeTraceThreadBuffer *buffer = tracer.getThreadBuffer();
+    const uint64_t eventIndex       = buffer->eventCount.load(std::memory_order_relaxed);
+    NativeTraceEvent &event         = buffer->events[eventIndex % kNativeTraceEventsPerThread];
+    event.timestampNs               = tracer.getTimestampNs();
+    event.id                        = id;
+    event.name                      = name;
+    event.categoryIndex             = static_cast<uint8_t>(categoryIndex);
+    event.phase                     = phase;
+    event.flags                     = flags;
+    buffer->eventCount.store(eventIndex + 1, std::memory_order_release);
+}
+}  // anonymous namespace
+#endif  // defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
 
 const unsigned char *GetTraceCategoryEnabledFlag(PlatformMethods *platform, const char *name)
 {
+#if defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
+    return GetNativeTraceCategoryEnabledFlag(name);
+#else
     ASSERT(platform);
 
     const unsigned char *categoryEnabledFlag =
@@ -22,6 +263,7 @@ const unsigned char *GetTraceCategoryEnabledFlag(PlatformMethods *platform, cons
 
     static unsigned char disabled = 0;
     return &disabled;
+#endif  // defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
 }
 
 angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
@@ -35,13 +277,17 @@ angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+#if defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
+    AddNativeTraceEvent(phase, categoryGroupEnabled, name, id, flags);
+    return static_cast<angle::TraceEventHandle>(0);
+#else
     ASSERT(platform);
 
-#if defined(ANGLE_TRACE_EVENTS_IGNORE_TIMESTAMP)
+#    if defined(ANGLE_TRACE_EVENTS_IGNORE_TIMESTAMP)
     double timestamp = 1.0;  // Value doesn't matter, not used by the callback.
-#else
+#    else
     double timestamp = platform->monotonicallyIncreasingTime(platform);
-#endif
+#    endif
 
     if (timestamp != 0)
     {
@@ -52,6 +298,7 @@ angle::TraceEventHandle AddTraceEvent(PlatformMethods *platform,
     }
 
     return static_cast<angle::TraceEventHandle>(0);
+#endif  // defined(ANGLE_ENABLE_NATIVE_TRACE_EVENTS)
 }
 
 }  // namespace angle
@@ -18,8 +18,18 @@
 #include "frame_capture_binary_data.h"
 
 #include <array>
+#include <memory>
 #include <string>
 
+#if defined(ANGLE_PLATFORM_WINDOWS)
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 namespace angle
 {
 
@@ -371,6 +381,114 @@ class ZLibHelper
     bool mInitialized;
 };
 
+// Read-only memory mapping of a whole file.  The OS pages the data in as it is accessed and can
+// drop clean pages under memory pressure, so large uncompressed traces don't need to be copied
+// into heap allocations before replay starts.
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+    ~MappedFile() { unmap(); }
+
+    MappedFile(const MappedFile &)            = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool map(const std::string &filePath)
+    {
+        ASSERT(mData == nullptr);
+#if defined(ANGLE_PLATFORM_WINDOWS)
+        mFile = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mFile == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(mFile, &fileSize) || fileSize.QuadPart == 0 ||
+            static_cast<unsigned long long>(fileSize.QuadPart) > SIZE_MAX)
+        {
+            unmap();
+            return false;
+        }
+        mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mMapping == nullptr)
+        {
+            unmap();
+            return false;
+        }
+        void *data = MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            unmap();
+            return false;
+        }
+        mSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int fd = open(filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 ||
+            static_cast<unsigned long long>(fileStat.st_size) > SIZE_MAX)
+        {
+            close(fd);
+            return false;
+        }
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+        void *data        = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file.
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+        mSize = size;
+#endif
+        mData = static_cast<uint8_t *>(data);
+        return true;
+    }
+
+    void unmap()
+    {
+#if defined(ANGLE_PLATFORM_WINDOWS)
+        if (mData != nullptr)
+        {
+            UnmapViewOfFile(mData);
+        }
+        if (mMapping != nullptr)
+        {
+            CloseHandle(mMapping);
+            mMapping = nullptr;
+        }
+        if (mFile != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(mFile);
+            mFile = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (mData != nullptr)
+        {
+            munmap(mData, mSize);
+        }
+#endif
+        mData = nullptr;
+        mSize = 0;
+    }
+
+    uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    uint8_t *mData = nullptr;
+    size_t mSize   = 0;
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    HANDLE mFile    = INVALID_HANDLE_VALUE;
+    HANDLE mMapping = nullptr;
+#endif
+};
+
 // Configure binary data output parameters and prepare file for writing
 void FrameCaptureBinaryData::initializeBinaryDataStore(bool compression,
                                                        const std::string &outDir,
@@ -497,6 +615,19 @@ void FrameCaptureBinaryData::initializeBinaryDataLoader()
     // Assemble binary data file/cache index
     constructBlockDescIndex(mIndexOffset);
 
+    // Uncompressed data can be used in place, so no block ever needs to be read or swapped.
+    if (!mIsBinaryDataCompressed && mapBinaryDataFile())
+    {
+        updateGetDataCache(0);
+        return;
+    }
+
+    // Only data that doesn't fit in the resident blocks needs to be prefetched.
+    if (mPrefetchEnabled && mReplayBlockDescriptions.size() > mMaxResidentBlockIndex + 1)
+    {
+        startPrefetchThread();
+    }
+
     // Preload binary data blocks up to limit
     size_t blocksToPreload =
         std::min(mReplayBlockDescriptions.size(), (mMaxResidentBlockIndex + 1));
@@ -509,67 +640,228 @@ void FrameCaptureBinaryData::initializeBinaryDataLoader()
     updateGetDataCache(0);
 }
 
+bool FrameCaptureBinaryData::mapBinaryDataFile()
+{
+    ASSERT(!mIsBinaryDataCompressed);
+    if (mReplayBlockDescriptions.empty())
+    {
+        return false;
+    }
+
+    // Mapping may fail, e.g. for large traces in a 32-bit process; reading the blocks into memory
+    // is used in that case.
+    std::unique_ptr<MappedFile> mappedFile(new MappedFile);
+    if (!mappedFile->map(mFileName))
+    {
+        return false;
+    }
+
+    const ReplayBlockDescription &lastBlock = mReplayBlockDescriptions.back();
+    if (lastBlock.fileOffset + lastBlock.dataSize > mappedFile->size())
+    {
+        return false;
+    }
+
+    for (size_t blockId = 0; blockId < mReplayBlockDescriptions.size(); ++blockId)
+    {
+        setBlockResident(blockId,
+                         mappedFile->data() + mReplayBlockDescriptions[blockId].fileOffset);
+    }
+
+    mMappedFile = mappedFile.release();
+    return true;
+}
+
 // Load a single data block into memory
 void FrameCaptureBinaryData::loadBlock(size_t blockId)
 {
+    const bool isTransientBlock = blockId >= mMaxResidentBlockIndex;
+    if (isTransientBlock && takePrefetchedBlock(blockId))
+    {
+        requestPrefetch(blockId + 1);
+        return;
+    }
+
     std::vector<uint8_t> &uncompressedDataBlock = prepareLoadBlock(blockId);
+    mCurrentBlockOffset = readBlock(mFileStream, blockId, uncompressedDataBlock.data());
+
+    // Except for the last block this resize will be a no-op
+    uncompressedDataBlock.resize(mCurrentBlockOffset);
+    // Indicate that this block is now loaded
+    setBlockResident(blockId, uncompressedDataBlock.data());
 
+    if (isTransientBlock)
+    {
+        requestPrefetch(blockId + 1);
+    }
+}
+
+// Read a single data block from the file into blockData, which must be able to hold
+// mDataBlockSize bytes.  Returns the size of the block's data.
+size_t FrameCaptureBinaryData::readBlock(FileStream *fileStream,
+                                         size_t blockId,
+                                         uint8_t *blockData) const
+{
     // Move to start of this data block in the data file
-    mFileStream->seek(mReplayBlockDescriptions[blockId].fileOffset, kSeekBegin);
+    fileStream->seek(mReplayBlockDescriptions[blockId].fileOffset, kSeekBegin);
 
-    if (mIsBinaryDataCompressed)
+    if (!mIsBinaryDataCompressed)
     {
-        // Use zlib library, based on example/doc here: https://zlib.net/zlib_how.html
-        ZLibHelper decompressor(Mode::Load);
-        z_stream *zStream        = decompressor.getStream();
-        int inflateStatus        = 0;
-        size_t bytesDecompressed = 0;
+        return fileStream->read(blockData, mDataBlockSize);
+    }
 
-        using ZlibBuffer = std::array<unsigned char, kZlibBufferSize>;
-        std::unique_ptr<ZlibBuffer> compressedDataBuffer(new ZlibBuffer());
-        zStream->avail_out = static_cast<uInt>(mDataBlockSize);
-        zStream->next_out  = uncompressedDataBlock.data();
+    // Use zlib library, based on example/doc here: https://zlib.net/zlib_how.html
+    ZLibHelper decompressor(Mode::Load);
+    z_stream *zStream        = decompressor.getStream();
+    int inflateStatus        = 0;
+    size_t bytesDecompressed = 0;
+    size_t blockOffset       = 0;
+
+    using ZlibBuffer = std::array<unsigned char, kZlibBufferSize>;
+    std::unique_ptr<ZlibBuffer> compressedDataBuffer(new ZlibBuffer());
+    zStream->avail_out = static_cast<uInt>(mDataBlockSize);
+    zStream->next_out  = blockData;
+
+    do
+    {
+        if (zStream->avail_in == 0)
+        {
+            zStream->avail_in =
+                static_cast<uInt>(fileStream->read(compressedDataBuffer->data(), kZlibBufferSize));
+            zStream->next_in = compressedDataBuffer->data();
+        }
 
         do
         {
-            if (zStream->avail_in == 0)
+            int availableOutputSpace = static_cast<int>(mDataBlockSize - blockOffset);
+            zStream->avail_out       = availableOutputSpace;
+            zStream->next_out        = blockData + blockOffset;
+            inflateStatus            = inflate(zStream, Z_NO_FLUSH);
+            ASSERT(inflateStatus != Z_STREAM_ERROR);
+            if (inflateStatus == Z_NEED_DICT || inflateStatus == Z_DATA_ERROR ||
+                inflateStatus == Z_MEM_ERROR)
             {
-                zStream->avail_in = static_cast<uInt>(
-                    mFileStream->read(compressedDataBuffer->data(), kZlibBufferSize));
-                zStream->next_in = compressedDataBuffer->data();
+                FATAL() << "Zlib inflate failed: " << inflateStatus;
             }
+            bytesDecompressed = availableOutputSpace - zStream->avail_out;
+            blockOffset += bytesDecompressed;
+        } while (zStream->avail_out == 0 && blockOffset < mDataBlockSize);
+    } while (inflateStatus != Z_STREAM_END && blockOffset != mDataBlockSize);
 
-            do
-            {
-                int availableOutputSpace = static_cast<int>(mDataBlockSize - mCurrentBlockOffset);
-                zStream->avail_out       = availableOutputSpace;
-                zStream->next_out        = uncompressedDataBlock.data() + mCurrentBlockOffset;
-                inflateStatus            = inflate(zStream, Z_NO_FLUSH);
-                ASSERT(inflateStatus != Z_STREAM_ERROR);
-                if (inflateStatus == Z_NEED_DICT || inflateStatus == Z_DATA_ERROR ||
-                    inflateStatus == Z_MEM_ERROR)
-                {
-                    FATAL() << "Zlib inflate failed: " << inflateStatus;
-                }
-                bytesDecompressed = availableOutputSpace - zStream->avail_out;
-                mCurrentBlockOffset += bytesDecompressed;
-            } while (zStream->avail_out == 0 && mCurrentBlockOffset < mDataBlockSize);
-        } while (inflateStatus != Z_STREAM_END && mCurrentBlockOffset != mDataBlockSize);
+    return blockOffset;
+}
+
+void FrameCaptureBinaryData::startPrefetchThread()
+{
+    ASSERT(mPrefetchEnabled && !mPrefetchThread.joinable());
+
+    // The prefetch thread reads the file independently of the replay thread.
+    mPrefetchFileStream = new FileStream(mFileName, Mode::Load);
+    mPrefetchState      = PrefetchState::Idle;
+    mPrefetchBlockId    = kInvalidBlockId;
+    mPrefetchStopping   = false;
+    mPrefetchThread     = std::thread(&FrameCaptureBinaryData::prefetchThread, this);
+}
+
+void FrameCaptureBinaryData::stopPrefetchThread()
+{
+    if (!mPrefetchThread.joinable())
+    {
+        return;
     }
-    else
+
     {
-        mCurrentBlockOffset = mFileStream->read(uncompressedDataBlock.data(), mDataBlockSize);
+        std::lock_guard<std::mutex> lock(mPrefetchMutex);
+        mPrefetchStopping = true;
     }
+    mPrefetchCondition.notify_all();
+    mPrefetchThread.join();
 
-    // Except for the last block this resize will be a no-op
-    uncompressedDataBlock.resize(mCurrentBlockOffset);
-    // Indicate that this block is now loaded
-    setBlockResident(blockId, uncompressedDataBlock.data());
+    delete mPrefetchFileStream;
+    mPrefetchFileStream = nullptr;
+    mPrefetchData       = {};
+}
+
+void FrameCaptureBinaryData::prefetchThread()
+{
+    std::unique_lock<std::mutex> lock(mPrefetchMutex);
+    while (true)
+    {
+        mPrefetchCondition.wait(
+            lock, [this] { return mPrefetchStopping || mPrefetchState == PrefetchState::Pending; });
+        if (mPrefetchStopping)
+        {
+            return;
+        }
+
+        // mPrefetchData is only accessed by this thread while loading.
+        const size_t blockId = mPrefetchBlockId;
+        mPrefetchState       = PrefetchState::Loading;
+        lock.unlock();
+
+        mPrefetchData.resize(mDataBlockSize);
+        mPrefetchData.resize(readBlock(mPrefetchFileStream, blockId, mPrefetchData.data()));
+
+        lock.lock();
+        mPrefetchState = PrefetchState::Ready;
+        mPrefetchCondition.notify_all();
+    }
+}
+
+void FrameCaptureBinaryData::requestPrefetch(size_t blockId)
+{
+    if (!mPrefetchThread.joinable() || blockId >= mReplayBlockDescriptions.size() ||
+        isBlockResident(blockId))
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mPrefetchMutex);
+        // Don't stall the replay on a prefetch that turned out to be useless; the next miss
+        // will try again.
+        if (mPrefetchState == PrefetchState::Loading)
+        {
+            return;
+        }
+        mPrefetchBlockId = blockId;
+        mPrefetchState   = PrefetchState::Pending;
+    }
+    mPrefetchCondition.notify_all();
+}
+
+bool FrameCaptureBinaryData::takePrefetchedBlock(size_t blockId)
+{
+    if (!mPrefetchThread.joinable())
+    {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mPrefetchMutex);
+    if (mPrefetchBlockId != blockId || mPrefetchState == PrefetchState::Idle)
+    {
+        return false;
+    }
+    mPrefetchCondition.wait(lock, [this] { return mPrefetchState == PrefetchState::Ready; });
+
+    // Hand the prefetched data to the swap slot, and give the slot's previous storage to the
+    // prefetch thread for the next block.
+    std::vector<uint8_t> &swapBlock = prepareLoadBlock(blockId);
+    std::swap(swapBlock, mPrefetchData);
+    mPrefetchState   = PrefetchState::Idle;
+    mPrefetchBlockId = kInvalidBlockId;
+
+    mCurrentBlockOffset = swapBlock.size();
+    setBlockResident(blockId, swapBlock.data());
+    return true;
 }
 
 void FrameCaptureBinaryData::closeBinaryDataLoader()
 {
+    stopPrefetchThread();
     clear();
+    delete mMappedFile;
+    mMappedFile = nullptr;
 }
 
 int FileStreamSeek(FILE *stream, long long offset, int whence)
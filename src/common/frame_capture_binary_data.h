@@ -13,7 +13,10 @@
 #include "common/debug.h"
 
 #include <stddef.h>
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace angle
@@ -40,6 +43,7 @@ struct BinaryFileIndexInfo
 };
 
 class FileStream;
+class MappedFile;
 
 class FrameCaptureBinaryData
 {
@@ -70,6 +74,8 @@ class FrameCaptureBinaryData
         uint8_t *residentAddress;  // Memory address if resident, nullptr otherwise
     };
 
+    ~FrameCaptureBinaryData() { stopPrefetchThread(); }
+
     std::vector<std::vector<uint8_t>> &data() { return mData; }
     bool isSwapBlock(size_t blockId) { return blockId == mMaxResidentBlockIndex; }
     size_t totalSize() const;
@@ -79,6 +85,8 @@ class FrameCaptureBinaryData
     void setBlockNonResident(size_t blockId);
     void setBinaryDataSize(size_t binaryDataSize);
     void setBlockSize(size_t blockSize);
+    // During replay, load the block following the current swap block on a helper thread
+    void setPrefetchEnabled(bool enabled) { mPrefetchEnabled = enabled; }
 
     void storeResidentBlocks();
     // Format data for appending to compressed binary file
@@ -102,6 +110,8 @@ class FrameCaptureBinaryData
                                    size_t indexOffset,
                                    const std::string &fileName);
     void initializeBinaryDataLoader();
+    // Map an uncompressed binary data file into memory so blocks are paged in on first use
+    bool mapBinaryDataFile();
     void loadBlock(size_t blockId);
     void closeBinaryDataLoader();
     void updateGetDataCache(size_t blockId);
@@ -109,6 +119,21 @@ class FrameCaptureBinaryData
     std::vector<uint8_t> &prepareStoreBlock(size_t blockId);
 
   private:
+    enum class PrefetchState
+    {
+        Idle,
+        Pending,
+        Loading,
+        Ready,
+    };
+
+    size_t readBlock(FileStream *fileStream, size_t blockId, uint8_t *blockData) const;
+    void startPrefetchThread();
+    void stopPrefetchThread();
+    void prefetchThread();
+    void requestPrefetch(size_t blockId);
+    bool takePrefetchedBlock(size_t blockId);
+
     bool mIsBinaryDataCompressed;
     std::string mFileName;
     size_t mIndexOffset = 0;
@@ -143,6 +168,20 @@ class FrameCaptureBinaryData
     bool mCaptureComplete = false;
 
     FileStream *mFileStream = nullptr;
+    // Read-only view of an uncompressed binary data file, if it could be mapped
+    MappedFile *mMappedFile = nullptr;
+
+    // Prefetching of transient blocks during replay.  mPrefetchData holds the prefetched block,
+    // and is owned by the prefetch thread while mPrefetchState is Loading.
+    bool mPrefetchEnabled = false;
+    std::thread mPrefetchThread;
+    std::mutex mPrefetchMutex;
+    std::condition_variable mPrefetchCondition;
+    PrefetchState mPrefetchState = PrefetchState::Idle;
+    size_t mPrefetchBlockId      = kInvalidBlockId;
+    bool mPrefetchStopping       = false;
+    std::vector<uint8_t> mPrefetchData;
+    FileStream *mPrefetchFileStream = nullptr;
 };
 
 constexpr int kSeekBegin = SEEK_SET;
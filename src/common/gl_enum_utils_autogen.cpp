@@ -2812,6 +2812,8 @@ const char *GLenumToString(GLESEnum enumGroup, unsigned int value)
                     return "GL_RGBX8_ANGLE";
                 case 0x96BB:
                     return "GL_SHADER_BINARY_ANGLE";
+                case 0x96BC:
+                    return "GL_SERIALIZED_CONTEXT_DIGEST_ANGLE";
                 case 0x96BE:
                     return "GL_PROGRAM_BINARY_READY_ANGLE";
                 case 0x96C0:
@@ -3738,6 +3740,23 @@ const char *GLenumToString(GLESEnum enumGroup, unsigned int value)
             }
         }
 
+        case GLESEnum::ConditionalRenderMode:
+        {
+            switch (value)
+            {
+                case 0x8E13:
+                    return "GL_QUERY_WAIT_NV";
+                case 0x8E14:
+                    return "GL_QUERY_NO_WAIT_NV";
+                case 0x8E15:
+                    return "GL_QUERY_BY_REGION_WAIT_NV";
+                case 0x8E16:
+                    return "GL_QUERY_BY_REGION_NO_WAIT_NV";
+                default:
+                    return UnknownEnumToString(value);
+            }
+        }
+
         case GLESEnum::ContainerType:
         {
             switch (value)
@@ -13284,6 +13303,7 @@ static StringEnumEntry g_stringEnumTable[] = {
     {"GL_SEPARATE_ATTRIBS_NV", 0x8C8D},
     {"GL_SEPARATE_SPECULAR_COLOR", 0x81FA},
     {"GL_SEPARATE_SPECULAR_COLOR_EXT", 0x81FA},
+    {"GL_SERIALIZED_CONTEXT_DIGEST_ANGLE", 0x96BC},
     {"GL_SERIALIZED_CONTEXT_STRING_ANGLE", 0x96B0},
     {"GL_SET", 0x150F},
     {"GL_SET_AMD", 0x874A},
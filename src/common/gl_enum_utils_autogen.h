@@ -46,6 +46,7 @@ enum class GLESEnum
     CombinerComponentUsageNV,
     CombinerPortionNV,
     CombinerScaleNV,
+    ConditionalRenderMode,
     ContainerType,
     ContextFlagMask,
     CopyBufferSubDataTarget,
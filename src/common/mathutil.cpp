@@ -6,11 +6,25 @@
 
 // mathutil.cpp: Math and bit manipulation functions.
 
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
 #include "common/mathutil.h"
 
 #include <math.h>
 #include <algorithm>
 
+// SSE2 and NEON are baseline on the targets they are enabled for, so no runtime CPU detection is
+// needed.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_MATHUTIL_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_MATHUTIL_USE_NEON
+#endif
+
 namespace gl
 {
 
@@ -80,6 +94,205 @@ void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float
     *blue  = inputData->B * pow2_exp;
 }
 
+void ConvertFloat16ToFloat32(const uint16_t *source, float *dest, size_t count)
+{
+    // Moves the exponent and mantissa into place and rebiases the exponent, which matches the
+    // lookup tables of float16ToFloat32 bit for bit, NaN payloads included.  Denormals are
+    // normalized with a float subtraction, which is exact.
+    size_t x = 0;
+#if defined(ANGLE_MATHUTIL_USE_SSE2)
+    const __m128i zero           = _mm_setzero_si128();
+    const __m128i absMask        = _mm_set1_epi32(0x7FFF);
+    const __m128i exponentMask   = _mm_set1_epi32(0x0F800000);
+    const __m128i exponentAdjust = _mm_set1_epi32((127 - 15) << 23);
+    const __m128i denormAdjust   = _mm_set1_epi32(1 << 23);
+    const __m128 denormMagic     = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+
+    auto convert4 = [&](__m128i half) {
+        __m128i sign     = _mm_slli_epi32(_mm_andnot_si128(absMask, half), 16);
+        __m128i shifted  = _mm_slli_epi32(_mm_and_si128(half, absMask), 13);
+        __m128i exponent = _mm_and_si128(shifted, exponentMask);
+        shifted          = _mm_add_epi32(shifted, exponentAdjust);
+
+        // Infinity and NaN: the exponent is adjusted again to become all ones.
+        __m128i isInfNaN = _mm_cmpeq_epi32(exponent, exponentMask);
+        shifted          = _mm_add_epi32(shifted, _mm_and_si128(isInfNaN, exponentAdjust));
+
+        __m128i isDenorm = _mm_cmpeq_epi32(exponent, zero);
+        __m128i denorm   = _mm_castps_si128(
+            _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(shifted, denormAdjust)), denormMagic));
+        shifted =
+            _mm_or_si128(_mm_andnot_si128(isDenorm, shifted), _mm_and_si128(isDenorm, denorm));
+
+        return _mm_castsi128_ps(_mm_or_si128(shifted, sign));
+    };
+
+    for (; x + 8 <= count; x += 8)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        _mm_storeu_ps(dest + x, convert4(_mm_unpacklo_epi16(halves, zero)));
+        _mm_storeu_ps(dest + x + 4, convert4(_mm_unpackhi_epi16(halves, zero)));
+    }
+#elif defined(ANGLE_MATHUTIL_USE_NEON)
+    const uint32x4_t absMask        = vdupq_n_u32(0x7FFF);
+    const uint32x4_t exponentMask   = vdupq_n_u32(0x0F800000);
+    const uint32x4_t exponentAdjust = vdupq_n_u32((127 - 15) << 23);
+    const uint32x4_t denormAdjust   = vdupq_n_u32(1 << 23);
+    const float32x4_t denormMagic   = vreinterpretq_f32_u32(vdupq_n_u32(113 << 23));
+
+    auto convert4 = [&](uint32x4_t half) {
+        uint32x4_t sign     = vshlq_n_u32(vbicq_u32(half, absMask), 16);
+        uint32x4_t shifted  = vshlq_n_u32(vandq_u32(half, absMask), 13);
+        uint32x4_t exponent = vandq_u32(shifted, exponentMask);
+        shifted             = vaddq_u32(shifted, exponentAdjust);
+
+        // Infinity and NaN: the exponent is adjusted again to become all ones.
+        uint32x4_t isInfNaN = vceqq_u32(exponent, exponentMask);
+        shifted             = vaddq_u32(shifted, vandq_u32(isInfNaN, exponentAdjust));
+
+        uint32x4_t denorm = vreinterpretq_u32_f32(
+            vsubq_f32(vreinterpretq_f32_u32(vaddq_u32(shifted, denormAdjust)), denormMagic));
+        shifted = vbslq_u32(vceqq_u32(exponent, vdupq_n_u32(0)), denorm, shifted);
+
+        return vreinterpretq_f32_u32(vorrq_u32(shifted, sign));
+    };
+
+    for (; x + 8 <= count; x += 8)
+    {
+        uint16x8_t halves = vld1q_u16(source + x);
+        vst1q_f32(dest + x, convert4(vmovl_u16(vget_low_u16(halves))));
+        vst1q_f32(dest + x + 4, convert4(vmovl_u16(vget_high_u16(halves))));
+    }
+#endif
+    for (; x < count; x++)
+    {
+        dest[x] = float16ToFloat32(source[x]);
+    }
+}
+
+void ConvertFloat32ToFloat16(const float *source, uint16_t *dest, size_t count)
+{
+    // Bit-exact vector versions of float32ToFloat16, including its rounding and its NaN and
+    // infinity encodings.
+    size_t x = 0;
+#if defined(ANGLE_MATHUTIL_USE_SSE2)
+    const __m128i absMask      = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i nanThreshold = _mm_set1_epi32(0x7F800000);
+    const __m128i infThreshold = _mm_set1_epi32(0x47FFEFFF);
+    const __m128i denormLimit  = _mm_set1_epi32(0x38800000);
+    const __m128i bias         = _mm_set1_epi32(static_cast<int>(0xC8000000 + 0x00000FFF));
+    const __m128i one          = _mm_set1_epi32(1);
+    const __m128i nanValue     = _mm_set1_epi32(0x7FFF);
+    const __m128i infValue     = _mm_set1_epi32(0x7C00);
+    const __m128i zero         = _mm_setzero_si128();
+
+    auto convert4 = [&](const float *src, __m128i *result) {
+        __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        __m128i sign = _mm_srli_epi32(_mm_andnot_si128(absMask, bits), 16);
+        __m128i abs  = _mm_and_si128(bits, absMask);
+
+        // SSE2 has no per-lane variable shift, so non-zero denormals are left to the scalar code.
+        __m128i isDenorm = _mm_cmplt_epi32(abs, denormLimit);
+        if (_mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi32(abs, zero), isDenorm)) != 0)
+        {
+            return false;
+        }
+
+        __m128i isInf  = _mm_cmpgt_epi32(abs, infThreshold);
+        __m128i isNaN  = _mm_cmpgt_epi32(abs, nanThreshold);
+        __m128i lsb    = _mm_and_si128(_mm_srli_epi32(abs, 13), one);
+        __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, bias), lsb), 13);
+
+        // Zeros (the only remaining denormal-range inputs) produce just the sign.
+        __m128i value = _mm_andnot_si128(isDenorm, normal);
+
+        value = _mm_or_si128(_mm_andnot_si128(isInf, value), _mm_and_si128(isInf, infValue));
+        value = _mm_or_si128(value, sign);
+        value = _mm_or_si128(_mm_andnot_si128(isNaN, value), _mm_and_si128(isNaN, nanValue));
+
+        // Sign extend the 16-bit results so the saturating pack keeps them intact.
+        *result = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+        return true;
+    };
+
+    for (; x + 8 <= count; x += 8)
+    {
+        __m128i lo, hi;
+        if (!convert4(source + x, &lo) || !convert4(source + x + 4, &hi))
+        {
+            for (size_t i = x; i < x + 8; i++)
+            {
+                dest[i] = float32ToFloat16(source[i]);
+            }
+            continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), _mm_packs_epi32(lo, hi));
+    }
+#elif defined(ANGLE_MATHUTIL_USE_NEON)
+    const uint32x4_t absMask      = vdupq_n_u32(0x7FFFFFFF);
+    const uint32x4_t nanThreshold = vdupq_n_u32(0x7F800000);
+    const uint32x4_t infThreshold = vdupq_n_u32(0x47FFEFFF);
+    const uint32x4_t denormLimit  = vdupq_n_u32(0x38800000);
+    const uint32x4_t bias         = vdupq_n_u32(0xC8000000 + 0x00000FFF);
+    const uint32x4_t rounding     = vdupq_n_u32(0x00000FFF);
+    const uint32x4_t one          = vdupq_n_u32(1);
+
+    auto convert4 = [&](const float *src) {
+        uint32x4_t bits = vld1q_u32(reinterpret_cast<const uint32_t *>(src));
+        uint32x4_t sign = vshrq_n_u32(vbicq_u32(bits, absMask), 16);
+        uint32x4_t abs  = vandq_u32(bits, absMask);
+
+        uint32x4_t lsb    = vandq_u32(vshrq_n_u32(abs, 13), one);
+        uint32x4_t normal = vshrq_n_u32(vaddq_u32(vaddq_u32(abs, bias), lsb), 13);
+
+        // Denormal results: shift the mantissa right by (113 - exponent).  NEON shifts take a
+        // signed per-lane count and shifting by 32 or more yields zero, matching the scalar code.
+        uint32x4_t mantissa =
+            vorrq_u32(vandq_u32(abs, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x00800000));
+        int32x4_t shift =
+            vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(abs, 23)), vdupq_n_s32(113));
+        uint32x4_t denormAbs = vshlq_u32(mantissa, shift);
+        uint32x4_t denormLsb = vandq_u32(vshrq_n_u32(denormAbs, 13), one);
+        uint32x4_t denorm =
+            vshrq_n_u32(vaddq_u32(vaddq_u32(denormAbs, rounding), denormLsb), 13);
+
+        uint32x4_t value = vbslq_u32(vcltq_u32(abs, denormLimit), denorm, normal);
+        value            = vbslq_u32(vcgtq_u32(abs, infThreshold), vdupq_n_u32(0x7C00), value);
+        value            = vorrq_u32(value, sign);
+        value            = vbslq_u32(vcgtq_u32(abs, nanThreshold), vdupq_n_u32(0x7FFF), value);
+        return vmovn_u32(value);
+    };
+
+    for (; x + 8 <= count; x += 8)
+    {
+        vst1q_u16(dest + x, vcombine_u16(convert4(source + x), convert4(source + x + 4)));
+    }
+#endif
+
+    for (; x < count; x++)
+    {
+        dest[x] = float32ToFloat16(source[x]);
+    }
+}
+
+void ConvertRGBFloatsTo999E5(const float *source, uint32_t *dest, size_t count)
+{
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[x] = convertRGBFloatsTo999E5(source[x * 3 + 0], source[x * 3 + 1], source[x * 3 + 2]);
+    }
+}
+
+void ConvertRGBFloatsTo111110F(const float *source, uint32_t *dest, size_t count)
+{
+    for (size_t x = 0; x < count; x++)
+    {
+        dest[x] = static_cast<uint32_t>(float32ToFloat11(source[x * 3 + 0])) << 0 |
+                  static_cast<uint32_t>(float32ToFloat11(source[x * 3 + 1])) << 11 |
+                  static_cast<uint32_t>(float32ToFloat10(source[x * 3 + 2])) << 22;
+    }
+}
+
 std::ostream &operator<<(std::ostream &s, const IndexRange &a)
 {
     if (a.isEmpty())
@@ -487,6 +487,14 @@ inline float float10ToFloat32(unsigned short fp10)
     }
 }
 
+// Batch versions of the conversions above, for image loads and vertex conversion.  The results are
+// identical to the scalar functions; the half float conversions are vectorized with SSE2 or NEON.
+void ConvertFloat16ToFloat32(const uint16_t *source, float *dest, size_t count);
+void ConvertFloat32ToFloat16(const float *source, uint16_t *dest, size_t count);
+// |source| holds |count| tightly packed RGB triples.
+void ConvertRGBFloatsTo999E5(const float *source, uint32_t *dest, size_t count);
+void ConvertRGBFloatsTo111110F(const float *source, uint32_t *dest, size_t count);
+
 // Converts to and from float and 16.16 fixed point format.
 inline float ConvertFixedToFloat(int32_t fixedInput)
 {
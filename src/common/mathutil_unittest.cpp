@@ -15,6 +15,9 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <vector>
+
 using namespace gl;
 
 namespace
@@ -597,6 +600,80 @@ TEST(MathUtilTest, convertRGBFloatsTo999E5)
     }
 }
 
+// Tests that the batch half float conversions match the scalar ones.
+TEST(MathUtilTest, ConvertFloat16ToFloat32Batch)
+{
+    std::vector<uint16_t> input(0x10000);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint16_t>(i);
+    }
+
+    std::vector<float> output(input.size());
+    ConvertFloat16ToFloat32(input.data(), output.data(), input.size());
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        EXPECT_EQ(bitCast<uint32_t>(output[i]), bitCast<uint32_t>(float16ToFloat32(input[i])))
+            << "input " << i;
+    }
+}
+
+// Tests that the batch float to half float conversion matches the scalar one, including the
+// scalar tail of the vectorized loop.
+TEST(MathUtilTest, ConvertFloat32ToFloat16Batch)
+{
+    const std::vector<float> input = {0.0f,
+                                      -0.0f,
+                                      1.0f,
+                                      -2.5f,
+                                      0.1f,
+                                      1.0e-5f,
+                                      -6.0e-8f,
+                                      1.0e-9f,
+                                      65504.0f,
+                                      65520.0f,
+                                      70000.0f,
+                                      -1.0e10f,
+                                      std::numeric_limits<float>::infinity(),
+                                      -std::numeric_limits<float>::infinity(),
+                                      std::numeric_limits<float>::quiet_NaN(),
+                                      std::numeric_limits<float>::denorm_min(),
+                                      3.14159f,
+                                      -1234.5678f,
+                                      0.33333f};
+
+    std::vector<uint16_t> output(input.size());
+    ConvertFloat32ToFloat16(input.data(), output.data(), input.size());
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        EXPECT_EQ(output[i], float32ToFloat16(input[i])) << "input " << input[i];
+    }
+}
+
+// Tests that the batch packed float conversions match the scalar ones.
+TEST(MathUtilTest, ConvertRGBFloatsToPackedBatch)
+{
+    const float input[][3] = {
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.5f, 0.25f}, {6.0f, 6.5f, 7.0f}, {0.1f, 9.6f, 3.2f},
+        {-1.0f, 1.0e5f, 1.0e-6f}};
+    constexpr size_t kCount = ArraySize(input);
+
+    uint32_t rgb9e5[kCount];
+    uint32_t rg11b10f[kCount];
+    ConvertRGBFloatsTo999E5(&input[0][0], rgb9e5, kCount);
+    ConvertRGBFloatsTo111110F(&input[0][0], rg11b10f, kCount);
+
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        EXPECT_EQ(rgb9e5[i], convertRGBFloatsTo999E5(input[i][0], input[i][1], input[i][2]));
+        EXPECT_EQ(rg11b10f[i], static_cast<uint32_t>(float32ToFloat11(input[i][0])) |
+                                   static_cast<uint32_t>(float32ToFloat11(input[i][1])) << 11 |
+                                   static_cast<uint32_t>(float32ToFloat10(input[i][2])) << 22);
+    }
+}
+
 // Tests the 999E5 to RGB float conversion
 TEST(MathUtilTest, convert999E5toRGBFloats)
 {
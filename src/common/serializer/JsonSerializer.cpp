@@ -14,6 +14,7 @@
 #include "JsonSerializer.h"
 
 #include "common/debug.h"
+#include "common/hash_utils.h"
 
 #include <anglebase/sha1.h>
 #include <rapidjson/document.h>
@@ -21,26 +22,139 @@
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace angle
 {
 
 namespace js = rapidjson;
 
-JsonSerializer::JsonSerializer() : mDoc(js::kObjectType), mAllocator(mDoc.GetAllocator()) {}
+namespace
+{
+template <typename T>
+void AppendBytes(std::vector<uint8_t> *bytes, const T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value);
+    const uint8_t *valueBytes = reinterpret_cast<const uint8_t *>(&value);
+    bytes->insert(bytes->end(), valueBytes, valueBytes + sizeof(T));
+}
+
+void AppendBytes(std::vector<uint8_t> *bytes, const char *str, size_t length)
+{
+    AppendBytes(bytes, static_cast<uint64_t>(length));
+    bytes->insert(bytes->end(), str, str + length);
+}
+
+// Appends a tagged representation of the value, so that for example the integer 1, the double 1.0
+// and the string "1" have different digests.
+void AppendValueBytes(std::vector<uint8_t> *bytes, const js::Value &value)
+{
+    if (value.IsNull())
+    {
+        bytes->push_back('n');
+    }
+    else if (value.IsBool())
+    {
+        bytes->push_back(value.GetBool() ? 't' : 'f');
+    }
+    else if (value.IsString())
+    {
+        bytes->push_back('s');
+        AppendBytes(bytes, value.GetString(), value.GetStringLength());
+    }
+    else if (value.IsUint64())
+    {
+        bytes->push_back('u');
+        AppendBytes(bytes, value.GetUint64());
+    }
+    else if (value.IsInt64())
+    {
+        bytes->push_back('i');
+        AppendBytes(bytes, value.GetInt64());
+    }
+    else if (value.IsDouble())
+    {
+        bytes->push_back('d');
+        AppendBytes(bytes, value.GetDouble());
+    }
+    else
+    {
+        // Objects are only made from groups, which are hashed separately.
+        ASSERT(value.IsArray());
+        bytes->push_back('a');
+        AppendBytes(bytes, static_cast<uint64_t>(value.Size()));
+        for (const js::Value &element : value.GetArray())
+        {
+            AppendValueBytes(bytes, element);
+        }
+    }
+}
+
+std::array<uint8_t, 16> ComputeDigest(const std::vector<uint8_t> &bytes)
+{
+    const XXH128_hash_t hash = XXH3_128bits(bytes.data(), bytes.size());
+    std::array<uint8_t, 16> digest;
+    static_assert(sizeof(hash) == sizeof(digest));
+    memcpy(digest.data(), &hash, sizeof(digest));
+    return digest;
+}
+}  // namespace
+
+JsonSerializer::JsonSerializer() : JsonSerializer(Mode::Document) {}
+
+JsonSerializer::JsonSerializer(Mode mode)
+    : mMode(mode), mDoc(js::kObjectType), mAllocator(mDoc.GetAllocator())
+{}
 
 JsonSerializer::~JsonSerializer() {}
 
 void JsonSerializer::startGroup(const std::string &name)
 {
-    mGroupValueStack.push(SortedValueGroup());
+    if (mMode == Mode::Digest)
+    {
+        mGroupDigestStack.push(DigestGroup());
+    }
+    else
+    {
+        mGroupValueStack.push(SortedValueGroup());
+    }
     mGroupNameStack.push(name);
 }
 
 void JsonSerializer::endGroup()
 {
-    ASSERT(!mGroupValueStack.empty());
     ASSERT(!mGroupNameStack.empty());
 
+    if (mMode == Mode::Digest)
+    {
+        ASSERT(!mGroupDigestStack.empty());
+
+        // Sort like the multimap of a document group, which keeps the order of equal names.
+        DigestGroup &group = mGroupDigestStack.top();
+        std::stable_sort(
+            group.begin(), group.end(),
+            [](const DigestEntry &a, const DigestEntry &b) { return a.name < b.name; });
+
+        std::vector<uint8_t> bytes;
+        bytes.push_back('g');
+        for (const DigestEntry &entry : group)
+        {
+            AppendBytes(&bytes, entry.name.c_str(), entry.name.length());
+            bytes.insert(bytes.end(), entry.digest.begin(), entry.digest.end());
+        }
+        const Digest digest = ComputeDigest(bytes);
+        std::string name    = mGroupNameStack.top();
+
+        mGroupDigestStack.pop();
+        mGroupNameStack.pop();
+
+        addDigest(name, digest);
+        return;
+    }
+
+    ASSERT(!mGroupValueStack.empty());
+
     rapidjson::Value group = makeValueGroup(mGroupValueStack.top());
     std::string name       = mGroupNameStack.top();
 
@@ -59,6 +173,17 @@ void JsonSerializer::addBlobWithMax(const std::string &name,
                                     angle::Span<const uint8_t> blob,
                                     size_t maxSerializedLength)
 {
+    if (mMode == Mode::Digest)
+    {
+        // The whole blob is hashed once, there's no need for a readable checksum and prefix.
+        std::vector<uint8_t> bytes;
+        bytes.reserve(blob.size() + 1);
+        bytes.push_back('b');
+        bytes.insert(bytes.end(), blob.begin(), blob.end());
+        addDigest(name, ComputeDigest(bytes));
+        return;
+    }
+
     unsigned char hash[angle::base::kSHA1Length];
     angle::base::SHA1HashBytes(blob.data(), blob.size(), hash);
     std::ostringstream os;
@@ -87,6 +212,15 @@ void JsonSerializer::addBlobWithMax(const std::string &name,
 
 void JsonSerializer::addCString(const std::string &name, const char *value)
 {
+    if (mMode == Mode::Digest)
+    {
+        std::vector<uint8_t> bytes;
+        bytes.push_back('s');
+        AppendBytes(&bytes, value, strlen(value));
+        addDigest(name, ComputeDigest(bytes));
+        return;
+    }
+
     rapidjson::Value val(value, mAllocator);
     addValue(name, std::move(val));
 }
@@ -144,6 +278,30 @@ void JsonSerializer::ensureEndDocument()
         return;
     }
 
+    if (mMode == Mode::Digest)
+    {
+        ASSERT(mGroupDigestStack.empty());
+
+        // Like the members of mDoc, the top level values are kept in the order they were added.
+        std::vector<uint8_t> bytes;
+        for (const DigestEntry &entry : mDocDigests)
+        {
+            AppendBytes(&bytes, entry.name.c_str(), entry.name.length());
+            bytes.insert(bytes.end(), entry.digest.begin(), entry.digest.end());
+        }
+        const Digest digest = ComputeDigest(bytes);
+
+        std::ostringstream os;
+        os << "XXH3:";
+        static constexpr char kASCII[] = "0123456789ABCDEF";
+        for (uint8_t byte : digest)
+        {
+            os << kASCII[byte >> 4] << kASCII[byte & 0xf];
+        }
+        mResult = os.str();
+        return;
+    }
+
     std::stringstream os;
     js::OStreamWrapper osw(os);
     js::PrettyWriter<js::OStreamWrapper> prettyOs(osw);
@@ -170,6 +328,14 @@ rapidjson::Value JsonSerializer::makeValueGroup(SortedValueGroup &group)
 
 void JsonSerializer::addValue(const std::string &name, rapidjson::Value &&value)
 {
+    if (mMode == Mode::Digest)
+    {
+        std::vector<uint8_t> bytes;
+        AppendValueBytes(&bytes, value);
+        addDigest(name, ComputeDigest(bytes));
+        return;
+    }
+
     if (!mGroupValueStack.empty())
     {
         mGroupValueStack.top().insert(std::make_pair(name, std::move(value)));
@@ -180,4 +346,11 @@ void JsonSerializer::addValue(const std::string &name, rapidjson::Value &&value)
         mDoc.AddMember(nameValue, std::move(value), mAllocator);
     }
 }
+
+void JsonSerializer::addDigest(const std::string &name, const Digest &digest)
+{
+    ASSERT(mMode == Mode::Digest);
+    DigestGroup &group = mGroupDigestStack.empty() ? mDocDigests : mGroupDigestStack.top();
+    group.push_back({name, digest});
+}
 }  // namespace angle
@@ -17,11 +17,13 @@
 
 #include <rapidjson/document.h>
 
+#include <array>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <stack>
 #include <type_traits>
+#include <vector>
 
 #include "common/span.h"
 
@@ -51,7 +53,17 @@ struct StoreAs<signed long>
 class JsonSerializer : public angle::NonCopyable
 {
   public:
+    // In Digest mode no document is built.  Each group is hashed when it ends from the sorted
+    // hashes of its values, and data() returns the hash of the whole document instead of its JSON.
+    // Two serializations with the same values have the same digest.
+    enum class Mode
+    {
+        Document,
+        Digest,
+    };
+
     JsonSerializer();
+    explicit JsonSerializer(Mode mode);
     ~JsonSerializer();
 
     void addCString(const std::string &name, const char *value);
@@ -114,17 +126,31 @@ class JsonSerializer : public angle::NonCopyable
   private:
     using SortedValueGroup = std::multimap<std::string, rapidjson::Value>;
 
+    using Digest = std::array<uint8_t, 16>;
+    struct DigestEntry
+    {
+        std::string name;
+        Digest digest;
+    };
+    using DigestGroup = std::vector<DigestEntry>;
+
     rapidjson::Value makeValueGroup(SortedValueGroup &group);
     void addValue(const std::string &name, rapidjson::Value &&value);
+    void addDigest(const std::string &name, const Digest &digest);
 
     void ensureEndDocument();
 
     using ValuePointer = std::unique_ptr<rapidjson::Value>;
 
+    const Mode mMode;
+
     rapidjson::Document mDoc;
     rapidjson::Document::AllocatorType &mAllocator;
     std::stack<std::string> mGroupNameStack;
     std::stack<SortedValueGroup> mGroupValueStack;
+    // Used instead of mDoc and mGroupValueStack in Digest mode.
+    DigestGroup mDocDigests;
+    std::stack<DigestGroup> mGroupDigestStack;
     std::string mResult;
 };
 
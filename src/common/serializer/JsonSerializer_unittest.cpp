@@ -265,6 +265,46 @@ TEST_F(JsonSerializerTest, GroupedIntValue)
     check(expect);
 }
 
+// Test that the digest doesn't depend on the order the values of a group are added in
+TEST(JsonSerializerDigestTest, ValueOrder)
+{
+    angle::JsonSerializer a(angle::JsonSerializer::Mode::Digest);
+    a.startGroup("group");
+    a.addScalar("test1", 1);
+    a.addString("test2", "two");
+    a.endGroup();
+
+    angle::JsonSerializer b(angle::JsonSerializer::Mode::Digest);
+    b.startGroup("group");
+    b.addString("test2", "two");
+    b.addScalar("test1", 1);
+    b.endGroup();
+
+    EXPECT_STREQ(a.data(), b.data());
+}
+
+// Test that changing a nested value or its type changes the digest
+TEST(JsonSerializerDigestTest, ValueChange)
+{
+    auto digest = [](auto value, const std::vector<uint8_t> &blob) {
+        angle::JsonSerializer js(angle::JsonSerializer::Mode::Digest);
+        js.startGroup("group");
+        js.startGroup("subgroup");
+        js.addScalar("test1", value);
+        js.addBlob("test2", blob);
+        js.endGroup();
+        js.endGroup();
+        return std::string(js.data());
+    };
+
+    const std::vector<uint8_t> blob  = {1, 2, 3, 4};
+    const std::vector<uint8_t> blob2 = {1, 2, 3, 5};
+    EXPECT_EQ(digest(1, blob), digest(1u, blob));
+    EXPECT_NE(digest(1, blob), digest(2, blob));
+    EXPECT_NE(digest(1, blob), digest(1.0, blob));
+    EXPECT_NE(digest(1, blob), digest(1, blob2));
+}
+
 void JsonSerializerTest::SetUp()
 {
     js.startGroup("context");
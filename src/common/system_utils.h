@@ -41,6 +41,8 @@ bool PrependPathToEnvironmentVar(const char *variableName, const char *path);
 bool IsDirectory(const char *filename);
 bool IsFullPath(std::string dirName);
 bool CreateDirectories(const std::string &path);
+// Renames a file, replacing |destPath| if it exists, in a single step.
+bool RenameFileReplacingExisting(const std::string &sourcePath, const std::string &destPath);
 void MakeForwardSlashThePathSeparator(std::string &path);
 bool IsSameFileDescriptor(int fd1, int fd2);
 std::string GetRootDirectory();
@@ -61,6 +63,26 @@ double GetCurrentSystemTime();
 // Get CPU time for current process in seconds.
 double GetCurrentProcessCpuTime();
 
+// Read a free running CPU counter: the time stamp counter on x86 and the virtual counter on Arm64.
+// Its frequency is not known but constant, so it's only good for comparing costs.  Falls back to
+// the system time in nanoseconds on other CPUs.
+inline uint64_t ReadCpuCycleCounter()
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return __rdtsc();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    return _ReadStatusReg(ARM64_CNTVCT);
+#elif defined(__i386__) || defined(__x86_64__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<uint64_t>(GetCurrentSystemTime() * 1e9);
+#endif
+}
+
 // Unique thread id (std::this_thread::get_id() gets recycled!)
 uint64_t GetCurrentThreadUniqueId();
 // Fast function to get thread id when performance is critical (may be recycled).
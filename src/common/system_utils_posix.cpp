@@ -14,6 +14,7 @@
 #include "system_utils.h"
 
 #include <array>
+#include <cstdio>
 #include <iostream>
 
 #include <dlfcn.h>
@@ -304,6 +305,11 @@ std::string GetRootDirectory()
     return "/";
 }
 
+bool RenameFileReplacingExisting(const std::string &sourcePath, const std::string &destPath)
+{
+    return rename(sourcePath.c_str(), destPath.c_str()) == 0;
+}
+
 bool CreateDirectories(const std::string &path)
 {
     // First sanitize path so we can use "/" as universal path separator
@@ -171,6 +171,12 @@ std::string GetRootDirectory()
     return "C:\\";
 }
 
+bool RenameFileReplacingExisting(const std::string &sourcePath, const std::string &destPath)
+{
+    return MoveFileExW(Widen(sourcePath).c_str(), Widen(destPath).c_str(),
+                       MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
 bool CreateDirectories(const std::string &path)
 {
     // First sanitize path so we can use "/" as universal path separator
@@ -18,6 +18,14 @@
 
 #include <set>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_INDEX_RANGE_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_INDEX_RANGE_USE_NEON
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
 #    include <windows.applicationmodel.core.h>
 #    include <windows.graphics.display.h>
@@ -28,6 +36,219 @@
 namespace
 {
 
+#if defined(ANGLE_INDEX_RANGE_USE_SSE2) || defined(ANGLE_INDEX_RANGE_USE_NEON)
+// Vectorized min/max scan of the indices.  SSE2 and NEON are baseline on the targets they are
+// enabled for, so no runtime CPU detection is needed.  With primitive restart enabled, the restart
+// index is the largest representable value, so it can never lower the minimum; it only needs to be
+// masked out (to zero) for the maximum.
+//
+// |minIndex| and |maxIndex| are updated with the results and the number of processed indices is
+// returned; the caller handles the remainder.
+#    define ANGLE_INDEX_RANGE_USE_SIMD
+
+#    if defined(ANGLE_INDEX_RANGE_USE_SSE2)
+template <typename IndexType>
+void StoreAndReduceMinMax(__m128i minValues,
+                          __m128i maxValues,
+                          IndexType bias,
+                          IndexType *minIndex,
+                          IndexType *maxIndex)
+{
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(minLanes), minValues);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxLanes), maxValues);
+
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        *minIndex = std::min(*minIndex, static_cast<IndexType>(minLanes[lane] ^ bias));
+        *maxIndex = std::max(*maxIndex, static_cast<IndexType>(maxLanes[lane] ^ bias));
+    }
+}
+
+size_t ComputeIndexRangeSIMD(const uint8_t *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             uint8_t *minIndex,
+                             uint8_t *maxIndex)
+{
+    constexpr size_t kLanes = 16;
+    const __m128i restart   = _mm_set1_epi8(-1);
+    __m128i minValues       = restart;
+    __m128i maxValues       = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        minValues      = _mm_min_epu8(minValues, values);
+        if (primitiveRestartEnabled)
+        {
+            values = _mm_andnot_si128(_mm_cmpeq_epi8(values, restart), values);
+        }
+        maxValues = _mm_max_epu8(maxValues, values);
+    }
+
+    StoreAndReduceMinMax<uint8_t>(minValues, maxValues, 0, minIndex, maxIndex);
+    return i;
+}
+
+size_t ComputeIndexRangeSIMD(const uint16_t *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             uint16_t *minIndex,
+                             uint16_t *maxIndex)
+{
+    // SSE2 only has signed 16-bit min/max, so the values are biased by flipping their sign bit.
+    constexpr size_t kLanes  = 8;
+    constexpr uint16_t kBias = 0x8000;
+    const __m128i bias       = _mm_set1_epi16(static_cast<int16_t>(kBias));
+    const __m128i restart    = _mm_set1_epi16(-1);
+    __m128i minValues        = _mm_xor_si128(restart, bias);
+    __m128i maxValues        = bias;
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        minValues      = _mm_min_epi16(minValues, _mm_xor_si128(values, bias));
+        if (primitiveRestartEnabled)
+        {
+            values = _mm_andnot_si128(_mm_cmpeq_epi16(values, restart), values);
+        }
+        maxValues = _mm_max_epi16(maxValues, _mm_xor_si128(values, bias));
+    }
+
+    StoreAndReduceMinMax<uint16_t>(minValues, maxValues, kBias, minIndex, maxIndex);
+    return i;
+}
+
+size_t ComputeIndexRangeSIMD(const uint32_t *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             uint32_t *minIndex,
+                             uint32_t *maxIndex)
+{
+    // SSE2 has no 32-bit min/max, so they are done with a signed compare (on biased values) and a
+    // select.
+    constexpr size_t kLanes  = 4;
+    constexpr uint32_t kBias = 0x80000000u;
+    const __m128i bias       = _mm_set1_epi32(static_cast<int32_t>(kBias));
+    const __m128i restart    = _mm_set1_epi32(-1);
+    __m128i minValues        = _mm_xor_si128(restart, bias);
+    __m128i maxValues        = bias;
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+
+        __m128i biased    = _mm_xor_si128(values, bias);
+        __m128i lowerMask = _mm_cmpgt_epi32(minValues, biased);
+        minValues         = _mm_or_si128(_mm_and_si128(lowerMask, biased),
+                                         _mm_andnot_si128(lowerMask, minValues));
+
+        if (primitiveRestartEnabled)
+        {
+            values = _mm_andnot_si128(_mm_cmpeq_epi32(values, restart), values);
+            biased = _mm_xor_si128(values, bias);
+        }
+        __m128i higherMask = _mm_cmpgt_epi32(biased, maxValues);
+        maxValues          = _mm_or_si128(_mm_and_si128(higherMask, biased),
+                                          _mm_andnot_si128(higherMask, maxValues));
+    }
+
+    StoreAndReduceMinMax<uint32_t>(minValues, maxValues, kBias, minIndex, maxIndex);
+    return i;
+}
+#    else  // defined(ANGLE_INDEX_RANGE_USE_SSE2)
+size_t ComputeIndexRangeSIMD(const uint8_t *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             uint8_t *minIndex,
+                             uint8_t *maxIndex)
+{
+    constexpr size_t kLanes  = 16;
+    const uint8x16_t restart = vdupq_n_u8(0xFF);
+    uint8x16_t minValues     = restart;
+    uint8x16_t maxValues     = vdupq_n_u8(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        uint8x16_t values = vld1q_u8(indices + i);
+        minValues         = vminq_u8(minValues, values);
+        if (primitiveRestartEnabled)
+        {
+            values = vbicq_u8(values, vceqq_u8(values, restart));
+        }
+        maxValues = vmaxq_u8(maxValues, values);
+    }
+
+    *minIndex = std::min(*minIndex, vminvq_u8(minValues));
+    *maxIndex = std::max(*maxIndex, vmaxvq_u8(maxValues));
+    return i;
+}
+
+size_t ComputeIndexRangeSIMD(const uint16_t *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             uint16_t *minIndex,
+                             uint16_t *maxIndex)
+{
+    constexpr size_t kLanes  = 8;
+    const uint16x8_t restart = vdupq_n_u16(0xFFFF);
+    uint16x8_t minValues     = restart;
+    uint16x8_t maxValues     = vdupq_n_u16(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        uint16x8_t values = vld1q_u16(indices + i);
+        minValues         = vminq_u16(minValues, values);
+        if (primitiveRestartEnabled)
+        {
+            values = vbicq_u16(values, vceqq_u16(values, restart));
+        }
+        maxValues = vmaxq_u16(maxValues, values);
+    }
+
+    *minIndex = std::min(*minIndex, vminvq_u16(minValues));
+    *maxIndex = std::max(*maxIndex, vmaxvq_u16(maxValues));
+    return i;
+}
+
+size_t ComputeIndexRangeSIMD(const uint32_t *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             uint32_t *minIndex,
+                             uint32_t *maxIndex)
+{
+    constexpr size_t kLanes  = 4;
+    const uint32x4_t restart = vdupq_n_u32(0xFFFFFFFFu);
+    uint32x4_t minValues     = restart;
+    uint32x4_t maxValues     = vdupq_n_u32(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        uint32x4_t values = vld1q_u32(indices + i);
+        minValues         = vminq_u32(minValues, values);
+        if (primitiveRestartEnabled)
+        {
+            values = vbicq_u32(values, vceqq_u32(values, restart));
+        }
+        maxValues = vmaxq_u32(maxValues, values);
+    }
+
+    *minIndex = std::min(*minIndex, vminvq_u32(minValues));
+    *maxIndex = std::max(*maxIndex, vmaxvq_u32(maxValues));
+    return i;
+}
+#    endif  // defined(ANGLE_INDEX_RANGE_USE_SSE2)
+#endif  // defined(ANGLE_INDEX_RANGE_USE_SSE2) || defined(ANGLE_INDEX_RANGE_USE_NEON)
+
 template <class IndexType>
 gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                                       size_t count,
@@ -36,32 +257,38 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
     constexpr IndexType primitiveRestartIndex = std::numeric_limits<IndexType>::max();
     IndexType minIndex                        = primitiveRestartIndex;
     IndexType maxIndex                        = 0;
-    bool hasVertices                          = false;
+
+    size_t i = 0;
+#if defined(ANGLE_INDEX_RANGE_USE_SIMD)
+    i = ComputeIndexRangeSIMD(indices, count, primitiveRestartEnabled, &minIndex, &maxIndex);
+#endif
 
     if (primitiveRestartEnabled)
     {
-        for (size_t i = 0; i < count; i++)
+        for (; i < count; i++)
         {
             IndexType index = indices[i];
             if (index == primitiveRestartIndex)
             {
                 continue;
             }
-            hasVertices = true;
-            minIndex    = std::min(minIndex, index);
-            maxIndex    = std::max(maxIndex, index);
+            minIndex = std::min(minIndex, index);
+            maxIndex = std::max(maxIndex, index);
         }
     }
     else
     {
-        for (size_t i = 0; i < count; i++)
+        for (; i < count; i++)
         {
             IndexType index = indices[i];
             minIndex        = std::min(minIndex, index);
             maxIndex        = std::max(maxIndex, index);
         }
-        hasVertices = count > 0;
     }
+
+    // With primitive restart, any index other than the restart index lowers the minimum.
+    const bool hasVertices =
+        primitiveRestartEnabled ? minIndex != primitiveRestartIndex : count > 0;
     if (!hasVertices)
     {
         return gl::IndexRange();
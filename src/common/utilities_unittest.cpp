@@ -258,4 +258,41 @@ TEST(Utilities, IndexRanges)
     EXPECT_EQ(ComputeIndexRange(b, vertices2, 3, false), gl::IndexRange(2, 255));
 }
 
+// Tests gl::ComputeIndexRange() with enough indices of each type to exercise the vectorized path,
+// including the remainder and with the extremes in every position.
+template <typename IndexType>
+void TestLongIndexRanges(gl::DrawElementsType type)
+{
+    constexpr IndexType kRestart = std::numeric_limits<IndexType>::max();
+    constexpr size_t kCount      = 67;
+
+    std::vector<IndexType> indices(kCount, kRestart);
+    EXPECT_EQ(ComputeIndexRange(type, indices.data(), kCount, true), gl::IndexRange());
+    EXPECT_EQ(ComputeIndexRange(type, indices.data(), kCount, false),
+              gl::IndexRange(kRestart, kRestart));
+
+    for (size_t position = 0; position < kCount; ++position)
+    {
+        // Every third index is a restart index, the others are in [10, 20), except for a minimum
+        // of 3 and a maximum of 100 placed around |position|.
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            indices[i] = i % 3 == 0 ? kRestart : static_cast<IndexType>(10 + i % 10);
+        }
+        indices[position]                = 3;
+        indices[(position + 7) % kCount] = 100;
+
+        EXPECT_EQ(ComputeIndexRange(type, indices.data(), kCount, true), gl::IndexRange(3, 100));
+        EXPECT_EQ(ComputeIndexRange(type, indices.data(), kCount, false),
+                  gl::IndexRange(3, kRestart));
+    }
+}
+
+TEST(Utilities, LongIndexRanges)
+{
+    TestLongIndexRanges<uint8_t>(gl::DrawElementsType::UnsignedByte);
+    TestLongIndexRanges<uint16_t>(gl::DrawElementsType::UnsignedShort);
+    TestLongIndexRanges<uint32_t>(gl::DrawElementsType::UnsignedInt);
+}
+
 }  // anonymous namespace
@@ -7,6 +7,7 @@
 #include "compiler/preprocessor/Macro.h"
 
 #include "common/angleutils.h"
+#include "common/debug.h"
 #include "compiler/preprocessor/Token.h"
 
 namespace angle
@@ -27,6 +28,8 @@ bool Macro::equals(const Macro &other) const
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value)
 {
+    ASSERT(IsPredefinedMacroName(name));
+
     Token token;
     token.type = Token::CONST_INT;
     token.text = ToString(value);
@@ -40,6 +43,11 @@ void PredefineMacro(MacroSet *macroSet, const char *name, int value)
     (*macroSet)[name] = macro;
 }
 
+bool IsPredefinedMacroName(const std::string &name)
+{
+    return name.compare(0, 3, "GL_") == 0 || name.compare(0, 2, "__") == 0;
+}
+
 }  // namespace pp
 
 }  // namespace angle
@@ -48,6 +48,9 @@ typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
+// Whether the name can be that of a predefined macro.  These all start with "GL_" or "__".
+bool IsPredefinedMacroName(const std::string &name);
+
 }  // namespace pp
 
 }  // namespace angle
@@ -93,6 +93,7 @@ MacroExpander::MacroExpander(Lexer *lexer,
       mMacroSet(macroSet),
       mDiagnostics(diagnostics),
       mParseDefined(parseDefined),
+      mOnlyPredefinedMacros(false),
       mTotalTokensInContexts(0),
       mSettings(settings),
       mDeferReenablingMacros(false)
@@ -165,6 +166,9 @@ void MacroExpander::lex(Token *token)
         if (token->expansionDisabled())
             break;
 
+        if (mOnlyPredefinedMacros && !IsPredefinedMacroName(token->text))
+            break;
+
         MacroSet::const_iterator iter = mMacroSet->find(token->text);
         if (iter == mMacroSet->end())
             break;
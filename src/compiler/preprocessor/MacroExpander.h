@@ -36,6 +36,13 @@ class MacroExpander : public Lexer
 
     void lex(Token *token) override;
 
+    // Called when the source is known not to define any macros, in which case only identifiers
+    // that may name a predefined macro need to be looked up.
+    void setOnlyPredefinedMacros(bool onlyPredefinedMacros)
+    {
+        mOnlyPredefinedMacros = onlyPredefinedMacros;
+    }
+
   private:
     void getToken(Token *token);
     void ungetToken(const Token &token);
@@ -73,6 +80,7 @@ class MacroExpander : public Lexer
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
     bool mParseDefined;
+    bool mOnlyPredefinedMacros;
 
     std::unique_ptr<Token> mReserveToken;
     std::vector<MacroContext> mContextStack;
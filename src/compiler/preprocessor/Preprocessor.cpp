@@ -6,6 +6,9 @@
 
 #include "compiler/preprocessor/Preprocessor.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "common/debug.h"
 #include "compiler/preprocessor/DiagnosticsBase.h"
 #include "compiler/preprocessor/DirectiveParser.h"
@@ -20,6 +23,46 @@ namespace angle
 namespace pp
 {
 
+namespace
+{
+// Conservatively checks whether the source may contain directives other than #version,
+// #extension, #pragma and #line.  Without them, the shader cannot define macros of its own and
+// there are no conditional blocks.  Anything unusual after a '#' (including comments, line
+// continuations and a directive split between strings) counts as such a directive.
+bool MayContainMacroDirectives(size_t count, const char *const string[], const int length[])
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char *begin = string[i];
+        const char *end =
+            begin + ((length && length[i] >= 0) ? static_cast<size_t>(length[i]) : strlen(begin));
+
+        for (const char *hash = std::find(begin, end, '#'); hash != end;
+             hash = std::find(hash + 1, end, '#'))
+        {
+            const char *name = hash + 1;
+            while (name != end && (*name == ' ' || *name == '\t'))
+            {
+                ++name;
+            }
+            const char *nameEnd = name;
+            while (nameEnd != end && *nameEnd >= 'a' && *nameEnd <= 'z')
+            {
+                ++nameEnd;
+            }
+
+            const std::string directive(name, nameEnd);
+            if (directive != "version" && directive != "extension" && directive != "pragma" &&
+                directive != "line")
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}  // anonymous namespace
+
 struct PreprocessorImpl
 {
     Diagnostics *diagnostics;
@@ -58,6 +101,10 @@ bool Preprocessor::init(size_t count, const char *const string[], const int leng
     predefineMacro("__FILE__", 0);
     predefineMacro("GL_ES", 1);
 
+    // Most shaders don't use the preprocessor beyond #version and #extension.  In that case, the
+    // only macros are the predefined ones, and other identifiers are not looked up.
+    mImpl->macroExpander.setOnlyPredefinedMacros(!MayContainMacroDirectives(count, string, length));
+
     return mImpl->tokenizer.init(count, string, length);
 }
 
@@ -10,6 +10,7 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <chrono>
 #include <sstream>
 
 #include "angle_gl.h"
@@ -357,6 +358,34 @@ class [[nodiscard]] TScopedSymbolTableLevel
     TSymbolTable *mTable;
 };
 
+// Adds the time until stop() or the end of the scope to |*secondsOut|, if |secondsOut| is given.
+class [[nodiscard]] TScopedCompilePhaseTimer
+{
+  public:
+    TScopedCompilePhaseTimer(double *secondsOut) : mSecondsOut(secondsOut)
+    {
+        if (mSecondsOut != nullptr)
+        {
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+    ~TScopedCompilePhaseTimer() { stop(); }
+
+    void stop()
+    {
+        if (mSecondsOut != nullptr)
+        {
+            *mSecondsOut += std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart)
+                                .count();
+            mSecondsOut = nullptr;
+        }
+    }
+
+  private:
+    double *mSecondsOut;
+    std::chrono::steady_clock::time_point mStart;
+};
+
 }  // namespace
 
 int GetMaxShaderVersionForSpec(ShShaderSpec spec)
@@ -393,6 +422,7 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
     : mShaderType(type),
       mShaderSpec(spec),
       mOutputType(output),
+      mMeasureCompilePhaseTimes(false),
       mDiagnostics(mInfoSink.info),
       mSourcePath(nullptr),
       mVariablesCollected(false),
@@ -478,6 +508,9 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
     TScopedSymbolTableLevel globalLevel(&mSymbolTable);
     ASSERT(mSymbolTable.atGlobalLevel());
 
+    TScopedCompilePhaseTimer parseTimer(
+        mMeasureCompilePhaseTimes ? &mCompilePhaseTimes.parseSeconds : nullptr);
+
     // Parse shader.
     if (PaParseStrings(shaderStrings.subspan(firstSource), nullptr, &parseContext) != 0)
     {
@@ -531,6 +564,7 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
     }
 #endif
     ASSERT(root != nullptr);
+    parseTimer.stop();
 
     if (compileOptions.skipAllValidationAndTransforms)
     {
@@ -555,6 +589,8 @@ TIntermBlock *TCompiler::compileTreeImpl(angle::Span<const char *const> shaderSt
     mValidateASTOptions = {};
     if (!compileOptions.useIR)
     {
+        TScopedCompilePhaseTimer transformTimer(
+            mMeasureCompilePhaseTimes ? &mCompilePhaseTimes.transformSeconds : nullptr);
         if (!checkAndSimplifyAST(root, parseContext, compileOptions))
         {
             return nullptr;
@@ -844,15 +880,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
-    // Create the function DAG.
-    initCallDag(root);
-
-    // Checks which functions are used
-    mFunctionMetadata.clear();
-    mFunctionMetadata.resize(mCallDag.size());
-    tagUsedFunctions();
-
-    if (!pruneUnusedFunctions(root))
+    if (!pruneUnreachableFunctions(root))
     {
         return false;
     }
@@ -1051,7 +1079,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.clampIndirectArrayBounds)
     {
-        if (!ClampIndirectIndices(this, root, &mSymbolTable))
+        if (!ClampIndirectIndices(this, root, &mSymbolTable,
+                                  compileOptions.skipClampingIndirectIndicesInBufferBlocks))
         {
             return false;
         }
@@ -1224,7 +1253,7 @@ bool TCompiler::compile(angle::Span<const char *const> shaderStrings,
 
     const ShCompileOptions compileOptions = adjustOptions(compileOptionsIn);
 
-    TScopedPoolAllocator scopedAlloc;
+    TScopedPoolAllocator scopedAlloc(&mCompileAllocator);
     TIntermBlock *root = compileTreeImpl(shaderStrings, compileOptions);
 
     if (root)
@@ -1236,6 +1265,8 @@ bool TCompiler::compile(angle::Span<const char *const> shaderStrings,
 
         if (compileOptions.objectCode && !compileOptions.skipAllValidationAndTransforms)
         {
+            TScopedCompilePhaseTimer translateTimer(
+                mMeasureCompilePhaseTimes ? &mCompilePhaseTimes.translateSeconds : nullptr);
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
@@ -1590,6 +1621,19 @@ bool TCompiler::sortUniforms(TIntermBlock *root)
     return validateAST(root);
 }
 
+bool TCompiler::pruneUnreachableFunctions(TIntermBlock *root)
+{
+    // Create the function DAG.
+    initCallDag(root);
+
+    // Checks which functions are used
+    mFunctionMetadata.clear();
+    mFunctionMetadata.resize(mCallDag.size());
+    tagUsedFunctions();
+
+    return pruneUnusedFunctions(root);
+}
+
 bool TCompiler::pruneUnusedFunctions(TIntermBlock *root)
 {
     TIntermSequence *sequence = root->getSequence();
@@ -77,6 +77,15 @@ struct TFunctionMetadata
     bool used = false;
 };
 
+// The time spent in each phase of compile(), summed over the compiles since the measurement was
+// enabled.  Translating includes the transformations that are specific to the output.
+struct CompilePhaseTimes
+{
+    double parseSeconds     = 0;
+    double transformSeconds = 0;
+    double translateSeconds = 0;
+};
+
 //
 // The base class for the machine dependent compiler to derive from
 // for managing object code from the compile.
@@ -133,6 +142,17 @@ class TCompiler : public TShHandleBase
     ShShaderSpec getShaderSpec() const { return mShaderSpec; }
     ShShaderOutput getOutputType() const { return mOutputType; }
     const ShBuiltInResources &getBuiltInResources() const { return mResources; }
+    const angle::PoolAllocatorStatistics &getCompileAllocatorStatistics() const
+    {
+        return mCompileAllocator.getStatistics();
+    }
+    // Measuring the compile phases is off by default, and is meant for benchmarks.
+    void setMeasureCompilePhaseTimes(bool measure)
+    {
+        mMeasureCompilePhaseTimes = measure;
+        mCompilePhaseTimes        = {};
+    }
+    const CompilePhaseTimes &getCompilePhaseTimes() const { return mCompilePhaseTimes; }
     const std::string &getBuiltInResourcesString() const { return mBuiltInResourcesString; }
 
     bool shouldRunLoopAndIndexingValidation(const ShCompileOptions &compileOptions) const;
@@ -235,6 +255,10 @@ class TCompiler : public TShHandleBase
     // Relies on collectVariables having been called.
     bool isVaryingDefined(const char *varyingName);
 
+    // Removes the functions that are not reachable from main.  This is done before the AST is
+    // simplified, but the translator may call it again if its transformations can remove calls.
+    [[nodiscard]] bool pruneUnreachableFunctions(TIntermBlock *root);
+
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
 
     std::vector<sh::ShaderVariable> mAttributes;
@@ -313,6 +337,14 @@ class TCompiler : public TShHandleBase
     // Built-in extensions with default behavior.
     TExtensionBehavior mExtensionBehavior;
 
+    // Allocator for the AST and everything else that only lives for the duration of compile().
+    // It is reset rather than freed after each compile, so a compiler that is reused settles at
+    // the page high-water mark of its shaders.
+    angle::PoolAllocator mCompileAllocator;
+
+    bool mMeasureCompilePhaseTimes;
+    CompilePhaseTimes mCompilePhaseTimes;
+
     // Results of compilation.
     int mShaderVersion;
     TInfoSink mInfoSink;  // Output sink.
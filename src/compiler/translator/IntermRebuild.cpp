@@ -480,48 +480,53 @@ PostResult TIntermRebuild::traversePost(NodeType currNodeType,
 
     NodeStackGuard guard(mNodeStack, &currNode);
 
-    switch (currNodeType)
+    return visitAnyPost(currNodeType, currNode);
+}
+
+PostResult TIntermRebuild::visitAnyPost(NodeType nodeType, TIntermNode &node)
+{
+    switch (nodeType)
     {
         case NodeType::Unknown:
             ASSERT(false);
             return Fail();
         case NodeType::Symbol:
-            return visitSymbolPost(*currNode.getAsSymbolNode());
+            return visitSymbolPost(*node.getAsSymbolNode());
         case NodeType::ConstantUnion:
-            return visitConstantUnionPost(*currNode.getAsConstantUnion());
+            return visitConstantUnionPost(*node.getAsConstantUnion());
         case NodeType::FunctionPrototype:
-            return visitFunctionPrototypePost(*currNode.getAsFunctionPrototypeNode());
+            return visitFunctionPrototypePost(*node.getAsFunctionPrototypeNode());
         case NodeType::PreprocessorDirective:
-            return visitPreprocessorDirectivePost(*currNode.getAsPreprocessorDirective());
+            return visitPreprocessorDirectivePost(*node.getAsPreprocessorDirective());
         case NodeType::Unary:
-            return visitUnaryPost(*currNode.getAsUnaryNode());
+            return visitUnaryPost(*node.getAsUnaryNode());
         case NodeType::Binary:
-            return visitBinaryPost(*currNode.getAsBinaryNode());
+            return visitBinaryPost(*node.getAsBinaryNode());
         case NodeType::Ternary:
-            return visitTernaryPost(*currNode.getAsTernaryNode());
+            return visitTernaryPost(*node.getAsTernaryNode());
         case NodeType::Swizzle:
-            return visitSwizzlePost(*currNode.getAsSwizzleNode());
+            return visitSwizzlePost(*node.getAsSwizzleNode());
         case NodeType::IfElse:
-            return visitIfElsePost(*currNode.getAsIfElseNode());
+            return visitIfElsePost(*node.getAsIfElseNode());
         case NodeType::Switch:
-            return visitSwitchPost(*currNode.getAsSwitchNode());
+            return visitSwitchPost(*node.getAsSwitchNode());
         case NodeType::Case:
-            return visitCasePost(*currNode.getAsCaseNode());
+            return visitCasePost(*node.getAsCaseNode());
         case NodeType::FunctionDefinition:
-            return visitFunctionDefinitionPost(*currNode.getAsFunctionDefinition());
+            return visitFunctionDefinitionPost(*node.getAsFunctionDefinition());
         case NodeType::Aggregate:
-            return visitAggregatePost(*currNode.getAsAggregate());
+            return visitAggregatePost(*node.getAsAggregate());
         case NodeType::Block:
-            return visitBlockPost(*currNode.getAsBlock());
+            return visitBlockPost(*node.getAsBlock());
         case NodeType::GlobalQualifierDeclaration:
             return visitGlobalQualifierDeclarationPost(
-                *currNode.getAsGlobalQualifierDeclarationNode());
+                *node.getAsGlobalQualifierDeclarationNode());
         case NodeType::Declaration:
-            return visitDeclarationPost(*currNode.getAsDeclarationNode());
+            return visitDeclarationPost(*node.getAsDeclarationNode());
         case NodeType::Loop:
-            return visitLoopPost(*currNode.getAsLoopNode());
+            return visitLoopPost(*node.getAsLoopNode());
         case NodeType::Branch:
-            return visitBranchPost(*currNode.getAsBranchNode());
+            return visitBranchPost(*node.getAsBranchNode());
         default:
             ASSERT(false);
             return Fail();
@@ -1041,4 +1046,51 @@ PostResult TIntermRebuild::visitGlobalQualifierDeclarationPost(
     return node;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+TIntermFusedRebuild::TIntermFusedRebuild(TCompiler &compiler)
+    : TIntermRebuild(compiler, false, true)
+{}
+
+TIntermFusedRebuild::~TIntermFusedRebuild() = default;
+
+void TIntermFusedRebuild::add(TIntermRebuild &rebuild)
+{
+    ASSERT(!rebuild.mPreVisit && rebuild.mPostVisit);
+    ASSERT(&rebuild.mCompiler == &mCompiler);
+    mRebuilds.push_back(&rebuild);
+}
+
+PostResult TIntermFusedRebuild::visitAnyPost(NodeType nodeType, TIntermNode &node)
+{
+    TIntermNode *currNode = &node;
+
+    for (TIntermRebuild *rebuild : mRebuilds)
+    {
+        // Give the fused rebuild the same view of the ancestors as this traversal.
+        rebuild->mNodeStack  = mNodeStack;
+        rebuild->mParentFunc = mParentFunc;
+
+        PostResult result = rebuild->visitAnyPost(nodeType, *currNode);
+
+        // The stack points into this traversal's frames, so it must not outlive this visit.
+        rebuild->mNodeStack  = {nullptr, nullptr};
+        rebuild->mParentFunc = nullptr;
+
+        if (!result.single())
+        {
+            // Dropped, replaced by multiple nodes, or failed.
+            return result;
+        }
+
+        if (result.single() != currNode)
+        {
+            currNode = result.single();
+            nodeType = getNodeType(*currNode);
+        }
+    }
+
+    return *currNode;
+}
+
 }  // namespace sh
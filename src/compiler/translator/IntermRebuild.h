@@ -50,6 +50,7 @@ namespace sh
 //
 class TIntermRebuild : angle::NonCopyable
 {
+    friend class TIntermFusedRebuild;
 
     enum class Action
     {
@@ -288,6 +289,10 @@ class TIntermRebuild : angle::NonCopyable
     bool traverseAnyAs(TIntermNode &node, Node *&out);
 
     PreResult traversePre(TIntermNode &originalNode);
+
+    // Dispatches to the visitXXXPost function matching the node type.
+    virtual PostResult visitAnyPost(NodeType nodeType, TIntermNode &node);
+
     TIntermNode *traverseChildren(NodeType currNodeType,
                                   const TIntermNode &originalNode,
                                   TIntermNode &currNode,
@@ -327,6 +332,34 @@ class TIntermRebuild : angle::NonCopyable
     bool mPostVisit;
 };
 
+// Runs several post visit only rebuilds in a single traversal of the tree.
+//
+// Every node is handed to the post visit of each added rebuild in turn, in the order the rebuilds
+// were added, with each rebuild seeing the node returned by the previous one.  If a rebuild drops
+// the node, returns multiple nodes or fails, the rebuilds after it are not run on that node.
+//
+// This produces the same tree as running the rebuilds one after the other when each rebuild only
+// looks at the node it visits and the subtree below it, and doesn't add nodes elsewhere in the
+// tree.  Rebuilds that need a pre visit, or that add nodes to the root after their traversal (such
+// as internal function definitions), cannot be fused.
+//
+// getParentFunction() and getParentNode() work as usual in the fused rebuilds.
+class TIntermFusedRebuild : public TIntermRebuild
+{
+  public:
+    explicit TIntermFusedRebuild(TCompiler &compiler);
+    ~TIntermFusedRebuild() override;
+
+    // Adds a rebuild to run in this traversal.  It must be post visit only, and must outlive this
+    // object.
+    void add(TIntermRebuild &rebuild);
+
+  private:
+    PostResult visitAnyPost(NodeType nodeType, TIntermNode &node) override;
+
+    std::vector<TIntermRebuild *> mRebuilds;
+};
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_INTERMREBUILD_H_
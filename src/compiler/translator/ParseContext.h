@@ -9,6 +9,7 @@
 #include "common/hash_containers.h"
 #include "common/span.h"
 #include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/Declarator.h"
 #include "compiler/translator/Diagnostics.h"
@@ -83,6 +84,9 @@ class TParseContext : angle::NonCopyable
     bool anyMultiviewExtensionAvailable();
     const angle::pp::Preprocessor &getPreprocessor() const { return mPreprocessor; }
     angle::pp::Preprocessor &getPreprocessor() { return mPreprocessor; }
+    // The token the lexer reads the preprocessor output into.  It's reused for the whole compile
+    // so that its text buffer is not reallocated for every token.
+    angle::pp::Token *getPreprocessorToken() { return &mPreprocessorToken; }
     void *getScanner() const { return mScanner; }
     void setScanner(void *scanner) { mScanner = scanner; }
     int getShaderVersion() const { return mShaderVersion; }
@@ -874,6 +878,7 @@ class TParseContext : angle::NonCopyable
     TDiagnostics *mDiagnostics;
     TDirectiveHandler mDirectiveHandler;
     angle::pp::Preprocessor mPreprocessor;
+    angle::pp::Token mPreprocessorToken;
     void *mScanner;
 
     // Keep track of clip/cull distance redeclaration, accessed indices, etc so that gl_ClipDistance
@@ -30,14 +30,25 @@ extern angle::PoolAllocator *GetGlobalPoolAllocator();
 extern void SetGlobalPoolAllocator(angle::PoolAllocator *poolAllocator);
 extern bool IsGlobalPoolAllocatorInitialized();
 
+// Makes a pool allocator the global one for the duration of a scope.  If an allocator is given, it
+// is reset when the scope ends and keeps its pages for the next user instead of freeing them.
 class [[nodiscard]] TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator() { SetGlobalPoolAllocator(&mAllocator); }
-    ~TScopedPoolAllocator() { SetGlobalPoolAllocator(nullptr); }
+    TScopedPoolAllocator() : mAllocator(&mOwnedAllocator) { SetGlobalPoolAllocator(mAllocator); }
+    explicit TScopedPoolAllocator(angle::PoolAllocator *allocator) : mAllocator(allocator)
+    {
+        SetGlobalPoolAllocator(mAllocator);
+    }
+    ~TScopedPoolAllocator()
+    {
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator->reset();
+    }
 
   private:
-    angle::PoolAllocator mAllocator;
+    angle::PoolAllocator mOwnedAllocator;
+    angle::PoolAllocator *mAllocator;
 };
 
 //
@@ -65,6 +65,23 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
 class TSymbolTable::TSymbolTableLevel
 {
   public:
+    // A name along with its hash.  A lookup that walks every level of the symbol table hashes the
+    // name only once, and most mismatching names are rejected without comparing the strings.
+    struct Key
+    {
+        explicit Key(const ImmutableString &name)
+            : name(name), hash(ImmutableString::FowlerNollVoHash<sizeof(size_t)>()(name))
+        {}
+
+        bool operator==(const Key &other) const
+        {
+            return hash == other.hash && name == other.name;
+        }
+
+        ImmutableString name;
+        size_t hash;
+    };
+
     TSymbolTableLevel() = default;
 
     bool insert(TSymbol *symbol);
@@ -76,12 +93,15 @@ class TSymbolTable::TSymbolTableLevel
     // Insert a function using its unmangled name as the key.
     void insertUnmangled(TFunction *function);
 
-    TSymbol *find(const ImmutableString &name) const;
+    TSymbol *find(const Key &key) const;
 
   private:
-    using tLevel        = TUnorderedMap<ImmutableString,
-                                        TSymbol *,
-                                        ImmutableString::FowlerNollVoHash<sizeof(size_t)>>;
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const { return key.hash; }
+    };
+
+    using tLevel        = TUnorderedMap<Key, TSymbol *, KeyHash>;
     using tLevelPair    = const tLevel::value_type;
     using tInsertResult = std::pair<tLevel::iterator, bool>;
 
@@ -91,7 +111,7 @@ class TSymbolTable::TSymbolTableLevel
 bool TSymbolTable::TSymbolTableLevel::insert(TSymbol *symbol)
 {
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
+    tInsertResult result = level.insert(tLevelPair(Key(symbol->getMangledName()), symbol));
     return result.second;
 }
 
@@ -99,18 +119,22 @@ bool TSymbolTable::TSymbolTableLevel::insert(TSymbol *symbol)
 void TSymbolTable::TSymbolTableLevel::redeclare(TSymbol *symbol)
 {
     // returning true means symbol was added to the table
-    level.insert_or_assign(symbol->getMangledName(), symbol);
+    level.insert_or_assign(Key(symbol->getMangledName()), symbol);
 }
 #endif
 
 void TSymbolTable::TSymbolTableLevel::insertUnmangled(TFunction *function)
 {
-    level.insert(tLevelPair(function->name(), function));
+    level.insert(tLevelPair(Key(function->name()), function));
 }
 
-TSymbol *TSymbolTable::TSymbolTableLevel::find(const ImmutableString &name) const
+TSymbol *TSymbolTable::TSymbolTableLevel::find(const Key &key) const
 {
-    tLevel::const_iterator it = level.find(name);
+    // Most nested scopes declare nothing.
+    if (level.empty())
+        return nullptr;
+
+    tLevel::const_iterator it = level.find(key);
     if (it == level.end())
         return nullptr;
     else
@@ -316,10 +340,12 @@ const TSymbol *TSymbolTable::find(const ImmutableString &name, int shaderVersion
 
 const TSymbol *TSymbolTable::findUserDefined(const ImmutableString &name) const
 {
+    const TSymbolTableLevel::Key key(name);
+
     int userDefinedLevel = static_cast<int>(mTable.size()) - 1;
     while (userDefinedLevel >= 0)
     {
-        const TSymbol *symbol = mTable[userDefinedLevel]->find(name);
+        const TSymbol *symbol = mTable[userDefinedLevel]->find(key);
         if (symbol)
         {
             return symbol;
@@ -334,13 +360,13 @@ TFunction *TSymbolTable::findUserDefinedFunction(const ImmutableString &name) co
 {
     // User-defined functions are always declared at the global level.
     ASSERT(!mTable.empty());
-    return static_cast<TFunction *>(mTable[0]->find(name));
+    return static_cast<TFunction *>(mTable[0]->find(TSymbolTableLevel::Key(name)));
 }
 
 const TSymbol *TSymbolTable::findGlobal(const ImmutableString &name) const
 {
     ASSERT(!mTable.empty());
-    return mTable[0]->find(name);
+    return mTable[0]->find(TSymbolTableLevel::Key(name));
 }
 
 bool TSymbolTable::declare(TSymbol *symbol)
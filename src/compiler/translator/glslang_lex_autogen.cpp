@@ -3915,8 +3915,9 @@ void yyfree(void *ptr, yyscan_t yyscanner)
 
 yy_size_t string_input(char *buf, yy_size_t max_size, yyscan_t yyscanner)
 {
-    angle::pp::Token token;
-    yyget_extra(yyscanner)->getPreprocessor().lex(&token);
+    TParseContext *context  = yyget_extra(yyscanner);
+    angle::pp::Token &token = *context->getPreprocessorToken();
+    context->getPreprocessor().lex(&token);
     yy_size_t len = token.type == angle::pp::Token::LAST ? 0 : token.text.size();
     if (len < max_size)
     {
@@ -193,6 +193,14 @@ bool TranslatorHLSL::translate(TIntermBlock *root,
         }
     }
 
+    // Folding done after unused functions were pruned (e.g. of array length expressions) may have
+    // removed function calls.  Prune the functions again, so that neither they nor the texture
+    // functions and emulated built-ins they use are output.
+    if (!pruneUnreachableFunctions(root))
+    {
+        return false;
+    }
+
     sh::OutputHLSL outputHLSL(
         getShaderType(), getShaderSpec(), getShaderVersion(), getExtensionBehavior(),
         getSourcePath(), getOutputType(), numRenderTargets, maxDualSourceDrawBuffers, getUniforms(),
@@ -155,6 +155,8 @@ void SetOptions(TCompiler *compiler, const ShCompileOptions &options, ffi::Compi
     opt->retain_inactive_fragment_outputs            = options.retainInactiveFragmentOutputs;
     opt->scalarize_vec_and_mat_constructor_args      = options.scalarizeVecAndMatConstructorArgs;
     opt->clamp_indirect_indices                      = options.clampIndirectArrayBounds;
+    opt->skip_clamping_indirect_indices_in_buffer_blocks =
+        options.skipClampingIndirectIndicesInBufferBlocks;
 
     opt->rewrite_pixel_local_storage = compiler->hasPixelLocalStorageUniforms();
     opt->pls_options.implementation  = static_cast<ffi::PixelLocalStorageImpl>(options.pls.type);
@@ -166,6 +168,9 @@ void SetOptions(TCompiler *compiler, const ShCompileOptions &options, ffi::Compi
 
     // MSL-specific flags
     opt->ensure_loop_forward_progress = options.ensureLoopForwardProgress;
+
+    // SPIR-V-specific flags
+    opt->optimize = options.optimizeSPIRVForSize || options.optimizeSPIRVForPerformance;
 }
 
 std::vector<ShaderVariable> ConvertShaderVariables(const rust::Vec<ffi::ShaderVariable> &variables)
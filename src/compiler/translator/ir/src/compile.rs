@@ -207,6 +207,8 @@ mod ffi {
         scalarize_vec_and_mat_constructor_args: bool,
         // Clamp non-constant indices to the bounds of the entity being indexed for robustness.
         clamp_indirect_indices: bool,
+        // Except for arrays in uniform and storage blocks, which are left to robust buffer access.
+        skip_clamping_indirect_indices_in_buffer_blocks: bool,
 
         // Whether the ANGLE_pixel_local_storage extension has been used and there are PLS uniforms
         // to rewrite.
@@ -215,6 +217,10 @@ mod ffi {
 
         // MSL: Ensure all loops execute side-effects or terminate.
         ensure_loop_forward_progress: bool,
+
+        // SPIR-V: Whether to run optimizations over the IR, such as common subexpression
+        // elimination.
+        optimize: bool,
     }
 
     // Matching sh::InterpolationType
@@ -647,6 +653,7 @@ fn common_post_variable_collection_transforms(ir: &mut IR, options: &Options) {
     if options.clamp_indirect_indices {
         let transform_options = transform::localized_workarounds::Options {
             clamp_indirect_indices: options.clamp_indirect_indices,
+            skip_buffer_block_arrays: options.skip_clamping_indirect_indices_in_buffer_blocks,
             max_dual_source_draw_buffers: options.limits.max_dual_source_draw_buffers,
         };
         transform::run!(localized_workarounds, ir, &transform_options);
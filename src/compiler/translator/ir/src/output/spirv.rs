@@ -22,4 +22,10 @@ pub fn generate(ir: &mut IR, options: &compile::Options) {
         let transform_options = transform::spirv::pass1::Options {};
         transform::run!(spirv::pass1, ir, &transform_options);
     }
+
+    // Optimizations that are easier on the IR than on the generated SPIR-V.  Dead code that they
+    // leave behind is removed by the common code after generation.
+    if options.optimize {
+        transform::run!(eliminate_common_subexpressions, ir);
+    }
 }
@@ -7,6 +7,7 @@ pub mod clamp_frag_depth;
 pub mod clamp_point_size;
 pub mod dead_code_eliminate;
 pub mod dealias;
+pub mod eliminate_common_subexpressions;
 pub mod emulate_instanced_multiview;
 pub mod emulate_multi_draw;
 pub mod initialize_uninitialized_variables;
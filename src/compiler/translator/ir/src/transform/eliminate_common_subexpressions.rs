@@ -0,0 +1,319 @@
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Block-local value numbering.  Within a block, an instruction that computes the same value as an
+// earlier instruction (same opcode, operands, result type and precision, and no side effect) is
+// turned into an `Alias` of the earlier register.  For example, in:
+//
+//     %3 = Add %1 %2
+//     %4 = Add %1 %2
+//
+// `%4` is made an alias of `%3`.  At the same time, loads from variables are forwarded:
+//
+// * A `Load` from a variable that was stored to earlier in the block is replaced with the stored
+//   value (copy propagation).
+// * A repeated `Load` from a variable is replaced with the earlier load, unless the variable may
+//   have been written to in between.
+//
+// Only loads of whole variables are forwarded, and only for variables that are either private to
+// the shader invocation (locals, `in` function parameters and non-interface globals) or read-only
+// (uniforms and inputs).  `out` and `inout` parameters are left alone, so that nothing is assumed
+// about how they are passed.
+//
+// A store through an access chain forgets the value of the variable it is rooted at, and any other
+// instruction with a side effect (function calls, atomics, barriers, etc) forgets the values of
+// all private variables.
+//
+// The resulting aliases are removed by `dealias` before code generation, and instructions that
+// became unused are removed by `dead_code_eliminate`.
+use crate::ir::*;
+use crate::*;
+
+use std::collections::hash_map::Entry;
+use std::mem::{discriminant, Discriminant};
+
+#[derive(Eq, PartialEq, Hash)]
+enum OperandId {
+    Register(RegisterId),
+    Constant(ConstantId),
+    Variable(VariableId),
+}
+
+#[derive(Eq, PartialEq, Hash)]
+struct Operand {
+    id: OperandId,
+    type_id: TypeId,
+    precision: Discriminant<Precision>,
+}
+
+#[derive(Eq, PartialEq, Hash)]
+enum SubOpCode {
+    None,
+    Unary(Discriminant<UnaryOpCode>),
+    Binary(Discriminant<BinaryOpCode>),
+    BuiltIn(Discriminant<BuiltInOpCode>),
+}
+
+// Everything that identifies the value computed by a pure instruction.
+#[derive(Eq, PartialEq, Hash)]
+struct ValueKey {
+    op: Discriminant<OpCode>,
+    sub_op: SubOpCode,
+    operands: Vec<Operand>,
+    literals: Vec<u32>,
+    result_type_id: TypeId,
+    result_precision: Discriminant<Precision>,
+}
+
+struct State<'a> {
+    ir_meta: &'a mut IRMeta,
+    out_params: HashSet<VariableId>,
+}
+
+// Per-block information.
+struct BlockState<'a> {
+    out_params: &'a HashSet<VariableId>,
+    // The register that first computed each value in the block.
+    values: HashMap<ValueKey, TypedRegisterId>,
+    // The known value of variables, either from the last store or the first load.
+    variable_values: HashMap<VariableId, TypedId>,
+}
+
+pub fn run(ir: &mut IR) {
+    let out_params = ir
+        .meta
+        .all_functions()
+        .iter()
+        .flat_map(|function| function.params.iter())
+        .filter(|param| param.direction != FunctionParamDirection::Input)
+        .map(|param| param.variable_id)
+        .collect();
+    let mut state = State { ir_meta: &mut ir.meta, out_params };
+
+    traverser::transformer::for_each_function(
+        &mut state,
+        &mut ir.function_entries,
+        &|state, _, entry| {
+            traverser::transformer::for_each_block(
+                state,
+                entry,
+                &|state, block| eliminate_in_block(state, block),
+                &|_, block| block,
+            )
+        },
+    );
+}
+
+fn eliminate_in_block<'block>(state: &mut State, block: &'block mut Block) -> &'block mut Block {
+    let mut block_state = BlockState {
+        out_params: &state.out_params,
+        values: HashMap::new(),
+        variable_values: HashMap::new(),
+    };
+
+    for instruction in &block.instructions {
+        match instruction {
+            BlockInstruction::Void(op) => {
+                process_side_effects(state.ir_meta, &mut block_state, op);
+            }
+            &BlockInstruction::Register(id) => {
+                let instruction = state.ir_meta.get_instruction(id);
+                let result = instruction.result;
+
+                if let OpCode::Load(pointer) = instruction.op {
+                    forward_load(state.ir_meta, &mut block_state, pointer, result);
+                } else if instruction.op.has_side_effect() {
+                    process_side_effects(state.ir_meta, &mut block_state, &instruction.op);
+                } else if let Some(key) = get_value_key(state.ir_meta, &instruction.op, result) {
+                    match block_state.values.entry(key) {
+                        Entry::Occupied(entry) => make_alias(state.ir_meta, result, *entry.get()),
+                        Entry::Vacant(entry) => {
+                            entry.insert(result);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    block
+}
+
+fn make_alias(ir_meta: &mut IRMeta, result: TypedRegisterId, original: TypedRegisterId) {
+    ir_meta.get_instruction_mut(result.id).op =
+        OpCode::Alias(TypedId::from_register_id(original));
+}
+
+fn make_alias_of_id(ir_meta: &mut IRMeta, result: TypedRegisterId, original: TypedId) {
+    ir_meta.get_instruction_mut(result.id).op = OpCode::Alias(original);
+}
+
+fn forward_load(
+    ir_meta: &mut IRMeta,
+    block_state: &mut BlockState,
+    pointer: TypedId,
+    result: TypedRegisterId,
+) {
+    let Id::Variable(variable_id) = resolve_alias(ir_meta, pointer).id else {
+        return;
+    };
+    if !is_private_variable(ir_meta, block_state, variable_id)
+        && !is_read_only_variable(ir_meta, variable_id)
+    {
+        return;
+    }
+
+    match block_state.variable_values.get(&variable_id) {
+        Some(&value) => make_alias_of_id(ir_meta, result, value),
+        None => {
+            block_state.variable_values.insert(variable_id, TypedId::from_register_id(result));
+        }
+    }
+}
+
+fn process_side_effects(ir_meta: &IRMeta, block_state: &mut BlockState, op: &OpCode) {
+    if let &OpCode::Store(pointer, value) = op {
+        match resolve_alias(ir_meta, pointer).id {
+            Id::Variable(variable_id) => {
+                // The whole variable is overwritten, so its value is known from here on.
+                if is_private_variable(ir_meta, block_state, variable_id) {
+                    block_state.variable_values.insert(variable_id, value);
+                }
+                return;
+            }
+            _ => {
+                // A part of the variable is overwritten, forget what's known about it.
+                if let Some(variable_id) = get_root_variable(ir_meta, pointer) {
+                    block_state.variable_values.remove(&variable_id);
+                    return;
+                }
+            }
+        }
+    } else if !op.has_side_effect() {
+        return;
+    }
+
+    // Any private variable may have been modified.
+    block_state
+        .variable_values
+        .retain(|&variable_id, _| is_read_only_variable(ir_meta, variable_id));
+}
+
+// Follow the access chain of a pointer to the variable it is derived from.
+fn get_root_variable(ir_meta: &IRMeta, pointer: TypedId) -> Option<VariableId> {
+    let mut pointer = pointer;
+    loop {
+        match pointer.id {
+            Id::Variable(variable_id) => return Some(variable_id),
+            Id::Constant(_) => return None,
+            Id::Register(register_id) => match ir_meta.get_instruction(register_id).op {
+                OpCode::Alias(id)
+                | OpCode::AccessVectorComponent(id, _)
+                | OpCode::AccessVectorComponentMulti(id, _)
+                | OpCode::AccessVectorComponentDynamic(id, _)
+                | OpCode::AccessMatrixColumn(id, _)
+                | OpCode::AccessStructField(id, _)
+                | OpCode::AccessArrayElement(id, _) => pointer = id,
+                _ => return None,
+            },
+        }
+    }
+}
+
+fn is_private_variable(
+    ir_meta: &IRMeta,
+    block_state: &BlockState,
+    variable_id: VariableId,
+) -> bool {
+    !ir_meta.get_variable(variable_id).is_interface_variable()
+        && !block_state.out_params.contains(&variable_id)
+}
+
+fn is_read_only_variable(ir_meta: &IRMeta, variable_id: VariableId) -> bool {
+    let variable = ir_meta.get_variable(variable_id);
+    if !variable.is_interface_variable() {
+        return false;
+    }
+    let decorations = &variable.decorations;
+    (decorations.has(Decoration::Uniform) || decorations.has(Decoration::Input))
+        && !decorations.has(Decoration::Buffer)
+        && !decorations.has(Decoration::Output)
+        && !decorations.has(Decoration::InputOutput)
+}
+
+// Look through aliases, including the ones created by this transformation.
+fn resolve_alias(ir_meta: &IRMeta, id: TypedId) -> TypedId {
+    match id.id {
+        Id::Register(register_id) => TypedId { id: ir_meta.get_aliased_id(register_id).id, ..id },
+        _ => id,
+    }
+}
+
+fn get_operand(ir_meta: &IRMeta, id: &TypedId) -> Operand {
+    // Values computed from eliminated registers are recognized through their alias.
+    let operand_id = match resolve_alias(ir_meta, *id).id {
+        Id::Register(id) => OperandId::Register(id),
+        Id::Constant(id) => OperandId::Constant(id),
+        Id::Variable(id) => OperandId::Variable(id),
+    };
+    Operand { id: operand_id, type_id: id.type_id, precision: discriminant(&id.precision) }
+}
+
+fn get_value_key(ir_meta: &IRMeta, op: &OpCode, result: TypedRegisterId) -> Option<ValueKey> {
+    let operand = |id: &TypedId| get_operand(ir_meta, id);
+
+    let (sub_op, operands, literals) = match op {
+        OpCode::ExtractVectorComponent(id, index)
+        | OpCode::ExtractStructField(id, index)
+        | OpCode::AccessVectorComponent(id, index)
+        | OpCode::AccessStructField(id, index) => {
+            (SubOpCode::None, vec![operand(id)], vec![*index])
+        }
+        OpCode::ExtractVectorComponentMulti(id, indices)
+        | OpCode::AccessVectorComponentMulti(id, indices) => {
+            (SubOpCode::None, vec![operand(id)], indices.clone())
+        }
+        OpCode::ExtractVectorComponentDynamic(lhs, rhs)
+        | OpCode::ExtractMatrixColumn(lhs, rhs)
+        | OpCode::ExtractArrayElement(lhs, rhs)
+        | OpCode::AccessVectorComponentDynamic(lhs, rhs)
+        | OpCode::AccessMatrixColumn(lhs, rhs)
+        | OpCode::AccessArrayElement(lhs, rhs) => {
+            (SubOpCode::None, vec![operand(lhs), operand(rhs)], vec![])
+        }
+        OpCode::ConstructScalarFromScalar(id)
+        | OpCode::ConstructVectorFromScalar(id)
+        | OpCode::ConstructMatrixFromScalar(id)
+        | OpCode::ConstructMatrixFromMatrix(id) => (SubOpCode::None, vec![operand(id)], vec![]),
+        OpCode::ConstructVectorFromMultiple(ids)
+        | OpCode::ConstructMatrixFromMultiple(ids)
+        | OpCode::ConstructStruct(ids)
+        | OpCode::ConstructArray(ids) => {
+            (SubOpCode::None, ids.iter().map(operand).collect(), vec![])
+        }
+        OpCode::Unary(unary_op, id) => {
+            (SubOpCode::Unary(discriminant(unary_op)), vec![operand(id)], vec![])
+        }
+        OpCode::Binary(binary_op, lhs, rhs) => {
+            (SubOpCode::Binary(discriminant(binary_op)), vec![operand(lhs), operand(rhs)], vec![])
+        }
+        OpCode::BuiltIn(built_in_op, ids) => (
+            SubOpCode::BuiltIn(discriminant(built_in_op)),
+            ids.iter().map(operand).collect(),
+            vec![],
+        ),
+        // Texture instructions depend on implicit derivatives and are left alone, as are the
+        // instructions that are not expected in the middle of a block.
+        _ => return None,
+    };
+
+    Some(ValueKey {
+        op: discriminant(op),
+        sub_op,
+        operands,
+        literals,
+        result_type_id: result.type_id,
+        result_precision: discriminant(&result.precision),
+    })
+}
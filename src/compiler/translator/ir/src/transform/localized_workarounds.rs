@@ -14,6 +14,9 @@ pub struct Options {
     // Clamp non-constant indices to the bounds of the entity being indexed.  For gl_FragData,
     // clamp it to max_dual_source_draw_buffers if gl_SecondaryFragDataEXT is used.
     pub clamp_indirect_indices: bool,
+    // Don't clamp the indices of arrays in uniform and storage blocks, leaving them to the robust
+    // buffer access of the backend.
+    pub skip_buffer_block_arrays: bool,
     pub max_dual_source_draw_buffers: u32,
 }
 
@@ -36,6 +39,7 @@ pub fn run(ir: &mut IR, options: &Options) {
                             indexed,
                             index,
                             result.unwrap(),
+                            options.skip_buffer_block_arrays,
                             options.max_dual_source_draw_buffers,
                         )
                     } else {
@@ -53,6 +57,7 @@ fn clamp_indirect_index(
     indexed: TypedId,
     index: TypedId,
     result: TypedRegisterId,
+    skip_buffer_block_arrays: bool,
     max_dual_source_draw_buffers: u32,
 ) -> Vec<traverser::Transform> {
     // No need to clamp constant indices, they are already validated to be in range.
@@ -78,6 +83,21 @@ fn clamp_indirect_index(
         return vec![];
     }
 
+    // Arrays in buffer blocks may be left to the robust buffer access of the backend too.  Arrays
+    // of blocks and of opaque types are indexed through descriptors, which it doesn't cover.
+    if skip_buffer_block_arrays {
+        if let Type::Array(element_type_id, _) = *indexed_type {
+            let element_type = ir_meta.get_type(element_type_id);
+            let is_indexed_through_descriptors = element_type.is_struct_interface_block()
+                || element_type.is_image()
+                || element_type.is_scalar_atomic_counter()
+                || element_type.is_struct_containing_samplers(ir_meta);
+            if !is_indexed_through_descriptors && is_in_buffer_block(ir_meta, indexed.id) {
+                return vec![];
+            }
+        }
+    }
+
     let mut transforms = vec![];
 
     // On GLSL es 100, clamp is only defined for float, so float arguments are used.
@@ -126,3 +146,23 @@ fn clamp_indirect_index(
     );
     transforms
 }
+
+// Whether the pointer |id| points to the memory of a uniform or storage block.  The default
+// uniform block is excluded, as backends may not keep it in a buffer.
+fn is_in_buffer_block(ir_meta: &IRMeta, id: Id) -> bool {
+    match id {
+        Id::Variable(variable_id) => {
+            let variable = ir_meta.get_variable(variable_id);
+            variable.decorations.has(Decoration::Buffer)
+                || (variable.decorations.has(Decoration::Uniform)
+                    && has_decoration!(variable.decorations, Decoration::Block))
+        }
+        Id::Register(register_id) => match ir_meta.get_instruction(register_id).op {
+            OpCode::AccessStructField(base, _)
+            | OpCode::AccessArrayElement(base, _)
+            | OpCode::Alias(base) => is_in_buffer_block(ir_meta, base.id),
+            _ => false,
+        },
+        Id::Constant(_) => false,
+    }
+}
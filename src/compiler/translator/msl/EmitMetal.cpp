@@ -11,6 +11,7 @@
 #include <cctype>
 #include <map>
 
+#include "anglebase/no_destructor.h"
 #include "common/system_utils.h"
 #include "compiler/translator/BaseTypes.h"
 #include "compiler/translator/ImmutableStringBuilder.h"
@@ -114,6 +115,7 @@ class GenMetalTraverser : public TIntermTraverser
   private:
     using FuncToName = std::map<ImmutableString, Name>;
     static FuncToName BuildFuncToName();
+    static const FuncToName &GetFuncToName();
 
     struct EmitVariableDeclarationConfig
     {
@@ -198,7 +200,7 @@ class GenMetalTraverser : public TIntermTraverser
     bool isTraversingVertexMain       = false;
     bool mTemporarilyDisableSemicolon = false;
     std::unordered_map<const TSymbol *, Name> mRenamedSymbols;
-    const FuncToName mFuncToName           = BuildFuncToName();
+    const FuncToName &mFuncToName          = GetFuncToName();
     size_t mMainTextureIndex               = 0;
     size_t mMainSamplerIndex               = 0;
     size_t mMainUniformBufferIndex         = 0;
@@ -2156,6 +2158,13 @@ bool GenMetalTraverser::visitFunctionDefinition(Visit, TIntermFunctionDefinition
     return false;
 }
 
+const GenMetalTraverser::FuncToName &GenMetalTraverser::GetFuncToName()
+{
+    // Only refers to string literals, so it's shared by all compiles.
+    static const angle::base::NoDestructor<FuncToName> kFuncToName(BuildFuncToName());
+    return *kFuncToName;
+}
+
 GenMetalTraverser::FuncToName GenMetalTraverser::BuildFuncToName()
 {
     FuncToName map;
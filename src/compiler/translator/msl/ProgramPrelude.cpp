@@ -10,6 +10,7 @@
 
 #include <cctype>
 
+#include "anglebase/no_destructor.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/Name.h"
 #include "compiler/translator/Symbol.h"
@@ -79,6 +80,7 @@ class ProgramPrelude : public TIntermTraverser
     }
 
     static FuncToEmitter BuildFuncToEmitter();
+    static const FuncToEmitter &GetFuncToEmitter();
 
     void visitOperator(TOperator op, const TFunction *func, const TType *argType0);
 
@@ -286,7 +288,7 @@ class ProgramPrelude : public TIntermTraverser
     TInfoSinkBase &mOut;
     std::unordered_set<LineTag> mEmitted;
     std::unordered_set<const TSymbol *> mHandled;
-    const FuncToEmitter mFuncToEmitter = BuildFuncToEmitter();
+    const FuncToEmitter &mFuncToEmitter = GetFuncToEmitter();
 };
 
 }  // anonymous namespace
@@ -2802,6 +2804,14 @@ static std::pair<Name, bool> MaskTemplateArgs(const Name &name, size_t bufferSiz
     return {Name(buffer, name.symbolType()), true};
 }
 
+const ProgramPrelude::FuncToEmitter &ProgramPrelude::GetFuncToEmitter()
+{
+    // The map only refers to string literals and stateless emitters, so it's built once and shared
+    // by all compiles instead of being rebuilt for every shader.
+    static const angle::base::NoDestructor<FuncToEmitter> kFuncToEmitter(BuildFuncToEmitter());
+    return *kFuncToEmitter;
+}
+
 ProgramPrelude::FuncToEmitter ProgramPrelude::BuildFuncToEmitter()
 {
 #define EMIT_METHOD(method) \
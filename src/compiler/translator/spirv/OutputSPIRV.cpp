@@ -30,8 +30,9 @@ namespace spv
 #include <spirv/unified1/GLSL.std.450.h>
 }
 
-// SPIR-V tools include for disassembly
+// SPIR-V tools include for disassembly and optimization
 #include <spirv-tools/libspirv.hpp>
+#include <spirv-tools/optimizer.hpp>
 
 // Enable this for debug logging of pre-transform SPIR-V:
 #if !defined(ANGLE_DEBUG_SPIRV_GENERATION)
@@ -390,6 +391,9 @@ class OutputSPIRVTraverser : public TIntermTraverser
     void markVertexOutputOnShaderEnd();
     void markVertexOutputOnEmitVertex();
 
+    // Runs the optimization passes selected by the compile options over the generated SPIR-V.
+    void optimizeSpirv(spirv::Blob *spirvBlob) const;
+
     TCompiler *mCompiler;
     ANGLE_MAYBE_UNUSED_PRIVATE_FIELD const ShCompileOptions &mCompileOptions;
 
@@ -6689,6 +6693,43 @@ void OutputSPIRVTraverser::markVertexOutputOnShaderEnd()
     }
 }
 
+void OutputSPIRVTraverser::optimizeSpirv(spirv::Blob *spirvBlob) const
+{
+    spvtools::Optimizer optimizer(mCompileOptions.emitSPIRV14 ? SPV_ENV_VULKAN_1_1_SPIRV_1_4
+                                                              : SPV_ENV_VULKAN_1_1);
+
+    // The SPIR-V is further transformed at link time, which relies on the reserved ids (such as
+    // kIdIntZero) and the non-semantic instructions being intact.  Passes that remove unused
+    // global types, constants, variables or functions (such as aggressive DCE) are thus avoided,
+    // as well as those that renumber ids.
+    optimizer.RegisterPass(spvtools::CreateDeadBranchElimPass());
+    optimizer.RegisterPass(spvtools::CreateLocalSingleBlockLoadStoreElimPass());
+    optimizer.RegisterPass(spvtools::CreateLocalSingleStoreElimPass());
+    if (mCompileOptions.optimizeSPIRVForPerformance)
+    {
+        optimizer.RegisterPass(spvtools::CreateLocalMultiStoreElimPass());
+        optimizer.RegisterPass(spvtools::CreateCCPPass());
+    }
+    optimizer.RegisterPass(spvtools::CreateSimplificationPass());
+    optimizer.RegisterPass(spvtools::CreateDeadBranchElimPass());
+    optimizer.RegisterPass(spvtools::CreateDeadInsertElimPass());
+    if (mCompileOptions.optimizeSPIRVForPerformance)
+    {
+        optimizer.RegisterPass(spvtools::CreateRedundancyEliminationPass());
+    }
+    optimizer.RegisterPass(spvtools::CreateBlockMergePass());
+
+    // The input is already validated (in debug builds), and so is the output.
+    spvtools::OptimizerOptions options;
+    options.set_run_validator(false);
+
+    spirv::Blob optimized;
+    if (optimizer.Run(spirvBlob->data(), spirvBlob->size(), &optimized, options))
+    {
+        *spirvBlob = std::move(optimized);
+    }
+}
+
 void OutputSPIRVTraverser::markVertexOutputOnEmitVertex()
 {
     // Vertex output happens in the geometry stage at EmitVertex.
@@ -6705,6 +6746,12 @@ spirv::Blob OutputSPIRVTraverser::getSpirv()
     // Validate that correct SPIR-V was generated
     ASSERT(spirv::Validate(result));
 
+    if (mCompileOptions.optimizeSPIRVForSize || mCompileOptions.optimizeSPIRVForPerformance)
+    {
+        optimizeSpirv(&result);
+        ASSERT(spirv::Validate(result));
+    }
+
 #if ANGLE_DEBUG_SPIRV_GENERATION
     // Disassemble and log the generated SPIR-V for debugging.
     spvtools::SpirvTools spirvTools(mCompileOptions.emitSPIRV14 ? SPV_ENV_VULKAN_1_1_SPIRV_1_4
@@ -19,13 +19,47 @@ namespace sh
 {
 namespace
 {
+// Whether |node| is in the memory of a uniform or storage block.  The default uniform block is
+// excluded, as backends may not keep it in a buffer.
+bool IsInBufferBlock(TIntermTyped *node)
+{
+    while (TIntermBinary *binary = node->getAsBinaryNode())
+    {
+        switch (binary->getOp())
+        {
+            case EOpIndexDirect:
+            case EOpIndexIndirect:
+            case EOpIndexDirectStruct:
+            case EOpIndexDirectInterfaceBlock:
+                node = binary->getLeft();
+                break;
+            default:
+                return false;
+        }
+    }
+
+    TIntermSymbol *symbol = node->getAsSymbolNode();
+    if (symbol == nullptr)
+    {
+        return false;
+    }
+
+    const TType &type = symbol->getType();
+    return (type.getQualifier() == EvqUniform || type.getQualifier() == EvqBuffer) &&
+           type.getInterfaceBlock() != nullptr;
+}
+
 // Traverser that finds EOpIndexIndirect nodes and applies a clamp to their right-hand side
 // expression.
 class ClampIndirectIndicesTraverser : public TIntermTraverser
 {
   public:
-    ClampIndirectIndicesTraverser(TCompiler *compiler, TSymbolTable *symbolTable)
-        : TIntermTraverser(true, false, false, symbolTable), mCompiler(compiler)
+    ClampIndirectIndicesTraverser(TCompiler *compiler,
+                                  TSymbolTable *symbolTable,
+                                  bool skipBufferBlockArrays)
+        : TIntermTraverser(true, false, false, symbolTable),
+          mCompiler(compiler),
+          mSkipBufferBlockArrays(skipBufferBlockArrays)
     {
         mIsSecondaryFragDataUsed = symbolTable->isSecondaryFragDataUsed();
     }
@@ -40,16 +74,30 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
             return true;
         }
 
+        const TType &leftType  = node->getLeft()->getType();
+        const TType &rightType = node->getRight()->getType();
+
+        // Arrays in buffer blocks may be left to the robust buffer access of the backend.  Arrays
+        // of blocks and of opaque types are indexed through descriptors, which it doesn't cover.
+        // The children are still processed by this traverser.
+        const TBasicType leftBasicType = leftType.getBasicType();
+        if (mSkipBufferBlockArrays && leftType.isArray() && leftBasicType != EbtInterfaceBlock &&
+            !IsOpaqueType(leftBasicType) && !leftType.isStructureContainingSamplers() &&
+            IsInBufferBlock(node->getLeft()))
+        {
+            return true;
+        }
+
         // Apply the transformation to the left and right nodes
-        bool valid = ClampIndirectIndices(mCompiler, node->getLeft(), mSymbolTable);
+        bool valid =
+            ClampIndirectIndices(mCompiler, node->getLeft(), mSymbolTable, mSkipBufferBlockArrays);
         ASSERT(valid);
-        valid = ClampIndirectIndices(mCompiler, node->getRight(), mSymbolTable);
+        valid =
+            ClampIndirectIndices(mCompiler, node->getRight(), mSymbolTable, mSkipBufferBlockArrays);
         ASSERT(valid);
 
         // Generate clamp(right, 0, N), where N is the size of the array being indexed minus 1.  If
         // the array is runtime-sized, the length() method is called on it.
-        const TType &leftType  = node->getLeft()->getType();
-        const TType &rightType = node->getRight()->getType();
 
         // Don't clamp indirect indices on unsized arrays in buffer blocks.  They are covered by the
         // relevant robust access behavior of the backend.
@@ -133,13 +181,17 @@ class ClampIndirectIndicesTraverser : public TIntermTraverser
     }
 
     TCompiler *mCompiler;
+    bool mSkipBufferBlockArrays;
     bool mIsSecondaryFragDataUsed = false;
 };
 }  // anonymous namespace
 
-bool ClampIndirectIndices(TCompiler *compiler, TIntermNode *root, TSymbolTable *symbolTable)
+bool ClampIndirectIndices(TCompiler *compiler,
+                          TIntermNode *root,
+                          TSymbolTable *symbolTable,
+                          bool skipBufferBlockArrays)
 {
-    ClampIndirectIndicesTraverser traverser(compiler, symbolTable);
+    ClampIndirectIndicesTraverser traverser(compiler, symbolTable, skipBufferBlockArrays);
     root->traverse(&traverser);
     return traverser.updateTree(compiler, root);
 }
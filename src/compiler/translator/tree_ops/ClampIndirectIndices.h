@@ -18,9 +18,11 @@ class TCompiler;
 class TIntermNode;
 class TSymbolTable;
 
+// If |skipBufferBlockArrays|, the indices of arrays in uniform and storage blocks are not clamped.
 [[nodiscard]] bool ClampIndirectIndices(TCompiler *compiler,
                                         TIntermNode *root,
-                                        TSymbolTable *symbolTable);
+                                        TSymbolTable *symbolTable,
+                                        bool skipBufferBlockArrays);
 
 }  // namespace sh
 
@@ -92,6 +92,20 @@ struct OperatorInfo
     bool IsSymbolicOperator() const { return opName && !std::isalnum(opName[0]); }
 };
 
+// An increment or decrement whose result is unused.  The normal postfix operator will do for scalar
+// integers, but WGSL only allows increments of scalar integers, so other types use a compound
+// assignment instead of a prelude function.
+OperatorInfo IncrementOrDecrementStatement(const TType &type, TOperator op)
+{
+    if (type.isScalarInt())
+    {
+        const bool isIncrement = op == EOpPostIncrement || op == EOpPreIncrement;
+        return OperatorInfo{isIncrement ? "++" : "--", std::nullopt, /*isPostfix=*/true};
+    }
+    return OperatorInfo{WGSLProgramPrelude::InlinedIncrementOrDecrement(type, op).data(),
+                        std::nullopt, /*isPostfix=*/true};
+}
+
 // When emitting a list of statements, this determines whether a semicolon follows the statement.
 bool RequiresSemicolonTerminator(TIntermNode &node)
 {
@@ -626,49 +640,33 @@ OperatorInfo OutputWGSLTraverser::useOperatorAndGetInfo(TIntermNode *current,
         case TOperator::EOpBitwiseNot:
             return {"~"};
         // ++ and -- are always statements in WGSL and do not yield a value, so they are
-        // implemented as functions, unless the current expression is a statement and is a scalar
-        // integer, in which case the normal postfix operator will do.
-        // Note that WGSL only allows increments of scalar integers, so this also uses a function to
-        // increment floats.
+        // implemented as functions, unless the current expression is a statement.
+        // NOTE: ++ and -- can only be postfix unary operators in WGSL, so the prefix operators are
+        // implemented the same way.
         case TOperator::EOpPostIncrement:
-            if (isStatement(current) && argType0->isScalarInt())
-            {
-                return OperatorInfo{"++", std::nullopt, /*isPostfix=*/true};
-            }
-            else
+            if (isStatement(current))
             {
-                return OperatorInfo{"", mPrelude->postIncrement(*argType0)};
+                return IncrementOrDecrementStatement(*argType0, op);
             }
+            return OperatorInfo{"", mPrelude->postIncrement(*argType0)};
         case TOperator::EOpPostDecrement:
-            if (isStatement(current) && argType0->isScalarInt())
-            {
-                return OperatorInfo{"--", std::nullopt, /*isPostfix=*/true};
-            }
-            else
+            if (isStatement(current))
             {
-                return OperatorInfo{"", mPrelude->postDecrement(*argType0)};
+                return IncrementOrDecrementStatement(*argType0, op);
             }
-        // NOTE: ++ and -- can only be postfix unary operators in WGSL. If the current expression is
-        // a statement and is a scalar integer, just use the postfix operator, otherwise use a
-        // function call as above.
+            return OperatorInfo{"", mPrelude->postDecrement(*argType0)};
         case TOperator::EOpPreIncrement:
-            if (isStatement(current) && argType0->isScalarInt())
-            {
-                return OperatorInfo{"++", std::nullopt, /*isPostfix=*/true};
-            }
-            else
+            if (isStatement(current))
             {
-                return OperatorInfo{"", mPrelude->preIncrement(*argType0)};
+                return IncrementOrDecrementStatement(*argType0, op);
             }
+            return OperatorInfo{"", mPrelude->preIncrement(*argType0)};
         case TOperator::EOpPreDecrement:
-            if (isStatement(current) && argType0->isScalarInt())
-            {
-                return OperatorInfo{"--", std::nullopt, /*isPostfix=*/true};
-            }
-            else
+            if (isStatement(current))
             {
-                return OperatorInfo{"", mPrelude->preDecrement(*argType0)};
+                return IncrementOrDecrementStatement(*argType0, op);
             }
+            return OperatorInfo{"", mPrelude->preDecrement(*argType0)};
         case TOperator::EOpVectorTimesScalar:
             return {"*"};
         case TOperator::EOpVectorTimesMatrix:
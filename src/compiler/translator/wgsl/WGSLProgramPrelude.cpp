@@ -61,90 +61,79 @@ uint64_t InsertIntoMapWithUniqueId(uint64_t &idCounter, TMap<T, uint64_t> &map,
 }
 }  // namespace
 
-WGSLWrapperFunction WGSLProgramPrelude::preIncrement(const TType &incrementedType)
+WGSLWrapperFunction WGSLProgramPrelude::useFunction(const char *privateName,
+                                                    const char *functionName,
+                                                    FuncId funcId,
+                                                    const TType &pointeeType)
 {
-    ASSERT(incrementedType.getBasicType() == EbtInt || incrementedType.getBasicType() == EbtUInt ||
-           incrementedType.getBasicType() == EbtFloat);
+    const WgslPointerAddressSpace addressSpace = GetWgslAddressSpaceForPointer(pointeeType);
+    mUsedFunctions.insert({funcId, addressSpace});
 
-    uint64_t uniqueId =
-        InsertIntoMapWithUniqueId(mUniqueFuncId, mPreIncrementedTypes, incrementedType);
-    switch (GetWgslAddressSpaceForPointer(incrementedType))
+    switch (addressSpace)
     {
         case WgslPointerAddressSpace::Function:
-            return {BuildConcatenatedImmutableString(ConcatId("preIncFunc", uniqueId), "(&"),
+            return {BuildConcatenatedImmutableString(ConcatId(functionName, funcId), "(&"),
                     kEndParanthesis};
         case WgslPointerAddressSpace::Private:
             // EvqGlobal and various other shader outputs/builtins are all globals.
-            return {BuildConcatenatedImmutableString(ConcatId("preIncPriv", uniqueId), "(&"),
+            return {BuildConcatenatedImmutableString(ConcatId(privateName, funcId), "(&"),
                     kEndParanthesis};
     }
 }
 
+bool WGSLProgramPrelude::isUsed(FuncId funcId, WgslPointerAddressSpace addressSpace) const
+{
+    return mUsedFunctions.count({funcId, addressSpace}) != 0;
+}
+
+WGSLWrapperFunction WGSLProgramPrelude::preIncrement(const TType &incrementedType)
+{
+    ASSERT(incrementedType.getBasicType() == EbtInt || incrementedType.getBasicType() == EbtUInt ||
+           incrementedType.getBasicType() == EbtFloat);
+
+    uint64_t uniqueId =
+        InsertIntoMapWithUniqueId(mUniqueFuncId, mPreIncrementedTypes, incrementedType);
+    return useFunction("preIncPriv", "preIncFunc", uniqueId, incrementedType);
+}
+
 WGSLWrapperFunction WGSLProgramPrelude::preDecrement(const TType &decrementedType)
 {
     uint64_t uniqueId =
         InsertIntoMapWithUniqueId(mUniqueFuncId, mPreDecrementedTypes, decrementedType);
-
-    switch (GetWgslAddressSpaceForPointer(decrementedType))
-    {
-        case WgslPointerAddressSpace::Function:
-            return {BuildConcatenatedImmutableString(ConcatId("preDecFunc", uniqueId), "(&"),
-                    kEndParanthesis};
-        case WgslPointerAddressSpace::Private:
-            // EvqGlobal and various other shader outputs/builtins are all globals.
-            return {BuildConcatenatedImmutableString(ConcatId("preDecPriv", uniqueId), "(&"),
-                    kEndParanthesis};
-    }
+    return useFunction("preDecPriv", "preDecFunc", uniqueId, decrementedType);
 }
 
 WGSLWrapperFunction WGSLProgramPrelude::postIncrement(const TType &incrementedType)
 {
     uint64_t uniqueId =
         InsertIntoMapWithUniqueId(mUniqueFuncId, mPostIncrementedTypes, incrementedType);
-
-    switch (GetWgslAddressSpaceForPointer(incrementedType))
-    {
-        case WgslPointerAddressSpace::Function:
-            return {BuildConcatenatedImmutableString(ConcatId("postIncFunc", uniqueId), "(&"),
-                    kEndParanthesis};
-        case WgslPointerAddressSpace::Private:
-            // EvqGlobal and various other shader outputs/builtins are all globals.
-            return {BuildConcatenatedImmutableString(ConcatId("postIncPriv", uniqueId), "(&"),
-                    kEndParanthesis};
-    }
+    return useFunction("postIncPriv", "postIncFunc", uniqueId, incrementedType);
 }
 
 WGSLWrapperFunction WGSLProgramPrelude::postDecrement(const TType &decrementedType)
 {
     uint64_t uniqueId =
         InsertIntoMapWithUniqueId(mUniqueFuncId, mPostDecrementedTypes, decrementedType);
-
-    switch (GetWgslAddressSpaceForPointer(decrementedType))
-    {
-        case WgslPointerAddressSpace::Function:
-            return {BuildConcatenatedImmutableString(ConcatId("postDecFunc", uniqueId), "(&"),
-                    kEndParanthesis};
-        case WgslPointerAddressSpace::Private:
-            // EvqGlobal and various other shader outputs/builtins are all globals.
-            return {BuildConcatenatedImmutableString(ConcatId("postDecPriv", uniqueId), "(&"),
-                    kEndParanthesis};
-    }
+    return useFunction("postDecPriv", "postDecFunc", uniqueId, decrementedType);
 }
 
 WGSLWrapperFunction WGSLProgramPrelude::assign(const TType &dest, const TType &src, TOperator op)
 {
     uint64_t uniqueId = InsertIntoMapWithUniqueId(mUniqueFuncId, mAssigned, {dest, src, op});
+    return useFunction("assignPriv", "assignFunc", uniqueId, dest);
+}
 
-    switch (GetWgslAddressSpaceForPointer(dest))
-    {
-        case WgslPointerAddressSpace::Function:
-            return {BuildConcatenatedImmutableString(ConcatId("assignFunc", uniqueId), "(&"),
-                    kEndParanthesis};
-        case WgslPointerAddressSpace::Private:
-            // EvqGlobal and various other shader outputs/builtins are all globals.
-            return {BuildConcatenatedImmutableString(ConcatId("assignPriv", uniqueId), "(&"),
-                    kEndParanthesis};
-    }
+ImmutableString WGSLProgramPrelude::InlinedIncrementOrDecrement(const TType &type, TOperator op)
+{
+    ASSERT(op == EOpPostIncrement || op == EOpPreIncrement || op == EOpPostDecrement ||
+           op == EOpPreDecrement);
+    const bool isIncrement = op == EOpPostIncrement || op == EOpPreIncrement;
+
+    TInfoSinkBase sink;
+    sink << (isIncrement ? " += " : " -= ");
+    WriteWgslType(sink, type, {});
+    EmitConstructorList(sink, type, ImmutableString("1"));
+    return ImmutableString(sink.str());
 }
 
 void WGSLProgramPrelude::outputPrelude(TInfoSinkBase &sink)
@@ -164,27 +153,29 @@ void WGSLProgramPrelude::outputPrelude(TInfoSinkBase &sink)
     };
     for (const std::pair<const TType, FuncId> &elem : mPreIncrementedTypes)
     {
-
-        // NOTE: it's easiest just to generate increments and decrements functions for variables
-        // that live in either the function-local scope or the module-local scope. TType holds a
-        // qualifier, but its operator== and operator< ignore the qualifier. We could keep track of
-        // the qualifiers used but that's overkill.
-        genPreIncOrDec(ImmutableString("private"), elem.first, ImmutableString("+="),
-                       ConcatId("preIncPriv", elem.second));
-        genPreIncOrDec(ImmutableString("function"), elem.first, ImmutableString("+="),
-                       ConcatId("preIncFunc", elem.second));
+        if (isUsed(elem.second, WgslPointerAddressSpace::Private))
+        {
+            genPreIncOrDec(ImmutableString("private"), elem.first, ImmutableString("+="),
+                           ConcatId("preIncPriv", elem.second));
+        }
+        if (isUsed(elem.second, WgslPointerAddressSpace::Function))
+        {
+            genPreIncOrDec(ImmutableString("function"), elem.first, ImmutableString("+="),
+                           ConcatId("preIncFunc", elem.second));
+        }
     }
     for (const std::pair<const TType, FuncId> &elem : mPreDecrementedTypes)
     {
-
-        // NOTE: it's easiest just to generate increments and decrements functions for variables
-        // that live in either the function-local scope or the module-local scope. TType holds a
-        // qualifier, but its operator== and operator< ignore the qualifier. We could keep track of
-        // the qualifiers used but that's overkill.
-        genPreIncOrDec(ImmutableString("private"), elem.first, ImmutableString("-="),
-                       ConcatId("preDecPriv", elem.second));
-        genPreIncOrDec(ImmutableString("function"), elem.first, ImmutableString("-="),
-                       ConcatId("preDecFunc", elem.second));
+        if (isUsed(elem.second, WgslPointerAddressSpace::Private))
+        {
+            genPreIncOrDec(ImmutableString("private"), elem.first, ImmutableString("-="),
+                           ConcatId("preDecPriv", elem.second));
+        }
+        if (isUsed(elem.second, WgslPointerAddressSpace::Function))
+        {
+            genPreIncOrDec(ImmutableString("function"), elem.first, ImmutableString("-="),
+                           ConcatId("preDecFunc", elem.second));
+        }
     }
 
     auto genPostIncOrDec = [&](ImmutableString addressSpace, const TType &type, ImmutableString op,
@@ -203,25 +194,29 @@ void WGSLProgramPrelude::outputPrelude(TInfoSinkBase &sink)
     };
     for (const std::pair<const TType, FuncId> &elem : mPostIncrementedTypes)
     {
-        // NOTE: it's easiest just to generate increments and decrements functions for variables
-        // that live in either the function-local scope or the module-local scope. TType holds a
-        // qualifier, but its operator== and operator< ignore the qualifier. We could keep track of
-        // the qualifiers used but that's overkill.
-        genPostIncOrDec(ImmutableString("private"), elem.first, ImmutableString("+="),
-                        ConcatId("postIncPriv", elem.second));
-        genPostIncOrDec(ImmutableString("function"), elem.first, ImmutableString("+="),
-                        ConcatId("postIncFunc", elem.second));
+        if (isUsed(elem.second, WgslPointerAddressSpace::Private))
+        {
+            genPostIncOrDec(ImmutableString("private"), elem.first, ImmutableString("+="),
+                            ConcatId("postIncPriv", elem.second));
+        }
+        if (isUsed(elem.second, WgslPointerAddressSpace::Function))
+        {
+            genPostIncOrDec(ImmutableString("function"), elem.first, ImmutableString("+="),
+                            ConcatId("postIncFunc", elem.second));
+        }
     }
     for (const std::pair<const TType, FuncId> &elem : mPostDecrementedTypes)
     {
-        // NOTE: it's easiest just to generate increments and decrements functions for variables
-        // that live in either the function-local scope or the module-local scope. TType holds a
-        // qualifier, but its operator== and operator< ignore the qualifier. We could keep track of
-        // the qualifiers used but that's overkill.
-        genPostIncOrDec(ImmutableString("private"), elem.first, ImmutableString("-="),
-                        ConcatId("postDecPriv", elem.second));
-        genPostIncOrDec(ImmutableString("function"), elem.first, ImmutableString("-="),
-                        ConcatId("postDecFunc", elem.second));
+        if (isUsed(elem.second, WgslPointerAddressSpace::Private))
+        {
+            genPostIncOrDec(ImmutableString("private"), elem.first, ImmutableString("-="),
+                            ConcatId("postDecPriv", elem.second));
+        }
+        if (isUsed(elem.second, WgslPointerAddressSpace::Function))
+        {
+            genPostIncOrDec(ImmutableString("function"), elem.first, ImmutableString("-="),
+                            ConcatId("postDecFunc", elem.second));
+        }
     }
 
     for (const auto &assigned : mAssigned)
@@ -238,8 +233,14 @@ void WGSLProgramPrelude::outputPrelude(TInfoSinkBase &sink)
             sink << "  return *dest;\n";
             sink << "}\n";
         };
-        genAssignment(ImmutableString("private"), ConcatId("assignPriv", assigned.second));
-        genAssignment(ImmutableString("function"), ConcatId("assignFunc", assigned.second));
+        if (isUsed(assigned.second, WgslPointerAddressSpace::Private))
+        {
+            genAssignment(ImmutableString("private"), ConcatId("assignPriv", assigned.second));
+        }
+        if (isUsed(assigned.second, WgslPointerAddressSpace::Function))
+        {
+            genAssignment(ImmutableString("function"), ConcatId("assignFunc", assigned.second));
+        }
     }
 }
 
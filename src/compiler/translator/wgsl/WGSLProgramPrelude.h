@@ -11,6 +11,7 @@
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/Operator_autogen.h"
+#include "compiler/translator/wgsl/Utils.h"
 
 namespace sh
 {
@@ -30,13 +31,27 @@ class WGSLProgramPrelude
 
     WGSLWrapperFunction assign(const TType &dest, const TType &src, TOperator op);
 
+    // Increments and decrements whose result is unused don't need a wrapper function.  This
+    // returns the postfix compound assignment that implements them, e.g. " += vec2<f32>(1)".
+    static ImmutableString InlinedIncrementOrDecrement(const TType &type, TOperator op);
+
     void outputPrelude(TInfoSinkBase &sink);
 
   private:
     using FuncId = uint64_t;
 
+    WGSLWrapperFunction useFunction(const char *privateName,
+                                    const char *functionName,
+                                    FuncId funcId,
+                                    const TType &pointeeType);
+    bool isUsed(FuncId funcId, WgslPointerAddressSpace addressSpace) const;
+
     FuncId mUniqueFuncId = 0;
 
+    // Every function has a variant for each address space its pointer argument can be in.  Only
+    // the variants that are referenced by the shader are output.
+    TSet<std::pair<FuncId, WgslPointerAddressSpace>> mUsedFunctions;
+
     TMap<TType, FuncId> mPreIncrementedTypes;
     TMap<TType, FuncId> mPreDecrementedTypes;
     TMap<TType, FuncId> mPostIncrementedTypes;
@@ -7,7 +7,9 @@
 // AstcDecompressorImpl.cpp: Decodes ASTC-encoded textures.
 
 #include <array>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 #include <unordered_map>
 
 #include "astcenc.h"
@@ -82,28 +84,54 @@ bool IsAstcDecompressorAvailable()
 // Each context is fairly large (around 30 MB) and takes a while to construct, so it's important to
 // reuse them as much as possible.
 //
-// While context objects can be reused across multiple threads, they must be used sequentially. To
-// avoid having to lock and manage access between threads, we keep one cache per thread. This avoids
-// any concurrency issues, at the cost of extra memory.
+// A context can only decompress one image at a time.  To let concurrent uploads decompress in
+// parallel, contexts are leased out: an idle context for the block size is reused if available,
+// otherwise a new one is created.  Only one idle context is kept per block size; extra contexts
+// created during concurrent decompression are freed when returned.
 //
-// Currently, there is no eviction strategy. Each cache could grow to a maximum of ~400 MB in size
+// Currently, there is no eviction strategy. The cache could grow to a maximum of ~400 MB in size
 // since they are 13 possible ASTC block sizes.
 //
-// Thread-safety: not thread safe.
+// Thread-safety: thread safe.
 class AstcDecompressorContextCache
 {
   public:
     // Returns a context object for a given ASTC block size, along with the error code if the
     // context initialization failed.
     // In this case, the context will be null, and the status code will be non-zero.
-    std::pair<astcenc_context *, astcenc_error> get(uint32_t blockWidth, uint32_t blockHeight)
+    std::pair<AstcencContextUniquePtr, astcenc_error> acquire(uint32_t blockWidth,
+                                                              uint32_t blockHeight)
     {
+        {
+            std::lock_guard<angle::SimpleMutex> lock(mMutex);
+            Value &value = mContexts[{blockWidth, blockHeight}];
+            if (value.error != ASTCENC_SUCCESS || value.idleContext != nullptr)
+            {
+                return {std::move(value.idleContext), value.error};
+            }
+        }
+
+        // Create the context without holding the lock, as this takes a while.
+        astcenc_error error;
+        AstcencContextUniquePtr context = MakeDecoderContext(blockWidth, blockHeight, &error);
+        if (error != ASTCENC_SUCCESS)
+        {
+            std::lock_guard<angle::SimpleMutex> lock(mMutex);
+            mContexts[{blockWidth, blockHeight}].error = error;
+        }
+        return {std::move(context), error};
+    }
+
+    // Returns a context previously acquired from this cache.  astcenc_decompress_reset() must have
+    // been called on it.
+    void release(uint32_t blockWidth, uint32_t blockHeight, AstcencContextUniquePtr &&context)
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mMutex);
         Value &value = mContexts[{blockWidth, blockHeight}];
-        if (value.context == nullptr)
+        if (value.idleContext == nullptr)
         {
-            value.context = MakeDecoderContext(blockWidth, blockHeight, &value.error);
+            value.idleContext = std::move(context);
         }
-        return {value.context.get(), value.error};
     }
 
   private:
@@ -121,8 +149,8 @@ class AstcDecompressorContextCache
 
     struct Value
     {
-        AstcencContextUniquePtr context = nullptr;
-        astcenc_error error             = ASTCENC_SUCCESS;
+        AstcencContextUniquePtr idleContext = nullptr;
+        astcenc_error error                 = ASTCENC_SUCCESS;
     };
 
     // Computes the hash of a Key
@@ -135,34 +163,90 @@ class AstcDecompressorContextCache
         }
     };
 
+    angle::SimpleMutex mMutex;
     std::unordered_map<Key, Value, KeyHash> mContexts;
 };
 
+// State shared between the tasks decompressing a single image.
+//
+// astcenc hands out blocks to whichever thread asks next, so the work within an image is naturally
+// balanced.  The thread calling decompress() participates too, which means the image is decoded
+// even if the worker threads are busy with other images.  Once the calling thread runs out of
+// blocks, the decompression is "closed": tasks that have not started by then skip the image
+// entirely instead of holding up the caller, and the caller only waits for the tasks that are
+// still decoding blocks they were assigned.
+struct DecompressState
+{
+    DecompressState(astcenc_context *context,
+                    const uint8_t *data,
+                    size_t dataLength,
+                    uint32_t imgWidth,
+                    uint32_t imgHeight,
+                    uint8_t *output)
+        : context(context), data(data), dataLength(dataLength), output(output)
+    {
+        image.dim_x     = imgWidth;
+        image.dim_y     = imgHeight;
+        image.dim_z     = 1;
+        image.data_type = ASTCENC_TYPE_U8;
+        image.data      = reinterpret_cast<void **>(&this->output);
+    }
+
+    // Closes the decompression and waits for the tasks that are still running.
+    astcenc_error closeAndWait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        closed = true;
+        activeTaskDone.wait(lock, [this] { return activeTaskCount == 0; });
+        return result;
+    }
+
+    astcenc_context *context;
+    const uint8_t *data;
+    size_t dataLength;
+    uint8_t *output;
+    astcenc_image image;
+
+    std::mutex mutex;
+    std::condition_variable activeTaskDone;
+    bool closed              = false;
+    uint32_t activeTaskCount = 0;
+    astcenc_error result     = ASTCENC_SUCCESS;
+};
+
 struct DecompressTask : public Closure
 {
-    DecompressTask(astcenc_context *context,
-                   uint32_t threadIndex,
-                   const uint8_t *data,
-                   size_t dataLength,
-                   astcenc_image *image)
-        : context(context),
-          threadIndex(threadIndex),
-          data(data),
-          dataLength(dataLength),
-          image(image)
+    DecompressTask(std::shared_ptr<DecompressState> state, uint32_t threadIndex)
+        : state(std::move(state)), threadIndex(threadIndex)
     {}
 
     void operator()() override
     {
-        result = astcenc_decompress_image(context, data, dataLength, image, &kSwizzle, threadIndex);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->closed)
+            {
+                return;
+            }
+            ++state->activeTaskCount;
+        }
+
+        astcenc_error result = astcenc_decompress_image(
+            state->context, state->data, state->dataLength, &state->image, &kSwizzle, threadIndex);
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (result != ASTCENC_SUCCESS)
+        {
+            state->result = result;
+        }
+        if (--state->activeTaskCount == 0)
+        {
+            state->activeTaskDone.notify_all();
+        }
     }
 
-    astcenc_context *context;
+    std::shared_ptr<DecompressState> state;
     uint32_t threadIndex;
-    const uint8_t *data;
-    size_t dataLength;
-    astcenc_image *image;
-    astcenc_error result;
 };
 
 // Performs ASTC decompression of an image on the CPU
@@ -171,10 +255,7 @@ class AstcDecompressorImpl : public AstcDecompressor
   public:
     AstcDecompressorImpl()
         : AstcDecompressor(), mContextCache(std::make_unique<AstcDecompressorContextCache>())
-    {
-        mTasks.reserve(MaxThreads());
-        mWaitEvents.reserve(MaxThreads());
-    }
+    {}
 
     ~AstcDecompressorImpl() override = default;
 
@@ -194,46 +275,31 @@ class AstcDecompressorImpl : public AstcDecompressor
                        size_t inputLength,
                        uint8_t *output) override
     {
-        // A given astcenc context can only decompress one image at a time, which we why we keep
-        // this mutex locked the whole time.
-        std::lock_guard global_lock(mMutex);
-
-        auto [context, context_status] = mContextCache->get(blockWidth, blockHeight);
+        auto [context, context_status] = mContextCache->acquire(blockWidth, blockHeight);
         if (context_status != ASTCENC_SUCCESS)
             return context_status;
 
-        astcenc_image image;
-        image.dim_x     = imgWidth;
-        image.dim_y     = imgHeight;
-        image.dim_z     = 1;
-        image.data_type = ASTCENC_TYPE_U8;
-        image.data      = reinterpret_cast<void **>(&output);
+        auto state = std::make_shared<DecompressState>(context.get(), input, inputLength,
+                                                       imgWidth, imgHeight, output);
 
         // For smaller images the overhead of multithreading exceeds the benefits.
         const bool singleThreaded = (imgHeight <= 32 && imgWidth <= 32) || !multiThreadPool;
-
-        std::shared_ptr<WorkerThreadPool> &threadPool =
-            singleThreaded ? singleThreadPool : multiThreadPool;
         const uint32_t threadCount = singleThreaded ? 1 : MaxThreads();
 
-        mTasks.clear();
-        mWaitEvents.clear();
-
-        for (uint32_t i = 0; i < threadCount; ++i)
+        // Worker thread tasks use thread indices [1, threadCount), the calling thread uses 0.  The
+        // worker tasks don't need to be waited on individually; see DecompressState.
+        for (uint32_t i = 1; i < threadCount; ++i)
         {
-            mTasks.push_back(
-                std::make_shared<DecompressTask>(context, i, input, inputLength, &image));
-            mWaitEvents.push_back(threadPool->postWorkerTask(mTasks[i]));
+            multiThreadPool->postWorkerTask(std::make_shared<DecompressTask>(state, i));
         }
-        WaitableEvent::WaitMany(&mWaitEvents);
-        astcenc_decompress_reset(context);
+        singleThreadPool->postWorkerTask(std::make_shared<DecompressTask>(state, 0))->wait();
 
-        for (auto &task : mTasks)
-        {
-            if (task->result != ASTCENC_SUCCESS)
-                return task->result;
-        }
-        return ASTCENC_SUCCESS;
+        const astcenc_error result = state->closeAndWait();
+
+        astcenc_decompress_reset(context.get());
+        mContextCache->release(blockWidth, blockHeight, std::move(context));
+
+        return result;
     }
 
     const char *getStatusString(int32_t statusCode) const override
@@ -244,9 +310,6 @@ class AstcDecompressorImpl : public AstcDecompressor
 
   private:
     std::unique_ptr<AstcDecompressorContextCache> mContextCache;
-    angle::SimpleMutex mMutex;  // Locked while calling `decode()`
-    std::vector<std::shared_ptr<DecompressTask>> mTasks;
-    std::vector<std::shared_ptr<WaitableEvent>> mWaitEvents;
 };
 
 }  // namespace
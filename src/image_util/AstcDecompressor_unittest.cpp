@@ -6,6 +6,7 @@
 // AstcDecompressor_unittest.cpp: Unit tests for AstcDecompressor
 
 #include <gmock/gmock.h>
+#include <thread>
 #include <vector>
 
 #include "common/WorkerThread.h"
@@ -45,6 +46,49 @@ TEST(AstcDecompressor, Decompress)
     ASSERT_THAT(output, ElementsAreArray(expected));
 }
 
+// Test that images decompressed concurrently from several threads, sharing the same worker thread
+// pool, are all decompressed correctly
+TEST(AstcDecompressor, DecompressConcurrently)
+{
+    const int width          = 512;
+    const int height         = 512;
+    constexpr int kNumImages = 4;
+
+    auto multiThreadedPool =
+        WorkerThreadPool::Create(ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent());
+
+    auto &decompressor = AstcDecompressor::get();
+    if (!decompressor.available())
+        GTEST_SKIP() << "ASTC decompressor not available";
+
+    const std::vector<uint8_t> astcData = makeAstcCheckerboard(width, height);
+    std::vector<std::vector<Rgba>> outputs(kNumImages, std::vector<Rgba>(width * height));
+    std::vector<int32_t> statuses(kNumImages, -1);
+
+    std::vector<std::thread> threads;
+    for (int imageIndex = 0; imageIndex < kNumImages; ++imageIndex)
+    {
+        threads.emplace_back([&, imageIndex]() {
+            auto singleThreadedPool =
+                WorkerThreadPool::Create(ThreadPoolType::Synchronous, 0, ANGLEPlatformCurrent());
+            statuses[imageIndex] = decompressor.decompress(
+                singleThreadedPool, multiThreadedPool, width, height, 8, 8, astcData.data(),
+                astcData.size(), (uint8_t *)outputs[imageIndex].data());
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<Rgba> expected = makeCheckerboard(width, height);
+    for (int imageIndex = 0; imageIndex < kNumImages; ++imageIndex)
+    {
+        EXPECT_EQ(statuses[imageIndex], 0);
+        ASSERT_THAT(outputs[imageIndex], ElementsAreArray(expected));
+    }
+}
+
 // Test that getStatusString returns non-null even for unknown statuses
 TEST(AstcDecompressor, getStatusStringAlwaysNonNull)
 {
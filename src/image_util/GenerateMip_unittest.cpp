@@ -0,0 +1,84 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMip_unittest.cpp: Unit tests for mip generation.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "image_util/generatemip.h"
+
+using namespace angle;
+
+namespace
+{
+// Checks GenerateMip against the box filter written with T::average for a 2D image, which is
+// where the 8-bit formats use vectorized rows.  The width is odd and not a multiple of the
+// vector width, so the scalar loop finishes every row.
+template <typename T>
+void CheckGenerateMip2D()
+{
+    constexpr size_t kSourceWidth  = 75;
+    constexpr size_t kSourceHeight = 6;
+    constexpr size_t kDestWidth    = kSourceWidth / 2;
+    constexpr size_t kDestHeight   = kSourceHeight / 2;
+
+    const size_t sourceRowPitch = kSourceWidth * sizeof(T);
+    const size_t destRowPitch   = kDestWidth * sizeof(T);
+
+    std::vector<uint8_t> source(sourceRowPitch * kSourceHeight);
+    for (size_t byte = 0; byte < source.size(); ++byte)
+    {
+        source[byte] = static_cast<uint8_t>(byte * 37 + (byte >> 3));
+    }
+
+    std::vector<uint8_t> dest(destRowPitch * kDestHeight, 0);
+    GenerateMip<T>(kSourceWidth, kSourceHeight, 1, source.data(), sourceRowPitch,
+                   source.size(), dest.data(), destRowPitch, dest.size());
+
+    const T *sourcePixels = reinterpret_cast<const T *>(source.data());
+    const T *destPixels   = reinterpret_cast<const T *>(dest.data());
+    for (size_t y = 0; y < kDestHeight; ++y)
+    {
+        for (size_t x = 0; x < kDestWidth; ++x)
+        {
+            const T *topLeft = sourcePixels + y * 2 * kSourceWidth + x * 2;
+            T left, right, expected;
+            T::average(&left, topLeft, topLeft + kSourceWidth);
+            T::average(&right, topLeft + 1, topLeft + kSourceWidth + 1);
+            T::average(&expected, &left, &right);
+
+            EXPECT_EQ(0, memcmp(&expected, destPixels + y * kDestWidth + x, sizeof(T)))
+                << "at " << x << ", " << y;
+        }
+    }
+}
+
+// Test 2D mip generation of 4 byte 8-bit formats.
+TEST(GenerateMip, RGBA8)
+{
+    CheckGenerateMip2D<R8G8B8A8>();
+    CheckGenerateMip2D<B8G8R8A8>();
+}
+
+// Test 2D mip generation of 2 byte 8-bit formats.
+TEST(GenerateMip, RG8)
+{
+    CheckGenerateMip2D<R8G8>();
+    CheckGenerateMip2D<L8A8>();
+}
+
+// Test 2D mip generation of 1 byte 8-bit formats.
+TEST(GenerateMip, R8)
+{
+    CheckGenerateMip2D<R8>();
+    CheckGenerateMip2D<L8>();
+}
+}  // anonymous namespace
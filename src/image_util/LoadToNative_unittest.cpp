@@ -504,4 +504,71 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
+
+// Tests that the float to half-float loading function matches gl::float32ToFloat16 for special
+// values, denormals and rows whose width is not a multiple of the vectorized block size.
+TEST(Load32FTo16F, MatchesScalarConversion)
+{
+    ImageLoadContext context;
+    // Zeros, normals, values that round to infinity, infinities, NaNs, denormals and values on
+    // either side of the normal/denormal and rounding boundaries.
+    const uint32_t kValueBits[] = {0x00000000, 0x80000000, 0x3F800000, 0xBF800000, 0x3DCCCCCD,
+                                   0x477FE000, 0x477FF000, 0xC788B800, 0x7F800000, 0xFF800000,
+                                   0x7FC00000, 0xFFC00001, 0x38800000, 0x387FFFFF, 0x33800000,
+                                   0xB3000001, 0x2F800000, 0x477FEFFF, 0x3F801000, 0x3F803000};
+    constexpr size_t kValueCount = sizeof(kValueBits) / sizeof(kValueBits[0]);
+
+    for (size_t width : {1, 7, 8, 9, 31, 100})
+    {
+        const size_t height = 3;
+        std::vector<float> input(width * height);
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = gl::bitCast<float>(kValueBits[(i * 7) % kValueCount]);
+        }
+
+        std::vector<uint16_t> output(width * height);
+        Load32FTo16F<1>(context, width, height, 1, reinterpret_cast<const uint8_t *>(input.data()),
+                        width * sizeof(float), width * height * sizeof(float),
+                        reinterpret_cast<uint8_t *>(output.data()), width * sizeof(uint16_t),
+                        width * height * sizeof(uint16_t));
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            EXPECT_EQ(output[i], gl::float32ToFloat16(input[i]))
+                << "Mismatch at element " << i << " for width " << width;
+        }
+    }
+}
+
+// Tests that the R5G6B5 to RGBA8 loading function expands every channel correctly for all inputs.
+TEST(LoadR5G6B5ToRGBA8, AllValues)
+{
+    ImageLoadContext context;
+    constexpr size_t kWidth  = 256;
+    constexpr size_t kHeight = 256;
+
+    std::vector<uint16_t> input(kWidth * kHeight);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint16_t>(i);
+    }
+
+    std::vector<uint8_t> output(kWidth * kHeight * 4);
+    LoadR5G6B5ToRGBA8(context, kWidth, kHeight, 1, reinterpret_cast<const uint8_t *>(input.data()),
+                      kWidth * sizeof(uint16_t), kWidth * kHeight * sizeof(uint16_t),
+                      output.data(), kWidth * 4, kWidth * kHeight * 4);
+
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        const uint16_t rgb = input[i];
+        const uint8_t r5   = (rgb >> 11) & 0x1F;
+        const uint8_t g6   = (rgb >> 5) & 0x3F;
+        const uint8_t b5   = rgb & 0x1F;
+        EXPECT_EQ(output[i * 4 + 0], static_cast<uint8_t>((r5 << 3) | (r5 >> 2)));
+        EXPECT_EQ(output[i * 4 + 1], static_cast<uint8_t>((g6 << 2) | (g6 >> 4)));
+        EXPECT_EQ(output[i * 4 + 2], static_cast<uint8_t>((b5 << 3) | (b5 >> 2)));
+        EXPECT_EQ(output[i * 4 + 3], 0xFF);
+    }
+}
 }  // namespace
@@ -0,0 +1,171 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Defines the vectorized row kernels used by GenerateMip.
+
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
+#include "image_util/generatemip.h"
+
+#include "common/platform.h"
+
+// SSE2 and NEON are baseline on the targets they are enabled for.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANGLE_GENERATEMIP_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_GENERATEMIP_USE_NEON
+#endif
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+#if defined(ANGLE_GENERATEMIP_USE_SSE2)
+// Averages each byte rounding down, like gl::average: _mm_avg_epu8 rounds up, so one is taken
+// away where the sum is odd.
+inline __m128i AverageU8(__m128i a, __m128i b)
+{
+    const __m128i oddSum = _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1));
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), oddSum);
+}
+
+// Splits the pixels of |first| followed by |second| into the even and the odd ones.  For 1 and 2
+// byte pixels, every pair of pixels is sign extended from its low and high half so that the
+// saturating packs keep the bits unchanged.
+template <size_t PixelBytes>
+inline void DeinterleavePixels(__m128i first, __m128i second, __m128i *evenOut, __m128i *oddOut)
+{
+    if constexpr (PixelBytes == 4)
+    {
+        const __m128 firstPs  = _mm_castsi128_ps(first);
+        const __m128 secondPs = _mm_castsi128_ps(second);
+        *evenOut = _mm_castps_si128(_mm_shuffle_ps(firstPs, secondPs, _MM_SHUFFLE(2, 0, 2, 0)));
+        *oddOut  = _mm_castps_si128(_mm_shuffle_ps(firstPs, secondPs, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    else if constexpr (PixelBytes == 2)
+    {
+        *evenOut = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(first, 16), 16),
+                                   _mm_srai_epi32(_mm_slli_epi32(second, 16), 16));
+        *oddOut  = _mm_packs_epi32(_mm_srai_epi32(first, 16), _mm_srai_epi32(second, 16));
+    }
+    else
+    {
+        static_assert(PixelBytes == 1);
+        *evenOut = _mm_packs_epi16(_mm_srai_epi16(_mm_slli_epi16(first, 8), 8),
+                                   _mm_srai_epi16(_mm_slli_epi16(second, 8), 8));
+        *oddOut  = _mm_packs_epi16(_mm_srai_epi16(first, 8), _mm_srai_epi16(second, 8));
+    }
+}
+
+template <size_t PixelBytes>
+size_t GenerateMipRowXYUnorm8Impl(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth)
+{
+    // Every iteration reads 32 bytes of each source row and writes 16 bytes.
+    constexpr size_t kDestPixelsPerIteration = 16 / PixelBytes;
+
+    size_t x = 0;
+    for (; x + kDestPixelsPerIteration <= destWidth; x += kDestPixelsPerIteration)
+    {
+        const __m128i *source0 = reinterpret_cast<const __m128i *>(sourceRow0 + x * 2 * PixelBytes);
+        const __m128i *source1 = reinterpret_cast<const __m128i *>(sourceRow1 + x * 2 * PixelBytes);
+
+        // Average vertically first, then the even and odd columns, in the same order as the
+        // scalar path so the results are identical.
+        const __m128i vertical0 = AverageU8(_mm_loadu_si128(source0), _mm_loadu_si128(source1));
+        const __m128i vertical1 =
+            AverageU8(_mm_loadu_si128(source0 + 1), _mm_loadu_si128(source1 + 1));
+
+        __m128i even, odd;
+        DeinterleavePixels<PixelBytes>(vertical0, vertical1, &even, &odd);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destRow + x * PixelBytes),
+                         AverageU8(even, odd));
+    }
+    return x;
+}
+#elif defined(ANGLE_GENERATEMIP_USE_NEON)
+template <size_t PixelBytes>
+size_t GenerateMipRowXYUnorm8Impl(const uint8_t *sourceRow0,
+                                  const uint8_t *sourceRow1,
+                                  uint8_t *destRow,
+                                  size_t destWidth)
+{
+    // Every iteration reads 32 bytes of each source row and writes 16 bytes.  The structured
+    // loads split the even and odd pixels, and vhaddq_u8 rounds down like gl::average.
+    constexpr size_t kDestPixelsPerIteration = 16 / PixelBytes;
+
+    size_t x = 0;
+    for (; x + kDestPixelsPerIteration <= destWidth; x += kDestPixelsPerIteration)
+    {
+        const uint8_t *source0 = sourceRow0 + x * 2 * PixelBytes;
+        const uint8_t *source1 = sourceRow1 + x * 2 * PixelBytes;
+
+        uint8x16x2_t row0, row1;
+        if constexpr (PixelBytes == 4)
+        {
+            const uint32x4x2_t pixels0 = vld2q_u32(reinterpret_cast<const uint32_t *>(source0));
+            const uint32x4x2_t pixels1 = vld2q_u32(reinterpret_cast<const uint32_t *>(source1));
+            row0 = {{vreinterpretq_u8_u32(pixels0.val[0]), vreinterpretq_u8_u32(pixels0.val[1])}};
+            row1 = {{vreinterpretq_u8_u32(pixels1.val[0]), vreinterpretq_u8_u32(pixels1.val[1])}};
+        }
+        else if constexpr (PixelBytes == 2)
+        {
+            const uint16x8x2_t pixels0 = vld2q_u16(reinterpret_cast<const uint16_t *>(source0));
+            const uint16x8x2_t pixels1 = vld2q_u16(reinterpret_cast<const uint16_t *>(source1));
+            row0 = {{vreinterpretq_u8_u16(pixels0.val[0]), vreinterpretq_u8_u16(pixels0.val[1])}};
+            row1 = {{vreinterpretq_u8_u16(pixels1.val[0]), vreinterpretq_u8_u16(pixels1.val[1])}};
+        }
+        else
+        {
+            static_assert(PixelBytes == 1);
+            row0 = vld2q_u8(source0);
+            row1 = vld2q_u8(source1);
+        }
+
+        // Average vertically first, then the even and odd columns, in the same order as the
+        // scalar path so the results are identical.
+        const uint8x16_t even = vhaddq_u8(row0.val[0], row1.val[0]);
+        const uint8x16_t odd  = vhaddq_u8(row0.val[1], row1.val[1]);
+        vst1q_u8(destRow + x * PixelBytes, vhaddq_u8(even, odd));
+    }
+    return x;
+}
+#endif
+}  // anonymous namespace
+
+size_t GenerateMipRowXYUnorm8(size_t pixelBytes,
+                              const uint8_t *sourceRow0,
+                              const uint8_t *sourceRow1,
+                              uint8_t *destRow,
+                              size_t destWidth)
+{
+#if defined(ANGLE_GENERATEMIP_USE_SSE2) || defined(ANGLE_GENERATEMIP_USE_NEON)
+    switch (pixelBytes)
+    {
+        case 4:
+            return GenerateMipRowXYUnorm8Impl<4>(sourceRow0, sourceRow1, destRow, destWidth);
+        case 2:
+            return GenerateMipRowXYUnorm8Impl<2>(sourceRow0, sourceRow1, destRow, destWidth);
+        case 1:
+            return GenerateMipRowXYUnorm8Impl<1>(sourceRow0, sourceRow1, destRow, destWidth);
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+#else
+    return 0;
+#endif
+}
+}  // namespace priv
+}  // namespace angle
@@ -54,8 +54,231 @@ inline bool supportsSSE2()
 }
 #endif
 
+// Row kernels used by the hottest load functions.  SSE2 and NEON are baseline on the targets they
+// are enabled for; SSSE3 (needed for byte shuffles) is selected at runtime.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    include <tmmintrin.h>
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    endif
+#    define ANGLE_LOADIMAGE_USE_SSE2
+#    if defined(__clang__) || defined(__GNUC__)
+#        define ANGLE_LOADIMAGE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#    else
+#        define ANGLE_LOADIMAGE_TARGET_SSSE3
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_LOADIMAGE_USE_NEON
+#endif
+
 namespace angle
 {
+namespace
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE2)
+bool SupportsSSSE3()
+{
+    static const bool supports = []() {
+#    if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 1)
+        {
+            return false;
+        }
+        __cpuid(info, 1);
+        return ((info[2] >> 9) & 1) != 0;
+#    else
+        return __builtin_cpu_supports("ssse3") != 0;
+#    endif
+    }();
+    return supports;
+}
+
+template <bool swizzleRB>
+ANGLE_LOADIMAGE_TARGET_SSSE3 size_t LoadRGB8To4ChannelRowSSSE3(const uint8_t *source,
+                                                               uint8_t *dest,
+                                                               size_t width,
+                                                               uint8_t fourthValue)
+{
+    // Spreads four tightly packed RGB pixels into the low three bytes of each 32-bit lane.
+    const __m128i shuffle =
+        swizzleRB ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                  : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i fourth =
+        _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(fourthValue) << 24));
+
+    // 16 pixels per iteration: 48 input bytes are read as three registers, so there is no read
+    // past the end of the row.
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m128i *src = reinterpret_cast<const __m128i *>(source + x * 3);
+        __m128i *dst       = reinterpret_cast<__m128i *>(dest + x * 4);
+
+        __m128i a = _mm_loadu_si128(src + 0);
+        __m128i b = _mm_loadu_si128(src + 1);
+        __m128i c = _mm_loadu_si128(src + 2);
+
+        __m128i p0 = a;
+        __m128i p1 = _mm_alignr_epi8(b, a, 12);
+        __m128i p2 = _mm_alignr_epi8(c, b, 8);
+        __m128i p3 = _mm_srli_si128(c, 4);
+
+        _mm_storeu_si128(dst + 0, _mm_or_si128(_mm_shuffle_epi8(p0, shuffle), fourth));
+        _mm_storeu_si128(dst + 1, _mm_or_si128(_mm_shuffle_epi8(p1, shuffle), fourth));
+        _mm_storeu_si128(dst + 2, _mm_or_si128(_mm_shuffle_epi8(p2, shuffle), fourth));
+        _mm_storeu_si128(dst + 3, _mm_or_si128(_mm_shuffle_epi8(p3, shuffle), fourth));
+    }
+    return x;
+}
+#endif
+
+template <bool swizzleRB>
+size_t LoadRGB8To4ChannelRowSIMD(const uint8_t *source,
+                                 uint8_t *dest,
+                                 size_t width,
+                                 uint8_t fourthValue)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSE2)
+    if (SupportsSSSE3())
+    {
+        return LoadRGB8To4ChannelRowSSSE3<swizzleRB>(source, dest, width, fourthValue);
+    }
+    return 0;
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    const uint8x16_t fourth = vdupq_n_u8(fourthValue);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(source + x * 3);
+        uint8x16x4_t rgba;
+        rgba.val[0] = swizzleRB ? rgb.val[2] : rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = swizzleRB ? rgb.val[0] : rgb.val[2];
+        rgba.val[3] = fourth;
+        vst4q_u8(dest + x * 4, rgba);
+    }
+    return x;
+#else
+    return 0;
+#endif
+}
+
+// Expands 8 R5G6B5 pixels to 8-bit channels, replicating the high bits into the low bits the same
+// way as the scalar code.  Returns the number of processed pixels.
+template <bool swizzleRB>
+size_t LoadR5G6B5To4ChannelRowSIMD(const uint16_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE2)
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    const __m128i alpha = _mm_set1_epi16(static_cast<short>(0xFF00));
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+
+        __m128i r5 = _mm_and_si128(_mm_srli_epi16(rgb, 11), mask5);
+        __m128i g6 = _mm_and_si128(_mm_srli_epi16(rgb, 5), mask6);
+        __m128i b5 = _mm_and_si128(rgb, mask5);
+
+        __m128i r8 = _mm_or_si128(_mm_slli_epi16(r5, 3), _mm_srli_epi16(r5, 2));
+        __m128i g8 = _mm_or_si128(_mm_slli_epi16(g6, 2), _mm_srli_epi16(g6, 4));
+        __m128i b8 = _mm_or_si128(_mm_slli_epi16(b5, 3), _mm_srli_epi16(b5, 2));
+
+        // Each 16-bit lane of |lo| holds the first two channels of a pixel and |hi| the last two.
+        __m128i lo = _mm_or_si128(swizzleRB ? b8 : r8, _mm_slli_epi16(g8, 8));
+        __m128i hi = _mm_or_si128(swizzleRB ? r8 : b8, alpha);
+
+        __m128i *dst = reinterpret_cast<__m128i *>(dest + x * 4);
+        _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(lo, hi));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, hi));
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16x8_t rgb = vld1q_u16(source + x);
+
+        uint8x8_t r5 = vmovn_u16(vshrq_n_u16(rgb, 11));
+        uint8x8_t g6 = vand_u8(vmovn_u16(vshrq_n_u16(rgb, 5)), vdup_n_u8(0x3F));
+        uint8x8_t b5 = vand_u8(vmovn_u16(rgb), vdup_n_u8(0x1F));
+
+        uint8x8_t r8 = vorr_u8(vshl_n_u8(r5, 3), vshr_n_u8(r5, 2));
+        uint8x8_t g8 = vorr_u8(vshl_n_u8(g6, 2), vshr_n_u8(g6, 4));
+        uint8x8_t b8 = vorr_u8(vshl_n_u8(b5, 3), vshr_n_u8(b5, 2));
+
+        uint8x8x4_t rgba;
+        rgba.val[0] = swizzleRB ? b8 : r8;
+        rgba.val[1] = g8;
+        rgba.val[2] = swizzleRB ? r8 : b8;
+        rgba.val[3] = vdup_n_u8(0xFF);
+        vst4_u8(dest + x * 4, rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGB565ToBGR565RowSIMD(const uint16_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOADIMAGE_USE_SSE2)
+    const __m128i greenMask = _mm_set1_epi16(0x07E0);
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        __m128i bgr = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(rgb, 11), _mm_srli_epi16(rgb, 11)),
+                                   _mm_and_si128(rgb, greenMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), bgr);
+    }
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    const uint16x8_t greenMask = vdupq_n_u16(0x07E0);
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16x8_t rgb = vld1q_u16(source + x);
+        uint16x8_t bgr = vorrq_u16(vorrq_u16(vshlq_n_u16(rgb, 11), vshrq_n_u16(rgb, 11)),
+                                   vandq_u16(rgb, greenMask));
+        vst1q_u16(dest + x, bgr);
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
+
+namespace priv
+{
+size_t LoadRGB8ToRGBA8RowSIMD(const uint8_t *source,
+                              uint8_t *dest,
+                              size_t width,
+                              uint8_t fourthValue)
+{
+    return LoadRGB8To4ChannelRowSIMD<false>(source, dest, width, fourthValue);
+}
+}  // namespace priv
+
+namespace
+{
+// Converts a row of RGB half floats to a packed float format, going through floats in chunks that
+// fit on the stack.
+void LoadRGB16FRowToPackedFloat(const uint16_t *source,
+                                uint32_t *dest,
+                                size_t width,
+                                void (*packRow)(const float *, uint32_t *, size_t))
+{
+    constexpr size_t kChunkWidth = 64;
+    float rgb[kChunkWidth * 3];
+    for (size_t x = 0; x < width; x += kChunkWidth)
+    {
+        const size_t chunkWidth = std::min(kChunkWidth, width - x);
+        gl::ConvertFloat16ToFloat32(source + x * 3, rgb, chunkWidth * 3);
+        packRow(rgb, dest + x, chunkWidth);
+    }
+}
+}  // anonymous namespace
+
 ImageLoadContext::ImageLoadContext()                                         = default;
 ImageLoadContext::~ImageLoadContext()                                        = default;
 ImageLoadContext::ImageLoadContext(const ImageLoadContext &other)            = default;
@@ -540,7 +763,7 @@ void LoadRGB565ToBGR565(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB565ToBGR565RowSIMD(source, dest, width); x < width; x++)
             {
                 auto rgb    = source[x];
                 uint16_t r5 = gl::getShiftedData<5, 11>(rgb);
@@ -571,7 +794,8 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = LoadRGB8To4ChannelRowSIMD<true>(source, dest, width, 0xFF);
+            for (; x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -661,7 +885,7 @@ void LoadR5G6B5ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5To4ChannelRowSIMD<true>(source, dest, width); x < width; x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -695,7 +919,7 @@ void LoadR5G6B5ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5To4ChannelRowSIMD<false>(source, dest, width); x < width; x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -1486,12 +1710,7 @@ void LoadRGB16FToRGB9E5(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = gl::convertRGBFloatsTo999E5(gl::float16ToFloat32(source[x * 3 + 0]),
-                                                      gl::float16ToFloat32(source[x * 3 + 1]),
-                                                      gl::float16ToFloat32(source[x * 3 + 2]));
-            }
+            LoadRGB16FRowToPackedFloat(source, dest, width, gl::ConvertRGBFloatsTo999E5);
         }
     }
 }
@@ -1515,11 +1734,7 @@ void LoadRGB32FToRGB9E5(const ImageLoadContext &context,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = gl::convertRGBFloatsTo999E5(source[x * 3 + 0], source[x * 3 + 1],
-                                                      source[x * 3 + 2]);
-            }
+            gl::ConvertRGBFloatsTo999E5(source, dest, width);
         }
     }
 }
@@ -1543,12 +1758,7 @@ void LoadRGB16FToRG11B10F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) << 0) |
-                          (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
-                          (gl::float32ToFloat10(gl::float16ToFloat32(source[x * 3 + 2])) << 22);
-            }
+            LoadRGB16FRowToPackedFloat(source, dest, width, gl::ConvertRGBFloatsTo111110F);
         }
     }
 }
@@ -1572,12 +1782,7 @@ void LoadRGB32FToRG11B10F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = (gl::float32ToFloat11(source[x * 3 + 0]) << 0) |
-                          (gl::float32ToFloat11(source[x * 3 + 1]) << 11) |
-                          (gl::float32ToFloat10(source[x * 3 + 2]) << 22);
-            }
+            gl::ConvertRGBFloatsTo111110F(source, dest, width);
         }
     }
 }
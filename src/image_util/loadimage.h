@@ -27,6 +27,10 @@ struct ImageLoadContext
     // Passed to Load* functions as the context
     std::shared_ptr<WorkerThreadPool> singleThreadPool;
     std::shared_ptr<WorkerThreadPool> multiThreadPool;
+
+    // If non-zero, uncompressed loads producing at least this many bytes may be split into row
+    // stripes that are loaded in parallel on multiThreadPool.
+    size_t parallelLoadThreshold = 0;
 };
 
 void LoadA8ToRGBA8(const ImageLoadContext &context,
@@ -1208,6 +1212,32 @@ inline void LoadPalettedToRGBA8(const ImageLoadContext &context,
                                 size_t outputRowPitch,
                                 size_t outputDepthPitch);
 
+void LoadPalettedToPacked16Impl(const ImageLoadContext &context,
+                                size_t width,
+                                size_t height,
+                                size_t depth,
+                                uint32_t indexBits,
+                                const uint8_t *input,
+                                size_t inputRowPitch,
+                                size_t inputDepthPitch,
+                                uint8_t *output,
+                                size_t outputRowPitch,
+                                size_t outputDepthPitch);
+
+// The 16-bit palettes have the same bit layout as the R5G6B5, R4G4B4A4 and R5G5B5A1 formats, so
+// textures using them can be stored in those formats by copying the palette entries as is.
+template <uint32_t indexBits>
+inline void LoadPalettedToPacked16(const ImageLoadContext &context,
+                                   size_t width,
+                                   size_t height,
+                                   size_t depth,
+                                   const uint8_t *input,
+                                   size_t inputRowPitch,
+                                   size_t inputDepthPitch,
+                                   uint8_t *output,
+                                   size_t outputRowPitch,
+                                   size_t outputDepthPitch);
+
 }  // namespace angle
 
 #include "loadimage.inc"
@@ -136,7 +136,12 @@ void LoadPalettedToRGBA8Impl(const ImageLoadContext &context,
     size_t paletteSize  = 1 << indexBits;
     size_t paletteBytes = paletteSize * colorBytes;
 
-    const uint8_t *palette = input;
+    // Decode the palette once instead of every texel that uses it.
+    R8G8B8A8 palette[256];
+    for (size_t i = 0; i < paletteSize; ++i)
+    {
+        palette[i] = DecodeColor(input + i * colorBytes, redBlueBits, greenBits, alphaBits);
+    }
 
     const uint8_t *texels =
         input + paletteBytes;  // + TODO(http://anglebug.com/42266155): mip levels
@@ -152,10 +157,43 @@ void LoadPalettedToRGBA8Impl(const ImageLoadContext &context,
 
             for (size_t x = 0; x < width; x++)
             {
-                size_t indexIntoPalette = DecodeIndexIntoPalette(srcRow, x, indexBits);
+                dstRow[x] = palette[DecodeIndexIntoPalette(srcRow, x, indexBits)];
+            }
+        }
+    }
+}
+
+// See LoadPalettedToPacked16.
+void LoadPalettedToPacked16Impl(const ImageLoadContext &context,
+                                size_t width,
+                                size_t height,
+                                size_t depth,
+                                uint32_t indexBits,
+                                const uint8_t *input,
+                                size_t inputRowPitch,
+                                size_t inputDepthPitch,
+                                uint8_t *output,
+                                size_t outputRowPitch,
+                                size_t outputDepthPitch)
+{
+    const uint16_t *palette   = reinterpret_cast<const uint16_t *>(input);
+    const size_t paletteBytes = (size_t(1) << indexBits) * sizeof(uint16_t);
+
+    const uint8_t *texels =
+        input + paletteBytes;  // + TODO(http://anglebug.com/42266155): mip levels
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint8_t *srcRow =
+                priv::OffsetDataPointer<uint8_t>(texels, y, z, inputRowPitch, inputDepthPitch);
+            uint16_t *dstRow =
+                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-                dstRow[x] = DecodeColor(palette + indexIntoPalette * colorBytes, redBlueBits,
-                                        greenBits, alphaBits);
+            for (size_t x = 0; x < width; x++)
+            {
+                dstRow[x] = palette[DecodeIndexIntoPalette(srcRow, x, indexBits)];
             }
         }
     }
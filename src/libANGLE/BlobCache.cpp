@@ -9,6 +9,7 @@
 
 #include "libANGLE/BlobCache.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCacheFile.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/histogram_macros.h"
@@ -24,7 +25,8 @@ BlobCache::~BlobCache() {}
 
 void BlobCache::put(const gl::Context *context,
                     const BlobCache::Key &key,
-                    angle::MemoryBuffer &&value)
+                    angle::MemoryBuffer &&value,
+                    EvictionCost evictionCost)
 {
     if (areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()))
     {
@@ -32,7 +34,9 @@ void BlobCache::put(const gl::Context *context,
     }
     else
     {
-        populate(key, std::move(value), CacheSource::Memory);
+        appendToFile(key, value);
+        populate(key, std::move(value), CacheSource::Memory, evictionCost);
+        compactFileIfNeeded();
     }
 }
 
@@ -71,7 +75,10 @@ void BlobCache::putApplication(const gl::Context *context,
     }
 }
 
-void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
+void BlobCache::populate(const BlobCache::Key &key,
+                         angle::MemoryBuffer &&value,
+                         CacheSource source,
+                         EvictionCost evictionCost)
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     CacheEntry newEntry;
@@ -79,7 +86,9 @@ void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value,
     newEntry.second = source;
 
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    const size_t entrySize = newEntry.first.size();
+    mBlobCache.put(key, std::move(newEntry), entrySize,
+                   evictionCost == EvictionCost::High ? kHighEvictionCost : 0);
 }
 
 bool BlobCache::get(const gl::Context *context,
@@ -183,6 +192,74 @@ void BlobCache::remove(const BlobCache::Key &key)
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     mBlobCache.eraseByKey(key);
+    if (mFile)
+    {
+        mFile->onEntryRemoved();
+    }
+}
+
+void BlobCache::openFile(const std::string &path, size_t maxFileSize)
+{
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        if (mFile)
+        {
+            return;
+        }
+
+        if (mBlobCache.maxSize() < maxFileSize / 2)
+        {
+            mBlobCache.resize(maxFileSize / 2);
+        }
+
+        mFile = std::make_unique<BlobCacheFile>();
+        const bool opened =
+            mFile->open(path, maxFileSize, [this](const Key &key, angle::MemoryBuffer &&value) {
+                const size_t entrySize = value.size();
+                mBlobCache.put(key, CacheEntry(std::move(value), CacheSource::Disk), entrySize);
+            });
+        if (!opened)
+        {
+            mFile.reset();
+            return;
+        }
+    }
+
+    // Get rid of a damaged tail or of the entries that didn't fit in the cache.
+    compactFileIfNeeded();
+}
+
+void BlobCache::closeFile()
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mFile.reset();
+}
+
+void BlobCache::appendToFile(const BlobCache::Key &key, const angle::MemoryBuffer &value)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    if (mFile)
+    {
+        mFile->append(key, value.span());
+    }
+}
+
+void BlobCache::compactFileIfNeeded()
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    if (!mFile || !mFile->isOpen() || !mFile->needsCompaction())
+    {
+        return;
+    }
+
+    // Rewriting the entries from the least recently used one keeps their order when the file is
+    // loaded again.
+    std::vector<BlobCacheFile::Entry> entries;
+    entries.reserve(mBlobCache.entryCount());
+    mBlobCache.visitEntries([&entries](const Key &key, const CacheEntry &entry) {
+        entries.emplace_back(&key, entry.first.span());
+    });
+    mFile->compact(entries);
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
@@ -12,6 +12,8 @@
 
 #include <array>
 #include <cstring>
+#include <memory>
+#include <string>
 
 #include "common/SimpleMutex.h"
 #include "libANGLE/Error.h"
@@ -25,6 +27,7 @@ class Context;
 
 namespace egl
 {
+class BlobCacheFile;
 
 // Used by MemoryProgramCache and MemoryShaderCache, this result indicates whether program/shader
 // cache load from blob was successful.
@@ -49,13 +52,24 @@ class BlobCache final : angle::NonCopyable
         Memory,
         Disk,
     };
+    // How expensive an entry is to recreate if it's evicted.  Only used by this object's cache.
+    // High cost entries (such as linked programs) survive longer than low cost ones (such as
+    // compiled shaders) when the cache is full.
+    enum class EvictionCost
+    {
+        Low,
+        High,
+    };
 
     explicit BlobCache(size_t maxCacheSizeBytes);
     ~BlobCache();
 
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
     // will be used.  Otherwise the value is cached in this object.
-    void put(const gl::Context *context, const BlobCache::Key &key, angle::MemoryBuffer &&value);
+    void put(const gl::Context *context,
+             const BlobCache::Key &key,
+             angle::MemoryBuffer &&value,
+             EvictionCost evictionCost = EvictionCost::Low);
 
     // Store a key-blob pair in the cache, but compress the blob before insertion. Returns false if
     // compression fails, returns true otherwise.
@@ -73,7 +87,8 @@ class BlobCache final : angle::NonCopyable
     // to repopulate this object's cache on startup without generating callback calls.
     void populate(const BlobCache::Key &key,
                   angle::MemoryBuffer &&value,
-                  CacheSource source = CacheSource::Disk);
+                  CacheSource source        = CacheSource::Disk,
+                  EvictionCost evictionCost = EvictionCost::Low);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
     // set, those will be used.  Otherwise they key is looked up in this object's cache.
@@ -130,9 +145,21 @@ class BlobCache final : angle::NonCopyable
 
     bool isCachingEnabled(const gl::Context *context) const;
 
+    // Keeps the entries that are cached in this object in the file at |path| as well, so they
+    // survive across runs.  The entries already in the file are loaded right away.  The cache is
+    // resized to half of |maxFileSize| if it's smaller, which discards its current contents.
+    void openFile(const std::string &path, size_t maxFileSize);
+    void closeFile();
+
     angle::SimpleMutex &getMutex() { return mBlobCacheMutex; }
 
   private:
+    // The number of extra passes through the cache a high cost entry gets before being evicted.
+    static constexpr uint32_t kHighEvictionCost = 2;
+
+    void appendToFile(const BlobCache::Key &key, const angle::MemoryBuffer &value);
+    void compactFileIfNeeded();
+
     size_t callBlobGetCallback(const gl::Context *context,
                                const void *key,
                                size_t keySize,
@@ -147,6 +174,8 @@ class BlobCache final : angle::NonCopyable
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+
+    std::unique_ptr<BlobCacheFile> mFile;
 };
 
 }  // namespace egl
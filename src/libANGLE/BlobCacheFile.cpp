@@ -0,0 +1,216 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFile: Keeps the contents of a BlobCache in a file across runs.
+
+#include "libANGLE/BlobCacheFile.h"
+
+#include <cstring>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+#include "xxhash.h"
+
+namespace egl
+{
+namespace
+{
+// Bumped whenever the layout of the file changes.  A file with another header is discarded.
+constexpr char kFileMagic[8] = {'A', 'N', 'G', 'L', 'E', 'B', 'C', '1'};
+
+// Starts every record, to catch records that weren't completely written.
+constexpr uint32_t kRecordMagic = 0x52424341;
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t valueSize;
+    uint64_t checksum;
+    angle::BlobCacheKey key;
+};
+
+uint64_t ComputeRecordChecksum(const angle::BlobCacheKey &key, angle::Span<const uint8_t> value)
+{
+    const uint64_t keyHash = XXH64(key.data(), key.size(), 0);
+    return XXH64(value.data(), value.size(), keyHash);
+}
+
+bool WriteRecord(FILE *file, const angle::BlobCacheKey &key, angle::Span<const uint8_t> value)
+{
+    RecordHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic     = kRecordMagic;
+    header.valueSize = static_cast<uint32_t>(value.size());
+    header.checksum  = ComputeRecordChecksum(key, value);
+    header.key       = key;
+
+    return fwrite(&header, sizeof(header), 1, file) == 1 &&
+           (value.empty() || fwrite(value.data(), value.size(), 1, file) == 1);
+}
+}  // anonymous namespace
+
+BlobCacheFile::BlobCacheFile()
+    : mFile(nullptr), mFileSize(0), mMaxFileSize(0), mNeedsCompaction(false)
+{}
+
+BlobCacheFile::~BlobCacheFile()
+{
+    close();
+}
+
+bool BlobCacheFile::open(const std::string &path, size_t maxFileSize, const LoadFunc &loadFunc)
+{
+    ASSERT(!isOpen());
+
+    mPath            = path;
+    mMaxFileSize     = maxFileSize;
+    mNeedsCompaction = false;
+
+    load(loadFunc);
+    if (!openForAppend())
+    {
+        WARN() << "Failed to open the blob cache file " << mPath;
+        return false;
+    }
+
+    return true;
+}
+
+void BlobCacheFile::close()
+{
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+}
+
+void BlobCacheFile::load(const LoadFunc &loadFunc)
+{
+    FILE *file = fopen(mPath.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    // An empty file is fine, the header is written when the file is opened for appending.
+    char magic[sizeof(kFileMagic)];
+    const size_t magicBytesRead = fread(magic, 1, sizeof(magic), file);
+    if (magicBytesRead != sizeof(magic) || memcmp(magic, kFileMagic, sizeof(magic)) != 0)
+    {
+        fclose(file);
+        mNeedsCompaction = magicBytesRead != 0;
+        return;
+    }
+
+    while (true)
+    {
+        RecordHeader header;
+        const size_t headerBytesRead = fread(&header, 1, sizeof(header), file);
+        if (headerBytesRead == 0 && feof(file))
+        {
+            break;
+        }
+
+        angle::MemoryBuffer value;
+        const bool isValid = headerBytesRead == sizeof(header) && header.magic == kRecordMagic &&
+                             header.valueSize <= mMaxFileSize && value.resize(header.valueSize) &&
+                             (value.empty() || fread(value.data(), value.size(), 1, file) == 1) &&
+                             header.checksum == ComputeRecordChecksum(header.key, value.span());
+        if (!isValid)
+        {
+            mNeedsCompaction = true;
+            break;
+        }
+
+        loadFunc(header.key, std::move(value));
+    }
+
+    fclose(file);
+}
+
+bool BlobCacheFile::openForAppend()
+{
+    ASSERT(mFile == nullptr);
+
+    mFile = fopen(mPath.c_str(), "ab");
+    if (mFile == nullptr)
+    {
+        return false;
+    }
+
+    fseek(mFile, 0, SEEK_END);
+    const long fileSize = ftell(mFile);
+    if (fileSize < 0)
+    {
+        close();
+        return false;
+    }
+    mFileSize = static_cast<size_t>(fileSize);
+
+    if (mFileSize == 0)
+    {
+        if (fwrite(kFileMagic, sizeof(kFileMagic), 1, mFile) != 1 || fflush(mFile) != 0)
+        {
+            close();
+            return false;
+        }
+        mFileSize = sizeof(kFileMagic);
+    }
+
+    return true;
+}
+
+void BlobCacheFile::append(const angle::BlobCacheKey &key, angle::Span<const uint8_t> value)
+{
+    if (mFile == nullptr)
+    {
+        return;
+    }
+
+    // Stop using the file if it can't be written to, the cache still works in memory.
+    if (!WriteRecord(mFile, key, value) || fflush(mFile) != 0)
+    {
+        WARN() << "Failed to write to the blob cache file " << mPath;
+        close();
+        return;
+    }
+
+    mFileSize += sizeof(RecordHeader) + value.size();
+}
+
+void BlobCacheFile::compact(const std::vector<Entry> &entries)
+{
+    const std::string tempPath = mPath + ".tmp";
+
+    FILE *tempFile = fopen(tempPath.c_str(), "wb");
+    bool success =
+        tempFile != nullptr && fwrite(kFileMagic, sizeof(kFileMagic), 1, tempFile) == 1;
+    for (const Entry &entry : entries)
+    {
+        success = success && WriteRecord(tempFile, *entry.first, entry.second);
+    }
+    if (tempFile != nullptr)
+    {
+        success = (fclose(tempFile) == 0) && success;
+    }
+
+    // The file must be closed before it can be replaced on Windows.
+    close();
+
+    if (!success || !angle::RenameFileReplacingExisting(tempPath, mPath))
+    {
+        WARN() << "Failed to compact the blob cache file " << mPath;
+        std::remove(tempPath.c_str());
+        return;
+    }
+
+    mNeedsCompaction = false;
+    if (!openForAppend())
+    {
+        WARN() << "Failed to open the blob cache file " << mPath;
+    }
+}
+}  // namespace egl
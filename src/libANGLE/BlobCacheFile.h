@@ -0,0 +1,68 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFile: Keeps the contents of a BlobCache in a file across runs, for embedders that don't
+//   provide EGL_ANDROID_blob_cache callbacks.  The file is a header followed by records, each
+//   holding a key, a value and a checksum of both.  New entries are appended to it, and an entry
+//   that is put again is appended again, so a later record replaces an earlier one when the file
+//   is loaded.  Once the file grows past its size limit, it's compacted by rewriting it with the
+//   entries of the cache only.
+
+#ifndef LIBANGLE_BLOB_CACHE_FILE_H_
+#define LIBANGLE_BLOB_CACHE_FILE_H_
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/MemoryBuffer.h"
+#include "common/span.h"
+#include "libANGLE/angletypes.h"
+
+namespace egl
+{
+class BlobCacheFile final : angle::NonCopyable
+{
+  public:
+    using LoadFunc = std::function<void(const angle::BlobCacheKey &, angle::MemoryBuffer &&)>;
+    using Entry    = std::pair<const angle::BlobCacheKey *, angle::Span<const uint8_t>>;
+
+    BlobCacheFile();
+    ~BlobCacheFile();
+
+    // Opens the file at |path|, creating it if needed, and calls |loadFunc| with each entry found
+    // in it, in the order they were added.  Loading stops at the first record that is incomplete
+    // or doesn't match its checksum, such as one left by a crash in the middle of an append.  The
+    // file is then rewritten by the next compaction.
+    bool open(const std::string &path, size_t maxFileSize, const LoadFunc &loadFunc);
+    void close();
+    bool isOpen() const { return mFile != nullptr; }
+
+    void append(const angle::BlobCacheKey &key, angle::Span<const uint8_t> value);
+
+    // Called when an entry is removed from the cache, so the next compaction drops it from the
+    // file too.
+    void onEntryRemoved() { mNeedsCompaction = true; }
+
+    bool needsCompaction() const { return mNeedsCompaction || mFileSize > mMaxFileSize; }
+
+    // Replaces the contents of the file with |entries|.  They are written to a temporary file
+    // first, which then replaces the file, so a crash at any point leaves a valid file behind.
+    void compact(const std::vector<Entry> &entries);
+
+  private:
+    void load(const LoadFunc &loadFunc);
+    bool openForAppend();
+
+    std::string mPath;
+    FILE *mFile;
+    size_t mFileSize;
+    size_t mMaxFileSize;
+    bool mNeedsCompaction;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_CACHE_FILE_H_
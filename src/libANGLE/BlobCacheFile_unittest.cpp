@@ -0,0 +1,163 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFile_unittest.cpp: Unit tests for the file that keeps a blob cache across runs.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <map>
+
+#include "common/system_utils.h"
+#include "libANGLE/BlobCacheFile.h"
+
+namespace egl
+{
+namespace
+{
+using Key = angle::BlobCacheKey;
+
+Key MakeKey(uint8_t start)
+{
+    Key key;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<uint8_t>(start + i);
+    }
+    return key;
+}
+
+std::vector<uint8_t> MakeValue(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> value(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        value[i] = static_cast<uint8_t>(start + i);
+    }
+    return value;
+}
+
+class BlobCacheFileTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Optional<std::string> path = angle::CreateTemporaryFile();
+        ASSERT_TRUE(path.valid());
+        mPath = path.value();
+    }
+
+    void TearDown() override
+    {
+        std::remove(mPath.c_str());
+        std::remove((mPath + ".tmp").c_str());
+    }
+
+    // Opens the file and returns what was loaded from it, with later records replacing earlier
+    // ones like the cache does.
+    std::map<Key, std::vector<uint8_t>> open(BlobCacheFile *file, size_t maxFileSize)
+    {
+        std::map<Key, std::vector<uint8_t>> loaded;
+        EXPECT_TRUE(
+            file->open(mPath, maxFileSize, [&loaded](const Key &key, angle::MemoryBuffer &&value) {
+                loaded[key] = std::vector<uint8_t>(value.data(), value.data() + value.size());
+            }));
+        return loaded;
+    }
+
+    std::string mPath;
+};
+
+// Test that the entries appended to the file are loaded when it's opened again.
+TEST_F(BlobCacheFileTest, AppendAndLoad)
+{
+    const std::vector<uint8_t> value0 = MakeValue(100, 0);
+    const std::vector<uint8_t> value1 = MakeValue(7, 3);
+    const std::vector<uint8_t> value2 = MakeValue(50, 9);
+
+    {
+        BlobCacheFile file;
+        EXPECT_TRUE(open(&file, 1024 * 1024).empty());
+        EXPECT_FALSE(file.needsCompaction());
+
+        file.append(MakeKey(0), value0);
+        file.append(MakeKey(1), value1);
+        // Putting an entry again replaces it.
+        file.append(MakeKey(0), value2);
+    }
+
+    BlobCacheFile file;
+    std::map<Key, std::vector<uint8_t>> loaded = open(&file, 1024 * 1024);
+    EXPECT_FALSE(file.needsCompaction());
+    ASSERT_EQ(2u, loaded.size());
+    EXPECT_EQ(value2, loaded[MakeKey(0)]);
+    EXPECT_EQ(value1, loaded[MakeKey(1)]);
+}
+
+// Test that a record that wasn't completely written is dropped, and the file is compacted.
+TEST_F(BlobCacheFileTest, TruncatedRecord)
+{
+    const std::vector<uint8_t> value0 = MakeValue(100, 0);
+    const std::vector<uint8_t> value1 = MakeValue(100, 1);
+
+    {
+        BlobCacheFile file;
+        open(&file, 1024 * 1024);
+        file.append(MakeKey(0), value0);
+        file.append(MakeKey(1), value1);
+    }
+
+    // Cut the last record in the middle of its value.
+    {
+        FILE *file = fopen(mPath.c_str(), "rb");
+        ASSERT_NE(nullptr, file);
+        std::vector<uint8_t> contents(4096);
+        contents.resize(fread(contents.data(), 1, contents.size(), file));
+        fclose(file);
+
+        file = fopen(mPath.c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        fwrite(contents.data(), contents.size() - 10, 1, file);
+        fclose(file);
+    }
+
+    BlobCacheFile file;
+    std::map<Key, std::vector<uint8_t>> loaded = open(&file, 1024 * 1024);
+    EXPECT_TRUE(file.needsCompaction());
+    ASSERT_EQ(1u, loaded.size());
+    EXPECT_EQ(value0, loaded[MakeKey(0)]);
+}
+
+// Test that compacting the file only keeps the given entries.
+TEST_F(BlobCacheFileTest, Compact)
+{
+    const Key key1                    = MakeKey(1);
+    const std::vector<uint8_t> value1 = MakeValue(100, 1);
+    const Key key2                    = MakeKey(2);
+    const std::vector<uint8_t> value2 = MakeValue(100, 2);
+
+    {
+        BlobCacheFile file;
+        open(&file, 250);
+        file.append(MakeKey(0), MakeValue(100, 0));
+        file.append(key1, value1);
+        EXPECT_TRUE(file.needsCompaction());
+
+        file.compact({{&key1, value1}});
+        EXPECT_FALSE(file.needsCompaction());
+        EXPECT_TRUE(file.isOpen());
+
+        // The file can still be appended to after compaction.
+        file.append(key2, value2);
+    }
+
+    BlobCacheFile file;
+    std::map<Key, std::vector<uint8_t>> loaded = open(&file, 1024 * 1024);
+    ASSERT_EQ(2u, loaded.size());
+    EXPECT_EQ(value1, loaded[key1]);
+    EXPECT_EQ(value2, loaded[key2]);
+}
+}  // anonymous namespace
+}  // namespace egl
@@ -1372,6 +1372,8 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_webgpu_texture_client_buffer",              webgpuTextureClientBuffer,          &extensionStrings);
     InsertExtensionString("EGL_ANGLE_create_context_passthrough_shaders",        createContextPassthroughShadersANGLE, &extensionStrings);
     InsertExtensionString("EGL_NV_context_priority_realtime",                    contextPriorityRealtimeNV,          &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_surface_present_statistics",                surfacePresentStatisticsANGLE,      &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_surface_low_latency",                       surfaceLowLatencyANGLE,             &extensionStrings);
     // clang-format on
 
     return extensionStrings;
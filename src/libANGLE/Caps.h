@@ -731,6 +731,12 @@ struct DisplayExtensions
 
     // EGL_NV_context_priority_realtime
     bool contextPriorityRealtimeNV = false;
+
+    // EGL_ANGLE_surface_present_statistics
+    bool surfacePresentStatisticsANGLE = false;
+
+    // EGL_ANGLE_surface_low_latency
+    bool surfaceLowLatencyANGLE = false;
 };
 
 struct DeviceExtensions
@@ -322,22 +322,26 @@ void Compiler::onDestroy(const Context *context)
     }
 }
 
-ShCompilerInstance Compiler::getInstance(ShaderType type)
+ShCompilerInstance Compiler::getPooledInstance(ShaderType type)
 {
     ASSERT(type != ShaderType::InvalidEnum);
     auto &pool = mPools[type];
     if (pool.empty())
     {
-        ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
-        ASSERT(handle);
-        return ShCompilerInstance(handle, mOutputType, type);
-    }
-    else
-    {
-        ShCompilerInstance instance = std::move(pool.back());
-        pool.pop_back();
-        return instance;
+        return ShCompilerInstance();
     }
+
+    ShCompilerInstance instance = std::move(pool.back());
+    pool.pop_back();
+    return instance;
+}
+
+ShCompilerInstance Compiler::constructInstance(ShaderType type) const
+{
+    ASSERT(type != ShaderType::InvalidEnum);
+    ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
+    ASSERT(handle);
+    return ShCompilerInstance(handle, mOutputType, type);
 }
 
 void Compiler::putInstance(ShCompilerInstance &&instance)
@@ -35,7 +35,11 @@ class Compiler final : public RefCountObjectNoID
 
     void onDestroy(const Context *context) override;
 
-    ShCompilerInstance getInstance(ShaderType shaderType);
+    // Returns a compiler instance from the pool, or an empty instance if the pool is empty.
+    ShCompilerInstance getPooledInstance(ShaderType shaderType);
+    // Creates a new compiler instance.  This only reads state that is immutable after
+    // construction, so it is safe to call from the compile worker threads.
+    ShCompilerInstance constructInstance(ShaderType shaderType) const;
     void putInstance(ShCompilerInstance &&instance);
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const ShBuiltInResources &getBuiltInResources() const { return mResources; }
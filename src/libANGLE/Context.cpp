@@ -710,6 +710,9 @@ Context::Context(egl::Display *display,
       mSharedContext(shareContext != nullptr),
       mDisplayTextureShareGroup(shareTextures != nullptr),
       mDisplaySemaphoreShareGroup(shareSemaphores != nullptr),
+      mElideShareContextLock(
+          egl::kIsContextMutexEnabled && !mShared &&
+          display->getFrontendFeatures().elideShareContextLockForUnsharedContexts.enabled),
       mErrors(&mState.getDebug(), display->getFrontendFeatures(), attribs),
       mImplementation(display->getImplementation()
                           ->createContext(mState, &mErrors, config, shareContext, attribs)),
@@ -1745,6 +1748,28 @@ void Context::endQuery(QueryType target)
     mStateCache.onQueryChange(this);
 }
 
+void Context::beginConditionalRender(QueryID query, GLenum mode)
+{
+    Query *queryObject = getQuery(query);
+    ASSERT(queryObject);
+
+    ANGLE_CONTEXT_TRY(mImplementation->beginConditionalRender(this, queryObject, mode));
+
+    // Keep a reference to the query, which may be deleted while conditional rendering is active.
+    mState.setConditionalRenderQuery(this, queryObject, mode);
+}
+
+void Context::endConditionalRender()
+{
+    ASSERT(mState.getConditionalRenderQuery());
+
+    // Intentionally don't call try here, conditional rendering must end even if there was an
+    // error.
+    (void)(mImplementation->endConditionalRender(this));
+
+    mState.setConditionalRenderQuery(this, nullptr, GL_NONE);
+}
+
 void Context::queryCounter(QueryID id, QueryType target)
 {
     ASSERT(target == QueryType::Timestamp);
@@ -3744,6 +3769,17 @@ const GLubyte *Context::getString(GLenum name) const
                 return nullptr;
             }
 
+        case GL_SERIALIZED_CONTEXT_DIGEST_ANGLE:
+            if (angle::SerializeContextToDigest(this, &mCachedSerializedStateDigest) ==
+                angle::Result::Continue)
+            {
+                return AsGLubytePtr(mCachedSerializedStateDigest.c_str());
+            }
+            else
+            {
+                return nullptr;
+            }
+
         default:
             UNREACHABLE();
             return nullptr;
@@ -9421,6 +9457,12 @@ std::shared_ptr<angle::WorkerThreadPool> Context::getShaderCompileThreadPool() c
     {
         return mDisplay->getMultiThreadPool();
     }
+    // GL_KHR_parallel_shader_compile is not exposed to GLES1, but the programs that GLES1Renderer
+    // precompiles speculatively are only useful if they are built in the background.
+    if (mState.isGLES1() && getFrontendFeatures().precompileGLES1NeighborVariants.enabled)
+    {
+        return mDisplay->getMultiThreadPool();
+    }
     return mDisplay->getSingleThreadPool();
 }
 
@@ -10671,6 +10713,15 @@ intptr_t StateCache::getBasicDrawStatesErrorImpl(const Context *context,
     ASSERT((mCachedBasicDrawStatesErrorString == 0) ==
            (mCachedBasicDrawStatesErrorCode == GL_NO_ERROR));
 
+    if (mCachedBasicDrawStatesErrorString == 0)
+    {
+        mCachedDrawableModes = mCachedValidDrawModeBits;
+    }
+    else
+    {
+        mCachedDrawableModes.reset();
+    }
+
     privateStateCache->setCachedBasicDrawStatesErrorValid();
     return mCachedBasicDrawStatesErrorString;
 }
@@ -10763,6 +10814,20 @@ void StateCache::setValidDrawModes(bool pointsOK,
 }
 
 void StateCache::updateValidDrawModes(Context *context)
+{
+    computeValidDrawModes(context);
+
+    mCachedValidDrawModeBits.reset();
+    for (PrimitiveMode mode : angle::AllEnums<PrimitiveMode>())
+    {
+        mCachedValidDrawModeBits.set(mode, mCachedValidDrawModes[mode]);
+    }
+
+    // Recomputed along with the basic draw states error.
+    mCachedDrawableModes.reset();
+}
+
+void StateCache::computeValidDrawModes(Context *context)
 {
     const State &state = context->getState();
 
@@ -15,6 +15,7 @@
 #    pragma allow_unsafe_libc_calls
 #endif
 
+#include <atomic>
 #include <mutex>
 #include <set>
 #include <string>
@@ -405,6 +406,17 @@ class StateCache final : angle::NonCopyable
         return getBasicDrawStatesErrorImpl(context, privateStateCache);
     }
 
+    // Fast path for draw validation.  Returns true if the basic draw states are known to be valid
+    // and |primitiveMode| is a valid draw mode, which is the case for the vast majority of draws.
+    // If false, getBasicDrawStatesErrorString and isValidDrawMode must be checked; the draw may
+    // still turn out to be valid.
+    bool isDrawModeKnownValid(const PrivateStateCache &privateStateCache,
+                              PrimitiveMode primitiveMode) const
+    {
+        return privateStateCache.isCachedBasicDrawStatesErrorValid() &&
+               mCachedDrawableModes.test(primitiveMode);
+    }
+
     // The GL error enum to use when generating errors due to failed draw states. Only valid if
     // getBasicDrawStatesErrorString returns non-zero.
     GLenum getBasicDrawElementsErrorCode() const
@@ -490,12 +502,14 @@ class StateCache final : angle::NonCopyable
 
     // Cache update functions.
     void updateValidDrawModes(Context *context);
+    void computeValidDrawModes(Context *context);
     void updateValidBindTextureTypes(Context *context);
     void updateValidDrawElementsTypes(Context *context);
     void updateBasicDrawStatesError()
     {
         mCachedBasicDrawStatesErrorString = kInvalidPointer;
         mCachedBasicDrawStatesErrorCode   = GL_NO_ERROR;
+        mCachedDrawableModes.reset();
     }
     void updateProgramPipelineError() { mCachedProgramPipelineError = kInvalidPointer; }
     void updateTransformFeedbackActiveUnpaused(Context *context);
@@ -590,6 +604,17 @@ class StateCache final : angle::NonCopyable
     angle::PackedEnumMap<DrawElementsType, bool, angle::EnumSize<DrawElementsType>() + 1>
         mCachedValidDrawElementsTypes;
 
+    // mCachedValidDrawModes as a bitset, updated along with it.  Like mCachedValidDrawModes, has an
+    // extra bit for invalid enum that is never set.
+    using PrimitiveModeBitSet =
+        angle::BitSetT<angle::EnumSize<PrimitiveMode>() + 1, uint16_t, PrimitiveMode>;
+    PrimitiveModeBitSet mCachedValidDrawModeBits;
+
+    // The subset of mCachedValidDrawModes that is known to be drawable, i.e. all of them if the
+    // basic draw states were last found to be valid, and none if they were in error or need to be
+    // recomputed.
+    mutable PrimitiveModeBitSet mCachedDrawableModes;
+
     bool mCachedCanDraw;
 };
 
@@ -760,6 +785,21 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     {
         mShared        = true;
         mSharedContext = true;
+        disableShareContextLockElision();
+    }
+
+    // Returns the mutex locked by the GL entry points, which is nullptr if locking is elided with
+    // the elideShareContextLockForUnsharedContexts feature.
+    egl::ContextMutex *getShareContextMutex() const
+    {
+        return ANGLE_UNLIKELY(mElideShareContextLock.load(std::memory_order_relaxed))
+                   ? nullptr
+                   : &getContextMutex();
+    }
+    // Called once the ContextMutex may be locked by other contexts, through sharing or EGLImages.
+    void disableShareContextLockElision() const
+    {
+        mElideShareContextLock.store(false, std::memory_order_relaxed);
     }
 
     const State &getState() const { return mState; }
@@ -934,7 +974,8 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool supportsGeometryOrTesselation() const;
     void dirtyAllState();
 
-    bool isDestroyed() const { return mIsDestroyed; }
+    // May be called without the global lock, see egl::IsMakeCurrentNoOp().
+    bool isDestroyed() const { return mIsDestroyed.load(std::memory_order_relaxed); }
     void setIsDestroyed() { mIsDestroyed = true; }
 
     // This function acts as glEnable(GL_COLOR_LOGIC_OP), but it's called from the GLES1 emulation
@@ -1072,6 +1113,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mSharedContext;
     bool mDisplayTextureShareGroup;
     bool mDisplaySemaphoreShareGroup;
+    mutable std::atomic<bool> mElideShareContextLock;
 
     // Recorded errors
     mutable ErrorSet mErrors;
@@ -1171,12 +1213,13 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
 
     // Cache representation of the serialized context string.
     mutable std::string mCachedSerializedStateString;
+    mutable std::string mCachedSerializedStateDigest;
 
     mutable size_t mRefCount;
 
     OverlayType mOverlay;
 
-    bool mIsDestroyed;
+    std::atomic<bool> mIsDestroyed;
     bool mDestroyedManagers;
 
     std::unique_ptr<Framebuffer> mDefaultFramebuffer;
@@ -285,6 +285,9 @@
     void framebufferParameteriMESA(GLenum target, GLenum pname, GLint param);                      \
     void getFramebufferParameterivMESA(GLenum target, GLenum pname, GLint *params);                \
     /* GL_NV_EGL_stream_consumer_external */                                                       \
+    /* GL_NV_conditional_render */                                                                 \
+    void beginConditionalRender(QueryID idPacked, GLenum mode);                                    \
+    void endConditionalRender();                                                                   \
     /* GL_NV_fence */                                                                              \
     void deleteFencesNV(GLsizei n, const FenceNVID *fencesPacked);                                 \
     void finishFenceNV(FenceNVID fencePacked);                                                     \
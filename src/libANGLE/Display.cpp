@@ -147,6 +147,10 @@ TLSData *GetDisplayTLS()
 
 constexpr angle::SubjectIndex kGPUSwitchedSubjectIndex = 0;
 
+// The size past which the file named by ANGLE_BLOB_CACHE_FILE is compacted.  Half of it is kept
+// in memory.
+constexpr size_t kMaxBlobCacheFileSize = 64 * 1024 * 1024;
+
 static constexpr size_t kWindowSurfaceMapSize = 32;
 typedef angle::FlatUnorderedMap<EGLNativeWindowType, Surface *, kWindowSurfaceMapSize>
     WindowSurfaceMap;
@@ -746,6 +750,10 @@ void UpdateAttribsFromEnvironment(AttributeMap &attribMap)
 
 static constexpr uint32_t kScratchBufferLifetime = 64u;
 
+// Loads smaller than this are not worth splitting across threads when parallelImageLoads is
+// enabled.
+static constexpr size_t kParallelImageLoadThreshold = 1024 * 1024;
+
 }  // anonymous namespace
 
 // DisplayState
@@ -1110,6 +1118,13 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Let embedders that don't set cache functions keep the cache in a file across runs.
+    const std::string blobCacheFile = angle::GetEnvironmentVar("ANGLE_BLOB_CACHE_FILE");
+    if (!blobCacheFile.empty())
+    {
+        mBlobCache.openFile(blobCacheFile, kMaxBlobCacheFileSize);
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
@@ -1369,6 +1384,7 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
     mMemoryProgramCache.clear();
     mMemoryShaderCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
+    mBlobCache.closeFile();
 
     mState.singleThreadPool.reset();
     mState.multiThreadPool.reset();
@@ -1608,6 +1624,12 @@ Error Display::createImage(const gl::Context *context,
 
     Image *image = imagePtr.release();
 
+    // Contexts using the image lock the ContextMutex of the source context.
+    if (context != nullptr)
+    {
+        context->disableShareContextLockElision();
+    }
+
     ASSERT(outImage != nullptr);
     *outImage = image;
 
@@ -1805,6 +1827,29 @@ Error Display::makeCurrent(Thread *thread,
     }
 
     bool contextChanged = context != previousContext;
+
+    auto makeNewContextCurrent = [&]() -> Error {
+        thread->setCurrent(context);
+
+        ANGLE_TRY(mImplementation->makeCurrent(this, drawSurface, readSurface, context));
+
+        if (context != nullptr)
+        {
+            ANGLE_TRY(context->makeCurrent(this, drawSurface, readSurface));
+            if (contextChanged)
+            {
+                context->addRef();
+            }
+        }
+        return NoError();
+    };
+
+    // Contexts of the same share group use the same ContextMutex.  When switching between them,
+    // the mutex is locked once for the whole switch instead of once per context.
+    const bool isSameContextMutex =
+        previousContext != nullptr && context != nullptr && contextChanged &&
+        &previousContext->getContextMutex() == &context->getContextMutex();
+
     if (previousContext != nullptr && contextChanged)
     {
         // Need AddRefLock because there may be ContextMutex destruction.
@@ -1821,23 +1866,17 @@ Error Display::makeCurrent(Thread *thread,
             ANGLE_TRY(previousDisplay->releaseContext(previousContext, thread));
         }
         ANGLE_TRY(error);
+
+        if (isSameContextMutex)
+        {
+            ANGLE_TRY(makeNewContextCurrent());
+        }
     }
 
+    if (!isSameContextMutex)
     {
         ScopedContextMutexLock lock(context != nullptr ? &context->getContextMutex() : nullptr);
-
-        thread->setCurrent(context);
-
-        ANGLE_TRY(mImplementation->makeCurrent(this, drawSurface, readSurface, context));
-
-        if (context != nullptr)
-        {
-            ANGLE_TRY(context->makeCurrent(this, drawSurface, readSurface));
-            if (contextChanged)
-            {
-                context->addRef();
-            }
-        }
+        ANGLE_TRY(makeNewContextCurrent());
     }
 
     // Tick all the scratch buffers to make sure they get cleaned up eventually if they stop being
@@ -2779,6 +2818,8 @@ angle::ImageLoadContext Display::getImageLoadContext() const
     imageLoadContext.multiThreadPool  = mFrontendFeatures.singleThreadedTextureDecompression.enabled
                                             ? nullptr
                                             : mState.multiThreadPool;
+    imageLoadContext.parallelLoadThreshold =
+        mFrontendFeatures.parallelImageLoads.enabled ? kParallelImageLoadThreshold : 0;
 
     return imageLoadContext;
 }
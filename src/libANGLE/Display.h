@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -201,6 +202,9 @@ class Display final : public LabeledObject,
     void destroySync(Sync *sync);
 
     bool isInitialized() const;
+    // Whether eglTerminate() was called while contexts were still current.  May be called without
+    // the global lock.
+    bool isTerminatedByApi() const { return mTerminatedByApi.load(std::memory_order_relaxed); }
     bool isValidConfig(const Config *config) const;
     bool isValidContext(gl::ContextID contextID) const;
     bool isValidSurface(SurfaceID surfaceID) const;
@@ -449,7 +453,7 @@ class Display final : public LabeledObject,
     angle::SimpleMutex mDisplayGlobalMutex;
     angle::SimpleMutex mProgramCacheMutex;
 
-    bool mTerminatedByApi;
+    std::atomic<bool> mTerminatedByApi;
 };
 
 }  // namespace egl
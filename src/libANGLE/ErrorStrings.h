@@ -80,6 +80,10 @@ inline constexpr const char *kColorNumberGreaterThanMaxDualSourceDrawBuffers = "
 inline constexpr const char *kCompressedMismatch = "Compressed data is valid if-and-only-if the texture is compressed.";
 inline constexpr const char *kCompressedTextureImageSizeMismatch = "The <imageSize> does not match the expected data size for the format and dimensions of the compressed image.";
 inline constexpr const char *kCompressedTexturesNotAttachable = "Compressed textures cannot be attached to a framebuffer.";
+inline constexpr const char *kConditionalRenderActive = "Conditional rendering is already active.";
+inline constexpr const char *kConditionalRenderInactive = "Conditional rendering is not active.";
+inline constexpr const char *kConditionalRenderQueryInUse = "Query is in use for conditional rendering.";
+inline constexpr const char *kConditionalRenderQueryType = "Conditional rendering requires an occlusion query.";
 inline constexpr const char *kConstantColorAlphaLimitation = "Simultaneous use of GL_CONSTANT_ALPHA/GL_ONE_MINUS_CONSTANT_ALPHA and GL_CONSTANT_COLOR/GL_ONE_MINUS_CONSTANT_COLOR as color factors is not supported by this implementation.";
 inline constexpr const char *kContextLost = "Context has been lost.";
 inline constexpr const char *kCopyAlias = "The read and write copy regions alias memory.";
@@ -280,6 +284,7 @@ inline constexpr const char *kInvalidCompressedFormat = "Not a valid compressed
 inline constexpr const char *kInvalidCompressedInternalFormat = "Internal format 0x%04X is not a valid compressed format in the current context.";
 inline constexpr const char *kInvalidCompressedImageSize = "Invalid compressed image size.";
 inline constexpr const char *kInvalidCompressedRegionSize = "Invalid region for compressed texture format.";
+inline constexpr const char *kInvalidConditionalRenderMode = "Invalid conditional render mode.";
 inline constexpr const char *kInvalidConstantColor = "CONSTANT_COLOR (or ONE_MINUS_CONSTANT_COLOR) and CONSTANT_ALPHA (or ONE_MINUS_CONSTANT_ALPHA) cannot be used together as source and destination color factors in the blend function.";
 inline constexpr const char *kInvalidCopyCombination = "Invalid copy texture format combination.";
 inline constexpr const char *kInvalidCoverageComponents = "components is not one of GL_RGB, GL_RGBA, GL_ALPHA or GL_NONE.";
@@ -783,6 +783,7 @@ Framebuffer::Framebuffer(const Context *context, rx::GLImplFactory *factory)
       mImpl(factory->createFramebuffer(mState)),
       mCachedStatus(FramebufferStatus::Incomplete(GL_FRAMEBUFFER_UNDEFINED_OES,
                                                   err::kFramebufferIncompleteSurfaceless)),
+      mNextCompletenessCacheEntry(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT),
       mAttachmentChangedAfterEnablingFoveation(false)
@@ -795,6 +796,7 @@ Framebuffer::Framebuffer(const Context *context, rx::GLImplFactory *factory, Fra
     : mState(context->getCaps(), id, context->getShareGroup()->generateFramebufferSerial()),
       mImpl(factory->createFramebuffer(mState)),
       mCachedStatus(),
+      mNextCompletenessCacheEntry(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT),
       mAttachmentChangedAfterEnablingFoveation(false)
@@ -1229,11 +1231,88 @@ void Framebuffer::invalidateCompletenessCache()
     onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
 }
 
+bool Framebuffer::AttachmentCompletenessKey::operator==(
+    const AttachmentCompletenessKey &other) const
+{
+    return resourceSerial == other.resourceSerial && type == other.type &&
+           binding == other.binding && imageIndex == other.imageIndex &&
+           numViews == other.numViews && baseViewIndex == other.baseViewIndex &&
+           isMultiview == other.isMultiview &&
+           renderToTextureSamples == other.renderToTextureSamples;
+}
+
+bool Framebuffer::CompletenessCacheKey::operator==(const CompletenessCacheKey &other) const
+{
+    return attachments == other.attachments && drawBufferStates == other.drawBufferStates &&
+           readBufferState == other.readBufferState && defaultWidth == other.defaultWidth &&
+           defaultHeight == other.defaultHeight && defaultSamples == other.defaultSamples &&
+           defaultFixedSampleLocations == other.defaultFixedSampleLocations &&
+           defaultLayers == other.defaultLayers;
+}
+
+void Framebuffer::getCompletenessCacheKey(CompletenessCacheKey *keyOut) const
+{
+    auto addAttachment = [keyOut](const FramebufferAttachment &attachment) {
+        AttachmentCompletenessKey attachmentKey;
+        if (attachment.isAttached())
+        {
+            attachmentKey.resourceSerial = attachment.getResource()->getCompletenessSerial();
+            attachmentKey.type           = attachment.type();
+            attachmentKey.binding        = attachment.getBinding();
+            if (attachment.type() == GL_TEXTURE)
+            {
+                attachmentKey.imageIndex = attachment.getTextureImageIndex();
+            }
+            attachmentKey.numViews               = attachment.getNumViews();
+            attachmentKey.baseViewIndex          = attachment.getBaseViewIndex();
+            attachmentKey.isMultiview            = attachment.isMultiview();
+            attachmentKey.renderToTextureSamples = attachment.getRenderToTextureSamples();
+        }
+        keyOut->attachments.push_back(attachmentKey);
+    };
+
+    for (const FramebufferAttachment &colorAttachment : mState.mColorAttachments)
+    {
+        addAttachment(colorAttachment);
+    }
+    addAttachment(mState.mDepthAttachment);
+    addAttachment(mState.mStencilAttachment);
+
+    keyOut->drawBufferStates            = mState.mDrawBufferStates;
+    keyOut->readBufferState             = mState.mReadBufferState;
+    keyOut->defaultWidth                = mState.mDefaultWidth;
+    keyOut->defaultHeight               = mState.mDefaultHeight;
+    keyOut->defaultSamples              = mState.mDefaultSamples;
+    keyOut->defaultFixedSampleLocations = mState.mDefaultFixedSampleLocations;
+    keyOut->defaultLayers               = mState.mDefaultLayers;
+}
+
 const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) const
 {
     ASSERT(!isDefault());
     ASSERT(hasAnyDirtyBit() || !mCachedStatus.valid());
 
+    // The cache is not used when the back-end needs to sync state as part of the check, or with
+    // WebGL 1, where the separate depth/stencil attachment is not part of the key.
+    const State &state = context->getState();
+    const bool useCompletenessCache =
+        !mImpl->shouldSyncStateBeforeCheckStatus() && !state.isWebGL1();
+    CompletenessCacheKey cacheKey;
+    if (useCompletenessCache)
+    {
+        getCompletenessCacheKey(&cacheKey);
+        for (const CompletenessCacheEntry &entry : mCompletenessCache)
+        {
+            if (entry.key == cacheKey)
+            {
+                state.onFramebufferCompletenessCacheLookup(true);
+                mCachedStatus = entry.status;
+                return mCachedStatus.value();
+            }
+        }
+        state.onFramebufferCompletenessCacheLookup(false);
+    }
+
     mCachedStatus = checkStatusWithGLFrontEnd(context);
 
     if (mCachedStatus.value().isComplete())
@@ -1268,6 +1347,21 @@ const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) co
         mCachedStatus = mImpl->checkStatus(context);
     }
 
+    if (useCompletenessCache)
+    {
+        CompletenessCacheEntry entry = {std::move(cacheKey), mCachedStatus.value()};
+        if (mCompletenessCache.size() < kCompletenessCacheSize)
+        {
+            mCompletenessCache.push_back(std::move(entry));
+        }
+        else
+        {
+            mCompletenessCache[mNextCompletenessCacheEntry] = std::move(entry);
+            mNextCompletenessCacheEntry =
+                (mNextCompletenessCacheEntry + 1) % kCompletenessCacheSize;
+        }
+    }
+
     return mCachedStatus.value();
 }
 
@@ -2282,7 +2376,15 @@ void Framebuffer::onSubjectStateChange(angle::SubjectIndex index, angle::Subject
         // This can be triggered by SubImage calls for Textures.
         if (message == angle::SubjectMessage::ContentsChanged)
         {
-            mDirtyBits.set(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index);
+            // Streaming uploads send this message once per call.  If the bit is still set, the
+            // observers were already told about it and will sync the framebuffer before its next
+            // use, so the notification is coalesced with the pending one.
+            const size_t dirtyBit = DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index;
+            if (mDirtyBits.test(dirtyBit))
+            {
+                return;
+            }
+            mDirtyBits.set(dirtyBit);
             onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
             return;
         }
@@ -341,7 +341,7 @@ class Framebuffer final : public angle::ObserverInterface,
         // The default framebuffer is always complete except when it is surfaceless in which
         // case it is always unsupported.
         ASSERT(!isDefault() || mCachedStatus.valid());
-        if (isDefault() || (!hasAnyDirtyBit() && mCachedStatus.valid()))
+        if (isDefault() || (!hasAnyCompletenessDirtyBit() && mCachedStatus.valid()))
         {
             return mCachedStatus.value();
         }
@@ -435,6 +435,17 @@ class Framebuffer final : public angle::ObserverInterface,
     using DirtyBits = angle::BitSet<DIRTY_BIT_MAX>;
     bool hasAnyDirtyBit() const { return mDirtyBits.any(); }
 
+    // Changes to the contents of the attachments don't affect completeness.
+    bool hasAnyCompletenessDirtyBit() const
+    {
+        constexpr DirtyBits kContentsDirtyBits(
+            DirtyBits::Mask(DIRTY_BIT_STENCIL_BUFFER_CONTENTS + 1).bits() &
+            ~DirtyBits::Mask(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0).bits());
+        DirtyBits dirtyBits = mDirtyBits;
+        dirtyBits &= ~kContentsDirtyBits;
+        return dirtyBits.any();
+    }
+
     DrawBufferMask getActiveFloat32ColorAttachmentDrawBufferMask() const
     {
         return mFloat32ColorAttachmentBits & getDrawBufferMask();
@@ -577,6 +588,49 @@ class Framebuffer final : public angle::ObserverInterface,
         mSharedExponentColorAttachmentBits.set(index, format->type == GL_UNSIGNED_INT_5_9_9_9_REV);
     }
 
+    // Identifies everything the completeness of an attachment depends on.  The resource's
+    // completeness serial changes along with its format, size and other relevant state.
+    struct AttachmentCompletenessKey
+    {
+        bool operator==(const AttachmentCompletenessKey &other) const;
+
+        ImageIndex imageIndex;
+        uint64_t resourceSerial        = 0;
+        GLenum type                    = GL_NONE;
+        GLenum binding                 = GL_NONE;
+        GLsizei numViews               = 0;
+        GLint baseViewIndex            = 0;
+        bool isMultiview               = false;
+        GLsizei renderToTextureSamples = 0;
+    };
+
+    struct CompletenessCacheKey
+    {
+        bool operator==(const CompletenessCacheKey &other) const;
+
+        angle::FixedVector<AttachmentCompletenessKey, IMPLEMENTATION_MAX_DRAW_BUFFERS + 2>
+            attachments;
+        DrawBuffersVector<GLenum> drawBufferStates;
+        GLenum readBufferState           = GL_NONE;
+        GLint defaultWidth               = 0;
+        GLint defaultHeight              = 0;
+        GLint defaultSamples             = 0;
+        bool defaultFixedSampleLocations = false;
+        GLint defaultLayers              = 0;
+    };
+
+    struct CompletenessCacheEntry
+    {
+        CompletenessCacheKey key;
+        FramebufferStatus status;
+    };
+
+    // Framebuffers used as ping-pong targets switch between a few attachment combinations, so a
+    // handful of entries is enough.
+    static constexpr size_t kCompletenessCacheSize = 4;
+
+    void getCompletenessCacheKey(CompletenessCacheKey *keyOut) const;
+
     angle::Result syncAllDrawAttachmentState(const Context *context, Command command) const;
     angle::Result syncAttachmentState(const Context *context,
                                       Command command,
@@ -586,6 +640,9 @@ class Framebuffer final : public angle::ObserverInterface,
     rx::FramebufferImpl *mImpl;
 
     mutable Optional<FramebufferStatus> mCachedStatus;
+    // Completeness of recently checked attachment combinations, used in round-robin order.
+    mutable angle::FixedVector<CompletenessCacheEntry, kCompletenessCacheSize> mCompletenessCache;
+    mutable size_t mNextCompletenessCacheEntry;
     DrawBuffersVector<angle::ObserverBinding> mDirtyColorAttachmentBindings;
     angle::ObserverBinding mDirtyDepthAttachmentBinding;
     angle::ObserverBinding mDirtyStencilAttachmentBinding;
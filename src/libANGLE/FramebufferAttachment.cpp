@@ -9,6 +9,8 @@
 
 #include "libANGLE/FramebufferAttachment.h"
 
+#include <atomic>
+
 #include "common/utilities.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
@@ -21,6 +23,15 @@
 
 namespace gl
 {
+namespace
+{
+// Objects may be shared between contexts, so the serials are generated process-wide.
+uint64_t GenerateCompletenessSerial()
+{
+    static std::atomic<uint64_t> sNextSerial(1);
+    return sNextSerial.fetch_add(1, std::memory_order_relaxed);
+}
+}  // anonymous namespace
 
 ////// FramebufferAttachment::Target Implementation //////
 
@@ -328,10 +339,17 @@ void FramebufferAttachment::setInitState(InitState initState) const
 
 ////// FramebufferAttachmentObject Implementation //////
 
-FramebufferAttachmentObject::FramebufferAttachmentObject() {}
+FramebufferAttachmentObject::FramebufferAttachmentObject()
+    : mCompletenessSerial(GenerateCompletenessSerial())
+{}
 
 FramebufferAttachmentObject::~FramebufferAttachmentObject() {}
 
+void FramebufferAttachmentObject::onCompletenessStateChange()
+{
+    mCompletenessSerial = GenerateCompletenessSerial();
+}
+
 angle::Result FramebufferAttachmentObject::getAttachmentRenderTarget(
     const Context *context,
     GLenum binding,
@@ -262,8 +262,17 @@ class FramebufferAttachmentObject : public angle::Subject, public angle::Observe
                                      GLenum binding,
                                      const ImageIndex &imageIndex);
 
+    // A serial that changes whenever a state that framebuffer completeness depends on changes.
+    // Serials are unique across all objects, so they identify the object as well.
+    uint64_t getCompletenessSerial() const { return mCompletenessSerial; }
+
   protected:
     virtual rx::FramebufferAttachmentObjectImpl *getAttachmentImpl() const = 0;
+
+    void onCompletenessStateChange();
+
+  private:
+    uint64_t mCompletenessSerial;
 };
 
 inline const ImageIndex &FramebufferAttachment::getTextureImageIndex() const
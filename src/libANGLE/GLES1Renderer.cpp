@@ -28,6 +28,7 @@
 #include "libANGLE/State.h"
 #include "libANGLE/context_private_call.inl.h"
 #include "libANGLE/renderer/ContextImpl.h"
+#include "platform/autogen/FrontendFeatures_autogen.h"
 
 namespace
 {
@@ -679,6 +680,7 @@ Program *GLES1Renderer::getProgram(ShaderProgramID handle) const
 angle::Result GLES1Renderer::compileShader(Context *context,
                                            ShaderType shaderType,
                                            const char *src,
+                                           angle::JobResultExpectancy resultExpectancy,
                                            ShaderProgramID *shaderOut)
 {
     rx::ContextImpl *implementation = context->getImplementation();
@@ -694,7 +696,14 @@ angle::Result GLES1Renderer::compileShader(Context *context,
     ANGLE_CHECK(context, shaderObject, "Missing shader object", GL_INVALID_OPERATION);
 
     shaderObject->setSource(context, 1, &src, nullptr);
-    shaderObject->compile(context, angle::JobResultExpectancy::Immediate);
+    shaderObject->compile(context, resultExpectancy);
+
+    // Waiting for the compile result would defeat precompiling the shader in the background.  A
+    // failed compilation results in a failed link, which is checked in finishProgram().
+    if (resultExpectancy == angle::JobResultExpectancy::Future)
+    {
+        return angle::Result::Continue;
+    }
 
     if (!shaderObject->isCompiled(context))
     {
@@ -712,10 +721,10 @@ angle::Result GLES1Renderer::compileShader(Context *context,
 }
 
 angle::Result GLES1Renderer::linkProgram(Context *context,
-                                         State *glState,
                                          ShaderProgramID vertexShader,
                                          ShaderProgramID fragmentShader,
                                          const angle::HashMap<GLint, std::string> &attribLocs,
+                                         angle::JobResultExpectancy resultExpectancy,
                                          ShaderProgramID *programOut)
 {
     if (!mShaderPrograms->createProgram(context->getImplementation(), programOut))
@@ -737,31 +746,15 @@ angle::Result GLES1Renderer::linkProgram(Context *context,
         programObject->bindAttributeLocation(context, index, name.c_str());
     }
 
-    ANGLE_TRY(programObject->link(context, angle::JobResultExpectancy::Immediate));
-    programObject->resolveLink(context);
-
-    ANGLE_TRY(glState->setProgram(context, programObject));
-
-    if (!programObject->isLinked())
-    {
-        GLint infoLogLength = programObject->getInfoLogLength();
-        std::vector<char> infoLog(infoLogLength, 0);
-        programObject->getInfoLog(infoLogLength - 1, nullptr, infoLog.data());
-
-        ERR() << "Internal GLES 1 shader link failed. Info log: " << infoLog.data();
-        ANGLE_CHECK(context, false, "GLES1Renderer program link failed.", GL_INVALID_OPERATION);
-        return angle::Result::Stop;
-    }
-
-    programObject->detachShader(context, getShader(vertexShader));
-    programObject->detachShader(context, getShader(fragmentShader));
-
-    return angle::Result::Continue;
+    // The link result is checked in finishProgram(), possibly much later if the program is
+    // precompiled.
+    return programObject->link(context, resultExpectancy);
 }
 
-const char *GLES1Renderer::getShaderBool(GLES1StateEnables state)
+const char *GLES1Renderer::getShaderBool(const GLES1ShaderState &shaderState,
+                                         GLES1StateEnables state)
 {
-    if (mShaderState.mGLES1StateEnabled[state])
+    if (shaderState.mGLES1StateEnabled[state])
     {
         return "true";
     }
@@ -772,11 +765,12 @@ const char *GLES1Renderer::getShaderBool(GLES1StateEnables state)
 }
 
 void GLES1Renderer::addShaderDefine(std::stringstream &outStream,
+                                    const GLES1ShaderState &shaderState,
                                     GLES1StateEnables state,
                                     const char *enableString)
 {
     outStream << "\n";
-    outStream << "#define " << enableString << " " << getShaderBool(state);
+    outStream << "#define " << enableString << " " << getShaderBool(shaderState, state);
 }
 
 void GLES1Renderer::addShaderUint(std::stringstream &outStream, const char *name, uint16_t value)
@@ -787,7 +781,7 @@ void GLES1Renderer::addShaderUint(std::stringstream &outStream, const char *name
 
 void GLES1Renderer::addShaderUintTexArray(std::stringstream &outStream,
                                           const char *texString,
-                                          GLES1ShaderState::UintTexArray &texState)
+                                          const GLES1ShaderState::UintTexArray &texState)
 {
     outStream << "\n";
     outStream << "const uint " << texString << "[kMaxTexUnits] = uint[kMaxTexUnits](";
@@ -804,7 +798,7 @@ void GLES1Renderer::addShaderUintTexArray(std::stringstream &outStream,
 
 void GLES1Renderer::addShaderBoolTexArray(std::stringstream &outStream,
                                           const char *name,
-                                          GLES1ShaderState::BoolTexArray &value)
+                                          const GLES1ShaderState::BoolTexArray &value)
 {
     outStream << std::boolalpha;
     outStream << "\n";
@@ -822,7 +816,7 @@ void GLES1Renderer::addShaderBoolTexArray(std::stringstream &outStream,
 
 void GLES1Renderer::addShaderBoolLightArray(std::stringstream &outStream,
                                             const char *name,
-                                            GLES1ShaderState::BoolLightArray &value)
+                                            const GLES1ShaderState::BoolLightArray &value)
 {
     outStream << std::boolalpha;
     outStream << "\n";
@@ -840,7 +834,7 @@ void GLES1Renderer::addShaderBoolLightArray(std::stringstream &outStream,
 
 void GLES1Renderer::addShaderBoolClipPlaneArray(std::stringstream &outStream,
                                                 const char *name,
-                                                GLES1ShaderState::BoolClipPlaneArray &value)
+                                                const GLES1ShaderState::BoolClipPlaneArray &value)
 {
     outStream << std::boolalpha;
     outStream << "\n";
@@ -856,97 +850,104 @@ void GLES1Renderer::addShaderBoolClipPlaneArray(std::stringstream &outStream,
     outStream << ");";
 }
 
-void GLES1Renderer::addVertexShaderDefs(std::stringstream &outStream)
+void GLES1Renderer::addVertexShaderDefs(std::stringstream &outStream,
+                                        const GLES1ShaderState &shaderState)
 {
-    addShaderDefine(outStream, GLES1StateEnables::Lighting, "enable_lighting");
-    addShaderDefine(outStream, GLES1StateEnables::ColorMaterial, "enable_color_material");
-    addShaderDefine(outStream, GLES1StateEnables::DrawTexture, "enable_draw_texture");
-    addShaderDefine(outStream, GLES1StateEnables::PointRasterization, "point_rasterization");
-    addShaderDefine(outStream, GLES1StateEnables::RescaleNormal, "enable_rescale_normal");
-    addShaderDefine(outStream, GLES1StateEnables::Normalize, "enable_normalize");
-    addShaderDefine(outStream, GLES1StateEnables::LightModelTwoSided, "light_model_two_sided");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::Lighting, "enable_lighting");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::ColorMaterial,
+                    "enable_color_material");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::DrawTexture, "enable_draw_texture");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::PointRasterization,
+                    "point_rasterization");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::RescaleNormal,
+                    "enable_rescale_normal");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::Normalize, "enable_normalize");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::LightModelTwoSided,
+                    "light_model_two_sided");
 
     // bool light_enables[kMaxLights] = bool[kMaxLights](...);
-    addShaderBoolLightArray(outStream, "light_enables", mShaderState.lightEnables);
+    addShaderBoolLightArray(outStream, "light_enables", shaderState.lightEnables);
 }
 
-void GLES1Renderer::addFragmentShaderDefs(std::stringstream &outStream)
+void GLES1Renderer::addFragmentShaderDefs(std::stringstream &outStream,
+                                          const GLES1ShaderState &shaderState)
 {
-    addShaderDefine(outStream, GLES1StateEnables::Fog, "enable_fog");
-    addShaderDefine(outStream, GLES1StateEnables::ClipPlanes, "enable_clip_planes");
-    addShaderDefine(outStream, GLES1StateEnables::DrawTexture, "enable_draw_texture");
-    addShaderDefine(outStream, GLES1StateEnables::PointRasterization, "point_rasterization");
-    addShaderDefine(outStream, GLES1StateEnables::PointSprite, "point_sprite_enabled");
-    addShaderDefine(outStream, GLES1StateEnables::AlphaTest, "enable_alpha_test");
-    addShaderDefine(outStream, GLES1StateEnables::ShadeModelFlat, "shade_model_flat");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::Fog, "enable_fog");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::ClipPlanes, "enable_clip_planes");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::DrawTexture, "enable_draw_texture");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::PointRasterization,
+                    "point_rasterization");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::PointSprite, "point_sprite_enabled");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::AlphaTest, "enable_alpha_test");
+    addShaderDefine(outStream, shaderState, GLES1StateEnables::ShadeModelFlat, "shade_model_flat");
 
     // bool enable_texture_2d[kMaxTexUnits] = bool[kMaxTexUnits](...);
-    addShaderBoolTexArray(outStream, "enable_texture_2d", mShaderState.tex2DEnables);
+    addShaderBoolTexArray(outStream, "enable_texture_2d", shaderState.tex2DEnables);
 
     // bool enable_texture_cube_map[kMaxTexUnits] = bool[kMaxTexUnits](...);
-    addShaderBoolTexArray(outStream, "enable_texture_cube_map", mShaderState.texCubeEnables);
+    addShaderBoolTexArray(outStream, "enable_texture_cube_map", shaderState.texCubeEnables);
 
     // int texture_format[kMaxTexUnits] = int[kMaxTexUnits](...);
-    addShaderUintTexArray(outStream, "texture_format", mShaderState.tex2DFormats);
+    addShaderUintTexArray(outStream, "texture_format", shaderState.tex2DFormats);
 
     // bool point_sprite_coord_replace[kMaxTexUnits] = bool[kMaxTexUnits](...);
     addShaderBoolTexArray(outStream, "point_sprite_coord_replace",
-                          mShaderState.pointSpriteCoordReplaces);
+                          shaderState.pointSpriteCoordReplaces);
 
     // bool clip_plane_enables[kMaxClipPlanes] = bool[kMaxClipPlanes](...);
-    addShaderBoolClipPlaneArray(outStream, "clip_plane_enables", mShaderState.clipPlaneEnables);
+    addShaderBoolClipPlaneArray(outStream, "clip_plane_enables", shaderState.clipPlaneEnables);
 
     // int texture_format[kMaxTexUnits] = int[kMaxTexUnits](...);
-    addShaderUintTexArray(outStream, "texture_env_mode", mShaderState.texEnvModes);
+    addShaderUintTexArray(outStream, "texture_env_mode", shaderState.texEnvModes);
 
     // int combine_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "combine_rgb", mShaderState.texCombineRgbs);
+    addShaderUintTexArray(outStream, "combine_rgb", shaderState.texCombineRgbs);
 
     // int combine_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "combine_alpha", mShaderState.texCombineAlphas);
+    addShaderUintTexArray(outStream, "combine_alpha", shaderState.texCombineAlphas);
 
     // int src0_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "src0_rgb", mShaderState.texCombineSrc0Rgbs);
+    addShaderUintTexArray(outStream, "src0_rgb", shaderState.texCombineSrc0Rgbs);
 
     // int src0_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "src0_alpha", mShaderState.texCombineSrc0Alphas);
+    addShaderUintTexArray(outStream, "src0_alpha", shaderState.texCombineSrc0Alphas);
 
     // int src1_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "src1_rgb", mShaderState.texCombineSrc1Rgbs);
+    addShaderUintTexArray(outStream, "src1_rgb", shaderState.texCombineSrc1Rgbs);
 
     // int src1_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "src1_alpha", mShaderState.texCombineSrc1Alphas);
+    addShaderUintTexArray(outStream, "src1_alpha", shaderState.texCombineSrc1Alphas);
 
     // int src2_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "src2_rgb", mShaderState.texCombineSrc2Rgbs);
+    addShaderUintTexArray(outStream, "src2_rgb", shaderState.texCombineSrc2Rgbs);
 
     // int src2_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "src2_alpha", mShaderState.texCombineSrc2Alphas);
+    addShaderUintTexArray(outStream, "src2_alpha", shaderState.texCombineSrc2Alphas);
 
     // int op0_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "op0_rgb", mShaderState.texCombineOp0Rgbs);
+    addShaderUintTexArray(outStream, "op0_rgb", shaderState.texCombineOp0Rgbs);
 
     // int op0_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "op0_alpha", mShaderState.texCombineOp0Alphas);
+    addShaderUintTexArray(outStream, "op0_alpha", shaderState.texCombineOp0Alphas);
 
     // int op1_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "op1_rgb", mShaderState.texCombineOp1Rgbs);
+    addShaderUintTexArray(outStream, "op1_rgb", shaderState.texCombineOp1Rgbs);
 
     // int op1_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "op1_alpha", mShaderState.texCombineOp1Alphas);
+    addShaderUintTexArray(outStream, "op1_alpha", shaderState.texCombineOp1Alphas);
 
     // int op2_rgb[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "op2_rgb", mShaderState.texCombineOp2Rgbs);
+    addShaderUintTexArray(outStream, "op2_rgb", shaderState.texCombineOp2Rgbs);
 
     // int op2_alpha[kMaxTexUnits];
-    addShaderUintTexArray(outStream, "op2_alpha", mShaderState.texCombineOp2Alphas);
+    addShaderUintTexArray(outStream, "op2_alpha", shaderState.texCombineOp2Alphas);
 
     // int alpha_func;
     addShaderUint(outStream, "alpha_func",
-                  static_cast<uint16_t>(ToGLenum(mShaderState.alphaTestFunc)));
+                  static_cast<uint16_t>(ToGLenum(shaderState.alphaTestFunc)));
 
     // int fog_mode;
-    addShaderUint(outStream, "fog_mode", static_cast<uint16_t>(ToGLenum(mShaderState.fogMode)));
+    addShaderUint(outStream, "fog_mode", static_cast<uint16_t>(ToGLenum(shaderState.fogMode)));
 }
 
 angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
@@ -954,9 +955,19 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
                                                        GLES1State *gles1State)
 {
     // See if we have the shader for this combination of states
-    if (mUberShaderState.find(mShaderState) != mUberShaderState.end())
+    auto uberShaderIter = mUberShaderState.find(mShaderState);
+    if (uberShaderIter != mUberShaderState.end())
     {
-        Program *programObject = getProgram(getUberShaderState().programState.program);
+        GLES1UberShaderState &uberShaderState = uberShaderIter->second;
+
+        // If the program was precompiled for this combination of states, it's now needed.
+        if (uberShaderState.isLinkPending)
+        {
+            uberShaderState.isLinkPending = false;
+            return finishProgram(context, glState, gles1State, &uberShaderState.programState);
+        }
+
+        Program *programObject = getProgram(uberShaderState.programState.program);
 
         // If this is different than the current program, we need to sync everything
         // TODO: This could be optimized to only dirty state that differs between the two programs
@@ -976,7 +987,26 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
 
     // If we get here, we don't have a shader for this state, need to create it
     GLES1ProgramState &programState = mUberShaderState[mShaderState].programState;
+    ANGLE_TRY(createProgram(context, mShaderState, angle::JobResultExpectancy::Immediate,
+                            &programState));
+    ANGLE_TRY(finishProgram(context, glState, gles1State, &programState));
+
+    mRendererProgramInitialized = true;
+
+    // Applications that just used a new combination of states are likely to use similar ones soon.
+    if (context->getFrontendFeatures().precompileGLES1NeighborVariants.enabled)
+    {
+        ANGLE_TRY(precompileNeighborPrograms(context));
+    }
 
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::createProgram(Context *context,
+                                           const GLES1ShaderState &shaderState,
+                                           angle::JobResultExpectancy resultExpectancy,
+                                           GLES1ProgramState *programState)
+{
     ShaderProgramID vertexShader;
     ShaderProgramID fragmentShader;
 
@@ -985,14 +1015,14 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     uint32_t maxTexUnitsEnabled = 0;
     for (int i = 0; i < kTexUnitCount; i++)
     {
-        if (mShaderState.texCubeEnables[i] || mShaderState.tex2DEnables[i])
+        if (shaderState.texCubeEnables[i] || shaderState.tex2DEnables[i])
         {
             maxTexUnitsEnabled = i + 1;
         }
     }
 
     std::stringstream GLES1DrawVShaderStateDefs;
-    addVertexShaderDefs(GLES1DrawVShaderStateDefs);
+    addVertexShaderDefs(GLES1DrawVShaderStateDefs, shaderState);
 
     std::stringstream vertexStream;
     vertexStream << kGLES1DrawVShaderHeader;
@@ -1000,15 +1030,15 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     vertexStream << GLES1DrawVShaderStateDefs.str();
     vertexStream << kGLES1DrawVShader;
 
-    ANGLE_TRY(
-        compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(), &vertexShader));
+    ANGLE_TRY(compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(),
+                            resultExpectancy, &vertexShader));
 
     std::stringstream GLES1DrawFShaderStateDefs;
-    addFragmentShaderDefs(GLES1DrawFShaderStateDefs);
+    addFragmentShaderDefs(GLES1DrawFShaderStateDefs, shaderState);
 
     std::stringstream fragmentStream;
     fragmentStream << kGLES1DrawFShaderVersion;
-    if (mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
+    if (shaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
     {
         if (context->getExtensions().shaderFramebufferFetchEXT)
         {
@@ -1023,7 +1053,7 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     fragmentStream << kGLES1TexUnitsDefine << maxTexUnitsEnabled << "u\n";
     fragmentStream << GLES1DrawFShaderStateDefs.str();
     fragmentStream << kGLES1DrawFShaderUniformDefs;
-    if (mShaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
+    if (shaderState.mGLES1StateEnabled[GLES1StateEnables::LogicOpThroughFramebufferFetch])
     {
         if (context->getExtensions().shaderFramebufferFetchEXT)
         {
@@ -1045,7 +1075,7 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
     fragmentStream << kGLES1DrawFShaderMain;
 
     ANGLE_TRY(compileShader(context, ShaderType::Fragment, fragmentStream.str().c_str(),
-                            &fragmentShader));
+                            resultExpectancy, &fragmentShader));
 
     angle::HashMap<GLint, std::string> attribLocs;
 
@@ -1061,19 +1091,47 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
         attribLocs[kTextureCoordAttribIndexBase + i] = ss.str();
     }
 
-    ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs,
-                          &programState.program));
+    ANGLE_TRY(linkProgram(context, vertexShader, fragmentShader, attribLocs, resultExpectancy,
+                          &programState->program));
 
+    // The shaders stay alive while attached to the program, and are detached in finishProgram().
     mShaderPrograms->deleteShader(context, vertexShader);
     mShaderPrograms->deleteShader(context, fragmentShader);
 
-    Program *programObject        = getProgram(programState.program);
+    return angle::Result::Continue;
+
+}
+
+angle::Result GLES1Renderer::finishProgram(Context *context,
+                                           State *glState,
+                                           GLES1State *gles1State,
+                                           GLES1ProgramState *programState)
+{
+    Program *programObject = getProgram(programState->program);
+    programObject->resolveLink(context);
+
+    ANGLE_TRY(glState->setProgram(context, programObject));
+
+    if (!programObject->isLinked())
+    {
+        GLint infoLogLength = programObject->getInfoLogLength();
+        std::vector<char> infoLog(infoLogLength, 0);
+        programObject->getInfoLog(infoLogLength - 1, nullptr, infoLog.data());
+
+        ERR() << "Internal GLES 1 shader link failed. Info log: " << infoLog.data();
+        ANGLE_CHECK(context, false, "GLES1Renderer program link failed.", GL_INVALID_OPERATION);
+        return angle::Result::Stop;
+    }
+
+    programObject->detachShader(context, programObject->getAttachedShader(ShaderType::Vertex));
+    programObject->detachShader(context, programObject->getAttachedShader(ShaderType::Fragment));
+
     ProgramExecutable &executable = programObject->getExecutable();
 
-    programState.projMatrixLoc      = executable.getUniformLocation("projection");
-    programState.modelviewMatrixLoc = executable.getUniformLocation("modelview");
-    programState.textureMatrixLoc   = executable.getUniformLocation("texture_matrix");
-    programState.modelviewInvTrLoc  = executable.getUniformLocation("modelview_invtr");
+    programState->projMatrixLoc      = executable.getUniformLocation("projection");
+    programState->modelviewMatrixLoc = executable.getUniformLocation("modelview");
+    programState->textureMatrixLoc   = executable.getUniformLocation("texture_matrix");
+    programState->modelviewInvTrLoc  = executable.getUniformLocation("modelview_invtr");
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -1083,76 +1141,115 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context,
         ss2d << "tex_sampler" << i;
         sscube << "tex_cube_sampler" << i;
 
-        programState.tex2DSamplerLocs[i]   = executable.getUniformLocation(ss2d.str());
-        programState.texCubeSamplerLocs[i] = executable.getUniformLocation(sscube.str());
+        programState->tex2DSamplerLocs[i]   = executable.getUniformLocation(ss2d.str());
+        programState->texCubeSamplerLocs[i] = executable.getUniformLocation(sscube.str());
     }
 
-    programState.textureEnvColorLoc = executable.getUniformLocation("texture_env_color");
-    programState.rgbScaleLoc        = executable.getUniformLocation("texture_env_rgb_scale");
-    programState.alphaScaleLoc      = executable.getUniformLocation("texture_env_alpha_scale");
-    programState.lodBiasLoc         = executable.getUniformLocation("texture_env_lod_bias");
+    programState->textureEnvColorLoc = executable.getUniformLocation("texture_env_color");
+    programState->rgbScaleLoc        = executable.getUniformLocation("texture_env_rgb_scale");
+    programState->alphaScaleLoc      = executable.getUniformLocation("texture_env_alpha_scale");
+    programState->lodBiasLoc         = executable.getUniformLocation("texture_env_lod_bias");
 
-    programState.alphaTestRefLoc = executable.getUniformLocation("alpha_test_ref");
+    programState->alphaTestRefLoc = executable.getUniformLocation("alpha_test_ref");
 
-    programState.materialAmbientLoc  = executable.getUniformLocation("material_ambient");
-    programState.materialDiffuseLoc  = executable.getUniformLocation("material_diffuse");
-    programState.materialSpecularLoc = executable.getUniformLocation("material_specular");
-    programState.materialEmissiveLoc = executable.getUniformLocation("material_emissive");
-    programState.materialSpecularExponentLoc =
+    programState->materialAmbientLoc  = executable.getUniformLocation("material_ambient");
+    programState->materialDiffuseLoc  = executable.getUniformLocation("material_diffuse");
+    programState->materialSpecularLoc = executable.getUniformLocation("material_specular");
+    programState->materialEmissiveLoc = executable.getUniformLocation("material_emissive");
+    programState->materialSpecularExponentLoc =
         executable.getUniformLocation("material_specular_exponent");
 
-    programState.lightModelSceneAmbientLoc =
+    programState->lightModelSceneAmbientLoc =
         executable.getUniformLocation("light_model_scene_ambient");
 
-    programState.lightAmbientsLoc   = executable.getUniformLocation("light_ambients");
-    programState.lightDiffusesLoc   = executable.getUniformLocation("light_diffuses");
-    programState.lightSpecularsLoc  = executable.getUniformLocation("light_speculars");
-    programState.lightPositionsLoc  = executable.getUniformLocation("light_positions");
-    programState.lightDirectionsLoc = executable.getUniformLocation("light_directions");
-    programState.lightSpotlightExponentsLoc =
+    programState->lightAmbientsLoc   = executable.getUniformLocation("light_ambients");
+    programState->lightDiffusesLoc   = executable.getUniformLocation("light_diffuses");
+    programState->lightSpecularsLoc  = executable.getUniformLocation("light_speculars");
+    programState->lightPositionsLoc  = executable.getUniformLocation("light_positions");
+    programState->lightDirectionsLoc = executable.getUniformLocation("light_directions");
+    programState->lightSpotlightExponentsLoc =
         executable.getUniformLocation("light_spotlight_exponents");
-    programState.lightSpotlightCutoffAnglesLoc =
+    programState->lightSpotlightCutoffAnglesLoc =
         executable.getUniformLocation("light_spotlight_cutoff_angles");
-    programState.lightAttenuationConstsLoc =
+    programState->lightAttenuationConstsLoc =
         executable.getUniformLocation("light_attenuation_consts");
-    programState.lightAttenuationLinearsLoc =
+    programState->lightAttenuationLinearsLoc =
         executable.getUniformLocation("light_attenuation_linears");
-    programState.lightAttenuationQuadraticsLoc =
+    programState->lightAttenuationQuadraticsLoc =
         executable.getUniformLocation("light_attenuation_quadratics");
 
-    programState.fogDensityLoc = executable.getUniformLocation("fog_density");
-    programState.fogStartLoc   = executable.getUniformLocation("fog_start");
-    programState.fogEndLoc     = executable.getUniformLocation("fog_end");
-    programState.fogColorLoc   = executable.getUniformLocation("fog_color");
+    programState->fogDensityLoc = executable.getUniformLocation("fog_density");
+    programState->fogStartLoc   = executable.getUniformLocation("fog_start");
+    programState->fogEndLoc     = executable.getUniformLocation("fog_end");
+    programState->fogColorLoc   = executable.getUniformLocation("fog_color");
 
-    programState.clipPlanesLoc = executable.getUniformLocation("clip_planes");
+    programState->clipPlanesLoc = executable.getUniformLocation("clip_planes");
 
-    programState.logicOpLoc = executable.getUniformLocation("logic_op");
+    programState->logicOpLoc = executable.getUniformLocation("logic_op");
 
-    programState.pointSizeMinLoc = executable.getUniformLocation("point_size_min");
-    programState.pointSizeMaxLoc = executable.getUniformLocation("point_size_max");
-    programState.pointDistanceAttenuationLoc =
+    programState->pointSizeMinLoc = executable.getUniformLocation("point_size_min");
+    programState->pointSizeMaxLoc = executable.getUniformLocation("point_size_max");
+    programState->pointDistanceAttenuationLoc =
         executable.getUniformLocation("point_distance_attenuation");
 
-    programState.drawTextureCoordsLoc = executable.getUniformLocation("draw_texture_coords");
-    programState.drawTextureDimsLoc   = executable.getUniformLocation("draw_texture_dims");
-    programState.drawTextureNormalizedCropRectLoc =
+    programState->drawTextureCoordsLoc = executable.getUniformLocation("draw_texture_coords");
+    programState->drawTextureDimsLoc   = executable.getUniformLocation("draw_texture_dims");
+    programState->drawTextureNormalizedCropRectLoc =
         executable.getUniformLocation("draw_texture_normalized_crop_rect");
 
-    ANGLE_TRY(glState->setProgram(context, programObject));
-
     for (int i = 0; i < kTexUnitCount; i++)
     {
         // To avoid GL_INVALID_OPERATION caused by samplers of different types pointing to the same
         // texture unit, the inactive sampler is shifted to a dummy unit (i + kTexUnitCount).
-        setUniform1i(context, &executable, programState.tex2DSamplerLocs[i], i);
-        setUniform1i(context, &executable, programState.texCubeSamplerLocs[i], i + kTexUnitCount);
+        setUniform1i(context, &executable, programState->tex2DSamplerLocs[i], i);
+        setUniform1i(context, &executable, programState->texCubeSamplerLocs[i], i + kTexUnitCount);
     }
 
     // We just created a new program, we need to sync everything
     gles1State->setAllDirty();
 
-    mRendererProgramInitialized = true;
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::precompileNeighborPrograms(Context *context)
+{
+    // Modes in the order they are most commonly used.  At most kMaxNeighborPrograms programs are
+    // started at a time to bound the amount of background work per new state combination.
+    constexpr std::array<TextureEnvMode, 6> kTexEnvModes = {
+        TextureEnvMode::Modulate, TextureEnvMode::Replace, TextureEnvMode::Combine,
+        TextureEnvMode::Add,      TextureEnvMode::Decal,   TextureEnvMode::Blend,
+    };
+    constexpr size_t kMaxNeighborPrograms = 4;
+
+    size_t neighborCount = 0;
+    for (int unit = 0; unit < kTexUnitCount; unit++)
+    {
+        if (!mShaderState.tex2DEnables[unit] && !mShaderState.texCubeEnables[unit])
+        {
+            continue;
+        }
+
+        for (TextureEnvMode mode : kTexEnvModes)
+        {
+            GLES1ShaderState neighborState(mShaderState);
+            neighborState.texEnvModes[unit] = static_cast<uint16_t>(ToGLenum(mode));
+            if (mUberShaderState.find(neighborState) != mUberShaderState.end())
+            {
+                continue;
+            }
+
+            GLES1UberShaderState &uberShaderState = mUberShaderState[neighborState];
+            uberShaderState.isLinkPending         = true;
+            ANGLE_TRY(createProgram(context, neighborState, angle::JobResultExpectancy::Future,
+                                    &uberShaderState.programState));
+
+            if (++neighborCount == kMaxNeighborPrograms)
+            {
+                return angle::Result::Continue;
+            }
+        }
+    }
+
     return angle::Result::Continue;
 }
 
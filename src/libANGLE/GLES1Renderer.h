@@ -156,12 +156,13 @@ class GLES1Renderer final : angle::NonCopyable
     angle::Result compileShader(Context *context,
                                 ShaderType shaderType,
                                 const char *src,
+                                angle::JobResultExpectancy resultExpectancy,
                                 ShaderProgramID *shaderOut);
     angle::Result linkProgram(Context *context,
-                              State *glState,
                               ShaderProgramID vshader,
                               ShaderProgramID fshader,
                               const angle::HashMap<GLint, std::string> &attribLocs,
+                              angle::JobResultExpectancy resultExpectancy,
                               ShaderProgramID *programOut);
     angle::Result initializeRendererProgram(Context *context,
                                             State *glState,
@@ -218,25 +219,26 @@ class GLES1Renderer final : angle::NonCopyable
 
     GLES1ShaderState mShaderState = {};
 
-    const char *getShaderBool(GLES1StateEnables state);
+    const char *getShaderBool(const GLES1ShaderState &shaderState, GLES1StateEnables state);
     void addShaderDefine(std::stringstream &outStream,
+                         const GLES1ShaderState &shaderState,
                          GLES1StateEnables state,
                          const char *enableString);
     void addShaderUint(std::stringstream &outStream, const char *name, uint16_t value);
     void addShaderUintTexArray(std::stringstream &outStream,
                                const char *texString,
-                               GLES1ShaderState::UintTexArray &texState);
+                               const GLES1ShaderState::UintTexArray &texState);
     void addShaderBoolTexArray(std::stringstream &outStream,
                                const char *texString,
-                               GLES1ShaderState::BoolTexArray &texState);
+                               const GLES1ShaderState::BoolTexArray &texState);
     void addShaderBoolLightArray(std::stringstream &outStream,
                                  const char *name,
-                                 GLES1ShaderState::BoolLightArray &value);
+                                 const GLES1ShaderState::BoolLightArray &value);
     void addShaderBoolClipPlaneArray(std::stringstream &outStream,
                                      const char *name,
-                                     GLES1ShaderState::BoolClipPlaneArray &value);
-    void addVertexShaderDefs(std::stringstream &outStream);
-    void addFragmentShaderDefs(std::stringstream &outStream);
+                                     const GLES1ShaderState::BoolClipPlaneArray &value);
+    void addVertexShaderDefs(std::stringstream &outStream, const GLES1ShaderState &shaderState);
+    void addFragmentShaderDefs(std::stringstream &outStream, const GLES1ShaderState &shaderState);
 
     struct GLES1ProgramState
     {
@@ -334,8 +336,26 @@ class GLES1Renderer final : angle::NonCopyable
     {
         GLES1UniformBuffers uniformBuffers;
         GLES1ProgramState programState;
+
+        // Programs that are precompiled for a predicted state combination are linked in the
+        // background, and are only resolved once the state combination is actually used.
+        bool isLinkPending = false;
     };
 
+    // Compiles the shaders of the given state combination and starts linking the program.
+    angle::Result createProgram(Context *context,
+                                const GLES1ShaderState &shaderState,
+                                angle::JobResultExpectancy resultExpectancy,
+                                GLES1ProgramState *programState);
+    // Waits for the link to finish, installs the program and looks up its uniforms.
+    angle::Result finishProgram(Context *context,
+                                State *glState,
+                                GLES1State *gles1State,
+                                GLES1ProgramState *programState);
+    // Starts building the programs of state combinations that differ from the current one only in
+    // the texture environment mode of one of the enabled texture units.
+    angle::Result precompileNeighborPrograms(Context *context);
+
     GLES1UberShaderState &getUberShaderState()
     {
         ASSERT(mUberShaderState.find(mShaderState) != mUberShaderState.end());
@@ -18,26 +18,102 @@
 namespace gl
 {
 
+namespace
+{
+constexpr size_t kBitsPerWord = 64;
+
+// Stale entries at the front of the released queue are dropped in batches of at least this size.
+constexpr size_t kMinReleasedQueueCompactionSize = 64;
+}  // anonymous namespace
+
 struct HandleAllocator::HandleRangeComparator
 {
     bool operator()(const HandleRange &range, GLuint handle) const { return (range.end < handle); }
 };
 
 HandleAllocator::HandleAllocator(GLuint maximumHandleValue)
-    : mMaxValue(maximumHandleValue), mLoggingEnabled(false)
+    : mMaxValue(maximumHandleValue),
+      mReleasedQueueBegin(0),
+      mReleasedCount(0),
+      mLoggingEnabled(false)
 {
     mUnallocatedList.push_back(HandleRange(1, mMaxValue));
 }
 
 HandleAllocator::~HandleAllocator() {}
 
+bool HandleAllocator::isReleased(GLuint handle) const
+{
+    const size_t wordIndex = handle / kBitsPerWord;
+    return wordIndex < mReleasedBits.size() &&
+           (mReleasedBits[wordIndex] & (uint64_t(1) << (handle % kBitsPerWord))) != 0;
+}
+
+void HandleAllocator::setReleased(GLuint handle, bool released)
+{
+    const size_t wordIndex = handle / kBitsPerWord;
+    const uint64_t bit     = uint64_t(1) << (handle % kBitsPerWord);
+    if (released)
+    {
+        if (wordIndex >= mReleasedBits.size())
+        {
+            mReleasedBits.resize(wordIndex + 1, 0);
+        }
+        ASSERT((mReleasedBits[wordIndex] & bit) == 0);
+        mReleasedBits[wordIndex] |= bit;
+        ++mReleasedCount;
+    }
+    else
+    {
+        ASSERT((mReleasedBits[wordIndex] & bit) != 0);
+        mReleasedBits[wordIndex] &= ~bit;
+        --mReleasedCount;
+    }
+}
+
+void HandleAllocator::compactReleasedQueue()
+{
+    // Drop the entries that were already consumed, as well as the stale entries left behind by
+    // reserve().  A handle that was reserved and released again may appear more than once; only
+    // its first entry is kept.
+    size_t writeIndex = 0;
+    for (size_t readIndex = mReleasedQueueBegin; readIndex < mReleasedQueue.size(); ++readIndex)
+    {
+        const GLuint handle = mReleasedQueue[readIndex];
+        if (isReleased(handle))
+        {
+            setReleased(handle, false);
+            mReleasedQueue[writeIndex++] = handle;
+        }
+    }
+    mReleasedQueue.resize(writeIndex);
+    mReleasedQueueBegin = 0;
+
+    for (GLuint handle : mReleasedQueue)
+    {
+        setReleased(handle, true);
+    }
+}
+
 bool HandleAllocator::allocate(GLuint *outId)
 {
-    // Allocate from released list, constant time for FIFO pop_front.
-    if (!mReleasedList.empty())
+    // Allocate from released list in FIFO order, amortized constant time.
+    while (mReleasedCount > 0)
     {
-        GLuint reusedHandle = mReleasedList.front();
-        mReleasedList.pop_front();
+        ASSERT(mReleasedQueueBegin < mReleasedQueue.size());
+        GLuint reusedHandle = mReleasedQueue[mReleasedQueueBegin++];
+        if (!isReleased(reusedHandle))
+        {
+            // Reserved after it was released.
+            continue;
+        }
+        setReleased(reusedHandle, false);
+
+        if (mReleasedQueueBegin >= kMinReleasedQueueCompactionSize &&
+            mReleasedQueueBegin * 2 >= mReleasedQueue.size())
+        {
+            compactReleasedQueue();
+        }
 
         if (mLoggingEnabled)
         {
@@ -98,27 +174,41 @@ void HandleAllocator::release(GLuint handle)
         return;
     }
 
-    // Try consolidating the ranges first.
-    for (HandleRange &handleRange : mUnallocatedList)
+    // Try consolidating the ranges first.  The ranges are sorted, so only the first range that
+    // ends at or after |handle - 1| can be adjacent to |handle|.
+    auto boundIt = std::lower_bound(mUnallocatedList.begin(), mUnallocatedList.end(), handle - 1,
+                                    HandleRangeComparator());
+    if (boundIt != mUnallocatedList.end())
     {
-        angle::CheckedNumeric<GLuint> checkedBegin = handleRange.begin;
-        angle::CheckedNumeric<GLuint> checkedEnd   = handleRange.end;
-
-        if ((checkedBegin - 1).ValueOrDie() == handle)
+        if (boundIt->begin - 1 == handle)
         {
-            handleRange.begin = (checkedBegin - 1).ValueOrDie();
+            boundIt->begin = handle;
             return;
         }
 
-        if (checkedEnd.ValueOrDie() == (handle - 1))
+        if (boundIt->end == handle - 1)
         {
-            handleRange.end = (checkedEnd + 1).ValueOrDie();
+            boundIt->end = handle;
             return;
         }
     }
 
-    // Add to released list, constant time for FIFO push_back.
-    mReleasedList.push_back(handle);
+    if (isReleased(handle))
+    {
+        // Already released, don't hand it out twice.
+        return;
+    }
+
+    // Add to released list, amortized constant time.
+    mReleasedQueue.push_back(handle);
+    setReleased(handle, true);
+
+    // Handles that are repeatedly reserved and released leave stale entries behind.
+    const size_t queuedCount = mReleasedQueue.size() - mReleasedQueueBegin;
+    if (queuedCount >= kMinReleasedQueueCompactionSize && queuedCount > mReleasedCount * 2)
+    {
+        compactReleasedQueue();
+    }
 }
 
 void HandleAllocator::reserve(GLuint handle)
@@ -135,15 +225,11 @@ void HandleAllocator::reserve(GLuint handle)
         return;
     }
 
-    // Clear from released list -- might be a slow operation.
-    if (!mReleasedList.empty())
+    // Clear from released list, constant time.  The stale queue entry is skipped by allocate().
+    if (isReleased(handle))
     {
-        auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
-        if (releasedIt != mReleasedList.end())
-        {
-            mReleasedList.erase(releasedIt);
-            return;
-        }
+        setReleased(handle, false);
+        return;
     }
 
     // Not in released list, reserve in the unallocated list.
@@ -185,12 +271,15 @@ void HandleAllocator::reset()
 {
     mUnallocatedList.clear();
     mUnallocatedList.push_back(HandleRange(1, mMaxValue));
-    mReleasedList.clear();
+    mReleasedQueue.clear();
+    mReleasedQueueBegin = 0;
+    mReleasedBits.clear();
+    mReleasedCount = 0;
 }
 
 bool HandleAllocator::anyHandleAvailableForAllocation() const
 {
-    return !mUnallocatedList.empty() || !mReleasedList.empty();
+    return !mUnallocatedList.empty() || mReleasedCount > 0;
 }
 
 void HandleAllocator::enableLogging(bool enabled)
@@ -10,7 +10,7 @@
 #ifndef LIBANGLE_HANDLEALLOCATOR_H_
 #define LIBANGLE_HANDLEALLOCATOR_H_
 
-#include <deque>
+#include <vector>
 
 #include "common/angleutils.h"
 
@@ -48,11 +48,23 @@ class HandleAllocator final : angle::NonCopyable
 
     struct HandleRangeComparator;
 
+    bool isReleased(GLuint handle) const;
+    void setReleased(GLuint handle, bool released);
+    void compactReleasedQueue();
+
     // The freelist consists of never-allocated handles, stored
     // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
+    // released, reused in FIFO order.
     std::vector<HandleRange> mUnallocatedList;
-    std::deque<GLuint> mReleasedList;
+
+    // Released handles are queued in the order they were released, starting at
+    // mReleasedQueueBegin.  A bitmap tracks which handles are currently released, so reserving
+    // one is constant time: the handle's bit is cleared and its stale queue entry is skipped
+    // when reached.  Both containers only grow, so releasing doesn't allocate in the steady state.
+    std::vector<GLuint> mReleasedQueue;
+    size_t mReleasedQueueBegin;
+    std::vector<uint64_t> mReleasedBits;
+    size_t mReleasedCount;
 
     bool mLoggingEnabled;
 };
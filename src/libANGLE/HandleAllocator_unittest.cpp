@@ -414,4 +414,60 @@ TEST(HandleAllocatorTest, InterleavedReleaseAllocate)
     }
 }
 
+// Verifies that released handles that are reserved again are skipped by allocate(), and that the
+// remaining released handles are still reused in FIFO order after many release/reserve cycles.
+TEST(HandleAllocatorTest, ReserveReleasedHandlesRepeatedly)
+{
+    constexpr GLuint kPoolSize = 256;
+    gl::HandleAllocator allocator(kMaxHandleForTesting);
+
+    std::vector<GLuint> pool;
+    for (GLuint i = 0; i < kPoolSize; i++)
+    {
+        GLuint handle;
+        EXPECT_TRUE(allocator.allocate(&handle));
+        pool.push_back(handle);
+    }
+
+    // Release and reserve every handle a few times, leaving stale entries in the released list.
+    for (int iteration = 0; iteration < 4; iteration++)
+    {
+        for (GLuint handle : pool)
+        {
+            allocator.release(handle);
+        }
+        for (GLuint handle : pool)
+        {
+            allocator.reserve(handle);
+        }
+    }
+
+    // Release the odd handles, and reserve every other one of them again.
+    std::vector<GLuint> releasedHandles;
+    for (GLuint i = 1; i < kPoolSize; i += 2)
+    {
+        allocator.release(pool[i]);
+    }
+    for (GLuint i = 1; i < kPoolSize; i += 4)
+    {
+        allocator.reserve(pool[i]);
+    }
+    for (GLuint i = 3; i < kPoolSize; i += 4)
+    {
+        releasedHandles.push_back(pool[i]);
+    }
+
+    for (GLuint handle : releasedHandles)
+    {
+        GLuint newHandle;
+        EXPECT_TRUE(allocator.allocate(&newHandle));
+        EXPECT_EQ(handle, newHandle);
+    }
+
+    // Nothing is left in the released list, so new handles come after the pool.
+    GLuint newHandle;
+    EXPECT_TRUE(allocator.allocate(&newHandle));
+    EXPECT_EQ(kPoolSize + 1, newHandle);
+}
+
 }  // anonymous namespace
@@ -25,7 +25,25 @@ void IndexRangeCache::addRange(DrawElementsType type,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    const IndexRangeKey key(type, offset, count, primitiveRestartEnabled);
+
+    auto iter = mIndexRangeCache.find(key);
+    if (iter != mIndexRangeCache.end())
+    {
+        iter->second.range = range;
+        mUsageOrder.splice(mUsageOrder.begin(), mUsageOrder, iter->second.usage);
+        return;
+    }
+
+    if (mIndexRangeCache.size() >= kMaxCachedRanges)
+    {
+        mIndexRangeCache.erase(mUsageOrder.back());
+        mUsageOrder.pop_back();
+    }
+
+    mUsageOrder.push_front(key);
+    mIndexRangeCache.emplace(key, Entry{range, mUsageOrder.begin()});
+    mMaxRangeByteSize = std::max(mMaxRangeByteSize, GetDrawElementsTypeSize(type) * count);
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
@@ -37,9 +55,10 @@ bool IndexRangeCache::findRange(DrawElementsType type,
     auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
     if (i != mIndexRangeCache.end())
     {
+        mUsageOrder.splice(mUsageOrder.begin(), mUsageOrder, i->second.usage);
         if (outRange)
         {
-            *outRange = i->second;
+            *outRange = i->second.range;
         }
         return true;
     }
@@ -58,8 +77,15 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    // No cached range can start before this and still reach the invalidated region.
+    size_t searchStart =
+        invalidateStart > mMaxRangeByteSize ? invalidateStart - mMaxRangeByteSize : 0;
+
+    // Keys are ordered by offset first, so start at the first entry whose offset is at least
+    // |searchStart|.  The other fields use the values that sort first for that offset.
+    auto i = mIndexRangeCache.lower_bound(
+        IndexRangeKey(DrawElementsType::UnsignedByte, searchStart, 0, true));
+    while (i != mIndexRangeCache.end() && i->first.offset <= invalidateEnd)
     {
         size_t rangeStart = i->first.offset;
         size_t rangeEnd =
@@ -71,26 +97,34 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
         }
         else
         {
+            mUsageOrder.erase(i->second.usage);
             mIndexRangeCache.erase(i++);
         }
     }
+
+    if (mIndexRangeCache.empty())
+    {
+        mMaxRangeByteSize = 0;
+    }
 }
 
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mUsageOrder.clear();
+    mMaxRangeByteSize = 0;
 }
 
 bool IndexRangeKey::operator<(const IndexRangeKey &rhs) const
 {
-    if (type != rhs.type)
-    {
-        return type < rhs.type;
-    }
     if (offset != rhs.offset)
     {
         return offset < rhs.offset;
     }
+    if (type != rhs.type)
+    {
+        return type < rhs.type;
+    }
     if (count != rhs.count)
     {
         return count < rhs.count;
@@ -15,6 +15,7 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
+#include <list>
 #include <map>
 
 namespace gl
@@ -53,8 +54,27 @@ class IndexRangeCache
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    size_t size() const { return mIndexRangeCache.size(); }
+
+    // The cache is bounded; when full, the least recently used range is evicted.
+    static constexpr size_t kMaxCachedRanges = 1024;
+
   private:
-    std::map<IndexRangeKey, IndexRange> mIndexRangeCache;
+    using UsageList = std::list<IndexRangeKey>;
+    struct Entry
+    {
+        IndexRange range;
+        UsageList::iterator usage;
+    };
+
+    // Entries are ordered by offset first, so that invalidation only visits entries that could
+    // overlap the invalidated region: those starting in
+    // [invalidateStart - mMaxRangeByteSize, invalidateEnd].
+    std::map<IndexRangeKey, Entry> mIndexRangeCache;
+    // Most recently used key at the front.
+    mutable UsageList mUsageOrder;
+    // The largest size in bytes of any range added since the cache was last emptied.
+    size_t mMaxRangeByteSize = 0;
 };
 
 // First level cache stored inline at the query site.
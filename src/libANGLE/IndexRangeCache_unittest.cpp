@@ -0,0 +1,89 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range cache.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace gl
+{
+namespace
+{
+constexpr DrawElementsType kUShort = DrawElementsType::UnsignedShort;
+
+// Test that added ranges can be found, and only with the exact same key.
+TEST(IndexRangeCacheTest, AddAndFind)
+{
+    IndexRangeCache cache;
+    cache.addRange(kUShort, 16, 6, false, IndexRange(2, 5));
+
+    IndexRange range;
+    EXPECT_TRUE(cache.findRange(kUShort, 16, 6, false, &range));
+    EXPECT_EQ(range, IndexRange(2, 5));
+
+    EXPECT_FALSE(cache.findRange(kUShort, 16, 6, true, &range));
+    EXPECT_FALSE(cache.findRange(kUShort, 16, 5, false, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedInt, 16, 6, false, &range));
+    EXPECT_FALSE(cache.findRange(kUShort, 18, 6, false, &range));
+}
+
+// Test that invalidation removes overlapping ranges only, including ones that start well before
+// the invalidated region.
+TEST(IndexRangeCacheTest, InvalidateOverlapping)
+{
+    IndexRangeCache cache;
+    // Bytes [0, 2000]
+    cache.addRange(kUShort, 0, 1000, false, IndexRange(0, 1));
+    // Bytes [3000, 3002]
+    cache.addRange(kUShort, 3000, 1, false, IndexRange(0, 1));
+    // Bytes [3100, 3104]
+    cache.addRange(kUShort, 3100, 2, false, IndexRange(0, 1));
+    // Bytes [5000, 5008]
+    cache.addRange(DrawElementsType::UnsignedInt, 5000, 2, true, IndexRange(0, 1));
+
+    // Overlaps the first range only.
+    cache.invalidateRange(1500, 100);
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 1000, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 3000, 1, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 3100, 2, false, nullptr));
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedInt, 5000, 2, true, nullptr));
+
+    // Overlaps the second and third ranges.
+    cache.invalidateRange(3001, 100);
+    EXPECT_FALSE(cache.findRange(kUShort, 3000, 1, false, nullptr));
+    EXPECT_FALSE(cache.findRange(kUShort, 3100, 2, false, nullptr));
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedInt, 5000, 2, true, nullptr));
+
+    // Doesn't overlap anything.
+    cache.invalidateRange(6000, 100);
+    EXPECT_EQ(cache.size(), 1u);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+// Test that the cache is bounded and evicts the least recently used range.
+TEST(IndexRangeCacheTest, EvictsLeastRecentlyUsed)
+{
+    IndexRangeCache cache;
+    for (size_t index = 0; index < IndexRangeCache::kMaxCachedRanges; ++index)
+    {
+        cache.addRange(kUShort, index * 2, 1, false, IndexRange(0, 1));
+    }
+    EXPECT_EQ(cache.size(), IndexRangeCache::kMaxCachedRanges);
+
+    // Use the oldest range, so the second oldest is evicted instead.
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 1, false, nullptr));
+    cache.addRange(kUShort, 1, 1, false, IndexRange(0, 1));
+
+    EXPECT_EQ(cache.size(), IndexRangeCache::kMaxCachedRanges);
+    EXPECT_TRUE(cache.findRange(kUShort, 0, 1, false, nullptr));
+    EXPECT_FALSE(cache.findRange(kUShort, 2, 1, false, nullptr));
+    EXPECT_TRUE(cache.findRange(kUShort, 1, 1, false, nullptr));
+}
+}  // anonymous namespace
+}  // namespace gl
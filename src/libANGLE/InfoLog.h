@@ -24,6 +24,8 @@ class InfoLog : angle::NonCopyable
     void getLog(GLsizei bufSize, GLsizei *length, char *infoLog) const;
 
     void appendSanitized(std::string message);
+    // Appends the messages of another info log, such as one filled by a link subtask.
+    void append(const InfoLog &other);
     void reset();
 
     // This helper class ensures we append a newline after writing a line.
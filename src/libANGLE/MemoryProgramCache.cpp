@@ -135,9 +135,11 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
 
     ComputeHash(context, program, hashOut);
 
-    angle::MemoryBuffer uncompressedData;
+    // The decompressed binary is shared with the program, so the backend can use parts of it (such
+    // as its pipeline cache data) in place while loading.
+    std::shared_ptr<angle::MemoryBuffer> uncompressedData = std::make_shared<angle::MemoryBuffer>();
     switch (mBlobCache.getAndDecompress(context, context->getScratchBuffer(), *hashOut,
-                                        kMaxUncompressedProgramSize, &uncompressedData))
+                                        kMaxUncompressedProgramSize, uncompressedData.get()))
     {
         case egl::BlobCache::GetAndDecompressResult::NotFound:
             return angle::Result::Continue;
@@ -151,8 +153,9 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
             return angle::Result::Continue;
 
         case egl::BlobCache::GetAndDecompressResult::Success:
-            ANGLE_TRY(program->loadBinary(context, uncompressedData.data(),
-                                          static_cast<int>(uncompressedData.size()), resultOut));
+            ANGLE_TRY(program->loadBinary(context, uncompressedData->data(),
+                                          static_cast<int>(uncompressedData->size()),
+                                          uncompressedData, resultOut));
 
             // Result is either Success or Rejected
             ASSERT(*resultOut != egl::CacheGetResult::NotFound);
@@ -228,7 +231,10 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
         platform->cacheProgram(platform, key, compressedData.size(), compressedData.data());
     }
 
-    mBlobCache.put(context, programHash, std::move(compressedData));
+    // Programs are linked from several shaders, so they are more expensive to recreate than the
+    // shaders cached by MemoryShaderCache in the same blob cache.
+    mBlobCache.put(context, programHash, std::move(compressedData),
+                   egl::BlobCache::EvictionCost::High);
     return angle::Result::Continue;
 }
 
@@ -252,7 +258,8 @@ bool MemoryProgramCache::putBinary(const egl::BlobCache::Key &programHash,
     memcpy(newEntry.data(), binary, length);
 
     // Store the binary.
-    mBlobCache.populate(programHash, std::move(newEntry));
+    mBlobCache.populate(programHash, std::move(newEntry), egl::BlobCache::CacheSource::Disk,
+                        egl::BlobCache::EvictionCost::High);
 
     return true;
 }
@@ -627,6 +627,151 @@ void AppendWidgetDataHelper::AppendVulkanTotalPipelineCacheMissTimeMs(
     AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
 }
 
+void AppendWidgetDataHelper::AppendVulkanPresentAcquireLatency(const overlay::Widget *widget,
+                                                               const gl::Extents &imageExtent,
+                                                               TextWidgetData *textWidget,
+                                                               GraphWidgetData *graphWidget,
+                                                               OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](uint64_t curValue, uint64_t maxValue) {
+        std::ostringstream text;
+        text << "Acquire latency (peak): " << maxValue << "us";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanPresentThrottleWaitTime(const overlay::Widget *widget,
+                                                                 const gl::Extents &imageExtent,
+                                                                 TextWidgetData *textWidget,
+                                                                 GraphWidgetData *graphWidget,
+                                                                 OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](uint64_t curValue, uint64_t maxValue) {
+        std::ostringstream text;
+        text << "Throttle wait (peak): " << maxValue << "us";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanPresentLatency(const overlay::Widget *widget,
+                                                        const gl::Extents &imageExtent,
+                                                        TextWidgetData *textWidget,
+                                                        GraphWidgetData *graphWidget,
+                                                        OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](uint64_t curValue, uint64_t maxValue) {
+        std::ostringstream text;
+        text << "Present latency (peak): " << maxValue << "us";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
+void AppendWidgetDataHelper::AppendVulkanPresentQueueDepth(const overlay::Widget *widget,
+                                                           const gl::Extents &imageExtent,
+                                                           TextWidgetData *textWidget,
+                                                           GraphWidgetData *graphWidget,
+                                                           OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *count = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Present queue depth: ";
+    OutputCount(text, count);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanShaderModuleCreations(const overlay::Widget *widget,
+                                                               const gl::Extents &imageExtent,
+                                                               TextWidgetData *textWidget,
+                                                               GraphWidgetData *graphWidget,
+                                                               OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *count = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Shader modules created: ";
+    OutputCount(text, count);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanMaxGraphicsPipelinesPerProgram(
+    const overlay::Widget *widget,
+    const gl::Extents &imageExtent,
+    TextWidgetData *textWidget,
+    GraphWidgetData *graphWidget,
+    OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *count = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Max pipelines per program: ";
+    OutputCount(text, count);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanGarbageBacklog(const overlay::Widget *widget,
+                                                        const gl::Extents &imageExtent,
+                                                        TextWidgetData *textWidget,
+                                                        GraphWidgetData *graphWidget,
+                                                        OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *count = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Garbage backlog: ";
+    OutputCount(text, count);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanBufferGhostKB(const overlay::Widget *widget,
+                                                       const gl::Extents &imageExtent,
+                                                       TextWidgetData *textWidget,
+                                                       GraphWidgetData *graphWidget,
+                                                       OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *count = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Ghosted buffers (KB): ";
+    OutputCount(text, count);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanRenderPassClosureReasons(
+    const overlay::Widget *widget,
+    const gl::Extents &imageExtent,
+    TextWidgetData *textWidget,
+    GraphWidgetData *graphWidget,
+    OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Text *closureReasons = static_cast<const overlay::Text *>(widget);
+    std::ostringstream text;
+    text << "RP closures: ";
+    OutputText(text, closureReasons);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanAttachmentBandwidth(const overlay::Widget *widget,
+                                                             const gl::Extents &imageExtent,
+                                                             TextWidgetData *textWidget,
+                                                             GraphWidgetData *graphWidget,
+                                                             OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Text *bandwidth = static_cast<const overlay::Text *>(widget);
+    std::ostringstream text;
+    text << "Attachment KB/frame: ";
+    OutputText(text, bandwidth);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
 std::ostream &AppendWidgetDataHelper::OutputPerSecond(std::ostream &out,
                                                       const overlay::PerSecond *perSecond)
 {
@@ -774,6 +774,328 @@ void Overlay::initOverlayWidgets()
         }
         mState.mOverlayWidgets[WidgetId::VulkanTotalPipelineCacheHitTimeMs].reset(widget);
     }
+
+    {
+        RunningGraph *widget = new RunningGraph(60);
+        {
+            const int32_t fontSize = GetFontSize(0, kLargeFont);
+            const int32_t offsetX  = 10;
+            const int32_t offsetY  = 360;
+            const int32_t width    = 5 * static_cast<uint32_t>(widget->runningValues.size());
+            const int32_t height   = 100;
+
+            widget->type          = WidgetType::RunningGraph;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = offsetX + width;
+            widget->coords[3]     = offsetY + height;
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 0.7490196078431373f;
+            widget->color[2]      = 0.0f;
+            widget->color[3]      = 0.7843137254901961f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency].reset(widget);
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency]->coords[1];
+            const int32_t width  = 40 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->description.type          = WidgetType::Text;
+            widget->description.fontSize      = fontSize;
+            widget->description.coords[0]     = offsetX;
+            widget->description.coords[1]     = std::max(offsetY - height, 1);
+            widget->description.coords[2]     = offsetX + width;
+            widget->description.coords[3]     = offsetY;
+            widget->description.color[0]      = 1.0f;
+            widget->description.color[1]      = 0.7490196078431373f;
+            widget->description.color[2]      = 0.0f;
+            widget->description.color[3]      = 1.0f;
+            widget->description.matchToWidget = nullptr;
+        }
+    }
+
+    {
+        RunningGraph *widget = new RunningGraph(60);
+        {
+            const int32_t fontSize = GetFontSize(0, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency]->coords[1];
+            const int32_t width  = 5 * static_cast<uint32_t>(widget->runningValues.size());
+            const int32_t height = 100;
+
+            widget->type      = WidgetType::RunningGraph;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX + width;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 1.0f;
+            widget->color[1]  = 0.24705882352941178f;
+            widget->color[2]  = 0.24705882352941178f;
+            widget->color[3]  = 0.5882352941176471f;
+            widget->matchToWidget =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency].get();
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanPresentThrottleWaitTime].reset(widget);
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX  = mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency]
+                                        ->getDescriptionWidget()
+                                        ->coords[0];
+            const int32_t offsetY = mState.mOverlayWidgets[WidgetId::VulkanPresentAcquireLatency]
+                                        ->getDescriptionWidget()
+                                        ->coords[1];
+            const int32_t width  = 40 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->description.type          = WidgetType::Text;
+            widget->description.fontSize      = fontSize;
+            widget->description.coords[0]     = offsetX;
+            widget->description.coords[1]     = std::max(offsetY - height, 1);
+            widget->description.coords[2]     = offsetX + width;
+            widget->description.coords[3]     = offsetY;
+            widget->description.color[0]      = 1.0f;
+            widget->description.color[1]      = 0.24705882352941178f;
+            widget->description.color[2]      = 0.24705882352941178f;
+            widget->description.color[3]      = 1.0f;
+            widget->description.matchToWidget = nullptr;
+        }
+    }
+
+    {
+        RunningGraph *widget = new RunningGraph(60);
+        {
+            const int32_t fontSize = GetFontSize(0, kLargeFont);
+            const int32_t offsetX  = 10;
+            const int32_t offsetY  = 520;
+            const int32_t width    = 5 * static_cast<uint32_t>(widget->runningValues.size());
+            const int32_t height   = 100;
+
+            widget->type          = WidgetType::RunningGraph;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = offsetX + width;
+            widget->coords[3]     = offsetY + height;
+            widget->color[0]      = 0.7490196078431373f;
+            widget->color[1]      = 0.4980392156862745f;
+            widget->color[2]      = 1.0f;
+            widget->color[3]      = 0.7843137254901961f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanPresentLatency].reset(widget);
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentLatency]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentLatency]->coords[1];
+            const int32_t width  = 40 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->description.type          = WidgetType::Text;
+            widget->description.fontSize      = fontSize;
+            widget->description.coords[0]     = offsetX;
+            widget->description.coords[1]     = std::max(offsetY - height, 1);
+            widget->description.coords[2]     = offsetX + width;
+            widget->description.coords[3]     = offsetY;
+            widget->description.color[0]      = 0.7490196078431373f;
+            widget->description.color[1]      = 0.4980392156862745f;
+            widget->description.color[2]      = 1.0f;
+            widget->description.color[3]      = 1.0f;
+            widget->description.matchToWidget = nullptr;
+        }
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentLatency]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanPresentLatency]->coords[3];
+            const int32_t width  = 40 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Count;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = offsetX + width;
+            widget->coords[3]     = offsetY + height;
+            widget->color[0]      = 0.7490196078431373f;
+            widget->color[1]      = 0.4980392156862745f;
+            widget->color[2]      = 1.0f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanPresentQueueDepth].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanTotalPipelineCacheHitTimeMs]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanTotalPipelineCacheHitTimeMs]->coords[3];
+            const int32_t width  = 45 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Count;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = std::min(offsetX + width, -1);
+            widget->coords[3]     = std::min(offsetY + height, -1);
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 1.0f;
+            widget->color[2]      = 0.4980392156862745f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanShaderModuleCreations].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanShaderModuleCreations]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanShaderModuleCreations]->coords[3];
+            const int32_t width  = 45 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Count;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = std::min(offsetX + width, -1);
+            widget->coords[3]     = std::min(offsetY + height, -1);
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 1.0f;
+            widget->color[2]      = 0.4980392156862745f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanMaxGraphicsPipelinesPerProgram].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanMaxGraphicsPipelinesPerProgram]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanMaxGraphicsPipelinesPerProgram]->coords[3];
+            const int32_t width  = 45 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Count;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = std::min(offsetX + width, -1);
+            widget->coords[3]     = std::min(offsetY + height, -1);
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 1.0f;
+            widget->color[2]      = 0.4980392156862745f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanGarbageBacklog].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanGarbageBacklog]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanGarbageBacklog]->coords[3];
+            const int32_t width  = 45 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Count;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY;
+            widget->coords[2]     = std::min(offsetX + width, -1);
+            widget->coords[3]     = std::min(offsetY + height, -1);
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 1.0f;
+            widget->color[2]      = 0.4980392156862745f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanBufferGhostKB].reset(widget);
+    }
+
+    {
+        Text *widget = new Text;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanLastValidationMessage]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanLastValidationMessage]->coords[1];
+            const int32_t width  = 150 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Text;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY - height;
+            widget->coords[2]     = offsetX + width;
+            widget->coords[3]     = offsetY;
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 0.4980392156862745f;
+            widget->color[2]      = 0.0f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanRenderPassClosureReasons].reset(widget);
+    }
+
+    {
+        Text *widget = new Text;
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanRenderPassClosureReasons]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanRenderPassClosureReasons]->coords[1];
+            const int32_t width  = 100 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->type          = WidgetType::Text;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY - height;
+            widget->coords[2]     = offsetX + width;
+            widget->coords[3]     = offsetY;
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 0.4980392156862745f;
+            widget->color[2]      = 0.0f;
+            widget->color[3]      = 1.0f;
+            widget->matchToWidget = nullptr;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanAttachmentBandwidth].reset(widget);
+    }
 }
 
 }  // namespace gl
@@ -50,6 +50,26 @@ enum class WidgetId
     VulkanTotalPipelineCacheMissTimeMs,
     // Total time spent creating pipelines that hit the cache.
     VulkanTotalPipelineCacheHitTimeMs,
+    // Time spent in vkAcquireNextImageKHR per frame (in us).
+    VulkanPresentAcquireLatency,
+    // Time the CPU is throttled per frame waiting for older frames (in us).
+    VulkanPresentThrottleWaitTime,
+    // Time from present to the frame being displayed (in us).
+    VulkanPresentLatency,
+    // Number of frames submitted for present that the GPU has not finished.
+    VulkanPresentQueueDepth,
+    // Number of shader modules created, excluding the ones shared between programs.
+    VulkanShaderModuleCreations,
+    // Largest number of graphics pipelines created for a single program.
+    VulkanMaxGraphicsPipelinesPerProgram,
+    // Number of garbage objects whose GPU use has finished but that are not yet destroyed.
+    VulkanGarbageBacklog,
+    // Size of the buffers ghosted to avoid waiting for the GPU in the last frame (KB).
+    VulkanBufferGhostKB,
+    // Most common reasons render passes were ended for in the last frame (Text).
+    VulkanRenderPassClosureReasons,
+    // Estimated attachment load, store, resolve and unresolve KB in the last frame (Text).
+    VulkanAttachmentBandwidth,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -75,6 +95,16 @@ enum class WidgetId
     PROC(VulkanPipelineCacheLookups)            \
     PROC(VulkanPipelineCacheMisses)             \
     PROC(VulkanTotalPipelineCacheMissTimeMs)    \
-    PROC(VulkanTotalPipelineCacheHitTimeMs)
+    PROC(VulkanTotalPipelineCacheHitTimeMs)     \
+    PROC(VulkanPresentAcquireLatency)           \
+    PROC(VulkanPresentThrottleWaitTime)         \
+    PROC(VulkanPresentLatency)                  \
+    PROC(VulkanPresentQueueDepth)               \
+    PROC(VulkanShaderModuleCreations)           \
+    PROC(VulkanMaxGraphicsPipelinesPerProgram)  \
+    PROC(VulkanGarbageBacklog)                  \
+    PROC(VulkanBufferGhostKB)                   \
+    PROC(VulkanRenderPassClosureReasons)        \
+    PROC(VulkanAttachmentBandwidth)
 
 }  // namespace gl
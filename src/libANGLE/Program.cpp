@@ -14,6 +14,8 @@
 #include "libANGLE/Program.h"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <utility>
 
 #include "common/angle_version_info.h"
@@ -87,6 +89,9 @@ class LinkEvent : angle::NonCopyable
     virtual angle::Result wait(const Context *context) = 0;
     // Peeks whether the linking is still ongoing.
     virtual bool isLinking() = 0;
+    // Tells the link job that its result is no longer needed.  wait() must still be called, and
+    // returns Stop if the job stopped early.
+    virtual void cancel() {}
 };
 
 // Wraps an already done linking.
@@ -101,14 +106,59 @@ class LinkEventDone final : public LinkEvent
     angle::Result mResult;
 };
 
+// A part of the front-end link that is done in parallel with the rest of it.  The main link task
+// may itself be running on the pool the subtask is posted to, so waiting for a subtask that no
+// thread has picked up could deadlock if all threads are busy doing the same.  Instead, the main
+// task runs the job itself if it has not started by the time its result is needed.
+class FrontendLinkSubTask final : public angle::Closure
+{
+  public:
+    using Job = std::function<bool(InfoLog &infoLog)>;
+
+    FrontendLinkSubTask(Job &&job) : mJob(std::move(job)), mStarted(false), mResult(false) {}
+    ~FrontendLinkSubTask() override = default;
+
+    void operator()() override { run(); }
+
+    // Returns the result of the job, and appends its messages to |infoLogOut|.  |event| is the one
+    // returned when the subtask was posted.
+    bool getResult(const std::shared_ptr<angle::WaitableEvent> &event, InfoLog *infoLogOut)
+    {
+        if (!run())
+        {
+            event->wait();
+        }
+        infoLogOut->append(mInfoLog);
+        return mResult;
+    }
+
+  private:
+    // Runs the job unless it has already started.  Returns whether this call ran the job.
+    bool run()
+    {
+        if (mStarted.exchange(true))
+        {
+            return false;
+        }
+        mResult = mJob(mInfoLog);
+        return true;
+    }
+
+    Job mJob;
+    std::atomic<bool> mStarted;
+    InfoLog mInfoLog;
+    bool mResult;
+};
+
 void ScheduleSubTasks(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
                       std::vector<std::shared_ptr<rx::LinkSubTask>> &tasks,
+                      angle::WorkerTaskPriority priority,
                       std::vector<std::shared_ptr<angle::WaitableEvent>> *eventsOut)
 {
     eventsOut->reserve(tasks.size());
     for (const std::shared_ptr<rx::LinkSubTask> &subTask : tasks)
     {
-        eventsOut->push_back(workerThreadPool->postWorkerTask(subTask));
+        eventsOut->push_back(workerThreadPool->postWorkerTask(subTask, priority));
     }
 }
 }  // anonymous namespace
@@ -282,6 +332,15 @@ void InfoLog::appendSanitized(std::string message)
     }
 }
 
+void InfoLog::append(const InfoLog &other)
+{
+    if (!other.empty())
+    {
+        ensureInitialized();
+        *mLazyStream << other.str();
+    }
+}
+
 void InfoLog::reset()
 {
     if (mLazyStream)
@@ -560,6 +619,8 @@ class Program::MainLinkLoadTask : public angle::Closure
 
     void waitSubTasks() { angle::WaitableEvent::WaitMany(&mSubTaskWaitableEvents); }
 
+    void cancel() { mCancellation.cancel(); }
+
     bool areSubTasksLinking()
     {
         if (mLinkTask->isLinkingInternally())
@@ -577,13 +638,16 @@ class Program::MainLinkLoadTask : public angle::Closure
         // currently, there is no support for ordering them.
         ASSERT(linkSubTasks.empty() || postLinkSubTasks.empty());
 
-        // Schedule link subtasks
+        // Schedule link subtasks.  The link is not complete until they are done.
         mSubTasks = std::move(linkSubTasks);
-        ScheduleSubTasks(mSubTaskWorkerPool, mSubTasks, &mSubTaskWaitableEvents);
+        ScheduleSubTasks(mSubTaskWorkerPool, mSubTasks, angle::WorkerTaskPriority::LatencyCritical,
+                         &mSubTaskWaitableEvents);
 
-        // Schedule post-link subtasks
+        // Schedule post-link subtasks.  These only warm up caches, so let other compile and link
+        // jobs go first.
         mState.mExecutable->mPostLinkSubTasks = std::move(postLinkSubTasks);
         ScheduleSubTasks(mSubTaskWorkerPool, mState.mExecutable->mPostLinkSubTasks,
+                         angle::WorkerTaskPriority::Background,
                          &mState.mExecutable->mPostLinkSubTaskWaitableEvents);
 
         // No further use for worker pool.  Release it earlier than the destructor (to avoid
@@ -595,6 +659,9 @@ class Program::MainLinkLoadTask : public angle::Closure
     ProgramState &mState;
     std::shared_ptr<rx::LinkTask> mLinkTask;
 
+    // Tripped when the program is deleted while the job is in flight.
+    angle::CancellationToken mCancellation;
+
     // Subtask and wait events
     std::vector<std::shared_ptr<rx::LinkSubTask>> mSubTasks;
     std::vector<std::shared_ptr<angle::WaitableEvent>> mSubTaskWaitableEvents;
@@ -683,6 +750,7 @@ class Program::MainLinkLoadEvent final : public LinkEvent
     {
         return !mWaitableEvent->isReady() || mLinkTask->areSubTasksLinking();
     }
+    void cancel() override { mLinkTask->cancel(); }
 
   private:
     std::shared_ptr<MainLinkLoadTask> mLinkTask;
@@ -691,11 +759,22 @@ class Program::MainLinkLoadEvent final : public LinkEvent
 
 angle::Result Program::MainLinkTask::linkImpl()
 {
+    if (mCancellation.isCancelled())
+    {
+        return angle::Result::Stop;
+    }
+
     ProgramMergedVaryings mergedVaryings;
 
     // Do the front-end portion of the link.
-    ANGLE_TRY(mProgram->linkJobImpl(mCaps, mLimitations, mClientVersion, mIsWebGL,
-                                    mLinkingVariables, mResources, &mergedVaryings));
+    ANGLE_TRY(mProgram->linkJobImpl(mSubTaskWorkerPool, mCaps, mLimitations, mClientVersion,
+                                    mIsWebGL, mLinkingVariables, mResources, &mergedVaryings));
+
+    // The backend portion of the link is usually the more expensive one.
+    if (mCancellation.isCancelled())
+    {
+        return angle::Result::Stop;
+    }
 
     // Next, do the backend portion of the link.  If there are any subtasks to be scheduled, they
     // are collected now.
@@ -715,6 +794,11 @@ angle::Result Program::MainLinkTask::linkImpl()
 
 angle::Result Program::MainLoadTask::loadImpl()
 {
+    if (mCancellation.isCancelled())
+    {
+        return angle::Result::Stop;
+    }
+
     std::vector<std::shared_ptr<rx::LinkSubTask>> linkSubTasks;
     std::vector<std::shared_ptr<rx::LinkSubTask>> postLinkSubTasks;
     mLinkTask->load(&linkSubTasks, &postLinkSubTasks);
@@ -751,7 +835,14 @@ Program::~Program()
 
 void Program::onDestroy(const Context *context)
 {
+    // Nothing will use the results of the jobs still in flight for this program, let them stop
+    // early.
+    if (mLinkingState)
+    {
+        mLinkingState->linkEvent->cancel();
+    }
     resolveLink(context);
+    mState.mExecutable->cancelPostLinkTasks();
     waitForPostLinkTasks(context);
 
     for (ShaderType shaderType : AllShaderTypes())
@@ -1051,13 +1142,15 @@ angle::Result Program::link(const Context *context, angle::JobResultExpectancy r
     return angle::Result::Continue;
 }
 
-angle::Result Program::linkJobImpl(const Caps &caps,
-                                   const Limitations &limitations,
-                                   const Version &clientVersion,
-                                   bool isWebGL,
-                                   LinkingVariables *linkingVariables,
-                                   ProgramLinkedResources *resources,
-                                   ProgramMergedVaryings *mergedVaryingsOut)
+angle::Result Program::linkJobImpl(
+    const std::shared_ptr<angle::WorkerThreadPool> &subTaskWorkerPool,
+    const Caps &caps,
+    const Limitations &limitations,
+    const Version &clientVersion,
+    bool isWebGL,
+    LinkingVariables *linkingVariables,
+    ProgramLinkedResources *resources,
+    ProgramMergedVaryings *mergedVaryingsOut)
 {
     // Cache load failed, fall through to normal linking.
     unlink();
@@ -1118,26 +1211,33 @@ angle::Result Program::linkJobImpl(const Caps &caps,
     }
     else
     {
-        if (!linkAttributes(caps, limitations, isWebGL))
-        {
-            return angle::Result::Stop;
-        }
-
-        if (!linkVaryings())
-        {
-            return angle::Result::Stop;
-        }
+        // Matching the interfaces between the shader stages and validating the interface blocks
+        // only read the compiled shaders, so they are done in a subtask while the attributes and
+        // uniforms are linked.  With large interfaces, each of these takes a good part of the link
+        // time.
+        GLuint combinedShaderStorageBlocks           = 0u;
+        const ShaderBitSet linkedShaderStages        = mState.mExecutable->getLinkedShaderStages();
+        const ProgramLinkedResources &constResources = *resources;
+        auto validateInterfacesTask = std::make_shared<FrontendLinkSubTask>(
+            [this, &caps, &clientVersion, isWebGL, linkedShaderStages, &constResources,
+             &combinedShaderStorageBlocks](InfoLog &infoLog) {
+                return linkVaryings(infoLog) &&
+                       LinkValidateProgramInterfaceBlocks(caps, clientVersion, isWebGL,
+                                                          linkedShaderStages, constResources,
+                                                          infoLog, &combinedShaderStorageBlocks);
+            });
+        std::shared_ptr<angle::WaitableEvent> validateInterfacesEvent =
+            subTaskWorkerPool->postWorkerTask(validateInterfacesTask);
 
         GLuint combinedImageUniforms = 0;
-        if (!linkUniforms(caps, clientVersion, &resources->unusedUniforms, &combinedImageUniforms))
-        {
-            return angle::Result::Stop;
-        }
-
-        GLuint combinedShaderStorageBlocks = 0u;
-        if (!LinkValidateProgramInterfaceBlocks(
-                caps, clientVersion, isWebGL, mState.mExecutable->getLinkedShaderStages(),
-                *resources, mState.mInfoLog, &combinedShaderStorageBlocks))
+        const bool attributesAndUniformsLinked =
+            linkAttributes(caps, limitations, isWebGL) &&
+            linkUniforms(caps, clientVersion, &resources->unusedUniforms, &combinedImageUniforms);
+
+        // Always wait for the subtask, it references the local variables.
+        const bool interfacesValid =
+            validateInterfacesTask->getResult(validateInterfacesEvent, &mState.mInfoLog);
+        if (!attributesAndUniformsLinked || !interfacesValid)
         {
             return angle::Result::Stop;
         }
@@ -1420,12 +1520,14 @@ angle::Result Program::setBinary(const Context *context,
     makeNewExecutable(context);
 
     egl::CacheGetResult result = egl::CacheGetResult::NotFound;
-    return loadBinary(context, binary, length, &result);
+    // The application's binary is not kept alive after this call, so it can't be used in place.
+    return loadBinary(context, binary, length, nullptr, &result);
 }
 
 angle::Result Program::loadBinary(const Context *context,
                                   const void *binary,
                                   GLsizei length,
+                                  std::shared_ptr<const angle::MemoryBuffer> storage,
                                   egl::CacheGetResult *resultOut)
 {
     *resultOut = egl::CacheGetResult::Rejected;
@@ -1433,7 +1535,8 @@ angle::Result Program::loadBinary(const Context *context,
     ASSERT(mLinkingState);
     unlink();
 
-    BinaryInputStream stream(angle::Span(static_cast<const uint8_t *>(binary), length));
+    BinaryInputStream stream(angle::Span(static_cast<const uint8_t *>(binary), length),
+                             std::move(storage));
     if (!deserialize(context, stream))
     {
         return angle::Result::Continue;
@@ -1934,7 +2037,7 @@ void Program::linkShaders()
     }
 }
 
-bool Program::linkVaryings()
+bool Program::linkVaryings(InfoLog &infoLog) const
 {
     ShaderType previousShaderType = ShaderType::InvalidEnum;
     for (ShaderType shaderType : kAllGraphicsShaderTypes)
@@ -1954,7 +2057,7 @@ bool Program::linkVaryings()
             if (!LinkValidateShaderInterfaceMatching(
                     outputVaryings, currentShader->inputVaryings, previousShaderType,
                     currentShader->shaderType, previousShader->shaderVersion,
-                    currentShader->shaderVersion, isSeparable(), mState.mInfoLog))
+                    currentShader->shaderVersion, isSeparable(), infoLog))
             {
                 return false;
             }
@@ -1972,7 +2075,7 @@ bool Program::linkVaryings()
         !LinkValidateBuiltInVaryings(vertexShader->outputVaryings, fragmentShader->inputVaryings,
                                      vertexShader->shaderType, fragmentShader->shaderType,
                                      vertexShader->shaderVersion, fragmentShader->shaderVersion,
-                                     mState.mInfoLog))
+                                     infoLog))
     {
         return false;
     }
@@ -402,9 +402,12 @@ class Program final : public LabeledObject, public angle::Subject
     void setBinaryRetrievableHint(bool retrievable);
     bool getBinaryRetrievableHint() const;
 
+    // If |storage| is given, it owns |binary|, and the backend may keep a reference to it to use
+    // the binary data in place.
     angle::Result loadBinary(const Context *context,
                              const void *binary,
                              GLsizei length,
+                             std::shared_ptr<const angle::MemoryBuffer> storage,
                              egl::CacheGetResult *resultOut);
 
     InfoLog &getInfoLog() { return mState.mInfoLog; }
@@ -504,7 +507,8 @@ class Program final : public LabeledObject, public angle::Subject
     void syncExecutableOnSuccessfulLink();
     void deleteSelf(const Context *context);
 
-    angle::Result linkJobImpl(const Caps &caps,
+    angle::Result linkJobImpl(const std::shared_ptr<angle::WorkerThreadPool> &subTaskWorkerPool,
+                              const Caps &caps,
                               const Limitations &limitations,
                               const Version &clientVersion,
                               bool isWebGL,
@@ -517,7 +521,8 @@ class Program final : public LabeledObject, public angle::Subject
     bool linkValidateShaders();
     void linkShaders();
     bool linkAttributes(const Caps &caps, const Limitations &limitations, bool webglCompatibility);
-    bool linkVaryings();
+    // Only reads the attached shaders, so it can run in parallel with the rest of the link.
+    bool linkVaryings(InfoLog &infoLog) const;
 
     bool linkUniforms(const Caps &caps,
                       const Version &clientVersion,
@@ -3248,6 +3248,16 @@ void ProgramExecutable::waitForPostLinkTasks(const Context *context)
     ASSERT(mPostLinkSubTasks.empty());
 }
 
+void ProgramExecutable::cancelPostLinkTasks()
+{
+    if (mPostLinkSubTasks.empty())
+    {
+        return;
+    }
+
+    mImplementation->cancelPostLinkTasks();
+}
+
 void InstallExecutable(const Context *context,
                        const SharedProgramExecutable &toInstall,
                        SharedProgramExecutable *executable)
@@ -759,6 +759,8 @@ class ProgramExecutable final : public angle::Subject
     }
 
     void waitForPostLinkTasks(const Context *context);
+    // Lets pending post-link tasks skip their work.  They must still be waited on.
+    void cancelPostLinkTasks();
 
     void updateActiveUniformBufferBlocks();
     void updateActiveStorageBufferBlocks();
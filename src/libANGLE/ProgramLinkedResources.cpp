@@ -10,6 +10,7 @@
 
 #include "libANGLE/ProgramLinkedResources.h"
 
+#include "common/hash_utils.h"
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Caps.h"
@@ -593,8 +594,9 @@ class FlattenUniformVisitor : public sh::VariableNameVisitor
 class InterfaceBlockInfo final : angle::NonCopyable
 {
   public:
-    InterfaceBlockInfo(CustomBlockLayoutEncoderFactory *customEncoderFactory)
-        : mCustomEncoderFactory(customEncoderFactory)
+    InterfaceBlockInfo(CustomBlockLayoutEncoderFactory *customEncoderFactory,
+                       InterfaceBlockLayoutCache *layoutCache)
+        : mCustomEncoderFactory(customEncoderFactory), mLayoutCache(layoutCache)
     {}
 
     void getShaderBlockInfo(const std::vector<sh::InterfaceBlock> &interfaceBlocks);
@@ -612,6 +614,7 @@ class InterfaceBlockInfo final : angle::NonCopyable
     // Based on the interface block layout, the std140 or std430 encoders are used.  On some
     // platforms (currently only D3D), there could be another non-standard encoder used.
     CustomBlockLayoutEncoderFactory *mCustomEncoderFactory;
+    InterfaceBlockLayoutCache *mLayoutCache;
 };
 
 void InterfaceBlockInfo::getShaderBlockInfo(const std::vector<sh::InterfaceBlock> &interfaceBlocks)
@@ -633,6 +636,20 @@ size_t InterfaceBlockInfo::getBlockInfo(const sh::InterfaceBlock &interfaceBlock
 {
     ASSERT(IsActiveInterfaceBlock(interfaceBlock));
 
+    // The std140 and std430 layouts only depend on the declaration of the block, so they can be
+    // shared with the other programs that declare the same block.
+    if (mLayoutCache != nullptr && (interfaceBlock.layout == sh::BLOCKLAYOUT_STD140 ||
+                                    interfaceBlock.layout == sh::BLOCKLAYOUT_STD430))
+    {
+        std::shared_ptr<const InterfaceBlockLayoutCache::Layout> layout =
+            mLayoutCache->getLayout(interfaceBlock);
+        for (const auto &memberInfo : layout->blockLayout)
+        {
+            mBlockLayout[memberInfo.first] = memberInfo.second;
+        }
+        return layout->dataSize;
+    }
+
     // define member uniforms
     sh::Std140BlockEncoder std140Encoder;
     sh::Std430BlockEncoder std430Encoder;
@@ -955,6 +972,50 @@ bool ValidateInterfaceBlocks(GLuint maxInterfaceBlocks,
 
     return true;
 }
+
+// Once the cache has this many layouts, which is a lot more than the blocks of a typical
+// application, it is cleared to bound its memory.
+constexpr size_t kMaxInterfaceBlockLayoutCacheSize = 1024;
+
+// Only what affects the layout of a block, i.e. the names that key its member infos and how the
+// members are laid out, is hashed and compared.  Other properties such as static use can differ
+// between the programs that declare the same block.
+void HashBlockLayoutField(const sh::ShaderVariable &field, size_t *hashInOut)
+{
+    angle::HashCombine(*hashInOut, field.name, field.type, field.isRowMajorLayout,
+                       field.arraySizes.size(), field.fields.size());
+    for (unsigned int arraySize : field.arraySizes)
+    {
+        angle::HashCombine(*hashInOut, arraySize);
+    }
+    for (const sh::ShaderVariable &subField : field.fields)
+    {
+        HashBlockLayoutField(subField, hashInOut);
+    }
+}
+
+bool HaveSameBlockLayout(const std::vector<sh::ShaderVariable> &fields,
+                         const std::vector<sh::ShaderVariable> &otherFields)
+{
+    if (fields.size() != otherFields.size())
+    {
+        return false;
+    }
+
+    for (size_t fieldIndex = 0; fieldIndex < fields.size(); ++fieldIndex)
+    {
+        const sh::ShaderVariable &field      = fields[fieldIndex];
+        const sh::ShaderVariable &otherField = otherFields[fieldIndex];
+        if (field.name != otherField.name || field.type != otherField.type ||
+            field.isRowMajorLayout != otherField.isRowMajorLayout ||
+            field.arraySizes != otherField.arraySizes ||
+            !HaveSameBlockLayout(field.fields, otherField.fields))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 }  // anonymous namespace
 
 // UsedUniform implementation
@@ -1734,11 +1795,75 @@ void ProgramLinkedResources::init(
     pixelLocalStorageLinker.init(pixelLocalStorageLayoutsOut);
 }
 
+// InterfaceBlockLayoutCache implementation.
+InterfaceBlockLayoutCache::InterfaceBlockLayoutCache() = default;
+
+InterfaceBlockLayoutCache::~InterfaceBlockLayoutCache() = default;
+
+std::shared_ptr<const InterfaceBlockLayoutCache::Layout> InterfaceBlockLayoutCache::getLayout(
+    const sh::InterfaceBlock &interfaceBlock)
+{
+    ASSERT(interfaceBlock.layout == sh::BLOCKLAYOUT_STD140 ||
+           interfaceBlock.layout == sh::BLOCKLAYOUT_STD430);
+
+    const std::string fieldPrefix = interfaceBlock.fieldPrefix();
+
+    size_t hash = angle::HashMultiple(static_cast<int>(interfaceBlock.layout), fieldPrefix,
+                                      interfaceBlock.fields.size());
+    for (const sh::ShaderVariable &field : interfaceBlock.fields)
+    {
+        HashBlockLayoutField(field, &hash);
+    }
+
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mMutex);
+        auto range = mEntries.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            const Entry &entry = iter->second;
+            if (entry.layout == interfaceBlock.layout && entry.fieldPrefix == fieldPrefix &&
+                HaveSameBlockLayout(entry.fields, interfaceBlock.fields))
+            {
+                return entry.blockLayout;
+            }
+        }
+    }
+
+    // The block is laid out without holding the lock, so the other programs being linked are not
+    // held up.  If another thread lays out the same block in the meantime, both layouts are kept,
+    // which is harmless.
+    sh::Std140BlockEncoder std140Encoder;
+    sh::Std430BlockEncoder std430Encoder;
+    sh::BlockLayoutEncoder *encoder = interfaceBlock.layout == sh::BLOCKLAYOUT_STD430
+                                          ? static_cast<sh::BlockLayoutEncoder *>(&std430Encoder)
+                                          : &std140Encoder;
+
+    auto layout = std::make_shared<Layout>();
+    sh::GetInterfaceBlockInfo(interfaceBlock.fields, fieldPrefix, encoder, &layout->blockLayout);
+    layout->dataSize = encoder->getCurrentOffset();
+
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    if (mEntries.size() >= kMaxInterfaceBlockLayoutCacheSize)
+    {
+        mEntries.clear();
+    }
+    mEntries.emplace(hash,
+                     Entry{interfaceBlock.layout, fieldPrefix, interfaceBlock.fields, layout});
+
+    return layout;
+}
+
+size_t InterfaceBlockLayoutCache::size() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    return mEntries.size();
+}
+
 void ProgramLinkedResourcesLinker::linkResources(const ProgramState &programState,
                                                  const ProgramLinkedResources &resources) const
 {
     // Gather uniform interface block info.
-    InterfaceBlockInfo uniformBlockInfo(mCustomEncoderFactory);
+    InterfaceBlockInfo uniformBlockInfo(mCustomEncoderFactory, mLayoutCache);
     for (const ShaderType shaderType : AllShaderTypes())
     {
         const SharedCompiledShaderState &shader = programState.getAttachedShader(shaderType);
@@ -1763,7 +1888,7 @@ void ProgramLinkedResourcesLinker::linkResources(const ProgramState &programStat
     resources.uniformBlockLinker.linkBlocks(getUniformBlockSize, getUniformBlockMemberInfo);
 
     // Gather storage buffer interface block info.
-    InterfaceBlockInfo shaderStorageBlockInfo(mCustomEncoderFactory);
+    InterfaceBlockInfo shaderStorageBlockInfo(mCustomEncoderFactory, mLayoutCache);
     for (const ShaderType shaderType : AllShaderTypes())
     {
         const SharedCompiledShaderState &shader = programState.getAttachedShader(shaderType);
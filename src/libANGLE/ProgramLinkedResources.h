@@ -15,11 +15,14 @@
 
 #include "angle_gl.h"
 #include "common/PackedEnums.h"
+#include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/VaryingPacking.h"
 
 #include <functional>
+#include <memory>
+#include <unordered_map>
 
 namespace sh
 {
@@ -332,13 +335,49 @@ class CustomBlockLayoutEncoderFactory : angle::NonCopyable
     virtual sh::BlockLayoutEncoder *makeEncoder() = 0;
 };
 
+// Caches the layout of std140 and std430 interface blocks across the programs of a share group.
+// Applications often declare the same large blocks in many programs, which are then only laid out
+// once.  Programs are linked in worker threads, so the cache is thread-safe.
+class InterfaceBlockLayoutCache final : angle::NonCopyable
+{
+  public:
+    struct Layout
+    {
+        size_t dataSize = 0;
+        sh::BlockLayoutMap blockLayout;
+    };
+
+    InterfaceBlockLayoutCache();
+    ~InterfaceBlockLayoutCache();
+
+    // Returns the layout of |interfaceBlock|, which must have the std140 or std430 layout.
+    std::shared_ptr<const Layout> getLayout(const sh::InterfaceBlock &interfaceBlock);
+
+    size_t size() const;
+
+  private:
+    struct Entry
+    {
+        sh::BlockLayoutType layout;
+        std::string fieldPrefix;
+        std::vector<sh::ShaderVariable> fields;
+        std::shared_ptr<const Layout> blockLayout;
+    };
+
+    mutable angle::SimpleMutex mMutex;
+    // Keyed by a hash of the structure of the block.  Blocks with the same hash are told apart by
+    // comparing their fields.
+    std::unordered_multimap<size_t, Entry> mEntries;
+};
+
 // Used by the backends in Program*::linkResources to parse interface blocks and provide
 // information to ProgramLinkedResources' linkers.
 class ProgramLinkedResourcesLinker final : angle::NonCopyable
 {
   public:
-    ProgramLinkedResourcesLinker(CustomBlockLayoutEncoderFactory *customEncoderFactory)
-        : mCustomEncoderFactory(customEncoderFactory)
+    ProgramLinkedResourcesLinker(CustomBlockLayoutEncoderFactory *customEncoderFactory,
+                                 InterfaceBlockLayoutCache *layoutCache)
+        : mCustomEncoderFactory(customEncoderFactory), mLayoutCache(layoutCache)
     {}
 
     void linkResources(const ProgramState &programState,
@@ -349,6 +388,8 @@ class ProgramLinkedResourcesLinker final : angle::NonCopyable
                                        std::map<int, unsigned int> &sizeMapOut) const;
 
     CustomBlockLayoutEncoderFactory *mCustomEncoderFactory;
+    // May be nullptr, in which case every block is laid out again.
+    InterfaceBlockLayoutCache *mLayoutCache;
 };
 
 using ShaderInterfaceBlock = std::pair<ShaderType, const sh::InterfaceBlock *>;
@@ -9,6 +9,7 @@
 #include <gtest/gtest.h>
 
 #include "libANGLE/Program.h"
+#include "libANGLE/ProgramLinkedResources.h"
 
 using namespace gl;
 
@@ -50,4 +51,57 @@ TEST(InfoLogTest, AppendingNewline)
     EXPECT_EQ(expected, infoLog.str());
 }
 
+sh::InterfaceBlock MakeStd140Block(GLenum secondFieldType, bool staticUse)
+{
+    sh::InterfaceBlock block;
+    block.name         = "Block";
+    block.instanceName = "block";
+    block.layout       = sh::BLOCKLAYOUT_STD140;
+    block.staticUse    = staticUse;
+    block.active       = staticUse;
+
+    sh::ShaderVariable first(GL_FLOAT_VEC4);
+    first.name      = "first";
+    first.staticUse = staticUse;
+    sh::ShaderVariable second(secondFieldType);
+    second.name = "second";
+
+    block.fields = {first, second};
+    return block;
+}
+
+// Tests that blocks that are declared the same way share their layout, even if they are used
+// differently.
+TEST(InterfaceBlockLayoutCacheTest, SameDeclarationSharesLayout)
+{
+    InterfaceBlockLayoutCache cache;
+
+    std::shared_ptr<const InterfaceBlockLayoutCache::Layout> layout =
+        cache.getLayout(MakeStd140Block(GL_FLOAT, true));
+    EXPECT_EQ(layout, cache.getLayout(MakeStd140Block(GL_FLOAT, false)));
+    EXPECT_EQ(1u, cache.size());
+
+    ASSERT_EQ(2u, layout->blockLayout.size());
+    EXPECT_EQ(0, layout->blockLayout.at("Block.first").offset);
+    EXPECT_EQ(16, layout->blockLayout.at("Block.second").offset);
+}
+
+// Tests that blocks whose members are laid out differently don't share their layout.
+TEST(InterfaceBlockLayoutCacheTest, DifferentDeclarationsDontShareLayout)
+{
+    InterfaceBlockLayoutCache cache;
+
+    std::shared_ptr<const InterfaceBlockLayoutCache::Layout> floatLayout =
+        cache.getLayout(MakeStd140Block(GL_FLOAT, true));
+    std::shared_ptr<const InterfaceBlockLayoutCache::Layout> vec3Layout =
+        cache.getLayout(MakeStd140Block(GL_FLOAT_VEC3, true));
+    EXPECT_NE(floatLayout, vec3Layout);
+    EXPECT_EQ(2u, cache.size());
+
+    sh::InterfaceBlock std430Block = MakeStd140Block(GL_FLOAT, true);
+    std430Block.layout             = sh::BLOCKLAYOUT_STD430;
+    EXPECT_NE(floatLayout, cache.getLayout(std430Block));
+    EXPECT_EQ(3u, cache.size());
+}
+
 }  // namespace
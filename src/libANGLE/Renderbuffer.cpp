@@ -154,6 +154,7 @@ angle::Result Renderbuffer::setStorage(const Context *context,
 
     mState.update(width, height, Format(internalformat), 0, MultisamplingMode::Regular,
                   DetermineInitState(context));
+    onCompletenessStateChange();
     onStateChange(angle::SubjectMessage::SubjectChanged);
 
     return angle::Result::Continue;
@@ -178,6 +179,7 @@ angle::Result Renderbuffer::setStorageMultisample(const Context *context,
 
     mState.update(width, height, Format(internalformat), samples, mode,
                   DetermineInitState(context));
+    onCompletenessStateChange();
     onStateChange(angle::SubjectMessage::SubjectChanged);
 
     return angle::Result::Continue;
@@ -205,6 +207,7 @@ angle::Result Renderbuffer::setStorageEGLImageTarget(const Context *context, egl
                   image->sourceInitState());
     mState.setProtectedContent(image->hasProtectedContent());
 
+    onCompletenessStateChange();
     onStateChange(angle::SubjectMessage::SubjectChanged);
 
     return angle::Result::Continue;
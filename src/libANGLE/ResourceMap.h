@@ -15,6 +15,8 @@
 #    pragma allow_unsafe_buffers
 #endif
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <type_traits>
@@ -65,7 +67,9 @@ struct SelectResourceMapMutex<false>
 //
 // kAdditionalFlatResourcesSize defines the size of the additional flat resource map.
 // Handles in [kInitialFlatResourcesSize, kInitialFlatResourcesSize + kAdditionalFlatResourcesSize)
-// are stored in mAdditionalFlatResources.  0 means the additional flat map is disabled.
+// are stored in mAdditionalFlatResources.  0 means the additional flat map is disabled.  The
+// additional map is allocated lazily in chunks of kInitialFlatResourcesSize entries, so a large
+// size only costs memory for the chunks that are actually used.
 template <typename IDType>
 struct ResourceMapParams
 {
@@ -88,7 +92,7 @@ template <>
 struct ResourceMapParams<BufferID>
 {
     static constexpr size_t kInitialFlatResourcesSize    = 0x1800;
-    static constexpr size_t kAdditionalFlatResourcesSize = 0x7800 - kInitialFlatResourcesSize;
+    static constexpr size_t kAdditionalFlatResourcesSize = 0x30000 - kInitialFlatResourcesSize;
     static constexpr bool kNeedsLock                     = true;
 };
 template <>
@@ -137,15 +141,9 @@ class ResourceMap final : angle::NonCopyable
         {
             if (handle < kLocklessFlatResourcesLimit)
             {
-                ASSERT(handle >= kInitialFlatResourcesSize);
-                ResourceType **additionalResources =
-                    mAdditionalFlatResources.load(std::memory_order_acquire);
-                if (additionalResources != nullptr)
-                {
-                    ResourceType *value = additionalResources[handle - kInitialFlatResourcesSize];
-                    return (value == InvalidPointer() ? nullptr : value);
-                }
-                return nullptr;
+                ResourceType **slot = getAdditionalFlatResource(handle);
+                ResourceType *value = (slot != nullptr ? *slot : InvalidPointer());
+                return (value == InvalidPointer() ? nullptr : value);
             }
         }
 
@@ -237,6 +235,11 @@ class ResourceMap final : angle::NonCopyable
         kAdditionalFlatResourcesSize == 0 || kNeedsLock,
         "kAdditionalFlatResourcesSize > 0 requires kNeedsLock to ensure safe lazy allocation");
 
+    static constexpr size_t kAdditionalFlatResourcesChunkSize = kInitialFlatResourcesSize;
+    static constexpr size_t kAdditionalFlatResourcesChunkCount =
+        (kAdditionalFlatResourcesSize + kAdditionalFlatResourcesChunkSize - 1) /
+        kAdditionalFlatResourcesChunkSize;
+
     using Mutex = typename SelectResourceMapMutex<kNeedsLock>::type;
 
     // For the lock-free flat map, experimental testing suggests that 10K is a reasonable upper
@@ -254,11 +257,25 @@ class ResourceMap final : angle::NonCopyable
     bool eraseFromHashedResources(GLuint handle, ResourceType **resourceOut);
     void assignAboveCurrentFlatSize(GLuint handle, ResourceType *resource);
 
+    // Returns the entry for |handle| in the additional flat array, or nullptr if the chunk holding
+    // it has not been allocated yet.
+    ANGLE_INLINE ResourceType **getAdditionalFlatResource(GLuint handle) const
+    {
+        ASSERT(handle >= kInitialFlatResourcesSize && handle < kLocklessFlatResourcesLimit);
+        const size_t offset = handle - kInitialFlatResourcesSize;
+        ResourceType **chunk =
+            mAdditionalFlatResources[offset / kAdditionalFlatResourcesChunkSize].load(
+                std::memory_order_acquire);
+        return (chunk != nullptr ? &chunk[offset % kAdditionalFlatResourcesChunkSize] : nullptr);
+    }
+
     size_t mFlatResourcesSize;
     ResourceType **mFlatResources;
-    // Additional flat array is allocated lazily on first use under mMutex and published through
-    // store/load, enabling lock-free reads in query().
-    std::atomic<ResourceType **> mAdditionalFlatResources;
+    // Each chunk of the additional flat array is allocated lazily on first use under mMutex and
+    // published through store/load.  Chunks are never reallocated or freed before destruction,
+    // which enables lock-free reads in query() for the whole additional range.
+    std::array<std::atomic<ResourceType **>, kAdditionalFlatResourcesChunkCount>
+        mAdditionalFlatResources;
 
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
@@ -309,10 +326,13 @@ class UnsafeResourceMapIter
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::ResourceMap()
     : mFlatResourcesSize(kInitialFlatResourcesSize),
-      mFlatResources(new ResourceType *[kInitialFlatResourcesSize]),
-      mAdditionalFlatResources(nullptr)
+      mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
 {
     memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * sizeof(mFlatResources[0]));
+    for (std::atomic<ResourceType **> &chunk : mAdditionalFlatResources)
+    {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 template <typename ResourceType, typename IDType>
@@ -320,7 +340,10 @@ ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(begin() == end());
     delete[] mFlatResources;
-    delete[] mAdditionalFlatResources.load(std::memory_order_acquire);
+    for (std::atomic<ResourceType **> &chunk : mAdditionalFlatResources)
+    {
+        delete[] chunk.load(std::memory_order_acquire);
+    }
 }
 
 template <typename ResourceType, typename IDType>
@@ -370,13 +393,8 @@ ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
     {
         if (handle < kLocklessFlatResourcesLimit)
         {
-            ResourceType **additionalResources =
-                mAdditionalFlatResources.load(std::memory_order_acquire);
-            if (additionalResources != nullptr)
-            {
-                return additionalResources[handle - kInitialFlatResourcesSize] != InvalidPointer();
-            }
-            return false;
+            ResourceType **slot = getAdditionalFlatResource(handle);
+            return slot != nullptr && *slot != InvalidPointer();
         }
     }
 
@@ -403,20 +421,14 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
     {
         if (handle < kLocklessFlatResourcesLimit)
         {
-            ResourceType **additionalResources =
-                mAdditionalFlatResources.load(std::memory_order_acquire);
-            if (additionalResources != nullptr)
+            ResourceType **value = getAdditionalFlatResource(handle);
+            if (value == nullptr || *value == InvalidPointer())
             {
-                ResourceType **value = &additionalResources[handle - kInitialFlatResourcesSize];
-                if (*value == InvalidPointer())
-                {
-                    return false;
-                }
-                *resourceOut = *value;
-                *value       = InvalidPointer();
-                return true;
+                return false;
             }
-            return false;
+            *resourceOut = *value;
+            *value       = InvalidPointer();
+            return true;
         }
     }
 
@@ -461,28 +473,32 @@ void ResourceMap<ResourceType, IDType>::assignAboveCurrentFlatSize(GLuint handle
         static_assert(kNeedsLock);
         if (handle < kLocklessFlatResourcesLimit)
         {
-            ResourceType **additionalResources =
-                mAdditionalFlatResources.load(std::memory_order_acquire);
-            if (ANGLE_UNLIKELY(additionalResources == nullptr))
+            const size_t offset       = handle - kInitialFlatResourcesSize;
+            const size_t indexInChunk = offset % kAdditionalFlatResourcesChunkSize;
+            std::atomic<ResourceType **> &chunkPointer =
+                mAdditionalFlatResources[offset / kAdditionalFlatResourcesChunkSize];
+
+            ResourceType **chunk = chunkPointer.load(std::memory_order_acquire);
+            if (ANGLE_UNLIKELY(chunk == nullptr))
             {
                 std::lock_guard<Mutex> lock(mMutex);
                 // Re-read under lock to avoid double allocation if two threads raced here.
                 // memory_order_relaxed is sufficient as the mutex provides the memory barrier.
-                additionalResources = mAdditionalFlatResources.load(std::memory_order_relaxed);
-                if (additionalResources == nullptr)
+                chunk = chunkPointer.load(std::memory_order_relaxed);
+                if (chunk == nullptr)
                 {
-                    additionalResources = new ResourceType *[kAdditionalFlatResourcesSize];
-                    memset(additionalResources, kInvalidPointer,
-                           kAdditionalFlatResourcesSize * sizeof(additionalResources[0]));
+                    chunk = new ResourceType *[kAdditionalFlatResourcesChunkSize];
+                    memset(chunk, kInvalidPointer,
+                           kAdditionalFlatResourcesChunkSize * sizeof(chunk[0]));
                     // Write the elements before the release-store so that a concurrent reader
                     // loading the pointer with memory_order_acquire observes a fully initialized
-                    // array.
-                    additionalResources[handle - kInitialFlatResourcesSize] = resource;
-                    mAdditionalFlatResources.store(additionalResources, std::memory_order_release);
+                    // chunk.
+                    chunk[indexInChunk] = resource;
+                    chunkPointer.store(chunk, std::memory_order_release);
                     return;
                 }
             }
-            additionalResources[handle - kInitialFlatResourcesSize] = resource;
+            chunk[indexInChunk] = resource;
             return;
         }
     }
@@ -544,14 +560,12 @@ void ResourceMap<ResourceType, IDType>::clear()
     // No need for a lock as this is only called on destruction.
     memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * sizeof(mFlatResources[0]));
     mFlatResourcesSize = kInitialFlatResourcesSize;
-    if constexpr (kAdditionalFlatResourcesSize > 0)
+    for (std::atomic<ResourceType **> &chunkPointer : mAdditionalFlatResources)
     {
-        ResourceType **additionalResources =
-            mAdditionalFlatResources.load(std::memory_order_acquire);
-        if (additionalResources != nullptr)
+        ResourceType **chunk = chunkPointer.load(std::memory_order_acquire);
+        if (chunk != nullptr)
         {
-            memset(additionalResources, kInvalidPointer,
-                   kAdditionalFlatResourcesSize * sizeof(additionalResources[0]));
+            memset(chunk, kInvalidPointer, kAdditionalFlatResourcesChunkSize * sizeof(chunk[0]));
         }
     }
     mHashedResources.clear();
@@ -573,18 +587,32 @@ GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool sk
     }
     if constexpr (kAdditionalFlatResourcesSize > 0)
     {
-        ResourceType **additionalResources =
-            mAdditionalFlatResources.load(std::memory_order_acquire);
-        if (additionalResources != nullptr)
+        ASSERT(index >= kInitialFlatResourcesSize);
+        while (index < kLocklessFlatResourcesLimit)
         {
-            for (; index < kLocklessFlatResourcesLimit; index++)
+            const size_t chunkIndex = (index - kInitialFlatResourcesSize) /
+                                      kAdditionalFlatResourcesChunkSize;
+            const size_t chunkStart =
+                kInitialFlatResourcesSize + chunkIndex * kAdditionalFlatResourcesChunkSize;
+            const size_t chunkEnd =
+                std::min(kLocklessFlatResourcesLimit,
+                         chunkStart + kAdditionalFlatResourcesChunkSize);
+
+            // Unallocated chunks hold no resources and are skipped entirely.
+            ResourceType **chunk =
+                mAdditionalFlatResources[chunkIndex].load(std::memory_order_acquire);
+            if (chunk != nullptr)
             {
-                ResourceType *value = additionalResources[index - kInitialFlatResourcesSize];
-                if ((value != nullptr || !skipNulls) && value != InvalidPointer())
+                for (; index < chunkEnd; index++)
                 {
-                    return static_cast<GLuint>(index);
+                    ResourceType *value = chunk[index - chunkStart];
+                    if ((value != nullptr || !skipNulls) && value != InvalidPointer())
+                    {
+                        return static_cast<GLuint>(index);
+                    }
                 }
             }
+            index = chunkEnd;
         }
         return static_cast<GLuint>(kLocklessFlatResourcesLimit);
     }
@@ -673,12 +701,10 @@ void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
         }
         else
         {
-            ResourceType **additionalResources =
-                mOrigin.mAdditionalFlatResources.load(std::memory_order_acquire);
-            ASSERT(additionalResources != nullptr);
-            mValue.first = mFlatIndex;
-            mValue.second =
-                additionalResources[mFlatIndex - ResourceMap::kInitialFlatResourcesSize];
+            ResourceType **slot = mOrigin.getAdditionalFlatResource(mFlatIndex);
+            ASSERT(slot != nullptr);
+            mValue.first  = mFlatIndex;
+            mValue.second = *slot;
         }
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
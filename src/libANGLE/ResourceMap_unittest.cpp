@@ -595,4 +595,44 @@ TEST(ResourceMapTest, IteratorVisitsInitialFlatArrayAndHashMap)
 
     resourceMap.clear();
 }
+
+// Tests that chunks of the additional flat array are allocated independently, and that handles in
+// unallocated chunks between allocated ones are skipped.
+TEST(ResourceMapTest, AdditionalFlatArrayChunks)
+{
+    // The additional flat range [3, 10) is split into chunks [3, 6), [6, 9) and [9, 10).  Assign
+    // handles in the first and last chunks only.
+    constexpr AdditionalFlatType kFirstChunkIdx  = 4;
+    constexpr AdditionalFlatType kMiddleChunkIdx = 7;
+    constexpr AdditionalFlatType kLastChunkIdx   = 9;
+    size_t firstChunkValue                       = 100;
+    size_t lastChunkValue                        = 200;
+
+    ResourceMap<size_t, AdditionalFlatType> resourceMap;
+    resourceMap.assign(kFirstChunkIdx, &firstChunkValue);
+    resourceMap.assign(kLastChunkIdx, &lastChunkValue);
+
+    EXPECT_EQ(resourceMap.query(kFirstChunkIdx), &firstChunkValue);
+    EXPECT_EQ(resourceMap.query(kLastChunkIdx), &lastChunkValue);
+    EXPECT_FALSE(resourceMap.contains(kMiddleChunkIdx));
+    EXPECT_EQ(resourceMap.query(kMiddleChunkIdx), nullptr);
+
+    size_t *erased = nullptr;
+    EXPECT_FALSE(resourceMap.erase(kMiddleChunkIdx, &erased));
+
+    std::map<GLuint, size_t *> visitedHandleMap;
+    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    {
+        visitedHandleMap[idValue.first] = idValue.second;
+    }
+    EXPECT_EQ(visitedHandleMap.size(), 2u);
+    EXPECT_EQ(visitedHandleMap[kFirstChunkIdx], &firstChunkValue);
+    EXPECT_EQ(visitedHandleMap[kLastChunkIdx], &lastChunkValue);
+
+    EXPECT_TRUE(resourceMap.erase(kFirstChunkIdx, &erased));
+    EXPECT_EQ(erased, &firstChunkValue);
+    EXPECT_TRUE(resourceMap.erase(kLastChunkIdx, &erased));
+    EXPECT_EQ(erased, &lastChunkValue);
+    EXPECT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
+}
 }  // anonymous namespace
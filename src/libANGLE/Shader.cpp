@@ -88,10 +88,12 @@ void GetSourceImpl(const std::string &source, GLsizei bufSize, GLsizei *length,
 class CompileTask final : public angle::Closure
 {
   public:
-    // Translate and compile
+    // Translate and compile.  If |compilerInstance| does not hold a compiler yet, one is
+    // constructed by the task itself, so that building the built-in symbol table is done in the
+    // worker thread as well.
     CompileTask(const angle::FrontendFeatures &frontendFeatures,
-                ShHandle compilerHandle,
-                ShShaderOutput outputType,
+                const Compiler *compiler,
+                ShCompilerInstance *compilerInstance,
                 const ShCompileOptions &options,
                 std::shared_ptr<const std::string> source,
                 size_t sourceHash,
@@ -102,8 +104,9 @@ class CompileTask final : public angle::Closure
         : mFrontendFeatures(frontendFeatures),
           mMaxComputeWorkGroupInvocations(maxComputeWorkGroupInvocations),
           mMaxComputeSharedMemory(maxComputeSharedMemory),
-          mCompilerHandle(compilerHandle),
-          mOutputType(outputType),
+          mCompiler(compiler),
+          mCompilerInstance(compilerInstance),
+          mOutputType(compiler->getShaderOutputType()),
           mOptions(options),
           mSource(source),
           mSourceHash(sourceHash),
@@ -123,6 +126,8 @@ class CompileTask final : public angle::Closure
 
     void operator()() override { mResult = compileImpl(); }
 
+    void cancel() { mCancellation.cancel(); }
+
     angle::Result getResult()
     {
         // Note: this function is called from WaitCompileJobUnlocked(), and must therefore be
@@ -151,9 +156,11 @@ class CompileTask final : public angle::Closure
     size_t mMaxComputeWorkGroupInvocations = 0;
     size_t mMaxComputeSharedMemory         = 0;
 
-    // Access to the compile information.  Note that the compiler instance is kept alive until
-    // resolveCompile.
-    ShHandle mCompilerHandle = 0;
+    // Access to the compile information.  Note that the compiler and the compiler instance are
+    // kept alive until resolveCompile.
+    const Compiler *mCompiler             = nullptr;
+    ShCompilerInstance *mCompilerInstance = nullptr;
+    ShHandle mCompilerHandle              = 0;
     ShShaderOutput mOutputType;
     ShCompileOptions mOptions;
     std::shared_ptr<const std::string> mSource;
@@ -163,6 +170,8 @@ class CompileTask final : public angle::Closure
     std::shared_ptr<rx::ShaderTranslateTask> mTranslateTask;
     angle::Result mResult;
     std::string mInfoLog;
+
+    angle::CancellationToken mCancellation;
 };
 
 class CompileEvent final
@@ -186,6 +195,7 @@ class CompileEvent final
     {
         return !mWaitableEvent->isReady() || mCompileTask->isCompilingInternally();
     }
+    void cancel() { mCompileTask->cancel(); }
 
     std::string &&getInfoLog() { return std::move(mCompileTask->getInfoLog()); }
 
@@ -196,9 +206,24 @@ class CompileEvent final
 
 angle::Result CompileTask::compileImpl()
 {
-    if (mCompilerHandle)
+    if (mCancellation.isCancelled())
+    {
+        return angle::Result::Stop;
+    }
+
+    if (mCompilerInstance)
     {
         // Compiling from source
+        if (mCompilerInstance->getHandle() == nullptr)
+        {
+            *mCompilerInstance = mCompiler->constructInstance(mCompiledState->shaderType);
+        }
+        mCompilerHandle = mCompilerInstance->getHandle();
+        if (mCompilerHandle == nullptr)
+        {
+            mInfoLog = "Failed to create the shader compiler.";
+            return angle::Result::Stop;
+        }
 
         // Call the translator and get the info log
         bool result = mTranslateTask->translate(mCompilerHandle, mOptions, *mSource);
@@ -443,6 +468,7 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    cancelUnusedCompile();
     resolveCompile(context);
     mImplementation->onDestroy(context);
     mBoundCompiler.set(context, nullptr);
@@ -620,6 +646,8 @@ void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
 
 void Shader::compile(const Context *context, angle::JobResultExpectancy resultExpectancy)
 {
+    // The result of a previous compile that is still pending is about to be replaced.
+    cancelUnusedCompile();
     resolveCompile(context);
 
     // Create a new compiled shader state.  If any programs are currently linking using this shader,
@@ -709,10 +737,6 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
     mBoundCompiler.set(context, compiler);
     ASSERT(mBoundCompiler.get());
 
-    ShCompilerInstance compilerInstance = mBoundCompiler->getInstance(mState.getShaderType());
-    ShHandle compilerHandle             = compilerInstance.getHandle();
-    ASSERT(compilerHandle);
-
     // Cache load failed, fall through normal compiling.
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
 
@@ -725,11 +749,17 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
         static_cast<size_t>(context->getCaps().maxComputeWorkGroupInvocations);
     const size_t maxComputeSharedMemory = context->getCaps().maxComputeSharedMemorySize;
 
-    std::shared_ptr<CompileTask> compileTask(
-        new CompileTask(context->getFrontendFeatures(), compilerInstance.getHandle(),
-                        compilerInstance.getShaderOutputType(), options, mState.mSource,
-                        mState.mSourceHash, mState.mCompiledState, maxComputeWorkGroupInvocations,
-                        maxComputeSharedMemory, std::move(translateTask)));
+    // Take a compiler instance from the pool if any.  Otherwise, the compile task creates one,
+    // which avoids serializing the (relatively expensive) creation of compiler instances on this
+    // thread when many shaders are compiled at once; the instances are only returned to the pool
+    // once the compilation is resolved.
+    mCompileJob                     = std::make_shared<CompileJob>();
+    mCompileJob->shCompilerInstance = mBoundCompiler->getPooledInstance(mState.getShaderType());
+
+    std::shared_ptr<CompileTask> compileTask(new CompileTask(
+        context->getFrontendFeatures(), mBoundCompiler.get(), &mCompileJob->shCompilerInstance,
+        options, mState.mSource, mState.mSourceHash, mState.mCompiledState,
+        maxComputeWorkGroupInvocations, maxComputeSharedMemory, std::move(translateTask)));
 
     // The GL backend relies on the driver's internal parallel compilation, and thus does not use a
     // thread to compile.  A front-end feature selects whether the single-threaded pool must be
@@ -741,9 +771,17 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
     std::shared_ptr<angle::WaitableEvent> compileEvent =
         context->postCompileLinkTask(compileTask, threadSafety, resultExpectancy);
 
-    mCompileJob                     = std::make_shared<CompileJob>();
-    mCompileJob->shCompilerInstance = std::move(compilerInstance);
-    mCompileJob->compileEvent       = std::make_unique<CompileEvent>(compileTask, compileEvent);
+    mCompileJob->compileEvent = std::make_unique<CompileEvent>(compileTask, compileEvent);
+}
+
+void Shader::cancelUnusedCompile()
+{
+    // Programs that are linking with this shader hold a reference to the compile job, and wait for
+    // its result.
+    if (mState.compilePending() && mCompileJob.use_count() == 1)
+    {
+        mCompileJob->compileEvent->cancel();
+    }
 }
 
 void Shader::resolveCompile(const Context *context)
@@ -206,6 +206,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
                             ShCompileOptions *compileOptions,
                             angle::JobResultExpectancy resultExpectancy);
 
+    // Lets the pending compile job stop early when no program is going to use its result.
+    void cancelUnusedCompile();
+
     // Compute a key to uniquely identify the shader object in memory caches.
     void setShaderKey(const Context *context,
                       const ShCompileOptions &compileOptions,
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "libANGLE/Context.h"
+#include "libANGLE/ProgramLinkedResources.h"
 
 namespace gl
 {
@@ -76,6 +77,11 @@ class ShareGroup final : angle::NonCopyable
 
     angle::FrameCaptureShared *getFrameCaptureShared() { return mFrameCaptureShared.get(); }
 
+    gl::InterfaceBlockLayoutCache *getInterfaceBlockLayoutCache()
+    {
+        return &mInterfaceBlockLayoutCache;
+    }
+
     void finishAllContexts();
 
     const ContextMap &getContexts() const { return mState.getContexts(); }
@@ -93,6 +99,9 @@ class ShareGroup final : angle::NonCopyable
     // Note: we use a raw pointer here so we can exclude frame capture sources from the build.
     std::unique_ptr<angle::FrameCaptureShared> mFrameCaptureShared;
 
+    // The layouts of the std140 and std430 interface blocks of the programs of the share group.
+    gl::InterfaceBlockLayoutCache mInterfaceBlockLayoutCache;
+
     ShareGroupState mState;
 };
 
@@ -23,8 +23,10 @@ class SizedMRUCache final : angle::NonCopyable
           mStore(SizedMRUCacheStore::NO_AUTO_EVICT)
     {}
 
-    // Returns nullptr on failure.
-    const Value *put(const Key &key, Value &&value, size_t size)
+    // Returns nullptr on failure.  An entry with a non-zero |evictionCost| is moved back to the
+    // front of the cache instead of being evicted, once per unit of cost.  This lets entries that
+    // are expensive to recreate outlive cheaper ones under memory pressure.
+    const Value *put(const Key &key, Value &&value, size_t size, uint32_t evictionCost = 0)
     {
         if (size > mMaximumTotalSize)
         {
@@ -34,7 +36,7 @@ class SizedMRUCache final : angle::NonCopyable
         // Check for existing key.
         eraseByKey(key);
 
-        auto retVal = mStore.Put(key, ValueAndSize(std::move(value), size));
+        auto retVal = mStore.Put(key, ValueAndSize(std::move(value), size, evictionCost));
         mCurrentSize += size;
 
         shrinkToSize(mMaximumTotalSize);
@@ -67,6 +69,16 @@ class SizedMRUCache final : angle::NonCopyable
         return false;
     }
 
+    // Calls |visitor| with the key and value of each entry, from the least recently used one.
+    template <typename Visitor>
+    void visitEntries(Visitor &&visitor) const
+    {
+        for (auto iter = mStore.rbegin(); iter != mStore.rend(); ++iter)
+        {
+            visitor(iter->first, iter->second.value);
+        }
+    }
+
     bool empty() const { return mStore.empty(); }
 
     void clear()
@@ -106,6 +118,14 @@ class SizedMRUCache final : angle::NonCopyable
         {
             ASSERT(!mStore.empty());
             auto iter = mStore.rbegin();
+            if (iter->second.evictionCost > 0)
+            {
+                // Give the entry another pass through the cache.  This terminates because the
+                // cost is reduced every time.
+                --iter->second.evictionCost;
+                mStore.Get(iter->first);
+                continue;
+            }
             mCurrentSize -= iter->second.size;
             mStore.Erase(iter);
         }
@@ -118,18 +138,22 @@ class SizedMRUCache final : angle::NonCopyable
   private:
     struct ValueAndSize
     {
-        ValueAndSize() : value(), size(0) {}
-        ValueAndSize(Value &&value, size_t size) : value(std::move(value)), size(size) {}
+        ValueAndSize() : value(), size(0), evictionCost(0) {}
+        ValueAndSize(Value &&value, size_t size, uint32_t evictionCost)
+            : value(std::move(value)), size(size), evictionCost(evictionCost)
+        {}
         ValueAndSize(ValueAndSize &&other) : ValueAndSize() { *this = std::move(other); }
         ValueAndSize &operator=(ValueAndSize &&other)
         {
             std::swap(value, other.value);
             std::swap(size, other.size);
+            std::swap(evictionCost, other.evictionCost);
             return *this;
         }
 
         Value value;
         size_t size;
+        uint32_t evictionCost;
     };
 
     using SizedMRUCacheStore = base::HashingMRUCache<Key, ValueAndSize>;
@@ -107,4 +107,37 @@ TEST(SizedMRUCacheTest, OversizeValue)
     EXPECT_FALSE(sizedCache.put(5, 5, 100));
 }
 
+// Tests that entries with an eviction cost outlive cheaper entries.
+TEST(SizedMRUCacheTest, EvictionCost)
+{
+    constexpr size_t kSize = 4;
+    SizedMRUCache<size_t, size_t> sizedCache(kSize);
+
+    // The first entry is the least recently used, but survives one eviction.
+    EXPECT_TRUE(sizedCache.put(0, 0, 1, 1));
+    for (size_t value = 1; value < kSize * 2 - 1; ++value)
+    {
+        size_t valueCopy = value;
+        EXPECT_TRUE(sizedCache.put(value, std::move(valueCopy), 1));
+    }
+    EXPECT_EQ(kSize, sizedCache.entryCount());
+
+    // The cheap entries put around the same time are evicted instead.
+    const size_t *qvalue = nullptr;
+    for (size_t value = 1; value < kSize; ++value)
+    {
+        EXPECT_FALSE(sizedCache.get(value, &qvalue));
+    }
+    EXPECT_TRUE(sizedCache.get(0, &qvalue));
+
+    // Once its cost is used up, it's evicted like any other entry.
+    for (size_t value = kSize * 2 - 1; value < kSize * 3 - 1; ++value)
+    {
+        size_t valueCopy = value;
+        EXPECT_TRUE(sizedCache.put(value, std::move(valueCopy), 1));
+    }
+    EXPECT_FALSE(sizedCache.get(0, &qvalue));
+    EXPECT_EQ(kSize, sizedCache.size());
+}
+
 }  // namespace angle
@@ -2472,9 +2472,12 @@ State::State(const State *shareContextState,
       mDrawFramebuffer(nullptr),
       mProgram(nullptr),
       mVertexArray(nullptr),
+      mConditionalRenderMode(GL_NONE),
       mDisplayTextureShareGroup(shareTextures != nullptr),
       mMaxShaderCompilerThreads(std::numeric_limits<GLuint>::max()),
       mOverlay(overlay),
+      mFramebufferCompletenessCacheHits(0),
+      mFramebufferCompletenessCacheMisses(0),
       mPrivateState(clientVersion,
                     debug,
                     bindGeneratesResourceCHROMIUM,
@@ -2622,6 +2625,8 @@ void State::reset(const Context *context)
     {
         mActiveQueries[type].set(context, nullptr);
     }
+    mConditionalRenderQuery.set(context, nullptr);
+    mConditionalRenderMode = GL_NONE;
 
     for (OffsetBindingPointer<Buffer> &buf : mUniformBuffers)
     {
@@ -3247,6 +3252,12 @@ Query *State::getActiveQuery(QueryType type) const
     return mActiveQueries[type].get();
 }
 
+void State::setConditionalRenderQuery(const Context *context, Query *query, GLenum mode)
+{
+    mConditionalRenderQuery.set(context, query);
+    mConditionalRenderMode = query ? mode : GL_NONE;
+}
+
 angle::Result State::setIndexedBufferBinding(const Context *context,
                                              BufferBinding target,
                                              GLuint index,
@@ -1042,6 +1042,11 @@ class State : angle::NonCopyable
     QueryID getActiveQueryId(QueryType type) const;
     Query *getActiveQuery(QueryType type) const;
 
+    // Conditional rendering (NV_conditional_render)
+    void setConditionalRenderQuery(const Context *context, Query *query, GLenum mode);
+    Query *getConditionalRenderQuery() const { return mConditionalRenderQuery.get(); }
+    GLenum getConditionalRenderMode() const { return mConditionalRenderMode; }
+
     // Program Pipeline binding manipulation
     angle::Result setProgramPipelineBinding(const Context *context, ProgramPipeline *pipeline);
     void detachProgramPipeline(const Context *context, ProgramPipelineID pipeline);
@@ -1290,6 +1295,21 @@ class State : angle::NonCopyable
 
     const OverlayType *getOverlay() const { return mOverlay; }
 
+    // Hits and misses of the completeness caches of this context's framebuffers, reported through
+    // the perf counters.
+    void onFramebufferCompletenessCacheLookup(bool hit) const
+    {
+        ++(hit ? mFramebufferCompletenessCacheHits : mFramebufferCompletenessCacheMisses);
+    }
+    uint64_t getFramebufferCompletenessCacheHits() const
+    {
+        return mFramebufferCompletenessCacheHits;
+    }
+    uint64_t getFramebufferCompletenessCacheMisses() const
+    {
+        return mFramebufferCompletenessCacheMisses;
+    }
+
     // Not for general use.
     const BufferManager &getBufferManagerForCapture() const { return *mBufferManager; }
     const BoundBufferMap &getBoundBuffersForCapture() const { return mBoundBuffers; }
@@ -1698,6 +1718,10 @@ class State : angle::NonCopyable
 
     ActiveQueryMap mActiveQueries;
 
+    // The query whose result predicates rendering between Begin/EndConditionalRenderNV.
+    BindingPointer<Query> mConditionalRenderQuery;
+    GLenum mConditionalRenderMode;
+
     // Stores the currently bound buffer for each binding point. It has an entry for the element
     // array buffer but it should not be used. Instead this bind point is owned by the current
     // vertex array object.
@@ -1737,6 +1761,9 @@ class State : angle::NonCopyable
     // Fine grained dirty type for uniform buffers.
     mutable BufferDirtyTypeBitMask mUniformBufferBlocksDirtyTypeMask;
 
+    mutable uint64_t mFramebufferCompletenessCacheHits;
+    mutable uint64_t mFramebufferCompletenessCacheMisses;
+
     PrivateState mPrivateState;
 };
 
@@ -38,10 +38,12 @@ SurfaceState::SurfaceState(SurfaceID idIn,
       timestampsEnabled(false),
       autoRefreshEnabled(false),
       directComposition(false),
+      lowLatency(false),
       swapBehavior(EGL_NONE),
       swapInterval(0)
 {
     directComposition = attributes.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE;
+    lowLatency        = attributes.get(EGL_SURFACE_LOW_LATENCY_ANGLE, EGL_FALSE) == EGL_TRUE;
     swapInterval      = attributes.getAsInt(EGL_SWAP_INTERVAL_ANGLE, 1);
 }
 
@@ -912,6 +914,11 @@ egl::Error Surface::getCompressionRate(const egl::Display *display,
     return mImplementation->getCompressionRate(display, context, rate);
 }
 
+egl::Error Surface::getPresentStatistic(EGLint attribute, EGLint *value) const
+{
+    return mImplementation->getPresentStatistic(attribute, value);
+}
+
 egl::Error Surface::lockSurfaceKHR(const egl::Display *display, const AttributeMap &attributes)
 {
     EGLint lockBufferUsageHint = attributes.getAsInt(
@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_SURFACE_H_
 #define LIBANGLE_SURFACE_H_
 
+#include <atomic>
 #include <memory>
 
 #include <EGL/egl.h>
@@ -64,6 +65,7 @@ struct SurfaceState final : private angle::NonCopyable
     SupportedCompositorTiming supportedCompositorTimings;
     SupportedTimestamps supportedTimestamps;
     bool directComposition;
+    bool lowLatency;
     EGLenum swapBehavior;
     EGLint swapInterval;
 };
@@ -151,11 +153,15 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     egl::Error getCompressionRate(const egl::Display *display,
                                   const gl::Context *context,
                                   EGLint *rate);
+    // EGL_ANGLE_surface_present_statistics
+    egl::Error getPresentStatistic(EGLint attribute, EGLint *value) const;
     egl::Error lockSurfaceKHR(const egl::Display *display, const AttributeMap &attributes);
     egl::Error unlockSurfaceKHR(const egl::Display *display);
 
     bool isLocked() const;
     bool isCurrentOnAnyContext() const { return mIsCurrentOnAnyContext; }
+    // May be called without the global lock, see egl::IsMakeCurrentNoOp().
+    bool isDestroyed() const { return mDestroyed.load(std::memory_order_relaxed); }
 
     gl::Texture *getBoundTexture() const { return mTexture; }
 
@@ -183,6 +189,7 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     EGLint getOrientation() const { return mOrientation; }
 
     bool directComposition() const { return mState.directComposition; }
+    bool isLowLatency() const { return mState.lowLatency; }
 
     gl::InitState initState(GLenum binding, const gl::ImageIndex &imageIndex) const override;
     void setInitState(GLenum binding,
@@ -251,7 +258,7 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
     SurfaceState mState;
     rx::SurfaceImpl *mImplementation;
     int mRefCount;
-    bool mDestroyed;
+    std::atomic<bool> mDestroyed;
 
     EGLint mType;
     EGLenum mBuftype;
@@ -1393,6 +1393,7 @@ void Texture::signalDirtyStorage(InitState initState)
         mState.mInitState = InitState::MayNeedInit;
     }
     invalidateCompletenessCache();
+    onCompletenessStateChange();
     mState.mCachedSamplerFormatValid = false;
     onStateChange(angle::SubjectMessage::SubjectChanged);
 }
@@ -1405,6 +1406,7 @@ void Texture::signalDirtyState(size_t dirtyBit)
 
     if (dirtyBit == DIRTY_BIT_BASE_LEVEL || dirtyBit == DIRTY_BIT_MAX_LEVEL)
     {
+        onCompletenessStateChange();
         onStateChange(angle::SubjectMessage::SubjectChanged);
     }
     else
@@ -2471,16 +2473,33 @@ bool Texture::isSamplerComplete(const Context *context, const Sampler *optionalS
         optionalSampler ? optionalSampler->getSamplerState() : mState.mSamplerState;
     const auto &contextState = context->getState();
 
-    if (contextState.getContextID() != mCompletenessCache.context ||
-        !mCompletenessCache.samplerState.sameCompleteness(samplerState))
+    if (contextState.getContextID() != mCompletenessCache.context)
     {
-        mCompletenessCache.context      = context->getState().getContextID();
-        mCompletenessCache.samplerState = samplerState;
-        mCompletenessCache.samplerComplete =
-            mState.computeSamplerCompleteness(samplerState, contextState);
+        mCompletenessCache.context         = contextState.getContextID();
+        mCompletenessCache.validEntryCount = 0;
+        mCompletenessCache.nextEntry       = 0;
     }
 
-    return mCompletenessCache.samplerComplete;
+    const uint32_t samplerCompleteness = samplerState.getPackedCompleteness();
+    for (size_t entry = 0; entry < mCompletenessCache.validEntryCount; ++entry)
+    {
+        if (mCompletenessCache.samplerCompleteness[entry] == samplerCompleteness)
+        {
+            return mCompletenessCache.samplerComplete[entry];
+        }
+    }
+
+    const bool samplerComplete = mState.computeSamplerCompleteness(samplerState, contextState);
+
+    const size_t entry                            = mCompletenessCache.nextEntry;
+    mCompletenessCache.samplerCompleteness[entry] = samplerCompleteness;
+    mCompletenessCache.samplerComplete[entry]     = samplerComplete;
+    mCompletenessCache.nextEntry =
+        static_cast<uint8_t>((entry + 1) % SamplerCompletenessCache::kEntryCount);
+    mCompletenessCache.validEntryCount = static_cast<uint8_t>(std::min<size_t>(
+        mCompletenessCache.validEntryCount + 1, SamplerCompletenessCache::kEntryCount));
+
+    return samplerComplete;
 }
 
 // CopyImageSubData requires that we ignore format-based completeness rules
@@ -2538,7 +2557,7 @@ bool Texture::isFramebufferAttachmentComplete(GLuint attachmentMipLevel, const c
 }
 
 Texture::SamplerCompletenessCache::SamplerCompletenessCache()
-    : context({0}), samplerState(), samplerComplete(false)
+    : context({0}), samplerCompleteness{}, samplerComplete{}, validEntryCount(0), nextEntry(0)
 {}
 
 void Texture::invalidateCompletenessCache() const
@@ -2777,6 +2796,7 @@ void Texture::onBindToMSRTTFramebuffer()
 {
     if (!mState.mHasBeenBoundToMSRTTFramebuffer)
     {
+        onCompletenessStateChange();
         onStateChange(angle::SubjectMessage::SubjectChanged);
     }
     mState.mHasBeenBoundToMSRTTFramebuffer = true;
@@ -2834,6 +2854,7 @@ void Texture::onBindAsImageTexture()
     {
         mDirtyBits.set(DIRTY_BIT_BOUND_AS_IMAGE);
         mState.mHasBeenBoundAsImage = true;
+        onCompletenessStateChange();
         onStateChange(angle::SubjectMessage::SubjectChanged);
     }
 }
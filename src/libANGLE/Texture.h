@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_TEXTURE_H_
 #define LIBANGLE_TEXTURE_H_
 
+#include <array>
 #include <map>
 #include <vector>
 
@@ -858,15 +859,22 @@ class Texture final : public RefCountObject<TextureID>,
     {
         SamplerCompletenessCache();
 
-        // Context used to generate this cache entry
+        // Context used to generate the cache entries
         ContextID context;
 
-        // All values that affect sampler completeness that are not stored within
-        // the texture itself
-        SamplerState samplerState;
+        // A few entries are kept so that a texture sampled with different sampler objects (or both
+        // with and without one) doesn't recompute its completeness every time it's rebound.
+        static constexpr size_t kEntryCount = 2;
+
+        // All values that affect sampler completeness that are not stored within the texture
+        // itself, as given by SamplerState::getPackedCompleteness().
+        std::array<uint32_t, kEntryCount> samplerCompleteness;
 
         // Result of the sampler completeness with the above parameters
-        bool samplerComplete;
+        std::array<bool, kEntryCount> samplerComplete;
+
+        uint8_t validEntryCount;
+        uint8_t nextEntry;
     };
 
     mutable SamplerCompletenessCache mCompletenessCache;
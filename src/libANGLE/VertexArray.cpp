@@ -72,6 +72,7 @@ void VertexArrayState::setAttribBinding(size_t attribIndex, GLuint newBindingInd
     attrib.bindingIndex = newBindingIndex;
 
     mEnabledAttributesMask.set(attribIndex, attrib.enabled);
+    mInstancedAttributesMask.set(attribIndex, newBinding.getDivisor() != 0);
 }
 
 bool VertexArrayState::isDefault() const
@@ -205,6 +206,14 @@ void VertexArrayPrivate::setVertexBindingDivisor(size_t bindingIndex, GLuint div
     }
 
     binding.setDivisor(divisor);
+    if (divisor != 0)
+    {
+        mState.mInstancedAttributesMask |= binding.getBoundAttributesMask();
+    }
+    else
+    {
+        mState.mInstancedAttributesMask &= ~binding.getBoundAttributesMask();
+    }
     setDirtyBindingBit(bindingIndex, DIRTY_BINDING_DIVISOR);
 }
 
@@ -80,6 +80,9 @@ class VertexArrayState final : angle::NonCopyable
         return mNullPointerClientMemoryAttribsMask;
     }
 
+    // The attributes whose binding has a non-zero divisor.
+    AttributesMask getInstancedAttributesMask() const { return mInstancedAttributesMask; }
+
     VertexArrayID id() const { return mId; }
 
     bool isDefault() const;
@@ -107,6 +110,10 @@ class VertexArrayState final : angle::NonCopyable
     // attribs.
     AttributesMask mClientMemoryAttribsMask;
     AttributesMask mNullPointerClientMemoryAttribsMask;
+
+    // Kept up to date with the divisor of each attribute's binding, so that draw validation
+    // doesn't need to look up the bindings of all attributes.
+    AttributesMask mInstancedAttributesMask;
 };
 
 class VertexArrayPrivate : public angle::NonCopyable
@@ -214,6 +221,7 @@ class VertexArrayPrivate : public angle::NonCopyable
     }
 
     AttributesMask getClientAttribsMask() const { return mState.mClientMemoryAttribsMask; }
+    AttributesMask getInstancedAttributesMask() const { return mState.mInstancedAttributesMask; }
 
     bool hasEnabledNullPointerClientArray() const
     {
@@ -452,6 +452,9 @@ class SamplerState final
         return mCompleteness.packed == samplerState.mCompleteness.packed;
     }
 
+    // Sampler states that affect texture completeness the same way have the same packed value.
+    uint32_t getPackedCompleteness() const { return mCompleteness.packed; }
+
   private:
     void updateWrapTCompareMode();
 
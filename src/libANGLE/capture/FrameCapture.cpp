@@ -4319,6 +4319,17 @@ void CaptureShareGroupMidExecutionSetup(
                                        replayState, true, gl::TextureType::External, eglImageID));
                 }
             }
+            else if (desc.initState == gl::InitState::MayNeedInit)
+            {
+                // The level was never written to (or was invalidated), so its contents are
+                // undefined and there is nothing to read back.  With robust resource init the
+                // clear is still pending, and the replay, which uses robust resource init too,
+                // clears the level the same way on first use.
+                for (std::vector<CallCapture> *calls : texSetupCalls)
+                {
+                    CaptureTextureContents(calls, &replayState, texture, index, desc, 0, nullptr);
+                }
+            }
             else if (context->getExtensions().getImageANGLE)
             {
                 // Use ANGLE_get_image to read back pixel data.
@@ -9594,6 +9605,30 @@ void FrameCaptureShared::writeCppReplayIndexFiles(const gl::Context *context,
         mReplayWriter.addPublicFunction(proto, std::stringstream(), source);
     }
 
+    if (mSerializeStateEnabled)
+    {
+        // Lets the replay compare a digest of its state and only serialize it fully on mismatch.
+        std::string proto = "const char *GetSerializedContextStateDigest(uint32_t frameIndex)";
+
+        std::stringstream source;
+
+        source << proto << "\n";
+        source << "{\n";
+        source << "    switch (frameIndex)\n";
+        source << "    {\n";
+        for (const auto &frameDigest : mSerializedStateDigests)
+        {
+            source << "        case " << frameDigest.first << ":\n";
+            source << "            return \"" << frameDigest.second << "\";\n";
+        }
+        source << "        default:\n";
+        source << "            return NULL;\n";
+        source << "    }\n";
+        source << "}\n";
+
+        mReplayWriter.addPublicFunction(proto, std::stringstream(), source);
+    }
+
     {
         std::stringstream fnameStream;
         fnameStream << mOutDirectory << FmtCapturePrefix(contextId, mCaptureLabel);
@@ -9893,6 +9928,12 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
 
             mReplayWriter.addPrivateFunction(proto, std::stringstream(), bodyStream);
         }
+
+        std::string serializedContextDigest;
+        if (SerializeContextToDigest(context, &serializedContextDigest) == Result::Continue)
+        {
+            mSerializedStateDigests[frameIndex] = std::move(serializedContextDigest);
+        }
     }
 
     {
@@ -14,7 +14,11 @@
 #    pragma allow_unsafe_buffers
 #endif
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <thread>
 #include "sys/stat.h"
 
 #include "common/PackedEnums.h"
@@ -100,12 +104,46 @@ enum class CaptureAPI : uint8_t
     EnumCount   = 2,
 };
 
+// Writes finished replay files on a background thread, so the captured application doesn't wait
+// on file I/O at frame boundaries.  The queue is bounded; once it is full, write() blocks until
+// the background thread catches up.
+class ReplayFileWriter final : angle::NonCopyable
+{
+  public:
+    ReplayFileWriter();
+    ~ReplayFileWriter();
+
+    void setAsync(bool async);
+    void write(const std::string &filePath, std::string &&contents);
+    // Waits until every queued file is written.
+    void flush();
+
+  private:
+    struct PendingFile
+    {
+        std::string filePath;
+        std::string contents;
+    };
+
+    static void WriteFile(const std::string &filePath, const std::string &contents);
+    void writerThread();
+
+    bool mAsync;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<PendingFile> mPendingFiles;
+    bool mIsWriting;
+    bool mIsStopping;
+    std::thread mThread;
+};
+
 class ReplayWriter final : angle::NonCopyable
 {
   public:
     ReplayWriter();
     ~ReplayWriter();
 
+    void setAsyncFileWrites(bool async) { mFileWriter.setAsync(async); }
     void setSourceFileExtension(const char *ext);
     void setSourceFileSizeThreshold(size_t sourceFileSizeThreshold);
     void setFilenamePattern(const std::string &pattern);
@@ -136,6 +174,7 @@ class ReplayWriter final : angle::NonCopyable
 
     void reset()
     {
+        mFileWriter.flush();
         mDataTracker.reset();
         mFrameIndex = 1;  // This is really the FileIndex
     }
@@ -170,6 +209,8 @@ class ReplayWriter final : angle::NonCopyable
     std::vector<std::string> mPrivateFunctions;
 
     std::vector<std::string> mWrittenFiles;
+
+    ReplayFileWriter mFileWriter;
 };
 
 using BufferCalls = std::map<GLuint, std::vector<CallCapture>>;
@@ -1068,6 +1109,8 @@ class FrameCaptureShared final : angle::NonCopyable
     static bool mRuntimeEnabled;
     static bool mRuntimeInitialized;
     bool mSerializeStateEnabled;
+    // The digest of the serialized state at the end of each replay frame.
+    std::map<uint32_t, std::string> mSerializedStateDigests;
     std::string mOutDirectory;
     std::string mCaptureLabel;
     bool mCompression;
@@ -1540,12 +1583,16 @@ constexpr char kValidationExprVarName[] = "ANGLE_CAPTURE_VALIDATION_EXPR";
 constexpr char kSourceExtVarName[]      = "ANGLE_CAPTURE_SOURCE_EXT";
 constexpr char kSourceSizeVarName[]     = "ANGLE_CAPTURE_SOURCE_SIZE";
 constexpr char kForceShadowVarName[]    = "ANGLE_CAPTURE_FORCE_SHADOW";
+constexpr char kAsyncWriteVarName[]     = "ANGLE_CAPTURE_ASYNC_WRITE";
 
 constexpr size_t kFunctionSizeLimit = 5000;
 
 // Limit based on MSVC Compiler Error C2026
 constexpr size_t kStringLengthLimit = 16380;
 
+// Number of finished replay files that can wait to be written before capture blocks on file I/O.
+constexpr size_t kMaxPendingReplayFiles = 8;
+
 // Default limit to number of bytes in a capture source files.
 constexpr char kDefaultSourceFileExt[]           = "cpp";
 constexpr size_t kDefaultSourceFileSizeThreshold = 400000;
@@ -1566,6 +1613,7 @@ constexpr char kAndroidValidationExpr[] = "debug.angle.capture.validation_expr";
 constexpr char kAndroidSourceExt[]      = "debug.angle.capture.source_ext";
 constexpr char kAndroidSourceSize[]     = "debug.angle.capture.source_size";
 constexpr char kAndroidForceShadow[]    = "debug.angle.capture.force_shadow";
+constexpr char kAndroidAsyncWrite[]     = "debug.angle.capture.async_write";
 
 void WriteCppReplayForCall(const CallCapture &call,
                            ReplayWriter &replayWriter,
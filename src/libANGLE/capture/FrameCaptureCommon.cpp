@@ -579,6 +579,13 @@ FrameCaptureShared::FrameCaptureShared()
         mCoherentBufferTracker.enableShadowMemory();
     }
 
+    std::string asyncWriteFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kAsyncWriteVarName, kAndroidAsyncWrite);
+    if (asyncWriteFromEnv == "0")
+    {
+        mReplayWriter.setAsyncFileWrites(false);
+    }
+
     if (mFrameIndex == mCaptureStartFrame)
     {
         // Capture is starting from the first frame, so set the capture active to ensure all GLES
@@ -760,6 +767,92 @@ void FrameCaptureShared::resetMidExecutionCapture(gl::Context *context)
     mActiveContexts.clear();
 }
 
+// ReplayFileWriter implementation.
+ReplayFileWriter::ReplayFileWriter() : mAsync(true), mIsWriting(false), mIsStopping(false) {}
+
+ReplayFileWriter::~ReplayFileWriter()
+{
+    flush();
+
+    if (mThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mIsStopping = true;
+        }
+        mCondition.notify_all();
+        mThread.join();
+    }
+}
+
+void ReplayFileWriter::setAsync(bool async)
+{
+    flush();
+    mAsync = async;
+}
+
+void ReplayFileWriter::write(const std::string &filePath, std::string &&contents)
+{
+    if (!mAsync)
+    {
+        WriteFile(filePath, contents);
+        return;
+    }
+
+    // The thread is only created once there is something to write.
+    if (!mThread.joinable())
+    {
+        mThread = std::thread(&ReplayFileWriter::writerThread, this);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mPendingFiles.size() < kMaxPendingReplayFiles; });
+        mPendingFiles.push_back({filePath, std::move(contents)});
+    }
+    mCondition.notify_all();
+}
+
+void ReplayFileWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mPendingFiles.empty() && !mIsWriting; });
+}
+
+// static
+void ReplayFileWriter::WriteFile(const std::string &filePath, const std::string &contents)
+{
+    SaveFileHelper saveFile(filePath);
+    saveFile.write(reinterpret_cast<const uint8_t *>(contents.data()), contents.size());
+}
+
+void ReplayFileWriter::writerThread()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mCondition.wait(lock, [this] { return mIsStopping || !mPendingFiles.empty(); });
+        if (mPendingFiles.empty())
+        {
+            ASSERT(mIsStopping);
+            return;
+        }
+
+        PendingFile file = std::move(mPendingFiles.front());
+        mPendingFiles.pop_front();
+        mIsWriting = true;
+
+        lock.unlock();
+        // Let a blocked write() queue the next file while this one is written.
+        mCondition.notify_all();
+        WriteFile(file.filePath, file.contents);
+        lock.lock();
+
+        mIsWriting = false;
+        mCondition.notify_all();
+    }
+}
+
 // ReplayWriter implementation.
 ReplayWriter::ReplayWriter()
     : mSourceFileExtension(kDefaultSourceFileExt),
@@ -995,7 +1088,7 @@ void ReplayWriter::saveHeader()
     headerPathStream << mFilenamePattern << ".h";
     std::string headerPath = headerPathStream.str();
 
-    SaveFileHelper saveH(headerPath);
+    std::stringstream saveH;
 
     saveH << mHeaderPrologue << "\n";
 
@@ -1029,6 +1122,7 @@ void ReplayWriter::saveHeader()
     mGlobalVariableDeclarations.clear();
     mStaticVariableDeclarations.clear();
 
+    mFileWriter.write(headerPath, saveH.str());
     addWrittenFile(headerPath);
 }
 
@@ -1042,6 +1136,10 @@ void ReplayWriter::saveIndexFilesAndHeader()
 
     writeReplaySource(sourcePath);
     saveHeader();
+
+    // The index files are the last to be written; make sure the trace is complete on disk when
+    // capture reports it is finished.
+    mFileWriter.flush();
 }
 
 void ReplayWriter::saveSetupFile()
@@ -1058,7 +1156,7 @@ void ReplayWriter::saveSetupFile()
 
 void ReplayWriter::writeReplaySource(const std::string &filename)
 {
-    SaveFileHelper saveCpp(filename);
+    std::stringstream saveCpp;
 
     saveCpp << mSourcePrologue << "\n";
     for (const std::string &header : mReplayHeaders)
@@ -1097,6 +1195,7 @@ void ReplayWriter::writeReplaySource(const std::string &filename)
     mPrivateFunctions.clear();
     mPublicFunctions.clear();
 
+    mFileWriter.write(filename, saveCpp.str());
     addWrittenFile(filename);
 }
 
@@ -34,6 +34,8 @@ DataCounters::DataCounters() {}
 DataCounters::~DataCounters() {}
 StringCounters::StringCounters() {}
 StringCounters::~StringCounters() {}
+ReplayFileWriter::ReplayFileWriter() {}
+ReplayFileWriter::~ReplayFileWriter() {}
 ReplayWriter::ReplayWriter() {}
 ReplayWriter::~ReplayWriter() {}
 
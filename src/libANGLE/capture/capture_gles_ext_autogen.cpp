@@ -8619,6 +8619,26 @@ CallCapture CaptureGetFramebufferParameterivMESA(const State &glState,
     return CallCapture(angle::EntryPoint::GLGetFramebufferParameterivMESA, std::move(paramBuffer));
 }
 
+CallCapture CaptureBeginConditionalRenderNV(const State &glState,
+                                            bool isCallValid,
+                                            QueryID idPacked,
+                                            GLenum mode)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("idPacked", ParamType::TQueryID, idPacked);
+    paramBuffer.addEnumParam("mode", GLESEnum::ConditionalRenderMode, ParamType::TGLenum, mode);
+
+    return CallCapture(angle::EntryPoint::GLBeginConditionalRenderNV, std::move(paramBuffer));
+}
+
+CallCapture CaptureEndConditionalRenderNV(const State &glState, bool isCallValid)
+{
+    ParamBuffer paramBuffer;
+
+    return CallCapture(angle::EntryPoint::GLEndConditionalRenderNV, std::move(paramBuffer));
+}
+
 CallCapture CaptureDeleteFencesNV(const State &glState,
                                   bool isCallValid,
                                   GLsizei n,
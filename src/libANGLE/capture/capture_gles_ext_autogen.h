@@ -2105,6 +2105,13 @@ angle::CallCapture CaptureGetFramebufferParameterivMESA(const State &glState,
                                                         GLenum pname,
                                                         GLint *params);
 
+// GL_NV_conditional_render
+angle::CallCapture CaptureBeginConditionalRenderNV(const State &glState,
+                                                   bool isCallValid,
+                                                   QueryID idPacked,
+                                                   GLenum mode);
+angle::CallCapture CaptureEndConditionalRenderNV(const State &glState, bool isCallValid);
+
 // GL_NV_fence
 angle::CallCapture CaptureDeleteFencesNV(const State &glState,
                                          bool isCallValid,
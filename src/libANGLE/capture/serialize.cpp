@@ -1402,55 +1402,52 @@ void SerializeVertexArray(JsonSerializer *json, gl::VertexArray *vertexArray)
                                   vertexArray->getBufferBindingPointers());
 }
 
-}  // namespace
-
-Result SerializeContextToString(const gl::Context *context, std::string *stringOut)
+Result SerializeContext(const gl::Context *context, JsonSerializer *json)
 {
-    JsonSerializer json;
-    json.startGroup("Context");
+    json->startGroup("Context");
 
-    SerializeContextState(&json, context->getState());
+    SerializeContextState(json, context->getState());
     ScratchBuffer scratchBuffer(1);
     {
         const gl::FramebufferManager &framebufferManager =
             context->getState().getFramebufferManagerForCapture();
-        GroupScope framebufferGroup(&json, "FramebufferManager");
+        GroupScope framebufferGroup(json, "FramebufferManager");
         for (const auto &framebuffer :
              gl::UnsafeResourceMapIter(framebufferManager.getResourcesForCapture()))
         {
             gl::Framebuffer *framebufferPtr = framebuffer.second;
-            ANGLE_TRY(SerializeFramebuffer(context, &json, &scratchBuffer, framebufferPtr));
+            ANGLE_TRY(SerializeFramebuffer(context, json, &scratchBuffer, framebufferPtr));
         }
     }
     {
         const gl::BufferManager &bufferManager = context->getState().getBufferManagerForCapture();
-        GroupScope framebufferGroup(&json, "BufferManager");
+        GroupScope framebufferGroup(json, "BufferManager");
         for (const auto &buffer : gl::UnsafeResourceMapIter(bufferManager.getResourcesForCapture()))
         {
             gl::Buffer *bufferPtr = buffer.second;
-            ANGLE_TRY(SerializeBuffer(context, &json, &scratchBuffer, bufferPtr));
+            ANGLE_TRY(SerializeBuffer(context, json, &scratchBuffer, bufferPtr));
         }
     }
     {
         const gl::SamplerManager &samplerManager =
             context->getState().getSamplerManagerForCapture();
-        GroupScope samplerGroup(&json, "SamplerManager");
+        GroupScope samplerGroup(json, "SamplerManager");
         for (const auto &sampler :
              gl::UnsafeResourceMapIter(samplerManager.getResourcesForCapture()))
         {
             gl::Sampler *samplerPtr = sampler.second;
-            SerializeSampler(&json, samplerPtr);
+            SerializeSampler(json, samplerPtr);
         }
     }
     {
         const gl::RenderbufferManager &renderbufferManager =
             context->getState().getRenderbufferManagerForCapture();
-        GroupScope renderbufferGroup(&json, "RenderbufferManager");
+        GroupScope renderbufferGroup(json, "RenderbufferManager");
         for (const auto &renderbuffer :
              gl::UnsafeResourceMapIter(renderbufferManager.getResourcesForCapture()))
         {
             gl::Renderbuffer *renderbufferPtr = renderbuffer.second;
-            ANGLE_TRY(SerializeRenderbuffer(context, &json, &scratchBuffer, renderbufferPtr));
+            ANGLE_TRY(SerializeRenderbuffer(context, json, &scratchBuffer, renderbufferPtr));
         }
     }
     const gl::ShaderProgramManager &shaderProgramManager =
@@ -1458,50 +1455,65 @@ Result SerializeContextToString(const gl::Context *context, std::string *stringO
     {
         const gl::ResourceMap<gl::Shader, gl::ShaderProgramID> &shaderManager =
             shaderProgramManager.getShadersForCapture();
-        GroupScope shaderGroup(&json, "ShaderManager");
+        GroupScope shaderGroup(json, "ShaderManager");
         for (const auto &shader : gl::UnsafeResourceMapIter(shaderManager))
         {
             GLuint id             = shader.first;
             gl::Shader *shaderPtr = shader.second;
-            SerializeShader(context, &json, id, shaderPtr);
+            SerializeShader(context, json, id, shaderPtr);
         }
     }
     {
         const gl::ResourceMap<gl::Program, gl::ShaderProgramID> &programManager =
             shaderProgramManager.getProgramsForCaptureAndPerf();
-        GroupScope shaderGroup(&json, "ProgramManager");
+        GroupScope shaderGroup(json, "ProgramManager");
         for (const auto &program : gl::UnsafeResourceMapIter(programManager))
         {
             GLuint id               = program.first;
             gl::Program *programPtr = program.second;
-            SerializeProgram(&json, context, id, programPtr);
+            SerializeProgram(json, context, id, programPtr);
         }
     }
     {
         const gl::TextureManager &textureManager =
             context->getState().getTextureManagerForCapture();
-        GroupScope shaderGroup(&json, "TextureManager");
+        GroupScope shaderGroup(json, "TextureManager");
         for (const auto &texture :
              gl::UnsafeResourceMapIter(textureManager.getResourcesForCapture()))
         {
             gl::Texture *texturePtr = texture.second;
-            ANGLE_TRY(SerializeTexture(context, &json, &scratchBuffer, texturePtr));
+            ANGLE_TRY(SerializeTexture(context, json, &scratchBuffer, texturePtr));
         }
     }
     {
         const gl::VertexArrayMap &vertexArrayMap = context->getVertexArraysForCapture();
-        GroupScope shaderGroup(&json, "VertexArrayMap");
+        GroupScope shaderGroup(json, "VertexArrayMap");
         for (const auto &vertexArray : gl::UnsafeResourceMapIter(vertexArrayMap))
         {
             gl::VertexArray *vertexArrayPtr = vertexArray.second;
-            SerializeVertexArray(&json, vertexArrayPtr);
+            SerializeVertexArray(json, vertexArrayPtr);
         }
     }
-    json.endGroup();
+    json->endGroup();
+
+    scratchBuffer.clear();
+    return Result::Continue;
+}
+}  // namespace
 
+Result SerializeContextToString(const gl::Context *context, std::string *stringOut)
+{
+    JsonSerializer json;
+    ANGLE_TRY(SerializeContext(context, &json));
     *stringOut = json.data();
+    return Result::Continue;
+}
 
-    scratchBuffer.clear();
+Result SerializeContextToDigest(const gl::Context *context, std::string *digestOut)
+{
+    JsonSerializer json(JsonSerializer::Mode::Digest);
+    ANGLE_TRY(SerializeContext(context, &json));
+    *digestOut = json.data();
     return Result::Continue;
 }
 
@@ -20,5 +20,9 @@ class Context;
 namespace angle
 {
 Result SerializeContextToString(const gl::Context *context, std::string *stringOut);
+
+// Returns a hash of the state that SerializeContextToString would serialize, which is much cheaper
+// to compute and to compare.  Use SerializeContextToString to find what differs.
+Result SerializeContextToDigest(const gl::Context *context, std::string *digestOut);
 }  // namespace angle
 #endif  // LIBANGLE_SERIALIZE_H_
@@ -16,4 +16,10 @@ Result SerializeContextToString(const gl::Context *context, std::string *stringO
     *stringOut = "SerializationNotAvailable";
     return angle::Result::Continue;
 }
+
+Result SerializeContextToDigest(const gl::Context *context, std::string *digestOut)
+{
+    *digestOut = "SerializationNotAvailable";
+    return angle::Result::Continue;
+}
 }  // namespace angle
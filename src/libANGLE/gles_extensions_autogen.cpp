@@ -58,6 +58,7 @@ const ExtensionInfoMap &GetExtensionInfoMap()
         map["GL_OES_compressed_ETC2_sRGB8_alpha8_texture"] = enableableExtension(&Extensions::compressedETC2SRGB8Alpha8TextureOES);
         map["GL_OES_compressed_ETC2_sRGB8_texture"] = enableableExtension(&Extensions::compressedETC2SRGB8TextureOES);
         map["GL_OES_compressed_paletted_texture"] = enableableExtension(&Extensions::compressedPalettedTextureOES);
+        map["GL_NV_conditional_render"] = enableableExtension(&Extensions::conditionalRenderNV);
         map["GL_EXT_conservative_depth"] = enableableExtension(&Extensions::conservativeDepthEXT);
         map["GL_EXT_copy_image"] = enableableExtension(&Extensions::copyImageEXT);
         map["GL_OES_copy_image"] = enableableExtension(&Extensions::copyImageOES);
@@ -159,6 +159,9 @@ struct Extensions
     // GL_OES_compressed_paletted_texture
     bool compressedPalettedTextureOES = false;
 
+    // GL_NV_conditional_render
+    bool conditionalRenderNV = false;
+
     // GL_EXT_conservative_depth
     bool conservativeDepthEXT = false;
 
@@ -4867,6 +4867,9 @@ egl::Error QuerySurfaceAttrib(const Display *display,
         case EGL_DIRECT_COMPOSITION_ANGLE:
             *value = surface->directComposition();
             break;
+        case EGL_SURFACE_LOW_LATENCY_ANGLE:
+            *value = surface->isLowLatency();
+            break;
         case EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE:
             *value = surface->isRobustResourceInitEnabled();
             break;
@@ -4906,6 +4909,12 @@ egl::Error QuerySurfaceAttrib(const Display *display,
         case EGL_SURFACE_COMPRESSION_EXT:
             ANGLE_TRY(surface->getCompressionRate(display, context, value));
             break;
+        case EGL_SURFACE_ACQUIRE_LATENCY_ANGLE:
+        case EGL_SURFACE_THROTTLE_WAIT_TIME_ANGLE:
+        case EGL_SURFACE_PRESENT_LATENCY_ANGLE:
+        case EGL_SURFACE_PRESENT_QUEUE_DEPTH_ANGLE:
+            ANGLE_TRY(surface->getPresentStatistic(attribute, value));
+            break;
         default:
             UNREACHABLE();
             break;
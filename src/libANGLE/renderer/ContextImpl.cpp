@@ -34,6 +34,20 @@ angle::Result ContextImpl::endTiling(const gl::Context *context, GLbitfield pres
     return angle::Result::Stop;
 }
 
+angle::Result ContextImpl::beginConditionalRender(const gl::Context *context,
+                                                  gl::Query *query,
+                                                  GLenum mode)
+{
+    UNREACHABLE();
+    return angle::Result::Stop;
+}
+
+angle::Result ContextImpl::endConditionalRender(const gl::Context *context)
+{
+    UNREACHABLE();
+    return angle::Result::Stop;
+}
+
 angle::Result ContextImpl::onUnMakeCurrent(const gl::Context *context)
 {
     return angle::Result::Continue;
@@ -22,6 +22,7 @@ class ErrorSet;
 class MemoryProgramCache;
 class Path;
 class PixelLocalStoragePlane;
+class Query;
 class Semaphore;
 struct Workarounds;
 }  // namespace gl
@@ -207,6 +208,12 @@ class ContextImpl : public GLImplFactory
                                       GLbitfield preserveMask);
     virtual angle::Result endTiling(const gl::Context *context, GLbitfield preserveMask);
 
+    // NV_conditional_render
+    virtual angle::Result beginConditionalRender(const gl::Context *context,
+                                                 gl::Query *query,
+                                                 GLenum mode);
+    virtual angle::Result endConditionalRender(const gl::Context *context);
+
     // State sync with dirty bits.
     virtual angle::Result syncState(const gl::Context *context,
                                     const gl::state::DirtyBits dirtyBits,
@@ -90,6 +90,8 @@ class ProgramExecutableImpl : angle::NonCopyable
                                GLuint *params) const                                           = 0;
     // Optional. Implement in backends that fill |postLinkSubTasksOut| in |LinkTask|.
     virtual void waitForPostLinkTasks(const gl::Context *context) { UNIMPLEMENTED(); }
+    // Optional.  Lets the post-link tasks know their results are no longer needed.
+    virtual void cancelPostLinkTasks() {}
     const gl::ProgramExecutable *getExecutable() const { return mExecutable; }
 
   protected:
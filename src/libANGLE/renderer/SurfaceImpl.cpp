@@ -210,6 +210,12 @@ egl::Error SurfaceImpl::getCompressionRate(const egl::Display *display,
     return egl::NoError();
 }
 
+egl::Error SurfaceImpl::getPresentStatistic(EGLint attribute, EGLint *value) const
+{
+    *value = 0;
+    return egl::NoError();
+}
+
 bool SurfaceImpl::supportsSingleRenderBuffer() const
 {
     return false;
@@ -133,6 +133,9 @@ class SurfaceImpl : public FramebufferAttachmentObjectImpl
                                           const gl::Context *context,
                                           EGLint *rate);
 
+    // EGL_ANGLE_surface_present_statistics
+    virtual egl::Error getPresentStatistic(EGLint attribute, EGLint *value) const;
+
     virtual bool supportsSingleRenderBuffer() const;
 
   protected:
@@ -309,6 +309,16 @@ inline void CopyToFloatVertexData(const uint8_t *input,
 template <size_t inputComponentCount, size_t outputComponentCount>
 void Copy32FTo16FVertexData(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
 {
+    // Tightly packed data with no added components is converted in one batch.
+    if (inputComponentCount == outputComponentCount &&
+        stride == sizeof(float) * inputComponentCount)
+    {
+        gl::ConvertFloat32ToFloat16(reinterpret_cast<const float *>(input),
+                                    reinterpret_cast<uint16_t *>(output),
+                                    count * inputComponentCount);
+        return;
+    }
+
     const unsigned short kZero = gl::float32ToFloat16(0.0f);
     const unsigned short kOne  = gl::float32ToFloat16(1.0f);
 
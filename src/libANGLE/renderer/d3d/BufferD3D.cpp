@@ -150,7 +150,8 @@ void BufferD3D::invalidateStaticData(const gl::Context *context, BufferFeedback
 {
     emptyStaticBufferCache();
 
-    if (mStaticIndexBuffer && mStaticIndexBuffer->getBufferSize() != 0)
+    if (mStaticIndexBuffer &&
+        (mStaticIndexBuffer->getBufferSize() != 0 || mStaticIndexBuffer->hasLineLoopRanges()))
     {
         SafeDelete(mStaticIndexBuffer);
     }
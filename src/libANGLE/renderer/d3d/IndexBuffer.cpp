@@ -7,6 +7,10 @@
 // IndexBuffer.cpp: Defines the abstract IndexBuffer class and IndexBufferInterface
 // class with derivations, classes that perform graphics API agnostic index buffer operations.
 
+#ifdef UNSAFE_BUFFERS_BUILD
+#    pragma allow_unsafe_buffers
+#endif
+
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
 
 #include "libANGLE/Context.h"
@@ -161,7 +165,7 @@ angle::Result StreamingIndexBufferInterface::reserveBufferSpace(const gl::Contex
 }
 
 StaticIndexBufferInterface::StaticIndexBufferInterface(BufferFactoryD3D *factory)
-    : IndexBufferInterface(factory, false)
+    : IndexBufferInterface(factory, false), mFactory(factory), mUsePrimitiveRestartFixedIndex(false)
 {}
 
 StaticIndexBufferInterface::~StaticIndexBufferInterface() {}
@@ -180,4 +184,60 @@ angle::Result StaticIndexBufferInterface::reserveBufferSpace(const gl::Context *
     return angle::Result::Continue;
 }
 
+const StaticIndexBufferInterface::LineLoopRange *StaticIndexBufferInterface::getLineLoopRange(
+    unsigned int offset,
+    GLuint count,
+    gl::DrawElementsType type,
+    bool primitiveRestart) const
+{
+    for (const std::unique_ptr<LineLoopRange> &range : mLineLoopRanges)
+    {
+        if (range->offset == offset && range->count == count && range->type == type &&
+            range->primitiveRestart == primitiveRestart)
+        {
+            return range.get();
+        }
+    }
+    return nullptr;
+}
+
+angle::Result StaticIndexBufferInterface::cacheLineLoopRange(
+    const gl::Context *context,
+    unsigned int offset,
+    GLuint count,
+    gl::DrawElementsType type,
+    bool primitiveRestart,
+    const std::vector<GLuint> &translatedIndices,
+    const LineLoopRange **rangeOut)
+{
+    ASSERT(!translatedIndices.empty());
+    *rangeOut = nullptr;
+
+    if (mLineLoopRanges.size() >= kMaxLineLoopRanges)
+    {
+        return angle::Result::Continue;
+    }
+
+    const unsigned int size = static_cast<unsigned int>(sizeof(GLuint) * translatedIndices.size());
+
+    auto range              = std::make_unique<LineLoopRange>();
+    range->offset           = offset;
+    range->count            = count;
+    range->type             = type;
+    range->primitiveRestart = primitiveRestart;
+    range->indexCount       = static_cast<unsigned int>(translatedIndices.size());
+    range->indices          = std::make_unique<StaticIndexBufferInterface>(mFactory);
+
+    ANGLE_TRY(range->indices->reserveBufferSpace(context, size, gl::DrawElementsType::UnsignedInt));
+
+    void *mappedMemory = nullptr;
+    ANGLE_TRY(range->indices->mapBuffer(context, size, &mappedMemory, nullptr));
+    memcpy(mappedMemory, translatedIndices.data(), size);
+    ANGLE_TRY(range->indices->unmapBuffer(context));
+
+    mLineLoopRanges.push_back(std::move(range));
+    *rangeOut = mLineLoopRanges.back().get();
+    return angle::Result::Continue;
+}
+
 }  // namespace rx
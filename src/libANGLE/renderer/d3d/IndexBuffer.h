@@ -14,6 +14,9 @@
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 
+#include <memory>
+#include <vector>
+
 namespace gl
 {
 class Context;
@@ -118,6 +121,49 @@ class StaticIndexBufferInterface : public IndexBufferInterface
     angle::Result reserveBufferSpace(const gl::Context *context,
                                      unsigned int size,
                                      gl::DrawElementsType indexType) override;
+
+    // Whether the restart index was translated along with the indices.  Only relevant if the
+    // buffer holds a converted copy of the source indices.
+    bool usesPrimitiveRestartFixedIndex() const { return mUsePrimitiveRestartFixedIndex; }
+    void setUsesPrimitiveRestartFixedIndex(bool enabled)
+    {
+        mUsePrimitiveRestartFixedIndex = enabled;
+    }
+
+    // A line loop drawn from a range of the source indices, translated into a closed list of
+    // 32-bit indices.  The buffer data doesn't change during the lifetime of the static buffer,
+    // so the translation is cached alongside it.
+    struct LineLoopRange final : angle::NonCopyable
+    {
+        unsigned int offset;
+        GLuint count;
+        gl::DrawElementsType type;
+        bool primitiveRestart;
+
+        unsigned int indexCount;
+        std::unique_ptr<StaticIndexBufferInterface> indices;
+    };
+
+    const LineLoopRange *getLineLoopRange(unsigned int offset,
+                                          GLuint count,
+                                          gl::DrawElementsType type,
+                                          bool primitiveRestart) const;
+    // Returns nullptr without an error if the cache is full.
+    angle::Result cacheLineLoopRange(const gl::Context *context,
+                                     unsigned int offset,
+                                     GLuint count,
+                                     gl::DrawElementsType type,
+                                     bool primitiveRestart,
+                                     const std::vector<GLuint> &translatedIndices,
+                                     const LineLoopRange **rangeOut);
+    bool hasLineLoopRanges() const { return !mLineLoopRanges.empty(); }
+
+  private:
+    static constexpr size_t kMaxLineLoopRanges = 4;
+
+    BufferFactoryD3D *const mFactory;
+    bool mUsePrimitiveRestartFixedIndex;
+    std::vector<std::unique_ptr<LineLoopRange>> mLineLoopRanges;
 };
 
 }  // namespace rx
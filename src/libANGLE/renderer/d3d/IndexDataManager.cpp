@@ -194,6 +194,14 @@ angle::Result IndexDataManager::prepareIndexData(const gl::Context *context,
     bool staticBufferUsable =
         staticBuffer && offsetAligned && staticBuffer->getIndexType() == dstType;
 
+    // A converted copy translated the restart index only if primitive restart was enabled at the
+    // time.
+    if (staticBufferInitialized && srcType != dstType &&
+        staticBuffer->usesPrimitiveRestartFixedIndex() != primitiveRestartFixedIndexEnabled)
+    {
+        staticBufferUsable = false;
+    }
+
     if (staticBufferInitialized && !staticBufferUsable)
     {
         BufferFeedback feedback;
@@ -226,6 +234,7 @@ angle::Result IndexDataManager::prepareIndexData(const gl::Context *context,
                 static_cast<unsigned int>(buffer->getSize()) >> srcTypeShift;
             ANGLE_TRY(StreamInIndexBuffer(context, staticBuffer, bufferData, convertCount, srcType,
                                           dstType, primitiveRestartFixedIndexEnabled, nullptr));
+            staticBuffer->setUsesPrimitiveRestartFixedIndex(primitiveRestartFixedIndexEnabled);
         }
         ASSERT(offsetAligned && staticBuffer->getIndexType() == dstType);
 
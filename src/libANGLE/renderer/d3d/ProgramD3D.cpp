@@ -717,7 +717,7 @@ GLboolean ProgramD3D::validate(const gl::Caps & /*caps*/)
 void ProgramD3D::linkResources(const gl::ProgramLinkedResources &resources)
 {
     HLSLBlockLayoutEncoderFactory hlslEncoderFactory;
-    gl::ProgramLinkedResourcesLinker linker(&hlslEncoderFactory);
+    gl::ProgramLinkedResourcesLinker linker(&hlslEncoderFactory, nullptr);
 
     linker.linkResources(mState, resources);
 
@@ -125,7 +125,7 @@ VertexBuffer *VertexBufferInterface::getVertexBuffer() const
 
 // StreamingVertexBufferInterface Implementation
 StreamingVertexBufferInterface::StreamingVertexBufferInterface(BufferFactoryD3D *factory)
-    : VertexBufferInterface(factory, true), mWritePosition(0), mReservedSpace(0)
+    : VertexBufferInterface(factory, true), mWritePosition(0), mReservedSpace(0), mGeneration(0)
 {}
 
 angle::Result StreamingVertexBufferInterface::initialize(const gl::Context *context,
@@ -141,6 +141,7 @@ void StreamingVertexBufferInterface::reset()
         mVertexBuffer->release();
         mVertexBuffer = mFactory->createVertexBuffer();
     }
+    ++mGeneration;
 }
 
 StreamingVertexBufferInterface::~StreamingVertexBufferInterface() {}
@@ -153,11 +154,13 @@ angle::Result StreamingVertexBufferInterface::reserveSpace(const gl::Context *co
     {
         ANGLE_TRY(setBufferSize(context, std::max(size, 3 * curBufferSize / 2)));
         mWritePosition = 0;
+        ++mGeneration;
     }
     else if (mWritePosition + size > curBufferSize)
     {
         ANGLE_TRY(discard(context));
         mWritePosition = 0;
+        ++mGeneration;
     }
 
     mReservedSpace = size;
@@ -136,11 +136,16 @@ class StreamingVertexBufferInterface : public VertexBufferInterface
                                      GLsizei instances,
                                      uint64_t baseInstance);
 
+    // Incremented whenever previously stored data may be overwritten, i.e. when the buffer is
+    // discarded, resized or reset.  Data stored under the same generation stays valid.
+    unsigned int getGeneration() const { return mGeneration; }
+
   private:
     angle::Result reserveSpace(const gl::Context *context, unsigned int size);
 
     unsigned int mWritePosition;
     unsigned int mReservedSpace;
+    unsigned int mGeneration;
 };
 
 class StaticVertexBufferInterface : public VertexBufferInterface
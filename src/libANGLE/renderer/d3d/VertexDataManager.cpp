@@ -25,6 +25,7 @@
 #include "libANGLE/renderer/d3d/BufferD3D.h"
 #include "libANGLE/renderer/d3d/ContextD3D.h"
 #include "libANGLE/renderer/d3d/VertexBuffer.h"
+#include "xxhash.h"
 
 using namespace angle;
 
@@ -224,7 +225,10 @@ VertexDataManager::CurrentValueState::CurrentValueState(CurrentValueState &&othe
 VertexDataManager::CurrentValueState::~CurrentValueState() {}
 
 VertexDataManager::VertexDataManager(BufferFactoryD3D *factory)
-    : mFactory(factory), mStreamingBuffer(factory)
+    : mFactory(factory),
+      mStreamingBuffer(factory),
+      mStreamedClientAttribs{},
+      mNextStreamedClientAttrib(0)
 {
     mCurrentValueCache.reserve(gl::MAX_VERTEX_ATTRIBS);
     for (int currentValueIndex = 0; currentValueIndex < gl::MAX_VERTEX_ATTRIBS; ++currentValueIndex)
@@ -446,25 +450,180 @@ angle::Result VertexDataManager::storeDynamicAttribs(
     // Will trigger unmapping on return.
     StreamingBufferUnmapper localUnmapper(&mStreamingBuffer);
 
-    // Reserve the required space for the dynamic buffers.
+    // Find the client memory attributes whose data is already in the streaming buffer, e.g.
+    // because the application draws the same client arrays over and over.
+    std::array<StreamedClientAttrib, gl::MAX_VERTEX_ATTRIBS> clientAttribs;
+    gl::AttributesMask clientAttribsMask;
+    gl::AttributesMask reusedAttribsMask;
     for (auto attribIndex : dynamicAttribsMask)
+    {
+        const auto &dynamicAttrib = (*translatedAttribs)[attribIndex];
+        ASSERT(dynamicAttrib.bufferBindingPointer);
+        if (dynamicAttrib.bufferBindingPointer->get() != nullptr)
+        {
+            continue;
+        }
+
+        InitStreamedClientAttrib(dynamicAttrib, start, count, instances, baseInstance,
+                                 &clientAttribs[attribIndex]);
+        if (clientAttribs[attribIndex].contentSize == 0)
+        {
+            continue;
+        }
+
+        clientAttribsMask.set(attribIndex);
+        const StreamedClientAttrib *streamed = findStreamedClientAttrib(clientAttribs[attribIndex]);
+        if (streamed != nullptr)
+        {
+            clientAttribs[attribIndex] = *streamed;
+            reusedAttribsMask.set(attribIndex);
+        }
+    }
+
+    // Reserve the required space for the dynamic buffers.
+    const unsigned int generation = mStreamingBuffer.getGeneration();
+    for (auto attribIndex : dynamicAttribsMask & ~reusedAttribsMask)
     {
         const auto &dynamicAttrib = (*translatedAttribs)[attribIndex];
         ANGLE_TRY(
             reserveSpaceForAttrib(context, dynamicAttrib, start, count, instances, baseInstance));
     }
 
+    // If making space discarded the streaming buffer, the data that was going to be reused is gone
+    // too.
+    if (mStreamingBuffer.getGeneration() != generation)
+    {
+        for (auto attribIndex : reusedAttribsMask)
+        {
+            const auto &dynamicAttrib = (*translatedAttribs)[attribIndex];
+            ANGLE_TRY(reserveSpaceForAttrib(context, dynamicAttrib, start, count, instances,
+                                            baseInstance));
+        }
+        reusedAttribsMask.reset();
+    }
+
     // Store dynamic attributes
     for (auto attribIndex : dynamicAttribsMask)
     {
         auto *dynamicAttrib = &(*translatedAttribs)[attribIndex];
+        if (reusedAttribsMask.test(attribIndex))
+        {
+            reuseStreamedClientAttrib(clientAttribs[attribIndex], dynamicAttrib);
+            continue;
+        }
+
         ANGLE_TRY(
             storeDynamicAttrib(context, dynamicAttrib, start, count, instances, baseInstance));
+
+        if (clientAttribsMask.test(attribIndex))
+        {
+            cacheStreamedClientAttrib(*dynamicAttrib, &clientAttribs[attribIndex]);
+        }
     }
 
     return angle::Result::Continue;
 }
 
+bool VertexDataManager::StreamedClientAttrib::sameDataAndLayout(
+    const StreamedClientAttrib &other) const
+{
+    return contentHash == other.contentHash && contentSize == other.contentSize &&
+           formatID == other.formatID && currentValueType == other.currentValueType &&
+           stride == other.stride && divisor == other.divisor && count == other.count &&
+           instances == other.instances && baseInstance == other.baseInstance;
+}
+
+// static
+void VertexDataManager::InitStreamedClientAttrib(const TranslatedAttribute &translated,
+                                                 GLint start,
+                                                 size_t count,
+                                                 GLsizei instances,
+                                                 uint64_t baseInstance,
+                                                 StreamedClientAttrib *streamedOut)
+{
+    ASSERT(translated.attribute && translated.binding);
+    const auto &attrib  = *translated.attribute;
+    const auto &binding = *translated.binding;
+    ASSERT(attrib.pointer);
+
+    GLsizei clampedInstances = std::max(instances, 1);
+    GLuint divisor           = binding.getDivisor();
+    size_t stride            = ComputeVertexAttributeStride(attrib, binding);
+
+    // Match the range of data that storeDynamicAttrib copies.  Instanced attributes ignore the
+    // 'start' offset.
+    size_t totalCount = gl::ComputeVertexBindingElementCount(divisor, count, clampedInstances, 0);
+    size_t elementCount =
+        gl::ComputeVertexBindingElementCount(divisor, totalCount, clampedInstances, baseInstance);
+    size_t firstElement = divisor == 0 ? static_cast<size_t>(start) : 0;
+
+    angle::CheckedNumeric<size_t> checkedOffset = firstElement;
+    checkedOffset *= stride;
+    angle::CheckedNumeric<size_t> checkedSize = elementCount;
+    checkedSize -= 1;
+    checkedSize *= stride;
+    checkedSize += ComputeVertexAttributeTypeSize(attrib);
+
+    *streamedOut = {};
+    if (elementCount == 0 || !checkedOffset.IsValid() || !checkedSize.IsValid())
+    {
+        // Not something to cache, the data is streamed as usual.
+        return;
+    }
+
+    const uint8_t *data = static_cast<const uint8_t *>(attrib.pointer) + checkedOffset.ValueOrDie();
+
+    streamedOut->contentSize      = checkedSize.ValueOrDie();
+    streamedOut->contentHash      = XXH3_64bits(data, streamedOut->contentSize);
+    streamedOut->formatID         = attrib.format->id;
+    streamedOut->currentValueType = translated.currentValueType;
+    streamedOut->stride           = stride;
+    streamedOut->divisor          = divisor;
+    streamedOut->count            = count;
+    streamedOut->instances        = clampedInstances;
+    streamedOut->baseInstance     = baseInstance;
+}
+
+const VertexDataManager::StreamedClientAttrib *VertexDataManager::findStreamedClientAttrib(
+    const StreamedClientAttrib &streamed) const
+{
+    const unsigned int generation = mStreamingBuffer.getGeneration();
+    for (const StreamedClientAttrib &cached : mStreamedClientAttribs)
+    {
+        if (cached.contentSize != 0 && cached.generation == generation &&
+            cached.sameDataAndLayout(streamed))
+        {
+            return &cached;
+        }
+    }
+    return nullptr;
+}
+
+void VertexDataManager::reuseStreamedClientAttrib(const StreamedClientAttrib &streamed,
+                                                  TranslatedAttribute *translated)
+{
+    ASSERT(streamed.generation == mStreamingBuffer.getGeneration());
+    VertexBuffer *vertexBuffer = mStreamingBuffer.getVertexBuffer();
+
+    translated->storage = nullptr;
+    translated->vertexBuffer.set(vertexBuffer);
+    translated->serial                = vertexBuffer->getSerial();
+    translated->stride                = streamed.streamStride;
+    translated->baseOffset            = streamed.streamOffset;
+    translated->usesFirstVertexOffset = false;
+}
+
+void VertexDataManager::cacheStreamedClientAttrib(const TranslatedAttribute &translated,
+                                                  StreamedClientAttrib *streamed)
+{
+    streamed->generation   = mStreamingBuffer.getGeneration();
+    streamed->streamOffset = translated.baseOffset;
+    streamed->streamStride = translated.stride;
+
+    mStreamedClientAttribs[mNextStreamedClientAttrib] = *streamed;
+    mNextStreamedClientAttrib = (mNextStreamedClientAttrib + 1) % kStreamedClientAttribCacheSize;
+}
+
 void VertexDataManager::PromoteDynamicAttribs(
     const gl::Context *context,
     const std::vector<TranslatedAttribute> &translatedAttribs,
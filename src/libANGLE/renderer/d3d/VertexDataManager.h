@@ -16,6 +16,8 @@
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/d3d/VertexBuffer.h"
 
+#include <array>
+
 namespace gl
 {
 class State;
@@ -139,6 +141,43 @@ class VertexDataManager : angle::NonCopyable
         size_t offset;
     };
 
+    // Client memory data that was streamed into mStreamingBuffer.  Identical data (by content
+    // hash) streamed with the same layout is not streamed again, as long as the streaming
+    // buffer hasn't been discarded since.
+    struct StreamedClientAttrib final
+    {
+        bool sameDataAndLayout(const StreamedClientAttrib &other) const;
+
+        uint64_t contentHash;
+        size_t contentSize;
+        angle::FormatID formatID;
+        gl::VertexAttribType currentValueType;
+        size_t stride;
+        GLuint divisor;
+        size_t count;
+        GLsizei instances;
+        uint64_t baseInstance;
+
+        unsigned int generation;
+        unsigned int streamOffset;
+        unsigned int streamStride;
+    };
+
+    static constexpr size_t kStreamedClientAttribCacheSize = 8;
+
+    static void InitStreamedClientAttrib(const TranslatedAttribute &translated,
+                                         GLint start,
+                                         size_t count,
+                                         GLsizei instances,
+                                         uint64_t baseInstance,
+                                         StreamedClientAttrib *streamedOut);
+    const StreamedClientAttrib *findStreamedClientAttrib(
+        const StreamedClientAttrib &streamed) const;
+    void reuseStreamedClientAttrib(const StreamedClientAttrib &streamed,
+                                   TranslatedAttribute *translated);
+    void cacheStreamedClientAttrib(const TranslatedAttribute &translated,
+                                   StreamedClientAttrib *streamed);
+
     angle::Result reserveSpaceForAttrib(const gl::Context *context,
                                         const TranslatedAttribute &translatedAttrib,
                                         GLint start,
@@ -158,6 +197,10 @@ class VertexDataManager : angle::NonCopyable
     StreamingVertexBufferInterface mStreamingBuffer;
     std::vector<CurrentValueState> mCurrentValueCache;
     gl::AttributesMask mDynamicAttribsMaskCache;
+
+    // Replaced round-robin.
+    std::array<StreamedClientAttrib, kStreamedClientAttribCacheSize> mStreamedClientAttribs;
+    size_t mNextStreamedClientAttrib;
 };
 
 }  // namespace rx
@@ -417,16 +417,14 @@ angle::Result Buffer11::setSubData(const gl::Context *context,
             {
                 BufferStorage *latestStorage = nullptr;
                 ANGLE_TRY(getLatestBufferStorage(context, &latestStorage, feedback));
-                if (latestStorage && (latestStorage->getUsage() == BUFFER_USAGE_STRUCTURED))
-                {
-                    ANGLE_TRY(
-                        getBufferStorage(context, BUFFER_USAGE_STRUCTURED, &writeBuffer, feedback));
-                }
-                else
-                {
-                    ANGLE_TRY(
-                        getBufferStorage(context, BUFFER_USAGE_UNIFORM, &writeBuffer, feedback));
-                }
+                const BufferUsage usage =
+                    latestStorage && (latestStorage->getUsage() == BUFFER_USAGE_STRUCTURED)
+                        ? BUFFER_USAGE_STRUCTURED
+                        : BUFFER_USAGE_UNIFORM;
+
+                // The whole buffer is replaced, so there is no need to bring the storage up to
+                // date first, which would copy the data from another storage through staging.
+                ANGLE_TRY(getBufferStorageForOverwrite(context, usage, &writeBuffer, feedback));
             }
             else
             {
@@ -840,6 +838,42 @@ angle::Result Buffer11::getBufferStorage(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+template <typename StorageOutT>
+angle::Result Buffer11::getBufferStorageForOverwrite(const gl::Context *context,
+                                                     BufferUsage usage,
+                                                     StorageOutT **storageOut,
+                                                     BufferFeedback *feedback)
+{
+    ASSERT(0 <= usage && usage < BUFFER_USAGE_COUNT);
+    BufferStorage *&newStorage = mBufferStorages[usage];
+
+    if (!newStorage)
+    {
+        newStorage = allocateStorage(usage);
+    }
+
+    markBufferUsage(usage);
+
+    if (newStorage->getSize() < mSize)
+    {
+        ANGLE_TRY(newStorage->resize(context, mSize, false, feedback));
+    }
+
+    // Skip the copy in updateBufferStorage(), but make sure the revision given to the storage once
+    // it's written is newer than any other storage's.
+    BufferStorage *latestBuffer = nullptr;
+    ANGLE_TRY(getLatestBufferStorage(context, &latestBuffer, feedback));
+    if (latestBuffer && latestBuffer->getDataRevision() > newStorage->getDataRevision())
+    {
+        newStorage->setDataRevision(latestBuffer->getDataRevision());
+    }
+
+    ANGLE_TRY(garbageCollection(context, usage));
+
+    *storageOut = GetAs<StorageOutT>(newStorage);
+    return angle::Result::Continue;
+}
+
 Buffer11::BufferStorage *Buffer11::allocateStorage(BufferUsage usage)
 {
     updateDeallocThreshold(usage);
@@ -191,6 +191,14 @@ class Buffer11 : public BufferD3D
                                    StorageOutT **storageOut,
                                    BufferFeedback *feedback);
 
+    // Like getBufferStorage, but doesn't copy the latest data into the storage because all of its
+    // contents are about to be overwritten.
+    template <typename StorageOutT>
+    angle::Result getBufferStorageForOverwrite(const gl::Context *context,
+                                               BufferUsage usage,
+                                               StorageOutT **storageOut,
+                                               BufferFeedback *feedback);
+
     template <typename StorageOutT>
     angle::Result getStagingStorage(const gl::Context *context, StorageOutT **storageOut);
 
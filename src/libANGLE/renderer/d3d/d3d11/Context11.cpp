@@ -129,7 +129,22 @@ Context11::Context11(const gl::State &state, gl::ErrorSet *errorSet, Renderer11
       mDisjointQueryStarted(false),
       mDisjoint(false),
       mFrequency(0)
-{}
+{
+    angle::PerfMonitorCounterGroupInfo d3d11GroupInfo;
+    angle::PerfMonitorCounterGroup d3d11Group;
+    d3d11GroupInfo.name = "d3d11";
+
+#define ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP(COUNTER) \
+    d3d11GroupInfo.counters.emplace_back(#COUNTER);   \
+    d3d11Group.counters.emplace_back(0);
+
+    ANGLE_D3D11_PERF_COUNTERS_X(ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP)
+
+#undef ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP
+
+    mPerfMonitorCountersInfo.emplace_back(std::move(d3d11GroupInfo));
+    mPerfMonitorCounters.emplace_back(std::move(d3d11Group));
+}
 
 Context11::~Context11() {}
 
@@ -268,6 +283,7 @@ OverlayImpl *Context11::createOverlay(const gl::OverlayState &state)
 
 angle::Result Context11::flush(const gl::Context *context)
 {
+    mRenderer->syncRenderStateCacheBlob(context);
     return mRenderer->flush(this);
 }
 
@@ -909,6 +925,7 @@ angle::Result Context11::onMakeCurrent(const gl::Context *context)
         return angle::Result::Continue;
     }
 
+    ANGLE_TRY(mRenderer->prewarmRenderStateCache(context));
     return mRenderer->getStateManager()->onMakeCurrent(context);
 }
 
@@ -1096,4 +1113,35 @@ void Context11::handleResult(HRESULT hr,
 
     mErrors->handleError(glErrorCode, errorStream.str().c_str(), file, function, line);
 }
+
+const angle::PerfMonitorCounterGroupsInfo &Context11::getPerfMonitorCountersInfo() const
+{
+    return mPerfMonitorCountersInfo;
+}
+
+const angle::PerfMonitorCounterGroups &Context11::getPerfMonitorCounters()
+{
+    ASSERT(mPerfMonitorCountersInfo.size() == 1);
+    ASSERT(mPerfMonitorCounters.size() == 1);
+
+    const angle::PerfMonitorCounterGroupInfo &info = mPerfMonitorCountersInfo[0];
+    angle::PerfMonitorCounters &counters           = mPerfMonitorCounters[0].counters;
+    const angle::D3D11PerfCounters &perfCounters   = mRenderer->getPerfCounters();
+
+    ASSERT(info.name == "d3d11");
+    ASSERT(info.counters.size() == counters.size());
+
+    uint32_t counterIndex = 0;
+
+#define ANGLE_UPDATE_PERF_MAP(COUNTER)                    \
+    ASSERT(info.counters.size() > counterIndex);          \
+    ASSERT(info.counters[counterIndex].name == #COUNTER); \
+    counters[counterIndex++].value = perfCounters.COUNTER;
+
+    ANGLE_D3D11_PERF_COUNTERS_X(ANGLE_UPDATE_PERF_MAP)
+
+#undef ANGLE_UPDATE_PERF_MAP
+
+    return mPerfMonitorCounters;
+}
 }  // namespace rx
@@ -268,6 +268,9 @@ class Context11 : public ContextD3D, public MultisampleTextureInitializer
                       const char *function,
                       unsigned int line) override;
 
+    const angle::PerfMonitorCounterGroupsInfo &getPerfMonitorCountersInfo() const override;
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+
     void setGPUDisjoint();
     angle::Result checkDisjointQuery();
     HRESULT checkDisjointQueryStatus();
@@ -294,6 +297,9 @@ class Context11 : public ContextD3D, public MultisampleTextureInitializer
     bool mDisjointQueryStarted;
     bool mDisjoint;
     UINT64 mFrequency;
+
+    angle::PerfMonitorCounterGroupsInfo mPerfMonitorCountersInfo;
+    angle::PerfMonitorCounterGroups mPerfMonitorCounters;
 };
 }  // namespace rx
 
@@ -198,7 +198,7 @@ angle::Result Image11::recoverFromAssociatedStorage(const gl::Context *context)
         storage->verifyAssociatedImageValid(imageIndex, this);
         disassociateStorage();
 
-        ANGLE_TRY(createStagingTexture(context));
+        ANGLE_TRY(createStagingTexture(context, true));
 
         // CopySubResource from the Storage to the Staging texture
         gl::Box region(0, 0, 0, mWidth, mHeight, mDepth);
@@ -300,6 +300,14 @@ angle::Result Image11::loadData(const gl::Context *context,
         d3d11::Format::Get(mInternalFormat, mRenderer->getRenderer11DeviceCaps());
     LoadImageFunction loadFunction = d3dFormatInfo.getLoadFunctions()(type).loadFunction;
 
+    // When the whole image is replaced, its previous contents don't need to be read back from the
+    // associated storage, nor the staging texture initialized.
+    if (isFullImageArea(area))
+    {
+        disassociateStorage();
+        ANGLE_TRY(createStagingTexture(context, true));
+    }
+
     D3D11_MAPPED_SUBRESOURCE mappedImage;
     ANGLE_TRY(map(context, D3D11_MAP_WRITE, &mappedImage));
 
@@ -342,6 +350,14 @@ angle::Result Image11::loadCompressedData(const gl::Context *context,
     LoadImageFunction loadFunction =
         d3dFormatInfo.getLoadFunctions()(GL_UNSIGNED_BYTE).loadFunction;
 
+    // When the whole image is replaced, its previous contents don't need to be read back from the
+    // associated storage, nor the staging texture initialized.
+    if (isFullImageArea(area))
+    {
+        disassociateStorage();
+        ANGLE_TRY(createStagingTexture(context, true));
+    }
+
     D3D11_MAPPED_SUBRESOURCE mappedImage;
     ANGLE_TRY(map(context, D3D11_MAP_WRITE, &mappedImage));
 
@@ -528,7 +544,7 @@ angle::Result Image11::getStagingTexture(const gl::Context *context,
                                          const TextureHelper11 **outStagingTexture,
                                          unsigned int *outSubresourceIndex)
 {
-    ANGLE_TRY(createStagingTexture(context));
+    ANGLE_TRY(createStagingTexture(context, false));
 
     *outStagingTexture   = &mStagingTexture;
     *outSubresourceIndex = mStagingSubresource;
@@ -537,10 +553,20 @@ angle::Result Image11::getStagingTexture(const gl::Context *context,
 
 void Image11::releaseStagingTexture()
 {
+    if (mStagingTexture.valid())
+    {
+        mRenderer->recycleImageStagingTexture(std::move(mStagingTexture));
+    }
     mStagingTexture.reset();
 }
 
-angle::Result Image11::createStagingTexture(const gl::Context *context)
+bool Image11::isFullImageArea(const gl::Box &area) const
+{
+    return area.x == 0 && area.y == 0 && area.z == 0 && area.width == mWidth &&
+           area.height == mHeight && area.depth == mDepth;
+}
+
+angle::Result Image11::createStagingTexture(const gl::Context *context, bool overwriteContents)
 {
     if (mStagingTexture.valid())
     {
@@ -562,6 +588,20 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
 
     Context11 *context11 = GetImplAs<Context11>(context);
 
+    if (overwriteContents)
+    {
+        const bool is3D = mType == gl::TextureType::_3D;
+        const gl::Extents size(width, height, is3D ? mDepth : 1);
+        if (mRenderer->takeRecycledImageStagingTexture(
+                is3D ? ResourceType::Texture3D : ResourceType::Texture2D, formatInfo, size,
+                &mStagingTexture))
+        {
+            mStagingSubresource = D3D11CalcSubresource(lodOffset, 0, lodOffset + 1);
+            mDirty              = false;
+            return angle::Result::Continue;
+        }
+    }
+
     switch (mType)
     {
         case gl::TextureType::_3D:
@@ -577,7 +617,7 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
             desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ | D3D11_CPU_ACCESS_WRITE;
             desc.MiscFlags      = 0;
 
-            if (formatInfo.dataInitializerFunction != nullptr)
+            if (formatInfo.dataInitializerFunction != nullptr && !overwriteContents)
             {
                 gl::TexLevelArray<D3D11_SUBRESOURCE_DATA> initialData;
                 ANGLE_TRY(d3d11::GenerateInitialTextureData(
@@ -615,7 +655,7 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
             desc.CPUAccessFlags     = D3D11_CPU_ACCESS_READ | D3D11_CPU_ACCESS_WRITE;
             desc.MiscFlags          = 0;
 
-            if (formatInfo.dataInitializerFunction != nullptr)
+            if (formatInfo.dataInitializerFunction != nullptr && !overwriteContents)
             {
                 gl::TexLevelArray<D3D11_SUBRESOURCE_DATA> initialData;
                 ANGLE_TRY(d3d11::GenerateInitialTextureData(
@@ -106,9 +106,13 @@ class Image11 : public ImageD3D
                                         const TextureHelper11 &textureHelper,
                                         UINT sourceSubResource);
 
-    angle::Result createStagingTexture(const gl::Context *context);
+    // If |overwriteContents| is true, the caller replaces the whole image, so the staging texture
+    // doesn't need to be initialized and may be a recycled one.
+    angle::Result createStagingTexture(const gl::Context *context, bool overwriteContents);
     void releaseStagingTexture();
 
+    bool isFullImageArea(const gl::Box &area) const;
+
     Renderer11 *mRenderer;
 
     DXGI_FORMAT mDXGIFormat;
@@ -149,13 +149,17 @@ angle::Result InputLayoutCache::getInputLayout(
 
     if (layout.numAttributes > 0)
     {
+        angle::D3D11PerfCounters &perfCounters = context11->getRenderer()->getPerfCounters();
+
         auto it = mLayoutCache.Get(layout);
         if (it != mLayoutCache.end())
         {
+            perfCounters.inputLayoutCacheHits++;
             *inputLayoutOut = &it->second;
         }
         else
         {
+            perfCounters.inputLayoutCacheMisses++;
             angle::TrimCache(mLayoutCache.max_size() / 2, kGCLimit, "input layout", &mLayoutCache);
 
             d3d11::InputLayout newInputLayout;
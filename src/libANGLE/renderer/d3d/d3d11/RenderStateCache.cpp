@@ -29,11 +29,44 @@ namespace rx
 {
 using namespace gl_d3d11;
 
+namespace
+{
+template <typename CacheT>
+void SerializeCacheKeys(const CacheT &cache, gl::BinaryOutputStream *stream)
+{
+    stream->writeInt(cache.size());
+    for (const auto &keyAndState : cache)
+    {
+        stream->writeBytes(angle::byte_span_from_ref(keyAndState.first));
+    }
+}
+
+template <typename KeyT>
+bool DeserializeCacheKeys(gl::BinaryInputStream *stream,
+                          size_t maxCount,
+                          std::vector<KeyT> *keysOut)
+{
+    const size_t count = stream->readInt<size_t>();
+    if (stream->error() || count > maxCount)
+    {
+        return false;
+    }
+
+    keysOut->resize(count);
+    for (KeyT &key : *keysOut)
+    {
+        stream->readBytes(angle::byte_span_from_ref(key));
+    }
+    return !stream->error();
+}
+}  // anonymous namespace
+
 RenderStateCache::RenderStateCache()
     : mBlendStateCache(kMaxStates),
       mRasterizerStateCache(kMaxStates),
       mDepthStencilStateCache(kMaxStates),
-      mSamplerStateCache(kMaxStates)
+      mSamplerStateCache(kMaxStates),
+      mHasNewStates(false)
 {}
 
 RenderStateCache::~RenderStateCache() {}
@@ -142,10 +175,20 @@ angle::Result RenderStateCache::getBlendState(const gl::Context *context,
     auto keyIter = mBlendStateCache.Get(key);
     if (keyIter != mBlendStateCache.end())
     {
+        renderer->getPerfCounters().blendStateCacheHits++;
         *outBlendState = &keyIter->second;
         return angle::Result::Continue;
     }
 
+    renderer->getPerfCounters().blendStateCacheMisses++;
+    return createBlendState(context, renderer, key, outBlendState);
+}
+
+angle::Result RenderStateCache::createBlendState(const gl::Context *context,
+                                                 Renderer11 *renderer,
+                                                 const d3d11::BlendStateKey &key,
+                                                 const d3d11::BlendState **outBlendState)
+{
     TrimCache(kMaxStates, kGCLimit, "blend state", &mBlendStateCache);
 
     // Create a new blend state and insert it into the cache
@@ -187,6 +230,7 @@ angle::Result RenderStateCache::getBlendState(const gl::Context *context,
     d3d11::BlendState d3dBlendState;
     ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context), blendDesc, &d3dBlendState));
     const auto &iter = mBlendStateCache.Put(key, std::move(d3dBlendState));
+    mHasNewStates    = true;
 
     *outBlendState = &iter->second;
 
@@ -206,12 +250,25 @@ angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
     auto keyIter = mRasterizerStateCache.Get(key);
     if (keyIter != mRasterizerStateCache.end())
     {
+        renderer->getPerfCounters().rasterizerStateCacheHits++;
         *outRasterizerState = keyIter->second.get();
         return angle::Result::Continue;
     }
 
+    renderer->getPerfCounters().rasterizerStateCacheMisses++;
+    return createRasterizerState(context, renderer, key, outRasterizerState);
+}
+
+angle::Result RenderStateCache::createRasterizerState(const gl::Context *context,
+                                                      Renderer11 *renderer,
+                                                      const d3d11::RasterizerStateKey &key,
+                                                      ID3D11RasterizerState **outRasterizerState)
+{
     TrimCache(kMaxStates, kGCLimit, "rasterizer state", &mRasterizerStateCache);
 
+    const gl::RasterizerState &rasterState = key.rasterizerState;
+    const bool scissorEnabled              = key.scissorEnabled != 0;
+
     D3D11_CULL_MODE cullMode =
         gl_d3d11::ConvertCullMode(rasterState.cullFace, rasterState.cullMode);
 
@@ -249,6 +306,7 @@ angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
                                          &dx11RasterizerState));
     *outRasterizerState = dx11RasterizerState.get();
     mRasterizerStateCache.Put(key, std::move(dx11RasterizerState));
+    mHasNewStates = true;
 
     return angle::Result::Continue;
 }
@@ -261,10 +319,21 @@ angle::Result RenderStateCache::getDepthStencilState(const gl::Context *context,
     auto keyIter = mDepthStencilStateCache.Get(glState);
     if (keyIter != mDepthStencilStateCache.end())
     {
+        renderer->getPerfCounters().depthStencilStateCacheHits++;
         *outDSState = &keyIter->second;
         return angle::Result::Continue;
     }
 
+    renderer->getPerfCounters().depthStencilStateCacheMisses++;
+    return createDepthStencilState(context, renderer, glState, outDSState);
+}
+
+angle::Result RenderStateCache::createDepthStencilState(
+    const gl::Context *context,
+    Renderer11 *renderer,
+    const gl::DepthStencilState &glState,
+    const d3d11::DepthStencilState **outDSState)
+{
     TrimCache(kMaxStates, kGCLimit, "depth stencil state", &mDepthStencilStateCache);
 
     D3D11_DEPTH_STENCIL_DESC dsDesc     = {};
@@ -287,6 +356,7 @@ angle::Result RenderStateCache::getDepthStencilState(const gl::Context *context,
     ANGLE_TRY(
         renderer->allocateResource(GetImplAs<Context11>(context), dsDesc, &dx11DepthStencilState));
     const auto &iter = mDepthStencilStateCache.Put(glState, std::move(dx11DepthStencilState));
+    mHasNewStates    = true;
 
     *outDSState = &iter->second;
 
@@ -301,10 +371,20 @@ angle::Result RenderStateCache::getSamplerState(const gl::Context *context,
     auto keyIter = mSamplerStateCache.Get(samplerState);
     if (keyIter != mSamplerStateCache.end())
     {
+        renderer->getPerfCounters().samplerStateCacheHits++;
         *outSamplerState = keyIter->second.get();
         return angle::Result::Continue;
     }
 
+    renderer->getPerfCounters().samplerStateCacheMisses++;
+    return createSamplerState(context, renderer, samplerState, outSamplerState);
+}
+
+angle::Result RenderStateCache::createSamplerState(const gl::Context *context,
+                                                   Renderer11 *renderer,
+                                                   const gl::SamplerState &samplerState,
+                                                   ID3D11SamplerState **outSamplerState)
+{
     TrimCache(kMaxStates, kGCLimit, "sampler state", &mSamplerStateCache);
 
     const auto &featureLevel = renderer->getRenderer11DeviceCaps().featureLevel;
@@ -332,7 +412,81 @@ angle::Result RenderStateCache::getSamplerState(const gl::Context *context,
         renderer->allocateResource(GetImplAs<Context11>(context), samplerDesc, &dx11SamplerState));
     *outSamplerState = dx11SamplerState.get();
     mSamplerStateCache.Put(samplerState, std::move(dx11SamplerState));
+    mHasNewStates = true;
+
+    return angle::Result::Continue;
+}
+
+void RenderStateCache::serializeKeys(gl::BinaryOutputStream *stream)
+{
+    SerializeCacheKeys(mBlendStateCache, stream);
+    SerializeCacheKeys(mRasterizerStateCache, stream);
+    SerializeCacheKeys(mDepthStencilStateCache, stream);
+    SerializeCacheKeys(mSamplerStateCache, stream);
+    mHasNewStates = false;
+}
+
+angle::Result RenderStateCache::prewarm(const gl::Context *context,
+                                        Renderer11 *renderer,
+                                        angle::Span<const uint8_t> serializedKeys,
+                                        size_t *createdCountOut)
+{
+    gl::BinaryInputStream stream(serializedKeys);
+    std::vector<d3d11::BlendStateKey> blendKeys;
+    std::vector<d3d11::RasterizerStateKey> rasterizerKeys;
+    std::vector<gl::DepthStencilState> depthStencilKeys;
+    std::vector<gl::SamplerState> samplerKeys;
+    if (!DeserializeCacheKeys(&stream, kMaxStates, &blendKeys) ||
+        !DeserializeCacheKeys(&stream, kMaxStates, &rasterizerKeys) ||
+        !DeserializeCacheKeys(&stream, kMaxStates, &depthStencilKeys) ||
+        !DeserializeCacheKeys(&stream, kMaxStates, &samplerKeys) || !stream.endOfStream())
+    {
+        WARN() << "Ignoring malformed D3D11 render state cache entry.";
+        return angle::Result::Continue;
+    }
+
+    // Prewarming only recreates states that were stored before, so it doesn't by itself make the
+    // stored keys stale.
+    const bool hadNewStates = mHasNewStates;
+
+    for (const d3d11::BlendStateKey &key : blendKeys)
+    {
+        if (mBlendStateCache.Peek(key) == mBlendStateCache.end())
+        {
+            const d3d11::BlendState *blendState = nullptr;
+            ANGLE_TRY(createBlendState(context, renderer, key, &blendState));
+            (*createdCountOut)++;
+        }
+    }
+    for (const d3d11::RasterizerStateKey &key : rasterizerKeys)
+    {
+        if (mRasterizerStateCache.Peek(key) == mRasterizerStateCache.end())
+        {
+            ID3D11RasterizerState *rasterizerState = nullptr;
+            ANGLE_TRY(createRasterizerState(context, renderer, key, &rasterizerState));
+            (*createdCountOut)++;
+        }
+    }
+    for (const gl::DepthStencilState &key : depthStencilKeys)
+    {
+        if (mDepthStencilStateCache.Peek(key) == mDepthStencilStateCache.end())
+        {
+            const d3d11::DepthStencilState *depthStencilState = nullptr;
+            ANGLE_TRY(createDepthStencilState(context, renderer, key, &depthStencilState));
+            (*createdCountOut)++;
+        }
+    }
+    for (const gl::SamplerState &key : samplerKeys)
+    {
+        if (mSamplerStateCache.Peek(key) == mSamplerStateCache.end())
+        {
+            ID3D11SamplerState *samplerState = nullptr;
+            ANGLE_TRY(createSamplerState(context, renderer, key, &samplerState));
+            (*createdCountOut)++;
+        }
+    }
 
+    mHasNewStates = hadNewStates;
     return angle::Result::Continue;
 }
 
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_D3D_D3D11_RENDERSTATECACHE_H_
 #define LIBANGLE_RENDERER_D3D_D3D11_RENDERSTATECACHE_H_
 
+#include "common/BinaryStream.h"
 #include "common/angleutils.h"
 #include "common/span.h"
 #include "libANGLE/Error.h"
@@ -93,7 +94,36 @@ class RenderStateCache : angle::NonCopyable
                                   const gl::SamplerState &samplerState,
                                   ID3D11SamplerState **outSamplerState);
 
+    // Whether states were created since the last call to serializeKeys().
+    bool hasNewStates() const { return mHasNewStates; }
+
+    // Serialize the keys of all cached states so that a later run can create them up front with
+    // prewarm() instead of at first use.
+    void serializeKeys(gl::BinaryOutputStream *stream);
+    // Create the states whose keys were produced by serializeKeys().  Malformed data is ignored.
+    angle::Result prewarm(const gl::Context *context,
+                          Renderer11 *renderer,
+                          angle::Span<const uint8_t> serializedKeys,
+                          size_t *createdCountOut);
+
   private:
+    angle::Result createBlendState(const gl::Context *context,
+                                   Renderer11 *renderer,
+                                   const d3d11::BlendStateKey &key,
+                                   const d3d11::BlendState **outBlendState);
+    angle::Result createRasterizerState(const gl::Context *context,
+                                        Renderer11 *renderer,
+                                        const d3d11::RasterizerStateKey &key,
+                                        ID3D11RasterizerState **outRasterizerState);
+    angle::Result createDepthStencilState(const gl::Context *context,
+                                          Renderer11 *renderer,
+                                          const gl::DepthStencilState &glState,
+                                          const d3d11::DepthStencilState **outDSState);
+    angle::Result createSamplerState(const gl::Context *context,
+                                     Renderer11 *renderer,
+                                     const gl::SamplerState &samplerState,
+                                     ID3D11SamplerState **outSamplerState);
+
     // MSDN's documentation of ID3D11Device::CreateBlendState, ID3D11Device::CreateRasterizerState,
     // ID3D11Device::CreateDepthStencilState and ID3D11Device::CreateSamplerState claims the maximum
     // number of unique states of each type an application can create is 4096
@@ -121,6 +151,8 @@ class RenderStateCache : angle::NonCopyable
     // Sample state cache
     using SamplerStateMap = angle::base::HashingMRUCache<gl::SamplerState, d3d11::SamplerState>;
     SamplerStateMap mSamplerStateCache;
+
+    bool mHasNewStates;
 };
 
 }  // namespace rx
@@ -16,7 +16,9 @@
 #include <sstream>
 
 #include "anglebase/no_destructor.h"
+#include "common/BinaryStream.h"
 #include "common/SimpleMutex.h"
+#include "common/angle_version_info.h"
 #include "common/debug.h"
 #include "common/tls.h"
 #include "common/utilities.h"
@@ -391,6 +393,48 @@ angle::Result GetTextureD3DResourceFromStorageOrImage(const gl::Context *context
     return angle::Result::Continue;
 }
 
+// Bumped whenever the layout of the serialized render state keys changes.
+constexpr uint32_t kRenderStateCacheBlobVersion = 1;
+
+// Compiled shaders larger than this are not stored in the blob cache.
+constexpr size_t kMaxCachedHLSLBinarySize = 4 * 1024 * 1024;
+
+egl::BlobCache::Key ComputeHLSLBinaryKey(const std::string &shaderHLSL,
+                                         const std::string &profile,
+                                         UINT flags)
+{
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    const char *hlslBinaryName = "ANGLE D3D11 HLSL Binary: ";
+    hasher.Update(hlslBinaryName, strlen(hlslBinaryName));
+
+    // The HLSL compiler is shipped alongside ANGLE, so the ANGLE version identifies it too.
+    const char *angleVersion = angle::GetANGLEShaderProgramVersion();
+    hasher.Update(angleVersion, strlen(angleVersion));
+    hasher.Update(profile.c_str(), profile.size());
+    angle::UpdateHashWithValue(hasher, flags);
+    hasher.Update(shaderHLSL.c_str(), shaderHLSL.size());
+
+    hasher.Final();
+    egl::BlobCache::Key key;
+    memcpy(key.data(), hasher.Digest(), angle::kBlobCacheKeyLength);
+    return key;
+}
+
+// The memory kept in recycled Image11 staging textures is limited to this.
+constexpr size_t kMaxRecycledImageStagingTexturesSize = 64 * 1024 * 1024;
+
+size_t GetStagingTextureSize(const TextureHelper11 &texture)
+{
+    const d3d11::DXGIFormatSize &dxgiFormatInfo = d3d11::GetDXGIFormatSizeInfo(texture.getFormat());
+    const gl::Extents &extents                  = texture.getExtents();
+    const size_t blocksWide =
+        UnsignedCeilDivide(static_cast<unsigned int>(extents.width), dxgiFormatInfo.blockWidth);
+    const size_t blocksHigh =
+        UnsignedCeilDivide(static_cast<unsigned int>(extents.height), dxgiFormatInfo.blockHeight);
+    return blocksWide * blocksHigh * extents.depth * dxgiFormatInfo.pixelBytes;
+}
 }  // anonymous namespace
 
 Renderer11DeviceCaps::Renderer11DeviceCaps() = default;
@@ -399,8 +443,11 @@ Renderer11::Renderer11(egl::Display *display)
     : RendererD3D(display),
       mCreateDebugDevice(false),
       mStateCache(),
+      mRenderStateCachePrewarmed(false),
       mStateManager(this),
-      mDebug(nullptr)
+      mDebug(nullptr),
+      mRecycledImageStagingTexturesSize(0),
+      mPerfCounters{}
 {
     mLineLoopIB    = nullptr;
     mTriangleFanIB = nullptr;
@@ -423,6 +470,8 @@ Renderer11::Renderer11(egl::Display *display)
     mRenderer11DeviceCaps.B4G4R4A4support                        = 0;
     mRenderer11DeviceCaps.B5G5R5A1support                        = 0;
 
+    mRenderer11DeviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffer = false;
+
     mD3d11Module          = nullptr;
     mD3d12Module          = nullptr;
     mDCompModule          = nullptr;
@@ -1103,6 +1152,8 @@ void Renderer11::populateRenderer11DeviceCaps()
             mRenderer11DeviceCaps.supportsClearView = (d3d11Options.ClearView != FALSE);
             mRenderer11DeviceCaps.supportsConstantBufferOffsets =
                 (d3d11Options.ConstantBufferOffsetting != FALSE);
+            mRenderer11DeviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffer =
+                (d3d11Options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
         }
     }
 
@@ -1391,6 +1442,11 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
     outExtensions->noConfigContext   = true;
     outExtensions->directComposition = !!mDCompModule;
 
+#if !defined(ANGLE_ENABLE_WINDOWS_UWP)
+    // Win32 windows use a flip model swap chain with a frame latency waitable object.
+    outExtensions->surfaceLowLatencyANGLE = true;
+#endif
+
     // Contexts are virtualized so textures and semaphores can be shared globally
     outExtensions->displayTextureShareGroup   = true;
     outExtensions->displaySemaphoreShareGroup = true;
@@ -1503,7 +1559,8 @@ NativeWindowD3D *Renderer11::createNativeWindow(EGLNativeWindowType window,
     {
         return new NativeWindow11Win32(
             window, config->alphaSize > 0,
-            attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE);
+            attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE,
+            attribs.get(EGL_SURFACE_LOW_LATENCY_ANGLE, EGL_FALSE) == EGL_TRUE);
     }
 #endif
 
@@ -2001,16 +2058,35 @@ angle::Result Renderer11::drawLineLoop(const gl::Context *context,
 
     const void *indices = indexPointer;
 
+    // Line loops drawn from static index buffers are translated only once.
+    BufferD3D *storage                       = nullptr;
+    StaticIndexBufferInterface *staticBuffer = nullptr;
+    const bool primitiveRestart              = glState.isPrimitiveRestartEnabled();
+    const unsigned int indexOffset =
+        static_cast<unsigned int>(reinterpret_cast<uintptr_t>(indexPointer));
+
     // Get the raw indices for an indexed draw
     if (type != gl::DrawElementsType::InvalidEnum && elementArrayBuffer)
     {
-        BufferD3D *storage = GetImplAs<BufferD3D>(elementArrayBuffer);
-        intptr_t offset    = reinterpret_cast<intptr_t>(indices);
+        storage      = GetImplAs<BufferD3D>(elementArrayBuffer);
+        staticBuffer = storage->getStaticIndexBuffer();
+
+        if (staticBuffer != nullptr)
+        {
+            const StaticIndexBufferInterface::LineLoopRange *range =
+                staticBuffer->getLineLoopRange(indexOffset, count, type, primitiveRestart);
+            if (range != nullptr)
+            {
+                return drawLineLoopIndices(
+                    context, GetAs<IndexBuffer11>(range->indices->getIndexBuffer()), 0,
+                    range->indexCount, baseVertex, instances);
+            }
+        }
 
         const uint8_t *bufferData = nullptr;
         ANGLE_TRY(storage->getData(context, &bufferData));
 
-        indices = bufferData + offset;
+        indices = bufferData + indexOffset;
     }
 
     if (!mLineLoopIB)
@@ -2028,13 +2104,35 @@ angle::Result Renderer11::drawLineLoop(const gl::Context *context,
                 "GL_LINE_LOOP, too many indices required.",
                 GL_OUT_OF_MEMORY);
 
-    GetLineLoopIndices(indices, type, static_cast<GLuint>(count),
-                       glState.isPrimitiveRestartEnabled(), &mScratchIndexDataBuffer);
+    GetLineLoopIndices(indices, type, static_cast<GLuint>(count), primitiveRestart,
+                       &mScratchIndexDataBuffer);
     if (ANGLE_UNLIKELY(mScratchIndexDataBuffer.empty()))
     {
         return angle::Result::Continue;
     }
 
+    if (staticBuffer != nullptr)
+    {
+        const StaticIndexBufferInterface::LineLoopRange *range = nullptr;
+        ANGLE_TRY(staticBuffer->cacheLineLoopRange(context, indexOffset, count, type,
+                                                   primitiveRestart, mScratchIndexDataBuffer,
+                                                   &range));
+        if (range != nullptr)
+        {
+            return drawLineLoopIndices(context,
+                                       GetAs<IndexBuffer11>(range->indices->getIndexBuffer()), 0,
+                                       range->indexCount, baseVertex, instances);
+        }
+    }
+    else if (storage != nullptr)
+    {
+        // Like IndexDataManager, let buffers that are drawn from without modification become
+        // static.
+        BufferFeedback feedback;
+        storage->promoteStaticUsage(context, count * gl::GetDrawElementsTypeSize(type), &feedback);
+        elementArrayBuffer->applyImplFeedback(context, feedback);
+    }
+
     uint64_t spaceNeeded64 = sizeof(GLuint) * mScratchIndexDataBuffer.size();
     ANGLE_CHECK(GetImplAs<Context11>(context), spaceNeeded64 <= std::numeric_limits<int>::max(),
                 "Failed to create a 32-bit looping index buffer for "
@@ -2055,14 +2153,23 @@ angle::Result Renderer11::drawLineLoop(const gl::Context *context,
 
     ANGLE_TRY(mLineLoopIB->unmapBuffer(context));
 
-    IndexBuffer11 *indexBuffer          = GetAs<IndexBuffer11>(mLineLoopIB->getIndexBuffer());
+    return drawLineLoopIndices(context, GetAs<IndexBuffer11>(mLineLoopIB->getIndexBuffer()),
+                               offset, static_cast<UINT>(mScratchIndexDataBuffer.size()),
+                               baseVertex, instances);
+}
+
+angle::Result Renderer11::drawLineLoopIndices(const gl::Context *context,
+                                              IndexBuffer11 *indexBuffer,
+                                              unsigned int offset,
+                                              UINT indexCount,
+                                              int baseVertex,
+                                              int instances)
+{
     const d3d11::Buffer &d3dIndexBuffer = indexBuffer->getBuffer();
     DXGI_FORMAT indexFormat             = indexBuffer->getIndexFormat();
 
     mStateManager.setIndexBuffer(d3dIndexBuffer.get(), indexFormat, offset);
 
-    UINT indexCount = static_cast<UINT>(mScratchIndexDataBuffer.size());
-
     if (instances > 0)
     {
         // D3D11 requires that indexCount * instances fits in 32 bits.
@@ -2175,6 +2282,7 @@ void Renderer11::releaseDeviceResources()
 {
     mStateManager.deinitialize();
     mStateCache.clear();
+    mRenderStateCachePrewarmed = false;
 
     SafeDelete(mLineLoopIB);
     SafeDelete(mTriangleFanIB);
@@ -2186,6 +2294,9 @@ void Renderer11::releaseDeviceResources()
     mSyncQuery.reset();
 
     mCachedResolveTexture.reset();
+
+    mRecycledImageStagingTextures.clear();
+    mRecycledImageStagingTexturesSize = 0;
 }
 
 // set notify to true to broadcast a message to all contexts of the device loss
@@ -3105,6 +3216,31 @@ angle::Result Renderer11::compileToExecutable(d3d::Context *context,
     configs.push_back(CompileConfig(flags | D3DCOMPILE_SKIP_VALIDATION, "skip validation"));
     configs.push_back(CompileConfig(flags | D3DCOMPILE_SKIP_OPTIMIZATION, "skip optimization"));
 
+    // This may run on a link task's worker thread, so the scratch buffer is not shared.  The blob
+    // cache itself is thread-safe.
+    const bool cacheBinary = getFeatures().cacheCompiledHlsl.enabled;
+    egl::BlobCache::Key binaryKey;
+    if (cacheBinary)
+    {
+        binaryKey = ComputeHLSLBinaryKey(shaderHLSL, profile, flags);
+
+        angle::ScratchBuffer scratchBuffer;
+        angle::MemoryBuffer cachedBinary;
+        egl::BlobCache &blobCache = mDisplay->getBlobCache();
+        switch (blobCache.getAndDecompress(nullptr, &scratchBuffer, binaryKey,
+                                           kMaxCachedHLSLBinarySize, &cachedBinary))
+        {
+            case egl::BlobCache::GetAndDecompressResult::Success:
+                return loadExecutable(context, cachedBinary.data(), cachedBinary.size(), type,
+                                      streamOutVaryings, separatedOutputBuffers, outExectuable);
+            case egl::BlobCache::GetAndDecompressResult::DecompressFailure:
+                blobCache.remove(binaryKey);
+                break;
+            case egl::BlobCache::GetAndDecompressResult::NotFound:
+                break;
+        }
+    }
+
     D3D_SHADER_MACRO loopMacros[] = {{"ANGLE_ENABLE_LOOP_FLATTEN", "1"}, {0, 0}};
 
     angle::ComPtr<ID3DBlob> binary;
@@ -3121,6 +3257,21 @@ angle::Result Renderer11::compileToExecutable(d3d::Context *context,
         return angle::Result::Continue;
     }
 
+    if (cacheBinary && binary->GetBufferSize() <= kMaxCachedHLSLBinarySize)
+    {
+        angle::MemoryBuffer binaryCopy;
+        if (binaryCopy.resize(binary->GetBufferSize()))
+        {
+            memcpy(binaryCopy.data(), binary->GetBufferPointer(), binary->GetBufferSize());
+            size_t compressedSize;
+            if (!mDisplay->getBlobCache().compressAndPut(nullptr, binaryKey, std::move(binaryCopy),
+                                                         &compressedSize))
+            {
+                WARN() << "Error compressing HLSL binary for insertion into the blob cache.";
+            }
+        }
+    }
+
     angle::Result error = loadExecutable(
         context, static_cast<const uint8_t *>(binary->GetBufferPointer()), binary->GetBufferSize(),
         type, streamOutVaryings, separatedOutputBuffers, outExectuable);
@@ -3888,6 +4039,83 @@ RendererClass Renderer11::getRendererClass() const
     return RENDERER_D3D11;
 }
 
+angle::Result Renderer11::prewarmRenderStateCache(const gl::Context *context)
+{
+    if (mRenderStateCachePrewarmed || !getFeatures().warmUpRenderStateCache.enabled)
+    {
+        return angle::Result::Continue;
+    }
+    mRenderStateCachePrewarmed = true;
+
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    const char *renderStatesName = "ANGLE D3D11 Render States: ";
+    hasher.Update(renderStatesName, strlen(renderStatesName));
+
+    // The state keys are stored as is, so the list is only valid for the same ANGLE version and
+    // the same adapter.
+    const char *angleVersion = angle::GetANGLEShaderProgramVersion();
+    hasher.Update(angleVersion, strlen(angleVersion));
+    angle::UpdateHashWithValue(hasher, mAdapterDescription.VendorId);
+    angle::UpdateHashWithValue(hasher, mAdapterDescription.DeviceId);
+    angle::UpdateHashWithValue(hasher, mAdapterDescription.SubSysId);
+    angle::UpdateHashWithValue(hasher, mAdapterDescription.Revision);
+
+    hasher.Final();
+    memcpy(mRenderStateCacheBlobKey.data(), hasher.Digest(), angle::kBlobCacheKeyLength);
+
+    angle::ScratchBuffer scratchBuffer;
+    egl::BlobCache::Value blob;
+    if (!mDisplay->getBlobCache().get(context, &scratchBuffer, mRenderStateCacheBlobKey, &blob))
+    {
+        return angle::Result::Continue;
+    }
+
+    gl::BinaryInputStream stream(angle::Span<const uint8_t>(blob.data(), blob.size()));
+    const uint32_t version = stream.readInt<uint32_t>();
+    if (stream.error() || version != kRenderStateCacheBlobVersion)
+    {
+        return angle::Result::Continue;
+    }
+
+    size_t createdCount = 0;
+    ANGLE_TRY(mStateCache.prewarm(context, this,
+                                  angle::Span<const uint8_t>(blob.data() + sizeof(version),
+                                                             blob.size() - sizeof(version)),
+                                  &createdCount));
+    mPerfCounters.prewarmedRenderStates += createdCount;
+    return angle::Result::Continue;
+}
+
+void Renderer11::syncRenderStateCacheBlob(const gl::Context *context)
+{
+    if (!mRenderStateCachePrewarmed || !mStateCache.hasNewStates())
+    {
+        return;
+    }
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(kRenderStateCacheBlobVersion);
+    mStateCache.serializeKeys(&stream);
+
+    angle::MemoryBuffer blob;
+    if (!blob.resize(stream.size()))
+    {
+        return;
+    }
+    memcpy(blob.data(), stream.data(), stream.size());
+    mDisplay->getBlobCache().putApplication(context, mRenderStateCacheBlobKey, blob);
+}
+
+void Renderer11::resetRenderStateCacheForTesting()
+{
+    // The state manager only holds on to the states it is given while applying them, and the
+    // device context keeps its own reference to the bound ones.
+    mStateCache.clear();
+    mRenderStateCachePrewarmed = false;
+}
+
 void Renderer11::onBufferCreate(const Buffer11 *created)
 {
     mAliveBuffers.insert(created);
@@ -4081,6 +4309,57 @@ DebugAnnotatorContext11 *Renderer11::getDebugAnnotatorContext()
     return &mAnnotatorContext;
 }
 
+bool Renderer11::takeRecycledImageStagingTexture(ResourceType textureType,
+                                                 const d3d11::Format &formatSet,
+                                                 const gl::Extents &size,
+                                                 TextureHelper11 *textureOut)
+{
+    for (auto iter = mRecycledImageStagingTextures.begin();
+         iter != mRecycledImageStagingTextures.end(); ++iter)
+    {
+        if (iter->getTextureType() == textureType && &iter->getFormatSet() == &formatSet &&
+            iter->getExtents() == size)
+        {
+            mRecycledImageStagingTexturesSize -= GetStagingTextureSize(*iter);
+            *textureOut = std::move(*iter);
+            mRecycledImageStagingTextures.erase(iter);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Renderer11::recycleImageStagingTexture(TextureHelper11 &&texture)
+{
+    ASSERT(texture.valid());
+
+    // Textures of a device that has since been reset can't be reused.
+    angle::ComPtr<ID3D11Device> device;
+    texture.get()->GetDevice(&device);
+    if (device.Get() != mDevice.Get())
+    {
+        return;
+    }
+
+    const size_t textureSize = GetStagingTextureSize(texture);
+    if (textureSize > kMaxRecycledImageStagingTexturesSize)
+    {
+        return;
+    }
+
+    // Keep the most recently recycled textures within the budget.
+    while (mRecycledImageStagingTexturesSize + textureSize > kMaxRecycledImageStagingTexturesSize)
+    {
+        mRecycledImageStagingTexturesSize -=
+            GetStagingTextureSize(mRecycledImageStagingTextures.front());
+        mRecycledImageStagingTextures.pop_front();
+    }
+
+    mRecycledImageStagingTexturesSize += textureSize;
+    mRecycledImageStagingTextures.push_back(std::move(texture));
+}
+
 angle::Result Renderer11::createStagingTexture(const gl::Context *context,
                                                ResourceType textureType,
                                                const d3d11::Format &formatSet,
@@ -9,9 +9,12 @@
 #ifndef LIBANGLE_RENDERER_D3D_D3D11_RENDERER11_H_
 #define LIBANGLE_RENDERER_D3D_D3D11_RENDERER11_H_
 
+#include <deque>
+
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 #include "libANGLE/AttributeMap.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/d3d/HLSLCompiler.h"
 #include "libANGLE/renderer/d3d/ProgramD3D.h"
@@ -36,6 +39,7 @@ class Blit11;
 class Buffer11;
 class Clear11;
 class Context11;
+class IndexBuffer11;
 class IndexDataManager;
 struct PackPixelsParams;
 class PixelTransfer11;
@@ -61,6 +65,7 @@ struct Renderer11DeviceCaps
     // https://learn.microsoft.com/en-us/windows/win32/direct3d11/typed-unordered-access-view-loads
     bool supportsUAVLoadStoreCommonFormats;  // Do the common additional formats support load/store?
     bool supportsRasterizerOrderViews;
+    bool supportsMapNoOverwriteOnDynamicConstantBuffer;
     bool allowES3OnFL10_0;
     UINT B5G6R5support;     // Bitfield of D3D11_FORMAT_SUPPORT values for DXGI_FORMAT_B5G6R5_UNORM
     UINT B5G6R5maxSamples;  // Maximum number of samples supported by DXGI_FORMAT_B5G6R5_UNORM
@@ -382,6 +387,16 @@ class Renderer11 : public RendererD3D
     RendererClass getRendererClass() const override;
     StateManager11 *getStateManager() { return &mStateManager; }
 
+    angle::D3D11PerfCounters &getPerfCounters() { return mPerfCounters; }
+
+    // Create the render states stored in the blob cache by a previous run.  Only done once.
+    angle::Result prewarmRenderStateCache(const gl::Context *context);
+    // Store the keys of the render state cache in the blob cache if new states were created.
+    void syncRenderStateCacheBlob(const gl::Context *context);
+    // Drop the cached render states so that the next prewarmRenderStateCache() behaves like the
+    // first one of a new run.
+    void resetRenderStateCacheForTesting();
+
     void onBufferCreate(const Buffer11 *created);
     void onBufferDelete(const Buffer11 *deleted);
 
@@ -420,6 +435,15 @@ class Renderer11 : public RendererD3D
                                        StagingAccess readAndWriteAccess,
                                        TextureHelper11 *textureOut);
 
+    // Image11 staging textures are recycled, so that images that are replaced repeatedly (such as
+    // streamed textures) don't create a new staging texture for every upload.  A recycled texture
+    // has undefined contents.
+    bool takeRecycledImageStagingTexture(ResourceType textureType,
+                                         const d3d11::Format &formatSet,
+                                         const gl::Extents &size,
+                                         TextureHelper11 *textureOut);
+    void recycleImageStagingTexture(TextureHelper11 &&texture);
+
     template <typename DescT, typename ResourceT>
     angle::Result allocateResource(d3d::Context *context, const DescT &desc, ResourceT *resourceOut)
     {
@@ -512,6 +536,13 @@ class Renderer11 : public RendererD3D
                                const void *indices,
                                int baseVertex,
                                int instances);
+    // Draws a line loop that was translated into a list of 32-bit indices.
+    angle::Result drawLineLoopIndices(const gl::Context *context,
+                                      IndexBuffer11 *indexBuffer,
+                                      unsigned int offset,
+                                      UINT indexCount,
+                                      int baseVertex,
+                                      int instances);
     angle::Result drawTriangleFan(const gl::Context *context,
                                   GLuint count,
                                   gl::DrawElementsType type,
@@ -567,6 +598,8 @@ class Renderer11 : public RendererD3D
     HLSLCompiler mCompiler;
 
     RenderStateCache mStateCache;
+    bool mRenderStateCachePrewarmed;
+    egl::BlobCache::Key mRenderStateCacheBlobKey;
 
     StateManager11 mStateManager;
 
@@ -608,10 +641,15 @@ class Renderer11 : public RendererD3D
 
     DebugAnnotatorContext11 mAnnotatorContext;
 
+    angle::D3D11PerfCounters mPerfCounters;
+
     mutable Optional<bool> mSupportsShareHandles;
     ResourceManager11 mResourceManager11;
 
     TextureHelper11 mCachedResolveTexture;
+
+    std::deque<TextureHelper11> mRecycledImageStagingTextures;
+    size_t mRecycledImageStagingTexturesSize;
 };
 
 }  // namespace rx
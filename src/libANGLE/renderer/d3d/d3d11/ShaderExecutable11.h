@@ -47,6 +47,15 @@ class ShaderExecutable11 : public ShaderExecutableD3D
     d3d11::GeometryShader mStreamOutExecutable;
 };
 
+// Where the uniforms were last written in StateManager11's default uniform ring.  The range is
+// only valid while the ring's generation matches.
+struct DefaultUniformRingRange
+{
+    uint64_t generation = 0;
+    UINT firstConstant  = 0;
+    UINT numConstants   = 0;
+};
+
 class UniformStorage11 : public UniformStorageD3D
 {
   public:
@@ -57,8 +66,12 @@ class UniformStorage11 : public UniformStorageD3D
                                     Renderer11 *renderer,
                                     const d3d11::Buffer **bufferOut);
 
+    const DefaultUniformRingRange &getRingRange() const { return mRingRange; }
+    void setRingRange(const DefaultUniformRingRange &range) { mRingRange = range; }
+
   private:
     d3d11::Buffer mConstantBuffer;
+    DefaultUniformRingRange mRingRange;
 };
 
 }  // namespace rx
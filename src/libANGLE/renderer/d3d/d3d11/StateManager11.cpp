@@ -165,6 +165,16 @@ void UpdateUniformBuffer(ID3D11DeviceContext *deviceContext,
                                      0);
 }
 
+// The default uniform ring's size.  Ranges bound with *SSetConstantBuffers1 must start at and span
+// a multiple of 16 constants.
+constexpr size_t kDefaultUniformRingSize       = 1024 * 1024;
+constexpr size_t kConstantBufferRangeAlignment = 16 * 16;
+
+size_t GetDefaultUniformRingAllocationSize(const UniformStorage11 *storage)
+{
+    return rx::roundUpPow2(storage->size(), kConstantBufferRangeAlignment);
+}
+
 size_t GetReservedBufferCount(bool usesPointSpriteEmulation)
 {
     return usesPointSpriteEmulation ? 1 : 0;
@@ -551,6 +561,9 @@ StateManager11::StateManager11(Renderer11 *renderer)
       mIndexDataManager(renderer),
       mIsMultiviewEnabled(false),
       mIndependentBlendStates(false),
+      mDefaultUniformRingOffset(0),
+      mDefaultUniformRingGeneration(1),
+      mDefaultUniformRingNeedsDiscard(true),
       mEmptySerial(mRenderer->generateSerial()),
       mExecutableD3D(nullptr),
       mVertexArray11(nullptr),
@@ -1676,6 +1689,11 @@ void StateManager11::deinitialize()
     {
         ShaderDriverConstantBuffer.reset();
     }
+
+    mDefaultUniformRing.reset();
+    mDefaultUniformRingOffset       = 0;
+    mDefaultUniformRingNeedsDiscard = true;
+    ++mDefaultUniformRingGeneration;
 }
 
 // Applies the render target surface, depth stencil surface, viewport rectangle and
@@ -2913,37 +2931,83 @@ angle::Result StateManager11::applyUniformsForShader(const gl::Context *context,
         GetAs<UniformStorage11>(mExecutableD3D->getShaderUniformStorage(shaderType));
     ASSERT(shaderUniformStorage);
 
-    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    ID3D11DeviceContext *deviceContext   = mRenderer->getDeviceContext();
+    ID3D11DeviceContext1 *deviceContext1 = mRenderer->getDeviceContext1IfSupported();
 
     const d3d11::Buffer *shaderConstantBuffer = nullptr;
-    ANGLE_TRY(shaderUniformStorage->getConstantBuffer(context, mRenderer, &shaderConstantBuffer));
+    UINT firstConstant                        = 0;
+    UINT numConstants                         = 0;
 
-    if (shaderUniformStorage->size() > 0 && mExecutableD3D->areShaderUniformsDirty(shaderType))
+    if (useDefaultUniformRing() && shaderUniformStorage->size() > 0)
     {
-        UpdateUniformBuffer(deviceContext, shaderUniformStorage, shaderConstantBuffer);
+        if (mExecutableD3D->areShaderUniformsDirty(shaderType) ||
+            shaderUniformStorage->getRingRange().generation != mDefaultUniformRingGeneration)
+        {
+            ANGLE_TRY(writeDefaultUniformRing(context, shaderUniformStorage));
+        }
+
+        shaderConstantBuffer = &mDefaultUniformRing;
+        firstConstant        = shaderUniformStorage->getRingRange().firstConstant;
+        numConstants         = shaderUniformStorage->getRingRange().numConstants;
     }
+    else
+    {
+        ANGLE_TRY(
+            shaderUniformStorage->getConstantBuffer(context, mRenderer, &shaderConstantBuffer));
 
-    unsigned int slot = d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK;
+        if (shaderUniformStorage->size() > 0 && mExecutableD3D->areShaderUniformsDirty(shaderType))
+        {
+            UpdateUniformBuffer(deviceContext, shaderUniformStorage, shaderConstantBuffer);
+        }
+    }
+
+    unsigned int slot     = d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK;
+    const GLintptr offset = static_cast<GLintptr>(firstConstant) * 16;
+    const GLsizeiptr size = static_cast<GLsizeiptr>(numConstants) * 16;
 
     switch (shaderType)
     {
         case gl::ShaderType::Vertex:
-            if (mCurrentConstantBufferVS[slot] != shaderConstantBuffer->getSerial())
+            if (mCurrentConstantBufferVS[slot] != shaderConstantBuffer->getSerial() ||
+                mCurrentConstantBufferVSOffset[slot] != offset ||
+                mCurrentConstantBufferVSSize[slot] != size)
             {
-                deviceContext->VSSetConstantBuffers(slot, 1, shaderConstantBuffer->getPointer());
+                if (numConstants != 0)
+                {
+                    deviceContext1->VSSetConstantBuffers1(slot, 1,
+                                                          shaderConstantBuffer->getPointer(),
+                                                          &firstConstant, &numConstants);
+                }
+                else
+                {
+                    deviceContext->VSSetConstantBuffers(slot, 1,
+                                                        shaderConstantBuffer->getPointer());
+                }
                 mCurrentConstantBufferVS[slot]       = shaderConstantBuffer->getSerial();
-                mCurrentConstantBufferVSOffset[slot] = 0;
-                mCurrentConstantBufferVSSize[slot]   = 0;
+                mCurrentConstantBufferVSOffset[slot] = offset;
+                mCurrentConstantBufferVSSize[slot]   = size;
             }
             break;
 
         case gl::ShaderType::Fragment:
-            if (mCurrentConstantBufferPS[slot] != shaderConstantBuffer->getSerial())
+            if (mCurrentConstantBufferPS[slot] != shaderConstantBuffer->getSerial() ||
+                mCurrentConstantBufferPSOffset[slot] != offset ||
+                mCurrentConstantBufferPSSize[slot] != size)
             {
-                deviceContext->PSSetConstantBuffers(slot, 1, shaderConstantBuffer->getPointer());
+                if (numConstants != 0)
+                {
+                    deviceContext1->PSSetConstantBuffers1(slot, 1,
+                                                          shaderConstantBuffer->getPointer(),
+                                                          &firstConstant, &numConstants);
+                }
+                else
+                {
+                    deviceContext->PSSetConstantBuffers(slot, 1,
+                                                        shaderConstantBuffer->getPointer());
+                }
                 mCurrentConstantBufferPS[slot]       = shaderConstantBuffer->getSerial();
-                mCurrentConstantBufferPSOffset[slot] = 0;
-                mCurrentConstantBufferPSSize[slot]   = 0;
+                mCurrentConstantBufferPSOffset[slot] = offset;
+                mCurrentConstantBufferPSSize[slot]   = size;
             }
             break;
 
@@ -2962,6 +3026,20 @@ angle::Result StateManager11::applyUniformsForShader(const gl::Context *context,
 
 angle::Result StateManager11::applyUniforms(const gl::Context *context)
 {
+    if (useDefaultUniformRing())
+    {
+        // Make room for all the stages up front, so the ring can't wrap around (and discard the
+        // uniforms of the first stages) in the middle.
+        size_t requiredSize = 0;
+        for (gl::ShaderType shaderType : {gl::ShaderType::Vertex, gl::ShaderType::Fragment})
+        {
+            const UniformStorage11 *shaderUniformStorage =
+                GetAs<UniformStorage11>(mExecutableD3D->getShaderUniformStorage(shaderType));
+            requiredSize += GetDefaultUniformRingAllocationSize(shaderUniformStorage);
+        }
+        ANGLE_TRY(reserveDefaultUniformRing(context, requiredSize));
+    }
+
     ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Vertex));
     ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Fragment));
     if (mExecutableD3D->hasShaderStage(gl::ShaderType::Geometry))
@@ -2974,6 +3052,66 @@ angle::Result StateManager11::applyUniforms(const gl::Context *context)
     return angle::Result::Continue;
 }
 
+bool StateManager11::useDefaultUniformRing() const
+{
+    const Renderer11DeviceCaps &caps = mRenderer->getRenderer11DeviceCaps();
+    return caps.supportsConstantBufferOffsets && caps.supportsMapNoOverwriteOnDynamicConstantBuffer;
+}
+
+angle::Result StateManager11::reserveDefaultUniformRing(const gl::Context *context, size_t size)
+{
+    ASSERT(size <= kDefaultUniformRingSize);
+
+    if (!mDefaultUniformRing.valid())
+    {
+        D3D11_BUFFER_DESC desc;
+        d3d11::InitConstantBufferDesc(&desc, kDefaultUniformRingSize);
+        ANGLE_TRY(
+            mRenderer->allocateResource(GetImplAs<Context11>(context), desc, &mDefaultUniformRing));
+        mDefaultUniformRing.setInternalName("StateManager11::mDefaultUniformRing");
+    }
+
+    if (mDefaultUniformRingOffset + size > kDefaultUniformRingSize)
+    {
+        mDefaultUniformRingOffset       = 0;
+        mDefaultUniformRingNeedsDiscard = true;
+        ++mDefaultUniformRingGeneration;
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result StateManager11::writeDefaultUniformRing(const gl::Context *context,
+                                                      UniformStorage11 *storage)
+{
+    const size_t allocationSize = GetDefaultUniformRingAllocationSize(storage);
+    ASSERT(mDefaultUniformRing.valid());
+    ASSERT(mDefaultUniformRingOffset + allocationSize <= kDefaultUniformRingSize);
+
+    // The ranges written since the last discard may still be in use by the GPU, so they are never
+    // written again until the ring wraps around.
+    const D3D11_MAP mapType =
+        mDefaultUniformRingNeedsDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+    D3D11_MAPPED_SUBRESOURCE mapping = {};
+    ANGLE_TRY(
+        mRenderer->mapResource(context, mDefaultUniformRing.get(), 0, mapType, 0, &mapping));
+    memcpy(static_cast<uint8_t *>(mapping.pData) + mDefaultUniformRingOffset,
+           storage->getDataPointer(0, 0), storage->size());
+    mRenderer->getDeviceContext()->Unmap(mDefaultUniformRing.get(), 0);
+
+    DefaultUniformRingRange range;
+    range.generation    = mDefaultUniformRingGeneration;
+    range.firstConstant = static_cast<UINT>(mDefaultUniformRingOffset / 16);
+    range.numConstants  = static_cast<UINT>(allocationSize / 16);
+    storage->setRingRange(range);
+
+    mDefaultUniformRingOffset += allocationSize;
+    mDefaultUniformRingNeedsDiscard = false;
+
+    return angle::Result::Continue;
+}
+
 angle::Result StateManager11::applyDriverUniformsForShader(const gl::Context *context,
                                                            gl::ShaderType shaderType)
 {
@@ -357,6 +357,10 @@ class StateManager11 final : angle::NonCopyable
     angle::Result applyUniforms(const gl::Context *context);
     angle::Result applyUniformsForShader(const gl::Context *context, gl::ShaderType shaderType);
 
+    bool useDefaultUniformRing() const;
+    angle::Result reserveDefaultUniformRing(const gl::Context *context, size_t size);
+    angle::Result writeDefaultUniformRing(const gl::Context *context, UniformStorage11 *storage);
+
     angle::Result syncUniformBuffers(const gl::Context *context);
     angle::Result syncUniformBuffersForShader(const gl::Context *context,
                                               gl::ShaderType shaderType);
@@ -598,6 +602,16 @@ class StateManager11 final : angle::NonCopyable
     FragmentConstantBufferArray<GLintptr> mCurrentConstantBufferPSOffset;
     FragmentConstantBufferArray<GLsizeiptr> mCurrentConstantBufferPSSize;
 
+    // With D3D11.1, the default uniform blocks are written to a ring in one dynamic constant
+    // buffer with D3D11_MAP_WRITE_NO_OVERWRITE and bound with offsets, instead of each program
+    // stage updating its own buffer.  When the ring wraps around it's mapped with
+    // D3D11_MAP_WRITE_DISCARD and its generation increases, which makes every program rewrite its
+    // uniforms.
+    d3d11::Buffer mDefaultUniformRing;
+    size_t mDefaultUniformRingOffset;
+    uint64_t mDefaultUniformRingGeneration;
+    bool mDefaultUniformRingNeedsDiscard;
+
     // Currently applied transform feedback buffers
     UniqueSerial mAppliedTFSerial;
 
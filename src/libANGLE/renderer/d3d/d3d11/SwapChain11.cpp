@@ -76,6 +76,7 @@ SwapChain11::SwapChain11(Renderer11 *renderer,
       mSwapChain(nullptr),
       mSwapChain1(nullptr),
       mKeyedMutex(nullptr),
+      mFrameLatencyWaitableObject(nullptr),
       mBackBufferTexture(),
       mBackBufferRTView(),
       mBackBufferSRView(),
@@ -118,6 +119,7 @@ void SwapChain11::release()
 {
     // TODO(jmadill): Should probably signal that the RenderTarget is dirty.
 
+    releaseFrameLatencyWaitableObject();
     SafeRelease(mSwapChain1);
     SafeRelease(mSwapChain);
     SafeRelease(mKeyedMutex);
@@ -512,8 +514,9 @@ EGLint SwapChain11::resize(DisplayD3D *displayD3D, EGLint backbufferWidth, EGLin
         return EGL_BAD_ALLOC;
     }
 
+    // The flags the swap chain was created with must be kept, or resizing fails.
     hr = mSwapChain->ResizeBuffers(desc.BufferCount, backbufferWidth, backbufferHeight,
-                                   getSwapChainNativeFormat(), 0);
+                                   getSwapChainNativeFormat(), desc.Flags);
 
     if (FAILED(hr))
     {
@@ -617,6 +620,7 @@ EGLint SwapChain11::reset(DisplayD3D *displayD3D,
 
     // Release specific resources to free up memory for the new render target, while the
     // old render target still exists for the purpose of preserving its contents.
+    releaseFrameLatencyWaitableObject();
     SafeRelease(mSwapChain1);
     SafeRelease(mSwapChain);
     mBackBufferTexture.reset();
@@ -655,6 +659,7 @@ EGLint SwapChain11::reset(DisplayD3D *displayD3D,
         }
 
         mSwapChain1 = d3d11::DynamicCastComObject<IDXGISwapChain1>(mSwapChain);
+        initFrameLatencyWaitableObject();
 
         ID3D11Texture2D *backbufferTex = nullptr;
         hr                             = mSwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D),
@@ -954,9 +959,64 @@ EGLint SwapChain11::present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint w
 
     mNativeWindow->commitChange();
 
+    waitForFrameLatencyWaitableObject();
+
     return EGL_SUCCESS;
 }
 
+void SwapChain11::initFrameLatencyWaitableObject()
+{
+    ASSERT(mFrameLatencyWaitableObject == nullptr);
+
+    DXGI_SWAP_CHAIN_DESC desc;
+    if (FAILED(mSwapChain->GetDesc(&desc)) ||
+        (desc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) == 0)
+    {
+        return;
+    }
+
+    IDXGISwapChain2 *swapChain2 = d3d11::DynamicCastComObject<IDXGISwapChain2>(mSwapChain);
+    if (swapChain2 == nullptr)
+    {
+        return;
+    }
+
+    // Keep at most one frame queued, so that eglSwapBuffers returns when the application should
+    // start its next frame.
+    HRESULT hr = swapChain2->SetMaximumFrameLatency(1);
+    if (SUCCEEDED(hr))
+    {
+        mFrameLatencyWaitableObject = swapChain2->GetFrameLatencyWaitableObject();
+    }
+    SafeRelease(swapChain2);
+
+    // The object is signaled when the swap chain is ready for the first frame too.
+    waitForFrameLatencyWaitableObject();
+}
+
+void SwapChain11::releaseFrameLatencyWaitableObject()
+{
+    if (mFrameLatencyWaitableObject != nullptr)
+    {
+        CloseHandle(mFrameLatencyWaitableObject);
+        mFrameLatencyWaitableObject = nullptr;
+    }
+}
+
+void SwapChain11::waitForFrameLatencyWaitableObject()
+{
+    if (mFrameLatencyWaitableObject == nullptr)
+    {
+        return;
+    }
+
+    // Time out in case the window stops being presented to, e.g. while it's occluded.
+    constexpr DWORD kFrameLatencyWaitTimeoutMs = 1000;
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "SwapChain11::waitForFrameLatencyWaitableObject");
+    WaitForSingleObjectEx(mFrameLatencyWaitableObject, kFrameLatencyWaitTimeoutMs, TRUE);
+}
+
 const TextureHelper11 &SwapChain11::getOffscreenTexture()
 {
     return mNeedsOffscreenTexture ? mOffscreenTexture : mBackBufferTexture;
@@ -86,6 +86,10 @@ class SwapChain11 final : public SwapChainD3D
     EGLint present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint width, EGLint height);
     UINT getD3DSamples() const;
 
+    void initFrameLatencyWaitableObject();
+    void releaseFrameLatencyWaitableObject();
+    void waitForFrameLatencyWaitableObject();
+
     Renderer11 *mRenderer;
     EGLint mWidth;
     EGLint mHeight;
@@ -100,6 +104,9 @@ class SwapChain11 final : public SwapChainD3D
     IDXGISwapChain *mSwapChain;
     IDXGISwapChain1 *mSwapChain1;
     IDXGIKeyedMutex *mKeyedMutex;
+    // Signaled when the swap chain can queue another frame, if it was created with
+    // DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT.
+    HANDLE mFrameLatencyWaitableObject;
 
     TextureHelper11 mBackBufferTexture;
     d3d11::RenderTargetView mBackBufferRTView;
@@ -2235,6 +2235,19 @@ void InitializeFeatures(const Renderer11DeviceCaps &deviceCaps,
                             IsWindows10OrLater());
 
     ANGLE_FEATURE_CONDITION(features, supportsNonConstantLoopIndexing, true);
+
+    // Creating state objects is a driver call the first draw with a new state has to wait for.
+    // Recreating the states seen by a previous run avoids it at the cost of a few unused objects.
+    ANGLE_FEATURE_CONDITION(features, warmUpRenderStateCache, true);
+
+    // Program binaries already skip compilation when they are cached, but draw-time variants and
+    // programs missing from the program cache (e.g. with a different set of shaders) still compile
+    // their HLSL.  The debug info of debug trace builds is not cached, so don't cache there.
+#if defined(ANGLE_ENABLE_DEBUG_TRACE)
+    ANGLE_FEATURE_CONDITION(features, cacheCompiledHlsl, false);
+#else
+    ANGLE_FEATURE_CONDITION(features, cacheCompiledHlsl, true);
+#endif
 }
 
 void InitializeFrontendFeatures(const DXGI_ADAPTER_DESC &adapterDesc,
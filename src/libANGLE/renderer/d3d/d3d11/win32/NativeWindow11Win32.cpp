@@ -21,10 +21,12 @@ namespace rx
 
 NativeWindow11Win32::NativeWindow11Win32(EGLNativeWindowType window,
                                          bool hasAlpha,
-                                         bool directComposition)
+                                         bool directComposition,
+                                         bool lowLatency)
     : NativeWindow11(window),
       mDirectComposition(directComposition),
       mHasAlpha(hasAlpha),
+      mLowLatency(lowLatency),
       mDevice(nullptr),
       mCompositionTarget(nullptr),
       mVisual(nullptr)
@@ -131,7 +133,8 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
         swapChainDesc.SwapEffect  = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
         swapChainDesc.AlphaMode =
             mHasAlpha ? DXGI_ALPHA_MODE_PREMULTIPLIED : DXGI_ALPHA_MODE_IGNORE;
-        swapChainDesc.Flags         = 0;
+        swapChainDesc.Flags =
+            mLowLatency ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT : 0;
         IDXGISwapChain1 *swapChain1 = nullptr;
         HRESULT result =
             factory2->CreateSwapChainForComposition(device, &swapChainDesc, nullptr, &swapChain1);
@@ -148,6 +151,39 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
     // Use IDXGIFactory2::CreateSwapChainForHwnd if DXGI 1.2 is available to create a
     // DXGI_SWAP_EFFECT_SEQUENTIAL swap chain.
     IDXGIFactory2 *factory2 = d3d11::DynamicCastComObject<IDXGIFactory2>(factory);
+
+    // In low-latency mode, use a flip model swap chain whose frame latency can be limited and
+    // waited on, see SwapChain11.  Flip model swap chains can't be multisampled.  If the swap
+    // chain can't be created, for example because the waitable object needs Windows 8.1, a
+    // regular swap chain is created instead.
+    if (factory2 != nullptr && mLowLatency && samples <= 1)
+    {
+        DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
+        swapChainDesc.Width                 = width;
+        swapChainDesc.Height                = height;
+        swapChainDesc.Format                = format;
+        swapChainDesc.Stereo                = FALSE;
+        swapChainDesc.SampleDesc.Count      = 1;
+        swapChainDesc.SampleDesc.Quality    = 0;
+        swapChainDesc.BufferUsage =
+            DXGI_USAGE_RENDER_TARGET_OUTPUT | DXGI_USAGE_SHADER_INPUT | DXGI_USAGE_BACK_BUFFER;
+        swapChainDesc.BufferCount   = 2;
+        swapChainDesc.Scaling       = DXGI_SCALING_STRETCH;
+        swapChainDesc.SwapEffect    = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+        swapChainDesc.AlphaMode     = DXGI_ALPHA_MODE_UNSPECIFIED;
+        swapChainDesc.Flags         = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+        IDXGISwapChain1 *swapChain1 = nullptr;
+        HRESULT result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &swapChainDesc,
+                                                          nullptr, nullptr, &swapChain1);
+        if (SUCCEEDED(result))
+        {
+            factory2->MakeWindowAssociation(getNativeWindow(), DXGI_MWA_NO_ALT_ENTER);
+            *swapChain = static_cast<IDXGISwapChain *>(swapChain1);
+            SafeRelease(factory2);
+            return result;
+        }
+    }
+
     if (factory2 != nullptr)
     {
         DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
@@ -21,7 +21,10 @@ namespace rx
 class NativeWindow11Win32 : public NativeWindow11
 {
   public:
-    NativeWindow11Win32(EGLNativeWindowType window, bool hasAlpha, bool directComposition);
+    NativeWindow11Win32(EGLNativeWindowType window,
+                        bool hasAlpha,
+                        bool directComposition,
+                        bool lowLatency);
     ~NativeWindow11Win32() override;
 
     bool initialize() override;
@@ -43,6 +46,7 @@ class NativeWindow11Win32 : public NativeWindow11
   private:
     bool mDirectComposition;
     bool mHasAlpha;
+    bool mLowLatency;
     IDCompositionDevice *mDevice;
     IDCompositionTarget *mCompositionTarget;
     IDCompositionVisual *mVisual;
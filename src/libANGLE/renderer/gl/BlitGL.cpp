@@ -430,13 +430,8 @@ angle::Result BlitGL::copySubImageToLUMAWorkaroundTexture(const gl::Context *con
     mStateManager->activeTexture(0);
     mStateManager->bindTexture(gl::TextureType::_2D, mScratchTextures[0]);
 
-    mStateManager->useProgram(blitProgram->program);
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->scaleLocation, 1.0, 1.0));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->offsetLocation, 0.0, 0.0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->transformLinearToSrgbLocation, 0));
+    ANGLE_TRY(setBlitProgramUniforms(context, blitProgram, Vector2(1.0f, 1.0f),
+                                     Vector2(0.0f, 0.0f), false, false, false));
 
     ANGLE_TRY(setVAOState(context));
     ANGLE_GL_TRY(context, mFunctions->drawArrays(GL_TRIANGLES, 0, 3));
@@ -610,15 +605,8 @@ angle::Result BlitGL::blitColorBufferWithShader(const gl::Context *context,
     mStateManager->activeTexture(0);
     mStateManager->bindTexture(gl::TextureType::_2D, textureId);
 
-    mStateManager->useProgram(blitProgram->program);
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->scaleLocation, texCoordScale.x(),
-                                                texCoordScale.y()));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->offsetLocation, texCoordOffset.x(),
-                                                texCoordOffset.y()));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->transformLinearToSrgbLocation, 0));
+    ANGLE_TRY(setBlitProgramUniforms(context, blitProgram, texCoordScale, texCoordOffset, false,
+                                     false, false));
 
     mStateManager->bindFramebuffer(GL_DRAW_FRAMEBUFFER, destFramebuffer);
 
@@ -720,25 +708,11 @@ angle::Result BlitGL::copySubTexture(const gl::Context *context,
         scale.y() = -scale.y();
     }
 
-    mStateManager->useProgram(blitProgram->program);
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->scaleLocation, scale.x(), scale.y()));
-    ANGLE_GL_TRY(context,
-                 mFunctions->uniform2f(blitProgram->offsetLocation, offset.x(), offset.y()));
-    if (unpackPremultiplyAlpha == unpackUnmultiplyAlpha)
-    {
-        ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0));
-        ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0));
-    }
-    else
-    {
-        ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->multiplyAlphaLocation,
-                                                    unpackPremultiplyAlpha));
-        ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation,
-                                                    unpackUnmultiplyAlpha));
-    }
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->transformLinearToSrgbLocation,
-                                                transformLinearToSrgb));
+    // Premultiplying and unmultiplying alpha cancel out.
+    const bool multiplyAlpha   = unpackPremultiplyAlpha && !unpackUnmultiplyAlpha;
+    const bool unMultiplyAlpha = unpackUnmultiplyAlpha && !unpackPremultiplyAlpha;
+    ANGLE_TRY(setBlitProgramUniforms(context, blitProgram, scale, offset, multiplyAlpha,
+                                     unMultiplyAlpha, transformLinearToSrgb));
 
     ANGLE_TRY(setVAOState(context));
     ANGLE_GL_TRY(context, mFunctions->drawArrays(GL_TRIANGLES, 0, 3));
@@ -1337,19 +1311,16 @@ angle::Result BlitGL::generateMipmap(const gl::Context *context,
                                                     GL_NEAREST));
     ANGLE_GL_TRY(context, mFunctions->texParameteri(ToGLenum(sourceTarget), GL_TEXTURE_MAG_FILTER,
                                                     GL_NEAREST));
+    mScratchTextureParameters[0].minFilter = GL_NEAREST;
+    mScratchTextureParameters[0].magFilter = GL_NEAREST;
 
     // Use a shader to copy the source to intermediate texture. glBlitFramebuffer does not always do
     // sRGB to linear conversions for us.
     BlitProgram *blitProgram = nullptr;
     ANGLE_TRY(getBlitProgram(context, sourceType, GL_FLOAT, GL_FLOAT, &blitProgram));
 
-    mStateManager->useProgram(blitProgram->program);
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->sourceTextureLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->scaleLocation, 1.0f, 1.0f));
-    ANGLE_GL_TRY(context, mFunctions->uniform2f(blitProgram->offsetLocation, 0.0f, 0.0f));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->multiplyAlphaLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->unMultiplyAlphaLocation, 0));
-    ANGLE_GL_TRY(context, mFunctions->uniform1i(blitProgram->transformLinearToSrgbLocation, 0));
+    ANGLE_TRY(setBlitProgramUniforms(context, blitProgram, Vector2(1.0f, 1.0f),
+                                     Vector2(0.0f, 0.0f), false, false, false));
 
     mStateManager->bindFramebuffer(GL_FRAMEBUFFER, mScratchFBO);
     mStateManager->setFramebufferSRGBEnabled(context, true);
@@ -1514,6 +1485,12 @@ angle::Result BlitGL::orphanScratchTextures(const gl::Context *context)
                                                      GL_UNSIGNED_BYTE, nullptr));
     }
 
+    for (ScratchTextureParameters &parameters : mScratchTextureParameters)
+    {
+        parameters.minFilter = GL_NEAREST_MIPMAP_LINEAR;
+        parameters.magFilter = GL_LINEAR;
+    }
+
     return angle::Result::Continue;
 }
 
@@ -1521,11 +1498,40 @@ angle::Result BlitGL::setScratchTextureParameter(const gl::Context *context,
                                                  GLenum param,
                                                  GLenum value)
 {
-    for (auto texture : mScratchTextures)
+    for (size_t i = 0; i < ArraySize(mScratchTextures); i++)
     {
-        mStateManager->bindTexture(gl::TextureType::_2D, texture);
-        ANGLE_GL_TRY(context, mFunctions->texParameteri(GL_TEXTURE_2D, param, value));
+        ScratchTextureParameters &parameters = mScratchTextureParameters[i];
+        GLenum *currentValue                 = nullptr;
+        switch (param)
+        {
+            case GL_TEXTURE_MIN_FILTER:
+                currentValue = &parameters.minFilter;
+                break;
+            case GL_TEXTURE_MAG_FILTER:
+                currentValue = &parameters.magFilter;
+                break;
+            case GL_TEXTURE_WRAP_S:
+                currentValue = &parameters.wrapS;
+                break;
+            case GL_TEXTURE_WRAP_T:
+                currentValue = &parameters.wrapT;
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        if (currentValue != nullptr && *currentValue == value)
+        {
+            continue;
+        }
+
+        mStateManager->bindTexture(gl::TextureType::_2D, mScratchTextures[i]);
         ANGLE_GL_TRY(context, mFunctions->texParameteri(GL_TEXTURE_2D, param, value));
+        if (currentValue != nullptr)
+        {
+            *currentValue = value;
+        }
     }
     return angle::Result::Continue;
 }
@@ -1867,4 +1873,48 @@ angle::Result BlitGL::getBlitProgram(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BlitGL::setBlitProgramUniforms(const gl::Context *context,
+                                             BlitProgram *program,
+                                             const Vector2 &scale,
+                                             const Vector2 &offset,
+                                             bool multiplyAlpha,
+                                             bool unMultiplyAlpha,
+                                             bool transformLinearToSrgb)
+{
+    mStateManager->useProgram(program->program);
+
+    // The source texture is always bound to unit 0, which is the default value of the sampler
+    // uniform.
+    if (program->scale != scale)
+    {
+        ANGLE_GL_TRY(context, mFunctions->uniform2f(program->scaleLocation, scale.x(), scale.y()));
+        program->scale = scale;
+    }
+    if (program->offset != offset)
+    {
+        ANGLE_GL_TRY(context,
+                     mFunctions->uniform2f(program->offsetLocation, offset.x(), offset.y()));
+        program->offset = offset;
+    }
+    if (program->multiplyAlpha != multiplyAlpha)
+    {
+        ANGLE_GL_TRY(context, mFunctions->uniform1i(program->multiplyAlphaLocation, multiplyAlpha));
+        program->multiplyAlpha = multiplyAlpha;
+    }
+    if (program->unMultiplyAlpha != unMultiplyAlpha)
+    {
+        ANGLE_GL_TRY(context,
+                     mFunctions->uniform1i(program->unMultiplyAlphaLocation, unMultiplyAlpha));
+        program->unMultiplyAlpha = unMultiplyAlpha;
+    }
+    if (program->transformLinearToSrgb != transformLinearToSrgb)
+    {
+        ANGLE_GL_TRY(context, mFunctions->uniform1i(program->transformLinearToSrgbLocation,
+                                                    transformLinearToSrgb));
+        program->transformLinearToSrgb = transformLinearToSrgb;
+    }
+
+    return angle::Result::Continue;
+}
+
 }  // namespace rx
@@ -11,6 +11,7 @@
 
 #include "angle_gl.h"
 #include "common/angleutils.h"
+#include "common/vector_utils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/gl/formatutilsgl.h"
@@ -200,6 +201,24 @@ class BlitGL : angle::NonCopyable
         GLint multiplyAlphaLocation         = -1;
         GLint unMultiplyAlphaLocation       = -1;
         GLint transformLinearToSrgbLocation = -1;
+
+        // The current values of the uniforms, which all start as zero.  The program is only used
+        // by BlitGL, so these are used to skip redundant glUniform calls.
+        angle::Vector2 scale{0.0f, 0.0f};
+        angle::Vector2 offset{0.0f, 0.0f};
+        bool multiplyAlpha         = false;
+        bool unMultiplyAlpha       = false;
+        bool transformLinearToSrgb = false;
+    };
+
+    // The parameters of a scratch texture that are set by setScratchTextureParameter, initially
+    // the GL defaults.
+    struct ScratchTextureParameters
+    {
+        GLenum minFilter = GL_NEAREST_MIPMAP_LINEAR;
+        GLenum magFilter = GL_LINEAR;
+        GLenum wrapS     = GL_REPEAT;
+        GLenum wrapT     = GL_REPEAT;
     };
 
     angle::Result getBlitProgram(const gl::Context *context,
@@ -207,6 +226,13 @@ class BlitGL : angle::NonCopyable
                                  GLenum sourceComponentType,
                                  GLenum destComponentType,
                                  BlitProgram **program);
+    angle::Result setBlitProgramUniforms(const gl::Context *context,
+                                         BlitProgram *program,
+                                         const angle::Vector2 &scale,
+                                         const angle::Vector2 &offset,
+                                         bool multiplyAlpha,
+                                         bool unMultiplyAlpha,
+                                         bool transformLinearToSrgb);
 
     bool mResourcesInitialized = false;
 
@@ -215,6 +241,7 @@ class BlitGL : angle::NonCopyable
     std::map<BlitProgramType, BlitProgram> mBlitPrograms;
 
     GLuint mScratchTextures[2] = {0};
+    ScratchTextureParameters mScratchTextureParameters[2];
     GLuint mScratchFBO         = 0;
 
     GLuint mVAO                   = 0;
@@ -67,7 +67,22 @@ ContextGL::ContextGL(const gl::State &state,
     : ContextImpl(state, errorSet),
       mRenderer(renderer),
       mRobustnessVideoMemoryPurgeStatus(robustnessVideoMemoryPurgeStatus)
-{}
+{
+    angle::PerfMonitorCounterGroupInfo glGroupInfo;
+    angle::PerfMonitorCounterGroup glGroup;
+    glGroupInfo.name = "opengl";
+
+#define ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP(COUNTER) \
+    glGroupInfo.counters.emplace_back(#COUNTER);      \
+    glGroup.counters.emplace_back(0);
+
+    ANGLE_GL_PERF_COUNTERS_X(ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP)
+
+#undef ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP
+
+    mPerfMonitorCountersInfo.emplace_back(std::move(glGroupInfo));
+    mPerfMonitorCounters.emplace_back(std::move(glGroup));
+}
 
 ContextGL::~ContextGL() {}
 
@@ -1043,4 +1058,34 @@ bool ContextGL::hasNativeParallelCompile()
     return mRenderer->hasNativeParallelCompile();
 }
 
+const angle::PerfMonitorCounterGroupsInfo &ContextGL::getPerfMonitorCountersInfo() const
+{
+    return mPerfMonitorCountersInfo;
+}
+
+const angle::PerfMonitorCounterGroups &ContextGL::getPerfMonitorCounters()
+{
+    ASSERT(mPerfMonitorCountersInfo.size() == 1);
+    ASSERT(mPerfMonitorCounters.size() == 1);
+
+    const angle::PerfMonitorCounterGroupInfo &info = mPerfMonitorCountersInfo[0];
+    angle::PerfMonitorCounters &counters           = mPerfMonitorCounters[0].counters;
+    const angle::GLPerfCounters &perfCounters      = getStateManager()->getPerfCounters();
+
+    ASSERT(info.name == "opengl");
+    ASSERT(info.counters.size() == counters.size());
+
+    uint32_t counterIndex = 0;
+
+#define ANGLE_UPDATE_PERF_MAP(COUNTER)                    \
+    ASSERT(info.counters.size() > counterIndex);          \
+    ASSERT(info.counters[counterIndex].name == #COUNTER); \
+    counters[counterIndex++].value = perfCounters.COUNTER;
+
+    ANGLE_GL_PERF_COUNTERS_X(ANGLE_UPDATE_PERF_MAP)
+
+#undef ANGLE_UPDATE_PERF_MAP
+
+    return mPerfMonitorCounters;
+}
 }  // namespace rx
@@ -298,6 +298,9 @@ class ContextGL : public ContextImpl
 
     const gl::Debug &getDebug() const { return mState.getDebug(); }
 
+    const angle::PerfMonitorCounterGroupsInfo &getPerfMonitorCountersInfo() const override;
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+
   private:
     angle::Result setDrawArraysState(const gl::Context *context,
                                      GLint first,
@@ -318,6 +321,9 @@ class ContextGL : public ContextImpl
     std::shared_ptr<RendererGL> mRenderer;
 
     RobustnessVideoMemoryPurgeStatus mRobustnessVideoMemoryPurgeStatus;
+
+    angle::PerfMonitorCounterGroupsInfo mPerfMonitorCountersInfo;
+    angle::PerfMonitorCounterGroups mPerfMonitorCounters;
 };
 
 }  // namespace rx
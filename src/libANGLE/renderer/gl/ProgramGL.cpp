@@ -104,6 +104,24 @@ std::string TrimArraySuffix(const char *inputName, size_t nameLen)
     return name;
 }
 
+// Identifies the driver that produced a native program binary.  Drivers are only required to
+// reject binaries of another driver version, and some of them crash on those instead, so a
+// binary saved by another driver is never given to glProgramBinary.
+std::string GetNativeDriverIdentity(const FunctionsGL *functions)
+{
+    std::string identity;
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const GLubyte *str = functions->getString(name);
+        if (str != nullptr)
+        {
+            identity += reinterpret_cast<const char *>(str);
+        }
+        identity += '\n';
+    }
+    return identity;
+}
+
 }  // anonymous namespace
 
 class ProgramGL::LinkTaskGL final : public LinkTask
@@ -223,6 +241,13 @@ angle::Result ProgramGL::load(const gl::Context *context,
     ANGLE_TRACE_EVENT0("gpu.angle", "ProgramGL::load");
     ProgramExecutableGL *executableGL = getExecutable();
 
+    // Reject the binary if the driver was updated since it was saved, so the program is relinked
+    // from source and saved again.
+    if (stream->readString() != GetNativeDriverIdentity(mFunctions))
+    {
+        return angle::Result::Continue;
+    }
+
     // Read the binary format, size and blob
     GLenum binaryFormat   = stream->readInt<GLenum>();
     GLint binaryLength    = stream->readInt<GLint>();
@@ -254,6 +279,8 @@ void ProgramGL::save(const gl::Context *context, gl::BinaryOutputStream *stream)
     GLint binaryLength = 0;
     mFunctions->getProgramiv(mProgramID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
 
+    stream->writeString(GetNativeDriverIdentity(mFunctions));
+
     std::vector<uint8_t> binary(std::max(binaryLength, 1));
     GLenum binaryFormat = GL_NONE;
     mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
@@ -425,6 +452,14 @@ angle::Result ProgramGL::link(const gl::Context *context, std::shared_ptr<LinkTa
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ProgramGL::link");
 
+    // Some drivers only keep the native binary of a program that was linked with the retrievable
+    // hint, so set it when the program may be saved in ANGLE's cache.  The hint the application
+    // sets is tracked by the front-end, which is what glGetProgramiv returns.
+    if (context->getMemoryProgramCache() != nullptr && mFunctions->programParameteri)
+    {
+        mFunctions->programParameteri(mProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     *linkTaskOut = std::make_shared<LinkTaskGL>(this, mRenderer->hasNativeParallelCompile(),
                                                 mFunctions, context->getExtensions(), mProgramID,
                                                 context->getState().usesPassthroughShaders());
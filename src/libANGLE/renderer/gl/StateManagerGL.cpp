@@ -178,7 +178,8 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mProvokingVertex(GL_LAST_VERTEX_CONVENTION),
       mMaxClipDistances(rendererCaps.maxClipDistances),
       mLogicOpEnabled(false),
-      mLogicOp(gl::LogicalOperation::Copy)
+      mLogicOp(gl::LogicalOperation::Copy),
+      mPerfCounters{}
 {
     ASSERT(mFunctions);
     ASSERT(rendererCaps.maxViews >= 1u);
@@ -430,8 +431,10 @@ void StateManagerGL::deleteTransformFeedback(GLuint transformFeedback)
 
 void StateManagerGL::useProgram(GLuint program)
 {
+    mPerfCounters.bindingCalls++;
     if (mProgram != program)
     {
+        mPerfCounters.bindingCallsIssued++;
         forceUseProgram(program);
     }
 }
@@ -445,8 +448,10 @@ void StateManagerGL::forceUseProgram(GLuint program)
 
 void StateManagerGL::bindVertexArray(GLuint vao, VertexArrayStateGL *vaoState)
 {
+    mPerfCounters.bindingCalls++;
     if (mVAO != vao)
     {
+        mPerfCounters.bindingCallsIssued++;
         ASSERT(!mFeatures.syncAllVertexArraysToDefault.enabled);
         forceBindVertexArray(vao, vaoState);
     }
@@ -465,12 +470,14 @@ void StateManagerGL::forceBindVertexArray(GLuint vao, VertexArrayStateGL *vaoSta
 
 void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
 {
+    mPerfCounters.bindingCalls++;
     // GL drivers differ in whether the transform feedback bind point is modified when
     // glBindTransformFeedback is called. To avoid these behavior differences we shouldn't try to
     // use it.
     ASSERT(target != gl::BufferBinding::TransformFeedback);
     if (mBuffers[target] != buffer)
     {
+        mPerfCounters.bindingCallsIssued++;
         mBuffers[target] = buffer;
         mFunctions->bindBuffer(gl::ToGLenum(target), buffer);
         setBufferBindingDirty(target);
@@ -479,6 +486,7 @@ void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
 
 void StateManagerGL::bindBufferBase(gl::BufferBinding target, size_t index, GLuint buffer)
 {
+    mPerfCounters.bindingCalls++;
     // Transform feedback buffer bindings are tracked in TransformFeedbackGL
     ASSERT(target != gl::BufferBinding::TransformFeedback);
 
@@ -487,6 +495,7 @@ void StateManagerGL::bindBufferBase(gl::BufferBinding target, size_t index, GLui
     if (binding.buffer != buffer || binding.offset != static_cast<size_t>(-1) ||
         binding.size != static_cast<size_t>(-1))
     {
+        mPerfCounters.bindingCallsIssued++;
         binding.buffer   = buffer;
         binding.offset   = static_cast<size_t>(-1);
         binding.size     = static_cast<size_t>(-1);
@@ -502,12 +511,14 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
                                      size_t offset,
                                      size_t size)
 {
+    mPerfCounters.bindingCalls++;
     // Transform feedback buffer bindings are tracked in TransformFeedbackGL
     ASSERT(target != gl::BufferBinding::TransformFeedback);
 
     auto &binding = mIndexedBuffers[target][index];
     if (binding.buffer != buffer || binding.offset != offset || binding.size != size)
     {
+        mPerfCounters.bindingCallsIssued++;
         binding.buffer   = buffer;
         binding.offset   = offset;
         binding.size     = size;
@@ -519,8 +530,10 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
 
 void StateManagerGL::activeTexture(size_t unit)
 {
+    mPerfCounters.bindingCalls++;
     if (mTextureUnitIndex != unit)
     {
+        mPerfCounters.bindingCallsIssued++;
         mTextureUnitIndex = unit;
         mFunctions->activeTexture(GL_TEXTURE0 + static_cast<GLenum>(mTextureUnitIndex));
     }
@@ -528,9 +541,11 @@ void StateManagerGL::activeTexture(size_t unit)
 
 void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
 {
+    mPerfCounters.bindingCalls++;
     gl::TextureType nativeType = nativegl::GetNativeTextureType(type);
     if (mTextures[nativeType][mTextureUnitIndex] != texture)
     {
+        mPerfCounters.bindingCallsIssued++;
         mTextures[nativeType][mTextureUnitIndex] = texture;
         mFunctions->bindTexture(nativegl::GetTextureBindingTarget(type), texture);
         mLocalDirtyBits.set(gl::state::DIRTY_BIT_TEXTURE_BINDINGS);
@@ -539,8 +554,10 @@ void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
 
 void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
 {
+    mPerfCounters.bindingCalls++;
     if (mSamplers[unit] != sampler)
     {
+        mPerfCounters.bindingCallsIssued++;
         mSamplers[unit] = sampler;
         mFunctions->bindSampler(static_cast<GLuint>(unit), sampler);
         mLocalDirtyBits.set(gl::state::DIRTY_BIT_SAMPLER_BINDINGS);
@@ -555,10 +572,12 @@ void StateManagerGL::bindImageTexture(size_t unit,
                                       GLenum access,
                                       GLenum format)
 {
+    mPerfCounters.bindingCalls++;
     auto &binding = mImages[unit];
     if (binding.texture != texture || binding.level != level || binding.layered != layered ||
         binding.layer != layer || binding.access != access || binding.format != format)
     {
+        mPerfCounters.bindingCallsIssued++;
         binding.texture = texture;
         binding.level   = level;
         binding.layered = layered;
@@ -690,6 +709,7 @@ angle::Result StateManagerGL::setPixelPackBuffer(const gl::Context *context,
 
 void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
 {
+    mPerfCounters.bindingCalls++;
     bool framebufferChanged = false;
     switch (type)
     {
@@ -739,6 +759,11 @@ void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
             break;
     }
 
+    if (framebufferChanged)
+    {
+        mPerfCounters.bindingCallsIssued++;
+    }
+
     if (framebufferChanged && mFeatures.flushOnFramebufferChange.enabled)
     {
         mFunctions->flush();
@@ -747,9 +772,11 @@ void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
 
 void StateManagerGL::bindRenderbuffer(GLenum type, GLuint renderbuffer)
 {
+    mPerfCounters.bindingCalls++;
     ASSERT(type == GL_RENDERBUFFER);
     if (mRenderbuffer != renderbuffer)
     {
+        mPerfCounters.bindingCallsIssued++;
         mRenderbuffer = renderbuffer;
         mFunctions->bindRenderbuffer(type, mRenderbuffer);
     }
@@ -757,9 +784,11 @@ void StateManagerGL::bindRenderbuffer(GLenum type, GLuint renderbuffer)
 
 void StateManagerGL::bindTransformFeedback(GLenum type, GLuint transformFeedback)
 {
+    mPerfCounters.bindingCalls++;
     ASSERT(type == GL_TRANSFORM_FEEDBACK);
     if (mTransformFeedback != transformFeedback)
     {
+        mPerfCounters.bindingCallsIssued++;
         // Pause the current transform feedback if one is active.
         // To handle virtualized contexts, StateManagerGL needs to be able to bind a new transform
         // feedback at any time, even if there is one active.
@@ -1137,8 +1166,10 @@ void StateManagerGL::updateProgramImageBindings(const gl::Context *context)
 void StateManagerGL::setAttributeCurrentData(size_t index,
                                              const gl::VertexAttribCurrentValueData &data)
 {
+    mPerfCounters.stateCalls++;
     if (mVertexAttribCurrentValues[index] != data)
     {
+        mPerfCounters.stateCallsIssued++;
         mVertexAttribCurrentValues[index] = data;
         switch (mVertexAttribCurrentValues[index].Type)
         {
@@ -1166,8 +1197,10 @@ void StateManagerGL::setAttributeCurrentData(size_t index,
 
 void StateManagerGL::setScissorTestEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mScissorTestEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mScissorTestEnabled = enabled;
         if (mScissorTestEnabled)
         {
@@ -1184,8 +1217,10 @@ void StateManagerGL::setScissorTestEnabled(bool enabled)
 
 void StateManagerGL::setScissor(const gl::Rectangle &scissor)
 {
+    mPerfCounters.stateCalls++;
     if (scissor != mScissor)
     {
+        mPerfCounters.stateCallsIssued++;
         mScissor = scissor;
         mFunctions->scissor(mScissor.x, mScissor.y, mScissor.width, mScissor.height);
 
@@ -1195,8 +1230,10 @@ void StateManagerGL::setScissor(const gl::Rectangle &scissor)
 
 void StateManagerGL::setViewport(const gl::Rectangle &viewport)
 {
+    mPerfCounters.stateCalls++;
     if (viewport != mViewport)
     {
+        mPerfCounters.stateCallsIssued++;
         mViewport = viewport;
         mFunctions->viewport(mViewport.x, mViewport.y, mViewport.width, mViewport.height);
 
@@ -1226,10 +1263,12 @@ void StateManagerGL::setDepthRange(float near, float far)
 
 void StateManagerGL::setClipControl(gl::ClipOrigin origin, gl::ClipDepthMode depth)
 {
+    mPerfCounters.stateCalls++;
     if (mClipOrigin == origin && mClipDepthMode == depth)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
 
     mClipOrigin    = origin;
     mClipDepthMode = depth;
@@ -1267,12 +1306,14 @@ void StateManagerGL::setClipControlWithEmulatedClipOrigin(const gl::ProgramExecu
 
 void StateManagerGL::setBlendEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     const gl::DrawBufferMask mask =
         enabled ? mBlendStateExt.getAllEnabledMask() : gl::DrawBufferMask::Zero();
     if (mBlendStateExt.getEnabledMask() == mask)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
 
     if (enabled)
     {
@@ -1289,10 +1330,12 @@ void StateManagerGL::setBlendEnabled(bool enabled)
 
 void StateManagerGL::setBlendEnabledIndexed(const gl::DrawBufferMask enabledMask)
 {
+    mPerfCounters.stateCalls++;
     if (mBlendStateExt.getEnabledMask() == enabledMask)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
 
     // Get DrawBufferMask of buffers with different blend enable state
     gl::DrawBufferMask diffMask = mBlendStateExt.getEnabledMask() ^ enabledMask;
@@ -1340,8 +1383,10 @@ void StateManagerGL::setBlendEnabledIndexed(const gl::DrawBufferMask enabledMask
 
 void StateManagerGL::setBlendColor(const gl::ColorF &blendColor)
 {
+    mPerfCounters.stateCalls++;
     if (mBlendColor != blendColor)
     {
+        mPerfCounters.stateCallsIssued++;
         mBlendColor = blendColor;
         mFunctions->blendColor(mBlendColor.red, mBlendColor.green, mBlendColor.blue,
                                mBlendColor.alpha);
@@ -1352,8 +1397,10 @@ void StateManagerGL::setBlendColor(const gl::ColorF &blendColor)
 
 void StateManagerGL::setBlendAdvancedCoherent(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mBlendAdvancedCoherent != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mBlendAdvancedCoherent = enabled;
 
         if (mBlendAdvancedCoherent)
@@ -1372,6 +1419,7 @@ void StateManagerGL::setBlendAdvancedCoherent(bool enabled)
 
 void StateManagerGL::setBlendFuncs(const gl::BlendStateExt &blendStateExt)
 {
+    mPerfCounters.stateCalls++;
     if (mBlendStateExt.getSrcColorBits() == blendStateExt.getSrcColorBits() &&
         mBlendStateExt.getDstColorBits() == blendStateExt.getDstColorBits() &&
         mBlendStateExt.getSrcAlphaBits() == blendStateExt.getSrcAlphaBits() &&
@@ -1379,6 +1427,7 @@ void StateManagerGL::setBlendFuncs(const gl::BlendStateExt &blendStateExt)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
 
     if (!mIndependentBlendStates)
     {
@@ -1462,11 +1511,13 @@ void StateManagerGL::setBlendFuncs(const gl::BlendStateExt &blendStateExt)
 
 void StateManagerGL::setBlendEquations(const gl::BlendStateExt &blendStateExt)
 {
+    mPerfCounters.stateCalls++;
     if (mBlendStateExt.getEquationColorBits() == blendStateExt.getEquationColorBits() &&
         mBlendStateExt.getEquationAlphaBits() == blendStateExt.getEquationAlphaBits())
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
 
     if (!mIndependentBlendStates)
     {
@@ -1556,10 +1607,12 @@ void StateManagerGL::setBlendEquations(const gl::BlendStateExt &blendStateExt)
 
 void StateManagerGL::setColorMask(bool red, bool green, bool blue, bool alpha)
 {
+    mPerfCounters.stateCalls++;
     const gl::BlendStateExt::ColorMaskStorage::Type mask =
         mBlendStateExt.expandColorMaskValue(red, green, blue, alpha);
     if (mBlendStateExt.getColorMaskBits() != mask)
     {
+        mPerfCounters.stateCallsIssued++;
         mFunctions->colorMask(red, green, blue, alpha);
         mBlendStateExt.setColorMaskBits(mask);
         mLocalDirtyBits.set(gl::state::DIRTY_BIT_COLOR_MASK);
@@ -1568,8 +1621,10 @@ void StateManagerGL::setColorMask(bool red, bool green, bool blue, bool alpha)
 
 void StateManagerGL::setSampleAlphaToCoverageEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mSampleAlphaToCoverageEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mSampleAlphaToCoverageEnabled = enabled;
         if (mSampleAlphaToCoverageEnabled)
         {
@@ -1586,8 +1641,10 @@ void StateManagerGL::setSampleAlphaToCoverageEnabled(bool enabled)
 
 void StateManagerGL::setSampleCoverageEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mSampleCoverageEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mSampleCoverageEnabled = enabled;
         if (mSampleCoverageEnabled)
         {
@@ -1613,16 +1670,20 @@ void StateManagerGL::forceSetSampleCoverage(float value, bool invert)
 
 void StateManagerGL::setSampleCoverage(float value, bool invert)
 {
+    mPerfCounters.stateCalls++;
     if (mSampleCoverageValue != value || mSampleCoverageInvert != invert)
     {
+        mPerfCounters.stateCallsIssued++;
         forceSetSampleCoverage(value, invert);
     }
 }
 
 void StateManagerGL::setSampleMaskEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mSampleMaskEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mSampleMaskEnabled = enabled;
         if (mSampleMaskEnabled)
         {
@@ -1639,9 +1700,11 @@ void StateManagerGL::setSampleMaskEnabled(bool enabled)
 
 void StateManagerGL::setSampleMaski(GLuint maskNumber, GLbitfield mask)
 {
+    mPerfCounters.stateCalls++;
     ASSERT(maskNumber < mSampleMaskValues.size());
     if (mSampleMaskValues[maskNumber] != mask)
     {
+        mPerfCounters.stateCallsIssued++;
         mSampleMaskValues[maskNumber] = mask;
         mFunctions->sampleMaski(maskNumber, mask);
 
@@ -1762,8 +1825,10 @@ void StateManagerGL::setStencilBackOps(GLenum sfail, GLenum dpfail, GLenum dppas
 
 void StateManagerGL::setCullFaceEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mCullFaceEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mCullFaceEnabled = enabled;
         if (mCullFaceEnabled)
         {
@@ -1780,8 +1845,10 @@ void StateManagerGL::setCullFaceEnabled(bool enabled)
 
 void StateManagerGL::setCullFace(gl::CullFaceMode cullFace)
 {
+    mPerfCounters.stateCalls++;
     if (mCullFace != cullFace)
     {
+        mPerfCounters.stateCallsIssued++;
         mCullFace = cullFace;
         mFunctions->cullFace(ToGLenum(mCullFace));
 
@@ -1791,8 +1858,10 @@ void StateManagerGL::setCullFace(gl::CullFaceMode cullFace)
 
 void StateManagerGL::setFrontFace(GLenum frontFace)
 {
+    mPerfCounters.stateCalls++;
     if (mFrontFace != frontFace)
     {
+        mPerfCounters.stateCallsIssued++;
         mFrontFace = frontFace;
         mFunctions->frontFace(mFrontFace);
 
@@ -1802,8 +1871,10 @@ void StateManagerGL::setFrontFace(GLenum frontFace)
 
 void StateManagerGL::setPolygonMode(gl::PolygonMode mode)
 {
+    mPerfCounters.stateCalls++;
     if (mPolygonMode != mode)
     {
+        mPerfCounters.stateCallsIssued++;
         mPolygonMode = mode;
         if (mFunctions->standard == STANDARD_GL_DESKTOP)
         {
@@ -1822,8 +1893,10 @@ void StateManagerGL::setPolygonMode(gl::PolygonMode mode)
 
 void StateManagerGL::setPolygonOffsetPointEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mPolygonOffsetPointEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mPolygonOffsetPointEnabled = enabled;
         if (mPolygonOffsetPointEnabled)
         {
@@ -1841,8 +1914,10 @@ void StateManagerGL::setPolygonOffsetPointEnabled(bool enabled)
 
 void StateManagerGL::setPolygonOffsetLineEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mPolygonOffsetLineEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mPolygonOffsetLineEnabled = enabled;
         if (mPolygonOffsetLineEnabled)
         {
@@ -1860,8 +1935,10 @@ void StateManagerGL::setPolygonOffsetLineEnabled(bool enabled)
 
 void StateManagerGL::setPolygonOffsetFillEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mPolygonOffsetFillEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mPolygonOffsetFillEnabled = enabled;
         if (mPolygonOffsetFillEnabled)
         {
@@ -1878,9 +1955,11 @@ void StateManagerGL::setPolygonOffsetFillEnabled(bool enabled)
 
 void StateManagerGL::setPolygonOffset(float factor, float units, float clamp)
 {
+    mPerfCounters.stateCalls++;
     if (mPolygonOffsetFactor != factor || mPolygonOffsetUnits != units ||
         mPolygonOffsetClamp != clamp)
     {
+        mPerfCounters.stateCallsIssued++;
         mPolygonOffsetFactor = factor;
         mPolygonOffsetUnits  = units;
         mPolygonOffsetClamp  = clamp;
@@ -1902,8 +1981,10 @@ void StateManagerGL::setPolygonOffset(float factor, float units, float clamp)
 
 void StateManagerGL::setDepthClampEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mDepthClampEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mDepthClampEnabled = enabled;
         if (mDepthClampEnabled)
         {
@@ -1921,8 +2002,10 @@ void StateManagerGL::setDepthClampEnabled(bool enabled)
 
 void StateManagerGL::setRasterizerDiscardEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mRasterizerDiscardEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mRasterizerDiscardEnabled = enabled;
         if (mRasterizerDiscardEnabled)
         {
@@ -1939,8 +2022,10 @@ void StateManagerGL::setRasterizerDiscardEnabled(bool enabled)
 
 void StateManagerGL::setLineWidth(float width)
 {
+    mPerfCounters.stateCalls++;
     if (mLineWidth != width)
     {
+        mPerfCounters.stateCallsIssued++;
         mLineWidth = width;
         mFunctions->lineWidth(mLineWidth);
 
@@ -1950,8 +2035,10 @@ void StateManagerGL::setLineWidth(float width)
 
 angle::Result StateManagerGL::setPrimitiveRestartEnabled(const gl::Context *context, bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mPrimitiveRestartEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         GLenum cap = mFeatures.emulatePrimitiveRestartFixedIndex.enabled
                          ? GL_PRIMITIVE_RESTART
                          : GL_PRIMITIVE_RESTART_FIXED_INDEX;
@@ -1974,8 +2061,10 @@ angle::Result StateManagerGL::setPrimitiveRestartEnabled(const gl::Context *cont
 
 angle::Result StateManagerGL::setPrimitiveRestartIndex(const gl::Context *context, GLuint index)
 {
+    mPerfCounters.stateCalls++;
     if (mPrimitiveRestartIndex != index)
     {
+        mPerfCounters.stateCallsIssued++;
         ANGLE_GL_TRY(context, mFunctions->primitiveRestartIndex(index));
         mPrimitiveRestartIndex = index;
 
@@ -1987,8 +2076,10 @@ angle::Result StateManagerGL::setPrimitiveRestartIndex(const gl::Context *contex
 
 void StateManagerGL::setClearDepth(float clearDepth)
 {
+    mPerfCounters.stateCalls++;
     if (mClearDepth != clearDepth)
     {
+        mPerfCounters.stateCallsIssued++;
         mClearDepth = clearDepth;
 
         // The glClearDepthf function isn't available until OpenGL 4.1.  Prefer it when it is
@@ -2009,8 +2100,10 @@ void StateManagerGL::setClearDepth(float clearDepth)
 
 void StateManagerGL::setClearColor(const gl::ColorF &clearColor)
 {
+    mPerfCounters.stateCalls++;
     if (mClearColor != clearColor)
     {
+        mPerfCounters.stateCallsIssued++;
         mClearColor = clearColor;
         mFunctions->clearColor(mClearColor.red, mClearColor.green, mClearColor.blue,
                                mClearColor.alpha);
@@ -2021,8 +2114,10 @@ void StateManagerGL::setClearColor(const gl::ColorF &clearColor)
 
 void StateManagerGL::setClearStencil(GLint clearStencil)
 {
+    mPerfCounters.stateCalls++;
     if (mClearStencil != clearStencil)
     {
+        mPerfCounters.stateCallsIssued++;
         mClearStencil = clearStencil;
         mFunctions->clearStencil(mClearStencil);
 
@@ -2646,8 +2741,10 @@ void StateManagerGL::setColorMaskForFramebuffer(const gl::BlendStateExt &blendSt
 
 void StateManagerGL::setDitherEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mDitherEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mDitherEnabled = enabled;
         if (mDitherEnabled)
         {
@@ -2662,8 +2759,10 @@ void StateManagerGL::setDitherEnabled(bool enabled)
 
 void StateManagerGL::setMultisamplingStateEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mMultisamplingEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mMultisamplingEnabled = enabled;
         if (mMultisamplingEnabled)
         {
@@ -2679,8 +2778,10 @@ void StateManagerGL::setMultisamplingStateEnabled(bool enabled)
 
 void StateManagerGL::setSampleAlphaToOneStateEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (mSampleAlphaToOneEnabled != enabled)
     {
+        mPerfCounters.stateCallsIssued++;
         mSampleAlphaToOneEnabled = enabled;
         if (mSampleAlphaToOneEnabled)
         {
@@ -2696,8 +2797,10 @@ void StateManagerGL::setSampleAlphaToOneStateEnabled(bool enabled)
 
 void StateManagerGL::setCoverageModulation(GLenum components)
 {
+    mPerfCounters.stateCalls++;
     if (mCoverageModulation != components)
     {
+        mPerfCounters.stateCallsIssued++;
         mCoverageModulation = components;
         mFunctions->coverageModulationNV(components);
 
@@ -2707,8 +2810,10 @@ void StateManagerGL::setCoverageModulation(GLenum components)
 
 void StateManagerGL::setProvokingVertex(GLenum mode)
 {
+    mPerfCounters.stateCalls++;
     if (mode != mProvokingVertex)
     {
+        mPerfCounters.stateCallsIssued++;
         mFunctions->provokingVertex(mode);
         mProvokingVertex = mode;
 
@@ -2718,10 +2823,12 @@ void StateManagerGL::setProvokingVertex(GLenum mode)
 
 void StateManagerGL::setClipDistancesEnable(const gl::ClipDistanceEnableBits &enables)
 {
+    mPerfCounters.stateCalls++;
     if (enables == mEnabledClipDistances)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
     ASSERT(mMaxClipDistances <= gl::IMPLEMENTATION_MAX_CLIP_DISTANCES);
 
     gl::ClipDistanceEnableBits diff = enables ^ mEnabledClipDistances;
@@ -2744,10 +2851,12 @@ void StateManagerGL::setClipDistancesEnable(const gl::ClipDistanceEnableBits &en
 
 void StateManagerGL::setLogicOpEnabled(bool enabled)
 {
+    mPerfCounters.stateCalls++;
     if (enabled == mLogicOpEnabled)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
     mLogicOpEnabled = enabled;
 
     if (enabled)
@@ -2765,10 +2874,12 @@ void StateManagerGL::setLogicOpEnabled(bool enabled)
 
 void StateManagerGL::setLogicOp(gl::LogicalOperation opcode)
 {
+    mPerfCounters.stateCalls++;
     if (opcode == mLogicOp)
     {
         return;
     }
+    mPerfCounters.stateCallsIssued++;
     mLogicOp = opcode;
 
     mFunctions->logicOp(ToGLenum(opcode));
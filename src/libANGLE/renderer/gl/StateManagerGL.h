@@ -338,6 +338,8 @@ class StateManagerGL final : angle::NonCopyable
 
     void validateState() const;
 
+    const angle::GLPerfCounters &getPerfCounters() const { return mPerfCounters; }
+
     void syncFromNativeContext(const gl::Extensions &extensions, ExternalContextState *state);
     void restoreNativeContext(const gl::Extensions &extensions, const ExternalContextState *state);
 
@@ -585,6 +587,8 @@ class StateManagerGL final : angle::NonCopyable
     gl::state::DirtyBits mLocalDirtyBits;
     gl::state::ExtendedDirtyBits mLocalExtendedDirtyBits;
     gl::AttributesMask mLocalDirtyCurrentValues;
+
+    angle::GLPerfCounters mPerfCounters;
 };
 
 }  // namespace rx
@@ -2266,6 +2266,18 @@ LoadImageFunctionInfo LUMINANCE_ALPHA32F_EXT_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo PALETTE4_R5_G6_B5_OES_to_R5G6B5_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadPalettedToPacked16<4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo PALETTE4_R5_G6_B5_OES_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -2278,6 +2290,18 @@ LoadImageFunctionInfo PALETTE4_R5_G6_B5_OES_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo PALETTE4_RGB5_A1_OES_to_R5G5B5A1_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadPalettedToPacked16<4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo PALETTE4_RGB5_A1_OES_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -2302,6 +2326,18 @@ LoadImageFunctionInfo PALETTE4_RGB8_OES_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo PALETTE4_RGBA4_OES_to_R4G4B4A4_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadPalettedToPacked16<4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo PALETTE4_RGBA4_OES_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -2326,6 +2362,18 @@ LoadImageFunctionInfo PALETTE4_RGBA8_OES_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo PALETTE8_R5_G6_B5_OES_to_R5G6B5_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadPalettedToPacked16<8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo PALETTE8_R5_G6_B5_OES_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -2338,6 +2386,18 @@ LoadImageFunctionInfo PALETTE8_R5_G6_B5_OES_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo PALETTE8_RGB5_A1_OES_to_R5G5B5A1_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadPalettedToPacked16<8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo PALETTE8_RGB5_A1_OES_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -2362,6 +2422,18 @@ LoadImageFunctionInfo PALETTE8_RGB8_OES_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo PALETTE8_RGBA4_OES_to_R4G4B4A4_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadPalettedToPacked16<8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo PALETTE8_RGBA4_OES_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -4677,6 +4749,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::R5G6B5_UNORM:
+                    return PALETTE4_R5_G6_B5_OES_to_R5G6B5_UNORM;
                 case FormatID::R8G8B8A8_UNORM:
                     return PALETTE4_R5_G6_B5_OES_to_R8G8B8A8_UNORM;
                 default:
@@ -4688,6 +4762,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::R5G5B5A1_UNORM:
+                    return PALETTE4_RGB5_A1_OES_to_R5G5B5A1_UNORM;
                 case FormatID::R8G8B8A8_UNORM:
                     return PALETTE4_RGB5_A1_OES_to_R8G8B8A8_UNORM;
                 default:
@@ -4710,6 +4786,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::R4G4B4A4_UNORM:
+                    return PALETTE4_RGBA4_OES_to_R4G4B4A4_UNORM;
                 case FormatID::R8G8B8A8_UNORM:
                     return PALETTE4_RGBA4_OES_to_R8G8B8A8_UNORM;
                 default:
@@ -4732,6 +4810,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::R5G6B5_UNORM:
+                    return PALETTE8_R5_G6_B5_OES_to_R5G6B5_UNORM;
                 case FormatID::R8G8B8A8_UNORM:
                     return PALETTE8_R5_G6_B5_OES_to_R8G8B8A8_UNORM;
                 default:
@@ -4743,6 +4823,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::R5G5B5A1_UNORM:
+                    return PALETTE8_RGB5_A1_OES_to_R5G5B5A1_UNORM;
                 case FormatID::R8G8B8A8_UNORM:
                     return PALETTE8_RGB5_A1_OES_to_R8G8B8A8_UNORM;
                 default:
@@ -4765,6 +4847,8 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
         {
             switch (angleFormat)
             {
+                case FormatID::R4G4B4A4_UNORM:
+                    return PALETTE8_RGBA4_OES_to_R4G4B4A4_UNORM;
                 case FormatID::R8G8B8A8_UNORM:
                     return PALETTE8_RGBA4_OES_to_R8G8B8A8_UNORM;
                 default:
@@ -84,6 +84,24 @@ struct IndexConversionBufferMtl : public ConversionBufferMtl
     bool primitiveRestartEnabled;
 };
 
+// Indices rewritten for last-vertex-provoking draws, see ProvokingVertexHelper.
+struct ProvokingVertexConversionBufferMtl : public ConversionBufferMtl
+{
+    ProvokingVertexConversionBufferMtl(ContextMtl *context,
+                                       gl::DrawElementsType elemTypeIn,
+                                       gl::PrimitiveMode modeIn,
+                                       bool primitiveRestartEnabledIn,
+                                       size_t firstIndexIn,
+                                       GLsizei countIn);
+
+    // The conversion is identified by the draw it was generated for.
+    const gl::DrawElementsType elemType;
+    const gl::PrimitiveMode mode;
+    const bool primitiveRestartEnabled;
+    const size_t firstIndex;
+    const GLsizei count;
+};
+
 struct UniformConversionBufferMtl : public ConversionBufferMtl
 {
     UniformConversionBufferMtl(ContextMtl *context,
@@ -185,6 +203,14 @@ class BufferMtl : public BufferImpl, public BufferHolderMtl
                                                        bool primitiveRestartEnabled,
                                                        size_t offset);
 
+    ProvokingVertexConversionBufferMtl *getProvokingVertexConversionBuffer(
+        ContextMtl *context,
+        gl::DrawElementsType elemType,
+        gl::PrimitiveMode mode,
+        bool primitiveRestartEnabled,
+        size_t firstIndex,
+        GLsizei count);
+
     ConversionBufferMtl *getUniformConversionBuffer(ContextMtl *context,
                                                     uint64_t programSerialId,
                                                     std::pair<size_t, size_t> offset,
@@ -251,6 +277,10 @@ class BufferMtl : public BufferImpl, public BufferHolderMtl
 
     std::vector<IndexConversionBufferMtl> mIndexConversionBuffers;
 
+    // A cache of the index ranges rewritten for the provoking vertex, so that a flat-shaded draw
+    // repeated every frame only runs the compute pass again after the buffer is modified.
+    std::deque<ProvokingVertexConversionBufferMtl> mProvokingVertexConversionBuffers;
+
     // TODO(crbug.com/500942658): Consider using LRU cache
     std::deque<UniformConversionBufferMtl> mUniformConversionBuffers;
 
@@ -77,6 +77,22 @@ IndexConversionBufferMtl::IndexConversionBufferMtl(ContextMtl *context,
       primitiveRestartEnabled(primitiveRestartEnabledIn)
 {}
 
+// ProvokingVertexConversionBufferMtl implementation.
+ProvokingVertexConversionBufferMtl::ProvokingVertexConversionBufferMtl(
+    ContextMtl *context,
+    gl::DrawElementsType elemTypeIn,
+    gl::PrimitiveMode modeIn,
+    bool primitiveRestartEnabledIn,
+    size_t firstIndexIn,
+    GLsizei countIn)
+    : ConversionBufferMtl(context, 0, mtl::kIndexBufferOffsetAlignment),
+      elemType(elemTypeIn),
+      mode(modeIn),
+      primitiveRestartEnabled(primitiveRestartEnabledIn),
+      firstIndex(firstIndexIn),
+      count(countIn)
+{}
+
 // UniformConversionBufferMtl implementation
 UniformConversionBufferMtl::UniformConversionBufferMtl(ContextMtl *context,
                                                        uint64_t programSerialIdIn,
@@ -417,6 +433,37 @@ IndexConversionBufferMtl *BufferMtl::getIndexConversionBuffer(ContextMtl *contex
     return &mIndexConversionBuffers.back();
 }
 
+ProvokingVertexConversionBufferMtl *BufferMtl::getProvokingVertexConversionBuffer(
+    ContextMtl *context,
+    gl::DrawElementsType elemType,
+    gl::PrimitiveMode mode,
+    bool primitiveRestartEnabled,
+    size_t firstIndex,
+    GLsizei count)
+{
+    // The range must match exactly, as the winding of strip primitives depends on their position
+    // relative to the first index of the draw.
+    for (ProvokingVertexConversionBufferMtl &buffer : mProvokingVertexConversionBuffers)
+    {
+        if (buffer.elemType == elemType && buffer.mode == mode &&
+            buffer.primitiveRestartEnabled == primitiveRestartEnabled &&
+            buffer.firstIndex == firstIndex && buffer.count == count)
+        {
+            return &buffer;
+        }
+    }
+
+    constexpr size_t kMaxCacheSize = 16;
+    if (mProvokingVertexConversionBuffers.size() >= kMaxCacheSize)
+    {
+        mProvokingVertexConversionBuffers.pop_front();
+    }
+
+    mProvokingVertexConversionBuffers.emplace_back(context, elemType, mode,
+                                                   primitiveRestartEnabled, firstIndex, count);
+    return &mProvokingVertexConversionBuffers.back();
+}
+
 ConversionBufferMtl *BufferMtl::getUniformConversionBuffer(ContextMtl *context,
                                                            uint64_t programSerialId,
                                                            std::pair<size_t, size_t> offset,
@@ -457,6 +504,12 @@ void BufferMtl::markConversionBuffersDirty()
         buffer.buffer = {};
     }
 
+    for (ProvokingVertexConversionBufferMtl &buffer : mProvokingVertexConversionBuffers)
+    {
+        buffer.dirty  = true;
+        buffer.buffer = {};
+    }
+
     for (UniformConversionBufferMtl &buffer : mUniformConversionBuffers)
     {
         buffer.dirty  = true;
@@ -469,6 +522,7 @@ void BufferMtl::clearConversionBuffers()
 {
     mVertexConversionBuffers.clear();
     mIndexConversionBuffers.clear();
+    mProvokingVertexConversionBuffers.clear();
     mUniformConversionBuffers.clear();
     mDrawIndexRangeCache.reset();
 }
@@ -301,6 +301,10 @@ class ContextMtl : public ContextImpl, public mtl::Context
     angle::Result onOcclusionQueryBegin(const gl::Context *context, QueryMtl *query);
     void onOcclusionQueryEnd(const gl::Context *context, QueryMtl *query);
     void onOcclusionQueryDestroy(const gl::Context *context, QueryMtl *query);
+    angle::Result allocateOcclusionQueryResult(mtl::BufferRef *bufferOut, uint32_t *offsetOut)
+    {
+        return mOcclusionQueryPool.allocateQueryResult(this, bufferOut, offsetOut);
+    }
 
     // Useful for temporarily pause then restart occlusion query during clear/blit with draw.
     bool hasActiveOcclusionQuery() const { return mOcclusionQuery; }
@@ -401,6 +405,8 @@ class ContextMtl : public ContextImpl, public mtl::Context
 
     mtl::BufferManager &getBufferManager() { return mBufferManager; }
 
+    mtl::BufferHeap &getBufferHeap() { return mBufferHeap; }
+
     ProvokingVertexHelper &getProvokingVertexHelper() { return mProvokingVertexHelper; }
 
     mtl::PipelineCache &getPipelineCache() { return mPipelineCache; }
@@ -630,6 +636,9 @@ class ContextMtl : public ContextImpl, public mtl::Context
 
     mtl::BufferManager mBufferManager;
 
+    // Heaps for the buffers of the streaming buffer pools
+    mtl::BufferHeap mBufferHeap;
+
     // Lineloop and TriFan index buffer
     mtl::BufferPool mLineLoopIndexBuffer;
     mtl::BufferPool mLineLoopLastSegmentIndexBuffer;
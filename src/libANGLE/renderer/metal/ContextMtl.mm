@@ -197,7 +197,8 @@ ContextMtl::ContextMtl(const gl::State &state,
       mCmdBuffer(&display->cmdQueue()),
       mRenderEncoder(&mCmdBuffer,
                      mOcclusionQueryPool,
-                     display->getFeatures().emulateDontCareLoadWithRandomClear.enabled),
+                     display->getFeatures().emulateDontCareLoadWithRandomClear.enabled,
+                     display->getFeatures().enableParallelRenderEncoding.enabled),
       mBlitEncoder(&mCmdBuffer),
       mComputeEncoder(&mCmdBuffer),
       mDriverUniforms{},
@@ -239,6 +240,7 @@ void ContextMtl::onDestroy(const gl::Context *context)
     mLineLoopIndexBuffer.destroy(this);
     mLineLoopLastSegmentIndexBuffer.destroy(this);
     mOcclusionQueryPool.destroy(this);
+    mBufferHeap.destroy();
 
     mIncompleteTextures.onDestroy(context);
     mProvokingVertexHelper.onDestroy(this);
@@ -256,6 +258,7 @@ angle::Result ContextMtl::flush(const gl::Context *context)
     // needed. This is typically required if two MTLDevices are
     // operating on the same IOSurface.
     flushCommandBuffer(mtl::NoWait);
+    getDisplay()->getRenderPipelineBinaryArchive().storeIfDirty(getDisplay()->getDisplay(), false);
     return checkCommandBufferError();
 }
 angle::Result ContextMtl::finish(const gl::Context *context)
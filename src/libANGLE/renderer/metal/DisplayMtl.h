@@ -18,6 +18,7 @@
 #include "libANGLE/renderer/metal/mtl_context_device.h"
 #include "libANGLE/renderer/metal/mtl_format_utils.h"
 #include "libANGLE/renderer/metal/mtl_library_cache.h"
+#include "libANGLE/renderer/metal/mtl_pipeline_cache.h"
 #include "libANGLE/renderer/metal/mtl_render_utils.h"
 #include "libANGLE/renderer/metal/mtl_state_cache.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
@@ -154,6 +155,10 @@ class DisplayMtl : public DisplayImpl
     mtl::RenderUtils &getUtils() { return *mUtils; }
     mtl::StateCache &getStateCache() { return mStateCache; }
     mtl::LibraryCache &getLibraryCache() { return mLibraryCache; }
+    mtl::RenderPipelineBinaryArchive &getRenderPipelineBinaryArchive()
+    {
+        return mRenderPipelineBinaryArchive;
+    }
     uint32_t getMaxColorTargetBits() { return mMaxColorTargetBits; }
     bool hasFragmentMemoryBarriers() const { return mHasFragmentMemoryBarriers; }
 
@@ -206,6 +211,7 @@ class DisplayMtl : public DisplayImpl
     mutable mtl::FormatTable mFormatTable;
     mtl::StateCache mStateCache;
     mtl::LibraryCache mLibraryCache;
+    mtl::RenderPipelineBinaryArchive mRenderPipelineBinaryArchive;
     std::unique_ptr<mtl::RenderUtils> mUtils;
 
     // Built-in Shaders
@@ -166,6 +166,9 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
 
 void DisplayMtl::terminate()
 {
+    mRenderPipelineBinaryArchive.storeIfDirty(mDisplay, true);
+    mRenderPipelineBinaryArchive.reset();
+
     mUtils = nullptr;
     mCmdQueue.reset();
     mDefaultShaders      = nil;
@@ -1284,6 +1287,18 @@ void DisplayMtl::initializeFeatures()
     ANGLE_FEATURE_CONDITION((&mFeatures), enableInMemoryMtlLibraryCache, true);
     ANGLE_FEATURE_CONDITION((&mFeatures), enableParallelMtlLibraryCompilation, true);
 
+    // Binary archives are not supported by the simulator's GPU.
+    ANGLE_FEATURE_CONDITION((&mFeatures), useRenderPipelineBinaryArchive, !isSimulator);
+
+    // Encoding is the largest CPU cost of big render passes on Apple GPUs.  Off by default until
+    // SimpleOperationTest.DrawManyQuadsInOneRenderPass passes with it forced on Apple GPUs.
+    ANGLE_FEATURE_CONDITION((&mFeatures), enableParallelRenderEncoding, false);
+
+    // Shared storage heaps need an Apple GPU.  Heap allocations can't be attributed to another
+    // task's memory footprint, so they are not used with ownership identities.
+    ANGLE_FEATURE_CONDITION((&mFeatures), allocateStreamingBuffersFromHeap,
+                            supportsAppleGPUFamily(1) && !ANGLE_USE_METAL_OWNERSHIP_IDENTITY);
+
     // Uploading texture data via staging buffers improves performance on all tested systems.
     // http://anglebug.com/40644905: Disabled on intel due to some texture formats uploading
     // incorrectly with staging buffers
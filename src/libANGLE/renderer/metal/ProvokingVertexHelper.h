@@ -27,6 +27,8 @@ class ProvokingVertexHelper : angle::NonCopyable
 {
   public:
     ProvokingVertexHelper(ContextMtl *context);
+    // The rewritten indices are allocated from |newIndexBufferPool| if not null, otherwise from a
+    // pool of the helper that is recycled once the command buffer completes.
     angle::Result preconditionIndexBuffer(ContextMtl *context,
                                           GLsizei count,
                                           gl::PrimitiveMode mode,
@@ -35,6 +37,7 @@ class ProvokingVertexHelper : angle::NonCopyable
                                           const std::vector<DrawIndexRange> &drawIndexRanges,
                                           mtl::BufferSlice indexBuffer,
                                           gl::DrawElementsType indexBufferType,
+                                          mtl::BufferPool *newIndexBufferPool,
                                           mtl::BufferSlice *outNewIndexBuffer);
 
     angle::Result generateIndexBuffer(ContextMtl *context,
@@ -198,6 +198,7 @@ angle::Result ProvokingVertexHelper::preconditionIndexBuffer(
     const std::vector<DrawIndexRange> &drawIndexRanges,
     mtl::BufferSlice indexBuffer,
     gl::DrawElementsType indexBufferType,
+    mtl::BufferPool *newIndexBufferPool,
     mtl::BufferSlice *outNewIndexBuffer)
 {
     // Get specialized program
@@ -241,7 +242,8 @@ angle::Result ProvokingVertexHelper::preconditionIndexBuffer(
     checkedBufferSize += newFirstIndexOffset;
     ANGLE_CHECK_GL_MATH(context, checkedBufferSize.IsValid());
     mtl::BufferSlice newBuffer;
-    ANGLE_TRY(mIndexBuffers.allocate(context, checkedBufferSize.ValueOrDie(), &newBuffer));
+    mtl::BufferPool &bufferPool = newIndexBufferPool ? *newIndexBufferPool : mIndexBuffers;
+    ANGLE_TRY(bufferPool.allocate(context, checkedBufferSize.ValueOrDie(), &newBuffer));
 
     mtl::ComputeCommandEncoder *encoder =
         context->getComputeCommandEncoderWithoutEndingRenderEncoder();
@@ -94,8 +94,9 @@ class QueryMtl : public QueryImpl
     void addAllocatedVisibilityOffset() { mVisibilityBufferOffsets.addOffset(); }
 
     void clearAllocatedVisibilityOffsets() { mVisibilityBufferOffsets.clear(); }
-    // Returns the buffer containing the final occlusion query result.
+    // Returns the buffer, and offset within it, containing the final occlusion query result.
     const mtl::BufferRef &getVisibilityResultBuffer() const { return mVisibilityResultBuffer; }
+    uint32_t getVisibilityResultOffset() const { return mVisibilityResultOffset; }
     // Reset the occlusion query result stored in buffer to zero
     void resetVisibilityResult(ContextMtl *contextMtl);
     void onTransformFeedbackEnd(const gl::Context *context);
@@ -113,6 +114,7 @@ class QueryMtl : public QueryImpl
     // List of offsets in the render pass's occlusion query pool buffer allocated for this query
     VisibilityBufferOffsetsMtl mVisibilityBufferOffsets;
     mtl::BufferRef mVisibilityResultBuffer;
+    uint32_t mVisibilityResultOffset = 0;
 
     size_t mTransformFeedbackPrimitivesDrawn = 0;
 
@@ -38,18 +38,10 @@ angle::Result QueryMtl::begin(const gl::Context *context)
     {
         case gl::QueryType::AnySamples:
         case gl::QueryType::AnySamplesConservative:
-            if (!mVisibilityResultBuffer)
-            {
-                // Allocate buffer
-                ANGLE_TRY(mtl::Buffer::MakeBuffer(contextMtl, mtl::kOcclusionQueryResultSize,
-                                                  &mVisibilityResultBuffer));
-
-                ANGLE_MTL_OBJC_SCOPE
-                {
-                    mVisibilityResultBuffer->get().label =
-                        [NSString stringWithFormat:@"QueryMtl=%p", this];
-                }
-            }
+            // The result is stored in a new slice every time, so that reading the result of a
+            // previous use doesn't wait for this one.
+            ANGLE_TRY(contextMtl->allocateOcclusionQueryResult(&mVisibilityResultBuffer,
+                                                               &mVisibilityResultOffset));
 
             ANGLE_TRY(contextMtl->onOcclusionQueryBegin(context, this));
             break;
@@ -127,7 +119,10 @@ angle::Result QueryMtl::waitAndGetResult(const gl::Context *context, T *params)
             }
             // map() will wait for the pending GPU works to finish
             const uint8_t *visibilityResultBytes =
-                mVisibilityResultBuffer->mapReadOnly(contextMtl).data();
+                mVisibilityResultBuffer
+                    ->mapReadOnly(contextMtl, mVisibilityResultOffset,
+                                  mtl::kOcclusionQueryResultSize)
+                    .data();
             uint64_t queryResult;
             memcpy(&queryResult, visibilityResultBytes, sizeof(queryResult));
             mVisibilityResultBuffer->unmap(contextMtl);
@@ -214,8 +209,9 @@ void QueryMtl::resetVisibilityResult(ContextMtl *contextMtl)
 
     // Fill the query's buffer with zeros
     auto blitEncoder = contextMtl->getBlitCommandEncoder();
-    blitEncoder->fillBuffer(mVisibilityResultBuffer, NSMakeRange(0, mtl::kOcclusionQueryResultSize),
-                            0);
+    blitEncoder->fillBuffer(
+        mVisibilityResultBuffer,
+        NSMakeRange(mVisibilityResultOffset, mtl::kOcclusionQueryResultSize), 0);
     mVisibilityResultBuffer->syncContent(contextMtl, blitEncoder);
 }
 
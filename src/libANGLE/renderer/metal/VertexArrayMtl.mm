@@ -902,11 +902,42 @@ angle::Result VertexArrayMtl::resolveDrawElementsDraw(
     // Step 3: Conditionally rewrite the index buffer for provoking vertex.
     // preconditionIndexBuffer dispatches per-range, so with primitive restart it only
     // processes the non-restart runs (not the full buffer).
+    // The rewritten indices of an element array buffer are cached with the buffer until it is
+    // modified.
     if (rewriteProvokingVertex)
     {
-        ANGLE_TRY(contextMtl->getProvokingVertexHelper().preconditionIndexBuffer(
-            contextMtl, count, mode, firstIndex, isPrimitiveRestartEnabled, *indexRanges,
-            std::move(indexBuffer), indexBufferType, &indexBuffer));
+        ProvokingVertexConversionBufferMtl *conversion = nullptr;
+        if (glElementArrayBuffer != nullptr)
+        {
+            BufferMtl *bufferMtl = mtl::GetImpl(glElementArrayBuffer);
+            conversion           = bufferMtl->getProvokingVertexConversionBuffer(
+                contextMtl, type, mode, isPrimitiveRestartEnabled, firstIndex, count);
+        }
+
+        if (conversion != nullptr && !conversion->dirty)
+        {
+            indexBuffer = conversion->buffer;
+        }
+        else
+        {
+            mtl::BufferPool *newIndexBufferPool = nullptr;
+            if (conversion != nullptr)
+            {
+                conversion->bufferPool.releaseInFlightBuffers(contextMtl);
+                newIndexBufferPool = &conversion->bufferPool;
+            }
+
+            ANGLE_TRY(contextMtl->getProvokingVertexHelper().preconditionIndexBuffer(
+                contextMtl, count, mode, firstIndex, isPrimitiveRestartEnabled, *indexRanges,
+                std::move(indexBuffer), indexBufferType, newIndexBufferPool, &indexBuffer));
+
+            if (conversion != nullptr)
+            {
+                ANGLE_TRY(conversion->bufferPool.commit(contextMtl));
+                conversion->dirty  = false;
+                conversion->buffer = indexBuffer;
+            }
+        }
     }
 
     // Step 4: Compute draw command ranges (handles primitive restart splitting and large draw
@@ -13,6 +13,7 @@
 #include "libANGLE/renderer/metal/mtl_resources.h"
 
 #include <deque>
+#include <vector>
 
 namespace rx
 {
@@ -22,6 +23,27 @@ class ContextMtl;
 namespace mtl
 {
 
+// Creates the shared storage buffers of a context's buffer pools inside a few large MTLHeaps,
+// instead of allocating each of them from the device.  The heap memory of a buffer is reused once
+// the buffer is released, which Metal delays until the command buffers using it have completed.
+class BufferHeap : angle::NonCopyable
+{
+  public:
+    BufferHeap();
+    ~BufferHeap();
+
+    // Falls back to a device allocation for storage modes and sizes that the heaps don't hold.
+    angle::Result allocateBuffer(ContextMtl *contextMtl,
+                                 MTLStorageMode storageMode,
+                                 size_t size,
+                                 BufferRef *bufferOut);
+
+    void destroy();
+
+  private:
+    std::vector<angle::ObjCPtr<id<MTLHeap>>> mHeaps;
+};
+
 // A buffer pool is conceptually an infinitely long buffer. Each time you write to the buffer,
 // you will always write to a previously unused portion. After a series of writes, you must flush
 // the buffer data to the device. Buffer lifetime currently assumes that each new allocation will
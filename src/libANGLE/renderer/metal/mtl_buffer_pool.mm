@@ -22,6 +22,74 @@ namespace rx
 namespace mtl
 {
 
+namespace
+{
+constexpr size_t kBufferHeapSize          = 4 * 1024 * 1024;
+constexpr size_t kBufferHeapMaxBufferSize = 1024 * 1024;
+}  // namespace
+
+// BufferHeap implementation.
+BufferHeap::BufferHeap() = default;
+
+BufferHeap::~BufferHeap()
+{
+    destroy();
+}
+
+angle::Result BufferHeap::allocateBuffer(ContextMtl *contextMtl,
+                                         MTLStorageMode storageMode,
+                                         size_t size,
+                                         BufferRef *bufferOut)
+{
+    if (storageMode != MTLStorageModeShared || size > kBufferHeapMaxBufferSize)
+    {
+        return Buffer::MakeBufferWithStorageMode(contextMtl, storageMode, size, bufferOut);
+    }
+
+    const mtl::ContextDevice &metalDevice = contextMtl->getMetalDevice();
+    const MTLSizeAndAlign sizeAndAlign =
+        [metalDevice heapBufferSizeAndAlignWithLength:size options:MTLResourceStorageModeShared];
+
+    id<MTLHeap> heap = nil;
+    for (const angle::ObjCPtr<id<MTLHeap>> &candidate : mHeaps)
+    {
+        if ([candidate maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size)
+        {
+            heap = candidate;
+            break;
+        }
+    }
+
+    if (!heap)
+    {
+        ANGLE_MTL_OBJC_SCOPE
+        {
+            auto heapDesc = angle::adoptObjCPtr([[MTLHeapDescriptor alloc] init]);
+            heapDesc.get().size        = kBufferHeapSize;
+            heapDesc.get().storageMode = MTLStorageModeShared;
+            // Keep the same synchronization as buffers allocated from the device.
+            heapDesc.get().hazardTrackingMode = MTLHazardTrackingModeTracked;
+
+            angle::ObjCPtr<id<MTLHeap>> newHeap = metalDevice.newHeapWithDescriptor(heapDesc);
+            if (!newHeap)
+            {
+                return Buffer::MakeBufferWithStorageMode(contextMtl, storageMode, size,
+                                                         bufferOut);
+            }
+            heap = newHeap;
+            mHeaps.push_back(std::move(newHeap));
+        }
+    }
+
+    return Buffer::MakeBufferFromHeap(contextMtl, heap, size, bufferOut);
+}
+
+void BufferHeap::destroy()
+{
+    // Buffers allocated from the heaps keep them alive until they are released.
+    mHeaps.clear();
+}
+
 // BufferPool implementation.
 BufferPool::BufferPool() : BufferPool(false) {}
 
@@ -142,8 +210,16 @@ angle::Result BufferPool::allocateNewBuffer(ContextMtl *contextMtl)
         return angle::Result::Continue;
     }
 
-    ANGLE_TRY(
-        Buffer::MakeBufferWithStorageMode(contextMtl, storageMode(contextMtl), mSize, &mBuffer));
+    if (contextMtl->getDisplay()->getFeatures().allocateStreamingBuffersFromHeap.enabled)
+    {
+        ANGLE_TRY(contextMtl->getBufferHeap().allocateBuffer(contextMtl, storageMode(contextMtl),
+                                                               mSize, &mBuffer));
+    }
+    else
+    {
+        ANGLE_TRY(Buffer::MakeBufferWithStorageMode(contextMtl, storageMode(contextMtl), mSize,
+                                                    &mBuffer));
+    }
 
     ASSERT(mBuffer);
 
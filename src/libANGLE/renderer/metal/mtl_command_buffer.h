@@ -330,13 +330,33 @@ class IntermediateCommandStream
         return *this;
     }
 
+    inline void clear() { mBuffer.clear(); }
+
+    inline size_t size() const { return mBuffer.size(); }
+    inline const uint8_t *data() const { return mBuffer.data(); }
+
+  private:
+    std::vector<uint8_t> mBuffer;
+};
+
+// Reads back a range of an IntermediateCommandStream.  Several readers can decode disjoint ranges
+// of the same stream concurrently.
+class IntermediateCommandReader
+{
+  public:
+    IntermediateCommandReader(const IntermediateCommandStream &stream, size_t begin, size_t end)
+        : mData(stream.data()), mReadPtr(begin), mEnd(end)
+    {
+        ASSERT(begin <= end && end <= stream.size());
+    }
+
     template <typename T>
     inline T peek()
     {
-        ASSERT(mReadPtr <= mBuffer.size() - sizeof(T));
+        ASSERT(mReadPtr <= mEnd - sizeof(T));
         T re;
         auto ptr = reinterpret_cast<uint8_t *>(&re);
-        std::copy(mBuffer.data() + mReadPtr, mBuffer.data() + mReadPtr + sizeof(T), ptr);
+        std::copy(mData + mReadPtr, mData + mReadPtr + sizeof(T), ptr);
         return re;
     }
 
@@ -350,29 +370,18 @@ class IntermediateCommandStream
 
     inline const uint8_t *fetch(size_t bytes)
     {
-        ASSERT(mReadPtr <= mBuffer.size() - bytes);
+        ASSERT(mReadPtr <= mEnd - bytes);
         auto cur = mReadPtr;
         mReadPtr += bytes;
-        return mBuffer.data() + cur;
+        return mData + cur;
     }
 
-    inline void clear()
-    {
-        mBuffer.clear();
-        mReadPtr = 0;
-    }
-
-    inline void resetReadPtr(size_t readPtr)
-    {
-        ASSERT(readPtr <= mBuffer.size());
-        mReadPtr = readPtr;
-    }
-
-    inline bool good() const { return mReadPtr < mBuffer.size(); }
+    inline bool good() const { return mReadPtr < mEnd; }
 
   private:
-    std::vector<uint8_t> mBuffer;
-    size_t mReadPtr = 0;
+    const uint8_t *mData;
+    size_t mReadPtr;
+    const size_t mEnd;
 };
 
 // Per shader stage's states
@@ -426,7 +435,8 @@ class RenderCommandEncoder final : public CommandEncoder
   public:
     RenderCommandEncoder(CommandBuffer *cmdBuffer,
                          const OcclusionQueryPool &queryPool,
-                         bool emulateDontCareLoadOpWithRandomClear);
+                         bool emulateDontCareLoadOpWithRandomClear,
+                         bool parallelEncoding);
     ~RenderCommandEncoder() override;
 
     // override CommandEncoder
@@ -623,6 +633,7 @@ class RenderCommandEncoder final : public CommandEncoder
                                  ObjCAttachmentDescriptor *objCRenderPassAttachment);
 
     void encodeMetalEncoder();
+    void encodeMetalParallelEncoder();
     void simulateDiscardFramebuffer();
     void endEncodingImpl(bool considerDiscardSimulation);
 
@@ -631,6 +642,9 @@ class RenderCommandEncoder final : public CommandEncoder
                                           size_t offset,
                                           uint32_t index);
 
+    void onDrawRecorded();
+    void releaseParallelEncodingChunks();
+
     RenderPassDesc mRenderPassDesc;
     // Cached Objective-C render pass desc to avoid re-allocate every frame.
     angle::ObjCPtr<MTLRenderPassDescriptor> mCachedRenderPassDescObjC;
@@ -655,7 +669,25 @@ class RenderCommandEncoder final : public CommandEncoder
     bool mPipelineStateSet = false;
     uint64_t mSerial       = 0;
 
+    // A point in mCommands where a worker of the parallel encoder can start encoding.  The states
+    // left behind by the commands before it are replayed first, including the setBytes data that
+    // is still bound.
+    struct ParallelEncodingChunk
+    {
+        size_t commandsOffset;
+        RenderCommandEncoderStates states;
+        std::vector<size_t> setBytesCmdOffsets;
+    };
+    std::vector<ParallelEncodingChunk> mParallelEncodingChunks;
+    gl::ShaderMap<std::array<size_t, kMaxShaderBuffers>> mSetBytesCmdOffsets;
+    uint32_t mDrawsSinceParallelEncodingChunk = 0;
+    uint32_t mDebugGroupDepth                 = 0;
+    // Resource usage and memory barriers only apply within one encoder, so they keep the render
+    // pass on a single encoder.
+    bool mParallelEncodingBlocked = false;
+
     const bool mEmulateDontCareLoadOpWithRandomClear;
+    const bool mParallelEncoding;
 };
 
 class BlitCommandEncoder final : public CommandEncoder
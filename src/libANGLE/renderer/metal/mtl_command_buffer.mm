@@ -93,13 +93,13 @@ enum class CmdType : uint8_t
 };
 
 // Commands decoder
-inline void InvalidCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void InvalidCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     UNREACHABLE();
 }
 
 inline void SetRenderPipelineStateCmd(id<MTLRenderCommandEncoder> encoder,
-                                      IntermediateCommandStream *stream)
+                                      IntermediateCommandReader *stream)
 {
     id<MTLRenderPipelineState> state = stream->fetch<id<MTLRenderPipelineState>>();
     [encoder setRenderPipelineState:state];
@@ -107,34 +107,34 @@ inline void SetRenderPipelineStateCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetTriangleFillModeCmd(id<MTLRenderCommandEncoder> encoder,
-                                   IntermediateCommandStream *stream)
+                                   IntermediateCommandReader *stream)
 {
     MTLTriangleFillMode mode = stream->fetch<MTLTriangleFillMode>();
     [encoder setTriangleFillMode:mode];
 }
 
 inline void SetFrontFacingWindingCmd(id<MTLRenderCommandEncoder> encoder,
-                                     IntermediateCommandStream *stream)
+                                     IntermediateCommandReader *stream)
 {
     MTLWinding winding = stream->fetch<MTLWinding>();
     [encoder setFrontFacingWinding:winding];
 }
 
-inline void SetCullModeCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void SetCullModeCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     MTLCullMode mode = stream->fetch<MTLCullMode>();
     [encoder setCullMode:mode];
 }
 
 inline void SetDepthStencilStateCmd(id<MTLRenderCommandEncoder> encoder,
-                                    IntermediateCommandStream *stream)
+                                    IntermediateCommandReader *stream)
 {
     id<MTLDepthStencilState> state = stream->fetch<id<MTLDepthStencilState>>();
     [encoder setDepthStencilState:state];
     [state ANGLE_MTL_RELEASE];
 }
 
-inline void SetDepthBiasCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void SetDepthBiasCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     float depthBias  = stream->fetch<float>();
     float slopeScale = stream->fetch<float>();
@@ -143,14 +143,14 @@ inline void SetDepthBiasCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCom
 }
 
 inline void SetDepthClipModeCmd(id<MTLRenderCommandEncoder> encoder,
-                                IntermediateCommandStream *stream)
+                                IntermediateCommandReader *stream)
 {
     MTLDepthClipMode depthClipMode = stream->fetch<MTLDepthClipMode>();
     [encoder setDepthClipMode:depthClipMode];
 }
 
 inline void SetStencilRefValsCmd(id<MTLRenderCommandEncoder> encoder,
-                                 IntermediateCommandStream *stream)
+                                 IntermediateCommandReader *stream)
 {
     // Metal has some bugs when reference values are larger than 0xff
     uint32_t frontRef = stream->fetch<uint32_t>();
@@ -158,20 +158,20 @@ inline void SetStencilRefValsCmd(id<MTLRenderCommandEncoder> encoder,
     [encoder setStencilFrontReferenceValue:frontRef backReferenceValue:backRef];
 }
 
-inline void SetViewportCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void SetViewportCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     MTLViewport viewport = stream->fetch<MTLViewport>();
     [encoder setViewport:viewport];
 }
 
 inline void SetScissorRectCmd(id<MTLRenderCommandEncoder> encoder,
-                              IntermediateCommandStream *stream)
+                              IntermediateCommandReader *stream)
 {
     MTLScissorRect rect = stream->fetch<MTLScissorRect>();
     [encoder setScissorRect:rect];
 }
 
-inline void SetBlendColorCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void SetBlendColorCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     float r = stream->fetch<float>();
     float g = stream->fetch<float>();
@@ -181,7 +181,7 @@ inline void SetBlendColorCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCo
 }
 
 inline void SetVertexBufferCmd(id<MTLRenderCommandEncoder> encoder,
-                               IntermediateCommandStream *stream)
+                               IntermediateCommandReader *stream)
 {
     id<MTLBuffer> buffer = stream->fetch<id<MTLBuffer>>();
     size_t offset        = stream->fetch<size_t>();
@@ -191,7 +191,7 @@ inline void SetVertexBufferCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetVertexBufferOffsetCmd(id<MTLRenderCommandEncoder> encoder,
-                                     IntermediateCommandStream *stream)
+                                     IntermediateCommandReader *stream)
 {
     size_t offset   = stream->fetch<size_t>();
     uint32_t index  = stream->fetch<uint32_t>();
@@ -199,7 +199,7 @@ inline void SetVertexBufferOffsetCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetVertexBytesCmd(id<MTLRenderCommandEncoder> encoder,
-                              IntermediateCommandStream *stream)
+                              IntermediateCommandReader *stream)
 {
     size_t size          = stream->fetch<size_t>();
     const uint8_t *bytes = stream->fetch(size);
@@ -208,7 +208,7 @@ inline void SetVertexBytesCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetVertexSamplerStateCmd(id<MTLRenderCommandEncoder> encoder,
-                                     IntermediateCommandStream *stream)
+                                     IntermediateCommandReader *stream)
 {
     id<MTLSamplerState> state = stream->fetch<id<MTLSamplerState>>();
     float lodMinClamp         = stream->fetch<float>();
@@ -223,7 +223,7 @@ inline void SetVertexSamplerStateCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetVertexTextureCmd(id<MTLRenderCommandEncoder> encoder,
-                                IntermediateCommandStream *stream)
+                                IntermediateCommandReader *stream)
 {
     id<MTLTexture> texture = stream->fetch<id<MTLTexture>>();
     uint32_t index         = stream->fetch<uint32_t>();
@@ -232,7 +232,7 @@ inline void SetVertexTextureCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetFragmentBufferCmd(id<MTLRenderCommandEncoder> encoder,
-                                 IntermediateCommandStream *stream)
+                                 IntermediateCommandReader *stream)
 {
     id<MTLBuffer> buffer = stream->fetch<id<MTLBuffer>>();
     size_t offset        = stream->fetch<size_t>();
@@ -242,7 +242,7 @@ inline void SetFragmentBufferCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetFragmentBufferOffsetCmd(id<MTLRenderCommandEncoder> encoder,
-                                       IntermediateCommandStream *stream)
+                                       IntermediateCommandReader *stream)
 {
     size_t offset  = stream->fetch<size_t>();
     uint32_t index = stream->fetch<uint32_t>();
@@ -250,7 +250,7 @@ inline void SetFragmentBufferOffsetCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetFragmentBytesCmd(id<MTLRenderCommandEncoder> encoder,
-                                IntermediateCommandStream *stream)
+                                IntermediateCommandReader *stream)
 {
     size_t size          = stream->fetch<size_t>();
     const uint8_t *bytes = stream->fetch(size);
@@ -259,7 +259,7 @@ inline void SetFragmentBytesCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetFragmentSamplerStateCmd(id<MTLRenderCommandEncoder> encoder,
-                                       IntermediateCommandStream *stream)
+                                       IntermediateCommandReader *stream)
 {
     id<MTLSamplerState> state = stream->fetch<id<MTLSamplerState>>();
     float lodMinClamp         = stream->fetch<float>();
@@ -273,7 +273,7 @@ inline void SetFragmentSamplerStateCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void SetFragmentTextureCmd(id<MTLRenderCommandEncoder> encoder,
-                                  IntermediateCommandStream *stream)
+                                  IntermediateCommandReader *stream)
 {
     id<MTLTexture> texture = stream->fetch<id<MTLTexture>>();
     uint32_t index         = stream->fetch<uint32_t>();
@@ -281,7 +281,7 @@ inline void SetFragmentTextureCmd(id<MTLRenderCommandEncoder> encoder,
     [texture ANGLE_MTL_RELEASE];
 }
 
-inline void DrawCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void DrawCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     MTLPrimitiveType primitiveType = stream->fetch<MTLPrimitiveType>();
     uint32_t vertexStart           = stream->fetch<uint32_t>();
@@ -289,7 +289,7 @@ inline void DrawCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStre
     [encoder drawPrimitives:primitiveType vertexStart:vertexStart vertexCount:vertexCount];
 }
 
-inline void DrawInstancedCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void DrawInstancedCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     MTLPrimitiveType primitiveType = stream->fetch<MTLPrimitiveType>();
     uint32_t vertexStart           = stream->fetch<uint32_t>();
@@ -302,7 +302,7 @@ inline void DrawInstancedCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCo
 }
 
 inline void DrawInstancedBaseInstanceCmd(id<MTLRenderCommandEncoder> encoder,
-                                         IntermediateCommandStream *stream)
+                                         IntermediateCommandReader *stream)
 {
     MTLPrimitiveType primitiveType = stream->fetch<MTLPrimitiveType>();
     uint32_t vertexStart           = stream->fetch<uint32_t>();
@@ -316,7 +316,7 @@ inline void DrawInstancedBaseInstanceCmd(id<MTLRenderCommandEncoder> encoder,
                baseInstance:baseInstance];
 }
 
-inline void DrawIndexedCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void DrawIndexedCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     MTLPrimitiveType primitiveType = stream->fetch<MTLPrimitiveType>();
     uint32_t indexCount            = stream->fetch<uint32_t>();
@@ -332,7 +332,7 @@ inline void DrawIndexedCmd(id<MTLRenderCommandEncoder> encoder, IntermediateComm
 }
 
 inline void DrawIndexedInstancedCmd(id<MTLRenderCommandEncoder> encoder,
-                                    IntermediateCommandStream *stream)
+                                    IntermediateCommandReader *stream)
 {
     MTLPrimitiveType primitiveType = stream->fetch<MTLPrimitiveType>();
     uint32_t indexCount            = stream->fetch<uint32_t>();
@@ -350,7 +350,7 @@ inline void DrawIndexedInstancedCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void DrawIndexedInstancedBaseVertexBaseInstanceCmd(id<MTLRenderCommandEncoder> encoder,
-                                                          IntermediateCommandStream *stream)
+                                                          IntermediateCommandReader *stream)
 {
     MTLPrimitiveType primitiveType = stream->fetch<MTLPrimitiveType>();
     uint32_t indexCount            = stream->fetch<uint32_t>();
@@ -372,14 +372,14 @@ inline void DrawIndexedInstancedBaseVertexBaseInstanceCmd(id<MTLRenderCommandEnc
 }
 
 inline void SetVisibilityResultModeCmd(id<MTLRenderCommandEncoder> encoder,
-                                       IntermediateCommandStream *stream)
+                                       IntermediateCommandReader *stream)
 {
     MTLVisibilityResultMode mode = stream->fetch<MTLVisibilityResultMode>();
     size_t offset                = stream->fetch<size_t>();
     [encoder setVisibilityResultMode:mode offset:offset];
 }
 
-inline void UseResourceCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void UseResourceCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     id<MTLResource> resource = stream->fetch<id<MTLResource>>();
     MTLResourceUsage usage   = stream->fetch<MTLResourceUsage>();
@@ -388,7 +388,7 @@ inline void UseResourceCmd(id<MTLRenderCommandEncoder> encoder, IntermediateComm
     [resource ANGLE_MTL_RELEASE];
 }
 
-inline void MemoryBarrierCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void MemoryBarrierCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     MTLBarrierScope scope  = stream->fetch<MTLBarrierScope>();
     MTLRenderStages after  = stream->fetch<MTLRenderStages>();
@@ -397,7 +397,7 @@ inline void MemoryBarrierCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCo
 }
 
 inline void MemoryBarrierWithResourceCmd(id<MTLRenderCommandEncoder> encoder,
-                                         IntermediateCommandStream *stream)
+                                         IntermediateCommandReader *stream)
 {
     id<MTLResource> resource = stream->fetch<id<MTLResource>>();
     MTLRenderStages after    = stream->fetch<MTLRenderStages>();
@@ -407,7 +407,7 @@ inline void MemoryBarrierWithResourceCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void InsertDebugSignpostCmd(id<MTLRenderCommandEncoder> encoder,
-                                   IntermediateCommandStream *stream)
+                                   IntermediateCommandReader *stream)
 {
     NSString *label = stream->fetch<NSString *>();
     [encoder insertDebugSignpost:label];
@@ -415,18 +415,148 @@ inline void InsertDebugSignpostCmd(id<MTLRenderCommandEncoder> encoder,
 }
 
 inline void PushDebugGroupCmd(id<MTLRenderCommandEncoder> encoder,
-                              IntermediateCommandStream *stream)
+                              IntermediateCommandReader *stream)
 {
     NSString *label = stream->fetch<NSString *>();
     [encoder pushDebugGroup:label];
     [label ANGLE_MTL_RELEASE];
 }
 
-inline void PopDebugGroupCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+inline void PopDebugGroupCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
 {
     [encoder popDebugGroup];
 }
 
+inline void DecodeCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandReader *stream)
+{
+    CmdType cmdType = stream->fetch<CmdType>();
+    switch (cmdType)
+    {
+#define ANGLE_MTL_CMD_MAP(CMD)     \
+    case CmdType::CMD:             \
+        CMD##Cmd(encoder, stream); \
+        break;
+        ANGLE_MTL_CMD_X(ANGLE_MTL_CMD_MAP)
+#undef ANGLE_MTL_CMD_MAP
+    }
+}
+
+// Number of draws recorded into a render pass between two chunks of the parallel encoder.
+constexpr uint32_t kDrawsPerParallelEncodingChunk = 256;
+constexpr size_t kInvalidCmdOffset                = std::numeric_limits<size_t>::max();
+
+template <typename ObjCPtrFunc>
+void ForEachRenderStateObject(const RenderCommandEncoderStates &states, ObjCPtrFunc &&func)
+{
+    func(states.renderPipeline);
+    func(states.depthStencilState);
+    for (const RenderCommandEncoderShaderStates &shaderStates : states.perShaderStates)
+    {
+        for (id<MTLBuffer> buffer : shaderStates.buffers)
+        {
+            func(buffer);
+        }
+        for (id<MTLSamplerState> sampler : shaderStates.samplers)
+        {
+            func(sampler);
+        }
+        for (id<MTLTexture> texture : shaderStates.textures)
+        {
+            func(texture);
+        }
+    }
+}
+
+// Sets the states that the commands before a parallel encoding chunk have left behind on the
+// fresh encoder of that chunk.
+void ApplyRenderStates(id<MTLRenderCommandEncoder> encoder,
+                       const RenderCommandEncoderStates &states)
+{
+    if (states.renderPipeline)
+    {
+        [encoder setRenderPipelineState:states.renderPipeline];
+    }
+    [encoder setTriangleFillMode:states.triangleFillMode];
+    [encoder setFrontFacingWinding:states.winding];
+    [encoder setCullMode:states.cullMode];
+    if (states.depthStencilState)
+    {
+        [encoder setDepthStencilState:states.depthStencilState];
+    }
+    [encoder setDepthBias:states.depthBias
+               slopeScale:states.depthSlopeScale
+                    clamp:states.depthClamp];
+    [encoder setDepthClipMode:states.depthClipMode];
+    [encoder setStencilFrontReferenceValue:states.stencilFrontRef
+                        backReferenceValue:states.stencilBackRef];
+    if (states.viewport.valid())
+    {
+        [encoder setViewport:states.viewport.value()];
+    }
+    if (states.scissorRect.valid())
+    {
+        [encoder setScissorRect:states.scissorRect.value()];
+    }
+    [encoder setBlendColorRed:states.blendColor[0]
+                        green:states.blendColor[1]
+                         blue:states.blendColor[2]
+                        alpha:states.blendColor[3]];
+
+    const RenderCommandEncoderShaderStates &vertexStates =
+        states.perShaderStates[gl::ShaderType::Vertex];
+    const RenderCommandEncoderShaderStates &fragmentStates =
+        states.perShaderStates[gl::ShaderType::Fragment];
+    for (uint32_t index = 0; index < kMaxShaderBuffers; ++index)
+    {
+        if (vertexStates.buffers[index])
+        {
+            [encoder setVertexBuffer:vertexStates.buffers[index]
+                              offset:vertexStates.bufferOffsets[index]
+                             atIndex:index];
+        }
+        if (fragmentStates.buffers[index])
+        {
+            [encoder setFragmentBuffer:fragmentStates.buffers[index]
+                                offset:fragmentStates.bufferOffsets[index]
+                               atIndex:index];
+        }
+    }
+    for (uint32_t index = 0; index < kMaxShaderSamplers; ++index)
+    {
+        if (vertexStates.samplers[index] && vertexStates.samplerLodClamps[index].valid())
+        {
+            const std::pair<float, float> &lodClamps = vertexStates.samplerLodClamps[index].value();
+            [encoder setVertexSamplerState:vertexStates.samplers[index]
+                               lodMinClamp:lodClamps.first
+                               lodMaxClamp:lodClamps.second
+                                   atIndex:index];
+        }
+        if (fragmentStates.samplers[index] && fragmentStates.samplerLodClamps[index].valid())
+        {
+            const std::pair<float, float> &lodClamps =
+                fragmentStates.samplerLodClamps[index].value();
+            [encoder setFragmentSamplerState:fragmentStates.samplers[index]
+                                 lodMinClamp:lodClamps.first
+                                 lodMaxClamp:lodClamps.second
+                                     atIndex:index];
+        }
+        if (vertexStates.textures[index])
+        {
+            [encoder setVertexTexture:vertexStates.textures[index] atIndex:index];
+        }
+        if (fragmentStates.textures[index])
+        {
+            [encoder setFragmentTexture:fragmentStates.textures[index] atIndex:index];
+        }
+    }
+
+    if (states.visibilityResultMode != MTLVisibilityResultModeDisabled)
+    {
+        [encoder setVisibilityResultMode:states.visibilityResultMode
+                                  offset:states.visibilityResultBufferOffset];
+    }
+}
+
 NSString *cppLabelToObjC(const std::string &marker)
 {
     NSString *label = [NSString stringWithUTF8String:marker.c_str()];
@@ -1361,10 +1491,12 @@ void RenderCommandEncoderStates::reset()
 // RenderCommandEncoder implemtation
 RenderCommandEncoder::RenderCommandEncoder(CommandBuffer *cmdBuffer,
                                            const OcclusionQueryPool &queryPool,
-                                           bool emulateDontCareLoadOpWithRandomClear)
+                                           bool emulateDontCareLoadOpWithRandomClear,
+                                           bool parallelEncoding)
     : CommandEncoder(cmdBuffer, RENDER),
       mOcclusionQueryPool(queryPool),
-      mEmulateDontCareLoadOpWithRandomClear(emulateDontCareLoadOpWithRandomClear)
+      mEmulateDontCareLoadOpWithRandomClear(emulateDontCareLoadOpWithRandomClear),
+      mParallelEncoding(parallelEncoding)
 {
     ANGLE_MTL_OBJC_SCOPE
     {
@@ -1397,8 +1529,16 @@ RenderCommandEncoder::RenderCommandEncoder(CommandBuffer *cmdBuffer,
     mSetSamplerCmds[gl::ShaderType::Vertex] = static_cast<uint8_t>(CmdType::SetVertexSamplerState);
     mSetSamplerCmds[gl::ShaderType::Fragment] =
         static_cast<uint8_t>(CmdType::SetFragmentSamplerState);
+
+    for (std::array<size_t, kMaxShaderBuffers> &offsets : mSetBytesCmdOffsets)
+    {
+        offsets.fill(kInvalidCmdOffset);
+    }
+}
+RenderCommandEncoder::~RenderCommandEncoder()
+{
+    releaseParallelEncodingChunks();
 }
-RenderCommandEncoder::~RenderCommandEncoder() {}
 
 void RenderCommandEncoder::reset()
 {
@@ -1406,6 +1546,57 @@ void RenderCommandEncoder::reset()
     mRecording        = false;
     mPipelineStateSet = false;
     mCommands.clear();
+
+    releaseParallelEncodingChunks();
+    for (std::array<size_t, kMaxShaderBuffers> &offsets : mSetBytesCmdOffsets)
+    {
+        offsets.fill(kInvalidCmdOffset);
+    }
+    mDrawsSinceParallelEncodingChunk = 0;
+    mDebugGroupDepth                 = 0;
+    mParallelEncodingBlocked         = false;
+}
+
+void RenderCommandEncoder::releaseParallelEncodingChunks()
+{
+    for (ParallelEncodingChunk &chunk : mParallelEncodingChunks)
+    {
+        ForEachRenderStateObject(chunk.states, [](id object) { [object ANGLE_MTL_RELEASE]; });
+    }
+    mParallelEncodingChunks.clear();
+}
+
+void RenderCommandEncoder::onDrawRecorded()
+{
+    if (!mParallelEncoding || mParallelEncodingBlocked)
+    {
+        return;
+    }
+
+    // Debug groups can't span two encoders, so wait for the current one to be popped.
+    if (++mDrawsSinceParallelEncodingChunk < kDrawsPerParallelEncodingChunk || mDebugGroupDepth > 0)
+    {
+        return;
+    }
+    mDrawsSinceParallelEncodingChunk = 0;
+
+    ParallelEncodingChunk &chunk = mParallelEncodingChunks.emplace_back();
+    chunk.commandsOffset         = mCommands.size();
+    chunk.states                 = mStateCache;
+    // The commands that set these objects release them once they are decoded, which may happen on
+    // another worker before this chunk replays them.
+    ForEachRenderStateObject(chunk.states, [](id object) { [object ANGLE_MTL_RETAIN]; });
+
+    for (const std::array<size_t, kMaxShaderBuffers> &offsets : mSetBytesCmdOffsets)
+    {
+        for (size_t offset : offsets)
+        {
+            if (offset != kInvalidCmdOffset)
+            {
+                chunk.setBytesCmdOffsets.push_back(offset);
+            }
+        }
+    }
 }
 
 template <typename ObjCAttachmentDescriptor>
@@ -1664,6 +1855,12 @@ void RenderCommandEncoder::encodeMetalEncoder()
 {
     ANGLE_MTL_OBJC_SCOPE
     {
+        if (!mParallelEncodingChunks.empty() && !mParallelEncodingBlocked)
+        {
+            encodeMetalParallelEncoder();
+            return;
+        }
+
         ANGLE_MTL_LOG("Creating new render command encoder with desc: %@",
                       [mCachedRenderPassDescObjC description]);
 
@@ -1684,24 +1881,88 @@ void RenderCommandEncoder::encodeMetalEncoder()
             metalCmdEncoder.label = mLabel;
         }
 
-        while (mCommands.good())
+        IntermediateCommandReader reader(mCommands, 0, mCommands.size());
+        while (reader.good())
         {
-            CmdType cmdType = mCommands.fetch<CmdType>();
-            switch (cmdType)
-            {
-#define ANGLE_MTL_CMD_MAP(CMD)                 \
-    case CmdType::CMD:                         \
-        CMD##Cmd(metalCmdEncoder, &mCommands); \
-        break;
-                ANGLE_MTL_CMD_X(ANGLE_MTL_CMD_MAP)
-#undef ANGLE_MTL_CMD_MAP
-            }
+            DecodeCmd(metalCmdEncoder, &reader);
         }
 
         mCommands.clear();
     }
 }
 
+void RenderCommandEncoder::encodeMetalParallelEncoder()
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        ANGLE_MTL_LOG("Creating new parallel render command encoder with desc: %@",
+                      [mCachedRenderPassDescObjC description]);
+
+        id<MTLParallelRenderCommandEncoder> parallelEncoder = [cmdBuffer().get()
+            parallelRenderCommandEncoderWithDescriptor:mCachedRenderPassDescObjC];
+
+        set(parallelEncoder);
+
+        // Verify that it was created successfully
+        ASSERT(parallelEncoder);
+
+        if (mLabel)
+        {
+            parallelEncoder.label = mLabel;
+        }
+
+        // The sub-encoders execute in the order they are created, so create them all here before
+        // handing them out to the workers.
+        const size_t chunkCount = mParallelEncodingChunks.size() + 1;
+        std::vector<id<MTLRenderCommandEncoder>> chunkEncoders(chunkCount);
+        for (id<MTLRenderCommandEncoder> &chunkEncoder : chunkEncoders)
+        {
+            chunkEncoder = [parallelEncoder renderCommandEncoder];
+        }
+
+        id<MTLRenderCommandEncoder> *chunkEncoderList = chunkEncoders.data();
+        dispatch_apply(
+            chunkCount, dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0),
+            ^(size_t chunkIndex) {
+              ANGLE_MTL_OBJC_SCOPE
+              {
+                  id<MTLRenderCommandEncoder> chunkEncoder = chunkEncoderList[chunkIndex];
+
+                  // Same iOS driver work-around as in encodeMetalEncoder().
+                  [chunkEncoder setStencilReferenceValue:0];
+
+                  size_t begin = 0;
+                  if (chunkIndex > 0)
+                  {
+                      const ParallelEncodingChunk &chunk = mParallelEncodingChunks[chunkIndex - 1];
+                      ApplyRenderStates(chunkEncoder, chunk.states);
+                      // Decoding setBytes commands again has no side effects.
+                      for (size_t offset : chunk.setBytesCmdOffsets)
+                      {
+                          IntermediateCommandReader setBytesReader(mCommands, offset,
+                                                                   mCommands.size());
+                          DecodeCmd(chunkEncoder, &setBytesReader);
+                      }
+                      begin = chunk.commandsOffset;
+                  }
+                  const size_t end = chunkIndex + 1 < chunkCount
+                                         ? mParallelEncodingChunks[chunkIndex].commandsOffset
+                                         : mCommands.size();
+
+                  IntermediateCommandReader reader(mCommands, begin, end);
+                  while (reader.good())
+                  {
+                      DecodeCmd(chunkEncoder, &reader);
+                  }
+
+                  [chunkEncoder endEncoding];
+              }
+            });
+
+        mCommands.clear();
+    }
+}
+
 RenderCommandEncoder &RenderCommandEncoder::restart(const RenderPassDesc &desc,
                                                     uint32_t deviceMaxRenderTargets)
 {
@@ -1968,7 +2229,8 @@ RenderCommandEncoder &RenderCommandEncoder::commonSetBuffer(gl::ShaderType shade
         }
 
         // If buffer already bound but with different offset, then update the offer only.
-        shaderStates.bufferOffsets[index] = offset;
+        shaderStates.bufferOffsets[index]      = offset;
+        mSetBytesCmdOffsets[shaderType][index] = kInvalidCmdOffset;
 
         mCommands.push(static_cast<CmdType>(mSetBufferOffsetCmds[shaderType]))
             .push(offset)
@@ -1977,8 +2239,9 @@ RenderCommandEncoder &RenderCommandEncoder::commonSetBuffer(gl::ShaderType shade
         return *this;
     }
 
-    shaderStates.buffers[index]       = mtlBuffer;
-    shaderStates.bufferOffsets[index] = offset;
+    shaderStates.buffers[index]            = mtlBuffer;
+    shaderStates.bufferOffsets[index]      = offset;
+    mSetBytesCmdOffsets[shaderType][index] = kInvalidCmdOffset;
 
     mCommands.push(static_cast<CmdType>(mSetBufferCmds[shaderType]))
         .push([mtlBuffer ANGLE_MTL_RETAIN])
@@ -2001,6 +2264,7 @@ RenderCommandEncoder &RenderCommandEncoder::setBytes(gl::ShaderType shaderType,
     RenderCommandEncoderShaderStates &shaderStates = mStateCache.perShaderStates[shaderType];
     shaderStates.buffers[index]                    = nil;
     shaderStates.bufferOffsets[index]              = 0;
+    mSetBytesCmdOffsets[shaderType][index]         = mCommands.size();
 
     mCommands.push(static_cast<CmdType>(mSetBytesCmds[shaderType]))
         .push(size)
@@ -2094,6 +2358,8 @@ RenderCommandEncoder &RenderCommandEncoder::draw(MTLPrimitiveType primitiveType,
     mHasDrawCalls = true;
     mCommands.push(CmdType::Draw).push(primitiveType).push(vertexStart).push(vertexCount);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -2112,6 +2378,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawInstanced(MTLPrimitiveType primi
         .push(vertexCount)
         .push(instances);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -2133,6 +2401,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawInstancedBaseInstance(
         .push(instances)
         .push(baseInstance);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -2160,6 +2430,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexed(MTLPrimitiveType primiti
         .push([indexBuffer->get() ANGLE_MTL_RETAIN])
         .push(bufferOffset);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -2189,6 +2461,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexedInstanced(MTLPrimitiveTyp
         .push(bufferOffset)
         .push(instances);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -2223,6 +2497,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexedInstancedBaseVertexBaseIn
         .push(baseVertex)
         .push(baseInstance);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -2252,6 +2528,7 @@ RenderCommandEncoder &RenderCommandEncoder::useResource(const BufferRef &resourc
 
     cmdBuffer().setReadDependency(resource, /*isRenderCommand=*/true);
 
+    mParallelEncodingBlocked = true;
     mCommands.push(CmdType::UseResource)
         .push([resource->get() ANGLE_MTL_RETAIN])
         .push(usage)
@@ -2264,6 +2541,7 @@ RenderCommandEncoder &RenderCommandEncoder::memoryBarrier(MTLBarrierScope scope,
                                                           MTLRenderStages after,
                                                           MTLRenderStages before)
 {
+    mParallelEncodingBlocked = true;
     mCommands.push(CmdType::MemoryBarrier).push(scope).push(after).push(before);
     return *this;
 }
@@ -2279,6 +2557,7 @@ RenderCommandEncoder &RenderCommandEncoder::memoryBarrierWithResource(const Buff
 
     cmdBuffer().setWriteDependency(resource, /*isRenderCommand=*/true);
 
+    mParallelEncodingBlocked = true;
     mCommands.push(CmdType::MemoryBarrierWithResource)
         .push([resource->get() ANGLE_MTL_RETAIN])
         .push(after)
@@ -2297,10 +2576,15 @@ void RenderCommandEncoder::pushDebugGroup(NSString *label)
 {
     // Defer the insertion until endEncoding()
     mCommands.push(CmdType::PushDebugGroup).push([label ANGLE_MTL_RETAIN]);
+    ++mDebugGroupDepth;
 }
 void RenderCommandEncoder::popDebugGroup()
 {
     mCommands.push(CmdType::PopDebugGroup);
+    if (mDebugGroupDepth > 0)
+    {
+        --mDebugGroupDepth;
+    }
 }
 
 RenderCommandEncoder &RenderCommandEncoder::setColorStoreAction(MTLStoreAction action,
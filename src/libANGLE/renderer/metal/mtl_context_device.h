@@ -41,6 +41,7 @@ class ContextDevice final : public WrappedObject<id<MTLDevice>>, angle::NonCopya
     angle::ObjCPtr<id<MTLBuffer>> newBufferWithBytes(const void *pointer,
                                                      NSUInteger length,
                                                      MTLResourceOptions options) const;
+    angle::ObjCPtr<id<MTLHeap>> newHeapWithDescriptor(MTLHeapDescriptor *descriptor) const;
 
     angle::ObjCPtr<id<MTLComputePipelineState>> newComputePipelineStateWithFunction(
         id<MTLFunction> computeFunction,
@@ -48,6 +49,10 @@ class ContextDevice final : public WrappedObject<id<MTLDevice>>, angle::NonCopya
     angle::ObjCPtr<id<MTLRenderPipelineState>> newRenderPipelineStateWithDescriptor(
         MTLRenderPipelineDescriptor *descriptor,
         __autoreleasing NSError **error) const;
+    angle::ObjCPtr<id<MTLRenderPipelineState>> newRenderPipelineStateWithDescriptor(
+        MTLRenderPipelineDescriptor *descriptor,
+        MTLPipelineOption options,
+        __autoreleasing NSError **error) const;
 
     angle::ObjCPtr<id<MTLDepthStencilState>> newDepthStencilStateWithDescriptor(
         MTLDepthStencilDescriptor *descriptor) const;
@@ -94,6 +94,12 @@ angle::ObjCPtr<id<MTLBuffer>> ContextDevice::newBufferWithBytes(const void *poin
     return resource;
 }
 
+angle::ObjCPtr<id<MTLHeap>> ContextDevice::newHeapWithDescriptor(
+    MTLHeapDescriptor *descriptor) const
+{
+    return angle::adoptObjCPtr([get() newHeapWithDescriptor:descriptor]);
+}
+
 angle::ObjCPtr<id<MTLComputePipelineState>> ContextDevice::newComputePipelineStateWithFunction(
     id<MTLFunction> computeFunction,
     __autoreleasing NSError **error) const
@@ -109,6 +115,17 @@ angle::ObjCPtr<id<MTLRenderPipelineState>> ContextDevice::newRenderPipelineState
     return angle::adoptObjCPtr([get() newRenderPipelineStateWithDescriptor:descriptor error:error]);
 }
 
+angle::ObjCPtr<id<MTLRenderPipelineState>> ContextDevice::newRenderPipelineStateWithDescriptor(
+    MTLRenderPipelineDescriptor *descriptor,
+    MTLPipelineOption options,
+    __autoreleasing NSError **error) const
+{
+    return angle::adoptObjCPtr([get() newRenderPipelineStateWithDescriptor:descriptor
+                                                                   options:options
+                                                                reflection:nil
+                                                                     error:error]);
+}
+
 angle::ObjCPtr<id<MTLDepthStencilState>> ContextDevice::newDepthStencilStateWithDescriptor(
     MTLDepthStencilDescriptor *descriptor) const
 {
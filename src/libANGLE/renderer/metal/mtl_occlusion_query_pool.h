@@ -33,6 +33,14 @@ class OcclusionQueryPool
 
     void destroy(ContextMtl *contextMtl);
 
+    // Allocate the slice of a buffer that holds the final result of a query, done on every begin.
+    // Slices are allocated in order from one buffer until a command buffer using it is committed.
+    // Consecutive queries of a render pass thus usually have consecutive slices, which are resolved
+    // with a single copy, and waiting for a result doesn't wait for later command buffers.
+    angle::Result allocateQueryResult(ContextMtl *contextMtl,
+                                      BufferRef *bufferOut,
+                                      uint32_t *offsetOut);
+
     // Allocate an offset in visibility buffer for a query in a render pass.
     // - clearOldValue = true, if the old value of query will be cleared before combining in the
     // visibility resolve pass. This flag is only allowed to be false for the first allocation of
@@ -60,6 +68,14 @@ class OcclusionQueryPool
 
     bool mResetFirstQuery = false;
     bool mUsed            = false;
+
+    // Buffer that query result slices are currently allocated from
+    BufferRef mCurrentResultBuffer;
+    uint64_t mCurrentResultBufferStartSerial = 0;
+    uint32_t mCurrentResultBufferNextOffset  = 0;
+    // Buffers that slices are no longer allocated from.  They are reused once no query refers to
+    // them and the GPU is done with them.
+    std::vector<BufferRef> mRetiredResultBuffers;
 };
 
 }  // namespace mtl
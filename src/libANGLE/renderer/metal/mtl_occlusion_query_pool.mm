@@ -17,6 +17,32 @@ namespace rx
 {
 namespace mtl
 {
+namespace
+{
+constexpr uint32_t kOcclusionQueryResultsPerBuffer = 128;
+
+// A copy of the results of consecutive queries from the render pass's visibility buffer.
+struct VisibilityResultCopy
+{
+    const BufferRef *dstBuffer = nullptr;
+    uint32_t srcOffset         = 0;
+    uint32_t dstOffset         = 0;
+    uint32_t size              = 0;
+};
+
+void FlushVisibilityResultCopy(ContextMtl *contextMtl,
+                               const BufferRef &srcBuffer,
+                               VisibilityResultCopy *copy)
+{
+    if (copy->size > 0)
+    {
+        contextMtl->getBlitCommandEncoder()->copyBuffer(srcBuffer, copy->srcOffset,
+                                                        *copy->dstBuffer, copy->dstOffset,
+                                                        copy->size);
+        copy->size = 0;
+    }
+}
+}  // anonymous namespace
 
 // OcclusionQueryPool implementation
 OcclusionQueryPool::OcclusionQueryPool() {}
@@ -25,6 +51,8 @@ OcclusionQueryPool::~OcclusionQueryPool() {}
 void OcclusionQueryPool::destroy(ContextMtl *contextMtl)
 {
     mRenderPassResultsPool = nullptr;
+    mCurrentResultBuffer   = nullptr;
+    mRetiredResultBuffers.clear();
     for (QueryMtl *allocatedQuery : mAllocatedQueries)
     {
         if (!allocatedQuery)
@@ -36,6 +64,51 @@ void OcclusionQueryPool::destroy(ContextMtl *contextMtl)
     mAllocatedQueries.clear();
 }
 
+angle::Result OcclusionQueryPool::allocateQueryResult(ContextMtl *contextMtl,
+                                                      BufferRef *bufferOut,
+                                                      uint32_t *offsetOut)
+{
+    if (mCurrentResultBuffer &&
+        (mCurrentResultBufferNextOffset + kOcclusionQueryResultSize >
+             mCurrentResultBuffer->size() ||
+         (!mCurrentResultBuffer->hasPendingWorks(contextMtl) &&
+          mCurrentResultBuffer->getCommandBufferQueueSerial() != mCurrentResultBufferStartSerial)))
+    {
+        mRetiredResultBuffers.push_back(std::move(mCurrentResultBuffer));
+        mCurrentResultBuffer = nullptr;
+    }
+
+    if (!mCurrentResultBuffer)
+    {
+        for (auto iter = mRetiredResultBuffers.begin(); iter != mRetiredResultBuffers.end(); ++iter)
+        {
+            if (iter->use_count() == 1 && !(*iter)->isBeingUsedByGPU(contextMtl))
+            {
+                mCurrentResultBuffer = std::move(*iter);
+                mRetiredResultBuffers.erase(iter);
+                break;
+            }
+        }
+
+        if (!mCurrentResultBuffer)
+        {
+            constexpr size_t kResultBufferSize =
+                kOcclusionQueryResultSize * kOcclusionQueryResultsPerBuffer;
+            ANGLE_TRY(Buffer::MakeBuffer(contextMtl, kResultBufferSize, &mCurrentResultBuffer));
+            mCurrentResultBuffer->get().label = @"OcclusionQueryResults";
+        }
+
+        mCurrentResultBufferStartSerial = mCurrentResultBuffer->getCommandBufferQueueSerial();
+        mCurrentResultBufferNextOffset  = 0;
+    }
+
+    *bufferOut = mCurrentResultBuffer;
+    *offsetOut = mCurrentResultBufferNextOffset;
+    mCurrentResultBufferNextOffset += static_cast<uint32_t>(kOcclusionQueryResultSize);
+
+    return angle::Result::Continue;
+}
+
 angle::Result OcclusionQueryPool::allocateQueryOffset(ContextMtl *contextMtl,
                                                       QueryMtl *query,
                                                       bool clearOldValue)
@@ -124,7 +197,8 @@ void OcclusionQueryPool::resolveVisibilityResults(ContextMtl *contextMtl)
     // Combine the values stored in the offsets allocated for first query
     if (mAllocatedQueries[0])
     {
-        const BufferRef &dstBuf = mAllocatedQueries[0]->getVisibilityResultBuffer();
+        const BufferRef &dstBuf  = mAllocatedQueries[0]->getVisibilityResultBuffer();
+        const uint32_t dstOffset = mAllocatedQueries[0]->getVisibilityResultOffset();
         const VisibilityBufferOffsetsMtl &allocatedOffsets =
             mAllocatedQueries[0]->getAllocatedVisibilityOffsets();
         if (!mResetFirstQuery &&
@@ -133,19 +207,22 @@ void OcclusionQueryPool::resolveVisibilityResults(ContextMtl *contextMtl)
             // If we cannot read and write to the same buffer in shader. We need to copy the old
             // value of first query to first offset allocated for it.
             blitEncoder = contextMtl->getBlitCommandEncoder();
-            blitEncoder->copyBuffer(dstBuf, 0, mRenderPassResultsPool, allocatedOffsets.front(),
-                                    kOcclusionQueryResultSize);
+            blitEncoder->copyBuffer(dstBuf, dstOffset, mRenderPassResultsPool,
+                                    allocatedOffsets.front(), kOcclusionQueryResultSize);
             utils.combineVisibilityResult(contextMtl, false, allocatedOffsets,
-                                          mRenderPassResultsPool, dstBuf);
+                                          mRenderPassResultsPool, dstBuf, dstOffset);
         }
         else
         {
             utils.combineVisibilityResult(contextMtl, !mResetFirstQuery, allocatedOffsets,
-                                          mRenderPassResultsPool, dstBuf);
+                                          mRenderPassResultsPool, dstBuf, dstOffset);
         }
     }
 
-    // Combine the values stored in the offsets allocated for each of the remaining queries
+    // Combine the values stored in the offsets allocated for each of the remaining queries.  The
+    // results of queries with a single offset are copied, and consecutive queries usually have
+    // consecutive offsets and result slices, in which case a single copy is made for all of them.
+    VisibilityResultCopy copy;
     for (size_t i = 1; i < mAllocatedQueries.size(); ++i)
     {
         QueryMtl *query = mAllocatedQueries[i];
@@ -154,15 +231,36 @@ void OcclusionQueryPool::resolveVisibilityResults(ContextMtl *contextMtl)
             continue;
         }
 
-        const BufferRef &dstBuf = mAllocatedQueries[i]->getVisibilityResultBuffer();
-        const VisibilityBufferOffsetsMtl &allocatedOffsets =
-            mAllocatedQueries[i]->getAllocatedVisibilityOffsets();
-        utils.combineVisibilityResult(contextMtl, false, allocatedOffsets, mRenderPassResultsPool,
-                                      dstBuf);
+        const BufferRef &dstBuf  = query->getVisibilityResultBuffer();
+        const uint32_t dstOffset = query->getVisibilityResultOffset();
+        const VisibilityBufferOffsetsMtl &allocatedOffsets = query->getAllocatedVisibilityOffsets();
+        if (allocatedOffsets.size() > 1)
+        {
+            utils.combineVisibilityResult(contextMtl, false, allocatedOffsets,
+                                          mRenderPassResultsPool, dstBuf, dstOffset);
+            continue;
+        }
+
+        const uint32_t srcOffset = allocatedOffsets.front();
+        if (copy.size > 0 && *copy.dstBuffer == dstBuf && srcOffset == copy.srcOffset + copy.size &&
+            dstOffset == copy.dstOffset + copy.size)
+        {
+            copy.size += static_cast<uint32_t>(kOcclusionQueryResultSize);
+            continue;
+        }
+
+        FlushVisibilityResultCopy(contextMtl, mRenderPassResultsPool, &copy);
+        copy.dstBuffer = &dstBuf;
+        copy.srcOffset = srcOffset;
+        copy.dstOffset = dstOffset;
+        copy.size      = static_cast<uint32_t>(kOcclusionQueryResultSize);
     }
+    FlushVisibilityResultCopy(contextMtl, mRenderPassResultsPool, &copy);
 
-    // Request synchronization and cleanup
-    blitEncoder = contextMtl->getBlitCommandEncoder();
+    // Request synchronization and cleanup.  Queries that share a result buffer only need it
+    // synchronized once.
+    blitEncoder                    = contextMtl->getBlitCommandEncoder();
+    const Buffer *lastSyncedBuffer = nullptr;
     for (size_t i = 0; i < mAllocatedQueries.size(); ++i)
     {
         QueryMtl *query = mAllocatedQueries[i];
@@ -171,9 +269,12 @@ void OcclusionQueryPool::resolveVisibilityResults(ContextMtl *contextMtl)
             continue;
         }
 
-        const BufferRef &dstBuf = mAllocatedQueries[i]->getVisibilityResultBuffer();
-
-        dstBuf->syncContent(contextMtl, blitEncoder);
+        const BufferRef &dstBuf = query->getVisibilityResultBuffer();
+        if (dstBuf.get() != lastSyncedBuffer)
+        {
+            dstBuf->syncContent(contextMtl, blitEncoder);
+            lastSyncedBuffer = dstBuf.get();
+        }
 
         query->clearAllocatedVisibilityOffsets();
     }
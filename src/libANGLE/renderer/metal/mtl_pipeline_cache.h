@@ -10,7 +10,9 @@
 #ifndef LIBANGLE_RENDERER_METAL_MTL_PIPELINE_CACHE_H_
 #define LIBANGLE_RENDERER_METAL_MTL_PIPELINE_CACHE_H_
 
+#include "common/SimpleMutex.h"
 #include "common/hash_utils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
 
@@ -83,6 +85,41 @@ class PipelineCache : angle::NonCopyable
     RenderPipelineMap mPipelineCache;
 };
 
+// A display-wide MTLBinaryArchive of the render pipelines created by all contexts.  The archive
+// is kept in the blob cache, so a later run creates these pipelines from the archive instead of
+// compiling them again.
+class RenderPipelineBinaryArchive : angle::NonCopyable
+{
+  public:
+    RenderPipelineBinaryArchive();
+    ~RenderPipelineBinaryArchive();
+
+    // Make pipelines created with |descriptor| look up the archive.  The archive is loaded from
+    // the blob cache on first use.  Returns false if there is no archive to use.
+    bool attach(ContextMtl *context, MTLRenderPipelineDescriptor *descriptor);
+    // Add the pipeline described by |descriptor| to the archive after an archive miss.
+    void addRenderPipeline(MTLRenderPipelineDescriptor *descriptor);
+    // Store the archive in the blob cache once enough pipelines were added to it, or
+    // unconditionally if |force|.
+    void storeIfDirty(egl::Display *display, bool force);
+
+    void reset();
+
+  private:
+    void load(DisplayMtl *displayMtl);
+
+    // Serializing the archive is not free, so new pipelines are stored in batches.
+    static constexpr uint32_t kPipelinesPerStore = 8;
+
+    angle::SimpleMutex mMutex;
+    angle::ObjCPtr<id<MTLBinaryArchive>> mArchive;
+    // The file the archive was loaded from.  It is kept until the archive is released.
+    angle::ObjCPtr<NSURL> mArchiveURL;
+    egl::BlobCache::Key mBlobKey;
+    bool mLoaded;
+    uint32_t mPendingPipelineCount;
+};
+
 }  // namespace mtl
 }  // namespace rx
 
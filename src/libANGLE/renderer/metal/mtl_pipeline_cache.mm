@@ -13,8 +13,11 @@
 
 #include "libANGLE/renderer/metal/mtl_pipeline_cache.h"
 
+#include "common/angle_version_info.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/ErrorStrings.h"
 #include "libANGLE/renderer/metal/ContextMtl.h"
+#include "libANGLE/renderer/metal/DisplayMtl.h"
 
 namespace rx
 {
@@ -93,6 +96,13 @@ angle::Result ValidateRenderPipelineState(ContextMtl *context,
     return angle::Result::Continue;
 }
 
+NSURL *NewTemporaryArchiveURL()
+{
+    NSString *fileName = [NSString
+        stringWithFormat:@"angle_render_pipelines_%@.metallib", [NSUUID UUID].UUIDString];
+    return [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:fileName]];
+}
+
 angle::Result CreateRenderPipelineState(
     ContextMtl *context,
     const PipelineKey &key,
@@ -120,6 +130,24 @@ angle::Result CreateRenderPipelineState(
             [objCDesc.get().vertexDescriptor.layouts setObject:defaultAttribLayoutObjCDesc
                                             atIndexedSubscript:kDefaultAttribsBindingIndex];
         }
+
+        RenderPipelineBinaryArchive &archive =
+            context->getDisplay()->getRenderPipelineBinaryArchive();
+        if (archive.attach(context, objCDesc))
+        {
+            NSError *archiveErr = nil;
+            auto archivedState  = metalDevice.newRenderPipelineStateWithDescriptor(
+                objCDesc, MTLPipelineOptionFailOnBinaryArchiveMiss, &archiveErr);
+            if (archivedState)
+            {
+                *outRenderPipeline = archivedState;
+                return angle::Result::Continue;
+            }
+
+            // Compile the pipeline into the archive, so it's found there below and in later runs.
+            archive.addRenderPipeline(objCDesc);
+        }
+
         // Create pipeline state
         NSError *err  = nil;
         auto newState = metalDevice.newRenderPipelineStateWithDescriptor(objCDesc, &err);
@@ -255,5 +283,154 @@ angle::Result PipelineCache::getComputePipeline(
     return angle::Result::Continue;
 }
 
+RenderPipelineBinaryArchive::RenderPipelineBinaryArchive()
+    : mLoaded(false), mPendingPipelineCount(0)
+{}
+
+RenderPipelineBinaryArchive::~RenderPipelineBinaryArchive()
+{
+    reset();
+}
+
+bool RenderPipelineBinaryArchive::attach(ContextMtl *context,
+                                         MTLRenderPipelineDescriptor *descriptor)
+{
+    if (!context->getDisplay()->getFeatures().useRenderPipelineBinaryArchive.enabled)
+    {
+        return false;
+    }
+
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    if (!mLoaded)
+    {
+        // Loaded lazily, as the application's blob cache callbacks are only set after the display
+        // is initialized.
+        mLoaded = true;
+        load(context->getDisplay());
+    }
+
+    if (!mArchive)
+    {
+        return false;
+    }
+
+    descriptor.binaryArchives = @[ mArchive.get() ];
+    return true;
+}
+
+void RenderPipelineBinaryArchive::load(DisplayMtl *displayMtl)
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        id<MTLDevice> device = displayMtl->getMetalDevice();
+
+        angle::BlobCacheHasher hasher;
+        hasher.Init();
+
+        const char *archiveName = "ANGLE Metal Render Pipeline Archive: ";
+        hasher.Update(archiveName, strlen(archiveName));
+
+        // Metal ignores archived pipelines compiled for another OS or driver version by itself, so
+        // only the ANGLE version and the device identify the archive.
+        const char *angleVersion = angle::GetANGLEShaderProgramVersion();
+        hasher.Update(angleVersion, strlen(angleVersion));
+        angle::UpdateHashWithValue(hasher, device.registryID);
+        const char *deviceName = device.name.UTF8String;
+        hasher.Update(deviceName, strlen(deviceName));
+
+        hasher.Final();
+        memcpy(mBlobKey.data(), hasher.Digest(), angle::kBlobCacheKeyLength);
+
+        angle::ObjCPtr<MTLBinaryArchiveDescriptor> archiveDesc =
+            angle::adoptObjCPtr([[MTLBinaryArchiveDescriptor alloc] init]);
+
+        angle::ScratchBuffer scratchBuffer;
+        egl::BlobCache::Value blob;
+        if (displayMtl->getDisplay()->getBlobCache().get(nullptr, &scratchBuffer, mBlobKey, &blob))
+        {
+            NSURL *archiveURL = NewTemporaryArchiveURL();
+            NSData *data      = [NSData dataWithBytesNoCopy:const_cast<uint8_t *>(blob.data())
+                                                length:blob.size()
+                                          freeWhenDone:NO];
+            if ([data writeToURL:archiveURL atomically:NO])
+            {
+                mArchiveURL           = archiveURL;
+                archiveDesc.get().url = archiveURL;
+            }
+        }
+
+        NSError *err = nil;
+        mArchive     = angle::adoptObjCPtr([device newBinaryArchiveWithDescriptor:archiveDesc
+                                                                         error:&err]);
+        if (!mArchive && archiveDesc.get().url)
+        {
+            WARN() << "Ignoring unusable Metal render pipeline archive in the blob cache: "
+                   << err.localizedDescription.UTF8String;
+            archiveDesc.get().url = nil;
+            mArchive = angle::adoptObjCPtr([device newBinaryArchiveWithDescriptor:archiveDesc
+                                                                            error:&err]);
+        }
+    }
+}
+
+void RenderPipelineBinaryArchive::addRenderPipeline(MTLRenderPipelineDescriptor *descriptor)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    ASSERT(mArchive);
+
+    NSError *err = nil;
+    if ([mArchive.get() addRenderPipelineFunctionsWithDescriptor:descriptor error:&err])
+    {
+        ++mPendingPipelineCount;
+    }
+}
+
+void RenderPipelineBinaryArchive::storeIfDirty(egl::Display *display, bool force)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    if (!mArchive || mPendingPipelineCount == 0 ||
+        (!force && mPendingPipelineCount < kPipelinesPerStore))
+    {
+        return;
+    }
+    mPendingPipelineCount = 0;
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        NSURL *serializedURL = NewTemporaryArchiveURL();
+        NSError *err         = nil;
+        if (![mArchive.get() serializeToURL:serializedURL error:&err])
+        {
+            WARN() << "Failed to serialize the Metal render pipeline archive: "
+                   << err.localizedDescription.UTF8String;
+            return;
+        }
+
+        NSData *data = [NSData dataWithContentsOfURL:serializedURL];
+        [[NSFileManager defaultManager] removeItemAtURL:serializedURL error:nil];
+
+        angle::MemoryBuffer blob;
+        if (data == nil || !blob.resize(data.length))
+        {
+            return;
+        }
+        memcpy(blob.data(), data.bytes, data.length);
+        display->getBlobCache().putApplication(nullptr, mBlobKey, blob);
+    }
+}
+
+void RenderPipelineBinaryArchive::reset()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    mArchive = nil;
+    if (mArchiveURL)
+    {
+        [[NSFileManager defaultManager] removeItemAtURL:mArchiveURL error:nil];
+        mArchiveURL = nil;
+    }
+    mLoaded               = false;
+    mPendingPipelineCount = 0;
+}
+
 }  // namespace mtl
 }  // namespace rx
@@ -472,7 +472,8 @@ class VisibilityResultUtils final : angle::NonCopyable
         bool keepOldValue,
         const VisibilityBufferOffsetsMtl &renderPassResultBufOffsets,
         const BufferRef &renderPassResultBuf,
-        const BufferRef &finalResultBuf);
+        const BufferRef &finalResultBuf,
+        uint32_t finalResultOffset);
 
   private:
     angle::Result getVisibilityResultCombinePipeline(
@@ -722,7 +723,8 @@ class RenderUtils : angle::NonCopyable
                                  bool keepOldValue,
                                  const VisibilityBufferOffsetsMtl &renderPassResultBufOffsets,
                                  const BufferRef &renderPassResultBuf,
-                                 const BufferRef &finalResultBuf);
+                                 const BufferRef &finalResultBuf,
+                                 uint32_t finalResultOffset);
 
     // Compute based mipmap generation. Only possible for 3D texture for now.
     angle::Result generateMipmapCS(ContextMtl *contextMtl,
@@ -902,12 +902,15 @@ void RenderUtils::combineVisibilityResult(
     bool keepOldValue,
     const VisibilityBufferOffsetsMtl &renderPassResultBufOffsets,
     const BufferRef &renderPassResultBuf,
-    const BufferRef &finalResultBuf)
+    const BufferRef &finalResultBuf,
+    uint32_t finalResultOffset)
 {
     // TODO(geofflang): Propagate this error. It spreads to adding angle::Result return values in
     // most of the metal backend's files.
-    (void)mVisibilityResultUtils.combineVisibilityResult(
-        contextMtl, keepOldValue, renderPassResultBufOffsets, renderPassResultBuf, finalResultBuf);
+    (void)mVisibilityResultUtils.combineVisibilityResult(contextMtl, keepOldValue,
+                                                         renderPassResultBufOffsets,
+                                                         renderPassResultBuf, finalResultBuf,
+                                                         finalResultOffset);
 }
 
 // Compute based mipmap generation
@@ -2165,7 +2168,8 @@ angle::Result VisibilityResultUtils::combineVisibilityResult(
     bool keepOldValue,
     const VisibilityBufferOffsetsMtl &renderPassResultBufOffsets,
     const BufferRef &renderPassResultBuf,
-    const BufferRef &finalResultBuf)
+    const BufferRef &finalResultBuf,
+    uint32_t finalResultOffset)
 {
     ASSERT(!renderPassResultBufOffsets.empty());
 
@@ -2175,7 +2179,7 @@ angle::Result VisibilityResultUtils::combineVisibilityResult(
         BlitCommandEncoder *blitEncoder = contextMtl->getBlitCommandEncoder();
 
         blitEncoder->copyBuffer(renderPassResultBuf, renderPassResultBufOffsets.front(),
-                                finalResultBuf, 0, kOcclusionQueryResultSize);
+                                finalResultBuf, finalResultOffset, kOcclusionQueryResultSize);
         return angle::Result::Continue;
     }
 
@@ -2193,7 +2197,7 @@ angle::Result VisibilityResultUtils::combineVisibilityResult(
 
     cmdEncoder->setData(options, 0);
     cmdEncoder->setBuffer(renderPassResultBuf, 0, 1);
-    cmdEncoder->setBufferForWrite(finalResultBuf, 0, 2);
+    cmdEncoder->setBufferForWrite(finalResultBuf, finalResultOffset, 2);
 
     DispatchCompute(contextMtl, cmdEncoder, pipeline, 1);
 
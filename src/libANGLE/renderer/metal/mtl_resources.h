@@ -448,6 +448,13 @@ class Buffer final : public Resource, public WrappedObject<id<MTLBuffer>>
                                                    size_t size,
                                                    BufferRef *bufferOut);
 
+    // Sub-allocate the buffer from the heap. reset() will keep allocating from the same heap
+    // while it has room.
+    static angle::Result MakeBufferFromHeap(ContextMtl *context,
+                                            id<MTLHeap> heap,
+                                            size_t size,
+                                            BufferRef *bufferOut);
+
     angle::Result reset(ContextMtl *context, MTLStorageMode storageMode, size_t size);
 
     angle::Span<const uint8_t> mapReadOnly(ContextMtl *context, size_t offset = 0);
@@ -485,7 +492,9 @@ class Buffer final : public Resource, public WrappedObject<id<MTLBuffer>>
 
   private:
     Buffer(ContextMtl *context, MTLStorageMode storageMode, size_t size);
+    Buffer(ContextMtl *context, id<MTLHeap> heap, size_t size);
 
+    angle::ObjCPtr<id<MTLHeap>> mHeap;
     bool mMapReadOnly = true;
     // For garbage collecting shadow buffers in BufferManager.
     size_t mContextSwitchesAtLastUse      = 0;
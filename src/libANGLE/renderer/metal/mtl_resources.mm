@@ -1117,11 +1117,26 @@ angle::Result Buffer::MakeBufferWithStorageMode(ContextMtl *context,
     return angle::Result::Continue;
 }
 
+angle::Result Buffer::MakeBufferFromHeap(ContextMtl *context,
+                                         id<MTLHeap> heap,
+                                         size_t size,
+                                         BufferRef *bufferOut)
+{
+    bufferOut->reset(new Buffer(context, heap, size));
+    ANGLE_CHECK_GL_ALLOC(context, *bufferOut && (*bufferOut)->get());
+    return angle::Result::Continue;
+}
+
 Buffer::Buffer(ContextMtl *context, MTLStorageMode storageMode, size_t size)
 {
     (void)reset(context, storageMode, size);
 }
 
+Buffer::Buffer(ContextMtl *context, id<MTLHeap> heap, size_t size) : mHeap(heap)
+{
+    (void)reset(context, heap.storageMode, size);
+}
+
 angle::Result Buffer::reset(ContextMtl *context, MTLStorageMode storageMode, size_t size)
 {
     auto options = resourceOptionsForStorageMode(storageMode);
@@ -1131,6 +1146,15 @@ angle::Result Buffer::reset(ContextMtl *context, MTLStorageMode storageMode, siz
         {
             return nullptr;
         }
+        if (mHeap && mHeap.get().storageMode == storageMode)
+        {
+            angle::ObjCPtr<id<MTLBuffer>> heapBuffer =
+                angle::adoptObjCPtr([mHeap newBufferWithLength:size options:options]);
+            if (heapBuffer)
+            {
+                return heapBuffer;
+            }
+        }
         return metalDevice.newBufferWithLength(size, options);
     }());
     // Reset command buffer's reference serial
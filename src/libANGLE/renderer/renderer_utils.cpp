@@ -13,12 +13,14 @@
 
 #include "libANGLE/renderer/renderer_utils.h"
 
+#include "common/WorkerThread.h"
 #include "common/base/anglebase/numerics/checked_math.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
 #include "common/utilities.h"
 #include "image_util/copyimage.h"
 #include "image_util/imageformats.h"
+#include "image_util/loadimage.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
@@ -26,10 +28,13 @@
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
+#include "libANGLE/trace.h"
 #include "platform/Feature.h"
 
+#include <array>
 #include <cctype>
 #include <cstring>
+#include <thread>
 
 namespace angle
 {
@@ -696,6 +701,144 @@ FastCopyFunction FastCopyFunctionMap::get(angle::FormatID formatID) const
     return entry ? entry->func : nullptr;
 }
 
+namespace
+{
+// Upper bound on the number of stripes a load is split into, and the minimum number of rows (or
+// slices) each stripe gets so that the task overhead stays small relative to the work.
+constexpr size_t kMaxLoadImageStripes     = 8;
+constexpr size_t kMinLoadImageStripeLines = 16;
+
+class LoadImageStripeTask final : public angle::Closure
+{
+  public:
+    LoadImageStripeTask(LoadImageFunction loadFunction,
+                        const angle::ImageLoadContext &context,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mContext(context),
+          mWidth(width),
+          mHeight(height),
+          mDepth(depth),
+          mInput(input),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "LoadImageStripeTask");
+        mLoadFunction(mContext, mWidth, mHeight, mDepth, mInput, mInputRowPitch, mInputDepthPitch,
+                      mOutput, mOutputRowPitch, mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    // The caller waits for all stripes before returning, so the context outlives the task.
+    const angle::ImageLoadContext &mContext;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+
+size_t GetLoadImageStripeCount(size_t lineCount)
+{
+    static const size_t maxStripes =
+        std::min<size_t>(kMaxLoadImageStripes, std::max(1u, std::thread::hardware_concurrency()));
+    return std::min(maxStripes, lineCount / kMinLoadImageStripeLines);
+}
+}  // anonymous namespace
+
+void LoadImageInStripes(LoadImageFunction loadFunction,
+                        const angle::ImageLoadContext &context,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    // Split 3D images by slice, and 2D images by row.
+    const bool splitSlices = depth > 1;
+    const size_t lineCount = splitSlices ? depth : height;
+    const size_t outputSize =
+        depth > 0 && height > 0 ? (depth - 1) * outputDepthPitch + height * outputRowPitch : 0;
+
+    const size_t stripeCount = GetLoadImageStripeCount(lineCount);
+    if (context.parallelLoadThreshold == 0 || outputSize < context.parallelLoadThreshold ||
+        !context.multiThreadPool || !context.multiThreadPool->isAsync() || stripeCount < 2)
+    {
+        loadFunction(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "LoadImageInStripes");
+
+    const size_t inputLinePitch  = splitSlices ? inputDepthPitch : inputRowPitch;
+    const size_t outputLinePitch = splitSlices ? outputDepthPitch : outputRowPitch;
+
+    std::vector<std::shared_ptr<angle::Closure>> pendingTasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    std::shared_ptr<angle::Closure> firstStripe;
+
+    for (size_t stripe = 0; stripe < stripeCount; ++stripe)
+    {
+        const size_t begin = lineCount * stripe / stripeCount;
+        const size_t end   = lineCount * (stripe + 1) / stripeCount;
+
+        auto task = std::make_shared<LoadImageStripeTask>(
+            loadFunction, context, width, splitSlices ? height : end - begin,
+            splitSlices ? end - begin : depth, input + begin * inputLinePitch, inputRowPitch,
+            inputDepthPitch, output + begin * outputLinePitch, outputRowPitch, outputDepthPitch);
+
+        if (stripe == 0)
+        {
+            firstStripe = task;
+            continue;
+        }
+
+        std::shared_ptr<angle::WaitableEvent> waitEvent =
+            context.multiThreadPool->postWorkerTask(task);
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            pendingTasks.push_back(std::move(task));
+        }
+    }
+
+    // The calling thread loads the first stripe, and any stripe the pool could not take.
+    (*firstStripe)();
+    for (const std::shared_ptr<angle::Closure> &task : pendingTasks)
+    {
+        (*task)();
+    }
+
+    angle::WaitableEvent::WaitMany(&waitEvents);
+}
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs)
 {
     EGLAttrib debugSetting =
@@ -1218,8 +1361,9 @@ BufferAndLayout::BufferAndLayout() = default;
 
 BufferAndLayout::~BufferAndLayout() = default;
 
+// Returns whether the data has changed.
 template <typename T>
-ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
+ANGLE_NOINLINE bool UpdateBufferWithLayoutStrided(GLsizei count,
                                                   uint32_t arrayIndex,
                                                   int componentCount,
                                                   const T *v,
@@ -1229,6 +1373,7 @@ ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
     const int elementSize = sizeof(T) * componentCount;
     uint8_t *dst          = uniformData->data() + layoutInfo.offset;
     int maxIndex          = arrayIndex + count;
+    bool changed          = false;
     for (int writeIndex = arrayIndex, readIndex = 0; writeIndex < maxIndex;
          writeIndex++, readIndex++)
     {
@@ -1236,12 +1381,19 @@ ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
         uint8_t *writePtr     = dst + arrayOffset;
         const T *readPtr      = v + (readIndex * componentCount);
         ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-        memcpy(writePtr, readPtr, elementSize);
+        if (memcmp(writePtr, readPtr, elementSize) != 0)
+        {
+            memcpy(writePtr, readPtr, elementSize);
+            changed = true;
+        }
     }
+    return changed;
 }
 
+// Returns whether the data has changed.  Applications often set uniforms to the values they
+// already have, in which case the block doesn't need to be uploaded again.
 template <typename T>
-ANGLE_INLINE void UpdateBufferWithLayout(GLsizei count,
+ANGLE_INLINE bool UpdateBufferWithLayout(GLsizei count,
                                          uint32_t arrayIndex,
                                          int componentCount,
                                          const T *v,
@@ -1256,13 +1408,18 @@ ANGLE_INLINE void UpdateBufferWithLayout(GLsizei count,
         uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
         uint8_t *writePtr    = dst + arrayOffset;
         ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
+        if (memcmp(writePtr, v, elementSize * count) == 0)
+        {
+            return false;
+        }
         memcpy(writePtr, v, elementSize * count);
+        return true;
     }
     else
     {
         // Have to respect the arrayStride between each element of the array.
-        UpdateBufferWithLayoutStrided(count, arrayIndex, componentCount, v, layoutInfo,
-                                      uniformData);
+        return UpdateBufferWithLayoutStrided(count, arrayIndex, componentCount, v, layoutInfo,
+                                             uniformData);
     }
 }
 
@@ -1435,9 +1592,11 @@ void SetUniform(const gl::ProgramExecutable *executable,
                 continue;
             }
 
-            UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                   &uniformBlock.uniformData);
-            defaultUniformBlocksDirty->set(shaderType);
+            if (UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v,
+                                       layoutInfo, &uniformBlock.uniformData))
+            {
+                defaultUniformBlocksDirty->set(shaderType);
+            }
         }
     }
     else
@@ -1468,6 +1627,108 @@ template void SetUniform<GLfloat>(const gl::ProgramExecutable *executable,
                                   DefaultUniformBlockMap *defaultUniformBlocks,
                                   gl::ShaderBitSet *defaultUniformBlocksDirty);
 
+void InitDefaultUniformSetters(const gl::ProgramExecutable *executable,
+                               const DefaultUniformBlockMap &defaultUniformBlocks,
+                               DefaultUniformSetters *settersOut)
+{
+    const std::vector<gl::VariableLocation> &locations = executable->getUniformLocations();
+
+    settersOut->clear();
+    settersOut->resize(locations.size());
+
+    for (size_t location = 0; location < locations.size(); ++location)
+    {
+        const gl::VariableLocation &locationInfo = locations[location];
+        if (!locationInfo.used() || locationInfo.ignored)
+        {
+            continue;
+        }
+
+        const gl::LinkedUniform &linkedUniform = executable->getUniforms()[locationInfo.index];
+        if (!linkedUniform.isInDefaultBlock() || linkedUniform.isSampler() ||
+            linkedUniform.isImage() || linkedUniform.isFragmentInOut())
+        {
+            continue;
+        }
+
+        DefaultUniformSetter &setter = (*settersOut)[location];
+        for (const gl::ShaderType shaderType : executable->getLinkedShaderStages())
+        {
+            const std::vector<sh::BlockMemberInfo> &uniformLayout =
+                defaultUniformBlocks[shaderType]->uniformLayout;
+            // Assume an offset of -1 means the block is unused.
+            if (location < uniformLayout.size() && uniformLayout[location].offset != -1)
+            {
+                setter.stages.set(shaderType);
+            }
+        }
+        setter.type           = linkedUniform.getType();
+        setter.arrayIndex     = locationInfo.arrayIndex;
+        setter.componentCount = static_cast<uint8_t>(linkedUniform.getElementComponents());
+        setter.isFloat16      = linkedUniform.isFloat16();
+    }
+}
+
+template <typename T>
+void SetUniform(const gl::ProgramExecutable *executable,
+                const DefaultUniformSetters &setters,
+                GLint location,
+                GLsizei count,
+                const T *v,
+                GLenum entryPointType,
+                DefaultUniformBlockMap *defaultUniformBlocks,
+                gl::ShaderBitSet *defaultUniformBlocksDirty)
+{
+    // Executables that don't own their uniform blocks, such as those of program pipelines, have
+    // no setters.
+    if (ANGLE_LIKELY(static_cast<size_t>(location) < setters.size()))
+    {
+        const DefaultUniformSetter &setter = setters[location];
+        if (ANGLE_LIKELY(setter.type == entryPointType && !setter.isFloat16))
+        {
+            for (const gl::ShaderType shaderType : setter.stages)
+            {
+                BufferAndLayout &uniformBlock = *(*defaultUniformBlocks)[shaderType];
+                if (UpdateBufferWithLayout(count, setter.arrayIndex, setter.componentCount, v,
+                                           uniformBlock.uniformLayout[location],
+                                           &uniformBlock.uniformData))
+                {
+                    defaultUniformBlocksDirty->set(shaderType);
+                }
+            }
+            return;
+        }
+    }
+
+    // Conversions to bool and float16 are left to the generic path.
+    SetUniform(executable, location, count, v, entryPointType, defaultUniformBlocks,
+               defaultUniformBlocksDirty);
+}
+template void SetUniform<GLint>(const gl::ProgramExecutable *executable,
+                                const DefaultUniformSetters &setters,
+                                GLint location,
+                                GLsizei count,
+                                const GLint *v,
+                                GLenum entryPointType,
+                                DefaultUniformBlockMap *defaultUniformBlocks,
+                                gl::ShaderBitSet *defaultUniformBlocksDirty);
+template void SetUniform<GLuint>(const gl::ProgramExecutable *executable,
+                                 const DefaultUniformSetters &setters,
+                                 GLint location,
+                                 GLsizei count,
+                                 const GLuint *v,
+                                 GLenum entryPointType,
+                                 DefaultUniformBlockMap *defaultUniformBlocks,
+                                 gl::ShaderBitSet *defaultUniformBlocksDirty);
+template void SetUniform<GLfloat>(const gl::ProgramExecutable *executable,
+                                  const DefaultUniformSetters &setters,
+                                  GLint location,
+                                  GLsizei count,
+                                  const GLfloat *v,
+                                  GLenum entryPointType,
+                                  DefaultUniformBlockMap *defaultUniformBlocks,
+                                  gl::ShaderBitSet *defaultUniformBlocksDirty);
+
 template <int cols, int rows>
 void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
                         GLint location,
@@ -1480,6 +1741,17 @@ void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
     const gl::VariableLocation &locationInfo = executable->getUniformLocations()[location];
     const gl::LinkedUniform &linkedUniform   = executable->getUniforms()[locationInfo.index];
 
+    // The matrices are written column-major with each column padded to 4 rows.  If the written
+    // range is small, keep a copy of it so that redundant updates don't dirty the block.
+    constexpr size_t kMatrixSize          = sizeof(GLfloat) * cols * 4;
+    constexpr size_t kMaxComparedDataSize = 4 * kMatrixSize;
+    const unsigned int elementCount       = linkedUniform.getBasicTypeElementCount();
+    const size_t writtenDataSize =
+        kMatrixSize *
+        std::min(elementCount - locationInfo.arrayIndex, static_cast<unsigned int>(count));
+    const bool compareData = writtenDataSize <= kMaxComparedDataSize;
+    std::array<uint8_t, kMaxComparedDataSize> previousData;
+
     for (const gl::ShaderType shaderType : executable->getLinkedShaderStages())
     {
         BufferAndLayout &uniformBlock         = *(*defaultUniformBlocks)[shaderType];
@@ -1491,11 +1763,21 @@ void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
             continue;
         }
 
-        SetFloatUniformMatrixGLSL<cols, rows>::Run(
-            locationInfo.arrayIndex, linkedUniform.getBasicTypeElementCount(), count, transpose,
-            value, uniformBlock.uniformData.data() + layoutInfo.offset, linkedUniform.isFloat16());
+        uint8_t *targetData  = uniformBlock.uniformData.data() + layoutInfo.offset;
+        uint8_t *writtenData = targetData + locationInfo.arrayIndex * kMatrixSize;
+        if (compareData)
+        {
+            memcpy(previousData.data(), writtenData, writtenDataSize);
+        }
 
-        defaultUniformBlocksDirty->set(shaderType);
+        SetFloatUniformMatrixGLSL<cols, rows>::Run(locationInfo.arrayIndex, elementCount, count,
+                                                   transpose, value, targetData,
+                                                   linkedUniform.isFloat16());
+
+        if (!compareData || memcmp(previousData.data(), writtenData, writtenDataSize) != 0)
+        {
+            defaultUniformBlocksDirty->set(shaderType);
+        }
     }
 }
 
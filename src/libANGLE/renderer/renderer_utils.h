@@ -189,6 +189,23 @@ struct LoadImageFunctionInfo
 
 using LoadFunctionMap = LoadImageFunctionInfo (*)(GLenum);
 
+// Runs |loadFunction| over the image.  If |context.parallelLoadThreshold| allows it and the output
+// is large enough, the image is split into row (or for 3D images, slice) stripes that are loaded in
+// parallel on |context.multiThreadPool|, with the calling thread loading the first stripe.  This
+// must only be used with load functions that convert each row independently, i.e. not for block
+// compressed, paletted or YUV formats.
+void LoadImageInStripes(LoadImageFunction loadFunction,
+                        const angle::ImageLoadContext &context,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch);
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs);
 
 void CopyImageCHROMIUM(const uint8_t *sourceData,
@@ -300,8 +317,9 @@ struct BufferAndLayout final : private angle::NonCopyable
     std::vector<sh::BlockMemberInfo> uniformLayout;
 };
 
+// Returns whether the data has changed.
 template <typename T>
-void UpdateBufferWithLayout(GLsizei count,
+bool UpdateBufferWithLayout(GLsizei count,
                             uint32_t arrayIndex,
                             int componentCount,
                             const T *v,
@@ -327,6 +345,34 @@ void SetUniform(const gl::ProgramExecutable *executable,
                 DefaultUniformBlockMap *defaultUniformBlocks,
                 gl::ShaderBitSet *defaultUniformBlocksDirty);
 
+// How a setUniform call on a uniform location updates the default uniform blocks, precomputed
+// after link so that calls with the uniform's own type don't need to look up the uniform.
+struct DefaultUniformSetter
+{
+    // GL_NONE for locations not backed by the default uniform blocks.
+    GLenum type             = GL_NONE;
+    uint32_t arrayIndex     = 0;
+    uint8_t componentCount  = 0;
+    bool isFloat16          = false;
+    gl::ShaderBitSet stages = {};
+};
+using DefaultUniformSetters = std::vector<DefaultUniformSetter>;
+
+void InitDefaultUniformSetters(const gl::ProgramExecutable *executable,
+                               const DefaultUniformBlockMap &defaultUniformBlocks,
+                               DefaultUniformSetters *settersOut);
+
+// Same as above, but uses the setters when the uniform type matches the entry point.
+template <typename T>
+void SetUniform(const gl::ProgramExecutable *executable,
+                const DefaultUniformSetters &setters,
+                GLint location,
+                GLsizei count,
+                const T *v,
+                GLenum entryPointType,
+                DefaultUniformBlockMap *defaultUniformBlocks,
+                gl::ShaderBitSet *defaultUniformBlocksDirty);
+
 template <int cols, int rows>
 void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
                         GLint location,
@@ -0,0 +1,71 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// renderer_utils_unittest:
+//   Unit tests for the renderer utils.
+//
+
+#include <gtest/gtest.h>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace rx
+{
+namespace
+{
+void RunStripedLoadTest(size_t width, size_t height, size_t depth)
+{
+    angle::ImageLoadContext context;
+    context.singleThreadPool =
+        angle::WorkerThreadPool::Create(angle::ThreadPoolType::Synchronous, 0, nullptr);
+    context.multiThreadPool =
+        angle::WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 0, nullptr);
+    context.parallelLoadThreshold = 1;
+
+    const size_t inputRowPitch    = width * 3;
+    const size_t inputDepthPitch  = inputRowPitch * height;
+    const size_t outputRowPitch   = width * 4;
+    const size_t outputDepthPitch = outputRowPitch * height;
+
+    std::vector<uint8_t> input(inputDepthPitch * depth);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i * 13 + 7);
+    }
+
+    std::vector<uint8_t> expected(outputDepthPitch * depth);
+    angle::LoadToNative3To4<uint8_t, 0xFF>(context, width, height, depth, input.data(),
+                                           inputRowPitch, inputDepthPitch, expected.data(),
+                                           outputRowPitch, outputDepthPitch);
+
+    std::vector<uint8_t> actual(outputDepthPitch * depth);
+    LoadImageInStripes(angle::LoadToNative3To4<uint8_t, 0xFF>, context, width, height, depth,
+                       input.data(), inputRowPitch, inputDepthPitch, actual.data(), outputRowPitch,
+                       outputDepthPitch);
+
+    EXPECT_EQ(expected, actual);
+}
+
+// Tests that a 2D load split into row stripes produces the same result as a single load.
+TEST(LoadImageInStripesTest, Rows)
+{
+    RunStripedLoadTest(67, 301, 1);
+}
+
+// Tests that a 3D load split into slice stripes produces the same result as a single load.
+TEST(LoadImageInStripesTest, Slices)
+{
+    RunStripedLoadTest(19, 5, 47);
+}
+
+// Tests that loads too small to be split still produce the right result.
+TEST(LoadImageInStripesTest, Small)
+{
+    RunStripedLoadTest(3, 2, 1);
+}
+}  // anonymous namespace
+}  // namespace rx
@@ -8,6 +8,9 @@
 //
 
 #include "libANGLE/renderer/vulkan/AllocatorHelperPool.h"
+
+#include <algorithm>
+
 #include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
 
 namespace rx
@@ -22,19 +25,44 @@ void DedicatedCommandBlockAllocator::resetAllocator()
 
 void DedicatedCommandBlockPool::reset(CommandBufferCommandTracker *commandBufferTracker)
 {
+    updateFirstBlockSize();
+
     mCommandBuffer->clearCommands();
     mCurrentWritePointer   = nullptr;
     mCurrentBytesRemaining = 0;
+    mCurrentBlockSize      = 0;
+    mAllocatedBytes        = 0;
     commandBufferTracker->reset();
 }
 
+void DedicatedCommandBlockPool::updateFirstBlockSize()
+{
+    if (mAllocatedBytes == 0)
+    {
+        // Nothing was allocated since the last reset.
+        return;
+    }
+
+    if (mAllocatedBytes != mCurrentBlockSize)
+    {
+        // The commands needed more than one block, use full blocks from the start next time.
+        mFirstBlockSize = kBlockSize;
+        return;
+    }
+
+    // The commands fit in a single block.  Leave room for twice as many commands, so that a small
+    // increase in the number of commands doesn't spill into a second block.
+    const size_t usedBytes = mCurrentBlockSize - mCurrentBytesRemaining + kCommandHeaderSize;
+    mFirstBlockSize = std::clamp(roundUpPow2<size_t>(usedBytes * 2, 8), kMinBlockSize, kBlockSize);
+}
+
 // Initialize the SecondaryCommandBuffer by setting the allocator it will use
 angle::Result DedicatedCommandBlockPool::initialize(DedicatedCommandMemoryAllocator *allocator)
 {
     ASSERT(allocator);
     ASSERT(mCommandBuffer->hasEmptyCommands());
     mAllocator = allocator;
-    allocateNewBlock();
+    allocateNewBlock(mFirstBlockSize);
     // Set first command to Invalid to start
     reinterpret_cast<CommandHeaderIDType &>(*mCurrentWritePointer) = 0;
 
@@ -51,13 +79,17 @@ void DedicatedCommandBlockPool::allocateNewBlock(size_t blockSize)
     ASSERT(mAllocator);
     mCurrentWritePointer   = mAllocator->fastAllocate(blockSize);
     mCurrentBytesRemaining = blockSize;
+    mCurrentBlockSize      = blockSize;
+    mAllocatedBytes += blockSize;
     mCommandBuffer->pushToCommands(mCurrentWritePointer);
 }
 
 void DedicatedCommandBlockPool::getMemoryUsageStats(size_t *usedMemoryOut,
                                                     size_t *allocatedMemoryOut) const
 {
-    mCommandBuffer->getMemoryUsageStatsForPoolAlloc(kBlockSize, usedMemoryOut, allocatedMemoryOut);
+    *usedMemoryOut      = mCommandBuffer->getUsedMemoryForPoolAlloc();
+    *allocatedMemoryOut = mAllocatedBytes;
+    ASSERT(*usedMemoryOut <= *allocatedMemoryOut);
 }
 
 }  // namespace vk
@@ -54,6 +54,9 @@ class DedicatedCommandBlockPool final
         : mAllocator(nullptr),
           mCurrentWritePointer(nullptr),
           mCurrentBytesRemaining(0),
+          mCurrentBlockSize(0),
+          mAllocatedBytes(0),
+          mFirstBlockSize(kBlockSize),
           mCommandBuffer(nullptr)
     {}
 
@@ -66,6 +69,12 @@ class DedicatedCommandBlockPool final
     static constexpr size_t kBlockSize = 1360;
     // Make sure block size is 8-byte aligned to avoid ASAN errors.
     static_assert((kBlockSize % 8) == 0, "Check kBlockSize alignment");
+    // Many command buffers (for example the render passes of a frame that only clear or draw a
+    // few times) use a fraction of a block.  The first block of a command buffer is sized based
+    // on the usage of the previous command buffer recorded with this pool, with the following
+    // lower bound.  The next blocks always use kBlockSize.
+    static constexpr size_t kMinBlockSize = 256;
+    static_assert((kMinBlockSize % 8) == 0, "Check kMinBlockSize alignment");
 
     void setCommandBuffer(priv::SecondaryCommandBuffer *commandBuffer)
     {
@@ -117,8 +126,23 @@ class DedicatedCommandBlockPool final
         *headerOut = updateHeaderAndAllocatorParams(allocationSize);
     }
 
+    // Grow the last command written, which ends at |commandEnd|, by |extraSize| bytes.  Returns a
+    // pointer to the new bytes, or nullptr if another command has been written since or the
+    // current block doesn't have room for them.
+    uint8_t *tryExtendLastCommand(const uint8_t *commandEnd, const size_t extraSize)
+    {
+        if (commandEnd != mCurrentWritePointer ||
+            mCurrentBytesRemaining < extraSize + kCommandHeaderSize)
+        {
+            return nullptr;
+        }
+
+        return updateHeaderAndAllocatorParams(extraSize);
+    }
+
   private:
     void allocateNewBlock(size_t blockSize = kBlockSize);
+    void updateFirstBlockSize();
 
     uint8_t *updateHeaderAndAllocatorParams(size_t allocationSize)
     {
@@ -136,6 +160,11 @@ class DedicatedCommandBlockPool final
     DedicatedCommandMemoryAllocator *mAllocator;
     uint8_t *mCurrentWritePointer;
     size_t mCurrentBytesRemaining;
+    size_t mCurrentBlockSize;
+    // The total size of the blocks allocated for the current command buffer.
+    size_t mAllocatedBytes;
+    // The size of the first block of the next command buffer.
+    size_t mFirstBlockSize;
 
     // Points to the parent command buffer.
     priv::SecondaryCommandBuffer *mCommandBuffer;
@@ -38,6 +38,10 @@ VkBufferUsageFlags GetDefaultBufferUsageFlags(vk::Renderer *renderer)
         defaultBufferUsageFlags |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT |
                                    VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_COUNTER_BUFFER_BIT_EXT;
     }
+    if (renderer->getFeatures().supportsConditionalRendering.enabled)
+    {
+        defaultBufferUsageFlags |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
+    }
     return defaultBufferUsageFlags;
 }
 
@@ -65,6 +69,11 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
+// The number of index translations cached per buffer.  Applications that draw many line loops out
+// of one buffer use a different range for each, beyond which the draws translate the indices every
+// time as if there was no cache.
+constexpr size_t kMaxIndexConversionBuffers = 64;
+
 // Buffers that have a static usage pattern will be allocated in
 // device local memory to speed up access to and from the GPU.
 // Dynamic usage patterns or that are frequently mapped
@@ -134,6 +143,18 @@ VkMemoryPropertyFlags GetStorageMemoryType(vk::Renderer *renderer,
         return kDeviceLocalFlags;
     }
 
+    // Persistently mapped buffers that the CPU only writes to (typically ring buffers) are placed
+    // in device local memory if it's host visible, so the GPU reads them without going over PCIe.
+    // CPU reads from this (write-combined) memory are slow, so buffers mapped for read are left in
+    // host cached memory.  Like above, the memory is coherent.
+    const bool isPersistentWriteOnly = (storageFlags & GL_MAP_PERSISTENT_BIT_EXT) != 0 &&
+                                       (storageFlags & GL_MAP_READ_BIT) == 0;
+    if (isPersistentWriteOnly &&
+        renderer->getFeatures().preferDeviceLocalMemoryForPersistentWriteBuffers.enabled)
+    {
+        return kDeviceLocalHostCoherentFlags;
+    }
+
     return hasMapAccess ? kHostCachedFlags : kDeviceLocalFlags;
 }
 
@@ -197,6 +218,17 @@ bool ShouldUseCPUToCopyData(ContextVk *contextVk,
             copySize < renderer->getMaxCopyBytesUsingCPUWhenPreservingBufferData());
 }
 
+// Ghosting a buffer duplicates it until the GPU is done with the old one.  To bound the memory this
+// takes, the size of the buffers ghosted in a frame is limited, after which updates use a staging
+// buffer instead (or wait for the GPU, if the previous contents are needed).
+constexpr uint64_t kMaxBufferGhostBytesPerFrame = 64 * 1024 * 1024;
+
+bool IsWithinBufferGhostingBudget(ContextVk *contextVk, size_t bufferSize)
+{
+    return contextVk->getPerfCounters().bufferGhostBytesPerFrame + bufferSize <=
+           kMaxBufferGhostBytesPerFrame;
+}
+
 bool RenderPassUsesBufferForReadOnly(ContextVk *contextVk, const vk::BufferHelper &buffer)
 {
     if (!contextVk->hasActiveRenderPass())
@@ -371,6 +403,13 @@ VertexConversionBuffer::VertexConversionBuffer(VertexConversionBuffer &&other) =
 
 VertexConversionBuffer::~VertexConversionBuffer() = default;
 
+// IndexConversionBuffer implementation.
+IndexConversionBuffer::IndexConversionBuffer(const CacheKey &cacheKey) : mCacheKey(cacheKey) {}
+
+IndexConversionBuffer::IndexConversionBuffer(IndexConversionBuffer &&other) = default;
+
+IndexConversionBuffer::~IndexConversionBuffer() = default;
+
 // BufferVk implementation.
 BufferVk::BufferVk(const gl::BufferState &state)
     : BufferImpl(state),
@@ -378,11 +417,13 @@ BufferVk::BufferVk(const gl::BufferState &state)
       mMemoryTypeIndex(0),
       mMemoryPropertyFlags(0),
       mIsStagingBufferMapped(false),
+      mIsReadbackBufferMapped(false),
       mHasValidData(false),
       mIsMappedForWrite(false),
       mUsageType(BufferUsageType::Static)
 {
     mMappedRange.invalidate();
+    mReadbackRange.invalidate();
 }
 
 BufferVk::~BufferVk() {}
@@ -401,6 +442,12 @@ void BufferVk::releaseConversionBuffers(vk::Context *context)
         buffer.release(context);
     }
     mVertexConversionBuffers.clear();
+
+    for (ConversionBuffer &buffer : mIndexConversionBuffers)
+    {
+        buffer.release(context);
+    }
+    mIndexConversionBuffers.clear();
 }
 
 angle::Result BufferVk::release(ContextVk *contextVk)
@@ -413,6 +460,10 @@ angle::Result BufferVk::release(ContextVk *contextVk)
     {
         mStagingBuffer.release(contextVk);
     }
+    if (mReadbackBuffer.valid())
+    {
+        mReadbackBuffer.release(contextVk);
+    }
 
     releaseConversionBuffers(contextVk);
 
@@ -691,6 +742,53 @@ angle::Result BufferVk::handleDeviceLocalBufferMap(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result BufferVk::handleDeviceLocalBufferMapForRead(ContextVk *contextVk,
+                                                          VkDeviceSize offset,
+                                                          VkDeviceSize size,
+                                                          uint8_t **mapPtr)
+{
+    vk::Renderer *renderer = contextVk->getRenderer();
+
+    // If the range was read before and the GPU hasn't written to the buffer since, the data is
+    // still in the readback buffer, and reading it again needs neither a copy nor a wait.
+    const bool isReadbackBufferCurrent =
+        mReadbackBuffer.valid() && mReadbackSourceSerial == mBuffer.getBufferSerial() &&
+        mReadbackSourceWriteUse == mBuffer.getWriteResourceUse() &&
+        mReadbackRange.low() <= offset && offset + size <= mReadbackRange.high();
+
+    if (!isReadbackBufferCurrent)
+    {
+        // The readback buffer is only ever used by the copy below, which is waited on.
+        if (mReadbackBuffer.valid() && mReadbackBuffer.getSize() < size)
+        {
+            mReadbackBuffer.release(contextVk);
+        }
+        if (!mReadbackBuffer.valid())
+        {
+            ANGLE_TRY(contextVk->initBufferForBufferCopy(
+                &mReadbackBuffer, static_cast<size_t>(size),
+                vk::MemoryCoherency::CachedPreferCoherent));
+        }
+        ANGLE_TRY(mReadbackBuffer.flush(renderer));
+
+        VkBufferCopy copyRegion = {mBuffer.getOffset() + offset, mReadbackBuffer.getOffset(), size};
+        ANGLE_TRY(CopyBuffers(contextVk, &mBuffer, &mReadbackBuffer, 1, &copyRegion));
+        ANGLE_TRY(mReadbackBuffer.waitForIdle(contextVk,
+                                              "GPU stall due to mapping device local buffer",
+                                              QueueSubmitReason::DeviceLocalBufferMap));
+        ANGLE_TRY(mReadbackBuffer.invalidate(renderer));
+
+        mReadbackSourceSerial   = mBuffer.getBufferSerial();
+        mReadbackSourceWriteUse = mBuffer.getWriteResourceUse();
+        mReadbackRange          = RangeDeviceSize(offset, offset + size);
+    }
+
+    *mapPtr = mReadbackBuffer.getMappedMemory() + (offset - mReadbackRange.low());
+    mIsReadbackBufferMapped = true;
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferVk::mapHostVisibleBuffer(ContextVk *contextVk,
                                              VkDeviceSize offset,
                                              GLbitfield access,
@@ -748,15 +846,15 @@ angle::Result BufferVk::ghostMappedBuffer(ContextVk *contextVk,
 
     ++contextVk->getPerfCounters().buffersGhosted;
 
+    const size_t totalSize = static_cast<size_t>(mState.getSize());
+    contextVk->getPerfCounters().bufferGhostBytesPerFrame += totalSize;
+
     // If we are creating a new buffer because the GPU is using it as read-only, then we
     // also need to copy the contents of the previous buffer into the new buffer, in
     // case the caller only updates a portion of the new buffer.
     vk::BufferHelper src = std::move(mBuffer);
-    ANGLE_TRY(acquireBufferHelper(contextVk, static_cast<size_t>(mState.getSize()),
-                                  BufferUsageType::Dynamic, feedback));
+    ANGLE_TRY(acquireBufferHelper(contextVk, totalSize, BufferUsageType::Dynamic, feedback));
 
-    // Before returning the new buffer, map the previous buffer and copy its entire
-    // contents into the new buffer.
     uint8_t *srcMapPtr = nullptr;
     uint8_t *dstMapPtr = nullptr;
     ANGLE_TRY(src.map(contextVk, &srcMapPtr));
@@ -765,24 +863,50 @@ angle::Result BufferVk::ghostMappedBuffer(ContextVk *contextVk,
     ASSERT(src.isCoherent());
     ASSERT(mBuffer.isCoherent());
 
-    // No need to copy over [offset, offset + length), just around it
-    if ((access & GL_MAP_INVALIDATE_RANGE_BIT) != 0)
+    // Only the mapped range [offset, offset + length) is given to the caller, so its previous
+    // contents are copied with the CPU, unless the caller invalidated it.  The rest of the buffer
+    // is copied by the GPU if that's preferred over a CPU copy, in which case the caller can write
+    // to the mapped range while the GPU copies the regions around it.
+    const size_t mappedStart   = static_cast<size_t>(offset);
+    const size_t mappedEnd     = static_cast<size_t>(offset + length);
+    const size_t remainingSize = totalSize - mappedEnd;
+    const bool useCPUForRegionsAroundMappedRange =
+        ShouldUseCPUToCopyData(contextVk, src, totalSize - (mappedEnd - mappedStart), totalSize);
+
+    if ((access & GL_MAP_INVALIDATE_RANGE_BIT) == 0 && length != 0)
     {
-        if (offset != 0)
+        memcpy(dstMapPtr + mappedStart, srcMapPtr + mappedStart, mappedEnd - mappedStart);
+    }
+
+    if (useCPUForRegionsAroundMappedRange)
+    {
+        if (mappedStart != 0)
         {
-            memcpy(dstMapPtr, srcMapPtr, static_cast<size_t>(offset));
+            memcpy(dstMapPtr, srcMapPtr, mappedStart);
         }
-        size_t totalSize      = static_cast<size_t>(mState.getSize());
-        size_t remainingStart = static_cast<size_t>(offset + length);
-        size_t remainingSize  = totalSize - remainingStart;
         if (remainingSize != 0)
         {
-            memcpy(dstMapPtr + remainingStart, srcMapPtr + remainingStart, remainingSize);
+            memcpy(dstMapPtr + mappedEnd, srcMapPtr + mappedEnd, remainingSize);
         }
     }
     else
     {
-        memcpy(dstMapPtr, srcMapPtr, static_cast<size_t>(mState.getSize()));
+        constexpr int kMaxCopyRegions = 2;
+        angle::FixedVector<VkBufferCopy, kMaxCopyRegions> copyRegions;
+        if (mappedStart != 0)
+        {
+            copyRegions.push_back({src.getOffset(), mBuffer.getOffset(), mappedStart});
+        }
+        if (remainingSize != 0)
+        {
+            copyRegions.push_back(
+                {src.getOffset() + mappedEnd, mBuffer.getOffset() + mappedEnd, remainingSize});
+        }
+        if (!copyRegions.empty())
+        {
+            ANGLE_TRY(CopyBuffers(contextVk, &src, &mBuffer,
+                                  static_cast<uint32_t>(copyRegions.size()), copyRegions.data()));
+        }
     }
 
     ANGLE_TRY(contextVk->releaseBufferAllocation(&src));
@@ -840,7 +964,7 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
         {
             return mapHostVisibleBuffer(contextVk, offset, access, mapPtrBytes);
         }
-        return handleDeviceLocalBufferMap(contextVk, offset, length, mapPtrBytes);
+        return handleDeviceLocalBufferMapForRead(contextVk, offset, length, mapPtrBytes);
     }
 
     // Write case
@@ -875,15 +999,16 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
     }
 
     bool smallMapRange = (length < static_cast<VkDeviceSize>(mState.getSize()) / 2);
+    bool canGhost = IsWithinBufferGhostingBudget(contextVk, static_cast<size_t>(mState.getSize()));
 
-    if (smallMapRange && rangeInvalidate)
+    if ((smallMapRange || !canGhost) && rangeInvalidate)
     {
         ANGLE_TRY(allocStagingBuffer(contextVk, vk::MemoryCoherency::CachedNonCoherent,
                                      static_cast<size_t>(length), mapPtrBytes));
         return angle::Result::Continue;
     }
 
-    if (renderer->hasResourceUseFinished(mBuffer.getWriteResourceUse()))
+    if (canGhost && renderer->hasResourceUseFinished(mBuffer.getWriteResourceUse()))
     {
         // This will keep the new buffer mapped and update mapPtr, so return immediately.
         return ghostMappedBuffer(contextVk, offset, length, access, mapPtr, feedback);
@@ -923,6 +1048,11 @@ angle::Result BufferVk::unmapImpl(ContextVk *contextVk, BufferFeedback *feedback
 
         mIsStagingBufferMapped = false;
     }
+    else if (mIsReadbackBufferMapped)
+    {
+        ASSERT(!mIsMappedForWrite);
+        mIsReadbackBufferMapped = false;
+    }
     else
     {
         ASSERT(mBuffer.isHostVisible());
@@ -1150,6 +1280,7 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
     uint8_t *prevMapPtrAfterSubData  = nullptr;
     if (updateRegionBeforeSubData || updateRegionAfterSubData)
     {
+        contextVk->getPerfCounters().bufferGhostBytesPerFrame += bufferSize;
         prevBuffer = std::move(mBuffer);
 
         // The total bytes that we need to copy from old buffer to new buffer
@@ -1261,12 +1392,18 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
         // - The update modifies a significant portion of the buffer
         // - The preferCPUForBufferSubData feature is enabled.
         //
+        // When the buffer has valid data, it is additionally limited by the per-frame budget of
+        // ghosted buffers.
+        //
         const bool canAcquireAndUpdate = !isExternalBuffer() &&
                                          updateType != BufferUpdateType::StorageRedefined &&
                                          !IsSelfCopy(dataSource, mBuffer);
+        const bool canGhost = canAcquireAndUpdate && mHasValidData &&
+                              IsWithinBufferGhostingBudget(contextVk, bufferSize);
         if (canAcquireAndUpdate &&
-            (!mHasValidData || ShouldAvoidRenderPassBreakOnUpdate(contextVk, mBuffer, bufferSize) ||
-             ShouldAllocateNewMemoryForUpdate(contextVk, updateSize, bufferSize)))
+            (!mHasValidData ||
+             (canGhost && (ShouldAvoidRenderPassBreakOnUpdate(contextVk, mBuffer, bufferSize) ||
+                           ShouldAllocateNewMemoryForUpdate(contextVk, updateSize, bufferSize)))))
         {
             ANGLE_TRY(acquireAndUpdate(contextVk, bufferSize, dataSource, updateSize, updateOffset,
                                        updateType, feedback));
@@ -1317,12 +1454,55 @@ VertexConversionBuffer *BufferVk::getVertexConversionBuffer(
     return &mVertexConversionBuffers.back();
 }
 
+IndexConversionBuffer *BufferVk::getIndexConversionBuffer(
+    const IndexConversionBuffer::CacheKey &cacheKey)
+{
+    // Writes through a mapping are only known when the buffer is unmapped, so a translation made
+    // while the buffer is (persistently) mapped could go stale unnoticed.
+    if (mState.isMapped())
+    {
+        return nullptr;
+    }
+
+    for (IndexConversionBuffer &buffer : mIndexConversionBuffers)
+    {
+        if (buffer.match(cacheKey))
+        {
+            return &buffer;
+        }
+    }
+
+    // Cached translations are never evicted, as their buffers may be bound by vertex arrays.
+    if (mIndexConversionBuffers.size() >= kMaxIndexConversionBuffers)
+    {
+        return nullptr;
+    }
+
+    mIndexConversionBuffers.emplace_back(cacheKey);
+    return &mIndexConversionBuffers.back();
+}
+
 void BufferVk::dataRangeUpdated(const RangeDeviceSize &range)
 {
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
     {
         buffer.addDirtyBufferRange(range);
     }
+    // Index translations are redone entirely, so only the ones reading from the range matter.
+    for (IndexConversionBuffer &buffer : mIndexConversionBuffers)
+    {
+        const IndexConversionBuffer::CacheKey &cacheKey = buffer.getCacheKey();
+        VkDeviceSize sourceEnd = std::numeric_limits<VkDeviceSize>::max();
+        if (cacheKey.indexCount > 0)
+        {
+            sourceEnd = cacheKey.offset +
+                        cacheKey.indexCount * gl::GetDrawElementsTypeSize(cacheKey.indexType);
+        }
+        if (range.low() < sourceEnd && range.high() > cacheKey.offset)
+        {
+            buffer.setEntireBufferDirty();
+        }
+    }
     // Now we have valid data
     mHasValidData = true;
 }
@@ -1333,6 +1513,10 @@ void BufferVk::dataUpdated()
     {
         buffer.setEntireBufferDirty();
     }
+    for (IndexConversionBuffer &buffer : mIndexConversionBuffers)
+    {
+        buffer.setEntireBufferDirty();
+    }
     // Now we have valid data
     mHasValidData = true;
 }
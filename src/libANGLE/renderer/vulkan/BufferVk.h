@@ -87,19 +87,23 @@ class VertexConversionBuffer : public ConversionBuffer
 
     bool match(const CacheKey &cacheKey)
     {
-        // If anything other than offset mismatch, it can't reuse.
-        if (mCacheKey.vertexArrayVk != cacheKey.vertexArrayVk ||
-            mCacheKey.attribIndex != cacheKey.attribIndex ||
-            mCacheKey.formatID != cacheKey.formatID || mCacheKey.stride != cacheKey.stride ||
+        // If anything other than offset mismatch, it can't reuse.  The conversion result only
+        // depends on the buffer's data, so it is shared by every vertex array (in any context of
+        // the share group) that reads the buffer with the same format and stride.
+        if (mCacheKey.formatID != cacheKey.formatID || mCacheKey.stride != cacheKey.stride ||
             mCacheKey.offsetMustMatchExactly != cacheKey.offsetMustMatchExactly ||
             mCacheKey.hostVisible != cacheKey.hostVisible)
         {
             return false;
         }
 
+        const bool isOwner = mCacheKey.vertexArrayVk == cacheKey.vertexArrayVk &&
+                             mCacheKey.attribIndex == cacheKey.attribIndex;
+
         // If offset matches, for sure we can reuse.
         if (mCacheKey.offset == cacheKey.offset)
         {
+            mIsShared = mIsShared || !isOwner;
             return true;
         }
 
@@ -113,9 +117,17 @@ class VertexConversionBuffer : public ConversionBuffer
             {
                 if (cacheKey.offset < mCacheKey.offset)
                 {
+                    // Moving the base offset down shifts the converted data within the buffer,
+                    // which would invalidate the offsets other users have already bound.  Only
+                    // allow it if nobody else is using this conversion.
+                    if (!isOwner || mIsShared)
+                    {
+                        return false;
+                    }
                     addDirtyBufferRange(RangeDeviceSize(cacheKey.offset, mCacheKey.offset));
                     mCacheKey.offset = cacheKey.offset;
                 }
+                mIsShared = mIsShared || !isOwner;
                 return true;
             }
         }
@@ -125,8 +137,53 @@ class VertexConversionBuffer : public ConversionBuffer
     const CacheKey &getCacheKey() const { return mCacheKey; }
 
   private:
-    // The conversion is identified by the triple of {format, stride, offset}.
+    // The conversion is identified by the triple of {format, stride, offset}.  The vertex array
+    // and attribute that created it are recorded as its owner.
+    CacheKey mCacheKey;
+    // Whether a vertex array other than the owner is also reading from this conversion.
+    bool mIsShared = false;
+};
+
+// Translated index data (uint8 indices emulated as uint16, and line loops closed with their first
+// index) made from a range of an element array buffer.  The result only depends on the buffer's
+// data, so it is kept with the buffer and shared by every vertex array that draws with the same
+// parameters.
+class IndexConversionBuffer : public ConversionBuffer
+{
+  public:
+    struct CacheKey final
+    {
+        gl::DrawElementsType indexType;
+        size_t offset;
+        // The number of indices translated, or 0 if everything from offset to the end of the
+        // buffer is translated.
+        GLsizei indexCount;
+        bool primitiveRestart;
+        bool lineLoop;
+    };
+
+    IndexConversionBuffer(const CacheKey &cacheKey);
+    ~IndexConversionBuffer();
+
+    IndexConversionBuffer(IndexConversionBuffer &&other);
+
+    bool match(const CacheKey &cacheKey) const
+    {
+        return mCacheKey.indexType == cacheKey.indexType && mCacheKey.offset == cacheKey.offset &&
+               mCacheKey.indexCount == cacheKey.indexCount &&
+               mCacheKey.primitiveRestart == cacheKey.primitiveRestart &&
+               mCacheKey.lineLoop == cacheKey.lineLoop;
+    }
+
+    const CacheKey &getCacheKey() const { return mCacheKey; }
+
+    // With primitive restart, the number of translated line loop indices depends on the data.
+    uint32_t getConvertedIndexCount() const { return mConvertedIndexCount; }
+    void setConvertedIndexCount(uint32_t indexCount) { mConvertedIndexCount = indexCount; }
+
+  private:
     CacheKey mCacheKey;
+    uint32_t mConvertedIndexCount = 0;
 };
 
 enum class BufferUpdateType
@@ -280,6 +337,11 @@ class BufferVk : public BufferImpl
         vk::Renderer *renderer,
         const VertexConversionBuffer::CacheKey &cacheKey);
 
+    // Returns nullptr if the translation can't be cached, in which case the caller should use its
+    // own buffer.
+    IndexConversionBuffer *getIndexConversionBuffer(
+        const IndexConversionBuffer::CacheKey &cacheKey);
+
   private:
     angle::Result updateBuffer(ContextVk *contextVk,
                                size_t bufferSize,
@@ -317,6 +379,10 @@ class BufferVk : public BufferImpl
                                              VkDeviceSize offset,
                                              VkDeviceSize size,
                                              uint8_t **mapPtr);
+    angle::Result handleDeviceLocalBufferMapForRead(ContextVk *contextVk,
+                                                    VkDeviceSize offset,
+                                                    VkDeviceSize size,
+                                                    uint8_t **mapPtr);
     angle::Result mapHostVisibleBuffer(ContextVk *contextVk,
                                        VkDeviceSize offset,
                                        GLbitfield access,
@@ -372,10 +438,21 @@ class BufferVk : public BufferImpl
 
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
+    // A cache of translated index data.
+    std::vector<IndexConversionBuffer> mIndexConversionBuffers;
 
     // Tracks whether mStagingBuffer has been mapped to user or not
     bool mIsStagingBufferMapped;
 
+    // A host cached copy of the range mReadbackRange of a device local buffer, made when that range
+    // was last read.  It is reused by later reads while mBuffer is the same buffer and has not been
+    // written to since (i.e. its write use is still mReadbackSourceWriteUse).
+    vk::BufferHelper mReadbackBuffer;
+    vk::BufferSerial mReadbackSourceSerial;
+    vk::ResourceUse mReadbackSourceWriteUse;
+    RangeDeviceSize mReadbackRange;
+    bool mIsReadbackBufferMapped;
+
     // Tracks if BufferVk object has valid data or not.
     bool mHasValidData;
 
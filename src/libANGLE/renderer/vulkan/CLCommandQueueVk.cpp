@@ -48,6 +48,7 @@
 #include "vulkan/vulkan_core.h"
 
 #include <chrono>
+#include <limits>
 
 namespace rx
 {
@@ -236,6 +237,8 @@ CLCommandQueueVk::CLCommandQueueVk(const cl::CommandQueue &commandQueue)
                     convertClToEglPriority(mCommandQueue.getPriority())),
       mQueueSerialIndex(kInvalidQueueSerialIndex),
       mNeedPrintfHandling(false),
+      mNextTimestampQueryPair(0),
+      mGpuToCpuTimestampOffset(std::numeric_limits<int64_t>::max()),
       mFinishHandler(this)
 {}
 
@@ -264,6 +267,7 @@ angle::Result CLCommandQueueVk::init()
     // Initialize serials to be valid but appear submitted and finished.
     mLastFlushedQueueSerial   = QueueSerial(mQueueSerialIndex, Serial());
     mLastSubmittedQueueSerial = mLastFlushedQueueSerial;
+    mLastProcessedQueueSerial = mLastFlushedQueueSerial;
 
     ANGLE_TRY(mFinishHandler.init());
 
@@ -278,6 +282,8 @@ CLCommandQueueVk::~CLCommandQueueVk()
 
     mFinishHandler.terminate();
 
+    mTimestampQueryPool.destroy(vkDevice);
+
     ASSERT(mComputePassCommands->empty());
     ASSERT(!mNeedPrintfHandling);
 
@@ -2028,9 +2034,20 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk)
     {
         if (!kernelVk.getDescriptorSetLayoutDesc(index).empty())
         {
-            mContext->getPerfCounters().writeDescriptorSets =
-                updateDescriptorSetsBuilders[index].flushDescriptorSetUpdates(
-                    renderer->getDevice());
+            // The argument descriptors were still collected above, but if the set already holds
+            // them they are simply dropped.
+            const bool skipUpdate = index == DescriptorSetIndex::KernelArguments &&
+                                    kernelVk.isKernelArgumentsDescriptorSetUpToDate();
+            if (!skipUpdate)
+            {
+                mContext->getPerfCounters().writeDescriptorSets =
+                    updateDescriptorSetsBuilders[index].flushDescriptorSetUpdates(
+                        renderer->getDevice());
+                if (index == DescriptorSetIndex::KernelArguments)
+                {
+                    kernelVk.onKernelArgumentsDescriptorSetUpdated();
+                }
+            }
 
             VkDescriptorSet descriptorSet = kernelVk.getDescriptorSet(index);
             mComputePassCommands->getCommandBuffer().bindDescriptorSets(
@@ -2202,6 +2219,12 @@ angle::Result CLCommandQueueVk::preEnqueueOps(cl::EventPtr &event,
             }
             return CLEventImpl::Ptr(eventVk);
         }));
+
+        // Commands that are complete on enqueue are only timed on the CPU.
+        if (initialStatus != cl::ExecutionStatus::Complete && isGpuProfilingEnabled())
+        {
+            ANGLE_TRY(beginTimestampQuery(event->getImpl<CLEventVk>()));
+        }
     }
 
     return angle::Result::Continue;
@@ -2219,8 +2242,13 @@ angle::Result CLCommandQueueVk::postEnqueueOps(const cl::EventPtr &event)
         if (cl::FromCLenum<cl::ExecutionStatus>(status) == cl::ExecutionStatus::Complete)
         {
             // skip event association if command is already complete
+            eventVk.clearTimestampQuery();
             return angle::Result::Continue;
         }
+        if (eventVk.hasTimestampQuery())
+        {
+            endTimestampQuery(eventVk);
+        }
         eventVk.setQueueSerial(mComputePassCommands->getQueueSerial());
         mCommandsStateMap.addEvent(eventVk.getQueueSerial(), event);
     }
@@ -2233,6 +2261,101 @@ angle::Result CLCommandQueueVk::postEnqueueOps(const cl::EventPtr &event)
     return angle::Result::Continue;
 }
 
+bool CLCommandQueueVk::isGpuProfilingEnabled() const
+{
+    return mCommandQueue.getProperties().intersects(CL_QUEUE_PROFILING_ENABLE) &&
+           mContext->getRenderer()->getQueueFamilyProperties().timestampValidBits > 0;
+}
+
+angle::Result CLCommandQueueVk::beginTimestampQuery(CLEventVk &eventVk)
+{
+    if (!mTimestampQueryPool.valid())
+    {
+        VkQueryPoolCreateInfo createInfo = {};
+        createInfo.sType                 = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+        createInfo.queryCount            = kTimestampQueryPairCount * 2;
+        ANGLE_VK_TRY(mContext, mTimestampQueryPool.init(mContext->getDevice(), createInfo));
+    }
+
+    // Fall back to CPU timestamps if the next pair may not have been read back yet.
+    const uint32_t queryPair            = mNextTimestampQueryPair;
+    const QueueSerial &lastWriterSerial = mTimestampQuerySerials[queryPair];
+    if (lastWriterSerial.valid() && !(lastWriterSerial <= mLastProcessedQueueSerial))
+    {
+        return angle::Result::Continue;
+    }
+    mNextTimestampQueryPair = (queryPair + 1) % kTimestampQueryPairCount;
+
+    // Bottom of pipe, so that the begin timestamp is taken once the previous commands are done.
+    const uint32_t query                              = queryPair * 2;
+    vk::OutsideRenderPassCommandBuffer &commandBuffer = mComputePassCommands->getCommandBuffer();
+    commandBuffer.resetQueryPool(mTimestampQueryPool, query, 2);
+    commandBuffer.writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, mTimestampQueryPool, query);
+
+    mTimestampQuerySerials[queryPair] = mComputePassCommands->getQueueSerial();
+    eventVk.setTimestampQuery(query);
+
+    return angle::Result::Continue;
+}
+
+void CLCommandQueueVk::endTimestampQuery(CLEventVk &eventVk)
+{
+    const uint32_t query = eventVk.getTimestampQuery();
+    mComputePassCommands->getCommandBuffer().writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                                            mTimestampQueryPool, query + 1);
+
+    // The command may have flushed in between, the pair is in use until this serial is processed.
+    mTimestampQuerySerials[query / 2] = mComputePassCommands->getQueueSerial();
+}
+
+void CLCommandQueueVk::resolveTimestampQueries(const QueueSerial queueSerial)
+{
+    const vk::Renderer *renderer = mContext->getRenderer();
+    const double timestampPeriod = renderer->getPhysicalDeviceProperties().limits.timestampPeriod;
+    const uint32_t validBits     = renderer->getQueueFamilyProperties().timestampValidBits;
+    const uint64_t validBitsMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+    const auto cpuTimestamp      = static_cast<int64_t>(CLEventVk::GetCpuTimestamp());
+
+    for (const cl::EventPtr &event : mCommandsStateMap.getEventsUpToQueueSerial(queueSerial))
+    {
+        CLEventVk &eventVk = event->getImpl<CLEventVk>();
+        if (!eventVk.hasTimestampQuery())
+        {
+            continue;
+        }
+
+        std::array<uint64_t, 2> ticks = {};
+        VkResult result               = mTimestampQueryPool.getResults(
+            mContext->getDevice(), eventVk.getTimestampQuery(), 2, sizeof(ticks), ticks.data(),
+            sizeof(ticks[0]), VK_QUERY_RESULT_64_BIT);
+        eventVk.clearTimestampQuery();
+        if (result != VK_SUCCESS)
+        {
+            // The queries are unavailable if the commands were discarded; keep the CPU timestamps.
+            continue;
+        }
+
+        const uint64_t durationTicks = (ticks[1] - ticks[0]) & validBitsMask;
+        const auto gpuEnd =
+            static_cast<int64_t>(static_cast<double>(ticks[1] & validBitsMask) * timestampPeriod);
+        const auto duration =
+            static_cast<int64_t>(static_cast<double>(durationTicks) * timestampPeriod);
+
+        // The command ended before now, so every sample bounds the clock offset from above.
+        mGpuToCpuTimestampOffset = std::min(mGpuToCpuTimestampOffset, cpuTimestamp - gpuEnd);
+
+        const int64_t commandEnd = gpuEnd + mGpuToCpuTimestampOffset;
+        eventVk.setGpuTimestamps(static_cast<cl_ulong>(commandEnd - duration),
+                                 static_cast<cl_ulong>(commandEnd));
+    }
+
+    if (mLastProcessedQueueSerial < queueSerial)
+    {
+        mLastProcessedQueueSerial = queueSerial;
+    }
+}
+
 angle::Result CLCommandQueueVk::submitEmptyCommand()
 {
     // This will be called as part of resetting the command buffer and command buffer has to be
@@ -2289,6 +2412,12 @@ angle::Result CLCommandQueueVk::finishQueueSerialInternal(const QueueSerial queu
         mNeedPrintfHandling = false;
     }
 
+    // Read back the GPU timestamps before the events report CL_COMPLETE
+    if (mTimestampQueryPool.valid())
+    {
+        resolveTimestampQueries(queueSerial);
+    }
+
     // Events associated with this queue serial and ready to be marked complete
     ANGLE_TRY(mCommandsStateMap.setEventsWithQueueSerialToState(queueSerial,
                                                                 cl::ExecutionStatus::Complete));
@@ -2469,6 +2598,20 @@ angle::Result CommandsStateMap::setEventsWithQueueSerialToState(const QueueSeria
     return angle::Result::Continue;
 }
 
+cl::EventPtrs CommandsStateMap::getEventsUpToQueueSerial(const QueueSerial &queueSerial)
+{
+    std::unique_lock<angle::SimpleMutex> ul(mMutex);
+    cl::EventPtrs events;
+    for (const auto &[serial, state] : mCommandsState)
+    {
+        if (serial <= queueSerial)
+        {
+            events.insert(events.end(), state.mEvents.begin(), state.mEvents.end());
+        }
+    }
+    return events;
+}
+
 angle::Result CommandsStateMap::processQueueSerial(const QueueSerial queueSerial)
 {
     std::unique_lock<angle::SimpleMutex> ul(mMutex);
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_CLCOMMANDQUEUEVK_H_
 #define LIBANGLE_RENDERER_VULKAN_CLCOMMANDQUEUEVK_H_
 
+#include <array>
 #include <condition_variable>
 #include <vector>
 
@@ -247,6 +248,7 @@ class CommandsStateMap
 
     angle::Result setEventsWithQueueSerialToState(const QueueSerial &queueSerial,
                                                   cl::ExecutionStatus executionStatus);
+    cl::EventPtrs getEventsUpToQueueSerial(const QueueSerial &queueSerial);
     angle::Result processQueueSerial(const QueueSerial queueSerial);
 
   private:
@@ -513,6 +515,13 @@ class CLCommandQueueVk : public CLCommandQueueImpl
     angle::Result preEnqueueOps(cl::EventPtr &event, cl::ExecutionStatus initialStatus);
     angle::Result postEnqueueOps(const cl::EventPtr &event);
 
+    // GPU timestamps for event profiling.  The begin/end queries are written around the commands
+    // of the event, and resolved once its queue serial has finished.
+    bool isGpuProfilingEnabled() const;
+    angle::Result beginTimestampQuery(CLEventVk &eventVk);
+    void endTimestampQuery(CLEventVk &eventVk);
+    void resolveTimestampQueries(const QueueSerial queueSerial);
+
     angle::Result onResourceAccess(const vk::CommandResources &resources);
     angle::Result getCommandBuffer(const vk::CommandResources &resources,
                                    vk::OutsideRenderPassCommandBuffer **commandBufferOut)
@@ -568,6 +577,19 @@ class CLCommandQueueVk : public CLCommandQueueImpl
 
     CommandsStateMap mCommandsStateMap;
 
+    // Timestamp queries of a profiling queue.  Every profiled command takes a pair of queries from
+    // the pool, which is used as a ring; a pair is only reused once the queue serial that last
+    // wrote it has been processed by finishQueueSerialInternal.  If the ring is full, the command
+    // falls back to CPU timestamps.
+    static constexpr uint32_t kTimestampQueryPairCount = 256;
+    vk::QueryPool mTimestampQueryPool;
+    std::array<QueueSerial, kTimestampQueryPairCount> mTimestampQuerySerials;
+    uint32_t mNextTimestampQueryPair;
+    QueueSerial mLastProcessedQueueSerial;
+    // Smallest observed difference between the CPU clock and the GPU timestamps (in nanoseconds),
+    // used to translate the latter into the CPU time domain of the other profiling timestamps.
+    int64_t mGpuToCpuTimestampOffset;
+
     // printf handling
     bool mNeedPrintfHandling;
 
@@ -23,7 +23,8 @@ CLEventVk::CLEventVk(const cl::Event &event, const cl::ExecutionStatus initialSt
     : CLEventImpl(event),
       mStatus(cl::ToCLenum(initialStatus)),
       mProfilingTimestamps(ProfilingTimestamps{}),
-      mQueueSerial(QueueSerial())
+      mQueueSerial(QueueSerial()),
+      mTimestampQuery(kInvalidTimestampQuery)
 {
     ANGLE_CL_IMPL_TRY(setTimestamp(*mStatus));
 }
@@ -164,13 +165,9 @@ angle::Result CLEventVk::setTimestamp(cl_int status)
     if (!isUserEvent() &&
         mEvent.getCommandQueue()->getProperties().intersects(CL_QUEUE_PROFILING_ENABLE))
     {
-        // TODO(aannestrand) Just get current CPU timestamp for now, look into Vulkan GPU device
-        // timestamp query instead and later make CPU timestamp a fallback if GPU timestamp cannot
-        // be queried http://anglebug.com/357902514
-        cl_ulong cpuTS =
-            std::chrono::time_point_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now())
-                .time_since_epoch()
-                .count();
+        // Start and end come from GPU timestamp queries when the queue could record them (see
+        // setGpuTimestamps), the CPU timestamp is the fallback.
+        cl_ulong cpuTS = GetCpuTimestamp();
 
         auto profilingTimestamps = mProfilingTimestamps.synchronize();
 
@@ -183,15 +180,21 @@ angle::Result CLEventVk::setTimestamp(cl_int status)
                 profilingTimestamps->commandSubmitTS = cpuTS;
                 break;
             case CL_RUNNING:
-                profilingTimestamps->commandStartTS = cpuTS;
+                if (!profilingTimestamps->hasGpuTimestamps)
+                {
+                    profilingTimestamps->commandStartTS = cpuTS;
+                }
                 break;
             case CL_COMPLETE:
-                profilingTimestamps->commandEndTS = cpuTS;
+                if (!profilingTimestamps->hasGpuTimestamps)
+                {
+                    profilingTimestamps->commandEndTS = cpuTS;
+                }
 
                 // Returns a value equivalent to passing CL_PROFILING_COMMAND_END if the device
                 // associated with event does not support device-side enqueue.
                 // https://registry.khronos.org/OpenCL/specs/3.0-unified/html/OpenCL_API.html#_device_side_enqueue
-                profilingTimestamps->commandCompleteTS = cpuTS;
+                profilingTimestamps->commandCompleteTS = profilingTimestamps->commandEndTS;
                 break;
             default:
                 UNREACHABLE();
@@ -201,4 +204,23 @@ angle::Result CLEventVk::setTimestamp(cl_int status)
     return angle::Result::Continue;
 }
 
+void CLEventVk::setGpuTimestamps(cl_ulong commandStartTS, cl_ulong commandEndTS)
+{
+    auto profilingTimestamps = mProfilingTimestamps.synchronize();
+
+    // The GPU and CPU clocks are only loosely correlated, keep the timestamps ordered.
+    profilingTimestamps->commandStartTS =
+        std::max(commandStartTS, profilingTimestamps->commandSubmitTS);
+    profilingTimestamps->commandEndTS =
+        std::max(commandEndTS, profilingTimestamps->commandStartTS);
+    profilingTimestamps->hasGpuTimestamps = true;
+}
+
+cl_ulong CLEventVk::GetCpuTimestamp()
+{
+    return std::chrono::time_point_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now())
+        .time_since_epoch()
+        .count();
+}
+
 }  // namespace rx
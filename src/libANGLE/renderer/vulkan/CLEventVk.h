@@ -9,6 +9,7 @@
 #define LIBANGLE_RENDERER_VULKAN_CLEVENTVK_H_
 
 #include <condition_variable>
+#include <limits>
 #include <mutex>
 
 #include "libANGLE/renderer/CLEventImpl.h"
@@ -46,7 +47,22 @@ class CLEventVk : public CLEventImpl
     angle::Result setStatusAndExecuteCallback(cl_int status);
     angle::Result setTimestamp(cl_int status);
 
+    // Index of the first of the two timestamp queries written around the command, if the queue
+    // measures it on the GPU.
+    bool hasTimestampQuery() const { return mTimestampQuery != kInvalidTimestampQuery; }
+    uint32_t getTimestampQuery() const { return mTimestampQuery; }
+    void setTimestampQuery(uint32_t query) { mTimestampQuery = query; }
+    void clearTimestampQuery() { mTimestampQuery = kInvalidTimestampQuery; }
+
+    // Replaces the CPU timestamps of CL_PROFILING_COMMAND_START/END with the GPU measurement,
+    // already converted to the CPU time domain.
+    void setGpuTimestamps(cl_ulong commandStartTS, cl_ulong commandEndTS);
+
+    static cl_ulong GetCpuTimestamp();
+
   private:
+    static constexpr uint32_t kInvalidTimestampQuery = std::numeric_limits<uint32_t>::max();
+
     std::mutex mUserEventMutex;
     angle::SynchronizedValue<cl_int> mStatus;
     std::condition_variable mUserEventCondition;
@@ -60,9 +76,11 @@ class CLEventVk : public CLEventImpl
         cl_ulong commandQueuedTS;
         cl_ulong commandSubmitTS;
         cl_ulong commandCompleteTS;
+        bool hasGpuTimestamps;
     };
     angle::SynchronizedValue<ProfilingTimestamps> mProfilingTimestamps;
     QueueSerial mQueueSerial;
+    uint32_t mTimestampQuery;
 };
 
 }  // namespace rx
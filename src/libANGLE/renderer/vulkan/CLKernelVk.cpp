@@ -99,7 +99,6 @@ CLKernelVk::CLKernelVk(const cl::Kernel &kernel,
 
 CLKernelVk::~CLKernelVk()
 {
-    mComputePipelineCache.destroy(mContext);
     mShaderProgramHelper.destroy(mContext->getRenderer());
 
     if (mPodBuffer)
@@ -246,6 +245,8 @@ angle::Result CLKernelVk::init()
 
 angle::Result CLKernelVk::setArg(cl_uint argIndex, size_t argSize, const void *argValue)
 {
+    mKernelArgumentsDescriptorSetUpToDate = false;
+
     auto &arg = mArgs.at(argIndex);
     if (arg.used)
     {
@@ -454,9 +455,9 @@ angle::Result CLKernelVk::getOrCreateComputePipeline(vk::PipelineCacheAccess *pi
     // Now get or create (on compute pipeline cache miss) compute pipeline and return it
     vk::ComputePipelineOptions options = vk::GetComputePipelineOptions(
         vk::PipelineRobustness::NonRobust, vk::PipelineProtectedAccess::Unprotected);
-    return mShaderProgramHelper.getOrCreateComputePipeline(
-        mContext, &mComputePipelineCache, pipelineCache, getPipelineLayout(), options,
-        PipelineSource::Draw, pipelineOut, mName.c_str(), &computeSpecializationInfo);
+    return mProgram->getOrCreateComputePipeline(mShaderProgramHelper, pipelineCache,
+                                                getPipelineLayout(), options, mName,
+                                                &computeSpecializationInfo, pipelineOut);
 }
 
 bool CLKernelVk::usesPrintf() const
@@ -493,6 +494,14 @@ angle::Result CLKernelVk::allocateDescriptorSet(
 {
     if (mDescriptorSets[index] && mDescriptorSets[index]->valid())
     {
+        if (index == DescriptorSetIndex::KernelArguments && mKernelArgumentsDescriptorSetUpToDate)
+        {
+            // The arguments haven't changed since the set was last written, so back-to-back
+            // dispatches of this kernel (in the same command buffer or not) can all bind it.
+            computePassCommands->retainResource(mDescriptorSets[index].get());
+            return angle::Result::Continue;
+        }
+
         if (mDescriptorSets[index]->usedByCommandBuffer(computePassCommands->getQueueSerial()))
         {
             mDescriptorSets[index].reset();
@@ -503,6 +512,11 @@ angle::Result CLKernelVk::allocateDescriptorSet(
         }
     }
 
+    if (index == DescriptorSetIndex::KernelArguments)
+    {
+        mKernelArgumentsDescriptorSetUpToDate = false;
+    }
+
     if (mDynamicDescriptorPools[index]->valid())
     {
         ANGLE_TRY(mDynamicDescriptorPools[index]->allocateDescriptorSet(
@@ -144,6 +144,14 @@ class CLKernelVk : public CLKernelImpl
         angle::EnumIterator<DescriptorSetIndex> layoutIndex,
         vk::OutsideRenderPassCommandBufferHelper *computePassCommands);
 
+    // Whether the kernel arguments descriptor set already holds the current arguments, in which
+    // case the descriptor writes for it can be skipped.
+    bool isKernelArgumentsDescriptorSetUpToDate() const
+    {
+        return mKernelArgumentsDescriptorSetUpToDate;
+    }
+    void onKernelArgumentsDescriptorSetUpdated() { mKernelArgumentsDescriptorSetUpToDate = true; }
+
     // Initialize the descriptor pools for this kernel resources
     angle::Result initializeDescriptorPools();
 
@@ -162,7 +170,6 @@ class CLKernelVk : public CLKernelImpl
     cl::MemoryPtr mPodBuffer;
 
     vk::ShaderProgramHelper mShaderProgramHelper;
-    ComputePipelineCache mComputePipelineCache;
 
     // Pipeline and DescriptorSetLayout Shared pointers
     vk::PipelineLayoutPtr mPipelineLayout;
@@ -172,6 +179,9 @@ class CLKernelVk : public CLKernelImpl
     vk::DescriptorSetArray<vk::DescriptorSetPointer> mDescriptorSets;
     vk::DescriptorSetArray<vk::DynamicDescriptorPoolPointer> mDynamicDescriptorPools;
 
+    // Cleared by setArg and whenever a new kernel arguments descriptor set is allocated.
+    bool mKernelArgumentsDescriptorSetUpToDate = false;
+
     vk::DescriptorSetArray<vk::DescriptorSetLayoutDesc> mDescriptorSetLayoutDescs;
     vk::PipelineLayoutDesc mPipelineLayoutDesc;
 
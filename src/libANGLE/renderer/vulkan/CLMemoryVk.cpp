@@ -11,6 +11,7 @@
 #endif
 
 #include "common/log_utils.h"
+#include "common/system_utils.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -192,12 +193,25 @@ bool CLBufferVk::isHostPtrAligned() const
 {
     VkDeviceSize alignment =
         mRenderer->getPhysicalDeviceExternalMemoryHostProperties().minImportedHostPointerAlignment;
-    return reinterpret_cast<uintptr_t>(mMemory.getHostPtr()) % alignment == 0 &&
-           getSize() % alignment == 0;
+    if (reinterpret_cast<uintptr_t>(mMemory.getHostPtr()) % alignment != 0)
+    {
+        return false;
+    }
+
+    // The imported size is rounded up to the alignment.  That is only safe if the extra bytes are
+    // in the same page as the end of the application's allocation, so they are known to be mapped.
+    // The buffer itself keeps the real size, so the GPU never accesses them.
+    return getSize() % alignment == 0 || alignment <= angle::GetPageSize();
 }
 
 bool CLBufferVk::supportsZeroCopy() const
 {
+    // Sub-buffers alias their parent's memory, so they are zero-copy exactly when it is.
+    if (isSubBuffer())
+    {
+        return static_cast<const CLBufferVk *>(mParent)->supportsZeroCopy();
+    }
+
     return mRenderer->getFeatures().supportsExternalMemoryHost.enabled &&
            mMemory.getFlags().intersects(CL_MEM_USE_HOST_PTR) && isHostPtrAligned();
 }
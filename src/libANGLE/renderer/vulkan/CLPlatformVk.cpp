@@ -319,9 +319,10 @@ bool CLPlatformVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue
 }
 
 std::shared_ptr<angle::WaitableEvent> CLPlatformVk::postMultiThreadWorkerTask(
-    const std::shared_ptr<angle::Closure> &task)
+    const std::shared_ptr<angle::Closure> &task,
+    angle::WorkerTaskPriority priority)
 {
-    return mPlatform.getMultiThreadPool()->postWorkerTask(task);
+    return mPlatform.getMultiThreadPool()->postWorkerTask(task, priority);
 }
 
 void CLPlatformVk::notifyDeviceLost()
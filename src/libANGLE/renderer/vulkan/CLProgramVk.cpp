@@ -23,6 +23,8 @@
 #include "libANGLE/CLProgram.h"
 #include "libANGLE/cl_utils.h"
 
+#include "common/angle_version_info.h"
+#include "common/hash_utils.h"
 #include "common/log_utils.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
@@ -46,6 +48,36 @@ constexpr bool kAngleDebug = true;
 constexpr bool kAngleDebug = false;
 #endif
 
+// Computes the blob cache key of the clspv output for a program built from source.  clspv is
+// pinned to the ANGLE revision, so the commit hash stands in for the compiler version.  The
+// processed options already include the device-dependent clspv options.
+void ComputeClspvBinaryCacheKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                const std::string &source,
+                                const std::string &processedOptions,
+                                angle::BlobCacheKey *keyOut)
+{
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    const char *cacheName = "ANGLE clspv binary: ";
+    hasher.Update(cacheName, strlen(cacheName));
+    const char *commitHash = angle::GetANGLECommitHash();
+    hasher.Update(commitHash, strlen(commitHash));
+
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.vendorID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.deviceID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.driverVersion);
+
+    // Hash the sizes too, so that the source and options can't run into each other.
+    angle::UpdateHashWithValue(hasher, source.size());
+    hasher.Update(source.c_str(), source.size());
+    angle::UpdateHashWithValue(hasher, processedOptions.size());
+    hasher.Update(processedOptions.c_str(), processedOptions.size());
+
+    hasher.Final();
+    memcpy(keyOut->data(), hasher.Digest(), angle::kBlobCacheKeyLength);
+}
+
 // Used by SPIRV-Tools to parse reflection info
 spv_result_t ParseReflection(CLProgramVk::SpvReflectionData &reflectionData,
                              const spv_parsed_instruction_t &spvInstr)
@@ -552,6 +584,13 @@ angle::Result CLProgramVk::init(const size_t *lengths,
 
 CLProgramVk::~CLProgramVk()
 {
+    // Kernels hold a reference to their program, and are kept alive until their work finishes,
+    // so none of the pipelines are in use anymore.
+    for (auto &kernelPipelines : mComputePipelines)
+    {
+        kernelPipelines.second.destroy(mContext);
+    }
+
     if (mModuleConstantDataBuffer)
     {
         mModuleConstantDataBuffer.release();
@@ -569,10 +608,11 @@ angle::Result CLProgramVk::build(const cl::DevicePtrs &devices,
 
     if (notify)
     {
-        mAsyncBuildEvent =
-            getPlatform()->postMultiThreadWorkerTask(std::make_shared<CLAsyncBuildTask>(
-                this, devicePtrs, std::string(options ? options : ""), "", buildType,
-                LinkProgramsList{}, notify));
+        mAsyncBuildEvent = getPlatform()->postMultiThreadWorkerTask(
+            std::make_shared<CLAsyncBuildTask>(this, devicePtrs,
+                                               std::string(options ? options : ""), "", buildType,
+                                               LinkProgramsList{}, notify),
+            angle::WorkerTaskPriority::LatencyCritical);
         ASSERT(mAsyncBuildEvent != nullptr);
     }
     else
@@ -916,6 +956,22 @@ cl::MemoryPtr CLProgramVk::getOrCreateModuleConstantDataBuffer(const std::string
     return mModuleConstantDataBuffer;
 }
 
+angle::Result CLProgramVk::getOrCreateComputePipeline(
+    const vk::ShaderProgramHelper &shaderProgramHelper,
+    vk::PipelineCacheAccess *pipelineCache,
+    const vk::PipelineLayout &pipelineLayout,
+    vk::ComputePipelineOptions pipelineOptions,
+    const std::string &kernelName,
+    VkSpecializationInfo *specializationInfo,
+    vk::PipelineHelper **pipelineOut)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mComputePipelinesMutex);
+
+    return shaderProgramHelper.getOrCreateComputePipeline(
+        mContext, &mComputePipelines[kernelName], pipelineCache, pipelineLayout, pipelineOptions,
+        PipelineSource::Draw, pipelineOut, kernelName.c_str(), specializationInfo);
+}
+
 bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
                                 std::string options,
                                 std::string internalOptions,
@@ -949,6 +1005,32 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
                 case BuildType::BUILD:
                 case BuildType::COMPILE:
                 {
+                    // Executables built from source are looked up in the blob cache first, as
+                    // clspv dominates the build time.  The reflection data is parsed from the
+                    // SPIR-V below, so only the binary needs to be stored.
+                    vk::GlobalOps *globalOps = mContext->getRenderer()->getGlobalOps();
+                    angle::BlobCacheKey binaryCacheKey;
+                    const bool useBinaryCache = buildType == BuildType::BUILD && globalOps;
+                    if (useBinaryCache)
+                    {
+                        ComputeClspvBinaryCacheKey(
+                            mContext->getRenderer()->getPhysicalDeviceProperties(),
+                            mProgram.getSource(), processedOptions, &binaryCacheKey);
+
+                        angle::BlobCacheValue cachedBinary;
+                        if (globalOps->getBlob(binaryCacheKey, &cachedBinary) &&
+                            cachedBinary.size() > 0 && cachedBinary.size() % sizeof(uint32_t) == 0)
+                        {
+                            deviceProgramData.binary.assign(
+                                cachedBinary.size() / sizeof(uint32_t), 0);
+                            std::memcpy(deviceProgramData.binary.data(), cachedBinary.data(),
+                                        cachedBinary.size());
+                            deviceProgramData.binaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
+                            deviceProgramData.buildLog.clear();
+                            break;
+                        }
+                    }
+
                     ScopedClspvContext clspvCtx;
                     const char *clSrc = mProgram.getSource().c_str();
 
@@ -980,6 +1062,14 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
                         std::memcpy(deviceProgramData.binary.data(), clspvCtx.mOutputBin,
                                     clspvCtx.mOutputBinSize);
                         deviceProgramData.binaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
+
+                        angle::MemoryBuffer binaryBlob;
+                        if (useBinaryCache && binaryBlob.resize(clspvCtx.mOutputBinSize))
+                        {
+                            std::memcpy(binaryBlob.data(), clspvCtx.mOutputBin,
+                                        clspvCtx.mOutputBinSize);
+                            globalOps->putBlob(binaryCacheKey, binaryBlob);
+                        }
                     }
                     break;
                 }
@@ -1064,6 +1154,14 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
             if (mShader)
             {
                 mShader.reset();
+
+                // The pipelines were created from the previous shader module.
+                std::lock_guard<angle::SimpleMutex> lock(mComputePipelinesMutex);
+                for (auto &kernelPipelines : mComputePipelines)
+                {
+                    kernelPipelines.second.release(mContext);
+                }
+                mComputePipelines.clear();
             }
             // Strip SPIR-V binary if Vk implementation does not support non-semantic info
             angle::spirv::Blob spvBlob =
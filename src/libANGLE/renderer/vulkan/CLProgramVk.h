@@ -9,6 +9,7 @@
 #define LIBANGLE_RENDERER_VULKAN_CLPROGRAMVK_H_
 
 #include <cstdint>
+#include <unordered_map>
 
 #include "common/SimpleMutex.h"
 #include "common/hash_containers.h"
@@ -337,6 +338,16 @@ class CLProgramVk : public CLProgramImpl
     const vk::ShaderModulePtr &getShaderModule() const { return mShader; }
     cl::MemoryPtr getOrCreateModuleConstantDataBuffer(const std::string &kernelName);
 
+    // Compute pipelines are cached per kernel name in the program rather than in the kernel, so
+    // they are shared by every cl::Kernel created for that kernel and survive clReleaseKernel.
+    angle::Result getOrCreateComputePipeline(const vk::ShaderProgramHelper &shaderProgramHelper,
+                                             vk::PipelineCacheAccess *pipelineCache,
+                                             const vk::PipelineLayout &pipelineLayout,
+                                             vk::ComputePipelineOptions pipelineOptions,
+                                             const std::string &kernelName,
+                                             VkSpecializationInfo *specializationInfo,
+                                             vk::PipelineHelper **pipelineOut);
+
     bool buildInternal(const cl::DevicePtrs &devices,
                        std::string options,
                        std::string internalOptions,
@@ -358,6 +369,10 @@ class CLProgramVk : public CLProgramImpl
     angle::SimpleMutex mProgramMutex;
     std::shared_ptr<angle::WaitableEvent> mAsyncBuildEvent;
     cl::MemoryPtr mModuleConstantDataBuffer;
+
+    // Kernels can be enqueued on several queues at once, so the caches have their own lock.
+    angle::SimpleMutex mComputePipelinesMutex;
+    std::unordered_map<std::string, ComputePipelineCache> mComputePipelines;
 };
 
 class CLAsyncBuildTask : public angle::Closure
@@ -69,6 +69,30 @@ void GetDeviceQueue(VkDevice device,
         vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, queue);
     }
 }
+
+VkResult GetTimelineSemaphoreStatus(VkDevice device, VkSemaphore semaphore, uint64_t value)
+{
+    uint64_t currentValue = 0;
+    VkResult result       = vkGetSemaphoreCounterValueKHR(device, semaphore, &currentValue);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+    return currentValue >= value ? VK_SUCCESS : VK_NOT_READY;
+}
+
+VkResult WaitTimelineSemaphore(VkDevice device,
+                               VkSemaphore semaphore,
+                               uint64_t value,
+                               uint64_t timeout)
+{
+    VkSemaphoreWaitInfoKHR waitInfo = {};
+    waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    waitInfo.semaphoreCount         = 1;
+    waitInfo.pSemaphores            = &semaphore;
+    waitInfo.pValues                = &value;
+    return vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+}
 }  // namespace
 
 // RecyclableFence implementation
@@ -148,7 +172,10 @@ void FenceRecycler::recycle(Fence &&fence)
 
 // CommandBatch implementation.
 CommandBatch::CommandBatch()
-    : mProtectionType(ProtectionType::InvalidEnum), mCommandPoolAccess(nullptr)
+    : mProtectionType(ProtectionType::InvalidEnum),
+      mCommandPoolAccess(nullptr),
+      mTimelineSemaphore(VK_NULL_HANDLE),
+      mTimelineValue(0)
 {}
 
 CommandBatch::~CommandBatch() = default;
@@ -167,6 +194,8 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(mSecondaryCommands, other.mSecondaryCommands);
     std::swap(mFence, other.mFence);
     std::swap(mExternalFence, other.mExternalFence);
+    std::swap(mTimelineSemaphore, other.mTimelineSemaphore);
+    std::swap(mTimelineValue, other.mTimelineValue);
     return *this;
 }
 
@@ -255,6 +284,15 @@ ANGLE_INLINE void CommandBatch::setExternalFence(SharedExternalFence &&externalF
     mExternalFence = std::move(externalFence);
 }
 
+ANGLE_INLINE void CommandBatch::setTimelineSignal(VkSemaphore timelineSemaphore,
+                                                  uint64_t timelineValue)
+{
+    ASSERT(timelineSemaphore != VK_NULL_HANDLE);
+    ASSERT(mTimelineSemaphore == VK_NULL_HANDLE);
+    mTimelineSemaphore = timelineSemaphore;
+    mTimelineValue     = timelineValue;
+}
+
 ANGLE_INLINE const QueueSerial &CommandBatch::getQueueSerial() const
 {
     ASSERT(mQueueSerial.valid());
@@ -283,28 +321,50 @@ ANGLE_INLINE VkFence CommandBatch::getFenceHandle() const
     return mFence ? mFence->get().getHandle() : mExternalFence->getHandle();
 }
 
-ANGLE_INLINE VkResult CommandBatch::getFenceStatus(VkDevice device) const
+ANGLE_INLINE bool CommandBatch::hasCompletionSignal() const
 {
-    ASSERT(hasFence());
+    return mTimelineSemaphore != VK_NULL_HANDLE || hasFence();
+}
+
+ANGLE_INLINE VkResult CommandBatch::getCompletionStatus(VkDevice device) const
+{
+    ASSERT(hasCompletionSignal());
+    if (mTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        return GetTimelineSemaphoreStatus(device, mTimelineSemaphore, mTimelineValue);
+    }
     return mFence ? mFence->get().getStatus(device) : mExternalFence->getStatus(device);
 }
 
-ANGLE_INLINE VkResult CommandBatch::waitFence(VkDevice device, uint64_t timeout) const
+ANGLE_INLINE VkResult CommandBatch::waitCompletion(VkDevice device, uint64_t timeout) const
 {
-    ASSERT(hasFence());
+    ASSERT(hasCompletionSignal());
+    if (mTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        return WaitTimelineSemaphore(device, mTimelineSemaphore, mTimelineValue, timeout);
+    }
     return mFence ? mFence->get().wait(device, timeout) : mExternalFence->wait(device, timeout);
 }
 
 ANGLE_INLINE VkResult
-CommandBatch::waitFenceUnlocked(VkDevice device,
-                                uint64_t timeout,
-                                std::unique_lock<angle::SimpleMutex> *lock) const
+CommandBatch::waitCompletionUnlocked(VkDevice device,
+                                     uint64_t timeout,
+                                     std::unique_lock<angle::SimpleMutex> *lock) const
 {
-    ASSERT(hasFence());
+    ASSERT(hasCompletionSignal());
     VkResult status;
     // You can only use the local copy of the fence without lock.
     // Do not access "this" after unlock() because object might be deleted from other thread.
-    if (mFence)
+    if (mTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        // The semaphore itself lives as long as the CommandQueue.
+        const VkSemaphore localSemaphoreToWaitOn = mTimelineSemaphore;
+        const uint64_t localValueToWaitOn        = mTimelineValue;
+        lock->unlock();
+        status = WaitTimelineSemaphore(device, localSemaphoreToWaitOn, localValueToWaitOn, timeout);
+        lock->lock();
+    }
+    else if (mFence)
     {
         const SharedFence localFenceToWaitOn = mFence;
         lock->unlock();
@@ -345,10 +405,7 @@ void CleanUpThread::handleError(VkResult errorCode,
 }
 
 CleanUpThread::CleanUpThread(Renderer *renderer, CommandQueue *commandQueue)
-    : ErrorContext(renderer),
-      mCommandQueue(commandQueue),
-      mTaskThreadShouldExit(false),
-      mNeedCleanUp(false)
+    : ErrorContext(renderer), mCommandQueue(commandQueue)
 {}
 
 CleanUpThread::~CleanUpThread() = default;
@@ -372,12 +429,9 @@ angle::Result CleanUpThread::checkAndPopPendingError(ErrorContext *errorHandling
 
 void CleanUpThread::requestCleanUp()
 {
-    if (!mNeedCleanUp.exchange(true))
-    {
-        // request clean up in async thread
-        std::unique_lock<std::mutex> enqueueLock(mMutex);
-        mWorkAvailableCondition.notify_one();
-    }
+    // Request clean up in async thread.  This is lock-free, and only makes a system call if the
+    // thread is idle.
+    mNeedCleanUp.raise();
 }
 
 void CleanUpThread::processTasks()
@@ -401,31 +455,18 @@ angle::Result CleanUpThread::processTasksImpl(bool *exitThread)
     WhenToResetCommandBuffer whenToReset = mRenderer->getFeatures().asyncCommandBufferReset.enabled
                                                ? WhenToResetCommandBuffer::Now
                                                : WhenToResetCommandBuffer::Defer;
-    while (true)
+    while (mNeedCleanUp.wait())
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mWorkAvailableCondition.wait(lock,
-                                     [this] { return mTaskThreadShouldExit || mNeedCleanUp; });
-
-        if (mTaskThreadShouldExit)
-        {
-            break;
-        }
-        lock.unlock();
+        // Always check completed commands again in case anything new has been finished.
+        ANGLE_TRY(mCommandQueue->checkCompletedCommands(this));
 
-        if (mNeedCleanUp.exchange(false))
+        // Reset command buffer and clean up garbage
+        if (mRenderer->getFeatures().asyncGarbageCleanup.enabled &&
+            mCommandQueue->hasFinishedCommands())
         {
-            // Always check completed commands again in case anything new has been finished.
-            ANGLE_TRY(mCommandQueue->checkCompletedCommands(this));
-
-            // Reset command buffer and clean up garbage
-            if (mRenderer->getFeatures().asyncGarbageCleanup.enabled &&
-                mCommandQueue->hasFinishedCommands())
-            {
-                ANGLE_TRY(mCommandQueue->releaseFinishedCommands(this, whenToReset));
-            }
-            mRenderer->cleanupGarbage(nullptr);
+            ANGLE_TRY(mCommandQueue->releaseFinishedCommands(this, whenToReset));
         }
+        mRenderer->cleanupGarbage(nullptr, GarbageCleanupBudget::Limited);
     }
     *exitThread = true;
     return angle::Result::Continue;
@@ -440,13 +481,8 @@ angle::Result CleanUpThread::init()
 
 void CleanUpThread::destroy(ErrorContext *context)
 {
-    {
-        // Request to terminate the worker thread
-        std::lock_guard<std::mutex> lock(mMutex);
-        mTaskThreadShouldExit = true;
-        mNeedCleanUp          = false;
-        mWorkAvailableCondition.notify_one();
-    }
+    // Request to terminate the worker thread
+    mNeedCleanUp.terminate();
 
     // Perform any lingering clean up right away.
     if (mRenderer->getFeatures().asyncGarbageCleanup.enabled)
@@ -605,19 +641,44 @@ CommandQueue::CommandQueue()
     : mInFlightCommands(kInFlightCommandsLimit),
       mFinishedCommandBatches(kMaxFinishedCommandsLimit),
       mNumAllCommands(0),
+      mReservedInFlightBatches(0),
       mPerfCounters{}
 {}
 
 CommandQueue::~CommandQueue() = default;
 
+void CommandQueue::lockVulkanQueueForExternalAccess()
+{
+    // Lanes are always locked in the order of their priorities, so two threads locking several
+    // of them can't deadlock.
+    for (angle::SimpleMutex &laneMutex : mQueueLaneMutexes)
+    {
+        laneMutex.lock();
+    }
+}
+
+void CommandQueue::unlockVulkanQueueForExternalAccess()
+{
+    for (angle::SimpleMutex &laneMutex : mQueueLaneMutexes)
+    {
+        laneMutex.unlock();
+    }
+}
+
 void CommandQueue::destroy(ErrorContext *context)
 {
+    ScopedQueueLanesLock queueLanesLock(this);
     std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
     std::lock_guard<angle::SimpleMutex> cmdCompleteLock(mCmdCompleteMutex);
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
 
     mQueueMap.destroy();
 
+    for (TimelineSemaphore &timelineSemaphore : mTimelineSemaphores)
+    {
+        timelineSemaphore.semaphore.destroy(context->getDevice());
+    }
+
     // Assigns an infinite "last completed" serial to force garbage to delete.
     mLastCompletedSerials.fill(Serial::Infinite());
 
@@ -635,6 +696,7 @@ angle::Result CommandQueue::init(ErrorContext *context,
                                  bool enableProtectedContent,
                                  uint32_t queueCount)
 {
+    ScopedQueueLanesLock queueLanesLock(this);
     std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
     std::lock_guard<angle::SimpleMutex> cmdCompleteLock(mCmdCompleteMutex);
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
@@ -653,6 +715,16 @@ angle::Result CommandQueue::init(ErrorContext *context,
         ANGLE_TRY(mCommandPoolAccess.initCommandPool(context, ProtectionType::Protected,
                                                      mQueueMap.getQueueFamilyIndex()));
     }
+
+    if (context->getFeatures().useTimelineSemaphoreForQueueSerials.enabled)
+    {
+        for (TimelineSemaphore &timelineSemaphore : mTimelineSemaphores)
+        {
+            ANGLE_VK_TRY(context, timelineSemaphore.semaphore.init(context->getDevice(),
+                                                                   VK_SEMAPHORE_TYPE_TIMELINE));
+            timelineSemaphore.lastSignaledValue = 0;
+        }
+    }
     return angle::Result::Continue;
 }
 
@@ -661,6 +733,7 @@ void CommandQueue::handleDeviceLost(Renderer *renderer)
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::handleDeviceLost");
     VkDevice device = renderer->getDevice();
     // Hold all locks while clean up mInFlightCommands.
+    ScopedQueueLanesLock queueLanesLock(this);
     std::lock_guard<angle::SimpleMutex> queueSubmitLock(mQueueSubmitMutex);
     std::lock_guard<angle::SimpleMutex> cmdCompleteLock(mCmdCompleteMutex);
     std::lock_guard<angle::SimpleMutex> cmdReleaseLock(mCmdReleaseMutex);
@@ -672,9 +745,9 @@ void CommandQueue::handleDeviceLost(Renderer *renderer)
     {
         CommandBatch &batch = mInFlightCommands.front();
         // On device loss we need to wait for fence to be signaled before destroying it
-        if (batch.hasFence())
+        if (batch.hasCompletionSignal())
         {
-            VkResult status = batch.waitFence(device, renderer->getMaxFenceWaitTimeNs());
+            VkResult status = batch.waitCompletion(device, renderer->getMaxFenceWaitTimeNs());
             // If the wait times out, it is probably not possible to recover from lost device
             ASSERT(status == VK_SUCCESS || status == VK_ERROR_DEVICE_LOST);
         }
@@ -729,8 +802,8 @@ angle::Result CommandQueue::finishResourceUse(ErrorContext *context,
             ANGLE_TRY(checkOneCommandBatchLocked(context, &finished));
             if (!finished)
             {
-                ANGLE_VK_TRY(context,
-                             mInFlightCommands.front().waitFenceUnlocked(device, timeout, &lock));
+                ANGLE_VK_TRY(context, mInFlightCommands.front().waitCompletionUnlocked(
+                                          device, timeout, &lock));
             }
         }
         // Check the rest of the commands in case they are also finished.
@@ -794,7 +867,7 @@ angle::Result CommandQueue::waitForResourceUseToFinishWithUserTimeout(ErrorConte
             ANGLE_TRY(checkOneCommandBatchLocked(context, &finished));
             if (!finished)
             {
-                *result = mInFlightCommands.front().waitFenceUnlocked(device, timeout, &lock);
+                *result = mInFlightCommands.front().waitCompletionUnlocked(device, timeout, &lock);
                 // Don't trigger an error on timeout.
                 if (*result == VK_TIMEOUT)
                 {
@@ -844,13 +917,13 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
                                            CommandsState &&commandsState)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitCommands");
-    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
     Renderer *renderer = context->getRenderer();
     VkDevice device    = renderer->getDevice();
 
-    ++mPerfCounters.commandQueueSubmitCallsTotal;
-    ++mPerfCounters.commandQueueSubmitCallsPerFrame;
-
+    // Everything that is private to this submission (ending the primary command buffer, gathering
+    // the wait semaphores and preparing the fence) is done before taking the queue lane mutex.
+    // With many contexts submitting at once, this keeps the critical section down to what must be
+    // ordered between them, i.e. vkQueueSubmit and the in-flight list update.
     DeviceScoped<CommandBatch> scopedBatch(device);
     CommandBatch &batch = scopedBatch.get();
 
@@ -863,8 +936,6 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
     ANGLE_TRY(commandsState.getCommandsAndWaitSemaphores(
         context, &mCommandPoolAccess, &batch, &waitSemaphores, &waitSemaphoreStageMasks));
 
-    mPerfCounters.commandQueueWaitSemaphoresTotal += waitSemaphores.size();
-
     // Don't make a submission if there is nothing to submit.
     const bool needsQueueSubmit = batch.getPrimaryCommands().valid() ||
                                   signalSemaphore != VK_NULL_HANDLE || externalFence ||
@@ -888,9 +959,12 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
         }
 
         // Initializing a fence is not required if the batch already has an external fence and does
-        // not need an extra fence after its submission.
+        // not need an extra fence after its submission, or if its completion is tracked with the
+        // timeline semaphore.
         const bool needsOwnedFence =
-            renderer->getFeatures().enableExtraSubmitFence.enabled || !externalFence;
+            renderer->getFeatures().enableExtraSubmitFence.enabled ||
+            (!externalFence &&
+             !renderer->getFeatures().useTimelineSemaphoreForQueueSerials.enabled);
         if (needsOwnedFence)
         {
             ANGLE_VK_TRY(context, batch.initFence(device, &mFenceRecycler));
@@ -899,13 +973,13 @@ angle::Result CommandQueue::submitCommands(ErrorContext *context,
         {
             batch.setExternalFence(std::move(externalFence));
         }
-
-        ++mPerfCounters.vkQueueSubmitCallsTotal;
-        ++mPerfCounters.vkQueueSubmitCallsPerFrame;
     }
 
-    return queueSubmitLocked(context, commandsState.getPriority(), submitInfo, scopedBatch,
-                             submitQueueSerial);
+    const egl::ContextPriority contextPriority = commandsState.getPriority();
+    std::lock_guard<angle::SimpleMutex> laneLock(getQueueLaneMutex(contextPriority));
+
+    return queueSubmitLocked(context, contextPriority, submitInfo, scopedBatch, submitQueueSerial,
+                             true);
 }
 
 angle::Result CommandQueue::queueSubmitOneOff(ErrorContext *context,
@@ -916,13 +990,15 @@ angle::Result CommandQueue::queueSubmitOneOff(ErrorContext *context,
                                               VkPipelineStageFlags waitSemaphoreStageMask,
                                               const QueueSerial &submitQueueSerial)
 {
-    std::unique_lock<angle::SimpleMutex> lock(mQueueSubmitMutex);
     DeviceScoped<CommandBatch> scopedBatch(context->getDevice());
     CommandBatch &batch = scopedBatch.get();
     batch.setQueueSerial(submitQueueSerial);
     batch.setProtectionType(protectionType);
 
-    ANGLE_VK_TRY(context, batch.initFence(context->getDevice(), &mFenceRecycler));
+    if (!context->getFeatures().useTimelineSemaphoreForQueueSerials.enabled)
+    {
+        ANGLE_VK_TRY(context, batch.initFence(context->getDevice(), &mFenceRecycler));
+    }
 
     VkSubmitInfo submitInfo = {};
     submitInfo.sType        = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -951,56 +1027,144 @@ angle::Result CommandQueue::queueSubmitOneOff(ErrorContext *context,
         submitInfo.pWaitDstStageMask  = &waitSemaphoreStageMask;
     }
 
-    ++mPerfCounters.vkQueueSubmitCallsTotal;
-    ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+    std::lock_guard<angle::SimpleMutex> laneLock(getQueueLaneMutex(contextPriority));
 
-    return queueSubmitLocked(context, contextPriority, submitInfo, scopedBatch, submitQueueSerial);
+    return queueSubmitLocked(context, contextPriority, submitInfo, scopedBatch, submitQueueSerial,
+                             false);
 }
 
-angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
-                                              egl::ContextPriority contextPriority,
-                                              const VkSubmitInfo &submitInfo,
-                                              DeviceScoped<CommandBatch> &commandBatch,
-                                              const QueueSerial &submitQueueSerial)
+angle::Result CommandQueue::reserveInFlightBatch(ErrorContext *context)
 {
-    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::queueSubmitLocked");
     Renderer *renderer = context->getRenderer();
+    std::unique_lock<angle::SimpleMutex> submitLock(mQueueSubmitMutex);
 
     // CPU should be throttled to avoid mInFlightCommands from growing too fast. Important for
-    // off-screen scenarios.
-    if (mInFlightCommands.full())
+    // off-screen scenarios.  mQueueSubmitMutex is not held during the wait, so that only the
+    // submissions of this queue lane wait for it.
+    while (mInFlightCommands.size() + mReservedInFlightBatches >= mInFlightCommands.capacity())
     {
-        std::unique_lock<angle::SimpleMutex> lock(mCmdCompleteMutex);
-        // Check once more inside the lock in case other thread already finished some/all commands.
-        if (mInFlightCommands.full())
+        submitLock.unlock();
         {
-            ANGLE_TRY(finishOneCommandBatch(context, renderer->getMaxFenceWaitTimeNs(), &lock));
+            std::unique_lock<angle::SimpleMutex> lock(mCmdCompleteMutex);
+            // Check once more inside the lock in case other thread already finished some/all
+            // commands.  The remaining batches may be reserved by others lanes, which are
+            // throttled by waiting for the oldest batch too.
+            if (!mInFlightCommands.empty())
+            {
+                ANGLE_TRY(
+                    finishOneCommandBatch(context, renderer->getMaxFenceWaitTimeNs(), &lock));
+            }
         }
+        submitLock.lock();
     }
-    // Assert will succeed since new batch is pushed only in this method below.
-    ASSERT(!mInFlightCommands.full());
 
     // Also ensure that all mInFlightCommands may be moved into the mFinishedCommandBatches without
     // need of the releaseFinishedCommandsLocked() call.
-    ASSERT(mNumAllCommands <= mFinishedCommandBatches.capacity());
-    if (mNumAllCommands == mFinishedCommandBatches.capacity())
+    ASSERT(mNumAllCommands + mReservedInFlightBatches <= mFinishedCommandBatches.capacity());
+    if (mNumAllCommands + mReservedInFlightBatches >= mFinishedCommandBatches.capacity())
     {
         std::lock_guard<angle::SimpleMutex> lock(mCmdReleaseMutex);
         ANGLE_TRY(releaseFinishedCommandsLocked(context, WhenToResetCommandBuffer::Now));
     }
-    // Assert will succeed since mNumAllCommands is incremented only in this method below.
-    ASSERT(mNumAllCommands < mFinishedCommandBatches.capacity());
+    // Assert will succeed since mNumAllCommands is incremented only after a reservation.
+    ASSERT(mNumAllCommands + mReservedInFlightBatches < mFinishedCommandBatches.capacity());
 
+    ++mReservedInFlightBatches;
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
+                                              egl::ContextPriority contextPriority,
+                                              const VkSubmitInfo &submitInfo,
+                                              DeviceScoped<CommandBatch> &commandBatch,
+                                              const QueueSerial &submitQueueSerial,
+                                              bool isCommandsSubmission)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::queueSubmitLocked");
+
+    // Make room for the batch in mInFlightCommands, then submit it while only holding the mutex of
+    // its queue lane.  A submission to the queue of another priority doesn't wait behind this one.
+    ANGLE_TRY(reserveInFlightBatch(context));
+    const angle::Result result =
+        vkQueueSubmitLocked(context, contextPriority, submitInfo, commandBatch.get());
+
+    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+    --mReservedInFlightBatches;
+    ANGLE_TRY(result);
+
+    if (isCommandsSubmission)
+    {
+        ++mPerfCounters.commandQueueSubmitCallsTotal;
+        ++mPerfCounters.commandQueueSubmitCallsPerFrame;
+        mPerfCounters.commandQueueWaitSemaphoresTotal += submitInfo.waitSemaphoreCount;
+    }
     if (submitInfo.sType == VK_STRUCTURE_TYPE_SUBMIT_INFO)
     {
-        CommandBatch &batch = commandBatch.get();
+        ++mPerfCounters.vkQueueSubmitCallsTotal;
+        ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+    }
+
+    pushInFlightBatchLocked(commandBatch.release());
 
+    // This must set last so that when this submission appears submitted, it actually already
+    // submitted and enqueued to mInFlightCommands.
+    mLastSubmittedSerials.setQueueSerial(submitQueueSerial);
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::vkQueueSubmitLocked(ErrorContext *context,
+                                                egl::ContextPriority contextPriority,
+                                                const VkSubmitInfo &submitInfo,
+                                                CommandBatch &batch)
+{
+    Renderer *renderer = context->getRenderer();
+
+    if (submitInfo.sType == VK_STRUCTURE_TYPE_SUBMIT_INFO)
+    {
         VkQueue queue = getQueue(contextPriority);
+
+        // Add the next value of the queue's timeline semaphore to the signal operations of the
+        // submission.  Values are assigned here, under the mutex of the queue lane, so that they
+        // increase in submission order.
+        VkSubmitInfo finalSubmitInfo                           = submitInfo;
+        VkTimelineSemaphoreSubmitInfoKHR timelineSemaphoreInfo = {};
+        std::array<VkSemaphore, 2> timelineSignalSemaphores    = {};
+        std::array<uint64_t, 2> timelineSignalValues           = {};
+        const bool useTimelineSemaphore =
+            renderer->getFeatures().useTimelineSemaphoreForQueueSerials.enabled;
+        if (useTimelineSemaphore)
+        {
+            TimelineSemaphore &timelineSemaphore = mTimelineSemaphores[contextPriority];
+            const uint64_t signalValue           = ++timelineSemaphore.lastSignaledValue;
+
+            ASSERT(submitInfo.signalSemaphoreCount < timelineSignalSemaphores.size());
+            uint32_t signalCount = 0;
+            for (; signalCount < submitInfo.signalSemaphoreCount; ++signalCount)
+            {
+                // The values of binary semaphores are ignored.
+                timelineSignalSemaphores[signalCount] = submitInfo.pSignalSemaphores[signalCount];
+            }
+            timelineSignalSemaphores[signalCount] = timelineSemaphore.semaphore.getHandle();
+            timelineSignalValues[signalCount]     = signalValue;
+            ++signalCount;
+
+            timelineSemaphoreInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineSemaphoreInfo.pNext = submitInfo.pNext;
+            timelineSemaphoreInfo.signalSemaphoreValueCount = signalCount;
+            timelineSemaphoreInfo.pSignalSemaphoreValues    = timelineSignalValues.data();
+
+            finalSubmitInfo.pNext                = &timelineSemaphoreInfo;
+            finalSubmitInfo.signalSemaphoreCount = signalCount;
+            finalSubmitInfo.pSignalSemaphores    = timelineSignalSemaphores.data();
+
+            batch.setTimelineSignal(timelineSemaphore.semaphore.getHandle(), signalValue);
+        }
+
         if (batch.getExternalFence())
         {
             VkFence externalFenceHandle = batch.getExternalFence()->getHandle();
             ASSERT(externalFenceHandle != VK_NULL_HANDLE);
-            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, externalFenceHandle));
+            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &finalSubmitInfo, externalFenceHandle));
 
             // If enabled, there will be an extra fence submitted after the primary commands.
             if (renderer->getFeatures().enableExtraSubmitFence.enabled)
@@ -1024,24 +1188,20 @@ angle::Result CommandQueue::queueSubmitLocked(ErrorContext *context,
         }
         else
         {
-            VkFence fence = batch.getFenceHandle();
-            ASSERT(fence != VK_NULL_HANDLE);
-            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, fence));
+            // No fence is needed when the submission signals the timeline semaphore.
+            VkFence fence = useTimelineSemaphore ? VK_NULL_HANDLE : batch.getFenceHandle();
+            ASSERT(useTimelineSemaphore || fence != VK_NULL_HANDLE);
+            ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &finalSubmitInfo, fence));
         }
     }
 
-    pushInFlightBatchLocked(commandBatch.release());
-
-    // This must set last so that when this submission appears submitted, it actually already
-    // submitted and enqueued to mInFlightCommands.
-    mLastSubmittedSerials.setQueueSerial(submitQueueSerial);
     return angle::Result::Continue;
 }
 
 VkResult CommandQueue::queuePresent(egl::ContextPriority contextPriority,
                                     const VkPresentInfoKHR &presentInfo)
 {
-    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+    std::lock_guard<angle::SimpleMutex> lock(getQueueLaneMutex(contextPriority));
     VkQueue queue = getQueue(contextPriority);
     return vkQueuePresentKHR(queue, &presentInfo);
 }
@@ -1070,7 +1230,7 @@ angle::Result CommandQueue::releaseFinishedCommandsAndCleanupGarbage(ErrorContex
     {
         // Do immediate command buffer reset and garbage cleanup
         ANGLE_TRY(releaseFinishedCommands(context, WhenToResetCommandBuffer::Now));
-        renderer->cleanupGarbage(nullptr);
+        renderer->cleanupGarbage(nullptr, GarbageCleanupBudget::Limited);
     }
 
     return angle::Result::Continue;
@@ -1114,9 +1274,9 @@ angle::Result CommandQueue::checkOneCommandBatchLocked(ErrorContext *context, bo
 
     CommandBatch &batch = mInFlightCommands.front();
     *finished           = false;
-    if (batch.hasFence())
+    if (batch.hasCompletionSignal())
     {
-        VkResult status = batch.getFenceStatus(context->getDevice());
+        VkResult status = batch.getCompletionStatus(context->getDevice());
         if (status == VK_NOT_READY)
         {
             return angle::Result::Continue;
@@ -1140,9 +1300,9 @@ angle::Result CommandQueue::finishOneCommandBatch(ErrorContext *context,
     CommandBatch &batch = mInFlightCommands.front();
     // Save queue serial since the batch may be destroyed during possible unlocked fence wait.
     const QueueSerial batchSerial = batch.getQueueSerial();
-    if (batch.hasFence())
+    if (batch.hasCompletionSignal())
     {
-        VkResult status = batch.waitFenceUnlocked(context->getDevice(), timeout, lock);
+        VkResult status = batch.waitCompletionUnlocked(context->getDevice(), timeout, lock);
         ANGLE_VK_TRY(context, status);
     }
 
@@ -10,13 +10,13 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_COMMAND_Queue_H_
 #define LIBANGLE_RENDERER_VULKAN_COMMAND_Queue_H_
 
-#include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <thread>
 
 #include "common/FixedQueue.h"
 #include "common/SimpleMutex.h"
+#include "common/WorkerThread.h"
 #include "common/vulkan/vk_headers.h"
 #include "libANGLE/renderer/vulkan/PersistentCommandPool.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -97,6 +97,7 @@ class CommandBatch final : angle::NonCopyable
     void setSecondaryCommands(SecondaryCommandBufferCollector &&secondaryCommands);
     VkResult initFence(VkDevice device, FenceRecycler *recycler);
     void setExternalFence(SharedExternalFence &&externalFence);
+    void setTimelineSignal(VkSemaphore timelineSemaphore, uint64_t timelineValue);
 
     const QueueSerial &getQueueSerial() const;
     const PrimaryCommandBuffer &getPrimaryCommands() const;
@@ -106,11 +107,15 @@ class CommandBatch final : angle::NonCopyable
     // fence may be used in an extra empty submission after the external fence (via a feature flag).
     bool hasFence() const;
     VkFence getFenceHandle() const;
-    VkResult getFenceStatus(VkDevice device) const;
-    VkResult waitFence(VkDevice device, uint64_t timeout) const;
-    VkResult waitFenceUnlocked(VkDevice device,
-                               uint64_t timeout,
-                               std::unique_lock<angle::SimpleMutex> *lock) const;
+
+    // Completion of the batch is tracked with the timeline semaphore value signaled by its
+    // submission if any, and with the fences otherwise.
+    bool hasCompletionSignal() const;
+    VkResult getCompletionStatus(VkDevice device) const;
+    VkResult waitCompletion(VkDevice device, uint64_t timeout) const;
+    VkResult waitCompletionUnlocked(VkDevice device,
+                                    uint64_t timeout,
+                                    std::unique_lock<angle::SimpleMutex> *lock) const;
 
   private:
     QueueSerial mQueueSerial;
@@ -121,6 +126,9 @@ class CommandBatch final : angle::NonCopyable
     SecondaryCommandBufferCollector mSecondaryCommands;
     SharedFence mFence;
     SharedExternalFence mExternalFence;
+    // The semaphore is owned by CommandQueue and outlives the batch.
+    VkSemaphore mTimelineSemaphore;
+    uint64_t mTimelineValue;
 };
 using CommandBatchQueue = angle::FixedQueue<CommandBatch>;
 
@@ -366,8 +374,8 @@ class CommandQueue : angle::NonCopyable
     // The following are used to implement EGL_ANGLE_device_vulkan, and are called by the
     // application when it wants to access the VkQueue previously retrieved from ANGLE.  Do not call
     // these for synchronization within ANGLE.
-    void lockVulkanQueueForExternalAccess() { mQueueSubmitMutex.lock(); }
-    void unlockVulkanQueueForExternalAccess() { mQueueSubmitMutex.unlock(); }
+    void lockVulkanQueueForExternalAccess();
+    void unlockVulkanQueueForExternalAccess();
 
     Serial getLastSubmittedSerial(SerialIndex index) const { return mLastSubmittedSerials[index]; }
 
@@ -487,18 +495,48 @@ class CommandQueue : angle::NonCopyable
                                     egl::ContextPriority contextPriority,
                                     const VkSubmitInfo &submitInfo,
                                     DeviceScoped<CommandBatch> &commandBatch,
-                                    const QueueSerial &submitQueueSerial);
+                                    const QueueSerial &submitQueueSerial,
+                                    bool isCommandsSubmission);
+    // Waits until mInFlightCommands has room for one more batch and reserves it.
+    angle::Result reserveInFlightBatch(ErrorContext *context);
+    angle::Result vkQueueSubmitLocked(ErrorContext *context,
+                                      egl::ContextPriority contextPriority,
+                                      const VkSubmitInfo &submitInfo,
+                                      CommandBatch &batch);
 
     void pushInFlightBatchLocked(CommandBatch &&batch);
     void moveInFlightBatchToFinishedQueueLocked(CommandBatch &&batch);
     void popFinishedBatchLocked();
     void popInFlightBatchLocked();
 
+    // The mutex of the queue lane that submissions of |priority| are made to.  Context priorities
+    // that share a VkQueue share its lane.
+    angle::SimpleMutex &getQueueLaneMutex(egl::ContextPriority priority)
+    {
+        return mQueueLaneMutexes[mQueueMap.getDevicePriority(priority)];
+    }
+
+    class ScopedQueueLanesLock final : angle::NonCopyable
+    {
+      public:
+        ScopedQueueLanesLock(CommandQueue *commandQueue) : mCommandQueue(commandQueue)
+        {
+            mCommandQueue->lockVulkanQueueForExternalAccess();
+        }
+        ~ScopedQueueLanesLock() { mCommandQueue->unlockVulkanQueueForExternalAccess(); }
+
+      private:
+        CommandQueue *mCommandQueue;
+    };
+
     CommandPoolAccess mCommandPoolAccess;
 
     // Warning: Mutexes must be locked in the order as declared below.
-    // Protect multi-thread access to mInFlightCommands.push/back and ensure ordering of submission.
-    // Also protects mPerfCounters.
+    // Protect multi-thread access to each VkQueue and ensure ordering of submissions to it.  The
+    // mutexes are locked in the order of the priorities when more than one is needed.
+    angle::PackedEnumMap<egl::ContextPriority, angle::SimpleMutex> mQueueLaneMutexes;
+    // Protect multi-thread access to mInFlightCommands.push/back and mReservedInFlightBatches.
+    // Only held for bookkeeping, not while calling vkQueueSubmit.  Also protects mPerfCounters.
     mutable angle::SimpleMutex mQueueSubmitMutex;
     // Protect multi-thread access to mInFlightCommands.pop/front and
     // mFinishedCommandBatches.push/back.
@@ -514,6 +552,8 @@ class CommandQueue : angle::NonCopyable
     // Used instead of calculating the sum because doing this is not thread safe and will require
     // the mCmdCompleteMutex lock.
     std::atomic_size_t mNumAllCommands;
+    // Number of batches being submitted by queue lanes that are not in mInFlightCommands yet.
+    size_t mReservedInFlightBatches;
 
     // Queue serial management.
     AtomicQueueSerialFixedArray mLastSubmittedSerials;
@@ -527,6 +567,16 @@ class CommandQueue : angle::NonCopyable
 
     FenceRecycler mFenceRecycler;
 
+    // With useTimelineSemaphoreForQueueSerials, every submission signals the next value of the
+    // timeline semaphore of its queue instead of a fence.  Protected by the mutex of the queue
+    // lane.
+    struct TimelineSemaphore
+    {
+        Semaphore semaphore;
+        uint64_t lastSignaledValue = 0;
+    };
+    angle::PackedEnumMap<egl::ContextPriority, TimelineSemaphore> mTimelineSemaphores;
+
     angle::VulkanPerfCounters mPerfCounters;
 };
 
@@ -579,10 +629,7 @@ class CleanUpThread : public ErrorContext
 
     // Command queue worker thread.
     std::thread mTaskThread;
-    bool mTaskThreadShouldExit;
-    std::mutex mMutex;
-    std::condition_variable mWorkAvailableCondition;
-    std::atomic<bool> mNeedCleanUp;
+    angle::WorkSignal mNeedCleanUp;
 };
 
 // Provides access to the PrimaryCommandBuffer while also locking the corresponding CommandPool
@@ -19,6 +19,7 @@
 #include "common/utilities.h"
 #include "image_util/loadimage.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/Semaphore.h"
@@ -47,6 +48,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -136,6 +138,10 @@ constexpr angle::PackedEnumMap<gl::PrimitiveMode, gl::PrimitiveMode> kPrimitiveT
 constexpr VkBufferUsageFlags kVertexBufferUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 constexpr size_t kDynamicVertexDataSizeLarge    = 128 * 1024;
 constexpr size_t kDynamicVertexDataSizeSmall    = 16 * 1024;
+// The shared streamed vertex buffer holds the client attributes of many draws, so it starts out
+// larger than the per-attribute buffers.
+constexpr size_t kSharedStreamedVertexDataSize = 1024 * 1024;
+constexpr size_t kStreamedIndirectDataSize     = 16 * 1024;
 
 bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
                                 VertexArrayVk *vertexArray,
@@ -587,6 +593,8 @@ constexpr angle::PackedEnumMap<RenderPassClosureReason, const char *> kRenderPas
     {RenderPassClosureReason::TimestampQuery, "Render pass closed due to timestamp query"},
     {RenderPassClosureReason::EndRenderPassQuery,
      "Render pass closed due to switch from query enabled draw to query disabled draw"},
+    {RenderPassClosureReason::ConditionalRenderingQueryCopy,
+     "Render pass closed due to conditional rendering on a query ended in the render pass"},
     {RenderPassClosureReason::BufferUseThenReleaseToExternal,
      "Render pass closed due to buffer (used by render pass) release to external"},
     {RenderPassClosureReason::ImageUseThenReleaseToExternal,
@@ -629,6 +637,8 @@ constexpr angle::PackedEnumMap<RenderPassClosureReason, const char *> kRenderPas
      "sampling"},
     {RenderPassClosureReason::OutOfReservedQueueSerialForOutsideCommands,
      "Render pass closed due to running out of reserved serials"},
+    {RenderPassClosureReason::RenderAreaGrowthAfterScissoredClear,
+     "Render pass closed due to render area growth after a scissored clear with loadOp"},
     {RenderPassClosureReason::LegacyDithering, "Render pass closed due to updating legacy dither"},
     {RenderPassClosureReason::SubmitCommands, "Render pass closed at command buffer submission"},
     {RenderPassClosureReason::TileMemorySimulatedClear,
@@ -853,8 +863,12 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mFlipViewportForDrawFramebuffer(false),
       mFlipViewportForReadFramebuffer(false),
       mIsAnyHostVisibleBufferWritten(false),
+      mHasInFlightSharedStreamedVertexBuffer(false),
+      mHasInFlightStreamedIndirectBuffer(false),
       mImageWithTileMemory(nullptr),
       mCurrentQueueSerialIndex(kInvalidQueueSerialIndex),
+      mConditionalRenderingPredicate(nullptr),
+      mIsConditionalRenderingActive(false),
       mInitialContextPriority(renderer->getDriverPriority(GetContextPriority(state))),
       mCommandState(renderer,
                     vk::ConvertProtectionBoolToType(state.hasProtectedContent()),
@@ -865,12 +879,18 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mPrimaryBufferEventCounter(0),
       mHasDeferredRenderPassFlush(false),
       mHasAnyCommandsPendingSubmission(false),
+      mDeferredSignalSemaphore(nullptr),
       mIsInColorFramebufferFetchMode(false),
       mAllowRenderPassToReactivate(true),
+      mRenderPassClosureCounts{},
       mUseSizePointerForBindingVertexBuffers(false),
       mTotalBufferToImageCopySize(0),
       mEstimatedPendingImageGarbageSize(0),
       mRenderPassCountSinceSubmit(0),
+      mFramePerfCounters{},
+      mFirstPendingPassGpuTime(0),
+      mPendingPassGpuTimeCount(0),
+      mIsRenderPassInternal(false),
       mShareGroupVk(vk::GetImpl(state.getShareGroup())),
       mCommandsPendingSubmissionCount(0),
       mGraphicsDriverUniforms(renderer)
@@ -971,6 +991,10 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
     {
         mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_LOGIC_OP);
     }
+    if (getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+    }
     if (getFeatures().supportsFragmentShadingRate.enabled)
     {
         mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE);
@@ -1072,6 +1096,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
         &ContextVk::handleDirtyGraphicsDynamicLogicOp;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE] =
         &ContextVk::handleDirtyGraphicsDynamicPrimitiveRestartEnable;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION] =
+        &ContextVk::handleDirtyGraphicsDynamicColorBlendEquation;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE] =
         &ContextVk::handleDirtyGraphicsDynamicFragmentShadingRate;
 
@@ -1209,20 +1235,39 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
 
     mDeviceQueueIndex = renderer->getDeviceQueueIndex(getPriority());
 
-    angle::PerfMonitorCounterGroupInfo vulkanGroupInfo;
-    angle::PerfMonitorCounterGroup vulkanGroup;
-    vulkanGroupInfo.name = "vulkan";
+    for (const char *groupName : {"vulkan", "vulkan_frame"})
+    {
+        angle::PerfMonitorCounterGroupInfo vulkanGroupInfo;
+        angle::PerfMonitorCounterGroup vulkanGroup;
+        vulkanGroupInfo.name = groupName;
 
 #define ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP(COUNTER) \
     vulkanGroupInfo.counters.emplace_back(#COUNTER);  \
     vulkanGroup.counters.emplace_back(0);
 
-    ANGLE_VK_PERF_COUNTERS_X(ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP)
+        ANGLE_VK_PERF_COUNTERS_X(ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP)
 
 #undef ANGLE_ADD_PERF_MONITOR_COUNTER_GROUP
 
-    mPerfMonitorCountersInfo.emplace_back(std::move(vulkanGroupInfo));
-    mPerfMonitorCounters.emplace_back(std::move(vulkanGroup));
+        mPerfMonitorCountersInfo.emplace_back(std::move(vulkanGroupInfo));
+        mPerfMonitorCounters.emplace_back(std::move(vulkanGroup));
+    }
+
+    {
+        angle::PerfMonitorCounterGroupInfo dirtyBitsGroupInfo;
+        angle::PerfMonitorCounterGroup dirtyBitsGroup;
+        dirtyBitsGroupInfo.name = "vulkan_dirty_bits";
+        for (size_t dirtyBit = 0; dirtyBit < DIRTY_BIT_MAX; ++dirtyBit)
+        {
+            const std::string name = GetDirtyBitName(static_cast<DirtyBitType>(dirtyBit));
+            dirtyBitsGroupInfo.counters.emplace_back(name + "Calls");
+            dirtyBitsGroupInfo.counters.emplace_back(name + "Cycles");
+            dirtyBitsGroup.counters.emplace_back(0);
+            dirtyBitsGroup.counters.emplace_back(0);
+        }
+        mPerfMonitorCountersInfo.emplace_back(std::move(dirtyBitsGroupInfo));
+        mPerfMonitorCounters.emplace_back(std::move(dirtyBitsGroup));
+    }
 
     mCurrentGarbage.reserve(32);
 
@@ -1271,11 +1316,14 @@ void ContextVk::onDestroy(const gl::Context *context)
     {
         defaultBuffer.destroy(mRenderer);
     }
+    mSharedStreamedVertexBuffer.destroy(mRenderer);
+    mStreamedIndirectBuffer.destroy(mRenderer);
 
     for (vk::DynamicQueryPool &queryPool : mQueryPools)
     {
         queryPool.destroy(device);
     }
+    mPassGpuTimeQueryPool.destroy(device);
 
     // Recycle current command buffers.
 
@@ -1379,6 +1427,16 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
             this, VK_QUERY_TYPE_PIPELINE_STATISTICS, vk::kDefaultPrimitivesGeneratedQueryPoolSize));
     }
 
+    if (getFeatures().measurePassGpuTime.enabled &&
+        mRenderer->getQueueFamilyProperties().timestampValidBits > 0)
+    {
+        VkQueryPoolCreateInfo queryPoolInfo = {};
+        queryPoolInfo.sType                 = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolInfo.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolInfo.queryCount            = kPassGpuTimeQueryPairCount * 2;
+        ANGLE_VK_TRY(this, mPassGpuTimeQueryPool.init(getDevice(), queryPoolInfo));
+    }
+
     // Init GLES to Vulkan index type map.
     initIndexTypeMap();
 
@@ -1396,6 +1454,14 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
         buffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment, vertexBufferInitSize,
                     true);
     }
+    if (getFeatures().shareStreamedVertexBufferAcrossAttribs.enabled)
+    {
+        mSharedStreamedVertexBuffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment,
+                                         kSharedStreamedVertexDataSize, true);
+    }
+    // Indirect buffer offsets must be a multiple of 4.
+    mStreamedIndirectBuffer.init(mRenderer, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, 4,
+                                 kStreamedIndirectDataSize, true);
 
     // Assign initial command buffers from queue
     ANGLE_TRY(vk::OutsideRenderPassCommandBuffer::InitializeCommandPool(
@@ -1475,7 +1541,7 @@ bool ContextVk::hasSomethingToFlush() const
 
     return mHasAnyCommandsPendingSubmission || hasActiveRenderPass() ||
            !mOutsideRenderPassCommands->empty() || isSingleBufferedWindowWithStagedUpdates ||
-           hasForeignImagesToTransition();
+           hasForeignImagesToTransition() || mDeferredSignalSemaphore != nullptr;
 }
 
 angle::Result ContextVk::flushImpl(const gl::Context *context)
@@ -1517,7 +1583,10 @@ angle::Result ContextVk::flushImpl(const gl::Context *context)
         }
     }
 
-    if (hasActiveRenderPass() && !frontBufferRenderingEnabled)
+    // A deferred semaphore signal is expected to be submitted by glFlush, as the semaphore may be
+    // waited on outside of GL right after.
+    if (hasActiveRenderPass() && !frontBufferRenderingEnabled &&
+        mDeferredSignalSemaphore == nullptr)
     {
         mHasDeferredRenderPassFlush = true;
         return angle::Result::Continue;
@@ -1668,6 +1737,17 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
              ++dirtyBitIter)
         {
             ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
+            if (ANGLE_UNLIKELY(getFeatures().profileDirtyBitHandlers.enabled))
+            {
+                // The handler may move the iterator, so the dirty bit is read first.
+                DirtyBitHandlerStats &stats = mGraphicsDirtyBitHandlerStats[*dirtyBitIter];
+                const uint64_t startCycles  = angle::ReadCpuCycleCounter();
+                ANGLE_TRY(
+                    (this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+                stats.cycles += angle::ReadCpuCycleCounter() - startCycles;
+                ++stats.calls;
+                continue;
+            }
             ANGLE_TRY(
                 (this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
         }
@@ -1681,6 +1761,21 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
     // Render pass must be always available at this point.
     ASSERT(hasActiveRenderPass());
 
+    if (ANGLE_UNLIKELY(mConditionalRenderingPredicate != nullptr) &&
+        !mIsConditionalRenderingActive)
+    {
+        mRenderPassCommands->bufferRead(this, VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT,
+                                        vk::PipelineStage::ConditionalRendering,
+                                        mConditionalRenderingPredicate);
+
+        VkConditionalRenderingBeginInfoEXT beginInfo = {};
+        beginInfo.sType  = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT;
+        beginInfo.buffer = mConditionalRenderingPredicate->getBuffer().getHandle();
+        beginInfo.offset = mConditionalRenderingPredicate->getOffset();
+        mRenderPassCommands->getCommandBuffer().beginConditionalRendering(beginInfo);
+        mIsConditionalRenderingActive = true;
+    }
+
     ASSERT(mState.getAndResetDirtyUniformBlocks().none());
 
     return angle::Result::Continue;
@@ -1741,32 +1836,46 @@ angle::Result ContextVk::setupIndexedDraw(const gl::Context *context,
         {
             if (mGraphicsDirtyBits[DIRTY_BIT_INDEX_BUFFER])
             {
-                ANGLE_VK_PERF_WARNING(
-                    this, GL_DEBUG_SEVERITY_LOW,
-                    "Potential inefficiency emulating uint8 vertex attributes due to "
-                    "lack of hardware support");
-
                 BufferVk *bufferVk             = vk::GetImpl(elementArrayBuffer);
                 vk::BufferHelper &bufferHelper = bufferVk->getBuffer();
 
-                if (bufferHelper.isHostVisible() &&
-                    mRenderer->hasResourceUseFinished(bufferHelper.getResourceUse()))
+                // The translation is cached in the element array buffer and reused (by any vertex
+                // array) until the indices are modified.
+                IndexConversionBuffer *cachedBuffer = bufferVk->getIndexConversionBuffer(
+                    {indexType, reinterpret_cast<uintptr_t>(indices), 0, false, false});
+
+                if (cachedBuffer != nullptr && !cachedBuffer->dirty())
                 {
-                    uint8_t *src = nullptr;
-                    ANGLE_TRY(
-                        bufferVk->mapForReadAccessOnly(this, reinterpret_cast<void **>(&src)));
-                    // Note: bufferOffset is not added here because mapImpl already adds it.
-                    src += reinterpret_cast<uintptr_t>(indices);
-                    const size_t byteCount = static_cast<size_t>(elementArrayBuffer->getSize()) -
-                                             reinterpret_cast<uintptr_t>(indices);
-                    BufferBindingDirty bindingDirty;
-                    ANGLE_TRY(vertexArrayVk->convertIndexBufferCPU(this, indexType, byteCount, src,
-                                                                   &bindingDirty));
-                    ANGLE_TRY(bufferVk->unmapReadAccessOnly(this));
+                    vertexArrayVk->setCurrentElementArrayBuffer(cachedBuffer->getBuffer());
                 }
                 else
                 {
-                    ANGLE_TRY(vertexArrayVk->convertIndexBufferGPU(this, bufferVk, indices));
+                    ANGLE_VK_PERF_WARNING(
+                        this, GL_DEBUG_SEVERITY_LOW,
+                        "Potential inefficiency emulating uint8 vertex attributes due to "
+                        "lack of hardware support");
+
+                    if (bufferHelper.isHostVisible() &&
+                        mRenderer->hasResourceUseFinished(bufferHelper.getResourceUse()))
+                    {
+                        uint8_t *src = nullptr;
+                        ANGLE_TRY(bufferVk->mapForReadAccessOnly(this,
+                                                                 reinterpret_cast<void **>(&src)));
+                        // Note: bufferOffset is not added here because mapImpl already adds it.
+                        src += reinterpret_cast<uintptr_t>(indices);
+                        const size_t byteCount =
+                            static_cast<size_t>(elementArrayBuffer->getSize()) -
+                            reinterpret_cast<uintptr_t>(indices);
+                        BufferBindingDirty bindingDirty;
+                        ANGLE_TRY(vertexArrayVk->convertIndexBufferCPU(this, indexType, byteCount,
+                                                                       src, &bindingDirty));
+                        ANGLE_TRY(bufferVk->unmapReadAccessOnly(this));
+                    }
+                    else
+                    {
+                        ANGLE_TRY(vertexArrayVk->convertIndexBufferGPU(this, bufferVk,
+                                                                       cachedBuffer, indices));
+                    }
                 }
             }
 
@@ -1916,17 +2025,27 @@ angle::Result ContextVk::setupLineLoopDraw(const gl::Context *context,
 
 angle::Result ContextVk::setupDispatch(const gl::Context *context)
 {
-    // TODO: We don't currently check if this flush is necessary.  It serves to make sure the
-    // barriers issued during dirty bit handling aren't reordered too early.
-    // http://anglebug.com/382090958
-    ANGLE_TRY(flushOutsideRenderPassCommands());
-
     ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
     if (executableVk->updateAndCheckDirtyUniforms())
     {
         mComputeDirtyBits.set(DIRTY_BIT_UNIFORMS);
     }
 
+    // Back-to-back dispatches with unchanged state are common in compute workloads.  Flushing the
+    // outside render pass commands sets all the dirty bits of a new command buffer, so every
+    // dispatch would rebind its pipeline and descriptor sets.  If nothing is dirty, the previous
+    // dispatch is still in mOutsideRenderPassCommands, with the same pipeline and descriptor sets
+    // bound and its resources already tracked, so this dispatch is simply recorded after it.
+    if (mComputeDirtyBits.none() && canAppendDispatchToOutsideRenderPassCommands())
+    {
+        return angle::Result::Continue;
+    }
+
+    // TODO: We don't currently check if this flush is necessary.  It serves to make sure the
+    // barriers issued during dirty bit handling aren't reordered too early.
+    // http://anglebug.com/382090958
+    ANGLE_TRY(flushOutsideRenderPassCommands());
+
     DirtyBits dirtyBits = mComputeDirtyBits;
 
     // Flush any relevant dirty bits.
@@ -1944,6 +2063,17 @@ angle::Result ContextVk::setupDispatch(const gl::Context *context)
     return angle::Result::Continue;
 }
 
+bool ContextVk::canAppendDispatchToOutsideRenderPassCommands() const
+{
+    // - An open render pass is submitted after mOutsideRenderPassCommands, so a dispatch added to
+    //   the latter could be reordered before draws that were recorded before it.
+    // - With VkEvents, the events set after the previous dispatch don't cover this one; the events
+    //   are only set up again when the resources are tracked again.
+    return !mOutsideRenderPassCommands->empty() && !mRenderPassCommands->started() &&
+           !getFeatures().useVkEventForImageBarrier.enabled &&
+           !getFeatures().useVkEventForBufferBarrier.enabled;
+}
+
 angle::Result ContextVk::handleDirtyGraphicsMemoryBarrier(DirtyBits::Iterator *dirtyBitsIterator,
                                                           DirtyBits dirtyBitMask)
 {
@@ -2429,12 +2559,51 @@ angle::Result ContextVk::handleDirtyAnySamplePassedQueryEnd(DirtyBits::Iterator
     return angle::Result::Continue;
 }
 
+bool ContextVk::canDrawFramebufferContinueStartedRenderPass(FramebufferVk *drawFramebufferVk,
+                                                            const gl::Rectangle &renderArea) const
+{
+    if (!mAllowRenderPassToReactivate ||
+        !hasStartedRenderPassWithQueueSerial(mStartedRenderPassFramebufferQueueSerial) ||
+        hasStartedRenderPassWithQueueSerial(drawFramebufferVk->getLastRenderPassQueueSerial()))
+    {
+        return false;
+    }
+
+    // Deferred clears need a new render pass to be applied with loadOp=CLEAR.
+    if (drawFramebufferVk->hasDeferredClears() ||
+        renderArea != mRenderPassCommands->getRenderArea())
+    {
+        return false;
+    }
+
+    vk::RenderPassDesc framebufferRenderPassDesc = drawFramebufferVk->getRenderPassDesc();
+    if (getFeatures().preferDynamicRendering.enabled)
+    {
+        // See handleDirtyGraphicsRenderPass, framebuffer fetch mode is not tracked by the
+        // framebuffer with dynamic rendering.
+        framebufferRenderPassDesc.setFramebufferFetchMode(
+            mRenderPassCommands->getRenderPassDesc().framebufferFetchMode());
+    }
+
+    return framebufferRenderPassDesc == mRenderPassCommands->getRenderPassDesc() &&
+           drawFramebufferVk->getFramebufferDesc() == mStartedRenderPassFramebufferDesc;
+}
+
 angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                        DirtyBits dirtyBitMask)
 {
     FramebufferVk *drawFramebufferVk = getDrawFramebuffer();
 
     gl::Rectangle renderArea = drawFramebufferVk->getRenderArea(this);
+
+    // If the render pass was started by another framebuffer with identical attachments, such as
+    // when the application round-trips through an unrelated framebuffer binding with duplicate
+    // framebuffer objects, let this framebuffer continue it.
+    if (canDrawFramebufferContinueStartedRenderPass(drawFramebufferVk, renderArea))
+    {
+        drawFramebufferVk->onContinueStartedRenderPass(mRenderPassCommands->getQueueSerial());
+    }
+
     // Check to see if we can reactivate the current renderPass, if all arguments that we use to
     // start the render pass is the same. We don't need to check clear values since mid render pass
     // clear are handled differently.
@@ -3414,6 +3583,35 @@ angle::Result ContextVk::handleDirtyGraphicsDynamicPrimitiveRestartEnable(
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::handleDirtyGraphicsDynamicColorBlendEquation(
+    DirtyBits::Iterator *dirtyBitsIterator,
+    DirtyBits dirtyBitMask)
+{
+    const gl::BlendStateExt &blendStateExt   = mState.getBlendStateExt();
+    const vk::RenderPassDesc &renderPassDesc = mGraphicsPipelineDesc->getRenderPassDesc();
+
+    // The equations are indexed the same way as the blend attachment states of the pipeline; with
+    // dynamic rendering, the disabled attachments are skipped.
+    std::array<VkColorBlendEquationEXT, gl::IMPLEMENTATION_MAX_DRAW_BUFFERS> equations;
+    uint32_t attachmentCount = 0;
+    for (size_t colorIndexGL = 0; colorIndexGL < renderPassDesc.colorAttachmentRange();
+         ++colorIndexGL)
+    {
+        if (getFeatures().preferDynamicRendering.enabled &&
+            !renderPassDesc.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+        vk::GetColorBlendEquation(blendStateExt, colorIndexGL, &equations[attachmentCount++]);
+    }
+
+    if (attachmentCount > 0)
+    {
+        mRenderPassCommandBuffer->setColorBlendEquation(0, attachmentCount, equations.data());
+    }
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::handleDirtyGraphicsDynamicFragmentShadingRate(
     DirtyBits::Iterator *dirtyBitsIterator,
     DirtyBits dirtyBitMask)
@@ -3689,17 +3887,216 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
     // Return current drawFramebuffer's cache stats
     mPerfCounters.framebufferCacheSize = mFramebufferCache.getSize();
 
+    // The completeness of framebuffers is cached by the front-end.
+    mPerfCounters.framebufferCompletenessCacheHits = mState.getFramebufferCompletenessCacheHits();
+    mPerfCounters.framebufferCompletenessCacheMisses =
+        mState.getFramebufferCompletenessCacheMisses();
+
     mPerfCounters.pendingSubmissionGarbageObjects =
         static_cast<uint64_t>(mRenderer->getPendingSubmissionGarbageSize());
 }
 
+// static
+const char *ContextVk::GetDirtyBitName(DirtyBitType dirtyBit)
+{
+    switch (dirtyBit)
+    {
+        case DIRTY_BIT_ANY_SAMPLE_PASSED_QUERY_END:
+            return "anySamplePassedQueryEnd";
+        case DIRTY_BIT_MEMORY_BARRIER:
+            return "memoryBarrier";
+        case DIRTY_BIT_DEFAULT_ATTRIBS:
+            return "defaultAttribs";
+        case DIRTY_BIT_PIPELINE_DESC:
+            return "pipelineDesc";
+        case DIRTY_BIT_READ_ONLY_DEPTH_FEEDBACK_LOOP_MODE:
+            return "readOnlyDepthFeedbackLoopMode";
+        case DIRTY_BIT_RENDER_PASS:
+            return "renderPass";
+        case DIRTY_BIT_EVENT_LOG:
+            return "eventLog";
+        case DIRTY_BIT_COLOR_ACCESS:
+            return "colorAccess";
+        case DIRTY_BIT_DEPTH_STENCIL_ACCESS:
+            return "depthStencilAccess";
+        case DIRTY_BIT_PIPELINE_BINDING:
+            return "pipelineBinding";
+        case DIRTY_BIT_TEXTURES:
+            return "textures";
+        case DIRTY_BIT_VERTEX_BUFFERS:
+            return "vertexBuffers";
+        case DIRTY_BIT_INDEX_BUFFER:
+            return "indexBuffer";
+        case DIRTY_BIT_UNIFORMS:
+            return "uniforms";
+        case DIRTY_BIT_DRIVER_UNIFORMS:
+            return "driverUniforms";
+        case DIRTY_BIT_UNIFORM_BUFFERS:
+            return "uniformBuffers";
+        case DIRTY_BIT_SHADER_RESOURCES:
+            return "shaderResources";
+        case DIRTY_BIT_TRANSFORM_FEEDBACK_BUFFERS:
+            return "transformFeedbackBuffers";
+        case DIRTY_BIT_TRANSFORM_FEEDBACK_RESUME:
+            return "transformFeedbackResume";
+        case DIRTY_BIT_DESCRIPTOR_SETS:
+            return "descriptorSets";
+        case DIRTY_BIT_FRAMEBUFFER_FETCH_BARRIER:
+            return "framebufferFetchBarrier";
+        case DIRTY_BIT_BLEND_BARRIER:
+            return "blendBarrier";
+        case DIRTY_BIT_DYNAMIC_VIEWPORT:
+            return "dynamicViewport";
+        case DIRTY_BIT_DYNAMIC_SCISSOR:
+            return "dynamicScissor";
+        case DIRTY_BIT_DYNAMIC_LINE_WIDTH:
+            return "dynamicLineWidth";
+        case DIRTY_BIT_DYNAMIC_DEPTH_BIAS:
+            return "dynamicDepthBias";
+        case DIRTY_BIT_DYNAMIC_BLEND_CONSTANTS:
+            return "dynamicBlendConstants";
+        case DIRTY_BIT_DYNAMIC_STENCIL_COMPARE_MASK:
+            return "dynamicStencilCompareMask";
+        case DIRTY_BIT_DYNAMIC_STENCIL_WRITE_MASK:
+            return "dynamicStencilWriteMask";
+        case DIRTY_BIT_DYNAMIC_STENCIL_REFERENCE:
+            return "dynamicStencilReference";
+        case DIRTY_BIT_DYNAMIC_CULL_MODE:
+            return "dynamicCullMode";
+        case DIRTY_BIT_DYNAMIC_FRONT_FACE:
+            return "dynamicFrontFace";
+        case DIRTY_BIT_DYNAMIC_PRIMITIVE_TOPOLOGY:
+            return "dynamicPrimitiveTopology";
+        case DIRTY_BIT_DYNAMIC_DEPTH_TEST_ENABLE:
+            return "dynamicDepthTestEnable";
+        case DIRTY_BIT_DYNAMIC_DEPTH_WRITE_ENABLE:
+            return "dynamicDepthWriteEnable";
+        case DIRTY_BIT_DYNAMIC_DEPTH_COMPARE_OP:
+            return "dynamicDepthCompareOp";
+        case DIRTY_BIT_DYNAMIC_STENCIL_TEST_ENABLE:
+            return "dynamicStencilTestEnable";
+        case DIRTY_BIT_DYNAMIC_STENCIL_OP:
+            return "dynamicStencilOp";
+        case DIRTY_BIT_DYNAMIC_RASTERIZER_DISCARD_ENABLE:
+            return "dynamicRasterizerDiscardEnable";
+        case DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE:
+            return "dynamicDepthBiasEnable";
+        case DIRTY_BIT_DYNAMIC_LOGIC_OP:
+            return "dynamicLogicOp";
+        case DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE:
+            return "dynamicPrimitiveRestartEnable";
+        case DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION:
+            return "dynamicColorBlendEquation";
+        case DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE:
+            return "dynamicFragmentShadingRate";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+void ContextVk::setPassGpuTimeQuery(vk::CommandBufferHelperCommon *commands,
+                                    PassGpuTimeCategory category)
+{
+    // Skip the measurement if all query pairs are still waiting for their command buffers to
+    // finish.
+    if (!mPassGpuTimeQueryPool.valid() || mPendingPassGpuTimeCount == kPassGpuTimeQueryPairCount)
+    {
+        return;
+    }
+
+    const uint32_t queryPair =
+        (mFirstPendingPassGpuTime + mPendingPassGpuTimeCount) % kPassGpuTimeQueryPairCount;
+    mPendingPassGpuTimes[queryPair] = {commands->getQueueSerial(), category};
+    ++mPendingPassGpuTimeCount;
+
+    commands->setGpuTimeQuery(&mPassGpuTimeQueryPool, queryPair * 2);
+}
+
+void ContextVk::resolvePassGpuTimes()
+{
+    const double timestampPeriod = mRenderer->getPhysicalDeviceProperties().limits.timestampPeriod;
+    const uint32_t validBits     = mRenderer->getQueueFamilyProperties().timestampValidBits;
+    const uint64_t validBitsMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+
+    while (mPendingPassGpuTimeCount > 0)
+    {
+        const uint32_t queryPair          = mFirstPendingPassGpuTime;
+        const PendingPassGpuTime &pending = mPendingPassGpuTimes[queryPair];
+        if (!mRenderer->hasQueueSerialFinished(pending.queueSerial))
+        {
+            break;
+        }
+        mFirstPendingPassGpuTime = (queryPair + 1) % kPassGpuTimeQueryPairCount;
+        --mPendingPassGpuTimeCount;
+
+        std::array<uint64_t, 2> ticks = {};
+        VkResult result               = mPassGpuTimeQueryPool.getResults(
+            getDevice(), queryPair * 2, 2, sizeof(ticks), ticks.data(), sizeof(ticks[0]),
+            VK_QUERY_RESULT_64_BIT);
+        if (result != VK_SUCCESS)
+        {
+            // The queries are unavailable if the commands were abandoned.
+            continue;
+        }
+
+        const uint64_t gpuTimeNs = static_cast<uint64_t>(
+            static_cast<double>((ticks[1] - ticks[0]) & validBitsMask) * timestampPeriod);
+        switch (pending.category)
+        {
+            case PassGpuTimeCategory::AppRenderPass:
+                mPerfCounters.appRenderPassGpuTimeNs += gpuTimeNs;
+                ANGLE_TRACE_EVENT_INSTANT("gpu.angle", "AppRenderPassGpuTime", "gpuTimeNs",
+                                          gpuTimeNs);
+                break;
+            case PassGpuTimeCategory::InternalRenderPass:
+                mPerfCounters.internalRenderPassGpuTimeNs += gpuTimeNs;
+                ANGLE_TRACE_EVENT_INSTANT("gpu.angle", "InternalRenderPassGpuTime", "gpuTimeNs",
+                                          gpuTimeNs);
+                break;
+            case PassGpuTimeCategory::OutsideRenderPass:
+                mPerfCounters.outsideRenderPassGpuTimeNs += gpuTimeNs;
+                ANGLE_TRACE_EVENT_INSTANT("gpu.angle", "OutsideRenderPassGpuTime", "gpuTimeNs",
+                                          gpuTimeNs);
+                break;
+        }
+    }
+}
+
+void ContextVk::collectFramePerfCounters()
+{
+    // The GPU times are those of the command buffers that finished during the frame, which are
+    // usually from a frame or two earlier.
+    resolvePassGpuTimes();
+
+    if (!mState.isPerfMonitorActive() && !mState.getOverlay()->isEnabled())
+    {
+        return;
+    }
+
+    const angle::VulkanPerfCounters commandQueuePerfCounters =
+        mRenderer->getCommandQueuePerfCounters();
+    syncObjectPerfCounters(commandQueuePerfCounters);
+
+    mFramePerfCounters = mPerfCounters;
+    // The overlay shows the submission counts even if no perf monitor is active, in which case
+    // syncObjectPerfCounters doesn't update them.
+    mFramePerfCounters.commandQueueSubmitCallsPerFrame =
+        commandQueuePerfCounters.commandQueueSubmitCallsPerFrame;
+    mFramePerfCounters.vkQueueSubmitCallsPerFrame =
+        commandQueuePerfCounters.vkQueueSubmitCallsPerFrame;
+
+    mFrameGraphicsDirtyBitHandlerStats = mGraphicsDirtyBitHandlerStats;
+}
+
 void ContextVk::updateOverlayOnPresent()
 {
     const gl::OverlayType *overlay = mState.getOverlay();
     ASSERT(overlay->isEnabled());
 
-    angle::VulkanPerfCounters commandQueuePerfCounters = mRenderer->getCommandQueuePerfCounters();
-    syncObjectPerfCounters(commandQueuePerfCounters);
+    // The overlay shows the same counters that are exported through the "vulkan_frame" perf
+    // monitor group.
+    const angle::VulkanPerfCounters &counters = mFramePerfCounters;
 
     // Update overlay if active.
     {
@@ -3712,26 +4109,26 @@ void ContextVk::updateOverlayOnPresent()
     {
         gl::RunningGraphWidget *writeDescriptorSetCount =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanWriteDescriptorSetCount);
-        writeDescriptorSetCount->add(mPerfCounters.writeDescriptorSets);
+        writeDescriptorSetCount->add(counters.writeDescriptorSets);
         writeDescriptorSetCount->next();
     }
 
     {
         gl::RunningGraphWidget *descriptorSetAllocationCount =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDescriptorSetAllocations);
-        descriptorSetAllocationCount->add(mPerfCounters.descriptorSetAllocations);
+        descriptorSetAllocationCount->add(counters.descriptorSetAllocations);
         descriptorSetAllocationCount->next();
     }
 
     {
         gl::RunningGraphWidget *shaderResourceHitRate =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanShaderResourceDSHitRate);
-        uint64_t numCacheAccesses = mPerfCounters.shaderResourcesDescriptorSetCacheHits +
-                                    mPerfCounters.shaderResourcesDescriptorSetCacheMisses;
+        uint64_t numCacheAccesses = counters.shaderResourcesDescriptorSetCacheHits +
+                                    counters.shaderResourcesDescriptorSetCacheMisses;
         if (numCacheAccesses > 0)
         {
             float hitRateFloat =
-                static_cast<float>(mPerfCounters.shaderResourcesDescriptorSetCacheHits) /
+                static_cast<float>(counters.shaderResourcesDescriptorSetCacheHits) /
                 static_cast<float>(numCacheAccesses);
             size_t hitRate = static_cast<size_t>(hitRateFloat * 100.0f);
             shaderResourceHitRate->add(hitRate);
@@ -3749,44 +4146,103 @@ void ContextVk::updateOverlayOnPresent()
         gl::CountWidget *cacheKeySize =
             overlay->getCountWidget(gl::WidgetId::VulkanDescriptorCacheKeySize);
         cacheKeySize->reset();
-        cacheKeySize->add(mPerfCounters.descriptorSetCacheKeySizeBytes);
+        cacheKeySize->add(counters.descriptorSetCacheKeySizeBytes);
     }
 
     {
         gl::RunningGraphWidget *dynamicBufferAllocations =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanDynamicBufferAllocations);
-        dynamicBufferAllocations->add(mPerfCounters.dynamicBufferAllocations);
+        dynamicBufferAllocations->add(counters.dynamicBufferAllocations);
     }
 
     {
         gl::RunningGraphWidget *attemptedSubmissionsWidget =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanAttemptedSubmissions);
-        attemptedSubmissionsWidget->add(commandQueuePerfCounters.commandQueueSubmitCallsPerFrame);
+        attemptedSubmissionsWidget->add(counters.commandQueueSubmitCallsPerFrame);
         attemptedSubmissionsWidget->next();
 
         gl::RunningGraphWidget *actualSubmissionsWidget =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanActualSubmissions);
-        actualSubmissionsWidget->add(commandQueuePerfCounters.vkQueueSubmitCallsPerFrame);
+        actualSubmissionsWidget->add(counters.vkQueueSubmitCallsPerFrame);
         actualSubmissionsWidget->next();
     }
 
     {
         gl::RunningGraphWidget *cacheLookupsWidget =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanPipelineCacheLookups);
-        cacheLookupsWidget->add(mPerfCounters.pipelineCreationCacheHits +
-                                mPerfCounters.pipelineCreationCacheMisses);
+        cacheLookupsWidget->add(counters.pipelineCreationCacheHits +
+                                counters.pipelineCreationCacheMisses);
         cacheLookupsWidget->next();
 
         gl::RunningGraphWidget *cacheMissesWidget =
             overlay->getRunningGraphWidget(gl::WidgetId::VulkanPipelineCacheMisses);
-        cacheMissesWidget->add(mPerfCounters.pipelineCreationCacheMisses);
+        cacheMissesWidget->add(counters.pipelineCreationCacheMisses);
         cacheMissesWidget->next();
 
         overlay->getCountWidget(gl::WidgetId::VulkanTotalPipelineCacheHitTimeMs)
-            ->set(mPerfCounters.pipelineCreationTotalCacheHitsDurationNs / 1000'000);
+            ->set(counters.pipelineCreationTotalCacheHitsDurationNs / 1000'000);
         overlay->getCountWidget(gl::WidgetId::VulkanTotalPipelineCacheMissTimeMs)
-            ->set(mPerfCounters.pipelineCreationTotalCacheMissesDurationNs / 1000'000);
+            ->set(counters.pipelineCreationTotalCacheMissesDurationNs / 1000'000);
+    }
+
+    overlay->getCountWidget(gl::WidgetId::VulkanShaderModuleCreations)
+        ->set(counters.shaderModuleCreations);
+    overlay->getCountWidget(gl::WidgetId::VulkanMaxGraphicsPipelinesPerProgram)
+        ->set(counters.maxGraphicsPipelinesPerProgram);
+    overlay->getCountWidget(gl::WidgetId::VulkanGarbageBacklog)
+        ->set(mRenderer->getSubmittedGarbageCount());
+    overlay->getCountWidget(gl::WidgetId::VulkanBufferGhostKB)
+        ->set(counters.bufferGhostBytesPerFrame / 1024);
+
+    overlay->getTextWidget(gl::WidgetId::VulkanRenderPassClosureReasons)
+        ->set(getRenderPassClosureSummary());
+    mRenderPassClosureCounts.fill(0);
+
+    {
+        std::ostringstream bandwidth;
+        bandwidth << "load " << mFrameAttachmentBandwidth.loadBytes / 1024 << ", store "
+                  << mFrameAttachmentBandwidth.storeBytes / 1024 << ", resolve "
+                  << mFrameAttachmentBandwidth.resolveBytes / 1024 << ", unresolve "
+                  << mFrameAttachmentBandwidth.unresolveBytes / 1024;
+        overlay->getTextWidget(gl::WidgetId::VulkanAttachmentBandwidth)->set(bandwidth.str());
+        mFrameAttachmentBandwidth = {};
+    }
+}
+
+std::string ContextVk::getRenderPassClosureSummary() const
+{
+    // List the most common reasons the render passes of the last frame were ended for.
+    constexpr size_t kMaxReasons = 3;
+    std::vector<RenderPassClosureReason> reasons;
+    for (RenderPassClosureReason reason : angle::AllEnums<RenderPassClosureReason>())
+    {
+        if (mRenderPassClosureCounts[reason] > 0)
+        {
+            reasons.push_back(reason);
+        }
+    }
+    std::sort(reasons.begin(), reasons.end(),
+              [this](RenderPassClosureReason lhs, RenderPassClosureReason rhs) {
+                  return mRenderPassClosureCounts[lhs] > mRenderPassClosureCounts[rhs];
+              });
+
+    constexpr char kReasonPrefix[] = "Render pass closed due to ";
+    std::ostringstream summary;
+    for (size_t index = 0; index < std::min(reasons.size(), kMaxReasons); ++index)
+    {
+        const char *description = kRenderPassClosureReason[reasons[index]];
+        if (description == nullptr)
+        {
+            description = "unspecified reason";
+        }
+        else if (strncmp(description, kReasonPrefix, sizeof(kReasonPrefix) - 1) == 0)
+        {
+            description += sizeof(kReasonPrefix) - 1;
+        }
+        summary << (index > 0 ? ", " : "") << mRenderPassClosureCounts[reasons[index]] << "x "
+                << description;
     }
+    return summary.str();
 }
 
 void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *commandBuffer)
@@ -4194,6 +4650,11 @@ angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
+    if (canStreamMultiDrawAsIndirect(mode, drawcount, false))
+    {
+        return multiDrawArraysStreamedIndirect(context, mode, firsts, counts, nullptr, nullptr,
+                                               drawcount);
+    }
     return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
 }
 
@@ -4204,6 +4665,11 @@ angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
+    if (canStreamMultiDrawAsIndirect(mode, drawcount, false))
+    {
+        return multiDrawArraysStreamedIndirect(context, mode, firsts, counts, instanceCounts,
+                                               nullptr, drawcount);
+    }
     return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
                                                drawcount);
 }
@@ -4290,6 +4756,16 @@ angle::Result ContextVk::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
+    if (canStreamMultiDrawAsIndirect(mode, drawcount, false))
+    {
+        bool drawn = false;
+        ANGLE_TRY(multiDrawElementsStreamedIndirect(context, mode, counts, type, indices, nullptr,
+                                                    nullptr, nullptr, drawcount, &drawn));
+        if (drawn)
+        {
+            return angle::Result::Continue;
+        }
+    }
     return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
 }
 
@@ -4301,6 +4777,17 @@ angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    if (canStreamMultiDrawAsIndirect(mode, drawcount, false))
+    {
+        bool drawn = false;
+        ANGLE_TRY(multiDrawElementsStreamedIndirect(context, mode, counts, type, indices,
+                                                    instanceCounts, nullptr, nullptr, drawcount,
+                                                    &drawn));
+        if (drawn)
+        {
+            return angle::Result::Continue;
+        }
+    }
     return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
                                                  instanceCounts, drawcount);
 }
@@ -4404,6 +4891,133 @@ angle::Result ContextVk::multiDrawElementsIndirectHelper(const gl::Context *cont
     return angle::Result::Continue;
 }
 
+bool ContextVk::canStreamMultiDrawAsIndirect(gl::PrimitiveMode mode,
+                                             GLsizei drawcount,
+                                             bool hasBaseVertexOrInstance)
+{
+    if (drawcount <= 1)
+    {
+        return false;
+    }
+
+    // gl_DrawID, as well as gl_BaseVertex and gl_BaseInstance if emulated, are uniforms that are
+    // set before each draw.  Transform feedback emulation similarly needs the vertex count of each
+    // draw.
+    const gl::ProgramExecutable *executable = mState.getProgramExecutable();
+    if (executable->hasDrawIDUniform() || mState.isTransformFeedbackActiveUnpaused())
+    {
+        return false;
+    }
+    if (hasBaseVertexOrInstance &&
+        (executable->hasBaseVertexUniform() || executable->hasBaseInstanceUniform() ||
+         !mRenderer->getEnabledFeatures().features.drawIndirectFirstInstance))
+    {
+        return false;
+    }
+
+    return CanMultiDrawIndirectUseCmd(this, getVertexArray(), mode, drawcount, 0);
+}
+
+angle::Result ContextVk::multiDrawArraysStreamedIndirect(const gl::Context *context,
+                                                         gl::PrimitiveMode mode,
+                                                         const GLint *firsts,
+                                                         const GLsizei *counts,
+                                                         const GLsizei *instanceCounts,
+                                                         const GLuint *baseInstances,
+                                                         GLsizei drawcount)
+{
+    vk::BufferHelper *indirectBuffer = nullptr;
+    bool newBuffer                   = false;
+    ANGLE_TRY(mStreamedIndirectBuffer.allocate(this, sizeof(VkDrawIndirectCommand) * drawcount,
+                                               &indirectBuffer, &newBuffer));
+    mHasInFlightStreamedIndirectBuffer = mHasInFlightStreamedIndirectBuffer || newBuffer;
+
+    VkDrawIndirectCommand *commands =
+        reinterpret_cast<VkDrawIndirectCommand *>(indirectBuffer->getMappedMemory());
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndirectCommand &command = commands[drawID];
+        command.vertexCount   = gl::GetClampedVertexCount<uint32_t>(counts[drawID]);
+        command.instanceCount = instanceCounts ? static_cast<uint32_t>(instanceCounts[drawID]) : 1;
+        command.firstVertex   = static_cast<uint32_t>(firsts[drawID]);
+        command.firstInstance = baseInstances ? baseInstances[drawID] : 0;
+    }
+    ANGLE_TRY(indirectBuffer->flush(mRenderer));
+
+    ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, indirectBuffer));
+    mRenderPassCommandBuffer->drawIndirect(indirectBuffer->getBuffer(),
+                                           indirectBuffer->getOffset(), drawcount,
+                                           sizeof(VkDrawIndirectCommand));
+    gl::MarkShaderStorageUsage(context);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsStreamedIndirect(const gl::Context *context,
+                                                           gl::PrimitiveMode mode,
+                                                           const GLsizei *counts,
+                                                           gl::DrawElementsType type,
+                                                           const GLvoid *const *indices,
+                                                           const GLsizei *instanceCounts,
+                                                           const GLint *baseVertices,
+                                                           const GLuint *baseInstances,
+                                                           GLsizei drawcount,
+                                                           bool *drawnOut)
+{
+    // Client-side indices would each need to be streamed, and uint8 indices converted.  The
+    // offsets must also be expressible as a first index.
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    if (vertexArrayVk->getElementArrayBuffer() == nullptr || shouldConvertUint8VkIndexType(type))
+    {
+        return angle::Result::Continue;
+    }
+
+    const uintptr_t indexSize = gl::GetDrawElementsTypeSize(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (reinterpret_cast<uintptr_t>(indices[drawID]) % indexSize != 0)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
+    vk::BufferHelper *indirectBuffer = nullptr;
+    bool newBuffer                   = false;
+    ANGLE_TRY(mStreamedIndirectBuffer.allocate(
+        this, sizeof(VkDrawIndexedIndirectCommand) * drawcount, &indirectBuffer, &newBuffer));
+    mHasInFlightStreamedIndirectBuffer = mHasInFlightStreamedIndirectBuffer || newBuffer;
+
+    VkDrawIndexedIndirectCommand *commands =
+        reinterpret_cast<VkDrawIndexedIndirectCommand *>(indirectBuffer->getMappedMemory());
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndexedIndirectCommand &command = commands[drawID];
+        command.indexCount    = static_cast<uint32_t>(counts[drawID]);
+        command.instanceCount = instanceCounts ? static_cast<uint32_t>(instanceCounts[drawID]) : 1;
+        command.firstIndex =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices[drawID]) / indexSize);
+        command.vertexOffset  = baseVertices ? baseVertices[drawID] : 0;
+        command.firstInstance = baseInstances ? baseInstances[drawID] : 0;
+    }
+    ANGLE_TRY(indirectBuffer->flush(mRenderer));
+
+    // The offsets are in the commands, so the index buffer is bound from its start.  Like after a
+    // line loop or uint8 draw, the vertex array's element buffer is made current again.
+    mGraphicsDirtyBits.set(DIRTY_BIT_INDEX_BUFFER);
+    mLastIndexBufferOffset    = reinterpret_cast<const void *>(angle::DirtyPointer);
+    mCurrentIndexBufferOffset = 0;
+    vertexArrayVk->updateCurrentElementArrayBuffer();
+
+    ANGLE_TRY(setupIndexedIndirectDraw(context, mode, type, indirectBuffer));
+    mRenderPassCommandBuffer->drawIndexedIndirect(indirectBuffer->getBuffer(),
+                                                  indirectBuffer->getOffset(), drawcount,
+                                                  sizeof(VkDrawIndexedIndirectCommand));
+    gl::MarkShaderStorageUsage(context);
+
+    *drawnOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::multiDrawArraysInstancedBaseInstance(const gl::Context *context,
                                                               gl::PrimitiveMode mode,
                                                               const GLint *firsts,
@@ -4412,6 +5026,11 @@ angle::Result ContextVk::multiDrawArraysInstancedBaseInstance(const gl::Context
                                                               const GLuint *baseInstances,
                                                               GLsizei drawcount)
 {
+    if (canStreamMultiDrawAsIndirect(mode, drawcount, true))
+    {
+        return multiDrawArraysStreamedIndirect(context, mode, firsts, counts, instanceCounts,
+                                               baseInstances, drawcount);
+    }
     return rx::MultiDrawArraysInstancedBaseInstanceGeneral(
         this, context, mode, firsts, counts, instanceCounts, baseInstances, drawcount);
 }
@@ -4427,6 +5046,17 @@ angle::Result ContextVk::multiDrawElementsInstancedBaseVertexBaseInstance(
     const GLuint *baseInstances,
     GLsizei drawcount)
 {
+    if (canStreamMultiDrawAsIndirect(mode, drawcount, true))
+    {
+        bool drawn = false;
+        ANGLE_TRY(multiDrawElementsStreamedIndirect(context, mode, counts, type, indices,
+                                                    instanceCounts, baseVertices, baseInstances,
+                                                    drawcount, &drawn));
+        if (drawn)
+        {
+            return angle::Result::Continue;
+        }
+    }
     return rx::MultiDrawElementsInstancedBaseVertexBaseInstanceGeneral(
         this, context, mode, counts, type, indices, instanceCounts, baseVertices, baseInstances,
         drawcount);
@@ -4836,12 +5466,21 @@ void ContextVk::updateBlendFuncsAndEquations()
     FramebufferVk *framebufferVk              = vk::GetImpl(mState.getDrawFramebuffer());
     mCachedDrawFramebufferColorAttachmentMask = framebufferVk->getState().getEnabledDrawBuffers();
 
-    mGraphicsPipelineDesc->updateBlendFuncs(&mGraphicsPipelineTransition, blendStateExt,
-                                            mCachedDrawFramebufferColorAttachmentMask);
-
-    mGraphicsPipelineDesc->updateBlendEquations(&mGraphicsPipelineTransition, blendStateExt,
+    if (getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        mGraphicsPipelineDesc->updateDynamicBlendEquations(
+            &mGraphicsPipelineTransition, blendStateExt, mCachedDrawFramebufferColorAttachmentMask);
+        mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+    }
+    else
+    {
+        mGraphicsPipelineDesc->updateBlendFuncs(&mGraphicsPipelineTransition, blendStateExt,
                                                 mCachedDrawFramebufferColorAttachmentMask);
 
+        mGraphicsPipelineDesc->updateBlendEquations(&mGraphicsPipelineTransition, blendStateExt,
+                                                    mCachedDrawFramebufferColorAttachmentMask);
+    }
+
     // This function may be called outside of ContextVk::syncState, and so invalidates the graphics
     // pipeline.
     invalidateCurrentGraphicsPipeline();
@@ -5053,7 +5692,16 @@ void ContextVk::updateScissor(const gl::State &glState)
         !mRenderPassCommands->getRenderArea().encloses(rotatedScissoredArea))
     {
         ASSERT(mRenderPassCommands->started());
-        mRenderPassCommands->growRenderArea(this, rotatedScissoredArea);
+        if (mRenderPassCommands->canGrowRenderArea(rotatedScissoredArea))
+        {
+            mRenderPassCommands->growRenderArea(this, rotatedScissoredArea);
+        }
+        else
+        {
+            // The render area is fixed by a scissored clear done with loadOp.  Let the next draw
+            // start a new render pass.
+            onRenderPassFinished(RenderPassClosureReason::RenderAreaGrowthAfterScissoredClear);
+        }
     }
 }
 
@@ -5496,14 +6144,31 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_BLEND_CONSTANTS);
                 break;
             case gl::state::DIRTY_BIT_BLEND_FUNCS:
-                mGraphicsPipelineDesc->updateBlendFuncs(
-                    &mGraphicsPipelineTransition, glState.getBlendStateExt(),
-                    drawFramebufferVk->getState().getColorAttachmentsMask());
+                if (getFeatures().useColorBlendEquationDynamicState.enabled)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateBlendFuncs(
+                        &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                        drawFramebufferVk->getState().getColorAttachmentsMask());
+                }
                 break;
             case gl::state::DIRTY_BIT_BLEND_EQUATIONS:
-                mGraphicsPipelineDesc->updateBlendEquations(
-                    &mGraphicsPipelineTransition, glState.getBlendStateExt(),
-                    drawFramebufferVk->getState().getColorAttachmentsMask());
+                if (getFeatures().useColorBlendEquationDynamicState.enabled)
+                {
+                    mGraphicsPipelineDesc->updateDynamicBlendEquations(
+                        &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                        drawFramebufferVk->getState().getColorAttachmentsMask());
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateBlendEquations(
+                        &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                        drawFramebufferVk->getState().getColorAttachmentsMask());
+                }
                 updateAdvancedBlendEquations(programExecutable);
                 break;
             case gl::state::DIRTY_BIT_COLOR_MASK:
@@ -5769,6 +6434,15 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 mGraphicsPipelineDesc->resetBlendFuncsAndEquations(
                     &mGraphicsPipelineTransition, glState.getBlendStateExt(),
                     mCachedDrawFramebufferColorAttachmentMask, newColorAttachmentMask);
+                if (getFeatures().useColorBlendEquationDynamicState.enabled)
+                {
+                    // Keep the blend funcs out of the pipeline description, and set the dynamic
+                    // state for the new set of attachments.
+                    mGraphicsPipelineDesc->updateDynamicBlendEquations(
+                        &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                        newColorAttachmentMask & ~mCachedDrawFramebufferColorAttachmentMask);
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+                }
                 mCachedDrawFramebufferColorAttachmentMask = newColorAttachmentMask;
 
                 if (!getFeatures().preferDynamicRendering.enabled)
@@ -6823,6 +7497,34 @@ angle::Result ContextVk::memoryBarrier(const gl::Context *context, GLbitfield ba
     // To achieve this, a dirty bit is added that breaks the render pass if any storage
     // buffer/images are used in it.  Until the render pass breaks, changing the program or storage
     // buffer/image bindings should set this dirty bit again.
+    //
+    // A barrier between two dispatches that only orders their storage accesses is common in
+    // compute workloads.  If the next dispatch can be appended to mOutsideRenderPassCommands, the
+    // barrier is recorded there instead, and neither the flush nor the compute dirty bits are
+    // needed.  The resources that the dispatches use are already tracked as written by compute
+    // shaders, so later commands still get their barriers.
+    constexpr GLbitfield kComputeToComputeMemoryBarriers =
+        GL_SHADER_STORAGE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT |
+        GL_ATOMIC_COUNTER_BARRIER_BIT;
+    if ((barriers & ~kComputeToComputeMemoryBarriers) == 0 && mComputeDirtyBits.none() &&
+        mOutsideRenderPassCommands->hasShaderStorageOutput() &&
+        canAppendDispatchToOutsideRenderPassCommands())
+    {
+        VkMemoryBarrier memoryBarrier = {};
+        memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask   = VK_ACCESS_SHADER_WRITE_BIT;
+        memoryBarrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        mOutsideRenderPassCommands->getCommandBuffer().memoryBarrier(
+            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            memoryBarrier);
+
+        // Draws still take the barrier into account as usual.
+        mDeferredMemoryBarriers |= barriers;
+        mGraphicsDirtyBits.set(DIRTY_BIT_MEMORY_BARRIER);
+        mGraphicsDirtyBits.set(DIRTY_BIT_SHADER_RESOURCES);
+        mRenderPassCommands->setGLMemoryBarrierIssued();
+        return angle::Result::Continue;
+    }
 
     if (mRenderPassCommands->hasShaderStorageOutput())
     {
@@ -6896,6 +7598,53 @@ void ContextVk::blendBarrier()
     }
 }
 
+angle::Result ContextVk::beginConditionalRender(const gl::Context *context,
+                                                gl::Query *query,
+                                                GLenum mode)
+{
+    // All modes are implemented as GL_QUERY_WAIT_NV; the predicate is written once the result of
+    // the query is available.  The GPU does the waiting, unless the query cannot be copied.
+    QueryVk *queryVk = vk::GetImpl(query);
+    return queryVk->updateConditionalRenderingPredicate(context, &mConditionalRenderingPredicate);
+}
+
+angle::Result ContextVk::endConditionalRender(const gl::Context *context)
+{
+    endConditionalRenderingIfActive();
+    mConditionalRenderingPredicate = nullptr;
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::isConditionalRenderingDiscarding(const gl::Context *context,
+                                                          bool *discardOut)
+{
+    *discardOut = false;
+
+    gl::Query *query = mState.getConditionalRenderQuery();
+    if (query == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_VK_PERF_WARNING(this, GL_DEBUG_SEVERITY_LOW,
+                          "Conditional rendering evaluated on the CPU");
+
+    bool passed = true;
+    ANGLE_TRY(vk::GetImpl(query)->getConditionalRenderingResult(context, &passed));
+    *discardOut = !passed;
+    return angle::Result::Continue;
+}
+
+void ContextVk::endConditionalRenderingIfActive()
+{
+    if (mIsConditionalRenderingActive)
+    {
+        ASSERT(mRenderPassCommands->started());
+        mRenderPassCommands->getCommandBuffer().endConditionalRendering();
+        mIsConditionalRenderingActive = false;
+    }
+}
+
 angle::Result ContextVk::acquireTextures(const gl::Context *context,
                                          const gl::TextureBarrierVector &textureBarriers)
 {
@@ -7502,12 +8251,19 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
         recreatePipelineLayout = true;
     }
 
+    if (getFeatures().useImmutableSamplersForTextures.enabled &&
+        executableVk->needsNewImmutableTextureSamplers(mActiveTextures, mState.getSamplers()))
+    {
+        recreatePipelineLayout = true;
+    }
+
     // Recreate the pipeline layout, if necessary.
     if (recreatePipelineLayout)
     {
         executableVk->resetLayout(this);
-        ANGLE_TRY(executableVk->createPipelineLayout(
-            this, &getPipelineLayoutCache(), &getDescriptorSetLayoutCache(), &mActiveTextures));
+        ANGLE_TRY(executableVk->createPipelineLayout(this, &getPipelineLayoutCache(),
+                                                     &getDescriptorSetLayoutCache(),
+                                                     &mActiveTextures, &mState.getSamplers()));
         ANGLE_TRY(executableVk->initializeDescriptorPools(this, &getDescriptorSetLayoutCache(),
                                                           &getMetaDescriptorPools()));
 
@@ -7629,6 +8385,38 @@ void ContextVk::prepareToSubmitAllCommands()
     finalizeAllForeignImages();
 }
 
+angle::Result ContextVk::deferSignalSemaphore(const vk::Semaphore *semaphore)
+{
+    ASSERT(getFeatures().deferExternalSemaphoreSignal.enabled);
+
+    // Every command recorded so far is submitted before the semaphore is signaled, as well as the
+    // ones recorded until the next submission, which the external side doesn't mind waiting for.
+    ANGLE_TRY(flushDeferredSignalSemaphore(QueueSubmitReason::ExternalSemaphoreSignal));
+    mDeferredSignalSemaphore = semaphore;
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::flushDeferredSignalSemaphore(QueueSubmitReason queueSubmitReason)
+{
+    if (mDeferredSignalSemaphore == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    const vk::Semaphore *semaphore = mDeferredSignalSemaphore;
+    mDeferredSignalSemaphore       = nullptr;
+    return flushAndSubmitCommands(semaphore, nullptr, queueSubmitReason);
+}
+
+void ContextVk::onSemaphoreDestroyed(const vk::Semaphore *semaphore)
+{
+    if (mDeferredSignalSemaphore == semaphore)
+    {
+        // The signal was requested before the semaphore was deleted, so it must still happen.
+        (void)flushDeferredSignalSemaphore(QueueSubmitReason::ExternalSemaphoreSignal);
+    }
+}
+
 angle::Result ContextVk::flushAndSubmitCommands(const vk::Semaphore *signalSemaphore,
                                                 const vk::SharedExternalFence *externalFence,
                                                 QueueSubmitReason queueSubmitReason)
@@ -7648,6 +8436,20 @@ angle::Result ContextVk::flushAndSubmitCommandsImpl(const vk::Semaphore *signalS
                                                     const vk::SharedExternalFence *externalFence,
                                                     QueueSubmitReason queueSubmitReason)
 {
+    if (mDeferredSignalSemaphore != nullptr)
+    {
+        if (signalSemaphore == nullptr)
+        {
+            signalSemaphore = mDeferredSignalSemaphore;
+        }
+        else
+        {
+            // Only one semaphore is signaled per submission, so the deferred one gets its own.
+            ANGLE_TRY(flushDeferredSignalSemaphore(queueSubmitReason));
+        }
+        mDeferredSignalSemaphore = nullptr;
+    }
+
     // Even if render pass does not have any command, we may still need to submit it in case it has
     // CLEAR loadOp.
     bool someCommandsNeedFlush =
@@ -7682,6 +8484,15 @@ angle::Result ContextVk::flushAndSubmitCommandsImpl(const vk::Semaphore *signalS
                                                        mLastFlushedQueueSerial));
     }
 
+    // The render pass is closed at this point, so the results of the queries that ended in it can
+    // be copied.  The copies write to host-visible buffers, which makes the barrier below cover
+    // them.
+    for (QueryVk *queryVk : mQueriesPendingResultCopy)
+    {
+        ANGLE_TRY(queryVk->recordResultCopy(this));
+    }
+    mQueriesPendingResultCopy.clear();
+
     const bool outsideRenderPassWritesToBuffer =
         mOutsideRenderPassCommands->getAndResetHasHostVisibleBufferWrite();
     const bool renderPassWritesToBuffer =
@@ -7732,6 +8543,20 @@ angle::Result ContextVk::flushAndSubmitCommandsImpl(const vk::Semaphore *signalS
         mHasInFlightStreamedVertexBuffers.reset();
     }
 
+    if (mHasInFlightSharedStreamedVertexBuffer)
+    {
+        mSharedStreamedVertexBuffer.updateQueueSerialAndReleaseInFlightBuffers(
+            this, mLastFlushedQueueSerial);
+        mHasInFlightSharedStreamedVertexBuffer = false;
+    }
+
+    if (mHasInFlightStreamedIndirectBuffer)
+    {
+        mStreamedIndirectBuffer.updateQueueSerialAndReleaseInFlightBuffers(this,
+                                                                           mLastFlushedQueueSerial);
+        mHasInFlightStreamedIndirectBuffer = false;
+    }
+
     prepareToSubmitAllCommands();
     ANGLE_TRY(submitCommands(signalSemaphore, externalFence, queueSubmitReason));
     mCommandsPendingSubmissionCount = 0;
@@ -7918,6 +8743,7 @@ angle::Result ContextVk::beginNewRenderPass(
     generateRenderPassCommandsQueueSerial(&renderPassQueueSerial);
 
     mPerfCounters.renderPasses++;
+    mIsRenderPassInternal = false;
     ANGLE_TRY(mRenderPassCommands->beginRenderPass(
         this, std::move(framebuffer), renderArea, renderPassDesc, renderPassAttachmentOps,
         colorAttachmentCount, depthStencilAttachmentIndex, clearValues, renderPassQueueSerial,
@@ -7940,6 +8766,8 @@ angle::Result ContextVk::beginNewRenderPass(
 
     // By default all render pass should allow to be reactivated.
     mAllowRenderPassToReactivate = true;
+    // Until the framebuffer that started it says otherwise, other framebuffers can't continue it.
+    mStartedRenderPassFramebufferQueueSerial = QueueSerial();
 
     if (mCurrentGraphicsPipeline)
     {
@@ -8002,6 +8830,9 @@ angle::Result ContextVk::startNextSubpass()
 {
     ASSERT(hasActiveRenderPass());
 
+    // Conditional rendering cannot span subpasses.
+    endConditionalRenderingIfActive();
+
     // The graphics pipelines are bound to a subpass, so update the subpass as well.
     mGraphicsPipelineDesc->nextSubpass(&mGraphicsPipelineTransition);
 
@@ -8034,6 +8865,12 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     // Set dirty bits if render pass was open (and thus will be closed).
     mGraphicsDirtyBits |= mNewRenderPassDirtyBits;
 
+    // The counts are only reset when the overlay is updated on present.
+    if (mState.getOverlay()->isEnabled())
+    {
+        ++mRenderPassClosureCounts[reason];
+    }
+
     mCurrentTransformFeedbackQueueSerial = QueueSerial();
 
     onRenderPassFinished(reason);
@@ -8041,9 +8878,28 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     addOverlayUsedBuffersCount(mRenderPassCommands);
 
     pauseTransformFeedbackIfActiveUnpaused();
+    endConditionalRenderingIfActive();
 
     ANGLE_TRY(mRenderPassCommands->endRenderPass(this));
 
+    // The attachment ops are final now, estimate how much memory traffic they cause on tilers.
+    vk::AttachmentBandwidth bandwidth;
+    vk::AccumulateAttachmentBandwidth(mRenderPassCommands->getRenderPassDesc(),
+                                      mRenderPassCommands->getAttachmentOps(),
+                                      mRenderPassCommands->getRenderArea(), &bandwidth);
+    ANGLE_TRACE_EVENT_INSTANT("gpu.angle", "RenderPassAttachmentBandwidth", "loadBytes",
+                              bandwidth.loadBytes, "storeBytes", bandwidth.storeBytes,
+                              "resolveBytes", bandwidth.resolveBytes, "unresolveBytes",
+                              bandwidth.unresolveBytes);
+    mPerfCounters.attachmentLoadBytes += bandwidth.loadBytes;
+    mPerfCounters.attachmentStoreBytes += bandwidth.storeBytes;
+    mPerfCounters.attachmentResolveBytes += bandwidth.resolveBytes;
+    mPerfCounters.attachmentUnresolveBytes += bandwidth.unresolveBytes;
+    mFrameAttachmentBandwidth.loadBytes += bandwidth.loadBytes;
+    mFrameAttachmentBandwidth.storeBytes += bandwidth.storeBytes;
+    mFrameAttachmentBandwidth.resolveBytes += bandwidth.resolveBytes;
+    mFrameAttachmentBandwidth.unresolveBytes += bandwidth.unresolveBytes;
+
     if (kEnableCommandStreamDiagnostics)
     {
         addCommandBufferDiagnostics(mRenderPassCommands->getCommandDiagnostics());
@@ -8090,6 +8946,20 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     mCommandsPendingSubmissionCount +=
         mRenderPassCommands->getCommandBuffer().getRenderPassWriteCommandCount();
 
+    const PassGpuTimeCategory gpuTimeCategory = mIsRenderPassInternal
+                                                    ? PassGpuTimeCategory::InternalRenderPass
+                                                    : PassGpuTimeCategory::AppRenderPass;
+    setPassGpuTimeQuery(mRenderPassCommands, gpuTimeCategory);
+
+    if (mRenderPassCommands->executesInlineInPrimary())
+    {
+        mPerfCounters.renderPassesExecutedInline++;
+    }
+    else
+    {
+        mPerfCounters.renderPassesExecutedFromSecondaries++;
+    }
+
     ANGLE_TRY(mCommandState.flushRenderPassCommands(this, *renderPass, framebufferOverride,
                                                     &mRenderPassCommands));
 
@@ -8384,6 +9254,7 @@ angle::Result ContextVk::flushOutsideRenderPassCommands()
     {
         mIsAnyHostVisibleBufferWritten = true;
     }
+    setPassGpuTimeQuery(mOutsideRenderPassCommands, PassGpuTimeCategory::OutsideRenderPass);
     ANGLE_TRY(mCommandState.flushOutsideRPCommands(this, &mOutsideRenderPassCommands));
 
     // Make sure appropriate dirty bits are set, in case another thread makes a submission before
@@ -8486,6 +9357,14 @@ angle::Result ContextVk::endRenderPassQuery(QueryVk *queryVk)
     return angle::Result::Continue;
 }
 
+void ContextVk::removePendingQueryResultCopy(QueryVk *queryVk)
+{
+    auto iter =
+        std::find(mQueriesPendingResultCopy.begin(), mQueriesPendingResultCopy.end(), queryVk);
+    ASSERT(iter != mQueriesPendingResultCopy.end());
+    mQueriesPendingResultCopy.erase(iter);
+}
+
 void ContextVk::pauseRenderPassQueriesIfActive()
 {
     for (QueryVk *activeQuery : mActiveRenderPassQueries)
@@ -8986,25 +9865,40 @@ const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters()
 {
     syncObjectPerfCounters(mRenderer->getCommandQueuePerfCounters());
 
-    ASSERT(mPerfMonitorCountersInfo.size() == 1);
-    ASSERT(mPerfMonitorCounters.size() == 1);
+    ASSERT(mPerfMonitorCountersInfo.size() == 3);
+    ASSERT(mPerfMonitorCounters.size() == 3);
+    ASSERT(mPerfMonitorCountersInfo[0].name == "vulkan");
+    ASSERT(mPerfMonitorCountersInfo[1].name == "vulkan_frame");
+    ASSERT(mPerfMonitorCountersInfo[2].name == "vulkan_dirty_bits");
 
-    const angle::PerfMonitorCounterGroupInfo &info = mPerfMonitorCountersInfo[0];
-    angle::PerfMonitorCounters &counters           = mPerfMonitorCounters[0].counters;
+    const angle::VulkanPerfCounters *sources[] = {&mPerfCounters, &mFramePerfCounters};
+    for (size_t groupIndex = 0; groupIndex < ArraySize(sources); ++groupIndex)
+    {
+        const angle::PerfMonitorCounterGroupInfo &info = mPerfMonitorCountersInfo[groupIndex];
+        angle::PerfMonitorCounters &counters           = mPerfMonitorCounters[groupIndex].counters;
+        const angle::VulkanPerfCounters &source        = *sources[groupIndex];
 
-    ASSERT(info.name == "vulkan");
-    ASSERT(info.counters.size() == counters.size());
+        ASSERT(info.counters.size() == counters.size());
 
-    uint32_t counterIndex = 0;
+        uint32_t counterIndex = 0;
 
 #define ANGLE_UPDATE_PERF_MAP(COUNTER)                    \
     ASSERT(info.counters.size() > counterIndex);          \
     ASSERT(info.counters[counterIndex].name == #COUNTER); \
-    counters[counterIndex++].value = mPerfCounters.COUNTER;
+    counters[counterIndex++].value = source.COUNTER;
 
-    ANGLE_VK_PERF_COUNTERS_X(ANGLE_UPDATE_PERF_MAP)
+        ANGLE_VK_PERF_COUNTERS_X(ANGLE_UPDATE_PERF_MAP)
 
 #undef ANGLE_UPDATE_PERF_MAP
+    }
+
+    angle::PerfMonitorCounters &dirtyBitCounters = mPerfMonitorCounters[2].counters;
+    for (size_t dirtyBit = 0; dirtyBit < DIRTY_BIT_MAX; ++dirtyBit)
+    {
+        dirtyBitCounters[dirtyBit * 2].value = mFrameGraphicsDirtyBitHandlerStats[dirtyBit].calls;
+        dirtyBitCounters[dirtyBit * 2 + 1].value =
+            mFrameGraphicsDirtyBitHandlerStats[dirtyBit].cycles;
+    }
 
     return mPerfMonitorCounters;
 }
@@ -9148,10 +10042,18 @@ ANGLE_INLINE void ContextVk::generateRenderPassCommandsQueueSerial(QueueSerial *
 void ContextVk::resetPerFramePerfCounters()
 {
     mPerfCounters.renderPasses                           = 0;
+    mPerfCounters.renderPassesExecutedInline             = 0;
+    mPerfCounters.renderPassesExecutedFromSecondaries    = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
     mPerfCounters.descriptorSetAllocations               = 0;
+    mPerfCounters.bufferGhostBytesPerFrame               = 0;
+    mPerfCounters.appRenderPassGpuTimeNs                 = 0;
+    mPerfCounters.internalRenderPassGpuTimeNs            = 0;
+    mPerfCounters.outsideRenderPassGpuTimeNs             = 0;
+
+    mGraphicsDirtyBitHandlerStats.fill({});
 
     mRenderer->resetCommandQueuePerFrameCounters();
 
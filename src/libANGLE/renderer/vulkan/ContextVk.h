@@ -79,6 +79,18 @@ enum class SurfaceAncillaryColorBehavior
     InvalidateOnPresent,
 };
 
+// The kinds of command buffers whose GPU time is measured with measurePassGpuTime.
+enum class PassGpuTimeCategory : uint8_t
+{
+    // Render passes started for the application's draws and clears.
+    AppRenderPass,
+    // Render passes started by UtilsVk for conversions, blits, resolves, etc.
+    InternalRenderPass,
+    // Copies, dispatches and other commands outside render passes, both the application's and
+    // ANGLE's.
+    OutsideRenderPass,
+};
+
 static constexpr GLbitfield kBufferMemoryBarrierBits =
     GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT | GL_UNIFORM_BARRIER_BIT |
     GL_COMMAND_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT |
@@ -415,6 +427,15 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // KHR_blend_equation_advanced
     void blendBarrier() override;
 
+    // NV_conditional_render
+    angle::Result beginConditionalRender(const gl::Context *context,
+                                         gl::Query *query,
+                                         GLenum mode) override;
+    angle::Result endConditionalRender(const gl::Context *context) override;
+    // Evaluates the condition on the CPU, for commands that VK_EXT_conditional_rendering does not
+    // affect.
+    angle::Result isConditionalRenderingDiscarding(const gl::Context *context, bool *discardOut);
+
     // GL_ANGLE_vulkan_image
     angle::Result acquireTextures(const gl::Context *context,
                                   const gl::TextureBarrierVector &textureBarriers) override;
@@ -458,6 +479,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result onPauseTransformFeedback();
     void pauseTransformFeedbackIfActiveUnpaused();
 
+    // Conditional rendering begins lazily with the first draw call in a render pass, and must end
+    // before the render pass (or subpass) does.  It is begun again with the next draw call.
+    void endConditionalRenderingIfActive();
+
     void onColorAccessChange() { mGraphicsDirtyBits |= kColorAccessChangeDirtyBits; }
     void onDepthStencilAccessChange() { mGraphicsDirtyBits |= kDepthStencilAccessChangeDirtyBits; }
 
@@ -512,6 +537,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         mCommandState.addWaitSemaphore(semaphore, stageMask);
     }
 
+    // With the deferExternalSemaphoreSignal feature, the semaphore of glSignalSemaphoreEXT is
+    // signaled by the next call to flushAndSubmitCommands instead of a submission of its own.
+    angle::Result deferSignalSemaphore(const vk::Semaphore *semaphore);
+    // Submits the deferred signal, if any.  Used before waiting on an external semaphore, as the
+    // external side may only signal it after it sees the deferred signal.
+    angle::Result flushDeferredSignalSemaphore(QueueSubmitReason queueSubmitReason);
+    void onSemaphoreDestroyed(const vk::Semaphore *semaphore);
+
     template <typename T>
     void addGarbage(T *object)
     {
@@ -672,6 +705,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void disableRenderPassReactivation() { mAllowRenderPassToReactivate = false; }
 
+    // Called by the framebuffer that started the current render pass, so that another framebuffer
+    // with the same attachments can continue it.
+    void onFramebufferStartedRenderPass(const vk::FramebufferDesc &framebufferDesc)
+    {
+        mStartedRenderPassFramebufferDesc        = framebufferDesc;
+        mStartedRenderPassFramebufferQueueSerial = mRenderPassCommands->getQueueSerial();
+    }
+
     bool hasStartedRenderPass() const { return mRenderPassCommands->started(); }
 
     // Only returns true if we have a started RP and we've run setupDraw.
@@ -767,8 +808,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // Used by QueryVk to share query helpers between transform feedback queries.
     QueryVk *getActiveRenderPassQuery(gl::QueryType queryType) const;
 
+    // Queries whose results are copied to a buffer on the next submission.
+    void addPendingQueryResultCopy(QueryVk *queryVk)
+    {
+        mQueriesPendingResultCopy.push_back(queryVk);
+    }
+    void removePendingQueryResultCopy(QueryVk *queryVk);
+
     void syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQueuePerfCounters);
     void updateOverlayOnPresent();
+    std::string getRenderPassClosureSummary() const;
     void addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *commandBuffer);
 
     // For testing only.
@@ -819,6 +868,20 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return angle::Result::Continue;
     }
 
+    // Used when shareStreamedVertexBufferAcrossAttribs is enabled.  The returned buffer's
+    // suballocation is only valid until the next call.
+    angle::Result allocateSharedStreamedVertexBuffer(size_t bytesToAllocate,
+                                                     vk::BufferHelper **vertexBufferOut)
+    {
+        ASSERT(getFeatures().shareStreamedVertexBufferAcrossAttribs.enabled);
+        bool newBufferOut;
+        ANGLE_TRY(mSharedStreamedVertexBuffer.allocate(this, bytesToAllocate, vertexBufferOut,
+                                                       &newBufferOut));
+        mHasInFlightSharedStreamedVertexBuffer =
+            mHasInFlightSharedStreamedVertexBuffer || newBufferOut;
+        return angle::Result::Continue;
+    }
+
     // Put the context in framebuffer fetch mode.  If the permanentlySwitchToFramebufferFetchMode
     // feature is enabled, this is done on first encounter of framebuffer fetch, and makes the
     // context use framebuffer-fetch-enabled render passes from here on.
@@ -832,8 +895,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     const angle::PerfMonitorCounterGroupsInfo &getPerfMonitorCountersInfo() const override;
     const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
 
+    // Captures the counters of the frame being presented, shown by the overlay and exported
+    // through the "vulkan_frame" perf monitor group.  Called before the overlay is drawn, so the
+    // overlay's own work isn't counted.
+    void collectFramePerfCounters();
     void resetPerFramePerfCounters();
 
+    // Called by UtilsVk when it starts a render pass of its own, so that the GPU time of the render
+    // pass is counted as ANGLE's and not the application's.
+    void onInternalRenderPassStarted() { mIsRenderPassInternal = true; }
+
     // Accumulate cache stats for a specific cache
     void accumulateCacheStats(VulkanCacheType cache, const CacheStats &stats)
     {
@@ -841,10 +912,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     }
 
     // Whether VK_EXT_pipeline_robustness should be used to enable robust buffer access in the
-    // pipeline.
+    // pipeline.  The shaders of a share group with a robust context may rely on robust buffer
+    // access instead of clamping the indices of arrays in buffer blocks, so every context of that
+    // share group uses it.
     vk::PipelineRobustness pipelineRobustness() const
     {
-        return getFeatures().supportsPipelineRobustness.enabled && mState.hasRobustAccess()
+        const bool robustAccess =
+            mState.hasRobustAccess() ||
+            (getFeatures().preferRobustBufferAccessToIndexClamping.enabled &&
+             mShareGroupVk->hasAnyContextWithRobustness());
+        return getFeatures().supportsPipelineRobustness.enabled && robustAccess
                    ? vk::PipelineRobustness::Robust
                    : vk::PipelineRobustness::NonRobust;
     }
@@ -1010,6 +1087,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE,
         DIRTY_BIT_DYNAMIC_LOGIC_OP,
         DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE,
+        // - In VK_EXT_extended_dynamic_state3
+        DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION,
         // - In VK_KHR_fragment_shading_rate
         DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE,
 
@@ -1106,6 +1185,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE > DIRTY_BIT_RENDER_PASS,
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
+    static_assert(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION > DIRTY_BIT_RENDER_PASS,
+                  "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE > DIRTY_BIT_RENDER_PASS,
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
 
@@ -1116,6 +1197,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     using ComputeDirtyBitHandler =
         angle::Result (ContextVk::*)(DirtyBits::Iterator *dirtyBitsIterator);
 
+    // Used by profileDirtyBitHandlers.
+    struct DirtyBitHandlerStats
+    {
+        uint64_t calls  = 0;
+        uint64_t cycles = 0;
+    };
+    static const char *GetDirtyBitName(DirtyBitType dirtyBit);
+
     class ScopedDescriptorSetUpdates;
 
     bool isSingleBufferedWindowCurrent() const;
@@ -1147,6 +1236,30 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                            gl::DrawElementsType indexType,
                                            vk::BufferHelper *indirectBuffer);
 
+    // Multi-draw calls with the draw parameters in client memory are issued as a single indirect
+    // draw when nothing needs to change between the draws, by streaming the parameters into an
+    // indirect buffer.
+    bool canStreamMultiDrawAsIndirect(gl::PrimitiveMode mode,
+                                      GLsizei drawcount,
+                                      bool hasBaseVertexOrInstance);
+    angle::Result multiDrawArraysStreamedIndirect(const gl::Context *context,
+                                                  gl::PrimitiveMode mode,
+                                                  const GLint *firsts,
+                                                  const GLsizei *counts,
+                                                  const GLsizei *instanceCounts,
+                                                  const GLuint *baseInstances,
+                                                  GLsizei drawcount);
+    angle::Result multiDrawElementsStreamedIndirect(const gl::Context *context,
+                                                    gl::PrimitiveMode mode,
+                                                    const GLsizei *counts,
+                                                    gl::DrawElementsType type,
+                                                    const GLvoid *const *indices,
+                                                    const GLsizei *instanceCounts,
+                                                    const GLint *baseVertices,
+                                                    const GLuint *baseInstances,
+                                                    GLsizei drawcount,
+                                                    bool *drawnOut);
+
     angle::Result setupLineLoopIndexedIndirectDraw(const gl::Context *context,
                                                    gl::PrimitiveMode mode,
                                                    gl::DrawElementsType indexType,
@@ -1171,6 +1284,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     uint32_t *numIndicesOut);
 
     angle::Result setupDispatch(const gl::Context *context);
+    // Whether a dispatch can be recorded right after the previous commands of
+    // mOutsideRenderPassCommands without flushing them.
+    bool canAppendDispatchToOutsideRenderPassCommands() const;
 
     gl::Rectangle getCorrectedViewport(const gl::Rectangle &viewport) const;
     void updateViewport(FramebufferVk *framebufferVk,
@@ -1229,6 +1345,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         DirtyBits dirtyBitMask);
     angle::Result handleDirtyAnySamplePassedQueryEnd(DirtyBits::Iterator *dirtyBitsIterator,
                                                      DirtyBits dirtyBitMask);
+    bool canDrawFramebufferContinueStartedRenderPass(FramebufferVk *drawFramebufferVk,
+                                                     const gl::Rectangle &renderArea) const;
     angle::Result handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                 DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsEventLog(DirtyBits::Iterator *dirtyBitsIterator,
@@ -1316,6 +1434,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result handleDirtyGraphicsDynamicPrimitiveRestartEnable(
         DirtyBits::Iterator *dirtyBitsIterator,
         DirtyBits dirtyBitMask);
+    angle::Result handleDirtyGraphicsDynamicColorBlendEquation(
+        DirtyBits::Iterator *dirtyBitsIterator,
+        DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsDynamicFragmentShadingRate(
         DirtyBits::Iterator *dirtyBitsIterator,
         DirtyBits dirtyBitMask);
@@ -1363,6 +1484,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void clearAllGarbage();
     void dumpCommandStreamDiagnostics();
     angle::Result flushOutsideRenderPassCommands();
+    void setPassGpuTimeQuery(vk::CommandBufferHelperCommon *commands, PassGpuTimeCategory category);
+    void resolvePassGpuTimes();
     angle::Result flushAndSubmitCommandsImpl(const vk::Semaphore *signalSemaphore,
                                              const vk::SharedExternalFence *externalFence,
                                              QueueSubmitReason queueSubmitReason);
@@ -1466,6 +1589,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     std::array<GraphicsDirtyBitHandler, DIRTY_BIT_MAX> mGraphicsDirtyBitHandlers;
     std::array<ComputeDirtyBitHandler, DIRTY_BIT_MAX> mComputeDirtyBitHandlers;
+    // With profileDirtyBitHandlers, the calls to and CPU cycles spent in each graphics dirty bit
+    // handler in the current frame, and in the last presented frame.
+    std::array<DirtyBitHandlerStats, DIRTY_BIT_MAX> mGraphicsDirtyBitHandlerStats;
+    std::array<DirtyBitHandlerStats, DIRTY_BIT_MAX> mFrameGraphicsDirtyBitHandlerStats;
 
     vk::RenderPassCommandBuffer *mRenderPassCommandBuffer;
 
@@ -1524,6 +1651,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::QueryTypeMap<QueryVk *> mActiveRenderPassQueries;
     gl::QueryTypeBitSet mActiveRenderPassQueryBitmask;
 
+    // Ended queries whose result copy is recorded just before the next submission.
+    std::vector<QueryVk *> mQueriesPendingResultCopy;
+
     // Dirty bits.
     DirtyBits mGraphicsDirtyBits;
     DirtyBits mComputeDirtyBits;
@@ -1594,6 +1724,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // in-flight buffer or not that we need to release at submission time.
     gl::AttribArray<vk::DynamicBuffer> mStreamedVertexBuffers;
     gl::AttributesMask mHasInFlightStreamedVertexBuffers;
+    // With shareStreamedVertexBufferAcrossAttribs, the non-instanced client attributes of a draw
+    // are instead streamed together into this buffer.
+    vk::DynamicBuffer mSharedStreamedVertexBuffer;
+    bool mHasInFlightSharedStreamedVertexBuffer;
+    // The draw parameters of multi-draw calls that are issued as a single indirect draw.
+    vk::DynamicBuffer mStreamedIndirectBuffer;
+    bool mHasInFlightStreamedIndirectBuffer;
 
     vk::ImageHelper *mImageWithTileMemory;
 
@@ -1609,6 +1746,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // Current active transform feedback buffer queue serial. Invalid if TF not active.
     QueueSerial mCurrentTransformFeedbackQueueSerial;
 
+    // The predicate of NV_conditional_render, owned by the query.  nullptr if conditional rendering
+    // is not enabled.
+    vk::BufferHelper *mConditionalRenderingPredicate;
+    bool mIsConditionalRenderingActive;
+
     egl::ContextPriority mInitialContextPriority;
 
     // The garbage list for single context use objects. The list will be GPU tracked by next
@@ -1662,6 +1804,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // glFlush in that mode).
     bool mHasAnyCommandsPendingSubmission;
 
+    // The semaphore that the next call to flushAndSubmitCommands signals, set by
+    // deferSignalSemaphore.
+    const vk::Semaphore *mDeferredSignalSemaphore;
+
     // Whether color framebuffer fetch is active.  When the permanentlySwitchToFramebufferFetchMode
     // feature is enabled, if any program uses framebuffer fetch, rendering switches to assuming
     // framebuffer fetch could happen in any render pass.  This incurs a potential cost due to usage
@@ -1678,6 +1824,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     // True if current started render pass is allowed to reactivate.
     bool mAllowRenderPassToReactivate;
+    // The attachments of the framebuffer that started the render pass of the given queue serial.
+    // Other framebuffers with identical attachments can reactivate that render pass.
+    vk::FramebufferDesc mStartedRenderPassFramebufferDesc;
+    QueueSerial mStartedRenderPassFramebufferQueueSerial;
+
+    // Number of render passes ended for each reason since the last present, shown in the overlay.
+    angle::PackedEnumMap<RenderPassClosureReason, uint32_t> mRenderPassClosureCounts;
+    // Estimated attachment bandwidth of the render passes ended since the last present, shown in
+    // the overlay.
+    vk::AttachmentBandwidth mFrameAttachmentBandwidth;
 
     // This flag indicates whether size pointer should be used as arg for binding vertex buffers.
     bool mUseSizePointerForBindingVertexBuffers;
@@ -1690,9 +1846,30 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // The number of render passes since the last submission of all commands.
     VkDeviceSize mRenderPassCountSinceSubmit;
 
-    // A mix of per-frame and per-run counters.
+    // A mix of per-frame and per-run counters.  The first group has the live values of
+    // mPerfCounters, the second has the values of mFramePerfCounters, and the third has the values
+    // of mFrameGraphicsDirtyBitHandlerStats.
     angle::PerfMonitorCounterGroupsInfo mPerfMonitorCountersInfo;
     angle::PerfMonitorCounterGroups mPerfMonitorCounters;
+    // The counters as they were at the end of the last presented frame.  Unlike the live
+    // counters, they can be sampled at any time without catching a frame midway.
+    angle::VulkanPerfCounters mFramePerfCounters;
+
+    // With measurePassGpuTime, every flushed command buffer is given a pair of timestamp queries
+    // from this pool.  The pairs are used in order, and read back once the command buffers that
+    // wrote them are finished, adding to the GPU time counters in mPerfCounters.
+    static constexpr uint32_t kPassGpuTimeQueryPairCount = 1024;
+    struct PendingPassGpuTime
+    {
+        QueueSerial queueSerial;
+        PassGpuTimeCategory category;
+    };
+    vk::QueryPool mPassGpuTimeQueryPool;
+    std::array<PendingPassGpuTime, kPassGpuTimeQueryPairCount> mPendingPassGpuTimes;
+    uint32_t mFirstPendingPassGpuTime;
+    uint32_t mPendingPassGpuTimeCount;
+    // Whether the current render pass was started by UtilsVk.
+    bool mIsRenderPassInternal;
 
     gl::state::DirtyBits mPipelineDirtyBitsMask;
 
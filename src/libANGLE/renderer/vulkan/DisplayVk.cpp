@@ -590,6 +590,9 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
     outExtensions->timestampSurfaceAttributeANGLE =
         getFeatures().supportsTimestampSurfaceAttribute.enabled;
 
+    outExtensions->surfacePresentStatisticsANGLE = true;
+    outExtensions->surfaceLowLatencyANGLE        = true;
+
     outExtensions->eglColorspaceAttributePassthroughANGLE =
         outExtensions->glColorspace && getFeatures().eglColorspaceAttributePassthrough.enabled;
 
@@ -678,9 +681,10 @@ bool DisplayVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *v
 }
 
 std::shared_ptr<angle::WaitableEvent> DisplayVk::postMultiThreadWorkerTask(
-    const std::shared_ptr<angle::Closure> &task)
+    const std::shared_ptr<angle::Closure> &task,
+    angle::WorkerTaskPriority priority)
 {
-    return mState.multiThreadPool->postWorkerTask(task);
+    return mState.multiThreadPool->postWorkerTask(task, priority);
 }
 
 void DisplayVk::notifyDeviceLost()
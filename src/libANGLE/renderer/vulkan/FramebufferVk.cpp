@@ -263,6 +263,24 @@ void AdjustBlitResolveParametersForPreRotation(SurfaceRotation framebufferAngle,
     }
 }
 
+// Whether a pre-rotated blit can be done with vkCmdBlitImage.  A 180 degree rotation is the same as
+// flipping both axes, which vkCmdBlitImage supports through reversed offsets.
+bool CanBlitWithCommandForPreRotation(SurfaceRotation rotation)
+{
+    return rotation == SurfaceRotation::Identity || rotation == SurfaceRotation::Rotated180Degrees;
+}
+
+// AdjustBlitAreas only moves the blit areas to their pre-rotated location; for the shader blit the
+// 180 degree flip is applied through the blit parameters instead.  For vkCmdBlitImage, reverse the
+// source area instead.
+gl::Rectangle AdjustBlitSourceAreaForPreRotation(SurfaceRotation rotation,
+                                                 const gl::Rectangle &sourceArea)
+{
+    ASSERT(CanBlitWithCommandForPreRotation(rotation));
+    const bool flip = rotation == SurfaceRotation::Rotated180Degrees;
+    return sourceArea.flip(flip, flip);
+}
+
 void AdjustBlitAreas(RenderTargetVk *readRenderTarget,
                      gl::Rectangle *sourceArea,
                      gl::Rectangle *destArea,
@@ -447,6 +465,17 @@ angle::Result UnresolveYuvImage(ContextVk *contextVk,
     contextVk->addGarbage(&srcViewObject);
     return angle::Result::Continue;
 }
+
+// Whether the render area is within the area of an attachment that a previous render pass has left
+// undefined with glInvalidateSubFramebuffer, in which case there is nothing to load.  Transient
+// images are excluded, as their loadOp may be turned into an unresolve operation.
+bool IsRenderAreaInvalidated(const RenderTargetVk *renderTarget,
+                             const gl::Rectangle &invalidatedArea,
+                             const gl::Rectangle &renderArea)
+{
+    return !renderTarget->isImageTransient() && !invalidatedArea.empty() &&
+           invalidatedArea.encloses(renderArea);
+}
 }  // anonymous namespace
 
 FramebufferVk::FramebufferVk(vk::Renderer *renderer, const gl::FramebufferState &state)
@@ -645,8 +674,13 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
+    // Clears may be done with loadOp, which VK_EXT_conditional_rendering doesn't affect, so the
+    // condition of NV_conditional_render is evaluated on the CPU for them.
+    bool discardClear = false;
+    ANGLE_TRY(contextVk->isConditionalRenderingDiscarding(context, &discardClear));
+
     const gl::Rectangle scissoredRenderArea = getRotatedScissoredRenderArea(contextVk);
-    if (scissoredRenderArea.width == 0 || scissoredRenderArea.height == 0)
+    if (discardClear || scissoredRenderArea.width == 0 || scissoredRenderArea.height == 0)
     {
         restageDeferredClears(contextVk);
         return angle::Result::Continue;
@@ -735,6 +769,28 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     bool clearDepthWithDraw   = clearDepth && scissoredClear;
     bool clearStencilWithDraw = clearStencil && (maskedClearStencil || scissoredClear);
 
+    // If the render pass was started by a scissored clear done with loadOp and this clear is
+    // outside its render area, either grow the render area now (which turns the previous clear
+    // into vkCmdClearAttachments) or close the render pass if it has already been drawn to.
+    if (contextVk->hasStartedRenderPassWithQueueSerial(mLastRenderPassQueueSerial))
+    {
+        vk::RenderPassCommandBufferHelper &renderPassCommands =
+            contextVk->getStartedRenderPassCommands();
+        if (renderPassCommands.hasScissoredClearWithLoadOp() &&
+            !renderPassCommands.getRenderArea().encloses(scissoredRenderArea))
+        {
+            if (renderPassCommands.canGrowRenderArea(scissoredRenderArea))
+            {
+                renderPassCommands.growRenderArea(contextVk, scissoredRenderArea);
+            }
+            else
+            {
+                ANGLE_TRY(contextVk->flushCommandsAndEndRenderPass(
+                    RenderPassClosureReason::RenderAreaGrowthAfterScissoredClear));
+            }
+        }
+    }
+
     const bool isMidRenderPassClear =
         contextVk->hasStartedRenderPassWithQueueSerial(mLastRenderPassQueueSerial) &&
         !contextVk->getStartedRenderPassCommands().getCommandBuffer().empty();
@@ -829,7 +885,7 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
             // be performed with a renderpass loadOp.
             if (mDeferredClears.any())
             {
-                clearWithLoadOp(contextVk);
+                clearWithLoadOp(contextVk, &mDeferredClears);
             }
         }
         else
@@ -842,7 +898,7 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
                 // can open a render pass that's otherwise empty, and additional clears can continue
                 // to be accumulated in the render pass loadOps.
                 ASSERT(isAnyAttachment3DWithoutAllLayers || hasAnyExternalAttachments());
-                clearWithLoadOp(contextVk);
+                clearWithLoadOp(contextVk, &mDeferredClears);
             }
 
             // This path will defer the current clears along with deferred clears.  This won't work
@@ -887,19 +943,25 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     // shader/pipeline support would then be required (though this is pending removal of the
     // preferDrawOverClearAttachments workaround).
     //
-    // A potential optimization is to use loadOp=Clear for scissored clears, but care needs to be
-    // taken to either break the render pass on growRenderArea(), or to turn the op back to Load and
-    // revert to vkCmdClearAttachments.  This is not currently deemed necessary.
+    // If the render pass is started for this clear, its render area is the scissor, so the clear
+    // can be done with loadOp=Clear instead.  If the render area needs to grow before anything is
+    // drawn, the render pass turns the op back to Load and reverts to vkCmdClearAttachments.  If
+    // it needs to grow afterwards, the render pass is closed.
     if (((clearColorBuffers.any() && !mEmulatedAlphaAttachmentMask.any() && !maskedClearColor) ||
          clearDepthWithDraw || (clearStencilWithDraw && !maskedClearStencil)) &&
         !preferDrawOverClearAttachments && mAttachmentWithColorSpaceOverrideMask.none())
     {
+        bool clearWithScissoredLoadOp = false;
         if (!contextVk->hasActiveRenderPass())
         {
             // Start a new render pass if necessary to record the commands.
             vk::RenderPassCommandBuffer *commandBuffer;
             gl::Rectangle renderArea = getRenderArea(contextVk);
             ANGLE_TRY(contextVk->startRenderPass(renderArea, &commandBuffer, nullptr));
+
+            clearWithScissoredLoadOp =
+                contextVk->getFeatures().preferLoadOpForScissoredClear.enabled &&
+                scissoredClear && renderArea == scissoredRenderArea;
         }
 
         // Build clear values
@@ -933,9 +995,20 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
             clears.store(vk::kUnpackedDepthIndex, dsAspectFlags, dsClearValue);
         }
 
-        clearWithCommand(contextVk, scissoredClear, scissoredRenderArea, ClearWithCommand::Always,
+        clearWithCommand(contextVk, scissoredClear, scissoredRenderArea,
+                         clearWithScissoredLoadOp ? ClearWithCommand::OptimizeWithLoadOp
+                                                  : ClearWithCommand::Always,
                          &clears);
 
+        // clearWithCommand leaves the clears that can be done with loadOp.
+        if (clears.any())
+        {
+            ASSERT(clearWithScissoredLoadOp);
+            clearWithLoadOp(contextVk, &clears);
+            contextVk->getStartedRenderPassCommands().onScissoredClearWithLoadOp(
+                mState.isMultiview() ? 1 : mCurrentFramebufferDesc.getLayerCount());
+        }
+
         if (!clearColorBuffers.any() && !clearStencilWithDraw)
         {
             ASSERT(!clearDepthWithDraw);
@@ -1480,14 +1553,15 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         // be hard to guarantee the image stretching remains perfect.  That also allows us not to
         // have to transform back the destination clipping to source.
         //
-        // Non-identity pre-rotation cases do not use Vulkan's builtin blit.  Additionally, blits
-        // between 3D and non-3D-non-layer-0 images are forbidden (possibly due to an oversight:
+        // Pre-rotation by 90 or 270 degrees cannot be expressed with Vulkan's builtin blit, but
+        // 180 degrees is a flip in both axes, which is.  Additionally, blits between 3D and
+        // non-3D-non-layer-0 images are forbidden (possibly due to an oversight:
         // https://gitlab.khronos.org/vulkan/vulkan/-/issues/3490)
         //
         // For simplicity, we either blit all render targets with a Vulkan command, or none.
         bool canBlitWithCommand = !isColorResolve && noClip &&
                                   HasSrcBlitFeature(renderer, readRenderTarget) &&
-                                  rotation == SurfaceRotation::Identity;
+                                  CanBlitWithCommandForPreRotation(rotation);
 
         // If we need to reinterpret the colorspace of the read RenderTarget or the draw
         // RenderTarget then the blit must be done through a shader
@@ -1524,10 +1598,12 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
 
         if (canBlitWithCommand && areChannelsBlitCompatible && !reinterpretsColorspace)
         {
+            const gl::Rectangle rotatedSourceColorArea =
+                AdjustBlitSourceAreaForPreRotation(rotation, sourceColorArea);
             for (size_t colorIndexGL : mState.getEnabledDrawBuffers())
             {
                 RenderTargetVk *drawRenderTarget = mRenderTargetCache.getColors()[colorIndexGL];
-                ANGLE_TRY(blitWithCommand(contextVk, sourceColorArea, destColorArea,
+                ANGLE_TRY(blitWithCommand(contextVk, rotatedSourceColorArea, destColorArea,
                                           readRenderTarget, drawRenderTarget, filter, true, false,
                                           false, flipX, flipY));
             }
@@ -1569,13 +1645,15 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
                 const vk::RenderPassDesc &renderPassDesc = renderPassCommands.getRenderPassDesc();
 
                 // Make sure that:
-                // - The blit and render areas are identical
+                // - The blit area covers the render area.  If it's larger, the render area is
+                //   grown to match it before the resolve attachment is added.
                 // - There is no resolve attachment for the corresponding index already
                 // Additionally, disable the optimization for a few corner cases that are
                 // unrealistic and inconvenient.
                 const uint32_t readColorIndexGL = srcFramebuffer->getState().getReadIndex();
                 canResolveWithSubpass =
-                    blitArea == renderPassCommands.getRenderArea() &&
+                    blitArea.encloses(renderPassCommands.getRenderArea()) &&
+                    renderPassCommands.canGrowRenderArea(blitArea) &&
                     !renderPassDesc.hasColorResolveAttachment(readColorIndexGL) &&
                     AllowAddingResolveAttachmentsToSubpass(renderPassDesc);
             }
@@ -1596,6 +1674,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
 
             if (canResolveWithSubpass)
             {
+                contextVk->getStartedRenderPassCommands().growRenderArea(contextVk, blitArea);
                 ANGLE_TRY(resolveColorWithSubpass(contextVk, params));
             }
             else
@@ -1671,6 +1750,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         bool canBlitWithMidRenderPassDraw =
             !isDepthStencilResolve && dstImage != srcImage &&
             contextVk->hasStartedRenderPassWithQueueSerial(mLastRenderPassQueueSerial) &&
+            contextVk->getStartedRenderPassCommands().canGrowRenderArea(params.renderArea) &&
             (!blitStencilBuffer || hasShaderStencilExport) &&
             !contextVk->getState().isTransformFeedbackActiveUnpaused() &&
             !contextVk->hasActiveRenderPassQuery();
@@ -1698,16 +1778,17 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         bool areChannelsBlitCompatible =
             AreSrcAndDstDepthStencilChannelsBlitCompatible(readRenderTarget, drawRenderTarget);
 
-        // Similarly, only blit if there's been no clipping or rotating.
+        // Similarly, only blit if there's been no clipping or 90/270 degree rotation.
         bool canBlitWithCommand = areChannelsBlitCompatible && !isDepthStencilResolve && noClip &&
                                   HasSrcBlitFeature(renderer, readRenderTarget) &&
                                   HasDstBlitFeature(renderer, drawRenderTarget) &&
-                                  rotation == SurfaceRotation::Identity;
+                                  CanBlitWithCommandForPreRotation(rotation);
         if (canBlitWithCommand)
         {
-            return blitWithCommand(contextVk, sourceArea, destArea, readRenderTarget,
-                                   drawRenderTarget, filter, false, blitDepthBuffer,
-                                   blitStencilBuffer, flipX, flipY);
+            return blitWithCommand(
+                contextVk, AdjustBlitSourceAreaForPreRotation(rotation, sourceArea), destArea,
+                readRenderTarget, drawRenderTarget, filter, false, blitDepthBuffer,
+                blitStencilBuffer, flipX, flipY);
         }
 
         VkImageAspectFlags resolveAspects = 0;
@@ -1740,7 +1821,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
             const bool resolvesAllAspects = (resolveAspects & srcImageAspects) == srcImageAspects;
 
             // Make sure that:
-            // - The blit and render areas are identical
+            // - The blit area covers the render area (which is grown to match it)
             // - There is no resolve attachment already
             // Additionally, disable the optimization for a few corner cases that are
             // unrealistic and inconvenient.
@@ -1750,7 +1831,8 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
             // should use one `glBlitFramebuffer` call with both aspects if they want to resolve
             // both.
             canResolveWithSubpass =
-                blitArea == renderPassCommands.getRenderArea() &&
+                blitArea.encloses(renderPassCommands.getRenderArea()) &&
+                renderPassCommands.canGrowRenderArea(blitArea) &&
                 (resolvesAllAspects ||
                  renderer->getFeatures().supportsDepthStencilIndependentResolveNone.enabled) &&
                 !renderPassDesc.hasDepthStencilResolveAttachment() &&
@@ -1758,6 +1840,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         }
         if (canResolveWithSubpass)
         {
+            contextVk->getStartedRenderPassCommands().growRenderArea(contextVk, blitArea);
             return resolveDepthStencilWithSubpass(contextVk, params, resolveAspects);
         }
 
@@ -2094,6 +2177,18 @@ angle::Result FramebufferVk::updateFragmentShadingRateAttachment(
     return angle::Result::Continue;
 }
 
+const gl::FoveationState *FramebufferVk::getFramebufferFoveationState(
+    const gl::FoveationState &noFoveationState) const
+{
+    ASSERT(mState.isFoveationEnabled());
+    if (mBackbuffer != nullptr &&
+        mBackbuffer->getPreTransform() != VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR)
+    {
+        return &noFoveationState;
+    }
+    return &mState.getFoveationState();
+}
+
 angle::Result FramebufferVk::updateFoveationState(ContextVk *contextVk,
                                                   const gl::FoveationState &newFoveationState,
                                                   const gl::Extents &foveatedAttachmentSize)
@@ -2111,7 +2206,8 @@ angle::Result FramebufferVk::updateFoveationState(ContextVk *contextVk,
     }
 
     // Update state after the possible failure point.
-    mFoveationState = newFoveationState;
+    mFoveationState         = newFoveationState;
+    mFoveatedAttachmentSize = foveatedAttachmentSize;
     mCurrentFramebufferDesc.updateFragmentShadingRate(serial);
     // mRenderPassDesc will be updated later in updateRenderPassDesc() in case if
     // mCurrentFramebufferDesc was changed.
@@ -2651,6 +2747,7 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
     // Cache new foveation state, if any
     const gl::FoveationState *newFoveationState = nullptr;
     gl::Extents foveatedAttachmentSize;
+    const gl::FoveationState noFoveationState;
 
     // For any updated attachments we'll update their Serials below
     ASSERT(dirtyBits.any());
@@ -2690,7 +2787,7 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
                 // This dirty bit is set iff the framebuffer itself is foveated
                 ASSERT(mState.isFoveationEnabled());
 
-                newFoveationState      = &mState.getFoveationState();
+                newFoveationState      = getFramebufferFoveationState(noFoveationState);
                 foveatedAttachmentSize = mState.getExtents();
                 break;
             default:
@@ -2726,6 +2823,14 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
                     foveatedAttachmentSize = attachment->getSize();
                 }
 
+                // When the window surface is resized or rotated, the fragment shading rate map of
+                // a foveated default framebuffer is regenerated.
+                if (mState.isDefault() && mState.isFoveationEnabled())
+                {
+                    newFoveationState      = getFramebufferFoveationState(noFoveationState);
+                    foveatedAttachmentSize = mState.getExtents();
+                }
+
                 // Window system framebuffer only have one color attachment and its property should
                 // never change unless via DIRTY_BIT_DRAW_BUFFERS bit.
                 if (!mState.isDefault())
@@ -2769,7 +2874,8 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
         updateLayerCount();
     }
 
-    if (newFoveationState && mFoveationState != *newFoveationState)
+    if (newFoveationState && (mFoveationState != *newFoveationState ||
+                              mFoveatedAttachmentSize != foveatedAttachmentSize))
     {
         ANGLE_TRY(updateFoveationState(contextVk, *newFoveationState, foveatedAttachmentSize));
     }
@@ -3295,6 +3401,12 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
             ASSERT(mCurrentFramebuffer.valid());
             framebufferHandle.setHandle(mCurrentFramebuffer.getHandle());
         }
+        else if (mCurrentFramebufferDesc.hasFragmentShadingRateAttachment())
+        {
+            // The framebuffers cached by WindowSurfaceVk don't include the fragment shading rate
+            // attachment of a foveated default framebuffer.  The framebuffer is left invalid, so
+            // that one is created from |unpackedAttachments| when the render pass is finalized.
+        }
         else
         {
             const vk::RenderPass *compatibleRenderPass = nullptr;
@@ -3696,7 +3808,7 @@ void FramebufferVk::clearWithCommand(ContextVk *contextVk,
     return;
 }
 
-void FramebufferVk::clearWithLoadOp(ContextVk *contextVk)
+void FramebufferVk::clearWithLoadOp(ContextVk *contextVk, vk::ClearValuesArray *clears)
 {
     vk::RenderPassCommandBufferHelper *renderPassCommands =
         &contextVk->getStartedRenderPassCommands();
@@ -3705,7 +3817,7 @@ void FramebufferVk::clearWithLoadOp(ContextVk *contextVk)
     vk::PackedAttachmentIndex colorIndexVk(0);
     for (size_t colorIndexGL : mState.getColorAttachmentsMask())
     {
-        if (!mDeferredClears.test(colorIndexGL))
+        if (!clears->test(colorIndexGL))
         {
             ++colorIndexVk;
             continue;
@@ -3713,30 +3825,30 @@ void FramebufferVk::clearWithLoadOp(ContextVk *contextVk)
 
         ASSERT(!renderPassCommands->hasAnyColorAccess(colorIndexVk));
 
-        renderPassCommands->updateRenderPassColorClear(colorIndexVk, mDeferredClears[colorIndexGL]);
+        renderPassCommands->updateRenderPassColorClear(colorIndexVk, (*clears)[colorIndexGL]);
 
-        mDeferredClears.reset(colorIndexGL);
+        clears->reset(colorIndexGL);
 
         ++colorIndexVk;
     }
 
     VkClearValue dsClearValue         = {};
-    dsClearValue.depthStencil.depth   = mDeferredClears.getDepthValue();
-    dsClearValue.depthStencil.stencil = mDeferredClears.getStencilValue();
+    dsClearValue.depthStencil.depth   = clears->getDepthValue();
+    dsClearValue.depthStencil.stencil = clears->getStencilValue();
     VkImageAspectFlags dsAspects      = 0;
 
-    if (mDeferredClears.testDepth())
+    if (clears->testDepth())
     {
         ASSERT(!renderPassCommands->hasAnyDepthAccess());
         dsAspects |= VK_IMAGE_ASPECT_DEPTH_BIT;
-        mDeferredClears.reset(vk::kUnpackedDepthIndex);
+        clears->reset(vk::kUnpackedDepthIndex);
     }
 
-    if (mDeferredClears.testStencil())
+    if (clears->testStencil())
     {
         ASSERT(!renderPassCommands->hasAnyStencilAccess());
         dsAspects |= VK_IMAGE_ASPECT_STENCIL_BIT;
-        mDeferredClears.reset(vk::kUnpackedStencilIndex);
+        clears->reset(vk::kUnpackedStencilIndex);
     }
 
     if (dsAspects != 0)
@@ -3784,6 +3896,12 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
     ASSERT(mCurrentFramebufferDesc.hasFragmentShadingRateAttachment() ==
            mRenderPassDesc.hasFragmentShadingAttachment());
 
+    // Attachments whose load is skipped due to an invalidate in a previous render pass.  If the
+    // render area grows beyond the invalidated area, the render pass will load them after all.
+    gl::DrawBufferMask colorLoadSkippedMask;
+    bool depthLoadSkipped   = false;
+    bool stencilLoadSkipped = false;
+
     // Color attachments.
     const auto &colorRenderTargets = mRenderTargetCache.getColors();
     vk::PackedAttachmentIndex colorIndexVk(0);
@@ -3807,9 +3925,16 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
         }
         else
         {
-            const vk::RenderPassLoadOp loadOp = colorRenderTarget->hasDefinedContent()
-                                                    ? vk::RenderPassLoadOp::Load
-                                                    : vk::RenderPassLoadOp::DontCare;
+            vk::RenderPassLoadOp loadOp = colorRenderTarget->hasDefinedContent()
+                                              ? vk::RenderPassLoadOp::Load
+                                              : vk::RenderPassLoadOp::DontCare;
+            if (loadOp == vk::RenderPassLoadOp::Load &&
+                IsRenderAreaInvalidated(colorRenderTarget, colorRenderTarget->getInvalidatedArea(),
+                                        renderArea))
+            {
+                loadOp = vk::RenderPassLoadOp::DontCare;
+                colorLoadSkippedMask.set(colorIndexGL);
+            }
 
             renderPassAttachmentOps.setOps(colorIndexVk, loadOp, storeOp);
             packedClearValues.storeColor(colorIndexVk, kUninitializedClearValue);
@@ -3884,6 +4009,25 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
             stencilLoadOp = vk::RenderPassLoadOp::DontCare;
         }
 
+        // Similarly, if the data was previously discarded only within an area that encloses the
+        // render area, there's nothing to load.
+        const angle::Format &format = depthStencilRenderTarget->getImageIntendedFormat();
+        if (depthLoadOp == vk::RenderPassLoadOp::Load && format.depthBits != 0 &&
+            IsRenderAreaInvalidated(depthStencilRenderTarget,
+                                    depthStencilRenderTarget->getInvalidatedArea(), renderArea))
+        {
+            depthLoadOp      = vk::RenderPassLoadOp::DontCare;
+            depthLoadSkipped = true;
+        }
+        if (stencilLoadOp == vk::RenderPassLoadOp::Load && format.stencilBits != 0 &&
+            IsRenderAreaInvalidated(depthStencilRenderTarget,
+                                    depthStencilRenderTarget->getInvalidatedStencilArea(),
+                                    renderArea))
+        {
+            stencilLoadOp      = vk::RenderPassLoadOp::DontCare;
+            stencilLoadSkipped = true;
+        }
+
         // If depth/stencil image is transient, no need to store its data at the end of the render
         // pass.
         if (depthStencilRenderTarget->isImageTransient())
@@ -3918,7 +4062,6 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
                                                 kUninitializedClearValue);
         }
 
-        const angle::Format &format = depthStencilRenderTarget->getImageIntendedFormat();
         // If the format we picked has stencil but user did not ask for it due to hardware
         // limitations, use DONT_CARE for load/store. The same logic for depth follows.
         if (format.stencilBits == 0)
@@ -4010,11 +4153,16 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
     // If deferred clears were used in the render pass, the render area must cover the whole
     // framebuffer.
     ASSERT(!hasDeferredClears || renderArea == getRotatedCompleteRenderArea(contextVk));
+    // An invalidated area never covers the whole framebuffer (that would be a full invalidate), so
+    // loads are never skipped together with deferred clears.
+    ASSERT(!hasDeferredClears ||
+           (colorLoadSkippedMask.none() && !depthLoadSkipped && !stencilLoadSkipped));
 
     ANGLE_TRY(contextVk->beginNewRenderPass(
         std::move(framebuffer), renderArea, mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
         depthStencilAttachmentIndex, packedClearValues, commandBufferOut));
     mLastRenderPassQueueSerial = contextVk->getStartedRenderPassCommands().getQueueSerial();
+    contextVk->onFramebufferStartedRenderPass(mCurrentFramebufferDesc);
 
     // Add the images to the renderpass tracking list (through onColorDraw).
     vk::PackedAttachmentIndex colorAttachmentIndex(0);
@@ -4023,6 +4171,11 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
         RenderTargetVk *colorRenderTarget = colorRenderTargets[colorIndexGL];
         colorRenderTarget->onColorDraw(contextVk, mCurrentFramebufferDesc.getLayerCount(),
                                        colorAttachmentIndex);
+        if (colorLoadSkippedMask.test(colorIndexGL))
+        {
+            contextVk->getStartedRenderPassCommands().onColorLoadSkipped(
+                colorAttachmentIndex, colorRenderTarget->getInvalidatedArea());
+        }
         ++colorAttachmentIndex;
     }
 
@@ -4033,6 +4186,16 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
         // endRenderPass.  The actual layout determination is also deferred until the same time.
         depthStencilRenderTarget->onDepthStencilDraw(contextVk,
                                                      mCurrentFramebufferDesc.getLayerCount());
+        if (depthLoadSkipped)
+        {
+            contextVk->getStartedRenderPassCommands().onDepthLoadSkipped(
+                depthStencilRenderTarget->getInvalidatedArea());
+        }
+        if (stencilLoadSkipped)
+        {
+            contextVk->getStartedRenderPassCommands().onStencilLoadSkipped(
+                depthStencilRenderTarget->getInvalidatedStencilArea());
+        }
     }
 
     const bool anyUnresolve = unresolveColorMask.any() || unresolveDepth || unresolveStencil;
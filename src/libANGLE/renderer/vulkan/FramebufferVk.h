@@ -152,6 +152,13 @@ class FramebufferVk : public FramebufferImpl
     void releaseCurrentFramebuffer(ContextVk *contextVk);
 
     const QueueSerial &getLastRenderPassQueueSerial() const { return mLastRenderPassQueueSerial; }
+    const vk::FramebufferDesc &getFramebufferDesc() const { return mCurrentFramebufferDesc; }
+    // Makes the render pass started by another framebuffer with the same attachments this
+    // framebuffer's render pass.
+    void onContinueStartedRenderPass(const QueueSerial &renderPassQueueSerial)
+    {
+        mLastRenderPassQueueSerial = renderPassQueueSerial;
+    }
 
     bool hasAnyExternalAttachments() const { return mIsExternalColorAttachments.any(); }
 
@@ -278,7 +285,7 @@ class FramebufferVk : public FramebufferImpl
                           const gl::Rectangle &scissoredRenderArea,
                           ClearWithCommand behavior,
                           vk::ClearValuesArray *clears);
-    void clearWithLoadOp(ContextVk *contextVk);
+    void clearWithLoadOp(ContextVk *contextVk, vk::ClearValuesArray *clears);
     void updateActiveColorMasks(size_t colorIndex, bool r, bool g, bool b, bool a);
     void updateRenderPassDesc(ContextVk *contextVk);
     angle::Result updateColorAttachment(const gl::Context *context, uint32_t colorIndex);
@@ -328,6 +335,10 @@ class FramebufferVk : public FramebufferImpl
     angle::Result updateFragmentShadingRateAttachment(ContextVk *contextVk,
                                                       const gl::FoveationState &foveationState,
                                                       const gl::Extents &foveatedAttachmentSize);
+    // Foveation of the default framebuffer is not applied to pre-rotated swapchains, as the
+    // fragment shading rate map would need to be rotated as well.
+    const gl::FoveationState *getFramebufferFoveationState(
+        const gl::FoveationState &noFoveationState) const;
     angle::Result updateFoveationState(ContextVk *contextVk,
                                        const gl::FoveationState &newFoveationState,
                                        const gl::Extents &foveatedAttachmentSize);
@@ -375,6 +386,7 @@ class FramebufferVk : public FramebufferImpl
     bool mIsYUVResolve;
 
     gl::FoveationState mFoveationState;
+    gl::Extents mFoveatedAttachmentSize;
     vk::ImageHelper mFragmentShadingRateImage;
     vk::ImageViewHelper mFragmentShadingRateImageView;
 
@@ -619,5 +619,53 @@ void MemoryReport::logMemoryReportStats() const
                << importedMemoryMax << ")";
     }
 }
+
+void MemoryReport::logSmallImagePoolStats(VkDeviceSize blockBytes,
+                                          VkDeviceSize allocationBytes) const
+{
+    ASSERT(allocationBytes <= blockBytes);
+    INFO() << std::right << "Small image pools:       Allocated=" << std::setw(10) << blockBytes
+           << ";  Used=" << std::setw(10) << allocationBytes << ";  Unused=" << std::setw(10)
+           << blockBytes - allocationBytes;
+}
+
+void MemoryReport::onLazilyAllocatedMemoryAlloc(void *handle,
+                                                VkDeviceMemory memory,
+                                                VkDeviceSize size)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMemoryReportMutex);
+    ASSERT(mLazilyAllocatedMemory.find(handle) == mLazilyAllocatedMemory.end());
+    mLazilyAllocatedMemory[handle] = {memory, size};
+}
+
+void MemoryReport::onLazilyAllocatedMemoryDealloc(void *handle)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMemoryReportMutex);
+    mLazilyAllocatedMemory.erase(handle);
+}
+
+void MemoryReport::logLazilyAllocatedMemoryStats(VkDevice device) const
+{
+    std::unique_lock<angle::SimpleMutex> lock(mMemoryReportMutex);
+
+    VkDeviceSize allocatedMemory = 0;
+    VkDeviceSize committedMemory = 0;
+    // Suballocations may share a VkDeviceMemory, whose commitment must only be counted once.
+    angle::HashSet<VkDeviceMemory> queriedMemory;
+    for (const auto &it : mLazilyAllocatedMemory)
+    {
+        allocatedMemory += it.second.size;
+        if (queriedMemory.insert(it.second.memory).second)
+        {
+            VkDeviceSize memoryCommitment = 0;
+            vkGetDeviceMemoryCommitment(device, it.second.memory, &memoryCommitment);
+            committedMemory += memoryCommitment;
+        }
+    }
+
+    INFO() << std::right << "Lazily allocated memory: Allocated=" << std::setw(10)
+           << allocatedMemory << " (count=" << mLazilyAllocatedMemory.size()
+           << ");  Committed=" << std::setw(10) << committedMemory;
+}
 }  // namespace vk
 }  // namespace rx
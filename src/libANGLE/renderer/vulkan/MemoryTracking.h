@@ -107,6 +107,16 @@ class MemoryReport final : angle::NonCopyable
     MemoryReport();
     void processCallback(const VkDeviceMemoryReportCallbackDataEXT &callbackData, bool logCallback);
     void logMemoryReportStats() const;
+    // The memory of the small image pools that is allocated from the driver but not used by any
+    // image is reported as unused.
+    void logSmallImagePoolStats(VkDeviceSize blockBytes, VkDeviceSize allocationBytes) const;
+
+    // Lazily allocated memory (used by transient attachments) is only backed by the driver if
+    // needed, which on tiling GPUs should be never.  The device memory of such allocations is
+    // tracked so that the size that is actually committed can be reported.
+    void onLazilyAllocatedMemoryAlloc(void *handle, VkDeviceMemory memory, VkDeviceSize size);
+    void onLazilyAllocatedMemoryDealloc(void *handle);
+    void logLazilyAllocatedMemoryStats(VkDevice device) const;
 
   private:
     struct MemorySizes
@@ -123,6 +133,13 @@ class MemoryReport final : angle::NonCopyable
     VkDeviceSize mCurrentTotalImportedMemory;
     VkDeviceSize mMaxTotalImportedMemory;
     angle::HashMap<uint64_t, int> mUniqueIDCounts;
+
+    struct LazilyAllocatedMemory
+    {
+        VkDeviceMemory memory;
+        VkDeviceSize size;
+    };
+    angle::HashMap<void *, LazilyAllocatedMemory> mLazilyAllocatedMemory;
 };
 }  // namespace vk
 }  // namespace rx
@@ -13,12 +13,14 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include "common/angle_version_info.h"
 #include "common/string_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/ProgramPipelineVk.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
+#include "libANGLE/renderer/vulkan/SamplerVk.h"
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include "libANGLE/renderer/vulkan/TransformFeedbackVk.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -32,6 +34,13 @@ namespace
 // Limit decompressed vulkan pipelines to 10MB per program.
 static constexpr size_t kMaxLocalPipelineCacheSize = 10 * 1024 * 1024;
 
+// The list of graphics pipelines recorded at draw time is versioned with the layout of
+// GraphicsPipelineDesc, which is otherwise stored as raw bytes.
+constexpr uint32_t kRecordedGraphicsPipelinesVersion = 1;
+// Limit the number of recorded graphics pipelines per program.  Programs drawn with many different
+// states are unlikely to benefit from warming up all of them.
+constexpr size_t kMaxRecordedGraphicsPipelines = 16;
+
 bool ValidateTransformedSpirV(vk::ErrorContext *context,
                               const gl::ShaderBitSet &linkedShaderStages,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -59,6 +68,24 @@ bool ValidateTransformedSpirV(vk::ErrorContext *context,
     return true;
 }
 
+// Packs the options that affect the output of SpvTransformSpirvCode, except for the shader type.
+uint32_t GetSpvTransformOptionsKey(const SpvTransformOptions &options)
+{
+    uint32_t key = options.ditherControl;
+    key          = key << 1 | options.isLastPreFragmentStage;
+    key          = key << 1 | options.isTransformFeedbackStage;
+    key          = key << 1 | options.isTransformFeedbackEmulated;
+    key          = key << 1 | options.isMultisampledFramebufferFetch;
+    key          = key << 1 | options.enableSampleShading;
+    key          = key << 1 | options.validate;
+    key          = key << 1 | options.useSpirvVaryingPrecisionFixer;
+    key          = key << 1 | options.removeDepthInput;
+    key          = key << 1 | options.removeStencilInput;
+    key          = key << 1 | options.roundOutputAfterDithering;
+    return key;
+}
+static_assert(sizeof(SpvTransformOptions::ditherControl) * 8 + 10 <= 32, "Key size check failed");
+
 uint32_t GetInterfaceBlockArraySize(const std::vector<gl::InterfaceBlock> &blocks,
                                     uint32_t bufferIndex)
 {
@@ -233,6 +260,11 @@ void GetPipelineCacheData(ContextVk *contextVk,
     }
 }
 
+// Descriptor sets with at most this many descriptors are pushed with vkCmdPushDescriptorSetKHR if
+// possible.  For such small sets, hashing the descriptor set description and looking it up in the
+// cache costs more than writing the descriptors on every bind.
+constexpr uint32_t kMaxPushDescriptorSetDescriptorCount = 16;
+
 vk::GraphicsPipelineSubset GetWarmUpSubset(const angle::FeaturesVk &features)
 {
     // Only build the shaders subset of the pipeline if VK_EXT_graphics_pipeline_library is
@@ -241,14 +273,14 @@ vk::GraphicsPipelineSubset GetWarmUpSubset(const angle::FeaturesVk &features)
                                                             : vk::GraphicsPipelineSubset::Complete;
 }
 
-angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
-                                              const ShaderInterfaceVariableInfoMap &variableInfoMap,
-                                              const vk::WriteDescriptorDescs &writeDescriptorDescs,
-                                              UpdateDescriptorSetsBuilder *updateBuilder,
-                                              const gl::ProgramExecutable &executable,
-                                              const gl::ActiveTextureArray<TextureVk *> &textures,
-                                              const gl::SamplerBindingVector &samplers,
-                                              VkDescriptorSet descriptorSet)
+// Fills in the pImageInfo or pTexelBufferView arrays of the texture descriptor set writes, which
+// have one entry per binding.
+angle::Result WriteTexturesDescriptors(vk::ErrorContext *context,
+                                       const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                       const gl::ProgramExecutable &executable,
+                                       const gl::ActiveTextureArray<TextureVk *> &textures,
+                                       const gl::SamplerBindingVector &samplers,
+                                       VkWriteDescriptorSet *writeDescriptorSets)
 {
     vk::Renderer *renderer = context->getRenderer();
 
@@ -257,31 +289,6 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
     const std::vector<gl::LinkedUniform> &uniforms      = executable.getUniforms();
     const gl::ActiveTextureTypeArray &textureTypes      = executable.getActiveSamplerTypes();
 
-    // Allocate VkWriteDescriptorSet and initialize the data structure
-    VkWriteDescriptorSet *writeDescriptorSets =
-        updateBuilder->allocWriteDescriptorSets(static_cast<uint32_t>(writeDescriptorDescs.size()));
-    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
-    {
-        ASSERT(writeDescriptorDescs[writeIndex].descriptorCount > 0);
-
-        VkWriteDescriptorSet &writeSet = writeDescriptorSets[writeIndex];
-        writeSet.descriptorCount       = writeDescriptorDescs[writeIndex].descriptorCount;
-        writeSet.descriptorType =
-            static_cast<VkDescriptorType>(writeDescriptorDescs[writeIndex].descriptorType);
-        writeSet.dstArrayElement  = 0;
-        writeSet.dstBinding       = writeIndex;
-        writeSet.dstSet           = descriptorSet;
-        writeSet.pBufferInfo      = nullptr;
-        writeSet.pImageInfo       = nullptr;
-        writeSet.pNext            = nullptr;
-        writeSet.pTexelBufferView = nullptr;
-        writeSet.sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        // Always allocate VkDescriptorImageInfo. In less common case that descriptorType is
-        // VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, this will not used.
-        writeSet.pImageInfo = updateBuilder->allocDescriptorImageInfos(
-            writeDescriptorDescs[writeIndex].descriptorCount);
-    }
-
     for (uint32_t samplerIndex = 0; samplerIndex < samplerBindings.size(); ++samplerIndex)
     {
         uint32_t uniformIndex = executable.getUniformIndexFromSamplerIndex(samplerIndex);
@@ -304,7 +311,8 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
         {
             GLuint textureUnit =
                 samplerBinding.getTextureUnit(samplerBoundTextureUnits, arrayElement);
-            TextureVk *textureVk = textures[textureUnit];
+            TextureVk *textureVk           = textures[textureUnit];
+            const uint32_t descriptorIndex = arrayElement + samplerUniform.getOuterArrayOffset();
 
             if (textureTypes[textureUnit] == gl::TextureType::Buffer)
             {
@@ -313,9 +321,9 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
                 ANGLE_TRY(textureVk->getBufferView(context, nullptr, &samplerBinding, false, &view,
                                                    nullptr));
 
-                VkBufferView &bufferView  = updateBuilder->allocBufferView();
-                bufferView                = view->getHandle();
-                writeSet.pTexelBufferView = &bufferView;
+                VkBufferView *bufferView =
+                    const_cast<VkBufferView *>(&writeSet.pTexelBufferView[descriptorIndex]);
+                *bufferView = view->getHandle();
             }
             else
             {
@@ -335,8 +343,8 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
                     samplerState.getSRGBDecode(), samplerUniform.isTexelFetchStaticUse(),
                     isSamplerExternalY2Y);
 
-                VkDescriptorImageInfo *imageInfo = const_cast<VkDescriptorImageInfo *>(
-                    &writeSet.pImageInfo[arrayElement + samplerUniform.getOuterArrayOffset()]);
+                VkDescriptorImageInfo *imageInfo =
+                    const_cast<VkDescriptorImageInfo *>(&writeSet.pImageInfo[descriptorIndex]);
                 imageInfo->imageLayout = renderer->getVkImageLayout(imageAccess);
                 imageInfo->imageView   = imageView.getHandle();
                 imageInfo->sampler     = samplerHelper.get().getHandle();
@@ -347,6 +355,57 @@ angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
     return angle::Result::Continue;
 }
 
+void InitWriteDescriptorSet(const vk::WriteDescriptorDescs &writeDescriptorDescs,
+                            uint32_t writeIndex,
+                            VkDescriptorSet descriptorSet,
+                            VkWriteDescriptorSet *writeSet)
+{
+    ASSERT(writeDescriptorDescs[writeIndex].descriptorCount > 0);
+
+    writeSet->descriptorCount = writeDescriptorDescs[writeIndex].descriptorCount;
+    writeSet->descriptorType =
+        static_cast<VkDescriptorType>(writeDescriptorDescs[writeIndex].descriptorType);
+    writeSet->dstArrayElement  = 0;
+    writeSet->dstBinding       = writeIndex;
+    writeSet->dstSet           = descriptorSet;
+    writeSet->pBufferInfo      = nullptr;
+    writeSet->pImageInfo       = nullptr;
+    writeSet->pNext            = nullptr;
+    writeSet->pTexelBufferView = nullptr;
+    writeSet->sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+}
+
+angle::Result UpdateFullTexturesDescriptorSet(vk::ErrorContext *context,
+                                              const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                              const vk::WriteDescriptorDescs &writeDescriptorDescs,
+                                              UpdateDescriptorSetsBuilder *updateBuilder,
+                                              const gl::ProgramExecutable &executable,
+                                              const gl::ActiveTextureArray<TextureVk *> &textures,
+                                              const gl::SamplerBindingVector &samplers,
+                                              VkDescriptorSet descriptorSet)
+{
+    // Allocate VkWriteDescriptorSet and initialize the data structure
+    VkWriteDescriptorSet *writeDescriptorSets =
+        updateBuilder->allocWriteDescriptorSets(static_cast<uint32_t>(writeDescriptorDescs.size()));
+    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
+    {
+        VkWriteDescriptorSet &writeSet = writeDescriptorSets[writeIndex];
+        InitWriteDescriptorSet(writeDescriptorDescs, writeIndex, descriptorSet, &writeSet);
+        if (writeSet.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER)
+        {
+            writeSet.pTexelBufferView = updateBuilder->allocBufferViews(writeSet.descriptorCount);
+        }
+        else
+        {
+            writeSet.pImageInfo =
+                updateBuilder->allocDescriptorImageInfos(writeSet.descriptorCount);
+        }
+    }
+
+    return WriteTexturesDescriptors(context, variableInfoMap, executable, textures, samplers,
+                                    writeDescriptorSets);
+}
+
 void UpdateBufferWithSharedCacheKey(const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding,
                                     const vk::SharedDescriptorSetCacheKey &sharedCacheKey)
 {
@@ -421,7 +480,17 @@ class ProgramExecutableVk::WarmUpTaskCommon : public vk::ErrorContext, public Li
 
     virtual void removeFailedPipeline() {}
 
+    bool wasSkipped() const { return mSkipped; }
+
   protected:
+    // Called before warming up; returns true if the task should do nothing because the program is
+    // being deleted.
+    bool skipIfCancelled()
+    {
+        mSkipped = mExecutableVk->mWarmUpCancellation.isCancelled();
+        return mSkipped;
+    }
+
     void mergeProgramExecutablePipelineCacheToRenderer()
     {
         angle::Result mergeResult = mExecutableVk->mergePipelineCacheToRenderer(this);
@@ -447,6 +516,8 @@ class ProgramExecutableVk::WarmUpTaskCommon : public vk::ErrorContext, public Li
     const char *mErrorFile     = nullptr;
     const char *mErrorFunction = nullptr;
     unsigned int mErrorLine    = 0;
+
+    bool mSkipped = false;
 };
 
 class ProgramExecutableVk::WarmUpComputeTask : public WarmUpTaskCommon
@@ -462,6 +533,11 @@ class ProgramExecutableVk::WarmUpComputeTask : public WarmUpTaskCommon
 
     void operator()() override
     {
+        if (skipIfCancelled())
+        {
+            return;
+        }
+
         angle::Result result = mExecutableVk->warmUpComputePipelineCache(this, mPipelineRobustness,
                                                                          mPipelineProtectedAccess);
         ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
@@ -501,11 +577,14 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
     void operator()() override
     {
-        angle::Result result = mExecutableVk->warmUpGraphicsPipelineCache(
-            this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset,
-            mGraphicsPipelineDesc, mProgramInfo, mCompletePipelines, mShadersPipelines,
-            mCompatibleRenderPass->get(), mWarmUpPipelineHelper);
-        ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
+        if (!skipIfCancelled())
+        {
+            angle::Result result = mExecutableVk->warmUpGraphicsPipelineCache(
+                this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset,
+                mGraphicsPipelineDesc, mProgramInfo, mCompletePipelines, mShadersPipelines,
+                mCompatibleRenderPass->get(), mWarmUpPipelineHelper);
+            ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
+        }
 
         // Release reference to shared renderpass. If this is the last reference -
         // 1. merge ProgramExecutableVk's pipeline cache into the Renderer's cache
@@ -529,7 +608,7 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
         // function must NOT be called from the task itself, as the cache is
         // not internally synchronized, which is why there was a placeholder
         // pipeline in the first place.
-        ASSERT(mErrorCode != VK_SUCCESS);
+        ASSERT(mErrorCode != VK_SUCCESS || mSkipped);
         if (mPipelineSubset == vk::GraphicsPipelineSubset::Complete)
         {
             mCompletePipelines.remove(mGraphicsPipelineDesc);
@@ -590,6 +669,9 @@ void ShaderInfo::initShaderFromProgram(gl::ShaderType shaderType,
 {
     mSpirvBlobs[shaderType] = programShaderInfo.mSpirvBlobs[shaderType];
     mIsInitialized          = true;
+
+    std::lock_guard<angle::SimpleMutex> lock(mTransformedShaderModulesMutex);
+    mTransformedShaderModules[shaderType].clear();
 }
 
 void ShaderInfo::clear()
@@ -599,6 +681,56 @@ void ShaderInfo::clear()
         spirvBlob.clear();
     }
     mIsInitialized = false;
+
+    clearTransformedShaderModules();
+}
+
+void ShaderInfo::clearTransformedShaderModules()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mTransformedShaderModulesMutex);
+    for (angle::HashMap<uint32_t, vk::ShaderModulePtr> &shaderModules : mTransformedShaderModules)
+    {
+        shaderModules.clear();
+    }
+}
+
+angle::Result ShaderInfo::getTransformedShaderModule(
+    vk::ErrorContext *context,
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    vk::ShaderModulePtr *shaderModuleOut) const
+{
+    ASSERT(valid());
+
+    const uint32_t key = GetSpvTransformOptionsKey(options);
+    angle::HashMap<uint32_t, vk::ShaderModulePtr> &shaderModules =
+        mTransformedShaderModules[options.shaderType];
+
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mTransformedShaderModulesMutex);
+        auto iter = shaderModules.find(key);
+        if (iter != shaderModules.end())
+        {
+            *shaderModuleOut = iter->second;
+            return angle::Result::Continue;
+        }
+    }
+
+    // Transform outside the lock; if another thread races to create the same module, the first
+    // one to finish is kept.
+    angle::spirv::Blob transformedSpirvBlob;
+    ANGLE_TRY(SpvTransformSpirvCode(options, variableInfoMap, mSpirvBlobs[options.shaderType],
+                                    &transformedSpirvBlob));
+    ++context->getPerfCounters().spirvTransforms;
+
+    // Identical shaders in other programs produce the same SPIR-V, and share the module.
+    vk::ShaderModulePtr shaderModule;
+    ANGLE_TRY(context->getRenderer()->getShaderModuleCache().getShaderModule(
+        context, transformedSpirvBlob, &shaderModule));
+
+    std::lock_guard<angle::SimpleMutex> lock(mTransformedShaderModulesMutex);
+    *shaderModuleOut = shaderModules.emplace(key, std::move(shaderModule)).first->second;
+    return angle::Result::Continue;
 }
 
 void ShaderInfo::load(gl::BinaryInputStream *stream)
@@ -638,11 +770,6 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
                                        ProgramTransformOptions optionBits,
                                        const ShaderInterfaceVariableInfoMap &variableInfoMap)
 {
-    const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
-    const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
-    gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
-    angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
-
     SpvTransformOptions options;
     options.shaderType               = shaderType;
     options.isLastPreFragmentStage   = isLastPreFragmentStage;
@@ -663,10 +790,8 @@ angle::Result ProgramInfo::initProgram(vk::ErrorContext *context,
     options.ditherControl = (shaderType == gl::ShaderType::Fragment) ? optionBits.ditherControl : 0;
     options.roundOutputAfterDithering = context->getFeatures().roundOutputAfterDithering.enabled;
 
-    ANGLE_TRY(
-        SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
-    ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob.data(),
-                                   transformedSpirvBlob.size() * sizeof(uint32_t)));
+    ANGLE_TRY(shaderInfo.getTransformedShaderModule(context, options, variableInfoMap,
+                                                    &mShaders[shaderType]));
 
     mProgramHelper.setShader(shaderType, mShaders[shaderType]);
 
@@ -723,12 +848,20 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     }
     mImmutableSamplersMaxDescriptorCount = 1;
     mImmutableSamplerIndexMap.clear();
+    mImmutableTextureSamplerSerials.clear();
 
     for (vk::DescriptorSetPointer &descriptorSet : mDescriptorSets)
     {
         descriptorSet.reset();
     }
     mValidDescriptorSetIndices.reset();
+    mLastTextureDescriptorSetDesc.resize(0);
+
+    mPushDescriptorSetIndex = DescriptorSetIndex::InvalidEnum;
+    mPushDescriptorWrites.clear();
+    mPushDescriptorImageInfos.clear();
+    mPushDescriptorBufferInfos.clear();
+    mPushDescriptorBufferViews.clear();
 
     for (vk::DynamicDescriptorPoolPointer &pool : mDynamicDescriptorPools)
     {
@@ -755,6 +888,7 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     mCompleteGraphicsPipelines.clear();
     mShadersGraphicsPipelines.clear();
     mGraphicsProgramInfos.clear();
+    mGraphicsPipelineCreationCount = 0;
 
     mComputePipelines.release(contextVk);
     mComputeProgramInfo.release(contextVk);
@@ -777,7 +911,7 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
 
 angle::Result ProgramExecutableVk::initializePipelineCache(vk::ErrorContext *context,
                                                            bool compressed,
-                                                           const std::vector<uint8_t> &pipelineData)
+                                                           angle::Span<const uint8_t> pipelineData)
 {
     ASSERT(!mPipelineCache.valid());
 
@@ -787,11 +921,10 @@ angle::Result ProgramExecutableVk::initializePipelineCache(vk::ErrorContext *con
     angle::MemoryBuffer uncompressedData;
     if (compressed)
     {
-        if (!angle::DecompressBlob(dataPointer, dataSize, kMaxLocalPipelineCacheSize,
-                                   &uncompressedData))
-        {
-            return angle::Result::Stop;
-        }
+        ANGLE_VK_CHECK(context,
+                       angle::DecompressBlob(dataPointer, dataSize, kMaxLocalPipelineCacheSize,
+                                             &uncompressedData),
+                       VK_ERROR_INITIALIZATION_FAILED);
         dataSize    = uncompressedData.size();
         dataPointer = uncompressedData.data();
     }
@@ -825,10 +958,10 @@ angle::Result ProgramExecutableVk::ensurePipelineCacheInitialized(vk::ErrorConte
     return angle::Result::Continue;
 }
 
-angle::Result ProgramExecutableVk::load(ContextVk *contextVk,
-                                        bool isSeparable,
-                                        gl::BinaryInputStream *stream,
-                                        egl::CacheGetResult *resultOut)
+void ProgramExecutableVk::load(ContextVk *contextVk,
+                               bool isSeparable,
+                               gl::BinaryInputStream *stream,
+                               LoadState *loadStateOut)
 {
     mVariableInfoMap.load(stream);
     mOriginalShaderInfo.load(stream);
@@ -840,37 +973,51 @@ angle::Result ProgramExecutableVk::load(ContextVk *contextVk,
     }
 
     // Deserializes required uniform block memory sizes
-    gl::ShaderMap<size_t> requiredBufferSize;
-    stream->readPackedEnumMap(&requiredBufferSize);
+    stream->readPackedEnumMap(&loadStateOut->requiredBufferSize);
 
     if (!isSeparable && !contextVk->getFeatures().preferGlobalPipelineCache.enabled)
     {
         size_t compressedPipelineDataSize = 0;
         stream->readInt<size_t>(&compressedPipelineDataSize);
 
-        std::vector<uint8_t> compressedPipelineData(compressedPipelineDataSize);
         if (compressedPipelineDataSize > 0)
         {
-            bool compressedData = false;
-            stream->readBool(&compressedData);
-            stream->readBytes(compressedPipelineData);
-            // Initialize the pipeline cache based on cached data.
-            ANGLE_TRY(initializePipelineCache(contextVk, compressedData, compressedPipelineData));
+            stream->readBool(&loadStateOut->pipelineDataCompressed);
+            angle::Span<const uint8_t> pipelineData =
+                stream->readBytesInPlace(compressedPipelineDataSize);
+            if (stream->getStorage())
+            {
+                loadStateOut->pipelineDataStorage = stream->getStorage();
+            }
+            else
+            {
+                loadStateOut->pipelineDataCopy.assign(pipelineData.begin(), pipelineData.end());
+                pipelineData = loadStateOut->pipelineDataCopy;
+            }
+            loadStateOut->pipelineData = pipelineData;
         }
     }
 
-    // Initialize and resize the mDefaultUniformBlocks' memory
-    ANGLE_TRY(resizeUniformBlockMemory(contextVk, requiredBufferSize));
-
     resetLayout(contextVk);
-    ANGLE_TRY(createPipelineLayout(contextVk, &contextVk->getPipelineLayoutCache(),
-                                   &contextVk->getDescriptorSetLayoutCache(), nullptr));
+}
 
-    ANGLE_TRY(initializeDescriptorPools(contextVk, &contextVk->getDescriptorSetLayoutCache(),
-                                        &contextVk->getMetaDescriptorPools()));
+angle::Result ProgramExecutableVk::finishLoad(vk::ErrorContext *context,
+                                              PipelineLayoutCache *pipelineLayoutCache,
+                                              DescriptorSetLayoutCache *descriptorSetLayoutCache,
+                                              const LoadState &loadState)
+{
+    if (!loadState.pipelineData.empty())
+    {
+        // Initialize the pipeline cache based on cached data.
+        ANGLE_TRY(initializePipelineCache(context, loadState.pipelineDataCompressed,
+                                          loadState.pipelineData));
+    }
 
-    *resultOut = egl::CacheGetResult::Success;
-    return angle::Result::Continue;
+    // Initialize and resize the mDefaultUniformBlocks' memory
+    ANGLE_TRY(resizeUniformBlockMemory(context, loadState.requiredBufferSize));
+
+    return createPipelineLayout(context, pipelineLayoutCache, descriptorSetLayoutCache, nullptr,
+                                nullptr);
 }
 
 void ProgramExecutableVk::save(ContextVk *contextVk,
@@ -972,6 +1119,14 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
             *graphicsPipelineDesc, mGraphicsProgramInfos[programIndex],
             mCompleteGraphicsPipelines[programIndex], mShadersGraphicsPipelines[programIndex],
             sharedRenderPass, pipelineHelper));
+
+        // Additionally warm up the pipelines that were created at draw time in a previous run.
+        if (renderer->getFeatures().warmUpRecordedGraphicsPipelines.enabled)
+        {
+            ANGLE_TRY(addRecordedGraphicsPipelineWarmUpTasks(
+                &prepForWarmUpContext, pipelineRobustness, pipelineProtectedAccess, subset,
+                graphicsPipelineDesc, &warmUpSubTasks));
+        }
     }
 
     // If the caller hasn't provided a valid async task container, inline the warmUp tasks.
@@ -993,6 +1148,249 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
     return angle::Result::Continue;
 }
 
+angle::Result ProgramExecutableVk::getRecordedPipelinesWarmUpTasks(
+    vk::Renderer *renderer,
+    vk::PipelineRobustness pipelineRobustness,
+    vk::PipelineProtectedAccess pipelineProtectedAccess,
+    std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
+{
+    ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
+    ASSERT(renderer->getFeatures().warmUpRecordedGraphicsPipelines.enabled);
+
+    if (!mExecutable->hasLinkedShaderStage(gl::ShaderType::Vertex))
+    {
+        return angle::Result::Continue;
+    }
+
+    WarmUpTaskCommon prepForWarmUpContext(renderer);
+    ANGLE_TRY(initWarmUpPipelineCache(&prepForWarmUpContext));
+
+    return addRecordedGraphicsPipelineWarmUpTasks(
+        &prepForWarmUpContext, pipelineRobustness, pipelineProtectedAccess,
+        GetWarmUpSubset(renderer->getFeatures()), nullptr, postLinkSubTasksOut);
+}
+
+angle::Result ProgramExecutableVk::addRecordedGraphicsPipelineWarmUpTasks(
+    vk::ErrorContext *context,
+    vk::PipelineRobustness pipelineRobustness,
+    vk::PipelineProtectedAccess pipelineProtectedAccess,
+    vk::GraphicsPipelineSubset subset,
+    const vk::GraphicsPipelineDesc *defaultWarmUpDesc,
+    std::vector<std::shared_ptr<LinkSubTask>> *warmUpSubTasks)
+{
+    vk::Renderer *renderer = context->getRenderer();
+
+    loadRecordedGraphicsPipelines(renderer);
+
+    for (size_t recordedIndex = 0; recordedIndex < mRecordedGraphicsPipelines.size();
+         ++recordedIndex)
+    {
+        const RecordedGraphicsPipeline &recorded = mRecordedGraphicsPipelines[recordedIndex];
+        const uint32_t programIndex              = recorded.transformOptions.permutationIndex;
+
+        // Skip pipelines that are already being warmed up.  Recorded pipelines are unique, but
+        // they may be identical as far as |subset| is concerned.
+        auto isSamePipeline = [&](uint32_t otherProgramIndex,
+                                  const vk::GraphicsPipelineDesc &otherDesc) {
+            return programIndex == otherProgramIndex && recorded.desc.keyEqual(otherDesc, subset);
+        };
+        bool isDuplicate = defaultWarmUpDesc != nullptr && isSamePipeline(0, *defaultWarmUpDesc);
+        for (size_t otherIndex = 0; otherIndex < recordedIndex && !isDuplicate; ++otherIndex)
+        {
+            const RecordedGraphicsPipeline &other = mRecordedGraphicsPipelines[otherIndex];
+            isDuplicate = isSamePipeline(other.transformOptions.permutationIndex, other.desc);
+        }
+        if (isDuplicate)
+        {
+            continue;
+        }
+
+        ANGLE_TRY(initGraphicsShaderPrograms(context, recorded.transformOptions));
+
+        // Create a temporary compatible RenderPass, similarly to preparePipelineCacheForWarmUp.
+        vk::RenderPass compatibleRenderPass;
+        if (!context->getFeatures().preferDynamicRendering.enabled)
+        {
+            vk::AttachmentOpsArray ops;
+            RenderPassCache::InitializeOpsForCompatibleRenderPass(
+                recorded.desc.getRenderPassDesc(), &ops);
+            ANGLE_TRY(RenderPassCache::MakeRenderPass(context, recorded.desc.getRenderPassDesc(),
+                                                      ops, &compatibleRenderPass, nullptr));
+        }
+        SharedRenderPass *sharedRenderPass = new SharedRenderPass(std::move(compatibleRenderPass));
+
+        // Add a placeholder entry in GraphicsPipelineCache
+        vk::PipelineHelper *pipelineHelper = nullptr;
+        if (subset == vk::GraphicsPipelineSubset::Complete)
+        {
+            mCompleteGraphicsPipelines[programIndex].populate(recorded.desc, vk::Pipeline(),
+                                                              &pipelineHelper);
+        }
+        else
+        {
+            ASSERT(subset == vk::GraphicsPipelineSubset::Shaders);
+            mShadersGraphicsPipelines[programIndex].populate(recorded.desc, vk::Pipeline(),
+                                                             &pipelineHelper);
+        }
+
+        warmUpSubTasks->push_back(std::make_shared<WarmUpGraphicsTask>(
+            renderer, this, pipelineRobustness, pipelineProtectedAccess, subset, recorded.desc,
+            mGraphicsProgramInfos[programIndex], mCompleteGraphicsPipelines[programIndex],
+            mShadersGraphicsPipelines[programIndex], sharedRenderPass, pipelineHelper));
+    }
+
+    return angle::Result::Continue;
+}
+
+void ProgramExecutableVk::initRecordedGraphicsPipelinesKey(vk::Renderer *renderer)
+{
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    // Start with the name
+    const char *recordedPipelinesName = "ANGLE Recorded Graphics Pipelines: ";
+    hasher.Update(recordedPipelinesName, strlen(recordedPipelinesName));
+
+    // GraphicsPipelineDesc is stored as is, so the list is only valid for the same ANGLE version
+    // and the same device.
+    const char *angleVersion = angle::GetANGLEShaderProgramVersion();
+    hasher.Update(angleVersion, strlen(angleVersion));
+
+    const VkPhysicalDeviceProperties &physicalDeviceProperties =
+        renderer->getPhysicalDeviceProperties();
+    hasher.Update(&physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.vendorID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.deviceID);
+
+    // Identify the program by its shaders
+    const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs = mOriginalShaderInfo.getSpirvBlobs();
+    for (gl::ShaderType shaderType : mExecutable->getLinkedShaderStages())
+    {
+        const angle::spirv::Blob &blob = spirvBlobs[shaderType];
+        angle::UpdateHashWithValue(hasher, shaderType);
+        hasher.Update(blob.data(), blob.size() * sizeof(*blob.data()));
+    }
+
+    hasher.Final();
+    memcpy(mRecordedGraphicsPipelinesKey.data(), hasher.Digest(), angle::kBlobCacheKeyLength);
+}
+
+void ProgramExecutableVk::loadRecordedGraphicsPipelines(vk::Renderer *renderer)
+{
+    if (mRecordedGraphicsPipelinesLoaded)
+    {
+        return;
+    }
+
+    // From this point on, new draw-time pipelines are appended to the list.
+    mRecordedGraphicsPipelinesLoaded = true;
+    initRecordedGraphicsPipelinesKey(renderer);
+
+    angle::BlobCacheValue blob;
+    if (!renderer->getGlobalOps()->getBlob(mRecordedGraphicsPipelinesKey, &blob))
+    {
+        return;
+    }
+
+    gl::BinaryInputStream stream(angle::Span<const uint8_t>(blob.data(), blob.size()));
+    const uint32_t version = stream.readInt<uint32_t>();
+    const size_t count     = stream.readInt<size_t>();
+    if (stream.error() || version != kRecordedGraphicsPipelinesVersion ||
+        count > kMaxRecordedGraphicsPipelines)
+    {
+        return;
+    }
+
+    mRecordedGraphicsPipelines.resize(count);
+    for (RecordedGraphicsPipeline &recorded : mRecordedGraphicsPipelines)
+    {
+        recorded.transformOptions.permutationIndex = stream.readInt<uint32_t>();
+        stream.readBytes(angle::Span<uint8_t>(reinterpret_cast<uint8_t *>(&recorded.desc),
+                                              sizeof(recorded.desc)));
+    }
+
+    // Ignore corrupt data.
+    if (stream.error() || !stream.endOfStream())
+    {
+        WARN() << "Ignoring corrupt list of recorded graphics pipelines in the blob cache";
+        mRecordedGraphicsPipelines.clear();
+    }
+}
+
+void ProgramExecutableVk::recordGraphicsPipeline(ContextVk *contextVk,
+                                                 ProgramTransformOptions transformOptions,
+                                                 const vk::GraphicsPipelineDesc &desc)
+{
+    ASSERT(contextVk->getFeatures().warmUpRecordedGraphicsPipelines.enabled);
+
+    // Nothing to do if warm up was never attempted for this program; recording would otherwise
+    // overwrite the list stored by a previous run.
+    if (!mRecordedGraphicsPipelinesLoaded ||
+        mRecordedGraphicsPipelines.size() >= kMaxRecordedGraphicsPipelines)
+    {
+        return;
+    }
+
+    for (const RecordedGraphicsPipeline &recorded : mRecordedGraphicsPipelines)
+    {
+        if (recorded.transformOptions.permutationIndex == transformOptions.permutationIndex &&
+            recorded.desc.keyEqual(desc, vk::GraphicsPipelineSubset::Complete))
+        {
+            return;
+        }
+    }
+
+    mRecordedGraphicsPipelines.push_back({transformOptions, desc});
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(kRecordedGraphicsPipelinesVersion);
+    stream.writeInt(mRecordedGraphicsPipelines.size());
+    for (const RecordedGraphicsPipeline &recorded : mRecordedGraphicsPipelines)
+    {
+        stream.writeInt(recorded.transformOptions.permutationIndex);
+        stream.writeBytes(angle::Span<const uint8_t>(recorded.desc.getPtr<uint8_t>(),
+                                                     sizeof(recorded.desc)));
+    }
+
+    angle::MemoryBuffer blob;
+    if (!blob.resize(stream.size()))
+    {
+        return;
+    }
+    memcpy(blob.data(), stream.data(), stream.size());
+
+    contextVk->getRenderer()->getGlobalOps()->putBlob(mRecordedGraphicsPipelinesKey, blob);
+}
+
+bool ProgramExecutableVk::isRecordedGraphicsPipeline(const vk::GraphicsPipelineDesc &desc,
+                                                     uint32_t permutationIndex,
+                                                     vk::GraphicsPipelineSubset subset) const
+{
+    for (const RecordedGraphicsPipeline &recorded : mRecordedGraphicsPipelines)
+    {
+        if (recorded.transformOptions.permutationIndex == permutationIndex &&
+            recorded.desc.keyEqual(desc, subset))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+angle::Result ProgramExecutableVk::initWarmUpPipelineCache(vk::ErrorContext *context)
+{
+    // Ensure pipeline cache is initialized
+    if (context->getFeatures().preferGlobalPipelineCache.enabled)
+    {
+        // Make sure Renderer's pipeline cache is initialized
+        vk::PipelineCacheAccess unused;
+        return context->getRenderer()->getPipelineCache(context, &unused);
+    }
+
+    // Make sure ProgramExecutableVk's pipeline cache is initialized
+    return ensurePipelineCacheInitialized(context);
+}
+
 angle::Result ProgramExecutableVk::preparePipelineCacheForWarmUp(
     vk::ErrorContext *context,
     vk::PipelineRobustness pipelineRobustness,
@@ -1007,18 +1405,7 @@ angle::Result ProgramExecutableVk::preparePipelineCacheForWarmUp(
     ASSERT(renderPassOut);
     ASSERT(context->getFeatures().warmUpPipelineCacheAtLink.enabled);
 
-    // Ensure pipeline cache is initialized
-    if (context->getFeatures().preferGlobalPipelineCache.enabled)
-    {
-        // Make sure Renderer's pipeline cache is initialized
-        vk::PipelineCacheAccess unused;
-        ANGLE_TRY(context->getRenderer()->getPipelineCache(context, &unused));
-    }
-    else
-    {
-        // Make sure ProgramExecutableVk's pipeline cache is initialized
-        ANGLE_TRY(ensurePipelineCacheInitialized(context));
-    }
+    ANGLE_TRY(initWarmUpPipelineCache(context));
 
     *isComputeOut        = false;
     const bool isCompute = mExecutable->hasLinkedShaderStage(gl::ShaderType::Compute);
@@ -1158,6 +1545,13 @@ void ProgramExecutableVk::waitForPostLinkTasksImpl(ContextVk *contextVk)
     {
         WarmUpTaskCommon *warmUpTask = static_cast<WarmUpTaskCommon *>(task.get());
 
+        if (warmUpTask->wasSkipped())
+        {
+            // The program is being deleted; just drop the placeholder pipeline.
+            warmUpTask->removeFailedPipeline();
+            continue;
+        }
+
         // As these tasks can be run post-link, their results are ignored.  Failure is harmless, but
         // more importantly the error (effectively due to a link event) may not be allowed through
         // the entry point that results in this call.
@@ -1188,8 +1582,15 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
     }
 
     const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(contextVk->getFeatures());
+    const uint32_t permutationIndex =
+        getTransformOptions(contextVk, currentGraphicsPipelineDesc).permutationIndex;
 
-    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset))
+    if (mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset) ||
+        isRecordedGraphicsPipeline(currentGraphicsPipelineDesc, permutationIndex, subset))
+    {
+        ++contextVk->getPerfCounters().graphicsPipelineWarmUpHits;
+    }
+    else
     {
         // The GraphicsPipelineDesc used for warm up differs from the one used by the draw call.
         // There is no need to wait for the warm up tasks to complete.
@@ -1357,9 +1758,67 @@ void ProgramExecutableVk::addInputAttachmentDescriptorSetDesc(vk::ErrorContext *
     }
 }
 
+bool ProgramExecutableVk::isImmutableTextureSamplerCandidate(uint32_t samplerIndex) const
+{
+    const gl::SamplerBinding &samplerBinding = mExecutable->getSamplerBindings()[samplerIndex];
+    const gl::LinkedUniform &samplerUniform =
+        mExecutable->getUniforms()[mExecutable->getUniformIndexFromSamplerIndex(samplerIndex)];
+
+    return samplerBinding.textureUnitsCount == 1 &&
+           samplerUniform.getOuterArraySizeProduct() == 1 &&
+           samplerBinding.textureType != gl::TextureType::Buffer &&
+           samplerBinding.samplerType != GL_SAMPLER_EXTERNAL_2D_Y2Y_EXT &&
+           samplerUniform.activeShaders().any() &&
+           !mSamplerBindingsWithChangingSamplers[samplerIndex];
+}
+
+bool ProgramExecutableVk::needsNewImmutableTextureSamplers(
+    const gl::ActiveTextureArray<TextureVk *> &textures,
+    const gl::SamplerBindingVector &samplers)
+{
+    const std::vector<gl::SamplerBinding> &samplerBindings = mExecutable->getSamplerBindings();
+    const std::vector<GLuint> &samplerBoundTextureUnits =
+        mExecutable->getSamplerBoundTextureUnits();
+    mSamplerBindingsWithChangingSamplers.resize(samplerBindings.size(), false);
+
+    bool needsNewLayout = false;
+    for (uint32_t samplerIndex = 0; samplerIndex < samplerBindings.size(); ++samplerIndex)
+    {
+        if (!isImmutableTextureSamplerCandidate(samplerIndex))
+        {
+            continue;
+        }
+
+        const GLuint textureUnit =
+            samplerBindings[samplerIndex].getTextureUnit(samplerBoundTextureUnits, 0);
+        const TextureVk *textureVk = textures[textureUnit];
+        if (textureVk == nullptr || textureVk->getImage().hasImmutableSampler())
+        {
+            continue;
+        }
+
+        gl::Sampler *sampler = samplers[textureUnit].get();
+        const vk::SamplerHelper &samplerHelper =
+            sampler ? vk::GetImpl(sampler)->getSampler() : textureVk->getSampler(false);
+
+        if (!hasImmutableTextureSampler(samplerIndex))
+        {
+            needsNewLayout = true;
+        }
+        else if (mImmutableTextureSamplerSerials[samplerIndex] != samplerHelper.getSamplerSerial())
+        {
+            mSamplerBindingsWithChangingSamplers[samplerIndex] = true;
+            needsNewLayout                                     = true;
+        }
+    }
+
+    return needsNewLayout;
+}
+
 angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
     vk::ErrorContext *context,
     const gl::ActiveTextureArray<TextureVk *> *activeTextures,
+    const gl::SamplerBindingVector *samplers,
     vk::DescriptorSetLayoutDesc *descOut)
 {
     const std::vector<gl::SamplerBinding> &samplerBindings = mExecutable->getSamplerBindings();
@@ -1367,6 +1826,12 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
     const std::vector<GLuint> &samplerBoundTextureUnits =
         mExecutable->getSamplerBoundTextureUnits();
 
+    const bool useImmutableTextureSamplers =
+        context->getFeatures().useImmutableSamplersForTextures.enabled &&
+        activeTextures != nullptr && samplers != nullptr;
+    mImmutableTextureSamplerSerials.assign(samplerBindings.size(), vk::SamplerSerial());
+    mSamplerBindingsWithChangingSamplers.resize(samplerBindings.size(), false);
+
     for (uint32_t samplerIndex = 0; samplerIndex < samplerBindings.size(); ++samplerIndex)
     {
         uint32_t uniformIndex = mExecutable->getUniformIndexFromSamplerIndex(samplerIndex);
@@ -1446,6 +1911,18 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
             mImmutableSamplersMaxDescriptorCount =
                 std::max(mImmutableSamplersMaxDescriptorCount, formatDescriptorCount);
         }
+        else if (useImmutableTextureSamplers && isImmutableTextureSamplerCandidate(samplerIndex) &&
+                 (*activeTextures)[textureUnit] != nullptr)
+        {
+            // The sampler cache keeps the sampler alive for as long as the layout may be used.
+            gl::Sampler *sampler = (*samplers)[textureUnit].get();
+            const vk::SamplerHelper &samplerHelper =
+                sampler ? vk::GetImpl(sampler)->getSampler()
+                        : (*activeTextures)[textureUnit]->getSampler(false);
+            descOut->addBinding(info.binding, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, arraySize,
+                                activeStages, &samplerHelper.get());
+            mImmutableTextureSamplerSerials[samplerIndex] = samplerHelper.getSamplerSerial();
+        }
         else
         {
             const VkDescriptorType descType = samplerBinding.textureType == gl::TextureType::Buffer
@@ -1510,6 +1987,86 @@ void ProgramExecutableVk::initializeWriteDescriptorDesc(vk::ErrorContext *contex
         mDefaultUniformAndXfbWriteDescriptorDescs.getTotalDescriptorCount());
 }
 
+void ProgramExecutableVk::initializePushDescriptorWrites()
+{
+    // Set up one write per binding, like UpdateFullTexturesDescriptorSet and
+    // UpdateDescriptorSetsBuilder::updateWriteDescriptorSet do.  Only the infos the writes point
+    // to are updated afterwards.
+    ASSERT(mPushDescriptorSetIndex == DescriptorSetIndex::Texture ||
+           mPushDescriptorSetIndex == DescriptorSetIndex::UniformBuffers ||
+           mPushDescriptorSetIndex == DescriptorSetIndex::ShaderResource);
+    const bool isTextureSet = mPushDescriptorSetIndex == DescriptorSetIndex::Texture;
+    const vk::WriteDescriptorDescs *writeDescriptorDescsPtr = &mShaderResourceWriteDescriptorDescs;
+    if (isTextureSet)
+    {
+        writeDescriptorDescsPtr = &mTextureWriteDescriptorDescs;
+    }
+    else if (mPushDescriptorSetIndex == DescriptorSetIndex::UniformBuffers)
+    {
+        writeDescriptorDescsPtr = &mUniformBuffersWriteDescriptorDescs;
+    }
+    const vk::WriteDescriptorDescs &writeDescriptorDescs = *writeDescriptorDescsPtr;
+
+    uint32_t imageInfoCount  = 0;
+    uint32_t bufferViewCount = 0;
+    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
+    {
+        if (writeDescriptorDescs[writeIndex].descriptorType ==
+            VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER)
+        {
+            bufferViewCount += writeDescriptorDescs[writeIndex].descriptorCount;
+        }
+        else if (writeDescriptorDescs[writeIndex].descriptorType ==
+                 VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+        {
+            imageInfoCount += writeDescriptorDescs[writeIndex].descriptorCount;
+        }
+    }
+
+    // Buffer infos are laid out like the DescriptorSetDescBuilder's descriptor infos, so that they
+    // can be copied over in one loop.
+    const size_t bufferInfoCount =
+        isTextureSet ? 0 : writeDescriptorDescs.getTotalDescriptorCount();
+
+    mPushDescriptorWrites.clear();
+    mPushDescriptorImageInfos.assign(imageInfoCount, {});
+    mPushDescriptorBufferInfos.assign(bufferInfoCount, {});
+    mPushDescriptorBufferViews.assign(bufferViewCount, VK_NULL_HANDLE);
+
+    VkDescriptorImageInfo *imageInfos = mPushDescriptorImageInfos.data();
+    VkBufferView *bufferViews         = mPushDescriptorBufferViews.data();
+    for (uint32_t writeIndex = 0; writeIndex < writeDescriptorDescs.size(); ++writeIndex)
+    {
+        const vk::WriteDescriptorDesc &writeDesc = writeDescriptorDescs[writeIndex];
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        VkWriteDescriptorSet writeSet;
+        InitWriteDescriptorSet(writeDescriptorDescs, writeIndex, VK_NULL_HANDLE, &writeSet);
+        switch (writeSet.descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                writeSet.pTexelBufferView = bufferViews;
+                bufferViews += writeSet.descriptorCount;
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                writeSet.pImageInfo = imageInfos;
+                imageInfos += writeSet.descriptorCount;
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                writeSet.pBufferInfo = &mPushDescriptorBufferInfos[writeDesc.descriptorInfoIndex];
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+        mPushDescriptorWrites.push_back(writeSet);
+    }
+}
+
 ProgramTransformOptions ProgramExecutableVk::getTransformOptions(
     ContextVk *contextVk,
     const vk::GraphicsPipelineDesc &desc)
@@ -1692,6 +2249,14 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
     ANGLE_TRY(initProgramThenCreateGraphicsPipeline(
         contextVk, transformOptions, pipelineSubset, pipelineCache, source, desc,
         *compatibleRenderPass, descPtrOut, pipelineOut));
+    onGraphicsPipelineCreated(contextVk, pipelineSubset);
+
+    // Remember the pipeline so it can be warmed up the next time this program is linked.
+    if (pipelineSubset == vk::GraphicsPipelineSubset::Complete && source == PipelineSource::Draw &&
+        contextVk->getFeatures().warmUpRecordedGraphicsPipelines.enabled)
+    {
+        recordGraphicsPipeline(contextVk, transformOptions, desc);
+    }
 
     if (useProgramPipelineCache &&
         contextVk->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled)
@@ -1702,6 +2267,25 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
     return angle::Result::Continue;
 }
 
+void ProgramExecutableVk::onGraphicsPipelineCreated(ContextVk *contextVk,
+                                                    vk::GraphicsPipelineSubset subset)
+{
+    angle::VulkanPerfCounters &perfCounters = contextVk->getPerfCounters();
+    if (subset == vk::GraphicsPipelineSubset::Complete)
+    {
+        ++perfCounters.completeGraphicsPipelineCreations;
+    }
+    else
+    {
+        ++perfCounters.shadersGraphicsPipelineCreations;
+    }
+
+    ++mGraphicsPipelineCreationCount;
+    perfCounters.maxGraphicsPipelinesPerProgram =
+        std::max<uint64_t>(perfCounters.maxGraphicsPipelinesPerProgram,
+                           mGraphicsPipelineCreationCount);
+}
+
 angle::Result ProgramExecutableVk::createLinkedGraphicsPipeline(
     ContextVk *contextVk,
     vk::PipelineCacheAccess *pipelineCache,
@@ -1732,6 +2316,7 @@ angle::Result ProgramExecutableVk::createLinkedGraphicsPipeline(
     ANGLE_TRY(mCompleteGraphicsPipelines[programIndex].createPipeline(
         contextVk, linkPipelineCache, *compatibleRenderPass, getPipelineLayout(), {shadersPipeline},
         PipelineSource::DrawLinked, desc, descPtrOut, pipelineOut));
+    onGraphicsPipelineCreated(contextVk, vk::GraphicsPipelineSubset::Complete);
 
     // If monolithic pipelines are preferred over libraries, create a task so that it can be created
     // asynchronously.
@@ -1767,7 +2352,8 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     vk::ErrorContext *context,
     PipelineLayoutCache *pipelineLayoutCache,
     DescriptorSetLayoutCache *descriptorSetLayoutCache,
-    gl::ActiveTextureArray<TextureVk *> *activeTextures)
+    gl::ActiveTextureArray<TextureVk *> *activeTextures,
+    const gl::SamplerBindingVector *samplers)
 {
     vk::Renderer *renderer                     = context->getRenderer();
     const gl::ShaderBitSet &linkedShaderStages = mExecutable->getLinkedShaderStages();
@@ -1814,6 +2400,40 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
         context, mDefaultUniformAndXfbSetDesc,
         &mDescriptorSetLayouts[DescriptorSetIndex::UniformsAndXfb]));
 
+    // Only one descriptor set of the pipeline layout can be pushed instead of being allocated and
+    // cached.  That is the texture set if it's small enough, otherwise the uniform buffer set, and
+    // otherwise the shader resource set if it only contains a few storage buffers.
+    mPushDescriptorSetIndex               = DescriptorSetIndex::InvalidEnum;
+    const uint32_t maxPushDescriptorCount = context->getFeatures().supportsPushDescriptor.enabled
+                                                ? std::min(kMaxPushDescriptorSetDescriptorCount,
+                                                           renderer->getMaxPushDescriptors())
+                                                : 0;
+
+    // Textures:
+    mTextureSetDesc = {};
+    ANGLE_TRY(addTextureDescriptorSetDesc(context, activeTextures, samplers, &mTextureSetDesc));
+
+    // Immutable samplers are excluded as the descriptor pools are sized for their per-format
+    // descriptor counts.  The sampler bindings include inactive samplers, so the count is an
+    // upper bound.
+    if (context->getFeatures().usePushDescriptorsForTextures.enabled && !mTextureSetDesc.empty() &&
+        mImmutableSamplerIndexMap.empty())
+    {
+        uint32_t textureDescriptorCount = 0;
+        for (const gl::SamplerBinding &samplerBinding : mExecutable->getSamplerBindings())
+        {
+            textureDescriptorCount += samplerBinding.textureUnitsCount;
+        }
+        if (textureDescriptorCount <= maxPushDescriptorCount)
+        {
+            mPushDescriptorSetIndex = DescriptorSetIndex::Texture;
+            mTextureSetDesc.setPushDescriptor(true);
+        }
+    }
+
+    ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
+        context, mTextureSetDesc, &mDescriptorSetLayouts[DescriptorSetIndex::Texture]));
+
     // Uniform buffers:
     mUniformBuffersSetDesc = {};
 
@@ -1832,11 +2452,20 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
         }
     }
 
+    // Push descriptor sets cannot contain dynamic uniform buffers, so the uniform buffer offsets
+    // are part of the pushed descriptors in that case.
+    const bool pushUniformBuffers =
+        context->getFeatures().usePushDescriptorsForUniformBuffers.enabled &&
+        mPushDescriptorSetIndex == DescriptorSetIndex::InvalidEnum &&
+        numActiveUniformBufferDescriptors > 0 &&
+        numActiveUniformBufferDescriptors <= maxPushDescriptorCount;
+
     // Decide if we should use dynamic or fixed descriptor types.
     VkPhysicalDeviceLimits limits = renderer->getPhysicalDeviceProperties().limits;
     uint32_t totalDynamicUniformBufferCount =
         numActiveUniformBufferDescriptors + numDefaultUniformDescriptors;
-    if (totalDynamicUniformBufferCount <= limits.maxDescriptorSetUniformBuffersDynamic)
+    if (!pushUniformBuffers &&
+        totalDynamicUniformBufferCount <= limits.maxDescriptorSetUniformBuffersDynamic)
     {
         mUniformBufferDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     }
@@ -1847,6 +2476,11 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
 
     addInterfaceBlockDescriptorSetDesc(mExecutable->getUniformBlocks(), linkedShaderStages,
                                        mUniformBufferDescriptorType, &mUniformBuffersSetDesc);
+    if (pushUniformBuffers)
+    {
+        mPushDescriptorSetIndex = DescriptorSetIndex::UniformBuffers;
+        mUniformBuffersSetDesc.setPushDescriptor(true);
+    }
 
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
         context, mUniformBuffersSetDesc,
@@ -1862,16 +2496,40 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     addImageDescriptorSetDesc(&mShaderResourceSetDesc);
     addInputAttachmentDescriptorSetDesc(context, &mShaderResourceSetDesc);
 
-    ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
-        context, mShaderResourceSetDesc,
-        &mDescriptorSetLayouts[DescriptorSetIndex::ShaderResource]));
+    // Atomic counter buffers are excluded as their descriptor array is indexed by binding and
+    // sized to the max, and images and input attachments as their count could exceed the limit.
+    if (context->getFeatures().usePushDescriptorsForStorageBuffers.enabled &&
+        mPushDescriptorSetIndex == DescriptorSetIndex::InvalidEnum &&
+        mExecutable->hasStorageBuffers() && !mExecutable->hasAtomicCounterBuffers() &&
+        !mExecutable->hasImages() && !mExecutable->usesColorFramebufferFetch() &&
+        !mExecutable->usesDepthFramebufferFetch() && !mExecutable->usesStencilFramebufferFetch())
+    {
+        uint32_t numActiveStorageBufferDescriptors = 0;
+        const std::vector<gl::InterfaceBlock> &storageBlocks =
+            mExecutable->getShaderStorageBlocks();
+        for (uint32_t bufferIndex = 0; bufferIndex < storageBlocks.size();)
+        {
+            const gl::InterfaceBlock &block = storageBlocks[bufferIndex];
+            const uint32_t arraySize = GetInterfaceBlockArraySize(storageBlocks, bufferIndex);
+            bufferIndex += arraySize;
 
-    // Textures:
-    mTextureSetDesc = {};
-    ANGLE_TRY(addTextureDescriptorSetDesc(context, activeTextures, &mTextureSetDesc));
+            if (block.activeShaders().any())
+            {
+                numActiveStorageBufferDescriptors += arraySize;
+            }
+        }
+
+        if (numActiveStorageBufferDescriptors > 0 &&
+            numActiveStorageBufferDescriptors <= maxPushDescriptorCount)
+        {
+            mPushDescriptorSetIndex = DescriptorSetIndex::ShaderResource;
+            mShaderResourceSetDesc.setPushDescriptor(true);
+        }
+    }
 
     ANGLE_TRY(descriptorSetLayoutCache->getDescriptorSetLayout(
-        context, mTextureSetDesc, &mDescriptorSetLayouts[DescriptorSetIndex::Texture]));
+        context, mShaderResourceSetDesc,
+        &mDescriptorSetLayouts[DescriptorSetIndex::ShaderResource]));
 
     // Create pipeline layout with these 4 descriptor sets.
     vk::PipelineLayoutDesc pipelineLayoutDesc;
@@ -1898,6 +2556,10 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     mDefaultUniformDynamicDescriptorOffsets.resize(mExecutable->getLinkedShaderStageCount(), 0);
 
     initializeWriteDescriptorDesc(context);
+    if (mPushDescriptorSetIndex != DescriptorSetIndex::InvalidEnum)
+    {
+        initializePushDescriptorWrites();
+    }
 
     return angle::Result::Continue;
 }
@@ -1910,15 +2572,28 @@ angle::Result ProgramExecutableVk::initializeDescriptorPools(
     ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::UniformsAndXfb].bindCachedDescriptorPool(
         context, mDefaultUniformAndXfbSetDesc, 1, descriptorSetLayoutCache,
         &mDynamicDescriptorPools[DescriptorSetIndex::UniformsAndXfb]));
-    ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::Texture].bindCachedDescriptorPool(
-        context, mTextureSetDesc, mImmutableSamplersMaxDescriptorCount, descriptorSetLayoutCache,
-        &mDynamicDescriptorPools[DescriptorSetIndex::Texture]));
-    ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::UniformBuffers].bindCachedDescriptorPool(
-        context, mUniformBuffersSetDesc, 1, descriptorSetLayoutCache,
-        &mDynamicDescriptorPools[DescriptorSetIndex::UniformBuffers]));
-    return (*metaDescriptorPools)[DescriptorSetIndex::ShaderResource].bindCachedDescriptorPool(
-        context, mShaderResourceSetDesc, 1, descriptorSetLayoutCache,
-        &mDynamicDescriptorPools[DescriptorSetIndex::ShaderResource]);
+    // Descriptor sets cannot be allocated with a push descriptor layout.
+    if (mPushDescriptorSetIndex != DescriptorSetIndex::Texture)
+    {
+        ANGLE_TRY((*metaDescriptorPools)[DescriptorSetIndex::Texture].bindCachedDescriptorPool(
+            context, mTextureSetDesc, mImmutableSamplersMaxDescriptorCount,
+            descriptorSetLayoutCache, &mDynamicDescriptorPools[DescriptorSetIndex::Texture]));
+    }
+    if (mPushDescriptorSetIndex != DescriptorSetIndex::UniformBuffers)
+    {
+        ANGLE_TRY(
+            (*metaDescriptorPools)[DescriptorSetIndex::UniformBuffers].bindCachedDescriptorPool(
+                context, mUniformBuffersSetDesc, 1, descriptorSetLayoutCache,
+                &mDynamicDescriptorPools[DescriptorSetIndex::UniformBuffers]));
+    }
+    if (mPushDescriptorSetIndex != DescriptorSetIndex::ShaderResource)
+    {
+        ANGLE_TRY(
+            (*metaDescriptorPools)[DescriptorSetIndex::ShaderResource].bindCachedDescriptorPool(
+                context, mShaderResourceSetDesc, 1, descriptorSetLayoutCache,
+                &mDynamicDescriptorPools[DescriptorSetIndex::ShaderResource]));
+    }
+    return angle::Result::Continue;
 }
 
 void ProgramExecutableVk::resolvePrecisionMismatch(const gl::ProgramMergedVaryings &mergedVaryings)
@@ -2082,7 +2757,13 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
     PipelineType pipelineType,
     UpdateDescriptorSetsBuilder *updateBuilder)
 {
-    if (context->getFeatures().descriptorSetCache.enabled)
+    if (mPushDescriptorSetIndex == DescriptorSetIndex::Texture)
+    {
+        // The writes are pushed by bindDescriptorSets, so there is nothing to allocate or cache.
+        ANGLE_TRY(WriteTexturesDescriptors(context, mVariableInfoMap, *mExecutable, textures,
+                                           samplers, mPushDescriptorWrites.data()));
+    }
+    else if (context->getFeatures().descriptorSetCache.enabled)
     {
         vk::SharedDescriptorSetCacheKey newSharedCacheKey;
 
@@ -2093,9 +2774,20 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         mTextureDescriptorDescBuilder.updatePreCacheActiveTextures(
             context, *mExecutable, textures, samplers, mTextureWriteDescriptorDescs);
 
+        // Texture dirty bits are often set without the bound textures actually changing, e.g.
+        // when the same textures are rebound every draw.  In that case the descriptor set that is
+        // already in use still describes the same image views and samplers, so the cache lookup
+        // (and hashing the desc) can be skipped.
+        const vk::DescriptorSetDesc &desc = mTextureDescriptorDescBuilder.getDesc();
+        if (mDescriptorSets[DescriptorSetIndex::Texture] && desc == mLastTextureDescriptorSetDesc)
+        {
+            ASSERT(mValidDescriptorSetIndices.test(DescriptorSetIndex::Texture));
+            return angle::Result::Continue;
+        }
+        mLastTextureDescriptorSetDesc = desc;
+
         ANGLE_TRY(mDynamicDescriptorPools[DescriptorSetIndex::Texture]->getOrAllocateDescriptorSet(
-            context, currentFrame, mTextureDescriptorDescBuilder.getDesc(),
-            *mDescriptorSetLayouts[DescriptorSetIndex::Texture],
+            context, currentFrame, desc, *mDescriptorSetLayouts[DescriptorSetIndex::Texture],
             &mDescriptorSets[DescriptorSetIndex::Texture], &newSharedCacheKey));
         ASSERT(mDescriptorSets[DescriptorSetIndex::Texture]);
 
@@ -2156,6 +2848,20 @@ angle::Result ProgramExecutableVk::updateUniformsAndXfbDescInfo(
     return angle::Result::Continue;
 }
 
+void ProgramExecutableVk::copyPushDescriptorBufferInfos(
+    const vk::DescriptorSetDescBuilder &descriptorSetDescBuilder)
+{
+    const vk::DescriptorInfoDesc *infoDescs  = descriptorSetDescBuilder.getDesc().getInfoDescs();
+    const vk::DescriptorDescHandles *handles = descriptorSetDescBuilder.getHandles();
+    for (size_t infoIndex = 0; infoIndex < mPushDescriptorBufferInfos.size(); ++infoIndex)
+    {
+        VkDescriptorBufferInfo &bufferInfo = mPushDescriptorBufferInfos[infoIndex];
+        bufferInfo.buffer                  = handles[infoIndex].buffer;
+        bufferInfo.offset                  = infoDescs[infoIndex].imageViewSerialOrOffset;
+        bufferInfo.range                   = infoDescs[infoIndex].imageLayoutOrRange;
+    }
+}
+
 angle::Result ProgramExecutableVk::updateUniformBuffersDescInfo(
     vk::Context *context,
     vk::CommandBufferHelperCommon *commandBufferHelper,
@@ -2175,6 +2881,14 @@ angle::Result ProgramExecutableVk::updateUniformBuffersDescInfo(
             emptyBuffer, mUniformBuffersWriteDescriptorDescs);
     }
 
+    if (mPushDescriptorSetIndex == DescriptorSetIndex::UniformBuffers)
+    {
+        // The writes are pushed by bindDescriptorSets, so there is nothing to allocate or cache.
+        copyPushDescriptorBufferInfos(mUniformBuffersDescriptorDescBuilder);
+        mValidDescriptorSetIndices.set(DescriptorSetIndex::UniformBuffers);
+        return angle::Result::Continue;
+    }
+
     vk::SharedDescriptorSetCacheKey newSharedCacheKey;
     ANGLE_TRY(updateBuffersDescriptorSet(
         context, currentFrameCount, mUniformBuffersDescriptorDescBuilder,
@@ -2323,6 +3037,15 @@ angle::Result ProgramExecutableVk::updateShaderResourcesDescInfo(
         commandBufferHelper->setHasShaderStorageOutput();
     }
 
+    if (mPushDescriptorSetIndex == DescriptorSetIndex::ShaderResource)
+    {
+        // The set only contains storage buffers, see createPipelineLayout.  The writes are pushed
+        // by bindDescriptorSets, so there is nothing to allocate or cache.
+        copyPushDescriptorBufferInfos(mShaderResourceDescriptorDescBuilder);
+        mValidDescriptorSetIndices.set(DescriptorSetIndex::ShaderResource);
+        return angle::Result::Continue;
+    }
+
     vk::SharedDescriptorSetCacheKey newSharedCacheKey;
     ANGLE_TRY(updateBuffersDescriptorSet(
         contextVk, currentFrameCount, mShaderResourceDescriptorDescBuilder,
@@ -2355,6 +3078,15 @@ angle::Result ProgramExecutableVk::bindDescriptorSets(
 
     for (DescriptorSetIndex descriptorSetIndex : mValidDescriptorSetIndices)
     {
+        if (descriptorSetIndex == mPushDescriptorSetIndex)
+        {
+            commandBuffer->pushDescriptorSet(getPipelineLayout(), pipelineBindPoint,
+                                             descriptorSetIndex,
+                                             static_cast<uint32_t>(mPushDescriptorWrites.size()),
+                                             mPushDescriptorWrites.data());
+            continue;
+        }
+
         ASSERT(mDescriptorSets[descriptorSetIndex]);
         VkDescriptorSet descSet = mDescriptorSets[descriptorSetIndex]->getDescriptorSet();
         ASSERT(descSet != VK_NULL_HANDLE);
@@ -2553,31 +3285,34 @@ angle::Result ProgramExecutableVk::resizeUniformBlockMemory(
         }
     }
 
+    // The uniform layout is final at this point, both after link and after load.
+    InitDefaultUniformSetters(mExecutable, mDefaultUniformBlocks, &mDefaultUniformSetters);
+
     return angle::Result::Continue;
 }
 
 void ProgramExecutableVk::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_FLOAT, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_FLOAT,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_FLOAT_VEC2, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_FLOAT_VEC2,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_FLOAT_VEC3, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_FLOAT_VEC3,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_FLOAT_VEC4, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_FLOAT_VEC4,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform1iv(GLint location, GLsizei count, const GLint *v)
@@ -2591,50 +3326,50 @@ void ProgramExecutableVk::setUniform1iv(GLint location, GLsizei count, const GLi
         return;
     }
 
-    SetUniform(mExecutable, location, count, v, GL_INT, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_INT,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform2iv(GLint location, GLsizei count, const GLint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_INT_VEC2, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_INT_VEC2,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform3iv(GLint location, GLsizei count, const GLint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_INT_VEC3, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_INT_VEC3,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform4iv(GLint location, GLsizei count, const GLint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_INT_VEC4, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_INT_VEC4,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_UNSIGNED_INT, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_UNSIGNED_INT,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_UNSIGNED_INT_VEC2, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_UNSIGNED_INT_VEC2,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_UNSIGNED_INT_VEC3, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_UNSIGNED_INT_VEC3,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
 {
-    SetUniform(mExecutable, location, count, v, GL_UNSIGNED_INT_VEC4, &mDefaultUniformBlocks,
-               &mDefaultUniformBlocksDirty);
+    SetUniform(mExecutable, mDefaultUniformSetters, location, count, v, GL_UNSIGNED_INT_VEC4,
+               &mDefaultUniformBlocks, &mDefaultUniformBlocksDirty);
 }
 
 void ProgramExecutableVk::setUniformMatrix2fv(GLint location,
@@ -44,13 +44,29 @@ class ShaderInfo final : angle::NonCopyable
 
     const gl::ShaderMap<angle::spirv::Blob> &getSpirvBlobs() const { return mSpirvBlobs; }
 
+    // Transforms the SPIR-V of a shader stage and creates its shader module, or returns the one
+    // created earlier for the same transform options.  Many program variants only differ in
+    // options that affect a single stage (for example, dithering only affects the fragment
+    // shader), so the other stages are transformed once and their modules are shared.
+    angle::Result getTransformedShaderModule(vk::ErrorContext *context,
+                                             const SpvTransformOptions &options,
+                                             const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                             vk::ShaderModulePtr *shaderModuleOut) const;
+
     // Save and load implementation for GLES Program Binary support.
     void load(gl::BinaryInputStream *stream);
     void save(gl::BinaryOutputStream *stream);
 
   private:
+    void clearTransformedShaderModules();
+
     gl::ShaderMap<angle::spirv::Blob> mSpirvBlobs;
     bool mIsInitialized = false;
+
+    // Shader modules created from the transformed SPIR-V, keyed by the transform options.
+    // Programs may be warmed up on a worker thread, hence the mutex.
+    mutable angle::SimpleMutex mTransformedShaderModulesMutex;
+    mutable gl::ShaderMap<angle::HashMap<uint32_t, vk::ShaderModulePtr>> mTransformedShaderModules;
 };
 
 union ProgramTransformOptions final
@@ -107,11 +123,29 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     void destroy(const gl::Context *context) override;
 
+    // The state read from a program binary that is needed to create the program's Vulkan objects.
+    // This is kept aside by |load| so that the objects are created by |finishLoad|, which may run
+    // in a worker thread.
+    struct LoadState
+    {
+        gl::ShaderMap<size_t> requiredBufferSize;
+        bool pipelineDataCompressed = false;
+        // The pipeline cache data is used in place if the binary's storage can be kept alive.
+        // Otherwise it's copied to |pipelineDataCopy|.
+        std::shared_ptr<const angle::MemoryBuffer> pipelineDataStorage;
+        std::vector<uint8_t> pipelineDataCopy;
+        angle::Span<const uint8_t> pipelineData;
+    };
+
     void save(ContextVk *contextVk, bool isSeparable, gl::BinaryOutputStream *stream);
-    angle::Result load(ContextVk *contextVk,
-                       bool isSeparable,
-                       gl::BinaryInputStream *stream,
-                       egl::CacheGetResult *resultOut);
+    void load(ContextVk *contextVk,
+              bool isSeparable,
+              gl::BinaryInputStream *stream,
+              LoadState *loadStateOut);
+    angle::Result finishLoad(vk::ErrorContext *context,
+                             PipelineLayoutCache *pipelineLayoutCache,
+                             DescriptorSetLayoutCache *descriptorSetLayoutCache,
+                             const LoadState &loadState);
 
     void setUniform1fv(GLint location, GLsizei count, const GLfloat *v) override;
     void setUniform2fv(GLint location, GLsizei count, const GLfloat *v) override;
@@ -207,7 +241,8 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     angle::Result createPipelineLayout(vk::ErrorContext *context,
                                        PipelineLayoutCache *pipelineLayoutCache,
                                        DescriptorSetLayoutCache *descriptorSetLayoutCache,
-                                       gl::ActiveTextureArray<TextureVk *> *activeTextures);
+                                       gl::ActiveTextureArray<TextureVk *> *activeTextures,
+                                       const gl::SamplerBindingVector *samplers);
     angle::Result initializeDescriptorPools(
         vk::ErrorContext *context,
         DescriptorSetLayoutCache *descriptorSetLayoutCache,
@@ -249,6 +284,20 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         return (mImmutableSamplerIndexMap == immutableSamplerIndexMap);
     }
 
+    // With the useImmutableSamplersForTextures feature, the sampler of a non-array texture binding
+    // is made an immutable sampler of the texture descriptor set layout, so that the descriptor
+    // sets only depend on the image views.  Returns true if the pipeline layout should be
+    // recreated, either because a binding can now be given an immutable sampler, or because the
+    // sampler of a binding has changed.  In the latter case, the binding is not given an immutable
+    // sampler anymore, so the layout is recreated at most once per binding.
+    bool needsNewImmutableTextureSamplers(const gl::ActiveTextureArray<TextureVk *> &textures,
+                                          const gl::SamplerBindingVector &samplers);
+    bool hasImmutableTextureSampler(uint32_t samplerIndex) const
+    {
+        return samplerIndex < mImmutableTextureSamplerSerials.size() &&
+               mImmutableTextureSamplerSerials[samplerIndex].valid();
+    }
+
     size_t getDefaultUniformAlignedSize(vk::ErrorContext *context, gl::ShaderType shaderType) const
     {
         vk::Renderer *renderer = context->getRenderer();
@@ -308,12 +357,21 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         vk::PipelineRobustness pipelineRobustness,
         vk::PipelineProtectedAccess pipelineProtectedAccess,
         std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
+    // Used when the program is loaded from the cache.  Only the pipelines that were recorded at
+    // draw time in a previous run are warmed up, as the program's pipeline cache is already
+    // loaded.
+    angle::Result getRecordedPipelinesWarmUpTasks(
+        vk::Renderer *renderer,
+        vk::PipelineRobustness pipelineRobustness,
+        vk::PipelineProtectedAccess pipelineProtectedAccess,
+        std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
 
     void waitForPostLinkTasks(const gl::Context *context) override
     {
         ContextVk *contextVk = vk::GetImpl(context);
         waitForPostLinkTasksImpl(contextVk);
     }
+    void cancelPostLinkTasks() override { mWarmUpCancellation.cancel(); }
     void waitForComputePostLinkTasks(ContextVk *contextVk)
     {
         ASSERT(mExecutable->hasLinkedShaderStage(gl::ShaderType::Compute));
@@ -387,6 +445,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     class WarmUpComputeTask;
     class WarmUpGraphicsTask;
 
+    // A graphics pipeline that was created at draw time, remembered in the blob cache so that it
+    // can be warmed up the next time this program is linked or loaded.
+    struct RecordedGraphicsPipeline
+    {
+        ProgramTransformOptions transformOptions;
+        vk::GraphicsPipelineDesc desc;
+    };
+
     friend class ProgramVk;
     friend class ProgramPipelineVk;
 
@@ -405,7 +471,9 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     angle::Result addTextureDescriptorSetDesc(
         vk::ErrorContext *context,
         const gl::ActiveTextureArray<TextureVk *> *activeTextures,
+        const gl::SamplerBindingVector *samplers,
         vk::DescriptorSetLayoutDesc *descOut);
+    bool isImmutableTextureSamplerCandidate(uint32_t samplerIndex) const;
 
     size_t calcUniformUpdateRequiredSpace(vk::ErrorContext *context,
                                           gl::ShaderMap<VkDeviceSize> *uniformOffsets) const;
@@ -482,6 +550,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                              const vk::RenderPass &compatibleRenderPass,
                                              const vk::GraphicsPipelineDesc **descPtrOut,
                                              vk::PipelineHelper **pipelineOut);
+    angle::Result initWarmUpPipelineCache(vk::ErrorContext *context);
     angle::Result preparePipelineCacheForWarmUp(vk::ErrorContext *context,
                                                 vk::PipelineRobustness pipelineRobustness,
                                                 vk::PipelineProtectedAccess pipelineProtectedAccess,
@@ -504,6 +573,23 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               vk::PipelineHelper *placeholderPipelineHelper);
     void waitForPostLinkTasksImpl(ContextVk *contextVk);
 
+    void initRecordedGraphicsPipelinesKey(vk::Renderer *renderer);
+    void loadRecordedGraphicsPipelines(vk::Renderer *renderer);
+    void recordGraphicsPipeline(ContextVk *contextVk,
+                                ProgramTransformOptions transformOptions,
+                                const vk::GraphicsPipelineDesc &desc);
+    void onGraphicsPipelineCreated(ContextVk *contextVk, vk::GraphicsPipelineSubset subset);
+    bool isRecordedGraphicsPipeline(const vk::GraphicsPipelineDesc &desc,
+                                    uint32_t permutationIndex,
+                                    vk::GraphicsPipelineSubset subset) const;
+    angle::Result addRecordedGraphicsPipelineWarmUpTasks(
+        vk::ErrorContext *context,
+        vk::PipelineRobustness pipelineRobustness,
+        vk::PipelineProtectedAccess pipelineProtectedAccess,
+        vk::GraphicsPipelineSubset subset,
+        const vk::GraphicsPipelineDesc *defaultWarmUpDesc,
+        std::vector<std::shared_ptr<LinkSubTask>> *warmUpSubTasks);
+
     angle::Result getOrAllocateDescriptorSet(vk::Context *context,
                                              uint32_t currentFrame,
                                              UpdateDescriptorSetsBuilder *updateBuilder,
@@ -516,10 +602,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     // the cache is lazily created as needed.
     angle::Result initializePipelineCache(vk::ErrorContext *context,
                                           bool compressed,
-                                          const std::vector<uint8_t> &pipelineData);
+                                          angle::Span<const uint8_t> pipelineData);
     angle::Result ensurePipelineCacheInitialized(vk::ErrorContext *context);
 
     void initializeWriteDescriptorDesc(vk::ErrorContext *context);
+    void initializePushDescriptorWrites();
+    // Copies the buffer descriptors of the pushed uniform buffer or shader resource set.
+    void copyPushDescriptorBufferInfos(
+        const vk::DescriptorSetDescBuilder &descriptorSetDescBuilder);
 
     void updateShaderResourcesWithSharedCacheKey(
         const gl::BufferVector &shaderStorageBufferBindings,
@@ -552,6 +642,10 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     // deleted while this program is in use.
     uint32_t mImmutableSamplersMaxDescriptorCount;
     ImmutableSamplerIndexMap mImmutableSamplerIndexMap;
+    // The samplers used as immutable samplers for regular textures, indexed by sampler index, and
+    // the bindings that are not given one because their sampler was seen changing.
+    std::vector<vk::SamplerSerial> mImmutableTextureSamplerSerials;
+    std::vector<bool> mSamplerBindingsWithChangingSamplers;
     vk::PipelineLayoutPtr mPipelineLayout;
     vk::DescriptorSetLayoutPointerArray mDescriptorSetLayouts;
 
@@ -583,8 +677,13 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     std::unordered_map<uint32_t, ShadersGraphicsPipelineCache> mShadersGraphicsPipelines;
     ComputePipelineCache mComputePipelines;
 
+    // The number of graphics pipelines (complete or shaders subset) created at draw time for this
+    // program, to track the largest number of variants any program has.
+    uint32_t mGraphicsPipelineCreationCount = 0;
+
     DefaultUniformBlockMap mDefaultUniformBlocks;
     gl::ShaderBitSet mDefaultUniformBlocksDirty;
+    DefaultUniformSetters mDefaultUniformSetters;
 
     ShaderInfo mOriginalShaderInfo;
 
@@ -605,6 +704,18 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     vk::GraphicsPipelineDesc mWarmUpGraphicsPipelineDesc;
 
+    // The graphics pipelines created at draw time for this program, in this or a previous run.
+    // They are stored in the blob cache under a key derived from the program's SPIR-V, and are
+    // warmed up along with |mWarmUpGraphicsPipelineDesc|.  Recording only starts once the
+    // previously stored list is loaded, so that it is not overwritten.
+    std::vector<RecordedGraphicsPipeline> mRecordedGraphicsPipelines;
+    angle::BlobCacheKey mRecordedGraphicsPipelinesKey;
+    bool mRecordedGraphicsPipelinesLoaded = false;
+
+    // Tripped when the program is deleted, so that warm up tasks that haven't started yet don't
+    // create pipelines that will never be used.
+    angle::CancellationToken mWarmUpCancellation;
+
     // The "layout" information for descriptorSets
     vk::WriteDescriptorDescs mUniformBuffersWriteDescriptorDescs;
     vk::WriteDescriptorDescs mShaderResourceWriteDescriptorDescs;
@@ -617,11 +728,25 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     vk::DescriptorSetDescBuilder mTextureDescriptorDescBuilder;
     vk::DescriptorSetDescBuilder mDefaultUniformAndXfbDescriptorDescBuilder;
 
+    // The desc of the texture descriptor set currently in |mDescriptorSets|, used to skip the
+    // descriptor set cache lookup when the same textures are bound again.
+    vk::DescriptorSetDesc mLastTextureDescriptorSetDesc;
+
     vk::DescriptorSetLayoutDesc mUniformBuffersSetDesc;
     vk::DescriptorSetLayoutDesc mShaderResourceSetDesc;
     vk::DescriptorSetLayoutDesc mTextureSetDesc;
     vk::DescriptorSetLayoutDesc mDefaultUniformAndXfbSetDesc;
 
+    // Only one descriptor set of a pipeline layout can use a push descriptor layout.  If
+    // |mPushDescriptorSetIndex| is valid, that set's descriptors are written here instead of to a
+    // descriptor set, and pushed when descriptor sets are bound.  The writes point into the info
+    // arrays, which are not resized until the layout is reset.
+    DescriptorSetIndex mPushDescriptorSetIndex = DescriptorSetIndex::InvalidEnum;
+    std::vector<VkWriteDescriptorSet> mPushDescriptorWrites;
+    std::vector<VkDescriptorImageInfo> mPushDescriptorImageInfos;
+    std::vector<VkDescriptorBufferInfo> mPushDescriptorBufferInfos;
+    std::vector<VkBufferView> mPushDescriptorBufferViews;
+
     gl::AttachmentsMask mCurrentInputAttachmentsMask;
 };
 
@@ -98,7 +98,7 @@ angle::Result ProgramPipelineVk::link(const gl::Context *glContext,
     executableVk->resetLayout(contextVk);
     ANGLE_TRY(executableVk->createPipelineLayout(contextVk, &contextVk->getPipelineLayoutCache(),
                                                  &contextVk->getDescriptorSetLayoutCache(),
-                                                 nullptr));
+                                                 nullptr, nullptr));
     ANGLE_TRY(executableVk->initializeDescriptorPools(contextVk,
                                                       &contextVk->getDescriptorSetLayoutCache(),
                                                       &contextVk->getMetaDescriptorPools()));
@@ -13,6 +13,7 @@
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ProgramLinkedResources.h"
+#include "libANGLE/ShareGroup.h"
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 
 namespace rx
@@ -74,6 +75,7 @@ class LinkTaskVk final : public vk::ErrorContext, public LinkTask
     LinkTaskVk(vk::Renderer *renderer,
                PipelineLayoutCache &pipelineLayoutCache,
                DescriptorSetLayoutCache &descriptorSetLayoutCache,
+               gl::InterfaceBlockLayoutCache *interfaceBlockLayoutCache,
                const gl::ProgramState &state,
                bool isGLES1,
                vk::PipelineRobustness pipelineRobustness,
@@ -85,7 +87,8 @@ class LinkTaskVk final : public vk::ErrorContext, public LinkTask
           mPipelineRobustness(pipelineRobustness),
           mPipelineProtectedAccess(pipelineProtectedAccess),
           mPipelineLayoutCache(pipelineLayoutCache),
-          mDescriptorSetLayoutCache(descriptorSetLayoutCache)
+          mDescriptorSetLayoutCache(descriptorSetLayoutCache),
+          mInterfaceBlockLayoutCache(interfaceBlockLayoutCache)
     {}
     ~LinkTaskVk() override = default;
 
@@ -171,6 +174,94 @@ class LinkTaskVk final : public vk::ErrorContext, public LinkTask
     const vk::PipelineRobustness mPipelineRobustness;
     const vk::PipelineProtectedAccess mPipelineProtectedAccess;
 
+    // Helpers that are interally thread-safe
+    PipelineLayoutCache &mPipelineLayoutCache;
+    DescriptorSetLayoutCache &mDescriptorSetLayoutCache;
+    gl::InterfaceBlockLayoutCache *mInterfaceBlockLayoutCache;
+
+    // Error handling
+    VkResult mErrorCode        = VK_SUCCESS;
+    const char *mErrorFile     = nullptr;
+    const char *mErrorFunction = nullptr;
+    unsigned int mErrorLine    = 0;
+};
+
+// When a program is loaded from the cache, the binary is read on the calling thread, but the
+// Vulkan objects are created by this task, which runs in a worker thread like a link job.  This
+// includes decompressing and creating the program's pipeline cache, which is the bulk of the load.
+// Afterwards, the graphics pipelines that were recorded at draw time in a previous run are warmed
+// up.
+class LoadTaskVk final : public vk::ErrorContext, public LinkTask
+{
+  public:
+    LoadTaskVk(vk::Renderer *renderer,
+               PipelineLayoutCache &pipelineLayoutCache,
+               DescriptorSetLayoutCache &descriptorSetLayoutCache,
+               const gl::ProgramState &state,
+               bool warmUpRecordedPipelines,
+               vk::PipelineRobustness pipelineRobustness,
+               vk::PipelineProtectedAccess pipelineProtectedAccess)
+        : vk::ErrorContext(renderer),
+          mExecutable(&state.getExecutable()),
+          mWarmUpRecordedPipelines(warmUpRecordedPipelines),
+          mPipelineRobustness(pipelineRobustness),
+          mPipelineProtectedAccess(pipelineProtectedAccess),
+          mPipelineLayoutCache(pipelineLayoutCache),
+          mDescriptorSetLayoutCache(descriptorSetLayoutCache)
+    {}
+    ~LoadTaskVk() override = default;
+
+    ProgramExecutableVk::LoadState *getLoadState() { return &mLoadState; }
+
+    void load(std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
+              std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut) override
+    {
+        ASSERT(linkSubTasksOut && linkSubTasksOut->empty());
+        ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
+
+        angle::Result result = loadImpl(postLinkSubTasksOut);
+        ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mErrorCode     = result;
+        mErrorFile     = file;
+        mErrorFunction = function;
+        mErrorLine     = line;
+    }
+
+    angle::Result getResult(const gl::Context *context, gl::InfoLog &infoLog) override
+    {
+        ContextVk *contextVk = vk::GetImpl(context);
+
+        // Forward any errors
+        if (mErrorCode != VK_SUCCESS)
+        {
+            contextVk->handleError(mErrorCode, mErrorFile, mErrorFunction, mErrorLine);
+            return angle::Result::Stop;
+        }
+
+        ProgramExecutableVk *executableVk = vk::GetImpl(mExecutable);
+        return executableVk->initializeDescriptorPools(contextVk,
+                                                       &contextVk->getDescriptorSetLayoutCache(),
+                                                       &contextVk->getMetaDescriptorPools());
+    }
+
+  private:
+    angle::Result loadImpl(std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
+
+    // The front-end ensures that the program is not accessed while loading, so it is safe to
+    // directly access the state from a potentially parallel job.
+    const gl::ProgramExecutable *mExecutable;
+    ProgramExecutableVk::LoadState mLoadState;
+    const bool mWarmUpRecordedPipelines;
+    const vk::PipelineRobustness mPipelineRobustness;
+    const vk::PipelineProtectedAccess mPipelineProtectedAccess;
+
     // Helpers that are interally thread-safe
     PipelineLayoutCache &mPipelineLayoutCache;
     DescriptorSetLayoutCache &mDescriptorSetLayoutCache;
@@ -215,7 +306,7 @@ angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
         initDefaultUniformBlocks(getFeatures().convertLowpAndMediumpFloatUniformsTo16Bits.enabled));
 
     ANGLE_TRY(executableVk->createPipelineLayout(this, &mPipelineLayoutCache,
-                                                 &mDescriptorSetLayoutCache, nullptr));
+                                                 &mDescriptorSetLayoutCache, nullptr, nullptr));
 
     // Warm up the pipeline cache by creating a few placeholder pipelines.  This is not done for
     // separable programs, and is deferred to when the program pipeline is finalized.
@@ -236,10 +327,32 @@ angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
     return angle::Result::Continue;
 }
 
+angle::Result LoadTaskVk::loadImpl(std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "LoadTaskVk::loadImpl");
+    ProgramExecutableVk *executableVk = vk::GetImpl(mExecutable);
+
+    ANGLE_TRY(executableVk->finishLoad(this, &mPipelineLayoutCache, &mDescriptorSetLayoutCache,
+                                       mLoadState));
+
+    // The loaded binary data is no longer needed.
+    mLoadState = {};
+
+    if (mWarmUpRecordedPipelines)
+    {
+        // Failure to prepare the warm up is not fatal to the load; any tasks that could be created
+        // are still run.
+        (void)executableVk->getRecordedPipelinesWarmUpTasks(
+            mRenderer, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut);
+    }
+
+    return angle::Result::Continue;
+}
+
 void LinkTaskVk::linkResources(const gl::ProgramLinkedResources &resources)
 {
     Std140BlockLayoutEncoderFactory std140EncoderFactory;
-    gl::ProgramLinkedResourcesLinker linker(&std140EncoderFactory);
+    gl::ProgramLinkedResourcesLinker linker(&std140EncoderFactory, mInterfaceBlockLayoutCache);
 
     linker.linkResources(mState, resources);
 }
@@ -378,10 +491,24 @@ angle::Result ProgramVk::load(const gl::Context *context,
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
-    // TODO: parallelize program load.  http://anglebug.com/41488637
-    *loadTaskOut = {};
+    // The pipeline cache is restored as part of the binary, but pipelines recorded at draw time
+    // still need to be created.  Same as link, this is not done for separable and GLES1 programs.
+    const bool warmUpRecordedPipelines =
+        !mState.isSeparable() && !context->getState().isGLES1() &&
+        contextVk->getFeatures().warmUpRecordedGraphicsPipelines.enabled;
+
+    std::shared_ptr<LoadTaskVk> loadTask(new LoadTaskVk(
+        contextVk->getRenderer(), contextVk->getPipelineLayoutCache(),
+        contextVk->getDescriptorSetLayoutCache(), mState, warmUpRecordedPipelines,
+        contextVk->pipelineRobustness(), contextVk->pipelineProtectedAccess()));
+
+    // Only read the binary here, as the stream does not outlive this call.  The rest of the load is
+    // done by the load task.
+    getExecutable()->load(contextVk, mState.isSeparable(), stream, loadTask->getLoadState());
 
-    return getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut);
+    *loadTaskOut = std::move(loadTask);
+    *resultOut   = egl::CacheGetResult::Success;
+    return angle::Result::Continue;
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
@@ -406,8 +533,10 @@ angle::Result ProgramVk::link(const gl::Context *context, std::shared_ptr<LinkTa
 
     *linkTaskOut = std::shared_ptr<LinkTask>(new LinkTaskVk(
         contextVk->getRenderer(), contextVk->getPipelineLayoutCache(),
-        contextVk->getDescriptorSetLayoutCache(), mState, context->getState().isGLES1(),
-        contextVk->pipelineRobustness(), contextVk->pipelineProtectedAccess()));
+        contextVk->getDescriptorSetLayoutCache(),
+        context->getShareGroup()->getInterfaceBlockLayoutCache(), mState,
+        context->getState().isGLES1(), contextVk->pipelineRobustness(),
+        contextVk->pipelineProtectedAccess()));
 
     return angle::Result::Continue;
 }
@@ -44,6 +44,11 @@ bool IsRenderPassQuery(ContextVk *contextVk, gl::QueryType type)
     }
 }
 
+bool IsAnySamplesQuery(gl::QueryType type)
+{
+    return type == gl::QueryType::AnySamples || type == gl::QueryType::AnySamplesConservative;
+}
+
 bool IsEmulatedTransformFeedbackQuery(ContextVk *contextVk, gl::QueryType type)
 {
     return type == gl::QueryType::TransformFeedbackPrimitivesWritten &&
@@ -108,7 +113,8 @@ QueryVk::QueryVk(gl::QueryType type)
     : QueryImpl(type),
       mTransformFeedbackPrimitivesDrawn(0),
       mCachedResult(0),
-      mCachedResultValid(false)
+      mCachedResultValid(false),
+      mResultCopyState(ResultCopyState::None)
 {}
 
 QueryVk::~QueryVk() = default;
@@ -179,6 +185,13 @@ void QueryVk::onDestroy(const gl::Context *context)
     {
         releaseQueries(contextVk);
     }
+
+    if (mResultCopyState == ResultCopyState::Pending)
+    {
+        contextVk->removePendingQueryResultCopy(this);
+    }
+    mResultBuffer.release(contextVk);
+    mPredicateBuffer.release(contextVk);
 }
 
 void QueryVk::stashQueryHelper()
@@ -312,6 +325,12 @@ angle::Result QueryVk::begin(const gl::Context *context)
 
     mCachedResultValid = false;
 
+    if (mResultCopyState == ResultCopyState::Pending)
+    {
+        contextVk->removePendingQueryResultCopy(this);
+    }
+    mResultCopyState = ResultCopyState::None;
+
     // Transform feedback query is handled by a CPU-calculated value when emulated.
     if (IsEmulatedTransformFeedbackQuery(contextVk, mType))
     {
@@ -408,6 +427,12 @@ angle::Result QueryVk::end(const gl::Context *context)
                     ANGLE_TRY(shareQuery->onRenderPassStart(contextVk));
                 }
             }
+
+            if (IsAnySamplesQuery(mType) &&
+                contextVk->getFeatures().copyOcclusionQueryResultsToBuffer.enabled)
+            {
+                ANGLE_TRY(requestResultCopy(contextVk));
+            }
             break;
         }
         case gl::QueryType::Timestamp:
@@ -439,6 +464,152 @@ angle::Result QueryVk::queryCounter(const gl::Context *context)
     return mQueryHelper.get().flushAndWriteTimestamp(contextVk);
 }
 
+angle::Result QueryVk::requestResultCopy(ContextVk *contextVk)
+{
+    // Only a single query helper can be copied in one go.  If the query spanned several render
+    // passes, its result is read back the usual way.
+    if (!mQueryHelper.isReferenced() || !mStashedQueryHelpers.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    if (!mResultBuffer.valid())
+    {
+        constexpr size_t kResultBufferSize =
+            sizeof(uint64_t) * gl::IMPLEMENTATION_ANGLE_MULTIVIEW_MAX_VIEWS;
+        ANGLE_TRY(contextVk->initBufferForBufferCopy(&mResultBuffer, kResultBufferSize,
+                                                     vk::MemoryCoherency::CachedPreferCoherent));
+    }
+    else if (!contextVk->getRenderer()->hasResourceUseFinished(mResultBuffer.getResourceUse()))
+    {
+        // The GPU may still be writing the result of the previous begin/end.
+        return angle::Result::Continue;
+    }
+
+    contextVk->addPendingQueryResultCopy(this);
+    mResultCopyState = ResultCopyState::Pending;
+    return angle::Result::Continue;
+}
+
+angle::Result QueryVk::recordResultCopy(ContextVk *contextVk)
+{
+    ASSERT(mResultCopyState == ResultCopyState::Pending);
+    ASSERT(mQueryHelper.isReferenced() && mStashedQueryHelpers.empty());
+
+    vk::CommandResources resources;
+    vk::OutsideRenderPassCommandBuffer *commandBuffer;
+    resources.onQueryAccess(&mQueryHelper.get());
+    resources.onBufferTransferWrite(&mResultBuffer);
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(resources, &commandBuffer));
+
+    mResultCopyState =
+        mQueryHelper.get().copyResultsToBuffer(commandBuffer, mResultBuffer, VK_QUERY_RESULT_64_BIT)
+            ? ResultCopyState::Recorded
+            : ResultCopyState::None;
+    return angle::Result::Continue;
+}
+
+angle::Result QueryVk::updateConditionalRenderingPredicate(const gl::Context *context,
+                                                           vk::BufferHelper **predicateOut)
+{
+    ASSERT(IsAnySamplesQuery(mType));
+    ContextVk *contextVk   = vk::GetImpl(context);
+    vk::Renderer *renderer = contextVk->getRenderer();
+
+    if (!mPredicateBuffer.valid())
+    {
+        ANGLE_TRY(contextVk->initBufferAllocation(
+            &mPredicateBuffer, renderer->getDeviceLocalMemoryTypeIndex(), sizeof(uint32_t),
+            renderer->getDefaultBufferAlignment(), BufferUsageType::Static));
+    }
+    *predicateOut = &mPredicateBuffer;
+
+    // If the result is held by a single query, it's copied to the predicate by the GPU.  The copy
+    // can't be recorded inside a render pass, so if the query was ended in the current render
+    // pass, the render pass is closed first.
+    if (mQueryHelper.isReferenced() && mStashedQueryHelpers.empty() &&
+        mQueryHelper.get().getQueryCount() == 1)
+    {
+        vk::QueryHelper &queryHelper = mQueryHelper.get();
+        if (contextVk->hasStartedRenderPass() &&
+            queryHelper.usedByCommandBuffer(
+                contextVk->getStartedRenderPassCommands().getQueueSerial()))
+        {
+            ANGLE_TRY(contextVk->flushCommandsAndEndRenderPass(
+                RenderPassClosureReason::ConditionalRenderingQueryCopy));
+        }
+
+        vk::CommandResources resources;
+        vk::OutsideRenderPassCommandBuffer *commandBuffer;
+        resources.onQueryAccess(&queryHelper);
+        resources.onBufferTransferWrite(&mPredicateBuffer);
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(resources, &commandBuffer));
+
+        if (queryHelper.copyResultsToBuffer(commandBuffer, mPredicateBuffer, 0))
+        {
+            return angle::Result::Continue;
+        }
+    }
+
+    // Otherwise, such as when the query was split over multiple render passes or used with
+    // multiview, the result is read back and written to the predicate.
+    bool passed = true;
+    ANGLE_TRY(getConditionalRenderingResult(context, &passed));
+
+    vk::CommandResources resources;
+    vk::OutsideRenderPassCommandBuffer *commandBuffer;
+    resources.onBufferTransferWrite(&mPredicateBuffer);
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(resources, &commandBuffer));
+    commandBuffer->fillBuffer(mPredicateBuffer.getBuffer(), mPredicateBuffer.getOffset(),
+                              sizeof(uint32_t), passed ? 1 : 0);
+
+    return angle::Result::Continue;
+}
+
+angle::Result QueryVk::getConditionalRenderingResult(const gl::Context *context, bool *passedOut)
+{
+    ANGLE_TRY(getResult(context, true));
+    *passedOut = mCachedResult != 0;
+    return angle::Result::Continue;
+}
+
+angle::Result QueryVk::getCopiedResult(ContextVk *contextVk, bool wait)
+{
+    vk::Renderer *renderer = contextVk->getRenderer();
+
+    if (!renderer->hasResourceUseFinished(mResultBuffer.getResourceUse()))
+    {
+        // See the comment in getResult() about forward progress when polling.
+        ANGLE_TRY(renderer->checkCompletedCommandsAndCleanup(contextVk));
+
+        if (!renderer->hasResourceUseFinished(mResultBuffer.getResourceUse()))
+        {
+            if (!wait)
+            {
+                return angle::Result::Continue;
+            }
+            ANGLE_VK_PERF_WARNING(contextVk, GL_DEBUG_SEVERITY_HIGH,
+                                  "GPU stall due to waiting on uncompleted query");
+            ANGLE_TRY(renderer->finishResourceUse(contextVk, mResultBuffer.getResourceUse()));
+        }
+    }
+
+    ANGLE_TRY(mResultBuffer.invalidate(renderer));
+
+    std::array<uint64_t, gl::IMPLEMENTATION_ANGLE_MULTIVIEW_MAX_VIEWS> results;
+    const uint32_t queryCount = mQueryHelper.get().getQueryCount();
+    ASSERT(queryCount <= results.size());
+    memcpy(results.data(), mResultBuffer.getMappedMemory(), queryCount * sizeof(uint64_t));
+
+    vk::QueryResult result(1);
+    result.setResults(results.data(), queryCount);
+
+    // OpenGL query result in these cases is binary
+    mCachedResult      = !!result.getResult(vk::QueryResult::kDefaultResultIndex);
+    mCachedResultValid = true;
+    return angle::Result::Continue;
+}
+
 bool QueryVk::isCurrentlyInUse(vk::Renderer *renderer) const
 {
     ASSERT(mQueryHelper.isReferenced());
@@ -501,6 +672,12 @@ angle::Result QueryVk::getResult(const gl::Context *context, bool wait)
             contextVk->getRenderer()->hasResourceUseSubmitted(mQueryHelper.get().getResourceUse()));
     }
 
+    // The copy is recorded on submission, after which reading the result is a memory read.
+    if (mResultCopyState == ResultCopyState::Recorded)
+    {
+        return getCopiedResult(contextVk, wait);
+    }
+
     // If the command buffer this query is being written to is still in flight and uses
     // vkCmdResetQueryPool, its reset command may not have been performed by the GPU yet.  To avoid
     // a race condition in this case, wait for the batch to finish first before querying (or return
@@ -47,8 +47,22 @@ class QueryVk : public QueryImpl
     angle::Result onRenderPassStart(ContextVk *contextVk);
     void onRenderPassEnd(ContextVk *contextVk);
 
+    // Called by ContextVk before submission for queries that asked for their result to be copied
+    // with copyOcclusionQueryResultsToBuffer.
+    angle::Result recordResultCopy(ContextVk *contextVk);
+
+    // NV_conditional_render: writes the result of an occlusion query to a buffer that's used as the
+    // predicate of VK_EXT_conditional_rendering.  The buffer is owned by the query.
+    angle::Result updateConditionalRenderingPredicate(const gl::Context *context,
+                                                      vk::BufferHelper **predicateOut);
+    // Reads the result of the query back for conditional rendering on the CPU, waiting for it if
+    // necessary.
+    angle::Result getConditionalRenderingResult(const gl::Context *context, bool *passedOut);
+
   private:
     angle::Result getResult(const gl::Context *context, bool wait);
+    angle::Result requestResultCopy(ContextVk *contextVk);
+    angle::Result getCopiedResult(ContextVk *contextVk, bool wait);
 
     bool isCurrentlyInUse(vk::Renderer *renderer) const;
     angle::Result finishRunningCommands(ContextVk *contextVk);
@@ -79,6 +93,21 @@ class QueryVk : public QueryImpl
 
     uint64_t mCachedResult;
     bool mCachedResultValid;
+
+    // With copyOcclusionQueryResultsToBuffer, the results of the query are copied to
+    // mResultBuffer when the commands that end it are submitted.  The buffer is kept for the
+    // lifetime of the query and reused by each begin/end.
+    enum class ResultCopyState
+    {
+        None,
+        Pending,
+        Recorded,
+    };
+    vk::BufferHelper mResultBuffer;
+    ResultCopyState mResultCopyState;
+
+    // The 32-bit predicate for NV_conditional_render.
+    vk::BufferHelper mPredicateBuffer;
 };
 
 }  // namespace rx
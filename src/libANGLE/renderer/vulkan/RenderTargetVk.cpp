@@ -436,6 +436,21 @@ bool RenderTargetVk::hasDefinedStencilContent() const
     return image->hasSubresourceDefinedStencilContent(mLevelIndexGL, mLayerIndex, mLayerCount);
 }
 
+gl::Rectangle RenderTargetVk::getInvalidatedArea() const
+{
+    vk::ImageHelper *image = getOwnerOfData();
+    const VkImageAspectFlagBits aspect =
+        image->isDepthOrStencil() ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+    return image->getSubresourceInvalidatedArea(mLevelIndexGL, mLayerIndex, mLayerCount, aspect);
+}
+
+gl::Rectangle RenderTargetVk::getInvalidatedStencilArea() const
+{
+    vk::ImageHelper *image = getOwnerOfData();
+    return image->getSubresourceInvalidatedArea(mLevelIndexGL, mLayerIndex, mLayerCount,
+                                                VK_IMAGE_ASPECT_STENCIL_BIT);
+}
+
 void RenderTargetVk::invalidateEntireContent(ContextVk *contextVk,
                                              bool *preferToKeepContentsDefinedOut)
 {
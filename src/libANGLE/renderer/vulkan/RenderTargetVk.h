@@ -139,6 +139,10 @@ class RenderTargetVk final : public FramebufferAttachmentRenderTarget
 
     bool hasDefinedContent() const;
     bool hasDefinedStencilContent() const;
+    // The area whose contents were left undefined by glInvalidateSubFramebuffer in a previous
+    // render pass, or an empty rectangle.  See ImageHelper::setSubresourceInvalidatedArea.
+    gl::Rectangle getInvalidatedArea() const;
+    gl::Rectangle getInvalidatedStencilArea() const;
     // Mark content as undefined so that certain optimizations are possible such as using DONT_CARE
     // as loadOp of the render target in the next renderpass.  If |preferToKeepContentsDefinedOut|
     // is set to true, it's preferred to ignore the invalidation due to image format and device
@@ -30,6 +30,8 @@ const char *GetCommandString(CommandID id)
     {
         case CommandID::Invalid:
             return "--Invalid--";
+        case CommandID::BeginConditionalRendering:
+            return "BeginConditionalRendering";
         case CommandID::BeginDebugUtilsLabel:
             return "BeginDebugUtilsLabel";
         case CommandID::BeginQuery:
@@ -80,6 +82,8 @@ const char *GetCommandString(CommandID id)
             return "CopyImage";
         case CommandID::CopyImageToBuffer:
             return "CopyImageToBuffer";
+        case CommandID::CopyQueryPoolResults:
+            return "CopyQueryPoolResults";
         case CommandID::Dispatch:
             return "Dispatch";
         case CommandID::DispatchIndirect:
@@ -104,6 +108,10 @@ const char *GetCommandString(CommandID id)
             return "DrawInstanced";
         case CommandID::DrawInstancedBaseInstance:
             return "DrawInstancedBaseInstance";
+        case CommandID::DrawRun:
+            return "DrawRun";
+        case CommandID::EndConditionalRendering:
+            return "EndConditionalRendering";
         case CommandID::EndDebugUtilsLabel:
             return "EndDebugUtilsLabel";
         case CommandID::EndQuery:
@@ -132,6 +140,8 @@ const char *GetCommandString(CommandID id)
             return "PipelineBarrier2";
         case CommandID::PushConstants:
             return "PushConstants";
+        case CommandID::PushDescriptorSet:
+            return "PushDescriptorSet";
         case CommandID::ResetEvent:
             return "ResetEvent";
         case CommandID::ResetQueryPool:
@@ -140,6 +150,8 @@ const char *GetCommandString(CommandID id)
             return "ResolveImage";
         case CommandID::SetBlendConstants:
             return "SetBlendConstants";
+        case CommandID::SetColorBlendEquation:
+            return "SetColorBlendEquation";
         case CommandID::SetCullMode:
             return "SetCullMode";
         case CommandID::SetDepthBias:
@@ -234,6 +246,16 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                 case CommandID::Invalid:
                     UNREACHABLE();
                     break;
+                case CommandID::BeginConditionalRendering:
+                {
+                    const BeginConditionalRenderingParams *params =
+                        getParamPtr<BeginConditionalRenderingParams>(currentCommand);
+                    const VkConditionalRenderingBeginInfoEXT beginInfo = {
+                        VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT, nullptr,
+                        params->buffer, params->offset, params->flags};
+                    vkCmdBeginConditionalRenderingEXT(cmdBuffer, &beginInfo);
+                    break;
+                }
                 case CommandID::BeginDebugUtilsLabel:
                 {
                     const DebugUtilsLabelParams *params =
@@ -463,8 +485,10 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                 {
                     const CopyBufferToImageParams *params =
                         getParamPtr<CopyBufferToImageParams>(currentCommand);
+                    const VkBufferImageCopy *regions =
+                        GetFirstArrayParameter<VkBufferImageCopy>(params);
                     vkCmdCopyBufferToImage(cmdBuffer, params->srcBuffer, params->dstImage,
-                                           params->dstImageLayout, 1, &params->region);
+                                           params->dstImageLayout, params->regionCount, regions);
                     break;
                 }
                 case CommandID::CopyImage:
@@ -478,8 +502,19 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                 {
                     const CopyImageToBufferParams *params =
                         getParamPtr<CopyImageToBufferParams>(currentCommand);
+                    const VkBufferImageCopy *regions =
+                        GetFirstArrayParameter<VkBufferImageCopy>(params);
                     vkCmdCopyImageToBuffer(cmdBuffer, params->srcImage, params->srcImageLayout,
-                                           params->dstBuffer, 1, &params->region);
+                                           params->dstBuffer, params->regionCount, regions);
+                    break;
+                }
+                case CommandID::CopyQueryPoolResults:
+                {
+                    const CopyQueryPoolResultsParams *params =
+                        getParamPtr<CopyQueryPoolResultsParams>(currentCommand);
+                    vkCmdCopyQueryPoolResults(cmdBuffer, params->queryPool, params->firstQuery,
+                                              params->queryCount, params->dstBuffer,
+                                              params->dstOffset, params->stride, params->flags);
                     break;
                 }
                 case CommandID::Dispatch:
@@ -573,6 +608,23 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                               params->firstVertex, params->firstInstance);
                     break;
                 }
+                case CommandID::DrawRun:
+                {
+                    const DrawRunParams *params = getParamPtr<DrawRunParams>(currentCommand);
+                    const DrawRunEntry *entries =
+                        Offset<DrawRunEntry>(params, sizeof(DrawRunParams));
+                    for (uint32_t drawIndex = 0; drawIndex < params->drawCount; ++drawIndex)
+                    {
+                        vkCmdDraw(cmdBuffer, entries[drawIndex].vertexCount, 1,
+                                  entries[drawIndex].firstVertex, 0);
+                    }
+                    break;
+                }
+                case CommandID::EndConditionalRendering:
+                {
+                    vkCmdEndConditionalRenderingEXT(cmdBuffer);
+                    break;
+                }
                 case CommandID::EndDebugUtilsLabel:
                 {
                     ASSERT(vkCmdEndDebugUtilsLabelEXT);
@@ -736,6 +788,48 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                                        params->size, data);
                     break;
                 }
+                case CommandID::PushDescriptorSet:
+                {
+                    const PushDescriptorSetParams *params =
+                        getParamPtr<PushDescriptorSetParams>(currentCommand);
+                    VkWriteDescriptorSet *descriptorWrites = const_cast<VkWriteDescriptorSet *>(
+                        GetFirstArrayParameter<VkWriteDescriptorSet>(params));
+                    const VkDescriptorImageInfo *imageInfos =
+                        GetNextArrayParameter<VkDescriptorImageInfo>(
+                            descriptorWrites, params->descriptorWriteCount);
+                    const VkDescriptorBufferInfo *bufferInfos =
+                        GetNextArrayParameter<VkDescriptorBufferInfo>(imageInfos,
+                                                                      params->imageInfoCount);
+                    const VkBufferView *bufferViews =
+                        GetNextArrayParameter<VkBufferView>(bufferInfos, params->bufferInfoCount);
+                    // Point the recorded writes at the infos that were copied after them.
+                    for (uint32_t writeIndex = 0; writeIndex < params->descriptorWriteCount;
+                         ++writeIndex)
+                    {
+                        VkWriteDescriptorSet &write = descriptorWrites[writeIndex];
+                        if (write.pTexelBufferView != nullptr)
+                        {
+                            write.pTexelBufferView = bufferViews;
+                            bufferViews += write.descriptorCount;
+                        }
+                        else if (write.pBufferInfo != nullptr)
+                        {
+                            write.pBufferInfo = bufferInfos;
+                            bufferInfos += write.descriptorCount;
+                        }
+                        else
+                        {
+                            write.pImageInfo = imageInfos;
+                            imageInfos += write.descriptorCount;
+                        }
+                    }
+                    ASSERT(vkCmdPushDescriptorSetKHR);
+                    vkCmdPushDescriptorSetKHR(
+                        cmdBuffer, static_cast<VkPipelineBindPoint>(params->pipelineBindPoint),
+                        params->layout, params->set, params->descriptorWriteCount,
+                        descriptorWrites);
+                    break;
+                }
                 case CommandID::ResetEvent:
                 {
                     const ResetEventParams *params = getParamPtr<ResetEventParams>(currentCommand);
@@ -765,6 +859,16 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdSetBlendConstants(cmdBuffer, params->blendConstants);
                     break;
                 }
+                case CommandID::SetColorBlendEquation:
+                {
+                    const SetColorBlendEquationParams *params =
+                        getParamPtr<SetColorBlendEquationParams>(currentCommand);
+                    const VkColorBlendEquationEXT *colorBlendEquations =
+                        GetFirstArrayParameter<VkColorBlendEquationEXT>(params);
+                    vkCmdSetColorBlendEquationEXT(cmdBuffer, 0, params->attachmentCount,
+                                                  colorBlendEquations);
+                    break;
+                }
                 case CommandID::SetCullMode:
                 {
                     const SetCullModeParams *params =
@@ -988,13 +1092,9 @@ void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
     mCommandAllocator.getMemoryUsageStats(usedMemoryOut, allocatedMemoryOut);
 }
 
-void SecondaryCommandBuffer::getMemoryUsageStatsForPoolAlloc(size_t blockSize,
-                                                             size_t *usedMemoryOut,
-                                                             size_t *allocatedMemoryOut) const
+size_t SecondaryCommandBuffer::getUsedMemoryForPoolAlloc() const
 {
-    *allocatedMemoryOut = blockSize * mCommands.size();
-
-    *usedMemoryOut = 0;
+    size_t usedMemory = 0;
     for (const CommandHeader *command : mCommands)
     {
         const CommandHeader *commandEnd = command;
@@ -1003,11 +1103,11 @@ void SecondaryCommandBuffer::getMemoryUsageStatsForPoolAlloc(size_t blockSize,
             commandEnd = NextCommand(commandEnd);
         }
 
-        *usedMemoryOut += reinterpret_cast<const uint8_t *>(commandEnd) -
-                          reinterpret_cast<const uint8_t *>(command) + sizeof(CommandHeader::id);
+        usedMemory += reinterpret_cast<const uint8_t *>(commandEnd) -
+                      reinterpret_cast<const uint8_t *>(command) + sizeof(CommandHeader::id);
     }
 
-    ASSERT(*usedMemoryOut <= *allocatedMemoryOut);
+    return usedMemory;
 }
 
 std::string SecondaryCommandBuffer::dumpCommands(const char *separator) const
@@ -44,6 +44,7 @@ enum class CommandID : uint16_t
 {
     // Invalid cmd used to mark end of sequence of commands
     Invalid = 0,
+    BeginConditionalRendering,
     BeginDebugUtilsLabel,
     BeginQuery,
     BeginTransformFeedback,
@@ -69,6 +70,7 @@ enum class CommandID : uint16_t
     CopyBufferToImage,
     CopyImage,
     CopyImageToBuffer,
+    CopyQueryPoolResults,
     Dispatch,
     DispatchIndirect,
     Draw,
@@ -81,6 +83,8 @@ enum class CommandID : uint16_t
     DrawIndirect,
     DrawInstanced,
     DrawInstancedBaseInstance,
+    DrawRun,
+    EndConditionalRendering,
     EndDebugUtilsLabel,
     EndQuery,
     EndTransformFeedback,
@@ -95,10 +99,12 @@ enum class CommandID : uint16_t
     PipelineBarrier,
     PipelineBarrier2,
     PushConstants,
+    PushDescriptorSet,
     ResetEvent,
     ResetQueryPool,
     ResolveImage,
     SetBlendConstants,
+    SetColorBlendEquation,
     SetCullMode,
     SetDepthBias,
     SetDepthBiasEnable,
@@ -142,6 +148,16 @@ ANGLE_ENABLE_STRUCT_PADDING_WARNINGS
 // Structs to encapsulate parameters for different commands.  This makes it easy to know the size of
 // params & to copy params.  Each struct must be prefixed by a CommandHeader (which is 4 bytes) and
 // must be aligned to 8 bytes.
+struct BeginConditionalRenderingParams
+{
+    CommandHeader header;
+
+    VkConditionalRenderingFlagsEXT flags;
+    VkBuffer buffer;
+    VkDeviceSize offset;
+};
+VERIFY_8_BYTE_ALIGNMENT(BeginConditionalRenderingParams)
+
 struct BeginQueryParams
 {
     CommandHeader header;
@@ -304,9 +320,9 @@ struct CopyBufferToImageParams
     CommandHeader header;
 
     VkImageLayout dstImageLayout;
+    uint32_t regionCount;
     VkBuffer srcBuffer;
     VkImage dstImage;
-    VkBufferImageCopy region;
 };
 VERIFY_8_BYTE_ALIGNMENT(CopyBufferToImageParams)
 
@@ -327,12 +343,27 @@ struct CopyImageToBufferParams
     CommandHeader header;
 
     VkImageLayout srcImageLayout;
+    uint32_t regionCount;
     VkImage srcImage;
     VkBuffer dstBuffer;
-    VkBufferImageCopy region;
 };
 VERIFY_8_BYTE_ALIGNMENT(CopyImageToBufferParams)
 
+struct CopyQueryPoolResultsParams
+{
+    CommandHeader header;
+
+    uint32_t firstQuery : 24;
+    uint32_t queryCount : 8;
+    VkQueryPool queryPool;
+    VkBuffer dstBuffer;
+    VkDeviceSize dstOffset;
+    VkDeviceSize stride;
+    VkQueryResultFlags flags;
+    uint32_t padding;
+};
+VERIFY_8_BYTE_ALIGNMENT(CopyQueryPoolResultsParams)
+
 // This is a common struct used by both begin & insert DebugUtilsLabelEXT() functions
 struct DebugUtilsLabelParams
 {
@@ -469,6 +500,33 @@ struct DrawInstancedBaseInstanceParams
 };
 VERIFY_8_BYTE_ALIGNMENT(DrawInstancedBaseInstanceParams)
 
+// A run of consecutive non-indexed draws with no other command recorded in between, so they share
+// all pipeline and descriptor state.  The header is followed by drawCount DrawRunEntry structs.
+struct DrawRunParams
+{
+    CommandHeader header;
+
+    uint32_t drawCount;
+};
+VERIFY_8_BYTE_ALIGNMENT(DrawRunParams)
+
+struct DrawRunEntry
+{
+    uint32_t vertexCount;
+    uint32_t firstVertex;
+};
+VERIFY_8_BYTE_ALIGNMENT(DrawRunEntry)
+
+// A Draw command is converted in place to a DrawRun when the following draw is appended to it.
+static_assert(sizeof(DrawParams) == sizeof(DrawRunParams) + sizeof(DrawRunEntry),
+              "DrawParams must have the same layout as a single-entry DrawRun");
+static_assert(offsetof(DrawParams, vertexCount) ==
+                  sizeof(DrawRunParams) + offsetof(DrawRunEntry, vertexCount),
+              "DrawParams must have the same layout as a single-entry DrawRun");
+static_assert(offsetof(DrawParams, firstVertex) ==
+                  sizeof(DrawRunParams) + offsetof(DrawRunEntry, firstVertex),
+              "DrawParams must have the same layout as a single-entry DrawRun");
+
 // A special struct used with commands that don't have params
 struct EmptyParams
 {
@@ -584,6 +642,22 @@ struct PushConstantsParams
 };
 VERIFY_8_BYTE_ALIGNMENT(PushConstantsParams)
 
+struct PushDescriptorSetParams
+{
+    CommandHeader header;
+
+    // Actually a VkPipelineBindPoint; valid values are GRAPHICS or COMPUTE.
+    uint32_t pipelineBindPoint : 8;
+    uint32_t set : 8;
+    uint32_t descriptorWriteCount : 16;
+
+    VkPipelineLayout layout;
+    uint32_t imageInfoCount : 16;
+    uint32_t bufferInfoCount : 16;
+    uint32_t bufferViewCount;
+};
+VERIFY_8_BYTE_ALIGNMENT(PushDescriptorSetParams)
+
 struct ResetEventParams
 {
     CommandHeader header;
@@ -624,6 +698,15 @@ struct SetBlendConstantsParams
 };
 VERIFY_8_BYTE_ALIGNMENT(SetBlendConstantsParams)
 
+// Followed by attachmentCount VkColorBlendEquationEXT structs.
+struct SetColorBlendEquationParams
+{
+    CommandHeader header;
+
+    uint32_t attachmentCount;
+};
+VERIFY_8_BYTE_ALIGNMENT(SetColorBlendEquationParams)
+
 struct SetCullModeParams
 {
     CommandHeader header;
@@ -886,6 +969,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     }
 
     // Add commands
+    void beginConditionalRendering(const VkConditionalRenderingBeginInfoEXT &beginInfo);
+
     void beginDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT &label);
 
     void beginQuery(const QueryPool &queryPool, uint32_t query, VkQueryControlFlags flags);
@@ -1005,6 +1090,14 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                            uint32_t regionCount,
                            const VkBufferImageCopy *regions);
 
+    void copyQueryPoolResults(const QueryPool &queryPool,
+                              uint32_t firstQuery,
+                              uint32_t queryCount,
+                              VkBuffer dstBuffer,
+                              VkDeviceSize dstOffset,
+                              VkDeviceSize stride,
+                              VkQueryResultFlags flags);
+
     void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
 
     void dispatchIndirect(const Buffer &buffer, VkDeviceSize offset);
@@ -1038,6 +1131,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                                    uint32_t firstVertex,
                                    uint32_t firstInstance);
 
+    void endConditionalRendering();
+
     void endDebugUtilsLabelEXT();
 
     void endQuery(const QueryPool &queryPool, uint32_t query);
@@ -1098,6 +1193,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                        uint32_t size,
                        const void *data);
 
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t descriptorWriteCount,
+                           const VkWriteDescriptorSet *descriptorWrites);
+
     void resetEvent(VkEvent event, VkPipelineStageFlags stageMask);
 
     void resetQueryPool(const QueryPool &queryPool, uint32_t firstQuery, uint32_t queryCount);
@@ -1110,6 +1211,9 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                       const VkImageResolve *regions);
 
     void setBlendConstants(const float blendConstants[4]);
+    void setColorBlendEquation(uint32_t firstAttachment,
+                               uint32_t attachmentCount,
+                               const VkColorBlendEquationEXT *colorBlendEquations);
     void setCullMode(VkCullModeFlags cullMode);
     void setDepthBias(float depthBiasConstantFactor,
                       float depthBiasClamp,
@@ -1170,9 +1274,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     // Calculate memory usage of this command buffer for diagnostics.
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
-    void getMemoryUsageStatsForPoolAlloc(size_t blockSize,
-                                         size_t *usedMemoryOut,
-                                         size_t *allocatedMemoryOut) const;
+    size_t getUsedMemoryForPoolAlloc() const;
 
     // Traverse the list of commands and build a summary for diagnostics.
     std::string dumpCommands(const char *separator) const;
@@ -1200,6 +1302,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     {
         mCommands.clear();
         mCommandAllocator.reset(&mCommandTracker);
+        mLastDraw = nullptr;
     }
 
     // The SecondaryCommandBuffer is valid if it's been initialized
@@ -1321,9 +1424,13 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     SecondaryCommandBlockPool mCommandAllocator;
 
     CommandBufferCommandTracker mCommandTracker;
+
+    // The last Draw or DrawRun command recorded.  A following draw is appended to it if no other
+    // command was recorded in between.
+    CommandHeader *mLastDraw;
 };
 
-ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer() : mIsOpen(true)
+ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer() : mIsOpen(true), mLastDraw(nullptr)
 {
     mCommandAllocator.setCommandBuffer(this);
 }
@@ -1354,6 +1461,17 @@ ANGLE_INLINE void SecondaryCommandBuffer::beginDebugUtilsLabelEXT(const VkDebugU
     commonDebugUtilsLabel(CommandID::BeginDebugUtilsLabel, label);
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::beginConditionalRendering(
+    const VkConditionalRenderingBeginInfoEXT &beginInfo)
+{
+    ASSERT(beginInfo.pNext == nullptr);
+    BeginConditionalRenderingParams *paramStruct =
+        initCommand<BeginConditionalRenderingParams>(CommandID::BeginConditionalRendering);
+    paramStruct->flags  = beginInfo.flags;
+    paramStruct->buffer = beginInfo.buffer;
+    paramStruct->offset = beginInfo.offset;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::beginQuery(const QueryPool &queryPool,
                                                      uint32_t query,
                                                      VkQueryControlFlags flags)
@@ -1704,13 +1822,16 @@ ANGLE_INLINE void SecondaryCommandBuffer::copyBufferToImage(VkBuffer srcBuffer,
                                                             uint32_t regionCount,
                                                             const VkBufferImageCopy *regions)
 {
-    ASSERT(regionCount == 1);
-    CopyBufferToImageParams *paramStruct =
-        initCommand<CopyBufferToImageParams>(CommandID::CopyBufferToImage);
+    uint8_t *writePtr;
+    const ArrayParamSize regionSize = calculateArrayParameterSize<VkBufferImageCopy>(regionCount);
+    CopyBufferToImageParams *paramStruct = initCommand<CopyBufferToImageParams>(
+        CommandID::CopyBufferToImage, regionSize.allocateBytes, &writePtr);
     paramStruct->srcBuffer      = srcBuffer;
     paramStruct->dstImage       = dstImage.getHandle();
     paramStruct->dstImageLayout = dstImageLayout;
-    paramStruct->region         = regions[0];
+    paramStruct->regionCount    = regionCount;
+    // Copy variable sized data
+    storeArrayParameter(writePtr, regions, regionSize);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::copyImage(const Image &srcImage,
@@ -1735,13 +1856,35 @@ ANGLE_INLINE void SecondaryCommandBuffer::copyImageToBuffer(const Image &srcImag
                                                             uint32_t regionCount,
                                                             const VkBufferImageCopy *regions)
 {
-    ASSERT(regionCount == 1);
-    CopyImageToBufferParams *paramStruct =
-        initCommand<CopyImageToBufferParams>(CommandID::CopyImageToBuffer);
+    uint8_t *writePtr;
+    const ArrayParamSize regionSize = calculateArrayParameterSize<VkBufferImageCopy>(regionCount);
+    CopyImageToBufferParams *paramStruct = initCommand<CopyImageToBufferParams>(
+        CommandID::CopyImageToBuffer, regionSize.allocateBytes, &writePtr);
     paramStruct->srcImage       = srcImage.getHandle();
     paramStruct->srcImageLayout = srcImageLayout;
     paramStruct->dstBuffer      = dstBuffer;
-    paramStruct->region         = regions[0];
+    paramStruct->regionCount    = regionCount;
+    // Copy variable sized data
+    storeArrayParameter(writePtr, regions, regionSize);
+}
+
+ANGLE_INLINE void SecondaryCommandBuffer::copyQueryPoolResults(const QueryPool &queryPool,
+                                                               uint32_t firstQuery,
+                                                               uint32_t queryCount,
+                                                               VkBuffer dstBuffer,
+                                                               VkDeviceSize dstOffset,
+                                                               VkDeviceSize stride,
+                                                               VkQueryResultFlags flags)
+{
+    CopyQueryPoolResultsParams *paramStruct =
+        initCommand<CopyQueryPoolResultsParams>(CommandID::CopyQueryPoolResults);
+    paramStruct->queryPool = queryPool.getHandle();
+    SetBitField(paramStruct->firstQuery, firstQuery);
+    SetBitField(paramStruct->queryCount, queryCount);
+    paramStruct->dstBuffer = dstBuffer;
+    paramStruct->dstOffset = dstOffset;
+    paramStruct->stride    = stride;
+    paramStruct->flags     = flags;
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::dispatch(uint32_t groupCountX,
@@ -1765,9 +1908,38 @@ ANGLE_INLINE void SecondaryCommandBuffer::dispatchIndirect(const Buffer &buffer,
 
 ANGLE_INLINE void SecondaryCommandBuffer::draw(uint32_t vertexCount, uint32_t firstVertex)
 {
+    // Draws recorded back to back share all state, so instead of paying a header per draw, the
+    // draw is appended to the previous one if it is the last command in the block.
+    if (mLastDraw != nullptr)
+    {
+        uint8_t *entryMemory = mCommandAllocator.tryExtendLastCommand(
+            Offset<uint8_t>(mLastDraw, mLastDraw->size), sizeof(DrawRunEntry));
+        if (entryMemory != nullptr)
+        {
+            DrawRunParams *runStruct = reinterpret_cast<DrawRunParams *>(mLastDraw);
+            if (runStruct->header.id == CommandID::Draw)
+            {
+                runStruct->header.id = CommandID::DrawRun;
+                runStruct->drawCount = 1;
+            }
+            ASSERT(runStruct->header.size + sizeof(DrawRunEntry) <=
+                   std::numeric_limits<uint16_t>::max());
+            runStruct->header.size += sizeof(DrawRunEntry);
+            runStruct->drawCount++;
+
+            DrawRunEntry *entry = reinterpret_cast<DrawRunEntry *>(entryMemory);
+            entry->vertexCount  = vertexCount;
+            entry->firstVertex  = firstVertex;
+
+            mCommandTracker.onDraw();
+            return;
+        }
+    }
+
     DrawParams *paramStruct  = initCommand<DrawParams>(CommandID::Draw);
     paramStruct->vertexCount = vertexCount;
     paramStruct->firstVertex = firstVertex;
+    mLastDraw                = &paramStruct->header;
 
     mCommandTracker.onDraw();
 }
@@ -1891,6 +2063,11 @@ ANGLE_INLINE void SecondaryCommandBuffer::drawInstancedBaseInstance(uint32_t ver
     mCommandTracker.onDraw();
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::endConditionalRendering()
+{
+    initCommand<EmptyParams>(CommandID::EndConditionalRendering);
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::endDebugUtilsLabelEXT()
 {
     initCommand<EmptyParams>(CommandID::EndDebugUtilsLabel);
@@ -2116,6 +2293,93 @@ ANGLE_INLINE void SecondaryCommandBuffer::pushConstants(const PipelineLayout &la
     storeArrayParameter(writePtr, data, dataSize);
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::pushDescriptorSet(
+    const PipelineLayout &layout,
+    VkPipelineBindPoint pipelineBindPoint,
+    DescriptorSetIndex set,
+    uint32_t descriptorWriteCount,
+    const VkWriteDescriptorSet *descriptorWrites)
+{
+    ASSERT(pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS ||
+           pipelineBindPoint == VK_PIPELINE_BIND_POINT_COMPUTE);
+
+    // The image, buffer and texel buffer infos are copied after the writes, and the write pointers
+    // are patched to the copies when the command is replayed.
+    uint32_t imageInfoCount  = 0;
+    uint32_t bufferInfoCount = 0;
+    uint32_t bufferViewCount = 0;
+    for (uint32_t writeIndex = 0; writeIndex < descriptorWriteCount; ++writeIndex)
+    {
+        const VkWriteDescriptorSet &write = descriptorWrites[writeIndex];
+        ASSERT(write.pNext == nullptr);
+        if (write.pTexelBufferView != nullptr)
+        {
+            bufferViewCount += write.descriptorCount;
+        }
+        else if (write.pBufferInfo != nullptr)
+        {
+            bufferInfoCount += write.descriptorCount;
+        }
+        else
+        {
+            ASSERT(write.pImageInfo != nullptr);
+            imageInfoCount += write.descriptorCount;
+        }
+    }
+
+    uint8_t *writePtr;
+    const ArrayParamSize writeSize =
+        calculateArrayParameterSize<VkWriteDescriptorSet>(descriptorWriteCount);
+    const ArrayParamSize imageInfoSize =
+        calculateArrayParameterSize<VkDescriptorImageInfo>(imageInfoCount);
+    const ArrayParamSize bufferInfoSize =
+        calculateArrayParameterSize<VkDescriptorBufferInfo>(bufferInfoCount);
+    const ArrayParamSize bufferViewSize =
+        calculateArrayParameterSize<VkBufferView>(bufferViewCount);
+    PushDescriptorSetParams *paramStruct = initCommand<PushDescriptorSetParams>(
+        CommandID::PushDescriptorSet,
+        writeSize.allocateBytes + imageInfoSize.allocateBytes + bufferInfoSize.allocateBytes +
+            bufferViewSize.allocateBytes,
+        &writePtr);
+    paramStruct->layout = layout.getHandle();
+    SetBitField(paramStruct->pipelineBindPoint, pipelineBindPoint);
+    SetBitField(paramStruct->set, ToUnderlying(set));
+    SetBitField(paramStruct->descriptorWriteCount, descriptorWriteCount);
+    SetBitField(paramStruct->imageInfoCount, imageInfoCount);
+    SetBitField(paramStruct->bufferInfoCount, bufferInfoCount);
+    paramStruct->bufferViewCount = bufferViewCount;
+    // Copy variable sized data
+    writePtr = storeArrayParameter(writePtr, descriptorWrites, writeSize);
+
+    VkDescriptorImageInfo *imageInfos = reinterpret_cast<VkDescriptorImageInfo *>(writePtr);
+    writePtr += imageInfoSize.allocateBytes;
+    VkDescriptorBufferInfo *bufferInfos = reinterpret_cast<VkDescriptorBufferInfo *>(writePtr);
+    writePtr += bufferInfoSize.allocateBytes;
+    VkBufferView *bufferViews = reinterpret_cast<VkBufferView *>(writePtr);
+    for (uint32_t writeIndex = 0; writeIndex < descriptorWriteCount; ++writeIndex)
+    {
+        const VkWriteDescriptorSet &write = descriptorWrites[writeIndex];
+        if (write.pTexelBufferView != nullptr)
+        {
+            memcpy(bufferViews, write.pTexelBufferView,
+                   sizeof(VkBufferView) * write.descriptorCount);
+            bufferViews += write.descriptorCount;
+        }
+        else if (write.pBufferInfo != nullptr)
+        {
+            memcpy(bufferInfos, write.pBufferInfo,
+                   sizeof(VkDescriptorBufferInfo) * write.descriptorCount);
+            bufferInfos += write.descriptorCount;
+        }
+        else
+        {
+            memcpy(imageInfos, write.pImageInfo,
+                   sizeof(VkDescriptorImageInfo) * write.descriptorCount);
+            imageInfos += write.descriptorCount;
+        }
+    }
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::resetEvent(VkEvent event, VkPipelineStageFlags stageMask)
 {
     ResetEventParams *paramStruct = initCommand<ResetEventParams>(CommandID::ResetEvent);
@@ -2161,6 +2425,22 @@ ANGLE_INLINE void SecondaryCommandBuffer::setBlendConstants(const float blendCon
     }
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::setColorBlendEquation(
+    uint32_t firstAttachment,
+    uint32_t attachmentCount,
+    const VkColorBlendEquationEXT *colorBlendEquations)
+{
+    ASSERT(firstAttachment == 0);
+    uint8_t *writePtr;
+    const ArrayParamSize equationSize =
+        calculateArrayParameterSize<VkColorBlendEquationEXT>(attachmentCount);
+    SetColorBlendEquationParams *paramStruct = initCommand<SetColorBlendEquationParams>(
+        CommandID::SetColorBlendEquation, equationSize.allocateBytes, &writePtr);
+    paramStruct->attachmentCount = attachmentCount;
+    // Copy variable sized data
+    storeArrayParameter(writePtr, colorBlendEquations, equationSize);
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::setCullMode(VkCullModeFlags cullMode)
 {
     SetCullModeParams *paramStruct = initCommand<SetCullModeParams>(CommandID::SetCullMode);
@@ -24,6 +24,7 @@ SemaphoreVk::~SemaphoreVk() = default;
 void SemaphoreVk::onDestroy(const gl::Context *context)
 {
     ContextVk *contextVk = vk::GetImpl(context);
+    contextVk->onSemaphoreDestroyed(&mSemaphore);
     contextVk->addGarbage(&mSemaphore);
 }
 
@@ -65,6 +66,10 @@ angle::Result SemaphoreVk::wait(gl::Context *context,
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
+    // The wait is added to the next submission, which must not be the one signaling a semaphore
+    // that the external side may need to see first.
+    ANGLE_TRY(contextVk->flushDeferredSignalSemaphore(QueueSubmitReason::ExternalSemaphoreSignal));
+
     if (!bufferBarriers.empty() || !textureBarriers.empty())
     {
         // Create one global memory barrier to cover all barriers.
@@ -185,6 +190,11 @@ angle::Result SemaphoreVk::signal(gl::Context *context,
         ANGLE_TRY(contextVk->syncExternalMemory());
     }
 
+    if (contextVk->getFeatures().deferExternalSemaphoreSignal.enabled)
+    {
+        return contextVk->deferSignalSemaphore(&mSemaphore);
+    }
+
     return contextVk->flushAndSubmitCommands(&mSemaphore, nullptr,
                                              QueueSubmitReason::ExternalSemaphoreSignal);
 }
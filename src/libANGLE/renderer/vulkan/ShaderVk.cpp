@@ -58,6 +58,13 @@ std::shared_ptr<ShaderTranslateTask> ShaderVk::compile(const gl::Context *contex
     if (contextVk->getShareGroup()->hasAnyContextWithRobustness())
     {
         options->clampIndirectArrayBounds = true;
+
+        // Every pipeline of the share group then uses robust buffer access, which covers the
+        // arrays in buffer blocks.  See ContextVk::pipelineRobustness().
+        if (contextVk->getFeatures().preferRobustBufferAccessToIndexClamping.enabled)
+        {
+            options->skipClampingIndirectIndicesInBufferBlocks = true;
+        }
     }
 
     if (contextVk->getFeatures().clampPointSize.enabled)
@@ -30,10 +30,21 @@ namespace
 {
 // How often monolithic pipelines should be created, if preferMonolithicPipelinesOverLibraries is
 // enabled.  Pipeline creation is typically O(hundreds of microseconds).  A value of 2ms is chosen
-// arbitrarily; it ensures that there is always at most a single pipeline job in progress, while
+// arbitrarily; it ensures that there are usually few pipeline jobs in progress, while
 // maintaining a high throughput of 500 pipelines / second for heavier applications.
 constexpr double kMonolithicPipelineJobPeriod = 0.002;
 
+// One core out of every this many may be busy creating monolithic pipelines, so that a burst of
+// new linked pipelines is replaced quickly on machines with many cores without taking over the
+// ones that the application needs.
+constexpr uint32_t kCoresPerMonolithicPipelineJob = 4;
+
+// The maximum number of monolithic pipeline creation jobs that are posted per frame for pipelines
+// that are anticipated to be used (if prewarmMonolithicPipelineTransitions is enabled).  This keeps
+// the speculative work from taking over the worker thread time that's needed for pipelines that are
+// actually in use.
+constexpr uint32_t kMaxPrewarmMonolithicPipelineJobsPerFrame = 8;
+
 // Time interval in seconds that we should try to prune default buffer pools.
 constexpr double kTimeElapsedForPruneDefaultBufferPool = 0.25;
 
@@ -66,9 +77,15 @@ ShareGroupVk::ShareGroupVk(const egl::ShareGroupState &state, vk::Renderer *rend
       mCurrentFrameCount(0),
       mContextsPriority(egl::ContextPriority::InvalidEnum),
       mIsContextsPriorityLocked(false),
-      mLastMonolithicPipelineJobTime(0)
+      mLastMonolithicPipelineJobTime(0),
+      mMaxConcurrentMonolithicPipelineJobs(1),
+      mPrewarmMonolithicPipelineJobCount(0)
 {
     mLastPruneTime = angle::GetCurrentSystemTime();
+
+    mMaxConcurrentMonolithicPipelineJobs =
+        std::clamp<size_t>(std::thread::hardware_concurrency() / kCoresPerMonolithicPipelineJob, 1,
+                           kMaxConcurrentMonolithicPipelineJobs);
 }
 
 void ShareGroupVk::onContextAdd()
@@ -203,8 +220,18 @@ angle::Result ShareGroupVk::scheduleMonolithicPipelineCreationTask(
 {
     ASSERT(contextVk->getFeatures().preferMonolithicPipelinesOverLibraries.enabled);
 
-    // Limit to a single task to avoid hogging all the cores.
-    if (mMonolithicPipelineCreationEvent && !mMonolithicPipelineCreationEvent->isReady())
+    // Limit the number of tasks in progress to avoid hogging all the cores.
+    std::shared_ptr<angle::WaitableEvent> *freeEvent = nullptr;
+    for (size_t jobIndex = 0; jobIndex < mMaxConcurrentMonolithicPipelineJobs; ++jobIndex)
+    {
+        std::shared_ptr<angle::WaitableEvent> &event = mMonolithicPipelineCreationEvents[jobIndex];
+        if (!event || event->isReady())
+        {
+            freeEvent = &event;
+            break;
+        }
+    }
+    if (freeEvent == nullptr)
     {
         return angle::Result::Continue;
     }
@@ -227,19 +254,44 @@ angle::Result ShareGroupVk::scheduleMonolithicPipelineCreationTask(
                                                  &compatibleRenderPass));
     taskOut->setRenderPass(compatibleRenderPass);
 
-    mMonolithicPipelineCreationEvent =
-        mRenderer->getGlobalOps()->postMultiThreadWorkerTask(taskOut->getTask());
+    *freeEvent = mRenderer->getGlobalOps()->postMultiThreadWorkerTask(
+        taskOut->getTask(), angle::WorkerTaskPriority::Background);
+
+    taskOut->onSchedule(*freeEvent);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ShareGroupVk::schedulePrewarmMonolithicPipelineCreationTask(
+    ContextVk *contextVk,
+    vk::WaitableMonolithicPipelineCreationTask *taskOut)
+{
+    ASSERT(contextVk->getFeatures().prewarmMonolithicPipelineTransitions.enabled);
+
+    if (mPrewarmMonolithicPipelineJobCount >= kMaxPrewarmMonolithicPipelineJobsPerFrame)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(scheduleMonolithicPipelineCreationTask(contextVk, taskOut));
 
-    taskOut->onSchedule(mMonolithicPipelineCreationEvent);
+    if (taskOut->isPosted())
+    {
+        ++mPrewarmMonolithicPipelineJobCount;
+        ++contextVk->getPerfCounters().monolithicPipelinePrewarms;
+    }
 
     return angle::Result::Continue;
 }
 
-void ShareGroupVk::waitForCurrentMonolithicPipelineCreationTask()
+void ShareGroupVk::waitForCurrentMonolithicPipelineCreationTasks()
 {
-    if (mMonolithicPipelineCreationEvent)
+    for (std::shared_ptr<angle::WaitableEvent> &event : mMonolithicPipelineCreationEvents)
     {
-        mMonolithicPipelineCreationEvent->wait();
+        if (event)
+        {
+            event->wait();
+        }
     }
 }
 
@@ -289,7 +341,11 @@ void TextureUpload::onTextureRelease(TextureVk *textureVk)
 
 void ShareGroupVk::onFrameBoundary()
 {
-    if (isDueForBufferPoolPrune())
+    if (mRenderer->isUnderMemoryBudgetPressure())
+    {
+        trimMemoryOnBudgetPressure();
+    }
+    else if (isDueForBufferPoolPrune())
     {
         pruneDefaultBufferPools();
     }
@@ -297,6 +353,8 @@ void ShareGroupVk::onFrameBoundary()
     // Always clean up event garbage and destroy the excessive free list at frame boundary.
     cleanupRefCountedEventGarbage();
 
+    mPrewarmMonolithicPipelineJobCount = 0;
+
     mCurrentFrameCount++;
 }
 
@@ -325,8 +383,10 @@ void ShareGroupVk::pruneDefaultBufferPools()
 {
     mLastPruneTime = angle::GetCurrentSystemTime();
 
-    // Bail out if no suballocation have been destroyed since last prune.
-    if (mRenderer->getSuballocationDestroyedSize() == 0)
+    // Bail out if no suballocation have been destroyed since last prune.  Under memory pressure,
+    // the empty buffers kept around by previous prunes are freed as well.
+    if (mRenderer->getSuballocationDestroyedSize() == 0 &&
+        !mRenderer->isUnderMemoryBudgetPressure())
     {
         return;
     }
@@ -346,6 +406,24 @@ void ShareGroupVk::pruneDefaultBufferPools()
 #endif
 }
 
+void ShareGroupVk::trimMemoryOnBudgetPressure()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ShareGroupVk::trimMemoryOnBudgetPressure");
+
+    // Free the empty buffer blocks, which are otherwise kept for reuse up to
+    // kMaxTotalEmptyBufferBytes per pool.  This includes the blocks used for staging buffers.
+    pruneDefaultBufferPools();
+
+    // Free the descriptor pools that no longer hold any descriptor sets in use.
+    if (mRenderer->getFeatures().descriptorSetCache.enabled)
+    {
+        for (vk::MetaDescriptorPool &metaDescriptorPool : mMetaDescriptorPools)
+        {
+            metaDescriptorPool.destroyUnusedPools(mRenderer);
+        }
+    }
+}
+
 bool ShareGroupVk::isDueForBufferPoolPrune()
 {
     // Ensure we periodically prune to maintain the heuristic information
@@ -20,6 +20,9 @@ namespace rx
 {
 constexpr VkDeviceSize kMaxTotalEmptyBufferBytes = 16 * 1024 * 1024;
 
+// The most monolithic pipeline creation jobs that can be in progress at the same time.
+constexpr size_t kMaxConcurrentMonolithicPipelineJobs = 4;
+
 class TextureUpload
 {
   public:
@@ -85,7 +88,12 @@ class ShareGroupVk : public ShareGroupImpl
     angle::Result scheduleMonolithicPipelineCreationTask(
         ContextVk *contextVk,
         vk::WaitableMonolithicPipelineCreationTask *taskOut);
-    void waitForCurrentMonolithicPipelineCreationTask();
+    // Same as scheduleMonolithicPipelineCreationTask, but for pipelines that are not yet in use and
+    // are only anticipated to be.  These are additionally limited by a per-frame budget.
+    angle::Result schedulePrewarmMonolithicPipelineCreationTask(
+        ContextVk *contextVk,
+        vk::WaitableMonolithicPipelineCreationTask *taskOut);
+    void waitForCurrentMonolithicPipelineCreationTasks();
 
     vk::RefCountedEventsGarbageRecycler *getRefCountedEventsGarbageRecycler()
     {
@@ -112,6 +120,8 @@ class ShareGroupVk : public ShareGroupImpl
     angle::Result updateContextsPriority(ContextVk *contextVk, egl::ContextPriority newPriority);
 
     bool isDueForBufferPoolPrune();
+    // Called at frame boundaries while memory usage is close to the budget.
+    void trimMemoryOnBudgetPressure();
 
     vk::Renderer *mRenderer;
 
@@ -148,10 +158,16 @@ class ShareGroupVk : public ShareGroupImpl
     double mLastPruneTime;
 
     // The system time when the last monolithic pipeline creation job was launched.  This is
-    // rate-limited to avoid hogging all cores and interfering with the application threads.  A
-    // single pipeline creation job is currently supported.
+    // rate-limited to avoid hogging all cores and interfering with the application threads.  A few
+    // pipeline creation jobs may be in progress at the same time, depending on the number of cores.
     double mLastMonolithicPipelineJobTime;
-    std::shared_ptr<angle::WaitableEvent> mMonolithicPipelineCreationEvent;
+    size_t mMaxConcurrentMonolithicPipelineJobs;
+    std::array<std::shared_ptr<angle::WaitableEvent>, kMaxConcurrentMonolithicPipelineJobs>
+        mMonolithicPipelineCreationEvents;
+    // The number of monolithic pipeline creation jobs posted in the current frame for pipelines
+    // that have not been used yet (see prewarmMonolithicPipelineTransitions).  Reset on frame
+    // boundary.
+    uint32_t mPrewarmMonolithicPipelineJobCount;
 
     // Texture update manager used to flush uploaded mutable textures.
     TextureUpload mTextureUpload;
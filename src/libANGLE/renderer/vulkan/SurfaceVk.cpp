@@ -14,6 +14,7 @@
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Overlay.h"
@@ -44,6 +45,23 @@ constexpr uint32_t kInvalidImageIndex = std::numeric_limits<uint32_t>::max();
 
 constexpr uint32_t kNeverPreserved = 0;
 
+// The number of frames whose damage is remembered.  A swapchain image older than this is updated
+// entirely from the ancillary color image.
+constexpr size_t kMaxDamageHistory = 8;
+
+// Maximum number of presents waiting for their display time to be reported by
+// VK_GOOGLE_display_timing.  Older presents are dropped, as their timing may never be reported
+// (for example if the swapchain is recreated).
+constexpr size_t kMaxPendingPresentTimes = 8;
+
+uint32_t SecondsToMicroseconds(double seconds)
+{
+    // Clamp to what can be returned through an EGLint.
+    const double microseconds = std::max(seconds, 0.0) * 1e6;
+    return static_cast<uint32_t>(
+        std::min(microseconds, static_cast<double>(std::numeric_limits<EGLint>::max())));
+}
+
 GLint GetSampleCount(const egl::Config *config)
 {
     GLint samples = 1;
@@ -561,8 +579,11 @@ void AcquireNextImageUnlocked(VkDevice device,
     result->acquireSemaphore = data->acquireImageSemaphores.front().getHandle();
 
     // Try to acquire an image.
+    const double acquireStartTime = angle::GetCurrentSystemTime();
     result->result = vkAcquireNextImageKHR(device, swapchain, UINT64_MAX, result->acquireSemaphore,
                                            VK_NULL_HANDLE, &result->imageIndex);
+    result->acquireLatencyUs =
+        SecondsToMicroseconds(angle::GetCurrentSystemTime() - acquireStartTime);
 
     if (!IsImageAcquireFailed(result->result))
     {
@@ -2500,8 +2521,83 @@ bool WindowSurfaceVk::shouldRetainColor() const
     return mPreserveOnSwap || mIsBufferAgeQueried || isSharedPresentMode();
 }
 
+gl::Rectangle WindowSurfaceVk::getFrameDamage(const EGLint *rects, EGLint n_rects) const
+{
+    const gl::Rectangle fullArea(0, 0, mWidth, mHeight);
+    if (n_rects <= 0)
+    {
+        return fullArea;
+    }
+
+    // The damage is kept in the top-left origin of the image, as rendered into.
+    gl::Rectangle damage;
+    for (EGLint i = 0; i < n_rects; i++)
+    {
+        const VkRectLayerKHR rect = ToVkRectLayer(rects + i * 4, mWidth, mHeight, false);
+        const gl::Rectangle damageRect(rect.offset.x, rect.offset.y, rect.extent.width,
+                                       rect.extent.height);
+        if (damageRect.empty())
+        {
+            continue;
+        }
+        if (damage.empty())
+        {
+            damage = damageRect;
+        }
+        else
+        {
+            gl::GetEnclosingRectangle(damage, damageRect, &damage);
+        }
+    }
+    return damage;
+}
+
+gl::Rectangle WindowSurfaceVk::getAncillaryColorCopyArea(const SwapchainImage &image,
+                                                         const gl::Rectangle &frameDamage) const
+{
+    const gl::Rectangle fullArea(0, 0, mWidth, mHeight);
+
+    // The swapchain image can only be partially updated if it still holds the contents of the
+    // frame it was last presented with.  That is only the case if its contents are retained (and
+    // were retained when it was acquired, i.e. preserve mode wasn't just turned on), and if the
+    // damage of every frame since then is known.  Rotated swapchains are always fully updated.
+    if (!mPreserveOnSwap || mFrameCount <= mPreserveStartFrame || image.frameNumber == 0 ||
+        getPreTransform() != VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR)
+    {
+        return fullArea;
+    }
+
+    ASSERT(mFrameCount > image.frameNumber);
+    const size_t previousFrames = static_cast<size_t>(mFrameCount - image.frameNumber - 1);
+    if (previousFrames > mDamageHistory.size())
+    {
+        return fullArea;
+    }
+
+    gl::Rectangle copyArea = frameDamage;
+    for (size_t index = mDamageHistory.size() - previousFrames; index < mDamageHistory.size();
+         ++index)
+    {
+        const gl::Rectangle &damage = mDamageHistory[index];
+        if (damage.empty())
+        {
+            continue;
+        }
+        if (copyArea.empty())
+        {
+            copyArea = damage;
+        }
+        else
+        {
+            gl::GetEnclosingRectangle(copyArea, damage, &copyArea);
+        }
+    }
+    return copyArea;
+}
+
 angle::Result WindowSurfaceVk::prePresentSubmit(ContextVk *contextVk,
-                                                const vk::Semaphore &presentSemaphore)
+                                                const vk::Semaphore &presentSemaphore,
+                                                const gl::Rectangle &frameDamage)
 {
     vk::Renderer *renderer = contextVk->getRenderer();
 
@@ -2620,13 +2716,31 @@ angle::Result WindowSurfaceVk::prePresentSubmit(ContextVk *contextVk,
         ANGLE_TRY(
             contextVk->getOutsideRenderPassCommandBufferHelper(resources, &commandBufferHelper));
 
-        if (isMultisampledSurface())
+        // Only the parts of the swapchain image that changed since it was last presented are
+        // updated, if known.
+        VkOffset3D copyOffset        = {};
+        VkExtent3D copyExtent        = image.image->getRotatedExtents();
+        const gl::Rectangle copyArea = getAncillaryColorCopyArea(image, frameDamage);
+        if (copyArea != gl::Rectangle(0, 0, mWidth, mHeight))
+        {
+            copyOffset = {copyArea.x, copyArea.y, 0};
+            copyExtent = {static_cast<uint32_t>(copyArea.width),
+                          static_cast<uint32_t>(copyArea.height), 1};
+        }
+
+        if (copyArea.empty())
+        {
+            // Nothing was damaged, the swapchain image is already up to date.
+        }
+        else if (isMultisampledSurface())
         {
             VkImageResolve resolveRegion            = {};
             resolveRegion.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             resolveRegion.srcSubresource.layerCount = 1;
+            resolveRegion.srcOffset                 = copyOffset;
             resolveRegion.dstSubresource            = resolveRegion.srcSubresource;
-            resolveRegion.extent                    = image.image->getRotatedExtents();
+            resolveRegion.dstOffset                 = copyOffset;
+            resolveRegion.extent                    = copyExtent;
 
             mAncillaryColorImage.resolve(renderer, image.image.get(), resolveRegion,
                                          &commandBufferHelper->getCommandBuffer());
@@ -2638,8 +2752,10 @@ angle::Result WindowSurfaceVk::prePresentSubmit(ContextVk *contextVk,
             VkImageCopy copyRegion               = {};
             copyRegion.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             copyRegion.srcSubresource.layerCount = 1;
+            copyRegion.srcOffset                 = copyOffset;
             copyRegion.dstSubresource            = copyRegion.srcSubresource;
-            copyRegion.extent                    = image.image->getRotatedExtents();
+            copyRegion.dstOffset                 = copyOffset;
+            copyRegion.extent                    = copyExtent;
 
             mAncillaryColorImage.copy(renderer, image.image.get(), copyRegion,
                                       &commandBufferHelper->getCommandBuffer());
@@ -2694,6 +2810,9 @@ angle::Result WindowSurfaceVk::prePresentSubmit(ContextVk *contextVk,
     ANGLE_TRY(contextVk->flushAndSubmitCommands(shouldDrawOverlay ? nullptr : &presentSemaphore,
                                                 nullptr, QueueSubmitReason::EGLSwapBuffers));
 
+    // Capture the counters of the frame before the overlay adds its own work to it.
+    contextVk->collectFramePerfCounters();
+
     if (shouldDrawOverlay)
     {
         updateOverlay(contextVk);
@@ -2778,7 +2897,8 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
 
     // Make a submission before present to flush whatever's pending.  In the very least, a
     // submission is necessary to make sure the present semaphore is signaled.
-    ANGLE_TRY(prePresentSubmit(contextVk, presentSemaphore));
+    const gl::Rectangle frameDamage = getFrameDamage(rects, n_rects);
+    ANGLE_TRY(prePresentSubmit(contextVk, presentSemaphore, frameDamage));
 
     QueueSerial swapSerial = contextVk->getLastSubmittedQueueSerial();
 
@@ -2866,13 +2986,18 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
                 .valid());
 
     // EGL_ANDROID_presentation_time: set the desired presentation time for the frame.
+    // EGL_ANGLE_surface_present_statistics: identify the present to later match it with its display
+    // time when frame timestamps are enabled.
+    const bool trackPresentLatency =
+        contextVk->getFeatures().supportsTimestampSurfaceAttribute.enabled &&
+        mState.timestampsEnabled;
     VkPresentTimesInfoGOOGLE presentTimesInfo = {};
     VkPresentTimeGOOGLE presentTime           = {};
-    if (mDesiredPresentTime.has_value())
+    if (mDesiredPresentTime.has_value() || trackPresentLatency)
     {
         ASSERT(contextVk->getFeatures().supportsTimestampSurfaceAttribute.enabled);
         presentTime.presentID          = mPresentID++;
-        presentTime.desiredPresentTime = mDesiredPresentTime.value();
+        presentTime.desiredPresentTime = mDesiredPresentTime.value_or(0);
         mDesiredPresentTime.reset();
 
         presentTimesInfo.sType          = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
@@ -2882,9 +3007,24 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
         vk::AddToPNextChain(&presentInfo, &presentTimesInfo);
     }
 
+    if (trackPresentLatency)
+    {
+        if (mPendingPresentTimes.size() >= kMaxPendingPresentTimes)
+        {
+            mPendingPresentTimes.pop_front();
+        }
+        mPendingPresentTimes.emplace_back(
+            presentTime.presentID, static_cast<uint64_t>(angle::GetCurrentSystemTime() * 1e9));
+    }
+
     VkResult presentResult =
         renderer->queuePresent(contextVk, contextVk->getPriority(), presentInfo);
 
+    if (trackPresentLatency)
+    {
+        updatePresentLatency(contextVk);
+    }
+
     // EGL_EXT_buffer_age
     // 4) What is the buffer age of a single buffered surface?
     //     RESOLVED: 0.  This falls out implicitly from the buffer age
@@ -2896,6 +3036,17 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     {
         // Set FrameNumber for the presented image.
         mSwapchainImages[mCurrentSwapchainImageIndex].frameNumber = mFrameCount++;
+
+        // Remember the damage of this frame for updating the other swapchain images.  The overlay
+        // is drawn directly to the swapchain image, so it always damages the full frame.
+        mDamageHistory.push_back(overlayHasEnabledWidget(contextVk)
+                                     ? gl::Rectangle(0, 0, mWidth, mHeight)
+                                     : frameDamage);
+        if (mDamageHistory.size() > kMaxDamageHistory)
+        {
+            mDamageHistory.pop_front();
+        }
+
         // Always defer acquiring the next swapchain image, except when in shared present mode.
         // Note, if desired present mode is not compatible with the current mode or present is
         // out-of-date, swapchain will be invalidated in |checkSwapchainOutOfDate| call below.
@@ -2933,16 +3084,94 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void WindowSurfaceVk::updatePresentLatency(vk::ErrorContext *context)
+{
+    if (mSwapchain == VK_NULL_HANDLE || mPendingPresentTimes.empty())
+    {
+        return;
+    }
+
+    VkDevice device = context->getDevice();
+
+    // Failures here only affect the reported statistic, so they are not propagated.
+    uint32_t count = 0;
+    if (vkGetPastPresentationTimingGOOGLE(device, mSwapchain, &count, nullptr) != VK_SUCCESS ||
+        count == 0)
+    {
+        return;
+    }
+
+    std::vector<VkPastPresentationTimingGOOGLE> timings(count);
+    VkResult result =
+        vkGetPastPresentationTimingGOOGLE(device, mSwapchain, &count, timings.data());
+    if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+    {
+        return;
+    }
+
+    for (uint32_t timingIndex = 0; timingIndex < count; ++timingIndex)
+    {
+        const VkPastPresentationTimingGOOGLE &timing = timings[timingIndex];
+
+        // Drop presents older than this one; their timing will not be reported anymore.
+        while (!mPendingPresentTimes.empty() &&
+               mPendingPresentTimes.front().first < timing.presentID)
+        {
+            mPendingPresentTimes.pop_front();
+        }
+        if (mPendingPresentTimes.empty() || mPendingPresentTimes.front().first != timing.presentID)
+        {
+            continue;
+        }
+
+        const uint64_t presentCallTimeNs = mPendingPresentTimes.front().second;
+        mPendingPresentTimes.pop_front();
+
+        if (timing.actualPresentTime > presentCallTimeNs)
+        {
+            mPresentStatistics.presentLatencyUs =
+                SecondsToMicroseconds((timing.actualPresentTime - presentCallTimeNs) * 1e-9);
+        }
+    }
+}
+
 angle::Result WindowSurfaceVk::throttleCPU(vk::ErrorContext *context,
                                            const QueueSerial &currentSubmitSerial)
 {
+    vk::Renderer *renderer = context->getRenderer();
+
     // Wait on the oldest serial and replace it with the newest as the circular buffer moves
     // forward.
     QueueSerial swapSerial = mSwapHistory.front();
     mSwapHistory.front()   = currentSubmitSerial;
     mSwapHistory.next();
 
-    if (swapSerial.valid() && !context->getRenderer()->hasQueueSerialFinished(swapSerial))
+    mPresentStatistics.queueDepth = 0;
+    for (const QueueSerial &serial : mSwapHistory)
+    {
+        if (serial.valid() && !renderer->hasQueueSerialFinished(serial))
+        {
+            ++mPresentStatistics.queueDepth;
+        }
+    }
+    if (swapSerial.valid() && !renderer->hasQueueSerialFinished(swapSerial))
+    {
+        // The wait includes the frame that is still in flight.
+        ++mPresentStatistics.queueDepth;
+    }
+
+    // EGL_ANGLE_surface_low_latency: wait on the previous swap instead, so that at most one frame
+    // is queued while the application records the next one.  This lets the application sample its
+    // input as late as possible, at the cost of less CPU/GPU overlap.
+    if (mState.lowLatency)
+    {
+        swapSerial = mPreviousSwapSerial;
+    }
+    mPreviousSwapSerial = currentSubmitSerial;
+
+    mPresentStatistics.throttleWaitUs.store(0, std::memory_order_relaxed);
+
+    if (swapSerial.valid() && !renderer->hasQueueSerialFinished(swapSerial))
     {
         // Make this call after unlocking the EGL lock.  Renderer::finishQueueSerial is necessarily
         // thread-safe because it can get called from any number of GL commands, which don't
@@ -2950,12 +3179,18 @@ angle::Result WindowSurfaceVk::throttleCPU(vk::ErrorContext *context,
         //
         // As this is an unlocked tail call, it must not access anything else in Renderer.  The
         // display passed to |finishQueueSerial| is a |vk::ErrorContext|, and the only possible
-        // modification to it is through |handleError()|.
+        // modification to it is through |handleError()|.  The surface is current to this thread
+        // and cannot be destroyed before the tail call runs, so the wait time can be recorded.
+        std::atomic<uint32_t> *throttleWaitUs = &mPresentStatistics.throttleWaitUs;
         egl::Display::GetCurrentThreadUnlockedTailCall()->add(
-            [context, swapSerial](void *resultOut) {
+            [context, swapSerial, throttleWaitUs](void *resultOut) {
                 ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::throttleCPU");
                 ANGLE_UNUSED_VARIABLE(resultOut);
+                const double waitStartTime = angle::GetCurrentSystemTime();
                 (void)context->getRenderer()->finishQueueSerial(context, swapSerial);
+                throttleWaitUs->store(
+                    SecondsToMicroseconds(angle::GetCurrentSystemTime() - waitStartTime),
+                    std::memory_order_relaxed);
             });
     }
 
@@ -3105,6 +3340,30 @@ egl::Error WindowSurfaceVk::setPresentationTime(EGLnsecsANDROID time)
     return egl::NoError();
 }
 
+egl::Error WindowSurfaceVk::getPresentStatistic(EGLint attribute, EGLint *value) const
+{
+    switch (attribute)
+    {
+        case EGL_SURFACE_ACQUIRE_LATENCY_ANGLE:
+            *value = static_cast<EGLint>(mPresentStatistics.acquireLatencyUs);
+            break;
+        case EGL_SURFACE_THROTTLE_WAIT_TIME_ANGLE:
+            *value = static_cast<EGLint>(
+                mPresentStatistics.throttleWaitUs.load(std::memory_order_relaxed));
+            break;
+        case EGL_SURFACE_PRESENT_LATENCY_ANGLE:
+            *value = static_cast<EGLint>(mPresentStatistics.presentLatencyUs);
+            break;
+        case EGL_SURFACE_PRESENT_QUEUE_DEPTH_ANGLE:
+            *value = static_cast<EGLint>(mPresentStatistics.queueDepth);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+    return egl::NoError();
+}
+
 void WindowSurfaceVk::deferAcquireNextImage()
 {
     ASSERT(mAcquireOperation.state == ImageAcquireState::Ready);
@@ -3216,6 +3475,8 @@ VkResult WindowSurfaceVk::acquireNextSwapchainImage(vk::ErrorContext *context)
     mCurrentSwapchainImageIndex = mAcquireOperation.unlockedAcquireResult.imageIndex;
     ASSERT(!isSharedPresentMode() || mCurrentSwapchainImageIndex == 0);
 
+    mPresentStatistics.acquireLatencyUs = mAcquireOperation.unlockedAcquireResult.acquireLatencyUs;
+
     SwapchainImage &image = mSwapchainImages[mCurrentSwapchainImageIndex];
 
     const VkSemaphore acquireImageSemaphore =
@@ -3662,6 +3923,26 @@ void WindowSurfaceVk::updateOverlay(ContextVk *contextVk) const
             ->set(validationMessageCount);
     }
 
+    {
+        gl::RunningGraphWidget *acquireLatency =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanPresentAcquireLatency);
+        acquireLatency->add(mPresentStatistics.acquireLatencyUs);
+        acquireLatency->next();
+
+        gl::RunningGraphWidget *throttleWaitTime =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanPresentThrottleWaitTime);
+        throttleWaitTime->add(mPresentStatistics.throttleWaitUs.load(std::memory_order_relaxed));
+        throttleWaitTime->next();
+
+        gl::RunningGraphWidget *presentLatency =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanPresentLatency);
+        presentLatency->add(mPresentStatistics.presentLatencyUs);
+        presentLatency->next();
+
+        overlay->getCountWidget(gl::WidgetId::VulkanPresentQueueDepth)
+            ->set(mPresentStatistics.queueDepth);
+    }
+
     contextVk->updateOverlayOnPresent();
 }
 
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_SURFACEVK_H_
 #define LIBANGLE_RENDERER_VULKAN_SURFACEVK_H_
 
+#include <atomic>
+#include <deque>
 #include <optional>
 #include "common/CircularBuffer.h"
 #include "common/SimpleMutex.h"
@@ -260,6 +262,9 @@ struct UnlockedAcquireResult : angle::NonCopyable
 
     // Image index that was acquired
     uint32_t imageIndex = std::numeric_limits<uint32_t>::max();
+
+    // Time spent in vkAcquireNextImageKHR, in microseconds.
+    uint32_t acquireLatencyUs = 0;
 };
 
 struct ImageAcquireOperation : angle::NonCopyable
@@ -389,6 +394,8 @@ class WindowSurfaceVk : public SurfaceVk
                                   const gl::Context *context,
                                   EGLint *rate) override;
 
+    egl::Error getPresentStatistic(EGLint attribute, EGLint *value) const override;
+
   protected:
     angle::Result swapImpl(ContextVk *contextVk,
                            const EGLint *rects,
@@ -462,7 +469,9 @@ class WindowSurfaceVk : public SurfaceVk
     bool skipAcquireNextSwapchainImageForSharedPresentMode() const;
 
     angle::Result checkSwapchainOutOfDate(vk::ErrorContext *context, VkResult presentResult);
-    angle::Result prePresentSubmit(ContextVk *contextVk, const vk::Semaphore &presentSemaphore);
+    angle::Result prePresentSubmit(ContextVk *contextVk,
+                                   const vk::Semaphore &presentSemaphore,
+                                   const gl::Rectangle &frameDamage);
     angle::Result recordPresentLayoutBarrierIfNecessary(ContextVk *contextVk);
     angle::Result present(ContextVk *contextVk,
                           const EGLint *rects,
@@ -474,6 +483,9 @@ class WindowSurfaceVk : public SurfaceVk
     angle::Result cleanUpOldSwapchains(vk::ErrorContext *context);
 
     bool shouldRetainColor() const;
+    gl::Rectangle getFrameDamage(const EGLint *rects, EGLint n_rects) const;
+    gl::Rectangle getAncillaryColorCopyArea(const impl::SwapchainImage &image,
+                                            const gl::Rectangle &frameDamage) const;
 
     // Throttle the CPU such that application's logic and command buffer recording doesn't get more
     // than two frame ahead of the frame being rendered (and three frames ahead of the one being
@@ -481,6 +493,9 @@ class WindowSurfaceVk : public SurfaceVk
     // not ahead of the frame being rendered by *one* frame.
     angle::Result throttleCPU(vk::ErrorContext *context, const QueueSerial &currentSubmitSerial);
 
+    // Match the display times reported by VK_GOOGLE_display_timing with past presents.
+    void updatePresentLatency(vk::ErrorContext *context);
+
     void mergeImageResourceUses();
     // Finish all GPU operations on the surface
     angle::Result finish(vk::ErrorContext *context);
@@ -533,6 +548,8 @@ class WindowSurfaceVk : public SurfaceVk
     // implemented in ANGLE as a fail safe.  Removing this throttling requires untangling it from
     // acquire semaphore recycling (see mAcquireImageSemaphores above)
     angle::CircularBuffer<QueueSerial, impl::kSwapHistorySize> mSwapHistory;
+    // The serial of the last swap, used to throttle the CPU in low-latency mode.
+    QueueSerial mPreviousSwapSerial;
 
     // The previous swapchain which needs to be scheduled for destruction when appropriate.  This
     // will be done when the first image of the current swapchain is presented or when fences are
@@ -576,11 +593,29 @@ class WindowSurfaceVk : public SurfaceVk
     uint64_t mFrameCount;
     // The frame in which swap behavior is set to PRESERVE.
     uint64_t mPreserveStartFrame;
+    // The bounding box of the damage of the last few presented frames, with the most recent frame
+    // at the back.  Used to limit the copy from the ancillary color image to the parts of the
+    // swapchain image that are out of date.
+    std::deque<gl::Rectangle> mDamageHistory;
     // EGL_ANDROID_presentation_time: Next frame's id and presentation time
     // used for VK_GOOGLE_display_timing.
     uint32_t mPresentID;
     std::optional<EGLnsecsANDROID> mDesiredPresentTime;
 
+    // EGL_ANGLE_surface_present_statistics: timings of the most recent frame, in microseconds.
+    struct PresentStatistics
+    {
+        uint32_t acquireLatencyUs = 0;
+        // Written by the unlocked tail call of throttleCPU().
+        std::atomic<uint32_t> throttleWaitUs = 0;
+        uint32_t presentLatencyUs = 0;
+        uint32_t queueDepth       = 0;
+    };
+    PresentStatistics mPresentStatistics;
+    // Presents (id and CLOCK_MONOTONIC time in nanoseconds) whose display time is yet unknown.
+    // Only tracked when EGL_TIMESTAMPS_ANDROID is enabled and VK_GOOGLE_display_timing is used.
+    std::deque<std::pair<uint32_t, uint64_t>> mPendingPresentTimes;
+
     // EGL_KHR_lock_surface3
     vk::BufferHelper mLockBufferHelper;
 
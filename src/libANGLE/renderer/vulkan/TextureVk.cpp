@@ -52,6 +52,10 @@ constexpr VkImageAspectFlags kDepthStencilAspects =
 
 constexpr angle::SubjectIndex kTextureImageSubjectIndex = 0;
 
+// The total size of the staged sub-image updates above which a new one is not left staged with the
+// batchSubImageUpdates feature.
+constexpr VkDeviceSize kMaxBatchedSubImageUpdateSize = 4 * 1024 * 1024;
+
 // Test whether a texture level is within the range of levels for which the current image is
 // allocated.  This is used to ensure out-of-range updates are staged in the image, and not
 // attempted to be directly applied.
@@ -231,6 +235,21 @@ bool CanGenerateMipmapWithCompute(vk::Renderer *renderer,
     return hasStorageSupport && !isSRGB && !isInt && is2D && !isMultisampled && isColorFormat;
 }
 
+bool CanGenerateMipmapWithDraw(vk::Renderer *renderer, const vk::ImageHelper &image)
+{
+    // Each level is rendered to as a color attachment while sampling from the previous level.
+    // This covers the color-renderable formats (sRGB included) that neither the compute path nor
+    // blit support.
+    constexpr VkImageUsageFlags kRequiredUsage =
+        VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+    return image.getType() == VK_IMAGE_TYPE_2D && image.getSamples() == 1 &&
+           image.getAspectFlags() == VK_IMAGE_ASPECT_COLOR_BIT &&
+           (image.getUsage() & kRequiredUsage) == kRequiredUsage &&
+           vk::FormatHasNecessaryFeature(renderer, image.getActualFormatID(), image.getTilingMode(),
+                                         VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT);
+}
+
 void Set3DBaseArrayLayerAndLayerCount(VkImageSubresourceLayers *Subresource)
 {
     // If the srcImage/dstImage parameters are of VkImageType VK_IMAGE_TYPE_3D, the baseArrayLayer
@@ -835,6 +854,27 @@ bool TextureVk::updateMustBeFlushed(gl::SourceLevel level, angle::FormatID dstIm
     return false;
 }
 
+bool TextureVk::shouldSubImageUpdateBeBatched(ContextVk *contextVk,
+                                              const gl::ImageIndex &index,
+                                              const gl::Box &area) const
+{
+    // Updates to images shared with other contexts are not held back, as those contexts may be
+    // relying on the updates being submitted.  Updates that overwrite the whole level have
+    // nothing to be batched with, and large uploads are better off not retaining their staging
+    // memory.
+    if (!contextVk->getFeatures().batchSubImageUpdates.enabled || !mOwnsImage ||
+        contextVk->getShareGroup()->getContexts().size() > 1 ||
+        mImage->getTotalStagedBufferUpdateSize() >= kMaxBatchedSubImageUpdateSize)
+    {
+        return false;
+    }
+
+    const gl::Extents levelExtents =
+        mImage->getLevelExtents(mImage->toVkLevel(gl::LevelIndex(index.getLevelIndex())));
+    return area.x != 0 || area.y != 0 || area.width != levelExtents.width ||
+           area.height != levelExtents.height;
+}
+
 bool TextureVk::updateMustBeStaged(gl::SourceLevel level, angle::FormatID dstImageFormatID) const
 {
     ASSERT(mImage);
@@ -1308,6 +1348,14 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
     }
     else if (pixels)
     {
+        // Small updates that would otherwise be flushed right away are left staged, so that
+        // consecutive ones are copied to the image together.
+        if (applyUpdate != vk::ApplyImageUpdate::Defer &&
+            shouldSubImageUpdateBeBatched(contextVk, index, area))
+        {
+            applyUpdate = vk::ApplyImageUpdate::Defer;
+        }
+
         ANGLE_TRY(mImage->stageSubresourceUpdate(
             contextVk, getNativeImageIndex(index), area.getExtents(), area.getOffset(), formatInfo,
             type, pixels, vkFormat, getRequiredFormatSupport(), inputRowPitch, inputDepthPitch,
@@ -2964,6 +3012,14 @@ angle::Result TextureVk::generateMipmap(const gl::Context *context)
         // Otherwise, use blit if possible.
         return mImage->generateMipmapsWithBlit(contextVk, baseLevel, maxLevel);
     }
+    else if (CanGenerateMipmapWithDraw(renderer, *mImage))
+    {
+        // Otherwise, stay on the GPU by rendering each level if possible.
+        const bool isLinear =
+            CalculateGenerateMipmapFilter(contextVk, mImage->getActualFormatID()) == GL_LINEAR;
+        return contextVk->getUtils().generateMipmapWithDraw(contextVk, mImage,
+                                                            mImage->getActualFormatID(), isLinear);
+    }
 
     ANGLE_VK_PERF_WARNING(contextVk, GL_DEBUG_SEVERITY_HIGH,
                           "Mipmap generated on CPU due to format restrictions");
@@ -605,6 +605,11 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     {
         return updateMustBeFlushed(level, dstFormatID) || !updateMustBeStaged(level, dstFormatID);
     }
+    // Whether a sub-image update that could be applied right away is left staged instead, to be
+    // copied to the image along with the following ones.
+    bool shouldSubImageUpdateBeBatched(ContextVk *contextVk,
+                                       const gl::ImageIndex &index,
+                                       const gl::Box &area) const;
 
     // We monitor the staging buffer and set dirty bits if the staging buffer changes. Note that we
     // support changes in the staging buffer even outside the TextureVk class.
@@ -171,7 +171,11 @@ angle::Result TransformFeedbackVk::end(const gl::Context *context)
     // The buffer data are cleared to avoid reusing outdated info when binding transform feedback
     // buffers (via vkCmdBindTransformFeedbackBuffersEXT()).
     clearCachedBufferData();
-    releaseCounterBuffers(contextVk);
+
+    // The counter buffers are kept for the next glBeginTransformFeedback, which doesn't read them
+    // (the buffers are rebound), so that applications that capture every frame don't allocate new
+    // ones each time.  Write-after-write hazards with the previous use are handled by the barrier
+    // issued when they are used again.
 
     return angle::Result::Continue;
 }
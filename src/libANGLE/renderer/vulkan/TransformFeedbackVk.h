@@ -123,7 +123,8 @@ class TransformFeedbackVk : public TransformFeedbackImpl, public angle::Observer
     gl::TransformFeedbackBuffersArray<VkDeviceSize> mBufferOffsets;
     gl::TransformFeedbackBuffersArray<VkDeviceSize> mBufferSizes;
 
-    // Counter buffer used for pause and resume.
+    // Counter buffer used for pause and resume.  These are allocated on first use and kept until
+    // the transform feedback object is destroyed.
     gl::TransformFeedbackBuffersArray<vk::BufferHelper> mCounterBufferHelpers;
     gl::TransformFeedbackBuffersArray<VkBuffer> mCounterBufferHandles;
     gl::TransformFeedbackBuffersArray<VkDeviceSize> mCounterBufferOffsets;
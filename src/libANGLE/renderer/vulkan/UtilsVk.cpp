@@ -1208,6 +1208,7 @@ void ResetDynamicState(ContextVk *contextVk, vk::RenderPassCommandBuffer *comman
     // - stencil reference: UtilsVk sets this when enabling stencil test
     // - stencil func: UtilsVk sets this when enabling stencil test
     // - stencil ops: UtilsVk sets this when enabling stencil test
+    // - color blend equation: UtilsVk sets this when enabling blending
 
     vk::Renderer *renderer = contextVk->getRenderer();
 
@@ -2608,6 +2609,7 @@ angle::Result UtilsVk::startRenderPass(ContextVk *contextVk,
             std::move(renderPassFramebuffer), renderArea, renderPassDesc, renderPassAttachmentOps,
             vk::PackedAttachmentCount(0), vk::kAttachmentIndexZero, clearValues, commandBufferOut));
     }
+    contextVk->onInternalRenderPassStarted();
 
     contextVk->addGarbage(&framebuffer);
 
@@ -2702,6 +2704,9 @@ angle::Result UtilsVk::clearFramebuffer(ContextVk *contextVk,
         contextVk->getStartedRenderPassCommands().isTransformFeedbackActiveUnpaused();
     contextVk->pauseTransformFeedbackIfActiveUnpaused();
 
+    // The condition of NV_conditional_render has already been checked on the CPU for clears.
+    contextVk->endConditionalRenderingIfActive();
+
     ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageClear, vertexShader, fragmentShader,
                                    imageClearProgramAndPipelines, &pipelineDesc, VK_NULL_HANDLE,
                                    &shaderParams, sizeof(shaderParams), commandBuffer));
@@ -5106,6 +5111,18 @@ angle::Result UtilsVk::drawOverlay(ContextVk *contextVk,
     SetDepthDynamicStateForUnused(renderer, commandBuffer);
     SetStencilDynamicStateForUnused(renderer, commandBuffer);
 
+    if (renderer->getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        VkColorBlendEquationEXT blendEquation = {};
+        blendEquation.srcColorBlendFactor     = VK_BLEND_FACTOR_SRC_ALPHA;
+        blendEquation.dstColorBlendFactor     = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        blendEquation.colorBlendOp            = VK_BLEND_OP_ADD;
+        blendEquation.srcAlphaBlendFactor     = VK_BLEND_FACTOR_ZERO;
+        blendEquation.dstAlphaBlendFactor     = VK_BLEND_FACTOR_ONE;
+        blendEquation.alphaBlendOp            = VK_BLEND_OP_ADD;
+        commandBuffer->setColorBlendEquation(0, 1, &blendEquation);
+    }
+
     // Draw all the graph widgets.
     if (params.graphWidgetCount > 0)
     {
@@ -5299,28 +5316,65 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
                                                                   vk::BufferHelper **bufferOut,
                                                                   uint32_t *indexCountOut)
 {
-    if (glIndexType == gl::DrawElementsType::UnsignedByte ||
-        contextVk->getState().isPrimitiveRestartEnabled())
+    const bool primitiveRestart = contextVk->getState().isPrimitiveRestartEnabled();
+
+    // The loop is cached in the element array buffer, and only translated again once the indices
+    // are modified.
+    IndexConversionBuffer *cachedBuffer = elementArrayBufferVk->getIndexConversionBuffer(
+        {glIndexType, elementArrayOffset, indexCount, primitiveRestart, true});
+    if (cachedBuffer != nullptr && !cachedBuffer->dirty())
+    {
+        *bufferOut     = cachedBuffer->getBuffer();
+        *indexCountOut = cachedBuffer->getConvertedIndexCount();
+        return angle::Result::Continue;
+    }
+    ConversionBuffer *dstBuffer = cachedBuffer != nullptr ? cachedBuffer : &mDynamicIndexBuffer;
+
+    if (glIndexType == gl::DrawElementsType::UnsignedByte || primitiveRestart)
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
 
         void *srcDataMapping = nullptr;
         ANGLE_TRY(elementArrayBufferVk->mapForReadAccessOnly(contextVk, &srcDataMapping));
-        ANGLE_TRY(streamIndices(contextVk, glIndexType, indexCount,
-                                static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset,
-                                bufferOut, indexCountOut));
+        ANGLE_TRY(streamIndicesImpl(
+            contextVk, glIndexType, indexCount,
+            static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset, dstBuffer,
+            bufferOut, indexCountOut));
         ANGLE_TRY(elementArrayBufferVk->unmapReadAccessOnly(contextVk));
-        return angle::Result::Continue;
+    }
+    else
+    {
+        ANGLE_TRY(copyIndicesAndFirstIndex(contextVk, elementArrayBufferVk, glIndexType,
+                                           indexCount, elementArrayOffset, dstBuffer, bufferOut,
+                                           indexCountOut));
     }
 
+    if (cachedBuffer != nullptr)
+    {
+        cachedBuffer->setConvertedIndexCount(*indexCountOut);
+        cachedBuffer->clearDirty();
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result LineLoopHelper::copyIndicesAndFirstIndex(ContextVk *contextVk,
+                                                       BufferVk *elementArrayBufferVk,
+                                                       gl::DrawElementsType glIndexType,
+                                                       int indexCount,
+                                                       uintptr_t elementArrayOffset,
+                                                       ConversionBuffer *dstBuffer,
+                                                       vk::BufferHelper **bufferOut,
+                                                       uint32_t *indexCountOut)
+{
     *indexCountOut = indexCount + 1;
 
     size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
 
     size_t allocateBytes = unitSize * (indexCount + 1) + 1;
-    ANGLE_TRY(contextVk->initBufferForVertexConversion(&mDynamicIndexBuffer, allocateBytes,
+    ANGLE_TRY(contextVk->initBufferForVertexConversion(dstBuffer, allocateBytes,
                                                        vk::MemoryHostVisibility::Visible));
-    vk::BufferHelper *indexBuffer = mDynamicIndexBuffer.getBuffer();
+    vk::BufferHelper *indexBuffer = dstBuffer->getBuffer();
 
     vk::BufferHelper *sourceBuffer = &elementArrayBufferVk->getBuffer();
     VkDeviceSize sourceOffset =
@@ -5354,6 +5408,18 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
                                             const uint8_t *srcPtr,
                                             vk::BufferHelper **bufferOut,
                                             uint32_t *indexCountOut)
+{
+    return streamIndicesImpl(contextVk, glIndexType, indexCount, srcPtr, &mDynamicIndexBuffer,
+                             bufferOut, indexCountOut);
+}
+
+angle::Result LineLoopHelper::streamIndicesImpl(ContextVk *contextVk,
+                                                gl::DrawElementsType glIndexType,
+                                                GLsizei indexCount,
+                                                const uint8_t *srcPtr,
+                                                ConversionBuffer *dstBuffer,
+                                                vk::BufferHelper **bufferOut,
+                                                uint32_t *indexCountOut)
 {
     size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
 
@@ -5367,9 +5433,9 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
     // Make sure indexBufferSize not zero, otherwise VMA may hit assertion.
     size_t indexBufferSize = numOutIndices > 0 ? unitSize * numOutIndices : unitSize;
 
-    ANGLE_TRY(contextVk->initBufferForVertexConversion(&mDynamicIndexBuffer, indexBufferSize,
+    ANGLE_TRY(contextVk->initBufferForVertexConversion(dstBuffer, indexBufferSize,
                                                        vk::MemoryHostVisibility::Visible));
-    vk::BufferHelper *indexBuffer = mDynamicIndexBuffer.getBuffer();
+    vk::BufferHelper *indexBuffer = dstBuffer->getBuffer();
     uint8_t *indices              = indexBuffer->getMappedMemory();
 
     if (contextVk->getState().isPrimitiveRestartEnabled())
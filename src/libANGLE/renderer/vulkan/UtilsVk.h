@@ -20,7 +20,8 @@
 //      on color images.
 //    - Depth/Stencil blit/resolve: Used by FramebufferVk::blit() to implement blit or multisample
 //      resolve on depth/stencil images.
-//    - Generate mipmap: Used by TextureVk::generateMipmapsWithCompute().
+//    - Generate mipmap: Used by TextureVk::generateMipmapsWithCompute(), and with draw by
+//      TextureVk::generateMipmap() for color-renderable formats the compute path doesn't support.
 //    - Overlay Draw: Used by OverlayVk to draw a UI for debugging.
 //    - Mipmap generation: Used by TextureVk to generate mipmaps more efficiently in compute.
 //
@@ -839,6 +840,22 @@ class LineLoopHelper final : angle::NonCopyable
     }
 
   private:
+    angle::Result copyIndicesAndFirstIndex(ContextVk *contextVk,
+                                           BufferVk *elementArrayBufferVk,
+                                           gl::DrawElementsType glIndexType,
+                                           int indexCount,
+                                           uintptr_t elementArrayOffset,
+                                           ConversionBuffer *dstBuffer,
+                                           vk::BufferHelper **bufferOut,
+                                           uint32_t *indexCountOut);
+    angle::Result streamIndicesImpl(ContextVk *contextVk,
+                                    gl::DrawElementsType glIndexType,
+                                    GLsizei indexCount,
+                                    const uint8_t *srcPtr,
+                                    ConversionBuffer *dstBuffer,
+                                    vk::BufferHelper **bufferOut,
+                                    uint32_t *indexCountOut);
+
     ConversionBuffer mDynamicIndexBuffer;
     ConversionBuffer mDynamicIndirectBuffer;
 };
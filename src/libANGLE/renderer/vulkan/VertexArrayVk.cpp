@@ -212,6 +212,23 @@ void WarnOnVertexFormatConversion(ContextVk *contextVk, const vk::Format &vertex
         vertexFormat.getActualBufferFormat().glInternalFormat);
 }
 
+void CopyVertexData(uint8_t *dst,
+                    const uint8_t *srcData,
+                    size_t bytesToCopy,
+                    size_t vertexCount,
+                    size_t srcStride,
+                    VertexCopyFunction vertexLoadFunction)
+{
+    if (vertexLoadFunction != nullptr)
+    {
+        vertexLoadFunction(srcData, srcStride, vertexCount, dst);
+    }
+    else
+    {
+        memcpy(dst, srcData, bytesToCopy);
+    }
+}
+
 angle::Result StreamVertexData(ContextVk *contextVk,
                                vk::BufferHelper *dstBufferHelper,
                                const uint8_t *srcData,
@@ -229,16 +246,8 @@ angle::Result StreamVertexData(ContextVk *contextVk,
         return angle::Result::Continue;
     }
 
-    uint8_t *dst = dstBufferHelper->getMappedMemory() + dstOffset;
-
-    if (vertexLoadFunction != nullptr)
-    {
-        vertexLoadFunction(srcData, srcStride, vertexCount, dst);
-    }
-    else
-    {
-        memcpy(dst, srcData, bytesToCopy);
-    }
+    CopyVertexData(dstBufferHelper->getMappedMemory() + dstOffset, srcData, bytesToCopy,
+                   vertexCount, srcStride, vertexLoadFunction);
 
     ANGLE_TRY(dstBufferHelper->flush(renderer));
 
@@ -545,18 +554,21 @@ void VertexArrayVk::destroy(const gl::Context *context)
 
 angle::Result VertexArrayVk::convertIndexBufferGPU(ContextVk *contextVk,
                                                    BufferVk *bufferVk,
+                                                   IndexConversionBuffer *cachedBuffer,
                                                    const void *indices)
 {
     uintptr_t offsetIntoSrcData = reinterpret_cast<uintptr_t>(indices);
     size_t srcDataSize         = static_cast<size_t>(bufferVk->getSize()) - offsetIntoSrcData;
 
+    ConversionBuffer *dstBuffer =
+        cachedBuffer != nullptr ? cachedBuffer : &mTranslatedByteIndexData;
+
     // Allocate buffer for results
-    ANGLE_TRY(contextVk->initBufferForVertexConversion(&mTranslatedByteIndexData,
-                                                       sizeof(GLushort) * srcDataSize,
+    ANGLE_TRY(contextVk->initBufferForVertexConversion(dstBuffer, sizeof(GLushort) * srcDataSize,
                                                        vk::MemoryHostVisibility::NonVisible));
-    mCurrentElementArrayBuffer = mTranslatedByteIndexData.getBuffer();
+    mCurrentElementArrayBuffer = dstBuffer->getBuffer();
 
-    vk::BufferHelper *dst = mTranslatedByteIndexData.getBuffer();
+    vk::BufferHelper *dst = dstBuffer->getBuffer();
     vk::BufferHelper *src = &bufferVk->getBuffer();
 
     // Copy relevant section of the source into destination at allocated offset.  Note that the
@@ -568,7 +580,7 @@ angle::Result VertexArrayVk::convertIndexBufferGPU(ContextVk *contextVk,
     params.maxIndex = static_cast<uint32_t>(srcDataSize);
 
     ANGLE_TRY(contextVk->getUtils().convertIndexBuffer(contextVk, dst, src, params));
-    mTranslatedByteIndexData.clearDirty();
+    dstBuffer->clearDirty();
 
     return angle::Result::Continue;
 }
@@ -1458,6 +1470,64 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                                     startVertex + vertexCount, mergedRanges, mergedIndexes);
     }
 
+    // With shareStreamedVertexBufferAcrossAttribs, the ranges of the non-instanced client
+    // attributes are laid out back to back in a single allocation, which is flushed once after
+    // all of them are copied.  Without vkCmdBindVertexBuffers2, a sub-range of the allocation can
+    // only be bound if the driver doesn't need to know its exact size, i.e. without robust access.
+    vk::BufferHelper *sharedBuffer  = nullptr;
+    VkDeviceSize sharedBufferOffset = 0;
+    gl::AttributesMask sharedAttribMask;
+    gl::AttributesMask sharedRangeMask;
+    gl::AttribArray<size_t> sharedRangeOffsets;
+    gl::AttribArray<size_t> sharedRangeSizes;
+    if (renderer->getFeatures().shareStreamedVertexBufferAcrossAttribs.enabled &&
+        (renderer->getFeatures().supportsBindVertexBuffers2.enabled ||
+         !contextVk->hasRobustAccess()))
+    {
+        size_t sharedBufferSize = 0;
+        for (size_t attribIndex : activeStreamedAttribs)
+        {
+            const gl::VertexAttribute &attrib = attribs[attribIndex];
+            if (attrib.pointer == nullptr || bindings[attrib.bindingIndex].getDivisor() > 0)
+            {
+                continue;
+            }
+            sharedAttribMask.set(attribIndex);
+
+            // Merged attributes all use the range of their group leader.
+            const bool isMerged     = mergedAttribMask.test(attribIndex);
+            const size_t rangeIndex = isMerged ? mergedIndexes[attribIndex] : attribIndex;
+            if (sharedRangeMask.test(rangeIndex))
+            {
+                continue;
+            }
+            sharedRangeMask.set(rangeIndex);
+
+            size_t rangeSize;
+            if (isMerged)
+            {
+                rangeSize = mergedRanges[rangeIndex].endAddr - mergedRanges[rangeIndex].startAddr;
+            }
+            else
+            {
+                const vk::Format &vertexFormat = renderer->getFormat(attrib.format->id);
+                rangeSize = (startVertex + vertexCount) *
+                            vertexFormat.getActualBufferFormat().pixelBytes;
+            }
+
+            sharedRangeOffsets[rangeIndex] = sharedBufferSize;
+            sharedRangeSizes[rangeIndex]   = rangeSize;
+            sharedBufferSize += roundUp(rangeSize, vk::kVertexBufferAlignment);
+        }
+
+        if (sharedBufferSize > 0)
+        {
+            ANGLE_TRY(
+                contextVk->allocateSharedStreamedVertexBuffer(sharedBufferSize, &sharedBuffer));
+            sharedBufferOffset = sharedBuffer->getOffset();
+        }
+    }
+
     for (size_t attribIndex : activeStreamedAttribs)
     {
         const gl::VertexAttribute &attrib = attribs[attribIndex];
@@ -1474,6 +1544,8 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
         const uint8_t *src                 = static_cast<const uint8_t *>(attrib.pointer);
         uint32_t divisor                   = binding.getDivisor();
 
+        const bool usesSharedBuffer = sharedBuffer != nullptr && sharedAttribMask.test(attribIndex);
+
         GLuint stride            = pixelBytes;
         VkDeviceSize startOffset = 0;
         if (divisor > 0)
@@ -1574,12 +1646,23 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             {
                 size_t destOffset      = range.copyStartAddr - range.startAddr;
                 size_t bytesToAllocate = range.endAddr - range.startAddr;
-                ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(
-                    mergedAttribIdx, bytesToAllocate, &attribBufferHelper[mergedAttribIdx]));
-                ANGLE_TRY(StreamVertexData(contextVk, attribBufferHelper[mergedAttribIdx],
-                                           (const uint8_t *)range.copyStartAddr,
-                                           bytesToAllocate - destOffset, destOffset, vertexCount,
-                                           stride, nullptr));
+                if (usesSharedBuffer)
+                {
+                    CopyVertexData(sharedBuffer->getMappedMemory() +
+                                       sharedRangeOffsets[mergedAttribIdx] + destOffset,
+                                   (const uint8_t *)range.copyStartAddr,
+                                   bytesToAllocate - destOffset, vertexCount, stride, nullptr);
+                    attribBufferHelper[mergedAttribIdx] = sharedBuffer;
+                }
+                else
+                {
+                    ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(
+                        mergedAttribIdx, bytesToAllocate, &attribBufferHelper[mergedAttribIdx]));
+                    ANGLE_TRY(StreamVertexData(contextVk, attribBufferHelper[mergedAttribIdx],
+                                               (const uint8_t *)range.copyStartAddr,
+                                               bytesToAllocate - destOffset, destOffset,
+                                               vertexCount, stride, nullptr));
+                }
             }
             vertexDataBuffer = attribBufferHelper[mergedAttribIdx];
             startOffset      = reinterpret_cast<uintptr_t>(attrib.pointer) - range.startAddr;
@@ -1594,13 +1677,24 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             size_t destOffset      = startVertex * stride;
             size_t bytesToAllocate = (startVertex + vertexCount) * stride;
 
-            // Allocate buffer for results
-            ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(attribIndex, bytesToAllocate,
-                                                              &vertexDataBuffer));
+            if (usesSharedBuffer)
+            {
+                vertexDataBuffer = sharedBuffer;
+                CopyVertexData(
+                    sharedBuffer->getMappedMemory() + sharedRangeOffsets[attribIndex] + destOffset,
+                    src, bytesToAllocate, vertexCount, binding.getStride(),
+                    vertexFormat.getVertexLoadFunction());
+            }
+            else
+            {
+                // Allocate buffer for results
+                ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(attribIndex, bytesToAllocate,
+                                                                  &vertexDataBuffer));
 
-            ANGLE_TRY(StreamVertexData(contextVk, vertexDataBuffer, src, bytesToAllocate,
-                                       destOffset, vertexCount, binding.getStride(),
-                                       vertexFormat.getVertexLoadFunction()));
+                ANGLE_TRY(StreamVertexData(contextVk, vertexDataBuffer, src, bytesToAllocate,
+                                           destOffset, vertexCount, binding.getStride(),
+                                           vertexFormat.getVertexLoadFunction()));
+            }
             startOffset = 0;
         }
         ASSERT(vertexDataBuffer != nullptr);
@@ -1609,7 +1703,15 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
         VkDeviceSize bufferSize                = vertexDataBuffer->getSize();
 
         VkDeviceSize bufferOffset;
-        if (contextVk->getFeatures().supportsBindVertexBuffers2.enabled)
+        if (usesSharedBuffer)
+        {
+            const size_t rangeIndex =
+                mergedAttribMask.test(attribIndex) ? mergedIndexes[attribIndex] : attribIndex;
+            mCurrentArrayBufferHandles[attribIndex] = vertexDataBuffer->getBuffer().getHandle();
+            bufferOffset = sharedBufferOffset + sharedRangeOffsets[rangeIndex];
+            bufferSize   = sharedRangeSizes[rangeIndex];
+        }
+        else if (contextVk->getFeatures().supportsBindVertexBuffers2.enabled)
         {
             mCurrentArrayBufferHandles[attribIndex] = vertexDataBuffer->getBuffer().getHandle();
             bufferOffset                            = vertexDataBuffer->getOffset();
@@ -1632,6 +1734,11 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
                                 mVertexInputBindingDescs[attribIndex].stride));
     }
 
+    if (sharedBuffer != nullptr)
+    {
+        ANGLE_TRY(sharedBuffer->flush(renderer));
+    }
+
     return angle::Result::Continue;
 }
 
@@ -134,14 +134,21 @@ class VertexArrayVk : public VertexArrayImpl
     void updateCurrentElementArrayBuffer();
 
     vk::BufferHelper *getCurrentElementArrayBuffer() const { return mCurrentElementArrayBuffer; }
+    // Use an index translation cached in the element array buffer.
+    void setCurrentElementArrayBuffer(vk::BufferHelper *buffer)
+    {
+        mCurrentElementArrayBuffer = buffer;
+    }
 
     const gl::AttribArray<vk::BufferHelper *> &getCurrentArrayBuffers() const
     {
         return mCurrentArrayBuffers;
     }
 
+    // The indices are translated to cachedBuffer, or to the vertex array's own buffer if null.
     angle::Result convertIndexBufferGPU(ContextVk *contextVk,
                                         BufferVk *bufferVk,
+                                        IndexConversionBuffer *cachedBuffer,
                                         const void *indices);
 
     angle::Result convertIndexBufferIndirectGPU(ContextVk *contextVk,
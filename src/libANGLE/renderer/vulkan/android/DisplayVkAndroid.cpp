@@ -96,6 +96,12 @@ egl::Error DisplayVkAndroid::initialize(egl::Display *display)
     return egl::NoError();
 }
 
+void DisplayVkAndroid::terminate()
+{
+    mHardwareBufferImportCache.destroy(mRenderer, mAHBFunctions);
+    DisplayVk::terminate();
+}
+
 bool DisplayVkAndroid::isValidNativeWindow(EGLNativeWindowType window) const
 {
     return (ANativeWindow_getFormat(window) >= 0);
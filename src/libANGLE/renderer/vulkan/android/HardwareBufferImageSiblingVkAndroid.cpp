@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/vulkan/android/HardwareBufferImageSiblingVkAndroid.h"
 
+#include <algorithm>
+
 #include "common/android_util.h"
 
 #include "libANGLE/Display.h"
@@ -139,10 +141,78 @@ gl::TextureType AhbDescUsageToTextureType(const AHardwareBuffer_Desc &ahbDescrip
 }
 // TODO(anglebug.com/42266422): remove when NDK header is updated to contain FRONT_BUFFER usage flag
 constexpr uint64_t kAHardwareBufferUsageFrontBuffer = (1ULL << 32);
+
+// Enough for the buffer queues of a few video decoders.
+constexpr size_t kMaxCachedHardwareBufferImports = 32;
 }  // namespace
 
+HardwareBufferImportCache::HardwareBufferImportCache() = default;
+
+HardwareBufferImportCache::~HardwareBufferImportCache()
+{
+    ASSERT(mImports.empty());
+}
+
+void HardwareBufferImportCache::store(vk::Renderer *renderer,
+                                      const AHBFunctions &functions,
+                                      Import &&import)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    if (mImports.size() >= kMaxCachedHardwareBufferImports)
+    {
+        evict(renderer, functions, &mImports.front());
+        mImports.pop_front();
+    }
+
+    functions.acquire(import.hardwareBuffer);
+    mImports.push_back(std::move(import));
+}
+
+bool HardwareBufferImportCache::take(const AHBFunctions &functions,
+                                     AHardwareBuffer *hardwareBuffer,
+                                     Import *importOut)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    auto iter = std::find_if(mImports.begin(), mImports.end(),
+                             [hardwareBuffer](const Import &import) {
+                                 return import.hardwareBuffer == hardwareBuffer;
+                             });
+    if (iter == mImports.end())
+    {
+        return false;
+    }
+
+    *importOut = std::move(*iter);
+    mImports.erase(iter);
+    functions.release(hardwareBuffer);
+    return true;
+}
+
+void HardwareBufferImportCache::destroy(vk::Renderer *renderer, const AHBFunctions &functions)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    for (Import &import : mImports)
+    {
+        evict(renderer, functions, &import);
+    }
+    mImports.clear();
+}
+
+void HardwareBufferImportCache::evict(vk::Renderer *renderer,
+                                      const AHBFunctions &functions,
+                                      Import *import)
+{
+    import->image->releaseImage(renderer);
+    SafeDelete(import->image);
+    functions.release(import->hardwareBuffer);
+}
+
 HardwareBufferImageSiblingVkAndroid::HardwareBufferImageSiblingVkAndroid(EGLClientBuffer buffer)
     : mBuffer(buffer),
+      mDisplay(nullptr),
       mFormat(GL_NONE),
       mRenderable(false),
       mTextureable(false),
@@ -330,6 +400,22 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
 
     functions.acquire(hardwareBuffer);
 
+    // If an EGL image was recently created from the same buffer, reuse its VkImage instead of
+    // importing the buffer again.
+    mDisplay = static_cast<DisplayVkAndroid *>(displayVk);
+    HardwareBufferImportCache::Import cachedImport;
+    if (renderer->getFeatures().recycleExternalBufferImports.enabled &&
+        mDisplay->getHardwareBufferImportCache().take(functions, hardwareBuffer, &cachedImport))
+    {
+        mImage       = cachedImport.image;
+        mFormat      = cachedImport.format;
+        mRenderable  = cachedImport.renderable;
+        mTextureable = cachedImport.textureable;
+        mYUV         = cachedImport.yuv;
+        mLevelCount  = cachedImport.levelCount;
+        return angle::Result::Continue;
+    }
+
     VkAndroidHardwareBufferPropertiesANDROID bufferProperties = {};
     bufferProperties.sType = VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID;
     bufferProperties.pNext = nullptr;
@@ -697,6 +783,30 @@ void HardwareBufferImageSiblingVkAndroid::release(vk::Renderer *renderer)
 {
     if (mImage != nullptr)
     {
+        // Keep the image for the next EGL image created from this buffer.  This is only done if
+        // the image is owned by the FOREIGN queue, i.e. it's not in use by a context that hasn't
+        // submitted it yet, so that the next use acquires it from FOREIGN again and sees the
+        // contents the producer writes in the meantime.
+        if (renderer->getFeatures().recycleExternalBufferImports.enabled && mDisplay != nullptr &&
+            mImage->isReleasedToForeign())
+        {
+            mImage->releaseStagedUpdates(renderer);
+
+            HardwareBufferImportCache::Import import;
+            import.hardwareBuffer = angle::android::ANativeWindowBufferToAHardwareBuffer(
+                angle::android::ClientBufferToANativeWindowBuffer(mBuffer));
+            import.image       = mImage;
+            import.format      = mFormat;
+            import.renderable  = mRenderable;
+            import.textureable = mTextureable;
+            import.yuv         = mYUV;
+            import.levelCount  = mLevelCount;
+            mDisplay->getHardwareBufferImportCache().store(renderer, mDisplay->getAHBFunctions(),
+                                                           std::move(import));
+            mImage = nullptr;
+            return;
+        }
+
         // TODO: Handle the case where the EGLImage is used in two contexts not in the same share
         // group.  https://issuetracker.google.com/169868803
         mImage->releaseImage(renderer);
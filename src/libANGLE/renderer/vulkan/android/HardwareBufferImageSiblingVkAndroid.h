@@ -10,10 +10,51 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_ANDROID_HARDWAREBUFFERIMAGESIBLINGVKANDROID_H_
 #define LIBANGLE_RENDERER_VULKAN_ANDROID_HARDWAREBUFFERIMAGESIBLINGVKANDROID_H_
 
+#include <deque>
+
+#include "common/SimpleMutex.h"
 #include "libANGLE/renderer/vulkan/ImageVk.h"
+#include "libANGLE/renderer/vulkan/android/AHBFunctions.h"
 
 namespace rx
 {
+class DisplayVkAndroid;
+
+// Holds the images of recently destroyed HardwareBufferImageSiblingVkAndroid objects, so that an
+// EGL image that is created again from the same AHardwareBuffer doesn't import it into a new
+// VkImage.  Each entry holds a reference to its hardware buffer, which guarantees that the buffer
+// is not freed and another one allocated at the same address in the meantime.
+class HardwareBufferImportCache final : angle::NonCopyable
+{
+  public:
+    struct Import
+    {
+        AHardwareBuffer *hardwareBuffer = nullptr;
+        vk::ImageHelper *image          = nullptr;
+        gl::Format format               = gl::Format(GL_NONE);
+        bool renderable                 = false;
+        bool textureable                = false;
+        bool yuv                        = false;
+        uint32_t levelCount             = 0;
+    };
+
+    HardwareBufferImportCache();
+    ~HardwareBufferImportCache();
+
+    // Takes ownership of the image, evicting the oldest import if the cache is full.
+    void store(vk::Renderer *renderer, const AHBFunctions &functions, Import &&import);
+    // Returns the import of |hardwareBuffer| if there is one, ownership of which is given back to
+    // the caller.
+    bool take(const AHBFunctions &functions, AHardwareBuffer *hardwareBuffer, Import *importOut);
+    void destroy(vk::Renderer *renderer, const AHBFunctions &functions);
+
+  private:
+    void evict(vk::Renderer *renderer, const AHBFunctions &functions, Import *import);
+
+    angle::SimpleMutex mMutex;
+    // Oldest first.
+    std::deque<Import> mImports;
+};
 
 class HardwareBufferImageSiblingVkAndroid : public ExternalImageSiblingVk
 {
@@ -49,6 +90,7 @@ class HardwareBufferImageSiblingVkAndroid : public ExternalImageSiblingVk
     angle::Result initImpl(DisplayVk *displayVk);
 
     EGLClientBuffer mBuffer;
+    DisplayVkAndroid *mDisplay;
     gl::Extents mSize;
     gl::Format mFormat;
 
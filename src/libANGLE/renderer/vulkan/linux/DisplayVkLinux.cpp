@@ -23,6 +23,12 @@ namespace rx
 
 DisplayVkLinux::DisplayVkLinux(const egl::DisplayState &state) : DisplayVk(state) {}
 
+void DisplayVkLinux::terminate()
+{
+    mDmaBufImportCache.destroy(mRenderer);
+    DisplayVk::terminate();
+}
+
 DeviceImpl *DisplayVkLinux::createDevice()
 {
     return new DeviceVkLinux(this);
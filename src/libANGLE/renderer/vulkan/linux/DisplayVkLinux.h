@@ -13,6 +13,7 @@
 #define LIBANGLE_RENDERER_VULKAN_DISPLAY_DISPLAYVKLINUX_H_
 
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
+#include "libANGLE/renderer/vulkan/linux/DmaBufImageSiblingVkLinux.h"
 
 namespace rx
 {
@@ -21,6 +22,8 @@ class DisplayVkLinux : public DisplayVk
   public:
     DisplayVkLinux(const egl::DisplayState &state);
 
+    void terminate() override;
+
     DeviceImpl *createDevice() override;
 
     ExternalImageSiblingImpl *createExternalImageSibling(const gl::Context *context,
@@ -35,6 +38,8 @@ class DisplayVkLinux : public DisplayVk
                                     EGLBoolean *externalOnly,
                                     EGLint *numModifiers) override;
 
+    DmaBufImportCache &getDmaBufImportCache() { return mDmaBufImportCache; }
+
   private:
     std::vector<VkDrmFormatModifierPropertiesEXT> getDrmModifiers(const DisplayVk *displayVk,
                                                                   VkFormat vkFormat);
@@ -44,6 +49,8 @@ class DisplayVkLinux : public DisplayVk
 
     // Supported DRM formats
     std::unordered_set<EGLint> mDrmFormats;
+
+    DmaBufImportCache mDmaBufImportCache;
 };
 
 }  // namespace rx
@@ -16,9 +16,13 @@
 #include "common/system_utils.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
+#include "libANGLE/renderer/vulkan/linux/DisplayVkLinux.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 
 #include <fcntl.h>
+#include <sys/stat.h>
+
+#include <algorithm>
 
 namespace rx
 {
@@ -54,6 +58,9 @@ constexpr VkImageUsageFlags kRenderUsage =
 constexpr VkImageUsageFlags kRenderAndInputUsage =
     kRenderUsage | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
 
+// Enough for the buffer pools of a few video decoders or cameras.
+constexpr size_t kMaxCachedDmaBufImports = 32;
+
 struct AllocateInfo
 {
     PerPlane<VkMemoryDedicatedAllocateInfo> allocateInfo = {};
@@ -327,10 +334,88 @@ angle::Result GetAllocateInfo(const egl::AttributeMap &attribs,
 
     return angle::Result::Continue;
 }
+
+// Identifies the dma-bufs and their layout, see DmaBufImportCache::Import::key.
+bool GetDmaBufImportKey(const egl::AttributeMap &attribs, std::vector<EGLAttrib> *keyOut)
+{
+    std::vector<std::pair<EGLAttrib, EGLAttrib>> sortedAttribs(attribs.begin(), attribs.end());
+    std::sort(sortedAttribs.begin(), sortedAttribs.end());
+
+    keyOut->clear();
+    for (const auto &[attrib, value] : sortedAttribs)
+    {
+        keyOut->push_back(attrib);
+        if (std::find(kFds.begin(), kFds.end(), static_cast<EGLenum>(attrib)) == kFds.end())
+        {
+            keyOut->push_back(value);
+            continue;
+        }
+
+        struct stat fdStat;
+        if (fstat(static_cast<int>(value), &fdStat) < 0)
+        {
+            return false;
+        }
+        keyOut->push_back(static_cast<EGLAttrib>(fdStat.st_dev));
+        keyOut->push_back(static_cast<EGLAttrib>(fdStat.st_ino));
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
+DmaBufImportCache::DmaBufImportCache() = default;
+
+DmaBufImportCache::~DmaBufImportCache()
+{
+    ASSERT(mImports.empty());
+}
+
+void DmaBufImportCache::store(vk::Renderer *renderer, Import &&import)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    if (mImports.size() >= kMaxCachedDmaBufImports)
+    {
+        mImports.front().image->releaseImage(renderer);
+        SafeDelete(mImports.front().image);
+        mImports.pop_front();
+    }
+
+    mImports.push_back(std::move(import));
+}
+
+bool DmaBufImportCache::take(const std::vector<EGLAttrib> &key, Import *importOut)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    auto iter = std::find_if(mImports.begin(), mImports.end(),
+                             [&key](const Import &import) { return import.key == key; });
+    if (iter == mImports.end())
+    {
+        return false;
+    }
+
+    *importOut = std::move(*iter);
+    mImports.erase(iter);
+    return true;
+}
+
+void DmaBufImportCache::destroy(vk::Renderer *renderer)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    for (Import &import : mImports)
+    {
+        import.image->releaseImage(renderer);
+        SafeDelete(import.image);
+    }
+    mImports.clear();
+}
+
 DmaBufImageSiblingVkLinux::DmaBufImageSiblingVkLinux(const egl::AttributeMap &attribs)
     : mAttribs(attribs),
+      mDisplay(nullptr),
       mFormat(GL_NONE),
       mVkFormats(),
       mRenderable(false),
@@ -586,6 +671,24 @@ angle::Result DmaBufImageSiblingVkLinux::initImpl(DisplayVk *displayVk)
 {
     vk::Renderer *renderer = displayVk->getRenderer();
 
+    // If an EGL image was recently created from the same dma-bufs, reuse its VkImage instead of
+    // importing them again.
+    // The key is made now, as the application may close the fds once the EGL image is created.
+    mDisplay = static_cast<DisplayVkLinux *>(displayVk);
+    DmaBufImportCache::Import cachedImport;
+    if (renderer->getFeatures().recycleExternalBufferImports.enabled &&
+        !GetDmaBufImportKey(mAttribs, &mImportKey))
+    {
+        mImportKey.clear();
+    }
+    if (!mImportKey.empty() && mDisplay->getDmaBufImportCache().take(mImportKey, &cachedImport))
+    {
+        mImage       = cachedImport.image;
+        mRenderable  = cachedImport.renderable;
+        mTextureable = cachedImport.textureable;
+        return angle::Result::Continue;
+    }
+
     const vk::Format &vkFormat = renderer->getFormat(mFormat.info->sizedInternalFormat);
     const angle::Format &format =
         vkFormat.getActualImageFormat(rx::vk::ImageFormatSupport::SampleOnly);
@@ -667,6 +770,23 @@ void DmaBufImageSiblingVkLinux::release(vk::Renderer *renderer)
 {
     if (mImage != nullptr)
     {
+        // Keep the image for the next EGL image created from these dma-bufs, if it's owned by the
+        // FOREIGN queue, i.e. it's not in use by a context that hasn't submitted it yet.  The next
+        // use then acquires it from FOREIGN again and sees the contents written in the meantime.
+        if (!mImportKey.empty() && mImage->isReleasedToForeign())
+        {
+            mImage->releaseStagedUpdates(renderer);
+
+            DmaBufImportCache::Import import;
+            import.key         = std::move(mImportKey);
+            import.image       = mImage;
+            import.renderable  = mRenderable;
+            import.textureable = mTextureable;
+            mDisplay->getDmaBufImportCache().store(renderer, std::move(import));
+            mImage = nullptr;
+            return;
+        }
+
         // TODO: Handle the case where the EGLImage is used in two contexts not in the same share
         // group.  https://issuetracker.google.com/169868803
         mImage->releaseImage(renderer);
@@ -10,10 +10,14 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_LINUX_DMABUFIMAGESIBLINGVKLINUX_H_
 #define LIBANGLE_RENDERER_VULKAN_LINUX_DMABUFIMAGESIBLINGVKLINUX_H_
 
+#include <deque>
+
+#include "common/SimpleMutex.h"
 #include "libANGLE/renderer/vulkan/ImageVk.h"
 
 namespace rx
 {
+class DisplayVkLinux;
 
 enum MutableFormat
 {
@@ -27,6 +31,40 @@ enum InitResult
     Failed
 };
 
+// Holds the images of recently destroyed DmaBufImageSiblingVkLinux objects, so that an EGL image
+// that is created again from the same dma-bufs with the same layout doesn't import them into a new
+// VkImage.  The dma-bufs are identified by their inode rather than the fds, which are different
+// for every import.  The imported memory holds a reference to the dma-bufs, so an inode can't be
+// reused by another dma-buf while its import is cached.
+class DmaBufImportCache final : angle::NonCopyable
+{
+  public:
+    struct Import
+    {
+        // The attributes the EGL image was created with, sorted, with the fds replaced by the
+        // device and inode of the dma-bufs.
+        std::vector<EGLAttrib> key;
+        vk::ImageHelper *image = nullptr;
+        bool renderable        = false;
+        bool textureable       = false;
+    };
+
+    DmaBufImportCache();
+    ~DmaBufImportCache();
+
+    // Takes ownership of the image, evicting the oldest import if the cache is full.
+    void store(vk::Renderer *renderer, Import &&import);
+    // Returns the import with the given key if there is one, ownership of which is given back to
+    // the caller.
+    bool take(const std::vector<EGLAttrib> &key, Import *importOut);
+    void destroy(vk::Renderer *renderer);
+
+  private:
+    angle::SimpleMutex mMutex;
+    // Oldest first.
+    std::deque<Import> mImports;
+};
+
 class DmaBufImageSiblingVkLinux : public ExternalImageSiblingVk
 {
   public:
@@ -60,6 +98,9 @@ class DmaBufImageSiblingVkLinux : public ExternalImageSiblingVk
     angle::Result initImpl(DisplayVk *displayVk);
 
     egl::AttributeMap mAttribs;
+    DisplayVkLinux *mDisplay;
+    // Identifies the dma-bufs for DmaBufImportCache, empty if the image is not to be cached.
+    std::vector<EGLAttrib> mImportKey;
     gl::Extents mSize;
     gl::Format mFormat;
     std::vector<VkFormat> mVkFormats;
@@ -21,7 +21,7 @@ DisplayVkSimple::DisplayVkSimple(const egl::DisplayState &state) : DisplayVkLinu
 
 void DisplayVkSimple::terminate()
 {
-    DisplayVk::terminate();
+    DisplayVkLinux::terminate();
 }
 
 bool DisplayVkSimple::isValidNativeWindow(EGLNativeWindowType window) const
@@ -37,7 +37,7 @@ egl::Error DisplayVkGbm::initialize(egl::Display *display)
 void DisplayVkGbm::terminate()
 {
     mGbmDevice = nullptr;
-    DisplayVk::terminate();
+    DisplayVkLinux::terminate();
 }
 
 bool DisplayVkGbm::isValidNativeWindow(EGLNativeWindowType window) const
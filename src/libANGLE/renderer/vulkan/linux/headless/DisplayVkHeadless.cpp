@@ -21,7 +21,7 @@ DisplayVkHeadless::DisplayVkHeadless(const egl::DisplayState &state) : DisplayVk
 
 void DisplayVkHeadless::terminate()
 {
-    DisplayVk::terminate();
+    DisplayVkLinux::terminate();
 }
 
 bool DisplayVkHeadless::isValidNativeWindow(EGLNativeWindowType window) const
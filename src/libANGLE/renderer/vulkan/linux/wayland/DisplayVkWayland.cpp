@@ -66,7 +66,7 @@ void DisplayVkWayland::terminate()
         mOwnDisplay = false;
     }
     mWaylandDisplay = nullptr;
-    DisplayVk::terminate();
+    DisplayVkLinux::terminate();
 }
 
 bool DisplayVkWayland::isValidNativeWindow(EGLNativeWindowType window) const
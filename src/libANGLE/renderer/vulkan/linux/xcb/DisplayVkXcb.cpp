@@ -76,7 +76,7 @@ void DisplayVkXcb::terminate()
         xcb_disconnect(mXcbConnection);
         mXcbConnection = nullptr;
     }
-    DisplayVk::terminate();
+    DisplayVkLinux::terminate();
 }
 
 bool DisplayVkXcb::isValidNativeWindow(EGLNativeWindowType window) const
@@ -32,6 +32,7 @@ constexpr angle::PackedEnumMap<PipelineStage, BufferMemoryBarrierData> kBufferMe
     {PipelineStage::Transfer, {VK_PIPELINE_STAGE_TRANSFER_BIT, EventStage::InvalidEnum}},
     {PipelineStage::BottomOfPipe, BufferMemoryBarrierData{VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, EventStage::InvalidEnum}},
     {PipelineStage::Host, {VK_PIPELINE_STAGE_HOST_BIT, EventStage::InvalidEnum}},
+    {PipelineStage::ConditionalRendering, {VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT, EventStage::InvalidEnum}},
 };
 
 constexpr ImageAccessToMemoryBarrierDataMap kImageMemoryBarrierData = {
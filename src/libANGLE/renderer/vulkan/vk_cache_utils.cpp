@@ -4211,6 +4211,10 @@ void GraphicsPipelineDesc::initializePipelineFragmentOutputState(
     {
         dynamicStateListOut->push_back(VK_DYNAMIC_STATE_LOGIC_OP_EXT);
     }
+    if (context->getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        dynamicStateListOut->push_back(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT);
+    }
 }
 
 void GraphicsPipelineDesc::updateVertexInputWithStride(ContextVk *contextVk,
@@ -4518,6 +4522,35 @@ void GraphicsPipelineDesc::resetBlendFuncsAndEquations(GraphicsPipelineTransitio
     }
 }
 
+void GraphicsPipelineDesc::updateDynamicBlendEquations(GraphicsPipelineTransitionBits *transition,
+                                                       const gl::BlendStateExt &blendStateExt,
+                                                       gl::DrawBufferMask attachmentMask)
+{
+    constexpr size_t kSizeBits = sizeof(PackedColorBlendAttachmentState) * 8;
+
+    for (size_t attachmentIndex : attachmentMask)
+    {
+        uint8_t colorBlendOp =
+            PackGLBlendOp(blendStateExt.getEquationColorIndexed(attachmentIndex));
+        if (colorBlendOp <= static_cast<uint8_t>(VK_BLEND_OP_MAX))
+        {
+            colorBlendOp = VK_BLEND_OP_ADD;
+        }
+
+        PackedColorBlendAttachmentState &blendAttachmentState =
+            mFragmentOutput.blend.attachments[attachmentIndex];
+        blendAttachmentState.colorBlendOp        = colorBlendOp;
+        blendAttachmentState.alphaBlendOp        = colorBlendOp;
+        blendAttachmentState.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+        blendAttachmentState.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+        blendAttachmentState.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        blendAttachmentState.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+
+        transition->set(ANGLE_GET_INDEXED_TRANSITION_BIT(mFragmentOutput.blend.attachments,
+                                                         attachmentIndex, kSizeBits));
+    }
+}
+
 void GraphicsPipelineDesc::setColorWriteMasks(gl::BlendStateExt::ColorMaskStorage::Type colorMasks,
                                               const gl::DrawBufferMask &alphaMask,
                                               const gl::DrawBufferMask &enabledDrawBuffers)
@@ -4912,6 +4945,94 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
     return memcmp(&lhs, &rhs, sizeof(AttachmentOpsArray)) == 0;
 }
 
+void GetColorBlendEquation(const gl::BlendStateExt &blendStateExt,
+                           size_t colorIndexGL,
+                           VkColorBlendEquationEXT *equationOut)
+{
+    const VkBlendOp colorBlendOp =
+        UnpackBlendOp(PackGLBlendOp(blendStateExt.getEquationColorIndexed(colorIndexGL)));
+    const VkBlendOp alphaBlendOp =
+        UnpackBlendOp(PackGLBlendOp(blendStateExt.getEquationAlphaIndexed(colorIndexGL)));
+
+    equationOut->srcColorBlendFactor = static_cast<VkBlendFactor>(
+        PackGLBlendFactor(blendStateExt.getSrcColorIndexed(colorIndexGL)));
+    equationOut->dstColorBlendFactor = static_cast<VkBlendFactor>(
+        PackGLBlendFactor(blendStateExt.getDstColorIndexed(colorIndexGL)));
+    equationOut->colorBlendOp = colorBlendOp <= VK_BLEND_OP_MAX ? colorBlendOp : VK_BLEND_OP_ADD;
+    equationOut->srcAlphaBlendFactor = static_cast<VkBlendFactor>(
+        PackGLBlendFactor(blendStateExt.getSrcAlphaIndexed(colorIndexGL)));
+    equationOut->dstAlphaBlendFactor = static_cast<VkBlendFactor>(
+        PackGLBlendFactor(blendStateExt.getDstAlphaIndexed(colorIndexGL)));
+    equationOut->alphaBlendOp = alphaBlendOp <= VK_BLEND_OP_MAX ? alphaBlendOp : VK_BLEND_OP_ADD;
+}
+
+void AccumulateAttachmentBandwidth(const RenderPassDesc &desc,
+                                   const AttachmentOpsArray &ops,
+                                   const gl::Rectangle &renderArea,
+                                   AttachmentBandwidth *bandwidthOut)
+{
+    // Every view of a multiview render pass is rendered to a separate layer.
+    const uint64_t pixelCount = static_cast<uint64_t>(renderArea.width) * renderArea.height *
+                                std::max<uint32_t>(desc.viewCount(), 1);
+    const uint64_t sampleCount = pixelCount * std::max<uint32_t>(desc.samples(), 1);
+
+    // Loads and stores of one aspect of an attachment.  Clears and DONT_CARE/NONE ops don't access
+    // memory.
+    auto accumulateOps = [&](uint32_t pixelBytes, uint16_t loadOp, uint16_t storeOp) {
+        if (loadOp == static_cast<uint16_t>(RenderPassLoadOp::Load))
+        {
+            bandwidthOut->loadBytes += pixelBytes * sampleCount;
+        }
+        if (storeOp == static_cast<uint16_t>(RenderPassStoreOp::Store))
+        {
+            bandwidthOut->storeBytes += pixelBytes * sampleCount;
+        }
+    };
+
+    PackedAttachmentIndex colorIndexVk(0);
+    for (uint32_t colorIndexGL = 0; colorIndexGL < desc.colorAttachmentRange(); ++colorIndexGL)
+    {
+        if (!desc.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+
+        const uint32_t pixelBytes = angle::Format::Get(desc[colorIndexGL]).pixelBytes;
+        accumulateOps(pixelBytes, ops[colorIndexVk].loadOp, ops[colorIndexVk].storeOp);
+
+        if (desc.hasColorResolveAttachment(colorIndexGL))
+        {
+            bandwidthOut->resolveBytes += pixelBytes * pixelCount;
+        }
+        if (desc.hasColorUnresolveAttachment(colorIndexGL))
+        {
+            bandwidthOut->unresolveBytes += pixelBytes * pixelCount;
+        }
+        ++colorIndexVk;
+    }
+
+    if (!desc.hasDepthStencilAttachment())
+    {
+        return;
+    }
+
+    const angle::Format &depthStencilFormat =
+        angle::Format::Get(desc[desc.depthStencilAttachmentIndex()]);
+    const uint32_t depthBytes   = depthStencilFormat.depthBits / 8;
+    const uint32_t stencilBytes = depthStencilFormat.stencilBits / 8;
+    accumulateOps(depthBytes, ops[colorIndexVk].loadOp, ops[colorIndexVk].storeOp);
+    accumulateOps(stencilBytes, ops[colorIndexVk].stencilLoadOp, ops[colorIndexVk].stencilStoreOp);
+
+    bandwidthOut->resolveBytes +=
+        ((desc.hasDepthResolveAttachment() ? depthBytes : 0) +
+         (desc.hasStencilResolveAttachment() ? stencilBytes : 0)) *
+        pixelCount;
+    bandwidthOut->unresolveBytes +=
+        ((desc.hasDepthUnresolveAttachment() ? depthBytes : 0) +
+         (desc.hasStencilUnresolveAttachment() ? stencilBytes : 0)) *
+        pixelCount;
+}
+
 // DescriptorSetLayoutDesc implementation.
 DescriptorSetLayoutDesc::DescriptorSetLayoutDesc()
     : mImmutableSamplers{}, mDescriptorSetLayoutBindings{}
@@ -4939,13 +5060,13 @@ size_t DescriptorSetLayoutDesc::hash() const
         genericHash ^= angle::ComputeGenericHash(angle::as_byte_span(mImmutableSamplers));
     }
 
-    return genericHash;
+    return genericHash ^ mCreateFlags;
 }
 
 bool DescriptorSetLayoutDesc::operator==(const DescriptorSetLayoutDesc &other) const
 {
     return mDescriptorSetLayoutBindings == other.mDescriptorSetLayoutBindings &&
-           mImmutableSamplers == other.mImmutableSamplers;
+           mImmutableSamplers == other.mImmutableSamplers && mCreateFlags == other.mCreateFlags;
 }
 
 void DescriptorSetLayoutDesc::addBinding(uint32_t bindingIndex,
@@ -5215,11 +5336,39 @@ angle::Result PipelineHelper::getPreferredPipeline(ContextVk *contextVk,
         }
     }
 
+    if (contextVk->getFeatures().prewarmMonolithicPipelineTransitions.enabled &&
+        !mMonolithicPipelineCreationTask.isValid())
+    {
+        ANGLE_TRY(prewarmTransitionTargets(contextVk));
+    }
+
     *pipelineOut = &mPipeline;
 
     return angle::Result::Continue;
 }
 
+angle::Result PipelineHelper::prewarmTransitionTargets(ContextVk *contextVk)
+{
+    // Only the most recently added transitions are considered, to bound the cost of this on the
+    // draw path.  Only one monolithic pipeline creation job can be in flight at a time, so the
+    // search stops at the first pending task.
+    constexpr size_t kMaxPrewarmCandidates = 4;
+
+    const size_t candidateCount = std::min(mTransitions.size(), kMaxPrewarmCandidates);
+    for (size_t index = 0; index < candidateCount; ++index)
+    {
+        PipelineHelper *target = mTransitions[mTransitions.size() - 1 - index].target;
+        WaitableMonolithicPipelineCreationTask &task = target->mMonolithicPipelineCreationTask;
+        if (task.isValid() && !task.isPosted())
+        {
+            return contextVk->getShareGroup()->schedulePrewarmMonolithicPipelineCreationTask(
+                contextVk, &task);
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
 void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
                                    const GraphicsPipelineDesc *desc,
                                    PipelineHelper *pipeline)
@@ -6359,8 +6508,11 @@ void DescriptorSetDescBuilder::updatePreCacheActiveTextures(
                 VkImageLayout imageLayout = textureVk->getImage().getCurrentLayout(renderer);
                 SetBitField(infoDesc.imageLayoutOrRange, imageLayout);
                 infoDesc.imageViewSerialOrOffset = imageViewSerial.viewSerial.getValue();
+                // An immutable sampler is part of the layout, so only the image view is keyed.
                 infoDesc.samplerOrBufferSerialOrStorageFormat =
-                    samplerHelper.getSamplerSerial().getValue();
+                    executableVk->hasImmutableTextureSampler(samplerIndex)
+                        ? 0
+                        : samplerHelper.getSamplerSerial().getValue();
                 memcpy(&infoDesc.imageSubresourceRange, &imageViewSerial.subresource,
                        sizeof(uint32_t));
             }
@@ -7412,7 +7564,7 @@ void RenderPassCache::destroy(ContextVk *contextVk)
     VkDevice device = renderer->getDevice();
 
     // Make sure there are no jobs referencing the render pass cache.
-    contextVk->getShareGroup()->waitForCurrentMonolithicPipelineCreationTask();
+    contextVk->getShareGroup()->waitForCurrentMonolithicPipelineCreationTasks();
 
     for (auto &outerIt : mPayload)
     {
@@ -7427,7 +7579,7 @@ void RenderPassCache::destroy(ContextVk *contextVk)
 void RenderPassCache::clear(ContextVk *contextVk)
 {
     // Make sure there are no jobs referencing the render pass cache.
-    contextVk->getShareGroup()->waitForCurrentMonolithicPipelineCreationTask();
+    contextVk->getShareGroup()->waitForCurrentMonolithicPipelineCreationTasks();
 
     for (auto &outerIt : mPayload)
     {
@@ -8429,7 +8581,7 @@ angle::Result DescriptorSetLayoutCache::getDescriptorSetLayout(
 
     VkDescriptorSetLayoutCreateInfo createInfo = {};
     createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    createInfo.flags        = 0;
+    createInfo.flags        = desc.getCreateFlags();
     createInfo.bindingCount = static_cast<uint32_t>(bindingVector.size());
     createInfo.pBindings    = bindingVector.data();
 
@@ -8585,6 +8737,84 @@ angle::Result SamplerYcbcrConversionCache::getSamplerYcbcrConversion(
 }
 
 // SamplerCache implementation.
+// ShaderModuleCache implementation.
+namespace
+{
+// The cache is pruned of unused modules when it grows past this many entries, and then every time
+// it doubles in size.
+constexpr size_t kShaderModuleCacheMinPruneThreshold = 256;
+}  // anonymous namespace
+
+ShaderModuleCache::ShaderModuleCache() : mPruneThreshold(kShaderModuleCacheMinPruneThreshold) {}
+
+ShaderModuleCache::~ShaderModuleCache()
+{
+    ASSERT(mPayload.empty());
+}
+
+void ShaderModuleCache::destroy(vk::Renderer *renderer)
+{
+    renderer->accumulateCacheStats(VulkanCacheType::ShaderModule, mCacheStats);
+    ASSERT(AllCacheEntriesHaveUniqueReference(mPayload));
+    mPayload.clear();
+}
+
+size_t ShaderModuleCache::SpirvBlobHash::operator()(const angle::spirv::Blob &blob) const
+{
+    return angle::ComputeGenericHash(angle::as_byte_span(blob));
+}
+
+angle::Result ShaderModuleCache::getShaderModule(vk::ErrorContext *context,
+                                                 const angle::spirv::Blob &spirvBlob,
+                                                 vk::ShaderModulePtr *shaderModuleOut)
+{
+    // Note: this function may be called by link jobs, without holding the share group lock.
+    std::unique_lock<angle::SimpleMutex> lock(mMutex);
+
+    auto iter = mPayload.find(spirvBlob);
+    if (iter != mPayload.end())
+    {
+        *shaderModuleOut = iter->second;
+        mCacheStats.hit();
+        ++context->getPerfCounters().shaderModuleCacheHits;
+        return angle::Result::Continue;
+    }
+
+    if (mPayload.size() >= mPruneThreshold)
+    {
+        pruneUnusedShaderModules();
+    }
+
+    mCacheStats.miss();
+    vk::ShaderModulePtr newShaderModule;
+    ANGLE_TRY(vk::InitShaderModule(context, &newShaderModule, spirvBlob.data(),
+                                   spirvBlob.size() * sizeof(uint32_t)));
+    ++context->getPerfCounters().shaderModuleCreations;
+
+    *shaderModuleOut = newShaderModule;
+    mPayload.emplace(spirvBlob, std::move(newShaderModule));
+    mCacheStats.setSize(static_cast<uint32_t>(mPayload.size()));
+
+    return angle::Result::Continue;
+}
+
+void ShaderModuleCache::pruneUnusedShaderModules()
+{
+    for (auto iter = mPayload.begin(); iter != mPayload.end();)
+    {
+        if (iter->second.unique())
+        {
+            mPayload.erase(iter++);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    mPruneThreshold = std::max(kShaderModuleCacheMinPruneThreshold, mPayload.size() * 2);
+}
+
 SamplerCache::SamplerCache() = default;
 
 SamplerCache::~SamplerCache()
@@ -21,6 +21,8 @@
 #include "common/FixedVector.h"
 #include "common/SimpleMutex.h"
 #include "common/WorkerThread.h"
+#include "common/hash_containers.h"
+#include "common/spirv/spirv_types.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/renderer/vulkan/ShaderInterfaceVariableInfoMap.h"
 #include "libANGLE/renderer/vulkan/vk_resource.h"
@@ -500,6 +502,22 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs);
 
 static_assert(sizeof(AttachmentOpsArray) == 40, "Size check failed");
 
+// Estimated number of bytes a tiling GPU transfers between tile memory and the attachments of a
+// render pass.  Loads and stores are of the (possibly multisampled) attachments themselves, while
+// resolves and unresolves are of the single-sampled resolve attachments.
+struct AttachmentBandwidth
+{
+    uint64_t loadBytes      = 0;
+    uint64_t storeBytes     = 0;
+    uint64_t resolveBytes   = 0;
+    uint64_t unresolveBytes = 0;
+};
+
+void AccumulateAttachmentBandwidth(const RenderPassDesc &desc,
+                                   const AttachmentOpsArray &ops,
+                                   const gl::Rectangle &renderArea,
+                                   AttachmentBandwidth *bandwidthOut);
+
 struct PackedAttribDesc final
 {
     uint8_t format;
@@ -799,7 +817,7 @@ struct GraphicsPipelineFragmentOutputVulkanStructs
 
 ANGLE_ENABLE_STRUCT_PADDING_WARNINGS
 
-using GraphicsPipelineDynamicStateList = angle::FixedVector<VkDynamicState, 24>;
+using GraphicsPipelineDynamicStateList = angle::FixedVector<VkDynamicState, 25>;
 
 enum class PipelineRobustness
 {
@@ -1033,6 +1051,12 @@ class GraphicsPipelineDesc final
                                      const gl::BlendStateExt &blendStateExt,
                                      gl::DrawBufferMask previousAttachmentsMask,
                                      gl::DrawBufferMask newAttachmentsMask);
+    // When the blend funcs and equations are dynamic state, only whether an advanced blend
+    // equation is used (which is emulated with blending disabled) affects the pipeline.  The rest
+    // is set to the defaults.
+    void updateDynamicBlendEquations(GraphicsPipelineTransitionBits *transition,
+                                     const gl::BlendStateExt &blendStateExt,
+                                     gl::DrawBufferMask attachmentMask);
     void setColorWriteMasks(gl::BlendStateExt::ColorMaskStorage::Type colorMasks,
                             const gl::DrawBufferMask &alphaMask,
                             const gl::DrawBufferMask &enabledDrawBuffers);
@@ -1176,6 +1200,12 @@ class GraphicsPipelineDesc final
 constexpr size_t kGraphicsPipelineDescSize = sizeof(GraphicsPipelineDesc);
 static_assert(kGraphicsPipelineDescSize == kGraphicsPipelineDescSumOfSizes, "Size mismatch");
 
+// The blend funcs and equations of a draw buffer for vkCmdSetColorBlendEquationEXT.  Advanced
+// blend equations are emulated with blending disabled, so they are replaced with ADD.
+void GetColorBlendEquation(const gl::BlendStateExt &blendStateExt,
+                           size_t colorIndexGL,
+                           VkColorBlendEquationEXT *equationOut);
+
 // Values are based on data recorded here -> https://anglebug.com/42267114#comment5
 constexpr size_t kDefaultDescriptorSetLayoutBindingsCount = 8;
 constexpr size_t kDefaultImmutableSamplerBindingsCount    = 1;
@@ -1206,6 +1236,16 @@ class DescriptorSetLayoutDesc final
 
     bool empty() const { return mDescriptorSetLayoutBindings.empty(); }
 
+    // The layout is created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR, and its
+    // descriptors are set with vkCmdPushDescriptorSetKHR instead of through a descriptor set.
+    void setPushDescriptor(bool pushDescriptor)
+    {
+        mCreateFlags =
+            pushDescriptor ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+    }
+    bool isPushDescriptor() const { return mCreateFlags != 0; }
+    VkDescriptorSetLayoutCreateFlags getCreateFlags() const { return mCreateFlags; }
+
   private:
     // There is a small risk of an issue if the sampler cache is evicted but not the descriptor
     // cache we would have an invalid handle here. Thus propose follow-up work:
@@ -1236,7 +1276,8 @@ class DescriptorSetLayoutDesc final
     angle::FastVector<PackedDescriptorSetBinding, kDefaultDescriptorSetLayoutBindingsCount>
         mDescriptorSetLayoutBindings;
 
-#if !defined(ANGLE_IS_64_BIT_CPU)
+    VkDescriptorSetLayoutCreateFlags mCreateFlags = 0;
+#if defined(ANGLE_IS_64_BIT_CPU)
     ANGLE_MAYBE_UNUSED_PRIVATE_FIELD uint32_t mPadding = 0;
 #endif
 };
@@ -1626,6 +1667,11 @@ class PipelineHelper final : public Resource
     // pipeline released.
     angle::Result getPreferredPipeline(ContextVk *contextVk, const Pipeline **pipelineOut);
 
+    // If there is no monolithic pipeline creation task of this pipeline to wait for, attempts to
+    // schedule that of a pipeline that was previously transitioned to from this one.  Those are the
+    // pipelines that are likely to be needed after the next state change.
+    angle::Result prewarmTransitionTargets(ContextVk *contextVk);
+
     ANGLE_INLINE bool findTransition(GraphicsPipelineTransitionBits bits,
                                      const GraphicsPipelineDesc &desc,
                                      PipelineHelper **pipelineOut) const
@@ -2453,6 +2499,7 @@ enum class VulkanCacheType
     ShaderResourcesDescriptors,
     Framebuffer,
     DescriptorMetaCache,
+    ShaderModule,
     EnumCount
 };
 
@@ -2840,7 +2887,9 @@ class DescriptorSetLayoutCache final : angle::NonCopyable
 
   private:
     mutable angle::SimpleMutex mMutex;
-    std::unordered_map<vk::DescriptorSetLayoutDesc, vk::DescriptorSetLayoutPtr> mPayload;
+    // Entries are shared pointers, so pointer stability is not needed and an open-addressing map
+    // keeps lookups cache-friendly.
+    angle::HashMap<vk::DescriptorSetLayoutDesc, vk::DescriptorSetLayoutPtr> mPayload;
     CacheStats mCacheStats;
 };
 
@@ -2859,7 +2908,35 @@ class PipelineLayoutCache final : public HasCacheStats<VulkanCacheType::Pipeline
 
   private:
     mutable angle::SimpleMutex mMutex;
-    std::unordered_map<vk::PipelineLayoutDesc, vk::PipelineLayoutPtr> mPayload;
+    angle::HashMap<vk::PipelineLayoutDesc, vk::PipelineLayoutPtr> mPayload;
+};
+
+// Deduplicates shader modules by their (transformed) SPIR-V, so that identical shaders in different
+// programs share a VkShaderModule.
+class ShaderModuleCache final : public HasCacheStats<VulkanCacheType::ShaderModule>
+{
+  public:
+    ShaderModuleCache();
+    ~ShaderModuleCache() override;
+
+    void destroy(vk::Renderer *renderer);
+
+    angle::Result getShaderModule(vk::ErrorContext *context,
+                                  const angle::spirv::Blob &spirvBlob,
+                                  vk::ShaderModulePtr *shaderModuleOut);
+
+  private:
+    struct SpirvBlobHash
+    {
+        size_t operator()(const angle::spirv::Blob &blob) const;
+    };
+
+    // Drops the modules that are no longer used by any program.
+    void pruneUnusedShaderModules();
+
+    mutable angle::SimpleMutex mMutex;
+    angle::HashMap<angle::spirv::Blob, vk::ShaderModulePtr, SpirvBlobHash> mPayload;
+    size_t mPruneThreshold;
 };
 
 class SamplerCache final : public HasCacheStats<VulkanCacheType::Sampler>
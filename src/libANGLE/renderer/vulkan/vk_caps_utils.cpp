@@ -465,6 +465,10 @@ void Renderer::ensureCapsInitialized() const
     // render pass, so there is no dependency to `inheritedQueries`.
     mNativeExtensions.occlusionQueryBooleanEXT = true;
 
+    // Draws can be predicated on the result of an occlusion query with
+    // VK_EXT_conditional_rendering.
+    mNativeExtensions.conditionalRenderNV = getFeatures().supportsConditionalRendering.enabled;
+
     // From the Vulkan specs:
     // > The number of valid bits in a timestamp value is determined by the
     // > VkQueueFamilyProperties::timestampValidBits property of the queue on which the timestamp is
@@ -1329,6 +1333,9 @@ void Renderer::ensureCapsInitialized() const
     mNativeExtensions.multiviewOVR =
         mFeatures.supportsMultiview.enabled && mFeatures.bresenhamLineRasterization.enabled;
     mNativeExtensions.multiview2OVR = mNativeExtensions.multiviewOVR;
+    // Multisampled 2D array textures are rendered to with the same multiview render passes.
+    mNativeExtensions.multiviewMultisampleANGLE =
+        mNativeExtensions.multiviewOVR && mNativeExtensions.textureStorageMultisample2dArrayOES;
     // Max views affects the number of Vulkan queries per GL query in render pass, and
     // SecondaryCommandBuffer's ResetQueryPoolParams would like this to have an upper limit (of
     // 255).
@@ -1399,10 +1406,12 @@ void Renderer::ensureCapsInitialized() const
         // Prefer framebuffer fetch in almost all cases if it's available, except if framebuffer
         // fetch isn't coherent *and* fragment shader pixel interlock is available. This is the case
         // on many desktop GPUs. Fall back to using shader images with interlock to provide coherent
-        // PLS in this case.
+        // PLS in this case, unless preferFramebufferFetchPixelLocalStorage trades coherence for
+        // keeping the planes in attachments.
         bool fetchIsNonCoherentButHasInterlock =
             !mIsColorFramebufferFetchCoherent &&
-            getFeatures().supportsFragmentShaderPixelInterlock.enabled;
+            getFeatures().supportsFragmentShaderPixelInterlock.enabled &&
+            !getFeatures().preferFramebufferFetchPixelLocalStorage.enabled;
 
         if (getFeatures().supportsShaderFramebufferFetch.enabled &&
             !fetchIsNonCoherentButHasInterlock)
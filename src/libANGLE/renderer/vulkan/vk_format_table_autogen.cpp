@@ -1618,23 +1618,38 @@ void Format::initialize(Renderer *renderer, const angle::Format &angleFormat)
             break;
 
         case angle::FormatID::PALETTE4_R4G4B4A4_UNORM:
-            mIntendedGLFormat              = GL_PALETTE4_RGBA4_OES;
-            mActualSampleOnlyImageFormatID = angle::FormatID::R8G8B8A8_UNORM;
-            mImageInitializerFunction      = nullptr;
+            mIntendedGLFormat = GL_PALETTE4_RGBA4_OES;
+            {
+                static constexpr ImageFormatInitInfo kInfo[] = {
+                    {angle::FormatID::R4G4B4A4_UNORM, nullptr},
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                };
+                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+            }
 
             break;
 
         case angle::FormatID::PALETTE4_R5G5B5A1_UNORM:
-            mIntendedGLFormat              = GL_PALETTE4_RGB5_A1_OES;
-            mActualSampleOnlyImageFormatID = angle::FormatID::R8G8B8A8_UNORM;
-            mImageInitializerFunction      = nullptr;
+            mIntendedGLFormat = GL_PALETTE4_RGB5_A1_OES;
+            {
+                static constexpr ImageFormatInitInfo kInfo[] = {
+                    {angle::FormatID::R5G5B5A1_UNORM, nullptr},
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                };
+                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+            }
 
             break;
 
         case angle::FormatID::PALETTE4_R5G6B5_UNORM:
-            mIntendedGLFormat              = GL_PALETTE4_R5_G6_B5_OES;
-            mActualSampleOnlyImageFormatID = angle::FormatID::R8G8B8A8_UNORM;
-            mImageInitializerFunction      = nullptr;
+            mIntendedGLFormat = GL_PALETTE4_R5_G6_B5_OES;
+            {
+                static constexpr ImageFormatInitInfo kInfo[] = {
+                    {angle::FormatID::R5G6B5_UNORM, nullptr},
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                };
+                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+            }
 
             break;
 
@@ -1653,23 +1668,38 @@ void Format::initialize(Renderer *renderer, const angle::Format &angleFormat)
             break;
 
         case angle::FormatID::PALETTE8_R4G4B4A4_UNORM:
-            mIntendedGLFormat              = GL_PALETTE8_RGBA4_OES;
-            mActualSampleOnlyImageFormatID = angle::FormatID::R8G8B8A8_UNORM;
-            mImageInitializerFunction      = nullptr;
+            mIntendedGLFormat = GL_PALETTE8_RGBA4_OES;
+            {
+                static constexpr ImageFormatInitInfo kInfo[] = {
+                    {angle::FormatID::R4G4B4A4_UNORM, nullptr},
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                };
+                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+            }
 
             break;
 
         case angle::FormatID::PALETTE8_R5G5B5A1_UNORM:
-            mIntendedGLFormat              = GL_PALETTE8_RGB5_A1_OES;
-            mActualSampleOnlyImageFormatID = angle::FormatID::R8G8B8A8_UNORM;
-            mImageInitializerFunction      = nullptr;
+            mIntendedGLFormat = GL_PALETTE8_RGB5_A1_OES;
+            {
+                static constexpr ImageFormatInitInfo kInfo[] = {
+                    {angle::FormatID::R5G5B5A1_UNORM, nullptr},
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                };
+                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+            }
 
             break;
 
         case angle::FormatID::PALETTE8_R5G6B5_UNORM:
-            mIntendedGLFormat              = GL_PALETTE8_R5_G6_B5_OES;
-            mActualSampleOnlyImageFormatID = angle::FormatID::R8G8B8A8_UNORM;
-            mImageInitializerFunction      = nullptr;
+            mIntendedGLFormat = GL_PALETTE8_R5_G6_B5_OES;
+            {
+                static constexpr ImageFormatInitInfo kInfo[] = {
+                    {angle::FormatID::R5G6B5_UNORM, nullptr},
+                    {angle::FormatID::R8G8B8A8_UNORM, nullptr},
+                };
+                initImageFallback(renderer, kInfo, ArraySize(kInfo));
+            }
 
             break;
 
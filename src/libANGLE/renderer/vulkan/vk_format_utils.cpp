@@ -285,8 +285,7 @@ void FormatTable::initialize(Renderer *renderer, gl::TextureCapsMap *outTextureC
         }
 
         bool transcodeEtcToBc = false;
-        if (renderer->getFeatures().supportsComputeTranscodeEtcToBc.enabled &&
-            IsETCFormat(intendedFormatID) &&
+        if (renderer->isEtcToBcTranscodingEnabled() && IsETCFormat(intendedFormatID) &&
             !angle::Format::Get(format.mActualSampleOnlyImageFormatID).isBlock)
         {
             // Check BC format support
@@ -618,6 +618,65 @@ const VkImageFormatListCreateInfoKHR *GetImageFormatListCreateInfo(const void *c
     return reinterpret_cast<const VkImageFormatListCreateInfoKHR *>(pNextChain);
 }
 
+// Uploads smaller than this are converted on the CPU even if expandRgbUploadsWithCompute is
+// enabled, as the conversion is cheaper than the dispatch.
+constexpr size_t kMinPixelCountForComputeRGBExpansion = 4096;
+
+// Returns true if |dstFormatID| is the four-channel format used to emulate the three-channel
+// |srcFormatID|, with the same component type and width.  Such data can be expanded on the GPU
+// with the vertex conversion shader.
+bool IsRGBToRGBAExpansion(angle::FormatID srcFormatID, angle::FormatID dstFormatID)
+{
+    switch (srcFormatID)
+    {
+        case angle::FormatID::R8G8B8_UNORM:
+            return dstFormatID == angle::FormatID::R8G8B8A8_UNORM;
+        case angle::FormatID::R8G8B8_UNORM_SRGB:
+            return dstFormatID == angle::FormatID::R8G8B8A8_UNORM_SRGB;
+        case angle::FormatID::R8G8B8_SNORM:
+            return dstFormatID == angle::FormatID::R8G8B8A8_SNORM;
+        case angle::FormatID::R8G8B8_UINT:
+            return dstFormatID == angle::FormatID::R8G8B8A8_UINT;
+        case angle::FormatID::R8G8B8_SINT:
+            return dstFormatID == angle::FormatID::R8G8B8A8_SINT;
+        case angle::FormatID::R16G16B16_UNORM:
+            return dstFormatID == angle::FormatID::R16G16B16A16_UNORM;
+        case angle::FormatID::R16G16B16_SNORM:
+            return dstFormatID == angle::FormatID::R16G16B16A16_SNORM;
+        case angle::FormatID::R16G16B16_UINT:
+            return dstFormatID == angle::FormatID::R16G16B16A16_UINT;
+        case angle::FormatID::R16G16B16_SINT:
+            return dstFormatID == angle::FormatID::R16G16B16A16_SINT;
+        case angle::FormatID::R16G16B16_FLOAT:
+            return dstFormatID == angle::FormatID::R16G16B16A16_FLOAT;
+        case angle::FormatID::R32G32B32_UINT:
+            return dstFormatID == angle::FormatID::R32G32B32A32_UINT;
+        case angle::FormatID::R32G32B32_SINT:
+            return dstFormatID == angle::FormatID::R32G32B32A32_SINT;
+        case angle::FormatID::R32G32B32_FLOAT:
+            return dstFormatID == angle::FormatID::R32G32B32A32_FLOAT;
+        default:
+            return false;
+    }
+}
+
+// Returns a load function that copies three-channel pixels of the given size unmodified.
+LoadImageFunction GetRGBCopyLoadFunction(size_t pixelBytes)
+{
+    switch (pixelBytes)
+    {
+        case 3:
+            return angle::LoadToNative<GLubyte, 3>;
+        case 6:
+            return angle::LoadToNative<GLushort, 3>;
+        case 12:
+            return angle::LoadToNative<GLuint, 3>;
+        default:
+            UNREACHABLE();
+            return nullptr;
+    }
+}
+
 void DeriveImageViewFormatsFromExternalCreateInfo(const void *externalCreateInfo,
                                                   vk::ImageHelper::ImageFormats *imageFormats)
 {
@@ -636,8 +695,117 @@ void DeriveImageViewFormatsFromExternalCreateInfo(const void *externalCreateInfo
         }
     }
 }
+
+// The maximum number of buffer updates that are copied to an image with one
+// vkCmdCopyBufferToImage call.  This also bounds the cost of checking a new update against the
+// ones already in the batch.
+constexpr size_t kMaxBatchedBufferToImageCopyRegions = 64;
+
+bool DoBufferToImageCopiesOverlap(const VkBufferImageCopy &a, const VkBufferImageCopy &b)
+{
+    const VkImageSubresourceLayers &aLayers = a.imageSubresource;
+    const VkImageSubresourceLayers &bLayers = b.imageSubresource;
+    if ((aLayers.aspectMask & bLayers.aspectMask) == 0 || aLayers.mipLevel != bLayers.mipLevel ||
+        aLayers.baseArrayLayer >= bLayers.baseArrayLayer + bLayers.layerCount ||
+        bLayers.baseArrayLayer >= aLayers.baseArrayLayer + aLayers.layerCount)
+    {
+        return false;
+    }
+
+    auto rangesOverlap = [](int32_t aStart, uint32_t aSize, int32_t bStart, uint32_t bSize) {
+        return aStart < bStart + static_cast<int32_t>(bSize) &&
+               bStart < aStart + static_cast<int32_t>(aSize);
+    };
+    return rangesOverlap(a.imageOffset.x, a.imageExtent.width, b.imageOffset.x,
+                         b.imageExtent.width) &&
+           rangesOverlap(a.imageOffset.y, a.imageExtent.height, b.imageOffset.y,
+                         b.imageExtent.height) &&
+           rangesOverlap(a.imageOffset.z, a.imageExtent.depth, b.imageOffset.z,
+                         b.imageExtent.depth);
+}
+
+// Loads an image into a staging buffer on a worker thread.  The source data is copied, as the
+// application may change it as soon as the upload call returns.
+class StagedLoadTask final : public angle::Closure
+{
+  public:
+    StagedLoadTask(LoadImageFunction loadFunction,
+                   const angle::ImageLoadContext &context,
+                   const gl::Extents &extents,
+                   const uint8_t *input,
+                   size_t inputRowPitch,
+                   size_t inputDepthPitch,
+                   uint8_t *output,
+                   size_t outputRowPitch,
+                   size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mContext(context),
+          mExtents(extents),
+          mInput(input, input + inputDepthPitch * extents.depth),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "StagedLoadTask");
+        mLoadFunction(mContext, mExtents.width, mExtents.height, mExtents.depth, mInput.data(),
+                      mInputRowPitch, mInputDepthPitch, mOutput, mOutputRowPitch,
+                      mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    angle::ImageLoadContext mContext;
+    gl::Extents mExtents;
+    std::vector<uint8_t> mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    // The staging buffer is kept alive until the owning image waits for the task.
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
 }  // anonymous namespace
 
+// Buffer updates that are copied to the image with a single vkCmdCopyBufferToImage call.  They
+// are all sourced from the same VkBuffer (the staging allocations of small updates are
+// suballocated from the same buffer block) and don't overlap each other, so no barrier is needed
+// between them.
+struct ImageHelper::PendingBufferToImageCopies
+{
+    bool canAppend(VkBuffer srcBuffer,
+                   const VkBufferImageCopy &region,
+                   const ImageLayerWriteMask &layerMask) const
+    {
+        if (regions.empty() || srcBuffer != buffer ||
+            regions.size() >= kMaxBatchedBufferToImageCopyRegions ||
+            (layerMask & writesBeforeBatch).any())
+        {
+            return false;
+        }
+        for (const VkBufferImageCopy &pendingRegion : regions)
+        {
+            if (DoBufferToImageCopiesOverlap(pendingRegion, region))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    VkBuffer buffer = VK_NULL_HANDLE;
+    angle::FastVector<VkBufferImageCopy, kMaxBatchedBufferToImageCopyRegions> regions;
+    // The total size of the staging buffers of the batched updates.
+    VkDeviceSize size = 0;
+    // The layers of the level that were written since the last barrier, before the first update in
+    // the batch.  Updates to these layers cannot join the batch as they need a barrier.
+    ImageLayerWriteMask writesBeforeBatch;
+};
+
 // This is an arbitrary max. We can change this later if necessary.
 uint32_t DynamicDescriptorPool::mMaxSetsPerPool           = 16;
 uint32_t DynamicDescriptorPool::mMaxSetsPerPoolMultiplier = 2;
@@ -759,6 +927,7 @@ void RenderPassAttachment::reset()
     mClearedCmdCount     = kInfiniteCmdCount;
     mClearValue          = {};
     mInvalidateArea      = gl::Rectangle();
+    mLoadSkippedArea     = gl::Rectangle();
 }
 
 void RenderPassAttachment::onAccess(ResourceAccess access, uint32_t currentCmdCount)
@@ -810,6 +979,17 @@ void RenderPassAttachment::onRenderAreaGrowth(ContextVk *contextVk,
     mInvalidatedCmdCount = kInfiniteCmdCount;
 }
 
+bool RenderPassAttachment::onRenderAreaGrowthRestoreLoad(const gl::Rectangle &newRenderArea)
+{
+    if (mLoadSkippedArea.empty() || mLoadSkippedArea.encloses(newRenderArea))
+    {
+        return false;
+    }
+
+    mLoadSkippedArea = gl::Rectangle();
+    return true;
+}
+
 void RenderPassAttachment::finalizeLoadStore(ErrorContext *context,
                                              uint32_t currentCmdCount,
                                              bool hasUnresolveAttachment,
@@ -825,6 +1005,15 @@ void RenderPassAttachment::finalizeLoadStore(ErrorContext *context,
     {
         *storeOp          = RenderPassStoreOp::DontCare;
         *isInvalidatedOut = true;
+
+        // If only a part of the attachment was invalidated, let the image know so that a future
+        // render pass within that area would use loadOp=DONT_CARE.  Full invalidates have
+        // already marked the contents undefined.
+        if (mImage && !mInvalidateArea.empty() && isInvalidated(currentCmdCount))
+        {
+            mImage->setSubresourceInvalidatedArea(mLevelIndex, mLayerIndex, mLayerCount, mAspect,
+                                                  mInvalidateArea);
+        }
     }
     else if (hasWriteAfterInvalidate(currentCmdCount))
     {
@@ -1009,6 +1198,36 @@ void CommandBufferHelperCommon::resetImpl(ErrorContext *context)
 
     ASSERT(mPipelineBarriers.isEmpty());
     ASSERT(mEventBarriers.isEmpty());
+
+    // The queries are left unwritten if the commands were abandoned.
+    mGpuTimeQueryPool = nullptr;
+}
+
+void CommandBufferHelperCommon::writeGpuTimeBeginTimestamp(PrimaryCommandBuffer *primaryCommands)
+{
+    if (mGpuTimeQueryPool == nullptr)
+    {
+        return;
+    }
+
+    // The reset is recorded in the primary command buffer too, so that it's done outside the
+    // render pass.  Bottom of pipe, so that the begin timestamp is taken once the previous commands
+    // are done and the time of overlapping command buffers isn't counted twice.
+    primaryCommands->resetQueryPool(*mGpuTimeQueryPool, mGpuTimeQuery, 2);
+    primaryCommands->writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, *mGpuTimeQueryPool,
+                                    mGpuTimeQuery);
+}
+
+void CommandBufferHelperCommon::writeGpuTimeEndTimestamp(PrimaryCommandBuffer *primaryCommands)
+{
+    if (mGpuTimeQueryPool == nullptr)
+    {
+        return;
+    }
+
+    primaryCommands->writeTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, *mGpuTimeQueryPool,
+                                    mGpuTimeQuery + 1);
+    mGpuTimeQueryPool = nullptr;
 }
 
 template <class DerivedT>
@@ -1349,6 +1568,22 @@ void OutsideRenderPassCommandBufferHelper::imageWrite(Context *context,
     retainImageWithEvent(context, image);
 }
 
+bool OutsideRenderPassCommandBufferHelper::canBatchImageBarrier(Context *context,
+                                                                const ImageHelper &image) const
+{
+    return context->getFeatures().batchOutsideRenderPassImageBarriers.enabled &&
+           !(image.getResourceUse() >= mQueueSerial);
+}
+
+void OutsideRenderPassCommandBufferHelper::batchImageBarrier(Context *context,
+                                                             VkImageAspectFlags aspectFlags,
+                                                             ImageAccess imageAccess,
+                                                             ImageHelper *image)
+{
+    ASSERT(canBatchImageBarrier(context, *image));
+    updateImageLayoutAndBarrier(context, image, aspectFlags, imageAccess, BarrierType::Event);
+}
+
 void OutsideRenderPassCommandBufferHelper::retainImage(Renderer *renderer, ImageHelper *image)
 {
     // We want explicit control on when VkEvent is used for outsideRPCommands to minimize the
@@ -1363,6 +1598,14 @@ void OutsideRenderPassCommandBufferHelper::trackImageWithEvent(Context *context,
     flushSetEventsImpl(context, &mCommandBuffer);
 }
 
+void OutsideRenderPassCommandBufferHelper::trackImageWithDeferredEvent(Context *context,
+                                                                      ImageHelper *image)
+{
+    ASSERT(context->getFeatures().useVkEventForImageBarrier.enabled);
+    // The events are set in flushToPrimary.
+    image->setCurrentRefCountedEvent(context, &mRefCountedEvents);
+}
+
 void OutsideRenderPassCommandBufferHelper::collectRefCountedEventsGarbage(
     RefCountedEventsGarbageRecycler *garbageRecycler)
 {
@@ -1386,10 +1629,14 @@ angle::Result OutsideRenderPassCommandBufferHelper::flushToPrimary(
     // Commands that are added to primary before beginRenderPass command
     executeBarriers(renderer, commandsState, primaryCommands);
 
+    writeGpuTimeBeginTimestamp(primaryCommands);
+
     ANGLE_TRY(endCommandBuffer(context));
     ASSERT(mIsCommandBufferEnded);
     mCommandBuffer.executeCommands(primaryCommands);
 
+    writeGpuTimeEndTimestamp(primaryCommands);
+
     // Call VkCmdSetEvent to track the completion of this renderPass.
     flushSetEventsImpl(context, primaryCommands);
 
@@ -1534,6 +1781,7 @@ RenderPassCommandBufferHelper::RenderPassCommandBufferHelper()
       mCounter(0),
       mClearValues{},
       mRenderPassStarted(false),
+      mScissoredClearLayerCount(0),
       mTransformFeedbackCounterBuffers{},
       mTransformFeedbackCounterBufferOffsets{},
       mValidTransformFeedbackBufferCount(0),
@@ -2305,6 +2553,7 @@ angle::Result RenderPassCommandBufferHelper::beginRenderPass(
     mFramebuffer                 = std::move(framebuffer);
     mRenderArea                  = renderArea;
     mClearValues                 = clearValues;
+    mScissoredClearLayerCount    = 0;
     mQueueSerial                 = queueSerial;
     *commandBufferOut            = &getCommandBuffer();
 
@@ -2396,6 +2645,23 @@ angle::Result RenderPassCommandBufferHelper::endRenderPass(ContextVk *contextVk)
     return angle::Result::Continue;
 }
 
+bool RenderPassCommandBufferHelper::executesInlineInPrimary() const
+{
+    if (ExecutesInline())
+    {
+        return true;
+    }
+
+    for (uint32_t subpass = 0; subpass < getSubpassCommandBufferCount(); ++subpass)
+    {
+        if (!mCommandBuffers[subpass].empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 angle::Result RenderPassCommandBufferHelper::endRenderPassCommandBuffer(ContextVk *contextVk)
 {
     return getCommandBuffer().end(contextVk);
@@ -2524,13 +2790,15 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
     // Commands that are added to primary before beginRenderPass command
     executeBarriers(renderer, commandsState, primaryCommands);
 
-    constexpr VkSubpassContents kSubpassContents =
-        ExecutesInline() ? VK_SUBPASS_CONTENTS_INLINE
-                         : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+    writeGpuTimeBeginTimestamp(primaryCommands);
+
+    const bool executesInline = executesInlineInPrimary();
+    const VsubpassContents kSubpassContents =
+        executesInline ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
 
     if (!renderPass.valid())
     {
-        mRenderPassDesc.beginRendering(context, primaryCommands, mRenderArea, kSubpassContents,
+        mRenderPassDesc.beginRendering(context, primaryCommands, mRenderArea, subpassContents,
                                        mFramebuffer.getUnpackedImageViews(), mAttachmentOps,
                                        mClearValues, mFramebuffer.getLayers());
     }
@@ -2552,7 +2820,7 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
         mRenderPassDesc.beginRenderPass(
             context, primaryCommands, renderPass,
             framebufferOverride ? framebufferOverride : mFramebuffer.getFramebuffer().getHandle(),
-            mRenderArea, kSubpassContents, mClearValues,
+            mRenderArea, subpassContents, mClearValues,
             mFramebuffer.isImageless() ? &attachmentBeginInfo : nullptr);
     }
 
@@ -2569,9 +2837,14 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
         if (subpass > 0)
         {
             ASSERT(!context->getFeatures().preferDynamicRendering.enabled);
-            primaryCommands->nextSubpass(kSubpassContents);
+            primaryCommands->nextSubpass(subpassContents);
+        }
+        // Empty Vulkan secondary command buffers are not executed.  ANGLE's secondary command
+        // buffers are always replayed, since they are what records the commands in the primary.
+        if (ExecutesInline() || !executesInline)
+        {
+            mCommandBuffers[subpass].executeCommands(primaryCommands);
         }
-        mCommandBuffers[subpass].executeCommands(primaryCommands);
     }
 
     if (!renderPass.valid())
@@ -2599,6 +2872,8 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
         primaryCommands->endRenderPass();
     }
 
+    writeGpuTimeEndTimestamp(primaryCommands);
+
     // Now issue VkCmdSetEvents to primary command buffer
     ASSERT(mRefCountedEvents.empty());
     mVkEventArray.flushSetEvents(primaryCommands);
@@ -2707,12 +2982,115 @@ void RenderPassCommandBufferHelper::updateRenderPassDepthStencilClear(
 void RenderPassCommandBufferHelper::growRenderArea(ContextVk *contextVk,
                                                    const gl::Rectangle &newRenderArea)
 {
+    ASSERT(canGrowRenderArea(newRenderArea));
+    if (hasScissoredClearWithLoadOp() && !mRenderArea.encloses(newRenderArea))
+    {
+        revertScissoredClearWithLoadOp(contextVk);
+    }
+
     // The render area is grown such that it covers both the previous and the new render areas.
     gl::GetEnclosingRectangle(mRenderArea, newRenderArea, &mRenderArea);
 
     // Remove invalidates that are no longer applicable.
     mDepthAttachment.onRenderAreaGrowth(contextVk, mRenderArea);
     mStencilAttachment.onRenderAreaGrowth(contextVk, mRenderArea);
+
+    // Load the attachments whose load was skipped due to a previous invalidate, if the render area
+    // is no longer within the invalidated area.
+    for (PackedAttachmentIndex index = kAttachmentIndexZero; index < mColorAttachmentsCount;
+         ++index)
+    {
+        if (mColorAttachments[index].onRenderAreaGrowthRestoreLoad(mRenderArea))
+        {
+            SetBitField(mAttachmentOps[index].loadOp, RenderPassLoadOp::Load);
+        }
+    }
+    if (mDepthAttachment.onRenderAreaGrowthRestoreLoad(mRenderArea))
+    {
+        SetBitField(mAttachmentOps[mDepthStencilAttachmentIndex].loadOp, RenderPassLoadOp::Load);
+    }
+    if (mStencilAttachment.onRenderAreaGrowthRestoreLoad(mRenderArea))
+    {
+        SetBitField(mAttachmentOps[mDepthStencilAttachmentIndex].stencilLoadOp,
+                    RenderPassLoadOp::Load);
+    }
+}
+
+void RenderPassCommandBufferHelper::revertScissoredClearWithLoadOp(ContextVk *contextVk)
+{
+    // Nothing has been drawn yet, so the clear can still be recorded in its place.
+    ASSERT(getRenderPassWriteCommandCount() == 0);
+
+    // The only loadOp=Clear in this render pass are from the scissored clear, as it started the
+    // render pass.  Turn them into Load and clear the render area (which is the scissor) instead.
+    angle::VulkanPerfCounters &perfCounters = contextVk->getPerfCounters();
+    gl::AttachmentVector<VkClearAttachment> attachments;
+
+    PackedAttachmentIndex colorIndexVk(0);
+    for (size_t colorIndexGL = 0; colorIndexGL < mRenderPassDesc.colorAttachmentRange();
+         ++colorIndexGL)
+    {
+        if (!mRenderPassDesc.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+
+        if (static_cast<RenderPassLoadOp>(mAttachmentOps[colorIndexVk].loadOp) ==
+            RenderPassLoadOp::Clear)
+        {
+            SetBitField(mAttachmentOps[colorIndexVk].loadOp, RenderPassLoadOp::Load);
+
+            // With render pass objects, the clears are indexed by the subpass-mapped locations.
+            // With dynamic rendering, they are indexed by the actual attachment index.
+            const uint32_t clearAttachmentIndex =
+                contextVk->getFeatures().preferDynamicRendering.enabled
+                    ? colorIndexVk.get()
+                    : static_cast<uint32_t>(colorIndexGL);
+            attachments.emplace_back(VkClearAttachment{
+                VK_IMAGE_ASPECT_COLOR_BIT, clearAttachmentIndex, mClearValues[colorIndexVk]});
+            onColorAccess(colorIndexVk, ResourceAccess::ReadWrite);
+            ++perfCounters.colorClearAttachments;
+        }
+
+        ++colorIndexVk;
+    }
+
+    VkImageAspectFlags dsAspectFlags = 0;
+    if (mDepthStencilAttachmentIndex != kAttachmentIndexInvalid)
+    {
+        PackedAttachmentOpsDesc &dsOps = mAttachmentOps[mDepthStencilAttachmentIndex];
+        if (static_cast<RenderPassLoadOp>(dsOps.loadOp) == RenderPassLoadOp::Clear)
+        {
+            SetBitField(dsOps.loadOp, RenderPassLoadOp::Load);
+            dsAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+            onDepthAccess(ResourceAccess::ReadWrite);
+            ++perfCounters.depthClearAttachments;
+        }
+        if (static_cast<RenderPassLoadOp>(dsOps.stencilLoadOp) == RenderPassLoadOp::Clear)
+        {
+            SetBitField(dsOps.stencilLoadOp, RenderPassLoadOp::Load);
+            dsAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+            onStencilAccess(ResourceAccess::ReadWrite);
+            ++perfCounters.stencilClearAttachments;
+        }
+    }
+    if (dsAspectFlags != 0)
+    {
+        attachments.emplace_back(
+            VkClearAttachment{dsAspectFlags, 0, mClearValues[mDepthStencilAttachmentIndex]});
+        updateDepthStencilReadOnlyMode(contextVk->getDepthStencilAttachmentFlags(), dsAspectFlags);
+    }
+
+    ASSERT(!attachments.empty());
+
+    VkClearRect rect    = {};
+    rect.rect           = gl_vk::GetRect(mRenderArea);
+    rect.baseArrayLayer = 0;
+    rect.layerCount     = mScissoredClearLayerCount;
+    getCommandBuffer().clearAttachments(static_cast<uint32_t>(attachments.size()),
+                                        attachments.data(), 1, &rect);
+
+    mScissoredClearLayerCount = 0;
 }
 
 angle::Result RenderPassCommandBufferHelper::attachCommandPool(ErrorContext *context,
@@ -3294,8 +3672,14 @@ void BufferPool::pruneEmptyBuffers(Renderer *renderer)
     // we will trim excessive empty buffers at next prune call. Or if we underestimate, we will end
     // up have to call into vulkan driver allocate new buffers, but next cycle we should correct
     // ourselves to keep enough number of empty buffers around.
+    //
+    // Under memory budget pressure, no empty buffers are kept.
     size_t buffersToKeep = std::min(mNumberOfNewBuffersNeededSinceLastPrune,
                                     static_cast<size_t>(kMaxTotalEmptyBufferBytes / mSize));
+    if (renderer->isUnderMemoryBudgetPressure())
+    {
+        buffersToKeep = 0;
+    }
     while (mEmptyBufferBlocks.size() > buffersToKeep)
     {
         std::unique_ptr<BufferBlock> &block = mEmptyBufferBlocks.back();
@@ -4590,6 +4974,26 @@ angle::Result QueryHelper::getUint64Result(ContextVk *contextVk, QueryResult *re
     return angle::Result::Continue;
 }
 
+bool QueryHelper::copyResultsToBuffer(OutsideRenderPassCommandBuffer *commandBuffer,
+                                      const BufferHelper &buffer,
+                                      VkQueryResultFlags flags)
+{
+    ASSERT(valid());
+    if (mStatus != QueryStatus::Ended)
+    {
+        return false;
+    }
+
+    const VkDeviceSize stride =
+        (flags & VK_QUERY_RESULT_64_BIT) != 0 ? sizeof(uint64_t) : sizeof(uint32_t);
+
+    // The query pool is reset before the query begins, which the copy is guaranteed to observe.
+    commandBuffer->copyQueryPoolResults(getQueryPool(), mQuery, mQueryCount,
+                                        buffer.getBuffer().getHandle(), buffer.getOffset(), stride,
+                                        flags | VK_QUERY_RESULT_WAIT_BIT);
+    return true;
+}
+
 VkResult QueryHelper::getResultImpl(ContextVk *contextVk,
                                     const VkQueryResultFlags flags,
                                     QueryResult *resultOut)
@@ -4981,12 +5385,28 @@ void BufferHelper::initializeBarrierTracker(ErrorContext *context)
     mCurrentReadStages       = 0;
 }
 
-angle::Result BufferHelper::initializeRobustMemory(ErrorContext *context,
+angle::Result BufferHelper::initializeRobustMemory(ContextVk *contextVk,
                                                    VkBufferUsageFlags usage,
                                                    VkDeviceSize size)
 {
     constexpr int kInitZeroValue = 0;
-    return initializeMemoryWithValueImpl(context, usage, size, kInitZeroValue);
+
+    // vkCmdFillBuffer requires the offset and size to be multiples of 4.
+    const bool canFill = !isHostVisible() && (usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) != 0 &&
+                         (getOffset() % 4) == 0 && (size % 4) == 0;
+    if (!canFill)
+    {
+        return initializeMemoryWithValueImpl(contextVk, usage, size, kInitZeroValue);
+    }
+
+    CommandResources resources;
+    resources.onBufferTransferWrite(this);
+
+    OutsideRenderPassCommandBuffer *commandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(resources, &commandBuffer));
+    commandBuffer->fillBuffer(getBuffer(), getOffset(), size, kInitZeroValue);
+
+    return angle::Result::Continue;
 }
 
 angle::Result BufferHelper::initializeNonZeroMemory(ErrorContext *context,
@@ -5629,6 +6049,7 @@ ImageHelper::ImageHelper()
 ImageHelper::~ImageHelper()
 {
     ASSERT(!valid());
+    ASSERT(mPendingStagedLoads.empty());
     ASSERT(!mAcquireNextImageSemaphore.valid());
 }
 
@@ -5678,6 +6099,7 @@ ANGLE_INLINE void ImageHelper::setEntireContentDefined()
     {
         levelContentDefined.set();
     }
+    clearSubresourceInvalidatedArea(VK_IMAGE_ASPECT_COLOR_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
 }
 
 ANGLE_INLINE void ImageHelper::setEntireContentUndefined()
@@ -5690,6 +6112,7 @@ ANGLE_INLINE void ImageHelper::setEntireContentUndefined()
     {
         levelContentDefined.reset();
     }
+    clearSubresourceInvalidatedArea(VK_IMAGE_ASPECT_COLOR_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
 
     // Note: this function is typically called during init/release, but also when importing an image
     // from Vulkan, so unlike invalidateSubresourceContentImpl, it doesn't attempt to make sure
@@ -5702,6 +6125,10 @@ ANGLE_INLINE void ImageHelper::setContentDefined(LevelIndex levelStart,
                                                  uint32_t layerCount,
                                                  VkImageAspectFlags aspectFlags)
 {
+    // Whatever part of the image is written to, forget the area that was left undefined by a
+    // previous sub-invalidate.
+    clearSubresourceInvalidatedArea(aspectFlags);
+
     // Mark the range as defined.  Layers above 8 are discarded, and are always assumed to have
     // defined contents.
     if (layerStart >= kMaxContentDefinedLayerCount)
@@ -5727,6 +6154,18 @@ ANGLE_INLINE void ImageHelper::setContentDefined(LevelIndex levelStart,
     }
 }
 
+ANGLE_INLINE void ImageHelper::clearSubresourceInvalidatedArea(VkImageAspectFlags aspectFlags)
+{
+    if ((aspectFlags & ~VK_IMAGE_ASPECT_STENCIL_BIT) != 0)
+    {
+        mInvalidatedArea.area = gl::Rectangle();
+    }
+    if ((aspectFlags & VK_IMAGE_ASPECT_STENCIL_BIT) != 0)
+    {
+        mStencilInvalidatedArea.area = gl::Rectangle();
+    }
+}
+
 ANGLE_INLINE void ImageHelper::setLevelContentDefined(LevelIndex level,
                                                       const uint8_t layerRangeBits)
 {
@@ -6202,6 +6641,7 @@ void ImageHelper::releaseImage(Renderer *renderer)
 
         //  mDeviceMemory and mVmaAllocation should not be valid at the same time.
         ASSERT(!mDeviceMemory.valid() || !mVmaAllocation.valid());
+        onLazilyAllocatedMemoryDealloc(renderer);
         if (mDeviceMemory.valid())
         {
             renderer->onMemoryDealloc(mMemoryAllocationType, mAllocationSize, mMemoryTypeIndex,
@@ -6241,6 +6681,7 @@ void ImageHelper::releaseImage(ContextVk *contextVk)
 void ImageHelper::releaseStagedUpdates(Renderer *renderer)
 {
     assertSubresourceUpdateRefCountsConsistent();
+    waitForPendingStagedLoads();
 
     // Remove updates that never made it to the texture.
     for (SubresourceUpdates &levelUpdates : mSubresourceUpdates)
@@ -6487,6 +6928,25 @@ VkResult ImageHelper::initMemory(ErrorContext *context,
                                           &mDeviceMemory, &mAllocationSize));
     }
 
+    // Let the memory report know of lazily allocated memory, to keep track of how much of it is
+    // committed.
+    if ((*flagsOut & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0)
+    {
+        if (mVmaAllocation.valid())
+        {
+            renderer->onLazilyAllocatedMemoryAlloc(
+                mVmaAllocation.getHandle(),
+                vma::GetAllocationDeviceMemory(renderer->getAllocator().getHandle(),
+                                               mVmaAllocation.getHandle()),
+                mAllocationSize);
+        }
+        else
+        {
+            renderer->onLazilyAllocatedMemoryAlloc(mDeviceMemory.getHandle(),
+                                                   mDeviceMemory.getHandle(), mAllocationSize);
+        }
+    }
+
     mCurrentDeviceQueueIndex = context->getDeviceQueueIndex();
     mIsReleasedToExternal    = false;
     mIsForeignImage          = false;
@@ -6495,6 +6955,30 @@ VkResult ImageHelper::initMemory(ErrorContext *context,
     return VK_SUCCESS;
 }
 
+void ImageHelper::onLazilyAllocatedMemoryDealloc(Renderer *renderer)
+{
+    if (!mDeviceMemory.valid() && !mVmaAllocation.valid())
+    {
+        return;
+    }
+
+    const VkMemoryPropertyFlags memoryFlags =
+        renderer->getMemoryProperties().getMemoryType(mMemoryTypeIndex).propertyFlags;
+    if ((memoryFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) == 0)
+    {
+        return;
+    }
+
+    if (mVmaAllocation.valid())
+    {
+        renderer->onLazilyAllocatedMemoryDealloc(mVmaAllocation.getHandle());
+    }
+    else
+    {
+        renderer->onLazilyAllocatedMemoryDealloc(mDeviceMemory.getHandle());
+    }
+}
+
 angle::Result ImageHelper::initMemoryAndNonZeroFillIfNeeded(
     ErrorContext *context,
     bool hasProtectedContent,
@@ -6838,6 +7322,7 @@ void ImageHelper::destroy(Renderer *renderer)
 
     // mDeviceMemory and mVmaAllocation should not be valid at the same time.
     ASSERT(!mDeviceMemory.valid() || !mVmaAllocation.valid());
+    onLazilyAllocatedMemoryDealloc(renderer);
     if (mDeviceMemory.valid())
     {
         renderer->onMemoryDealloc(mMemoryAllocationType, mAllocationSize, mMemoryTypeIndex,
@@ -7079,9 +7564,14 @@ angle::Result ImageHelper::initRgbDrawImageForYuvResolve(ErrorContext *context,
     const angle::FormatID formatID =
         vk::GetFormatIDFromVkFormat(externalFormatInfo.colorAttachmentFormat);
 
-    // Create RGB draw image
+    // Create RGB draw image.  Like with initImplicitMultisampledRenderToTexture, the image is only
+    // used as an attachment whose contents are discarded at the end of the render pass, so its
+    // memory is lazily allocated if possible.
+    const bool hasLazilyAllocatedMemory =
+        context->getRenderer()->getMemoryProperties().hasLazilyAllocatedMemory();
     const VkImageUsageFlags usageFlags =
-        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT |
+        (hasLazilyAllocatedMemory ? VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : 0);
 
     const bool hasProtectedContent =
         (resolveImage.getCreateFlags() & VK_IMAGE_CREATE_PROTECTED_BIT) != 0;
@@ -7098,6 +7588,7 @@ angle::Result ImageHelper::initRgbDrawImageForYuvResolve(ErrorContext *context,
 
     const VkMemoryPropertyFlags yuvMemoryFlags =
         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+        (hasLazilyAllocatedMemory ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : 0) |
         (hasProtectedContent ? VK_MEMORY_PROPERTY_PROTECTED_BIT : 0);
 
     ANGLE_TRY(initMemoryAndNonZeroFillIfNeeded(context, hasProtectedContent, yuvMemoryFlags,
@@ -7578,16 +8069,7 @@ void ImageHelper::recordWriteBarrier(Context *context,
 {
     if (isWriteBarrierNecessary(newAccess, levelStart, levelCount, layerStart, layerCount))
     {
-        ASSERT(!mCurrentEvent.valid() || !commands->hasSetEventPendingFlush(mCurrentEvent));
-        VkSemaphore acquireNextImageSemaphore;
-        recordBarrierImpl(context, aspectMask, newAccess, context->getDeviceQueueIndex(),
-                          commands->getRefCountedEventCollector(), &commands->getCommandBuffer(),
-                          &acquireNextImageSemaphore);
-
-        if (acquireNextImageSemaphore != VK_NULL_HANDLE)
-        {
-            commands->setAcquireNextImageSemaphore(acquireNextImageSemaphore);
-        }
+        recordOutsideRenderPassBarrier(context, aspectMask, newAccess, commands);
     }
 
     setSubresourcesWrittenSinceBarrier(levelStart, levelCount, layerStart, layerCount);
@@ -7607,16 +8089,7 @@ void ImageHelper::recordReadSubresourceBarrier(Context *context,
     if (isReadSubresourceBarrierNecessary(newAccess, levelStart, levelCount, layerStart,
                                           layerCount))
     {
-        ASSERT(!mCurrentEvent.valid() || !commands->hasSetEventPendingFlush(mCurrentEvent));
-        VkSemaphore acquireNextImageSemaphore;
-        recordBarrierImpl(context, aspectMask, newAccess, context->getDeviceQueueIndex(),
-                          commands->getRefCountedEventCollector(), &commands->getCommandBuffer(),
-                          &acquireNextImageSemaphore);
-
-        if (acquireNextImageSemaphore != VK_NULL_HANDLE)
-        {
-            commands->setAcquireNextImageSemaphore(acquireNextImageSemaphore);
-        }
+        recordOutsideRenderPassBarrier(context, aspectMask, newAccess, commands);
     }
 
     // Levels/layers being read from are also registered to avoid RAW and WAR hazards.
@@ -7633,7 +8106,33 @@ void ImageHelper::recordReadBarrier(Context *context,
         return;
     }
 
-    ASSERT(!mCurrentEvent.valid() || !commands->hasSetEventPendingFlush(mCurrentEvent));
+    recordOutsideRenderPassBarrier(context, aspectMask, newAccess, commands);
+}
+
+void ImageHelper::recordOutsideRenderPassBarrier(Context *context,
+                                                 VkImageAspectFlags aspectMask,
+                                                 ImageAccess newAccess,
+                                                 OutsideRenderPassCommandBufferHelper *commands)
+{
+    // Streaming many images in a row (e.g. texture uploads) would otherwise result in a barrier
+    // per copy.  If the image isn't used by the commands recorded so far, its barrier can safely
+    // be moved before them, where it's merged with the other barriers.
+    if (commands->canBatchImageBarrier(context, *this))
+    {
+        commands->batchImageBarrier(context, aspectMask, newAccess, this);
+        // All previous writes are now behind a barrier.
+        resetSubresourcesWrittenSinceBarrier();
+        return;
+    }
+
+    // If the image is tracked by an event that is only set at the end of this command buffer (see
+    // trackImageWithDeferredEvent), it can't be waited on here.  A pipeline barrier is used
+    // instead, which is correct as the previous use is in the same command buffer.
+    if (mCurrentEvent.valid() && commands->hasSetEventPendingFlush(mCurrentEvent))
+    {
+        mCurrentEvent.release(context);
+    }
+
     VkSemaphore acquireNextImageSemaphore;
     recordBarrierImpl(context, aspectMask, newAccess, context->getDeviceQueueIndex(),
                       commands->getRefCountedEventCollector(), &commands->getCommandBuffer(),
@@ -8384,6 +8883,8 @@ void ImageHelper::removeSingleSubresourceStagedUpdates(ContextVk *contextVk,
                                                        uint32_t layerIndex,
                                                        uint32_t layerCount)
 {
+    waitForPendingStagedLoads();
+
     // Find any staged updates for this index and remove them from the pending list.
     SubresourceUpdates *levelUpdates = getLevelUpdates(levelIndexGL);
     if (levelUpdates == nullptr)
@@ -8447,6 +8948,7 @@ void ImageHelper::removeStagedUpdates(ErrorContext *context,
                                       gl::LevelIndex levelGLEnd)
 {
     assertSubresourceUpdateRefCountsConsistent();
+    waitForPendingStagedLoads();
 
     // Remove all updates to levels [start, end].
     for (gl::LevelIndex level = levelGLStart; level <= levelGLEnd; ++level)
@@ -8581,10 +9083,11 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
         ANGLE_VK_CHECK_MATH(contextVk, storageFormatInfo.computeBufferImageHeight(
                                            glExtents.height, &bufferImageHeight));
 
-        if (contextVk->getFeatures().supportsComputeTranscodeEtcToBc.enabled &&
-            IsETCFormat(vkFormat.getIntendedFormatID()) && IsBCFormat(storageFormatID))
+        if (IsETCFormat(vkFormat.getIntendedFormatID()) && IsBCFormat(storageFormatID))
         {
+            ASSERT(contextVk->getRenderer()->isEtcToBcTranscodingEnabled());
             useComputeTransCoding =
+                contextVk->getFeatures().supportsComputeTranscodeEtcToBc.enabled &&
                 shouldUseComputeForTransCoding(vk::LevelIndex(index.getLevelIndex()));
             if (!useComputeTransCoding)
             {
@@ -8668,16 +9171,52 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
         }
     }
 
+    // Tightly packed RGB data that is stored as RGBA can be staged as is and expanded on the GPU
+    // when the update is flushed, saving the CPU conversion and a quarter of the staging memory.
+    const angle::Format &intendedFormat = vkFormat.getIntendedFormat();
+    const size_t pixelCount =
+        static_cast<size_t>(glExtents.width) * glExtents.height * glExtents.depth;
+    bool useComputeRGBExpansion = false;
+    if (contextVk->getFeatures().expandRgbUploadsWithCompute.enabled &&
+        loadFunctionInfo.requiresConversion &&
+        IsRGBToRGBAExpansion(intendedFormat.id, storageFormatID) &&
+        formatInfo.computePixelBytes(type) == intendedFormat.pixelBytes &&
+        pixelCount >= kMinPixelCountForComputeRGBExpansion)
+    {
+        useComputeRGBExpansion        = true;
+        loadFunctionInfo.loadFunction = GetRGBCopyLoadFunction(intendedFormat.pixelBytes);
+        outputRowPitch                = glExtents.width * intendedFormat.pixelBytes;
+        outputDepthPitch              = outputRowPitch * glExtents.height;
+        allocationSize                = outputDepthPitch * glExtents.depth;
+    }
+
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
     // If possible, copy the buffer to the image directly on the host, to avoid having to use a temp
-    // image (and do a double copy).
-    if (applyUpdate != ApplyImageUpdate::Defer && !loadFunctionInfo.requiresConversion &&
-        inputRowPitch == outputRowPitch && inputDepthPitch == outputDepthPitch)
-    {
+    // image (and do a double copy).  Data that needs conversion or repacking is converted on the
+    // host to a temporary buffer first, as long as it's a single-aspect uncompressed format, which
+    // still avoids the staging buffer and the GPU copy.
+    const bool copyAsIs = !loadFunctionInfo.requiresConversion &&
+                          inputRowPitch == outputRowPitch && inputDepthPitch == outputDepthPitch;
+    const bool canConvertOnHost =
+        !storageFormat.isBlock && !storageFormat.isYUV && !formatInfo.compressed &&
+        !storageFormat.hasDepthOrStencilBits() && !useComputeRGBExpansion &&
+        storageFormatID == mActualFormatID;
+    if (applyUpdate != ApplyImageUpdate::Defer && (copyAsIs || canConvertOnHost))
+    {
+        HostCopyConversion conversion;
+        if (!copyAsIs)
+        {
+            conversion.loadFunction     = loadFunctionInfo.loadFunction;
+            conversion.inputRowPitch    = inputRowPitch;
+            conversion.inputDepthPitch  = inputDepthPitch;
+            conversion.outputRowPitch   = outputRowPitch;
+            conversion.outputDepthPitch = outputDepthPitch;
+        }
+
         bool copied = false;
         ANGLE_TRY(updateSubresourceOnHost(contextVk, applyUpdate, index, glExtents, offset, source,
-                                          bufferRowLength, bufferImageHeight, &copied));
+                                          bufferRowLength, bufferImageHeight, conversion, &copied));
         if (copied)
         {
             *updateAppliedImmediatelyOut = true;
@@ -8695,9 +9234,44 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
                                                 MemoryCoherency::CachedNonCoherent, storageFormatID,
                                                 &stagingOffset, &stagingPointer));
 
-    loadFunctionInfo.loadFunction(
-        contextVk->getImageLoadContext(), glExtents.width, glExtents.height, glExtents.depth,
-        source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+    const angle::ImageLoadContext &loadContext = contextVk->getImageLoadContext();
+    const bool loadAsynchronously =
+        contextVk->getFeatures().decodeAstcUploadsAsynchronously.enabled &&
+        gl::IsASTC2DFormat(formatInfo.internalFormat) && !storageFormat.isBlock &&
+        loadContext.multiThreadPool && loadContext.multiThreadPool->isAsync();
+
+    if (loadAsynchronously)
+    {
+        // Decompressing ASTC on the CPU is slow, so let it run on a worker thread until the update
+        // is needed.  If the task can't be posted, it's run right away.
+        auto task = std::make_shared<StagedLoadTask>(
+            loadFunctionInfo.loadFunction, loadContext, glExtents, source, inputRowPitch,
+            inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+        std::shared_ptr<angle::WaitableEvent> waitEvent =
+            loadContext.multiThreadPool->postWorkerTask(task);
+        if (waitEvent)
+        {
+            mPendingStagedLoads.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            (*task)();
+        }
+    }
+    else if (storageFormat.isBlock || storageFormat.isYUV || formatInfo.compressed)
+    {
+        loadFunctionInfo.loadFunction(loadContext, glExtents.width, glExtents.height,
+                                      glExtents.depth, source, inputRowPitch, inputDepthPitch,
+                                      stagingPointer, outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        // Uncompressed loads convert each row independently, so large ones can be split across
+        // threads.
+        LoadImageInStripes(loadFunctionInfo.loadFunction, loadContext, glExtents.width,
+                           glExtents.height, glExtents.depth, source, inputRowPitch,
+                           inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+    }
 
     // YUV formats need special handling.
     if (storageFormat.isYUV)
@@ -8821,9 +9395,11 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
     {
         copy.imageSubresource.aspectMask = aspectFlags;
         appendSubresourceUpdate(
-            updateLevelGL, SubresourceUpdate(stagingBuffer.get(), currentBuffer, copy,
-                                             useComputeTransCoding ? vkFormat.getIntendedFormatID()
-                                                                   : storageFormatID));
+            updateLevelGL,
+            SubresourceUpdate(stagingBuffer.get(), currentBuffer, copy,
+                              useComputeTransCoding || useComputeRGBExpansion
+                                  ? vkFormat.getIntendedFormatID()
+                                  : storageFormatID));
         pruneSupersededUpdatesForLevel(contextVk, updateLevelGL, PruneReason::MemoryOptimization);
     }
 
@@ -8839,6 +9415,7 @@ angle::Result ImageHelper::updateSubresourceOnHost(ContextVk *contextVk,
                                                    const uint8_t *source,
                                                    const GLuint memoryRowLength,
                                                    const GLuint memoryImageHeight,
+                                                   const HostCopyConversion &conversion,
                                                    bool *copiedOut)
 {
     // If the image is not set up for host copy, it can't be done.
@@ -8931,14 +9508,28 @@ angle::Result ImageHelper::updateSubresourceOnHost(ContextVk *contextVk,
     // copy is done.
     auto doCopy = [contextVk, image = mImage.getHandle(), source, memoryRowLength,
                    memoryImageHeight, aspectMask, levelVk = toVkLevel(updateLevelGL), isArray,
-                   baseArrayLayer, layerCount, offset, glExtents,
+                   baseArrayLayer, layerCount, offset, glExtents, conversion,
                    layout = getCurrentLayout(renderer)](void *resultOut) {
         ANGLE_TRACE_EVENT0("gpu.angle", "Upload image data on host");
         ANGLE_UNUSED_VARIABLE(resultOut);
 
+        // The source is still valid here, as the tail call is run before the GL call returns.
+        std::vector<uint8_t> convertedData;
+        const void *hostPointer = source;
+        if (conversion.loadFunction != nullptr)
+        {
+            convertedData.resize(conversion.outputDepthPitch * glExtents.depth);
+            LoadImageInStripes(conversion.loadFunction, contextVk->getImageLoadContext(),
+                               glExtents.width, glExtents.height, glExtents.depth, source,
+                               conversion.inputRowPitch, conversion.inputDepthPitch,
+                               convertedData.data(), conversion.outputRowPitch,
+                               conversion.outputDepthPitch);
+            hostPointer = convertedData.data();
+        }
+
         VkMemoryToImageCopyEXT copyRegion          = {};
         copyRegion.sType                           = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
-        copyRegion.pHostPointer                    = source;
+        copyRegion.pHostPointer                    = hostPointer;
         copyRegion.memoryRowLength                 = memoryRowLength;
         copyRegion.memoryImageHeight               = memoryImageHeight;
         copyRegion.imageSubresource.aspectMask     = aspectMask;
@@ -8997,11 +9588,13 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
                                                        angle::FormatID dstFormatID,
                                                        gl::TextureType dstTextureType)
 {
-    const angle::Format &srcFormat = angle::Format::Get(srcFormatID);
     const angle::Format &dstFormat = angle::Format::Get(dstFormatID);
     const gl::InternalFormat &dstFormatInfo =
         gl::GetSizedInternalFormatInfo(dstFormat.glInternalFormat);
 
+    // The staged data is converted on the CPU.
+    waitForPendingStagedLoads();
+
     for (SubresourceUpdates &levelUpdates : mSubresourceUpdates)
     {
         for (SubresourceUpdate &update : levelUpdates)
@@ -9010,10 +9603,14 @@ angle::Result ImageHelper::reformatStagedBufferUpdates(ContextVk *contextVk,
             ASSERT(valid() || update.updateSource != UpdateSource::Image ||
                    update.data.image.formatID == srcFormatID);
 
+            // Updates staged for RGB expansion on the GPU hold three-channel data and are
+            // converted from that instead.
             if (update.updateSource == UpdateSource::Buffer &&
-                update.data.buffer.formatID == srcFormatID)
+                (update.data.buffer.formatID == srcFormatID ||
+                 IsRGBToRGBAExpansion(update.data.buffer.formatID, srcFormatID)))
             {
-                const VkBufferImageCopy &copy = update.data.buffer.copyRegion;
+                const VkBufferImageCopy &copy  = update.data.buffer.copyRegion;
+                const angle::Format &srcFormat = angle::Format::Get(update.data.buffer.formatID);
 
                 // Source and dst data are tightly packed
                 const size_t srcDataRowPitch = copy.imageExtent.width * srcFormat.pixelBytes;
@@ -9166,6 +9763,35 @@ bool ImageHelper::hasSubresourceDefinedStencilContent(gl::LevelIndex level,
         .any();
 }
 
+void ImageHelper::setSubresourceInvalidatedArea(gl::LevelIndex level,
+                                                uint32_t layerIndex,
+                                                uint32_t layerCount,
+                                                VkImageAspectFlagBits aspect,
+                                                const gl::Rectangle &area)
+{
+    SubresourceInvalidatedArea &invalidatedArea =
+        aspect == VK_IMAGE_ASPECT_STENCIL_BIT ? mStencilInvalidatedArea : mInvalidatedArea;
+    invalidatedArea.level      = level;
+    invalidatedArea.layerIndex = layerIndex;
+    invalidatedArea.layerCount = layerCount;
+    invalidatedArea.area       = area;
+}
+
+gl::Rectangle ImageHelper::getSubresourceInvalidatedArea(gl::LevelIndex level,
+                                                         uint32_t layerIndex,
+                                                         uint32_t layerCount,
+                                                         VkImageAspectFlagBits aspect) const
+{
+    const SubresourceInvalidatedArea &invalidatedArea =
+        aspect == VK_IMAGE_ASPECT_STENCIL_BIT ? mStencilInvalidatedArea : mInvalidatedArea;
+    if (invalidatedArea.area.empty() || invalidatedArea.level != level ||
+        invalidatedArea.layerIndex != layerIndex || invalidatedArea.layerCount != layerCount)
+    {
+        return gl::Rectangle();
+    }
+    return invalidatedArea.area;
+}
+
 void ImageHelper::invalidateEntireLevelContent(vk::ErrorContext *context, gl::LevelIndex level)
 {
     invalidateSubresourceContentImpl(
@@ -9333,6 +9959,8 @@ void ImageHelper::restoreSubresourceContentImpl(gl::LevelIndex level,
                                                 uint32_t layerCount,
                                                 VkImageAspectFlagBits aspect)
 {
+    clearSubresourceInvalidatedArea(aspect);
+
     if (layerIndex >= kMaxContentDefinedLayerCount)
     {
         return;
@@ -9956,6 +10584,8 @@ void ImageHelper::copyStateAndMoveStorageFrom(ImageHelper *other)
     mLevelCount                   = other->mLevelCount;
     mVkImageContentDefined        = other->mVkImageContentDefined;
     mVkImageStencilContentDefined = other->mVkImageStencilContentDefined;
+    mInvalidatedArea              = other->mInvalidatedArea;
+    mStencilInvalidatedArea       = other->mStencilInvalidatedArea;
 
     mAllocationSize       = other->mAllocationSize;
     mMemoryAllocationType = other->mMemoryAllocationType;
@@ -10167,6 +10797,9 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
 {
     Renderer *renderer = contextVk->getRenderer();
 
+    // The staging buffers are flushed and copied from below.
+    waitForPendingStagedLoads();
+
     const angle::FormatID &actualformat   = getActualFormatID();
     const angle::FormatID &intendedFormat = getIntendedFormatID();
 
@@ -10197,6 +10830,8 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
     }
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper(transferAccess, &commandBuffer));
 
+    PendingBufferToImageCopies pendingCopies;
+
     // Flush the staged updates in each mip level.
     for (gl::LevelIndex updateMipLevelGL = levelGLStart; updateMipLevelGL < levelGLEnd;
          ++updateMipLevelGL)
@@ -10277,7 +10912,8 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                 }
                 case UpdateSource::Buffer:
                 {
-                    if (!transCoding && !isDataFormatMatchForCopy(update.data.buffer.formatID))
+                    if (!transCoding && !isDataFormatMatchForCopy(update.data.buffer.formatID) &&
+                        !IsRGBToRGBAExpansion(update.data.buffer.formatID, actualformat))
                     {
                         // TODO: http://anglebug.com/42264884, we should handle this in higher level
                         // code. If we have incompatible updates, skip but keep it.
@@ -10306,6 +10942,27 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                 }
             }
 
+            // Plain buffer updates are batched into a single copy command.  An update can join
+            // the batch if it doesn't overlap the updates already in it, in which case it doesn't
+            // need a barrier either.  Anything else first records the pending copies.
+            const bool isBatchableBufferUpdate =
+                update.updateSource == UpdateSource::Buffer &&
+                !(transCoding && update.data.buffer.formatID != actualformat) &&
+                !IsRGBToRGBAExpansion(update.data.buffer.formatID, actualformat);
+            ImageLayerWriteMask subresourceHash =
+                updateLayerCount < kMaxParallelLayerWrites
+                    ? GetImageLayerWriteMask(updateBaseLayer, updateLayerCount)
+                    : ImageLayerWriteMask().set();
+            const bool joinsPendingCopies =
+                isBatchableBufferUpdate &&
+                pendingCopies.canAppend(update.data.buffer.bufferHelper->getBuffer().getHandle(),
+                                        update.data.buffer.copyRegion, subresourceHash);
+            if (!joinsPendingCopies)
+            {
+                ANGLE_TRY(flushPendingBufferToImageCopies(contextVk, &pendingCopies,
+                                                          &commandBuffer));
+            }
+
             // When a barrier is necessary when uploading updates to a level, we could instead move
             // to the next level and continue uploads in parallel.  Once all levels need a barrier,
             // a single barrier can be issued and we could continue with the rest of the updates
@@ -10313,7 +10970,12 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
             // barrier might be needed if there are multiple updates in the same parts of the image.
             ImageAccess barrierAccess =
                 transCoding ? ImageAccess::TransferDstAndComputeWrite : ImageAccess::TransferDst;
-            if (updateLayerCount >= kMaxParallelLayerWrites)
+            ImageLayerWriteMask writesBeforeUpdate;
+            if (joinsPendingCopies)
+            {
+                mSubresourcesWrittenSinceBarrier[updateMipLevelGL.get()] |= subresourceHash;
+            }
+            else if (updateLayerCount >= kMaxParallelLayerWrites)
             {
                 // If there are more subresources than bits we can track, always insert a barrier.
                 recordWriteBarrier(contextVk, aspectFlags, barrierAccess, updateMipLevelGL, 1,
@@ -10322,9 +10984,6 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
             }
             else
             {
-                ImageLayerWriteMask subresourceHash =
-                    GetImageLayerWriteMask(updateBaseLayer, updateLayerCount);
-
                 if (areLevelSubresourcesWrittenWithinMaskRange(updateMipLevelGL.get(),
                                                                subresourceHash))
                 {
@@ -10333,6 +10992,7 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                                        updateBaseLayer, updateLayerCount, commandBuffer);
                     mSubresourcesWrittenSinceBarrier[updateMipLevelGL.get()].reset();
                 }
+                writesBeforeUpdate = mSubresourcesWrittenSinceBarrier[updateMipLevelGL.get()];
                 mSubresourcesWrittenSinceBarrier[updateMipLevelGL.get()] |= subresourceHash;
             }
 
@@ -10428,29 +11088,83 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                         ANGLE_TRY(contextVk->getUtils().transCodeEtcToBc(contextVk, currentBuffer,
                                                                          this, copyRegion));
                     }
+                    else if (IsRGBToRGBAExpansion(update.data.buffer.formatID, actualformat))
+                    {
+                        // The staged data is tightly packed RGB.  Expand it to the storage format
+                        // in a temporary buffer with the vertex conversion shader, and copy that
+                        // to the image instead.
+                        const angle::Format &srcFormat =
+                            angle::Format::Get(update.data.buffer.formatID);
+                        const angle::Format &dstFormat = getActualFormat();
+                        const size_t pixelCount =
+                            static_cast<size_t>(copyRegion->imageExtent.width) *
+                            copyRegion->imageExtent.height * copyRegion->imageExtent.depth *
+                            copyRegion->imageSubresource.layerCount;
+
+                        RendererScoped<BufferHelper> expandedBuffer(renderer);
+                        ANGLE_TRY(contextVk->initBufferAllocation(
+                            &expandedBuffer.get(), renderer->getDeviceLocalMemoryTypeIndex(),
+                            pixelCount * dstFormat.pixelBytes,
+                            std::max(GetImageCopyBufferAlignment(actualformat),
+                                     renderer->getDefaultBufferAlignment()),
+                            BufferUsageType::Static));
+
+                        UtilsVk::ConvertVertexParameters params;
+                        params.vertexCount = pixelCount;
+                        params.srcFormat   = &srcFormat;
+                        params.dstFormat   = &dstFormat;
+                        params.srcStride   = srcFormat.pixelBytes;
+                        params.srcOffset   = static_cast<size_t>(copyRegion->bufferOffset -
+                                                                     currentBuffer->getOffset());
+                        params.dstOffset   = 0;
+                        ANGLE_TRY(contextVk->getUtils().convertVertexBuffer(
+                            contextVk, &expandedBuffer.get(), currentBuffer, params, {}));
+
+                        VkBufferImageCopy expandedCopyRegion = *copyRegion;
+                        expandedCopyRegion.bufferOffset      = expandedBuffer.get().getOffset();
+
+                        bufferAccess.onBufferTransferRead(&expandedBuffer.get());
+                        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper(
+                            bufferAccess, &commandBuffer));
+                        commandBuffer->getCommandBuffer().copyBufferToImage(
+                            expandedBuffer.get().getBuffer().getHandle(), mImage,
+                            getCurrentLayout(renderer), 1, &expandedCopyRegion);
+                    }
                     else
                     {
+                        // The copy is recorded along with the rest of the batch, which starts with
+                        // this update if it couldn't join the pending one.
+                        // The staging buffer is only read by transfers, so this doesn't submit
+                        // the copies that are already batched.
+                        ASSERT(isBatchableBufferUpdate);
                         bufferAccess.onBufferTransferRead(currentBuffer);
                         ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper(
                             bufferAccess, &commandBuffer));
-                        commandBuffer->getCommandBuffer().copyBufferToImage(
-                            currentBuffer->getBuffer().getHandle(), mImage,
-                            getCurrentLayout(renderer), 1, copyRegion);
+                        if (!joinsPendingCopies)
+                        {
+                            ASSERT(pendingCopies.regions.empty());
+                            pendingCopies.buffer = currentBuffer->getBuffer().getHandle();
+                            pendingCopies.writesBeforeBatch = writesBeforeUpdate;
+                        }
+                        pendingCopies.regions.push_back(*copyRegion);
+                        pendingCopies.size += currentBuffer->getSize();
+                    }
+                    if (!isBatchableBufferUpdate)
+                    {
+                        bool commandBufferWasFlushed = false;
+                        ANGLE_TRY(contextVk->onCopyUpdate(currentBuffer->getSize(),
+                                                          &commandBufferWasFlushed));
+                        if (commandBufferWasFlushed)
+                        {
+                            ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper(
+                                {}, &commandBuffer));
+                        }
                     }
-                    bool commandBufferWasFlushed = false;
-                    ANGLE_TRY(contextVk->onCopyUpdate(currentBuffer->getSize(),
-                                                      &commandBufferWasFlushed));
                     onWrite(updateMipLevelGL, 1, updateBaseLayer, updateLayerCount,
                             copyRegion->imageSubresource.aspectMask);
 
                     // Update total staging buffer size.
                     mTotalStagedBufferUpdateSize -= bufferUpdate.bufferHelper->getSize();
-
-                    if (commandBufferWasFlushed)
-                    {
-                        ANGLE_TRY(
-                            contextVk->getOutsideRenderPassCommandBufferHelper({}, &commandBuffer));
-                    }
                     break;
                 }
                 case UpdateSource::Image:
@@ -10479,6 +11193,9 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
             update.release(renderer);
         }
 
+        // The batch doesn't outlive the level, as the barrier tracking is per level.
+        ANGLE_TRY(flushPendingBufferToImageCopies(contextVk, &pendingCopies, &commandBuffer));
+
         // Only remove the updates that were actually applied to the image.
         *levelUpdates = std::move(updatesToKeep);
     }
@@ -10492,6 +11209,46 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
         setQueueSerial(commandBuffer->getQueueSerial());
     }
 
+    // Split the barrier between the uploads and their first use: an event is set after the
+    // uploads, and the render pass or dispatch that uses the image waits on it.  Unlike a pipeline
+    // barrier, this doesn't wait for the unrelated work submitted in between.  The event is set at
+    // the end of the command buffer, so that it is shared with the other uploads recorded in it.
+    if (renderer->getFeatures().useVkEventForImageBarrier.enabled)
+    {
+        commandBuffer->trackImageWithDeferredEvent(contextVk, this);
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result ImageHelper::flushPendingBufferToImageCopies(
+    ContextVk *contextVk,
+    PendingBufferToImageCopies *pendingCopies,
+    OutsideRenderPassCommandBufferHelper **commandBuffer)
+{
+    if (pendingCopies->regions.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    (*commandBuffer)
+        ->getCommandBuffer()
+        .copyBufferToImage(pendingCopies->buffer, mImage,
+                           getCurrentLayout(contextVk->getRenderer()),
+                           static_cast<uint32_t>(pendingCopies->regions.size()),
+                           pendingCopies->regions.data());
+    contextVk->getPerfCounters().bufferToImageCopyRegions += pendingCopies->regions.size();
+    contextVk->getPerfCounters().bufferToImageCopyCommands++;
+
+    bool commandBufferWasFlushed = false;
+    ANGLE_TRY(contextVk->onCopyUpdate(pendingCopies->size, &commandBufferWasFlushed));
+    if (commandBufferWasFlushed)
+    {
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper({}, commandBuffer));
+    }
+
+    pendingCopies->regions.clear();
+    pendingCopies->size = 0;
     return angle::Result::Continue;
 }
 
@@ -10918,6 +11675,7 @@ void ImageHelper::pruneSupersededUpdatesForLevelImpl(ContextVk *contextVk,
             }
 
             // Release the superseded update
+            waitForPendingStagedLoads();
             update.release(contextVk->getRenderer());
 
             // Update pruning size
@@ -10949,6 +11707,18 @@ void ImageHelper::pruneSupersededUpdatesForLevelImpl(ContextVk *contextVk,
     assertSubresourceUpdateRefCountsConsistent();
 }
 
+void ImageHelper::waitForPendingStagedLoads()
+{
+    if (mPendingStagedLoads.empty())
+    {
+        return;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::waitForPendingStagedLoads");
+    angle::WaitableEvent::WaitMany(&mPendingStagedLoads);
+    mPendingStagedLoads.clear();
+}
+
 void ImageHelper::removeSupersededUpdates(ContextVk *contextVk, const gl::TexLevelMask skipLevels)
 {
     assertSubresourceUpdateRefCountsConsistent();
@@ -11320,9 +12090,8 @@ bool ImageHelper::canCopyWithTransformForReadPixels(const PackPixelsParams &pack
     // Only allow copies to PBOs with identical format.
     const bool isSameFormatCopy = *readFormat == *packPixelsParams.destFormat;
 
-    // Disallow any transformation.
-    const bool needsTransformation =
-        packPixelsParams.rotation != SurfaceRotation::Identity || packPixelsParams.reverseRowOrder;
+    // Disallow rotation.  Reversing the row order is done by copying one row at a time.
+    const bool needsTransformation = packPixelsParams.rotation != SurfaceRotation::Identity;
 
     // Disallow copies when the output pitch cannot be correctly specified in Vulkan.
     const bool isPitchMultipleOfTexelSize =
@@ -11656,8 +12425,16 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
         ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::readPixelsImpl - PBO");
 
         const ptrdiff_t pixelsOffset = reinterpret_cast<ptrdiff_t>(pixels);
+        const bool canCopyWithCompute =
+            canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat, pixelsOffset);
+
+        // A y-flipped copy is done with one region per row with the transfer path, while the
+        // compute path flips in a single dispatch, so the compute path is preferred for it.  The
+        // transfer path is still used for y-flipped copies the compute path can't handle, as
+        // the alternative is the CPU readback below, which waits for the GPU to become idle.
         if (canCopyWithTransformForReadPixels(packPixelsParams, srcExtent, readFormat,
-                                              pixelsOffset))
+                                              pixelsOffset) &&
+            !(packPixelsParams.reverseRowOrder && canCopyWithCompute))
         {
             BufferHelper &packBuffer      = GetImpl(packPixelsParams.packBuffer)->getBuffer();
             VkDeviceSize packBufferOffset = packBuffer.getOffset();
@@ -11679,11 +12456,37 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
             region.imageOffset       = srcOffset;
             region.imageSubresource  = srcSubresource;
 
-            copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(renderer),
-                                                 packBuffer.getBuffer().getHandle(), 1, &region);
+            const VkImageLayout srcLayout = src->getCurrentLayout(renderer);
+            const VkBuffer dstBuffer      = packBuffer.getBuffer().getHandle();
+
+            if (!packPixelsParams.reverseRowOrder)
+            {
+                copyCommandBuffer->copyImageToBuffer(src->getImage(), srcLayout, dstBuffer, 1,
+                                                     &region);
+                return angle::Result::Continue;
+            }
+
+            // The image is y-flipped relative to the output.  Copy each row into its mirrored
+            // position in the buffer, with one region per row in a single copy command.
+            const VkDeviceSize lastRowOffset =
+                region.bufferOffset +
+                static_cast<VkDeviceSize>(packPixelsParams.outputPitch) * (srcExtent.height - 1);
+            region.bufferImageHeight  = 1;
+            region.imageExtent.height = 1;
+
+            std::vector<VkBufferImageCopy> rowRegions(srcExtent.height, region);
+            for (uint32_t row = 0; row < srcExtent.height; ++row)
+            {
+                rowRegions[row].bufferOffset =
+                    lastRowOffset - static_cast<VkDeviceSize>(packPixelsParams.outputPitch) * row;
+                rowRegions[row].imageOffset.y = srcOffset.y + row;
+            }
+            copyCommandBuffer->copyImageToBuffer(src->getImage(), srcLayout, dstBuffer,
+                                                 static_cast<uint32_t>(rowRegions.size()),
+                                                 rowRegions.data());
             return angle::Result::Continue;
         }
-        if (canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat, pixelsOffset))
+        if (canCopyWithCompute)
         {
             ANGLE_TRY(readPixelsWithCompute(contextVk, src, packPixelsParams, srcOffset, srcExtent,
                                             pixelsOffset, srcSubresource));
@@ -15,6 +15,7 @@
 
 #include "common/MemoryBuffer.h"
 #include "common/SimpleMutex.h"
+#include "common/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/MemoryTracking.h"
 #include "libANGLE/renderer/vulkan/Suballocation.h"
 #include "libANGLE/renderer/vulkan/vk_barrier_data.h"
@@ -475,6 +476,17 @@ class MetaDescriptorPool final : angle::NonCopyable
         return totalSize;
     }
 
+    // Destroy the descriptor pools that hold no descriptor sets in use, keeping at least one pool
+    // per layout.
+    void destroyUnusedPools(Renderer *renderer)
+    {
+        for (auto &iter : mPayload)
+        {
+            vk::DynamicDescriptorPoolPointer &pool = iter.second;
+            pool->checkAndDestroyUnusedPool(renderer);
+        }
+    }
+
   private:
     std::unordered_map<DescriptorSetLayoutDesc, DynamicDescriptorPoolPointer> mPayload;
 };
@@ -663,6 +675,15 @@ class QueryHelper final : public Resource
                                              bool *availableOut);
     angle::Result getUint64Result(ContextVk *contextVk, QueryResult *resultOut);
 
+    // Records a copy of the results of an ended query to |buffer|, with one value per query index.
+    // The values are 64-bit if |flags| contains VK_QUERY_RESULT_64_BIT, and 32-bit otherwise.  The
+    // copy waits on the GPU for the results to be available.  Returns false if the query has not
+    // ended, in which case nothing is recorded.
+    bool copyResultsToBuffer(OutsideRenderPassCommandBuffer *commandBuffer,
+                             const BufferHelper &buffer,
+                             VkQueryResultFlags flags);
+    uint32_t getQueryCount() const { return mQueryCount; }
+
   private:
     friend class DynamicQueryPool;
     const QueryPool &getQueryPool() const
@@ -1021,7 +1042,10 @@ class BufferHelper : public ReadWriteResource
         mDescriptorSetCacheManager.addKey(sharedCacheKey);
     }
 
-    angle::Result initializeRobustMemory(ErrorContext *context,
+    // Zeroes the buffer for robust resource initialization.  Memory that can't be mapped is
+    // cleared with vkCmdFillBuffer in the context's command buffer instead of copying from a
+    // zeroed staging buffer in a separate submission.
+    angle::Result initializeRobustMemory(ContextVk *contextVk,
                                          VkBufferUsageFlags usage,
                                          VkDeviceSize size);
 
@@ -1230,6 +1254,12 @@ class RenderPassAttachment final
                     bool isAttachmentEnabled,
                     uint32_t currentCmdCount);
     void onRenderAreaGrowth(ContextVk *contextVk, const gl::Rectangle &newRenderArea);
+    // Called when loadOp=DontCare is used because a previous render pass left the contents of
+    // |invalidatedArea| undefined, which encloses the render area.
+    void onLoadSkipped(const gl::Rectangle &invalidatedArea) { mLoadSkippedArea = invalidatedArea; }
+    // If the render area grows beyond the area the load was skipped for, returns true so that
+    // loadOp is turned back to Load.
+    bool onRenderAreaGrowthRestoreLoad(const gl::Rectangle &newRenderArea);
     void finalizeLoadStore(ErrorContext *context,
                            uint32_t currentCmdCount,
                            bool hasUnresolveAttachment,
@@ -1280,6 +1310,8 @@ class RenderPassAttachment final
     VkClearValue mClearValue;
     // The area that has been invalidated
     gl::Rectangle mInvalidateArea;
+    // The area within which loadOp=DontCare is valid, if used due to a previous invalidate
+    gl::Rectangle mLoadSkippedArea;
 };
 
 // Stores RenderPassAttachment In packed attachment index
@@ -1522,6 +1554,16 @@ class CommandBufferHelperCommon : angle::NonCopyable
         mAcquireNextImageSemaphore.setHandle(semaphore);
     }
 
+    // Used by measurePassGpuTime.  When this command buffer is flushed to the primary command
+    // buffer, timestamps are written to |query| and |query + 1| of |queryPool| before and after
+    // its commands.  The query pool must outlive the flush.
+    void setGpuTimeQuery(const QueryPool *queryPool, uint32_t query)
+    {
+        ASSERT(mGpuTimeQueryPool == nullptr);
+        mGpuTimeQueryPool = queryPool;
+        mGpuTimeQuery     = query;
+    }
+
   protected:
     CommandBufferHelperCommon();
     ~CommandBufferHelperCommon();
@@ -1576,6 +1618,9 @@ class CommandBufferHelperCommon : angle::NonCopyable
 
     void addCommandDiagnosticsCommon(std::ostringstream *out);
 
+    void writeGpuTimeBeginTimestamp(PrimaryCommandBuffer *primaryCommands);
+    void writeGpuTimeEndTimestamp(PrimaryCommandBuffer *primaryCommands);
+
     // Allocator used by this class.
     SecondaryCommandBlockAllocator mCommandAllocator;
 
@@ -1609,6 +1654,10 @@ class CommandBufferHelperCommon : angle::NonCopyable
 
     // Check for any buffer write commands recorded for host-visible buffers
     bool mIsAnyHostVisibleBufferWritten = false;
+
+    // The timestamp queries set by setGpuTimeQuery, if any.
+    const QueryPool *mGpuTimeQueryPool = nullptr;
+    uint32_t mGpuTimeQuery             = 0;
 };
 
 class SecondaryCommandBufferCollector;
@@ -1659,11 +1708,22 @@ class OutsideRenderPassCommandBufferHelper final : public CommandBufferHelperCom
                     ImageAccess imageAccess,
                     ImageHelper *image);
 
+    // If no command recorded so far uses the image, its barrier can be merged with the other
+    // barriers that are executed before the command buffer, instead of being recorded inline.
+    bool canBatchImageBarrier(Context *context, const ImageHelper &image) const;
+    void batchImageBarrier(Context *context,
+                           VkImageAspectFlags aspectFlags,
+                           ImageAccess imageAccess,
+                           ImageHelper *image);
+
     // Update image with this command buffer's queueSerial.
     void retainImage(Renderer *renderer, ImageHelper *image);
 
     // Call SetEvent and have image's current event pointing to it.
     void trackImageWithEvent(Context *context, ImageHelper *image);
+    // Have image's current event point to an event that is set at the end of this command buffer.
+    // Images tracked this way share the event with each other.
+    void trackImageWithDeferredEvent(Context *context, ImageHelper *image);
 
     // Issues SetEvent calls to the command buffer.
     void flushSetEvents(Context *context) { flushSetEventsImpl(context, &mCommandBuffer); }
@@ -1750,8 +1810,10 @@ class RenderPassFramebuffer : angle::NonCopyable
                         ImagelessFramebuffer imagelessFramebuffer,
                         RenderPassSource source)
     {
-        // Framebuffers are mutually exclusive with dynamic rendering.
-        ASSERT(initialFramebuffer.valid() != context->getFeatures().preferDynamicRendering.enabled);
+        // Framebuffers are mutually exclusive with dynamic rendering.  Without dynamic rendering,
+        // an invalid framebuffer is created from |imageViews| when the render pass is finalized.
+        ASSERT(!initialFramebuffer.valid() ||
+               !context->getFeatures().preferDynamicRendering.enabled);
         mInitialFramebuffer = std::move(initialFramebuffer);
         mImageViews         = std::move(imageViews);
         mWidth              = width;
@@ -1876,6 +1938,13 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
 
     bool empty() const { return mCommandBuffers[0].empty(); }
 
+    // Whether the commands of the render pass are recorded directly in the primary command buffer
+    // when it's flushed.  With Vulkan secondary command buffers, this is the case for a render
+    // pass where no command was recorded, such as one that only clears or resolves attachments
+    // through its load and store ops: it begins with inline contents and doesn't execute its
+    // secondary command buffers.
+    bool executesInlineInPrimary() const;
+
     angle::Result attachCommandPool(ErrorContext *context, SecondaryCommandPool *commandPool);
     void detachCommandPool(SecondaryCommandPool **commandPoolOut);
     void releaseCommandPool();
@@ -1972,6 +2041,22 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
                                                GLuint framebufferStencilSize,
                                                const gl::Rectangle &invalidateArea);
 
+    // Called when the loadOp of an attachment is DontCare because a previous render pass has left
+    // the contents of |invalidatedArea| (which encloses the render area) undefined.
+    void onColorLoadSkipped(PackedAttachmentIndex attachmentIndex,
+                            const gl::Rectangle &invalidatedArea)
+    {
+        mColorAttachments[attachmentIndex].onLoadSkipped(invalidatedArea);
+    }
+    void onDepthLoadSkipped(const gl::Rectangle &invalidatedArea)
+    {
+        mDepthAttachment.onLoadSkipped(invalidatedArea);
+    }
+    void onStencilLoadSkipped(const gl::Rectangle &invalidatedArea)
+    {
+        mStencilAttachment.onLoadSkipped(invalidatedArea);
+    }
+
     void updateRenderPassColorClear(PackedAttachmentIndex colorIndexVk,
                                     const VkClearValue &colorClearValue);
     void updateRenderPassDepthStencilClear(VkImageAspectFlags aspectFlags,
@@ -1983,6 +2068,18 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     // larger scissor is specified, grow the render area to accommodate it.
     void growRenderArea(ContextVk *contextVk, const gl::Rectangle &newRenderArea);
 
+    // A scissored clear that starts the render pass may be done with loadOp=Clear, with the render
+    // area being the scissor.  If the render area needs to grow before anything is drawn, the
+    // clear is turned back into vkCmdClearAttachments.  After that, the render area cannot grow,
+    // and the render pass must be closed instead.
+    void onScissoredClearWithLoadOp(uint32_t layerCount) { mScissoredClearLayerCount = layerCount; }
+    bool hasScissoredClearWithLoadOp() const { return mScissoredClearLayerCount != 0; }
+    bool canGrowRenderArea(const gl::Rectangle &newRenderArea) const
+    {
+        return !hasScissoredClearWithLoadOp() || mRenderArea.encloses(newRenderArea) ||
+               getRenderPassWriteCommandCount() == 0;
+    }
+
     void resumeTransformFeedback();
     void pauseTransformFeedback();
     bool isTransformFeedbackStarted() const { return mValidTransformFeedbackBufferCount > 0; }
@@ -2153,6 +2250,8 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     void finalizeDepthStencilImageLayoutAndLoadStore(Context *context);
     void finalizeFragmentShadingRateImageLayout(Context *context);
 
+    void revertScissoredClearWithLoadOp(ContextVk *contextVk);
+
     // When using Vulkan secondary command buffers, each subpass must be recorded in a separate
     // command buffer.  Currently ANGLE produces render passes with at most 2 subpasses.
     static constexpr size_t kMaxSubpassCount = 2;
@@ -2167,6 +2266,8 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     gl::Rectangle mRenderArea;
     PackedClearValuesArray mClearValues;
     bool mRenderPassStarted;
+    // The layer count of the scissored clear done with loadOp, or 0 if none.
+    uint32_t mScissoredClearLayerCount;
 
     // Transform feedback state
     gl::TransformFeedbackBuffersArray<VkBuffer> mTransformFeedbackCounterBuffers;
@@ -2779,6 +2880,7 @@ class ImageHelper final : public Resource, public angle::Subject
                                         uint32_t layerCount) const;
     bool hasStagedUpdatesInAllocatedLevels() const;
     bool hasBufferSourcedStagedUpdatesInAllLevels() const;
+    VkDeviceSize getTotalStagedBufferUpdateSize() const { return mTotalStagedBufferUpdateSize; }
 
     bool removeStagedClearUpdatesAndReturnColor(gl::LevelIndex levelGL,
                                                 const VkClearColorValue **color);
@@ -3018,6 +3120,21 @@ class ImageHelper final : public Resource, public angle::Subject
     void restoreSubresourceStencilContent(gl::LevelIndex level,
                                           uint32_t layerIndex,
                                           uint32_t layerCount);
+    // Used at the end of a render pass in which a part of an attachment was invalidated with
+    // glInvalidateSubFramebuffer, and so was not stored.  The contents of |area| remain undefined
+    // until the subresource is written to again, so later render passes within that area don't
+    // need to load them.  Only the last such area is remembered per aspect.
+    void setSubresourceInvalidatedArea(gl::LevelIndex level,
+                                       uint32_t layerIndex,
+                                       uint32_t layerCount,
+                                       VkImageAspectFlagBits aspect,
+                                       const gl::Rectangle &area);
+    // Returns the area of the subresource whose contents are undefined per the above, or an empty
+    // rectangle if there is none.
+    gl::Rectangle getSubresourceInvalidatedArea(gl::LevelIndex level,
+                                                uint32_t layerIndex,
+                                                uint32_t layerCount,
+                                                VkImageAspectFlagBits aspect) const;
     angle::Result reformatStagedBufferUpdates(ContextVk *contextVk,
                                               angle::FormatID srcFormatID,
                                               angle::FormatID dstFormatID,
@@ -3207,6 +3324,18 @@ class ImageHelper final : public Resource, public angle::Subject
     static constexpr uint32_t kMaxContentDefinedLayerCount = 8;
     using LevelContentDefinedMask = angle::BitSet8<kMaxContentDefinedLayerCount>;
 
+    struct SubresourceInvalidatedArea
+    {
+        gl::LevelIndex level;
+        uint32_t layerIndex;
+        uint32_t layerCount;
+        gl::Rectangle area;
+    };
+    void clearSubresourceInvalidatedArea(VkImageAspectFlags aspectFlags);
+
+    // Remove the image's memory from the memory report's lazily allocated memory tracking.
+    void onLazilyAllocatedMemoryDealloc(Renderer *renderer);
+
     void deriveExternalImageTiling(const void *createInfoChain);
 
     // Called from flushStagedUpdates, removes updates that are later superseded by another.  This
@@ -3246,6 +3375,14 @@ class ImageHelper final : public Resource, public angle::Subject
                                  PrimaryCommandBuffer *commandBuffer,
                                  VkSemaphore *acquireNextImageSemaphoreOut);
 
+    // Record a barrier for the outside render pass commands.  If the commands recorded so far don't
+    // use the image, the barrier is batched with the ones executed before the command buffer.
+    // Otherwise it's recorded inline.
+    void recordOutsideRenderPassBarrier(Context *context,
+                                        VkImageAspectFlags aspectMask,
+                                        ImageAccess newAccess,
+                                        OutsideRenderPassCommandBufferHelper *commands);
+
     void setSubresourcesWrittenSinceBarrier(gl::LevelIndex levelStart,
                                             uint32_t levelCount,
                                             uint32_t layerStart,
@@ -3299,6 +3436,16 @@ class ImageHelper final : public Resource, public angle::Subject
                                         uint32_t baseArrayLayer,
                                         uint32_t layerCount);
 
+    // If |conversion| has a load function, the source data is converted with it to a temporary
+    // buffer on the host, which is then copied to the image.
+    struct HostCopyConversion
+    {
+        LoadImageFunction loadFunction = nullptr;
+        size_t inputRowPitch           = 0;
+        size_t inputDepthPitch         = 0;
+        size_t outputRowPitch          = 0;
+        size_t outputDepthPitch        = 0;
+    };
     angle::Result updateSubresourceOnHost(ContextVk *contextVk,
                                           ApplyImageUpdate applyUpdate,
                                           const gl::ImageIndex &index,
@@ -3307,6 +3454,7 @@ class ImageHelper final : public Resource, public angle::Subject
                                           const uint8_t *source,
                                           const GLuint rowPitch,
                                           const GLuint depthPitch,
+                                          const HostCopyConversion &conversion,
                                           bool *copiedOut);
 
     // ClearEmulatedChannels updates are expected in the beginning of the level update list. They
@@ -3325,6 +3473,13 @@ class ImageHelper final : public Resource, public angle::Subject
                                          uint32_t layerStart,
                                          uint32_t layerEnd,
                                          const gl::TexLevelMask &skipLevels);
+    // Records the buffer updates that flushStagedUpdatesImpl has batched together with a single
+    // copy command.
+    struct PendingBufferToImageCopies;
+    angle::Result flushPendingBufferToImageCopies(
+        ContextVk *contextVk,
+        PendingBufferToImageCopies *pendingCopies,
+        OutsideRenderPassCommandBufferHelper **commandBuffer);
 
     // Limit the input level to the number of levels in subresource update list.
     void clipLevelToUpdateListUpperLimit(gl::LevelIndex *level) const;
@@ -3348,6 +3503,10 @@ class ImageHelper final : public Resource, public angle::Subject
                                             const gl::Box &upcomingUpdateBoundingBox,
                                             const PruneReason reason);
 
+    // Waits for the loads into staging buffers that are running on worker threads.  Must be called
+    // before the staged updates are read, flushed or released.
+    void waitForPendingStagedLoads();
+
     // Whether there are any updates in [start, end).
     bool hasStagedUpdatesInLevels(gl::LevelIndex levelStart, gl::LevelIndex levelEnd) const;
 
@@ -3537,6 +3696,8 @@ class ImageHelper final : public Resource, public angle::Subject
 
     std::vector<SubresourceUpdates> mSubresourceUpdates;
     VkDeviceSize mTotalStagedBufferUpdateSize;
+    // Loads into the staging buffers of mSubresourceUpdates that haven't necessarily finished.
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPendingStagedLoads;
 
     // Optimization for repeated clear with the same value. If this pointer is not null, the entire
     // image it has been cleared to the specified clear value. If another clear call is made with
@@ -3548,6 +3709,10 @@ class ImageHelper final : public Resource, public angle::Subject
     // only tracking VkImage. Staged update will not set this bit until it is flushed.
     gl::TexLevelArray<LevelContentDefinedMask> mVkImageContentDefined;
     gl::TexLevelArray<LevelContentDefinedMask> mVkImageStencilContentDefined;
+    // The part of a subresource that is undefined even though the subresource is considered to
+    // have defined contents above, because of a sub-invalidate.  The area is empty if none.
+    SubresourceInvalidatedArea mInvalidatedArea;
+    SubresourceInvalidatedArea mStencilInvalidatedArea;
 
     // Used for memory allocation tracking.
     // Memory size allocated for the image in the memory during the initialization.
@@ -102,6 +102,7 @@ VkResult AllocateAndBindMemoryForImage(VmaAllocator allocator,
                                        VkMemoryPropertyFlags preferredFlags,
                                        uint32_t memoryTypeBits,
                                        bool allocateDedicatedMemory,
+                                       VmaPool pool,
                                        VmaAllocation *pAllocationOut,
                                        uint32_t *pMemoryTypeIndexOut,
                                        VkDeviceSize *sizeOut)
@@ -111,6 +112,7 @@ VkResult AllocateAndBindMemoryForImage(VmaAllocator allocator,
     allocationCreateInfo.requiredFlags           = requiredFlags;
     allocationCreateInfo.preferredFlags          = preferredFlags;
     allocationCreateInfo.memoryTypeBits          = memoryTypeBits;
+    allocationCreateInfo.pool                    = pool;
     allocationCreateInfo.flags =
         allocateDedicatedMemory ? VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT : 0;
     VmaAllocationInfo allocationInfo = {};
@@ -168,6 +170,51 @@ VkResult FindMemoryTypeIndexForImageInfo(VmaAllocator allocator,
                                               pMemoryTypeIndexOut);
 }
 
+VkResult FindMemoryTypeIndex(VmaAllocator allocator,
+                             uint32_t memoryTypeBits,
+                             VkMemoryPropertyFlags requiredFlags,
+                             VkMemoryPropertyFlags preferredFlags,
+                             uint32_t *pMemoryTypeIndexOut)
+{
+    VmaAllocationCreateInfo allocationCreateInfo = {};
+    allocationCreateInfo.requiredFlags           = requiredFlags;
+    allocationCreateInfo.preferredFlags          = preferredFlags;
+
+    return vmaFindMemoryTypeIndex(allocator, memoryTypeBits, &allocationCreateInfo,
+                                  pMemoryTypeIndexOut);
+}
+
+VkResult CreateImagePool(VmaAllocator allocator,
+                         uint32_t memoryTypeIndex,
+                         VkDeviceSize blockSize,
+                         VmaPool *pPool)
+{
+    VmaPoolCreateInfo poolCreateInfo = {};
+    poolCreateInfo.memoryTypeIndex   = memoryTypeIndex;
+    poolCreateInfo.blockSize         = blockSize;
+    // Only optimal-tiling images are placed in the pool, so there is no linear resource to keep
+    // bufferImageGranularity away from.
+    poolCreateInfo.flags = VMA_POOL_CREATE_IGNORE_BUFFER_IMAGE_GRANULARITY_BIT;
+
+    return vmaCreatePool(allocator, &poolCreateInfo, pPool);
+}
+
+void DestroyPool(VmaAllocator allocator, VmaPool pool)
+{
+    vmaDestroyPool(allocator, pool);
+}
+
+void GetPoolStatistics(VmaAllocator allocator,
+                       VmaPool pool,
+                       VkDeviceSize *blockBytesOut,
+                       VkDeviceSize *allocationBytesOut)
+{
+    VmaStatistics statistics = {};
+    vmaGetPoolStatistics(allocator, pool, &statistics);
+    *blockBytesOut      = statistics.blockBytes;
+    *allocationBytesOut = statistics.allocationBytes;
+}
+
 void GetMemoryTypeProperties(VmaAllocator allocator,
                              uint32_t memoryTypeIndex,
                              VkMemoryPropertyFlags *pFlags)
@@ -175,6 +222,13 @@ void GetMemoryTypeProperties(VmaAllocator allocator,
     vmaGetMemoryTypeProperties(allocator, memoryTypeIndex, pFlags);
 }
 
+VkDeviceMemory GetAllocationDeviceMemory(VmaAllocator allocator, VmaAllocation allocation)
+{
+    VmaAllocationInfo allocationInfo = {};
+    vmaGetAllocationInfo(allocator, allocation, &allocationInfo);
+    return allocationInfo.deviceMemory;
+}
+
 VkResult MapMemory(VmaAllocator allocator, VmaAllocation allocation, void **ppData)
 {
     return vmaMapMemory(allocator, allocation, ppData);
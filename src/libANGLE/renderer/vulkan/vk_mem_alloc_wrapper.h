@@ -76,6 +76,7 @@ VkResult AllocateAndBindMemoryForImage(VmaAllocator allocator,
                                        VkMemoryPropertyFlags preferredFlags,
                                        uint32_t memoryTypeBits,
                                        bool allocateDedicatedMemory,
+                                       VmaPool pool,
                                        VmaAllocation *pAllocationOut,
                                        uint32_t *pMemoryTypeIndexOut,
                                        VkDeviceSize *sizeOut);
@@ -94,10 +95,29 @@ VkResult FindMemoryTypeIndexForImageInfo(VmaAllocator allocator,
                                          bool allocateDedicatedMemory,
                                          uint32_t *pMemoryTypeIndexOut);
 
+VkResult FindMemoryTypeIndex(VmaAllocator allocator,
+                             uint32_t memoryTypeBits,
+                             VkMemoryPropertyFlags requiredFlags,
+                             VkMemoryPropertyFlags preferredFlags,
+                             uint32_t *pMemoryTypeIndexOut);
+
+// Creates a pool of fixed-size blocks in the given memory type, for optimal-tiling images only.
+VkResult CreateImagePool(VmaAllocator allocator,
+                         uint32_t memoryTypeIndex,
+                         VkDeviceSize blockSize,
+                         VmaPool *pPool);
+void DestroyPool(VmaAllocator allocator, VmaPool pool);
+void GetPoolStatistics(VmaAllocator allocator,
+                       VmaPool pool,
+                       VkDeviceSize *blockBytesOut,
+                       VkDeviceSize *allocationBytesOut);
+
 void GetMemoryTypeProperties(VmaAllocator allocator,
                              uint32_t memoryTypeIndex,
                              VkMemoryPropertyFlags *pFlags);
 
+VkDeviceMemory GetAllocationDeviceMemory(VmaAllocator allocator, VmaAllocation allocation);
+
 VkResult MapMemory(VmaAllocator allocator, VmaAllocation allocation, void **ppData);
 
 void UnmapMemory(VmaAllocator allocator, VmaAllocation allocation);
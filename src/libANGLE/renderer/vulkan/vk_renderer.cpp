@@ -28,6 +28,7 @@
 #include "gpu_info_util/SystemInfo_vulkan.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
@@ -171,6 +172,10 @@ constexpr size_t kAllocationCountThresholdForDynamicVertexDataSize = 4096;
 // value will use a dedicated VkDeviceMemory.
 constexpr size_t kImageSizeThresholdForDedicatedMemoryAllocation = 8 * 1024 * 1024;
 
+// Images up to this size are suballocated from the small image pools, in blocks of the given size.
+constexpr VkDeviceSize kSmallImageSizeThreshold = 256 * 1024;
+constexpr VkDeviceSize kSmallImagePoolBlockSize = 4 * 1024 * 1024;
+
 // Maximum size for an allocated memory for a single object.
 constexpr VkDeviceSize kMemoryAllocationSizeLimit = 1 * 1024 * 1024 * 1024;
 
@@ -181,6 +186,17 @@ constexpr uint32_t kPipelineCacheVersion = 3;
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
 
+// Poll the memory budget every this many swaps.  Memory is proactively trimmed when the usage of a
+// heap exceeds this percentage of its budget.
+constexpr uint32_t kMemoryBudgetPollPeriod          = 30;
+constexpr VkDeviceSize kMemoryBudgetPressurePercent = 90;
+
+// With limitGarbageCleanupPerFrame, at least this many garbage objects are destroyed per frame.  If
+// the backlog is larger, a fraction of it is destroyed each frame so that it is cleared over about
+// kGarbageBacklogFrameCount frames.
+constexpr size_t kMinGarbageCleanupPerFrame = 256;
+constexpr size_t kGarbageBacklogFrameCount  = 8;
+
 // Per the Vulkan specification, ANGLE must indicate the highest version of Vulkan functionality
 // that it uses.  The Vulkan validation layers will issue messages for any core functionality that
 // requires a higher version.
@@ -1280,6 +1296,70 @@ void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDe
     memcpy(hashOut->data(), hasher.Digest(), angle::kBlobCacheKeyLength);
 }
 
+// Reports the time spent in each stage of Renderer::initialize as histograms.  Nothing is reported
+// if the platform doesn't provide a clock.
+class InitializeStageTimer final : angle::NonCopyable
+{
+  public:
+    InitializeStageTimer() : mStageStartTime(Now()) {}
+
+    static double Now()
+    {
+        angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+        return platform->currentTime(platform);
+    }
+
+    static void RecordDuration(const char *histogramName, double startTime, double endTime)
+    {
+        if (startTime != 0)
+        {
+            ANGLE_HISTOGRAM_COUNTS(histogramName, static_cast<int>((endTime - startTime) * 1e6));
+        }
+    }
+
+    void endStage(const char *histogramName)
+    {
+        const double now = Now();
+        RecordDuration(histogramName, mStageStartTime, now);
+        mStageStartTime = now;
+    }
+
+  private:
+    double mStageStartTime;
+};
+
+// Incremented whenever the way the format properties snapshot is stored in the blob cache changes.
+constexpr uint32_t kFormatPropertiesCacheVersion = 1;
+
+void ComputeFormatPropertiesCacheKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                     bool forceD16TexFilter,
+                                     angle::BlobCacheKey *hashOut)
+{
+    angle::BlobCacheHasher hasher;
+    hasher.Init();
+
+    const char *formatPropertiesName = "ANGLE Format Properties: ";
+    hasher.Update(formatPropertiesName, strlen(formatPropertiesName));
+
+    // The format properties can change with any driver update, so the driver version is part of
+    // the key in addition to what identifies the device.
+    hasher.Update(&physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.vendorID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.deviceID);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.driverVersion);
+    angle::UpdateHashWithValue(hasher, physicalDeviceProperties.apiVersion);
+
+    // The snapshot is indexed by angle::FormatID, and includes the effect of workarounds on the
+    // queried properties.
+    angle::UpdateHashWithValue(hasher, kFormatPropertiesCacheVersion);
+    angle::UpdateHashWithValue(hasher, static_cast<uint32_t>(angle::kNumANGLEFormats));
+    angle::UpdateHashWithValue(hasher, forceD16TexFilter);
+
+    ASSERT(hashOut);
+    hasher.Final();
+    memcpy(hashOut->data(), hasher.Digest(), angle::kBlobCacheKeyLength);
+}
+
 struct PipelineCacheVkChunkInfo
 {
     const uint8_t *data;
@@ -1568,29 +1648,42 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
     }
 }
 
-class CompressAndStorePipelineCacheTask : public angle::Closure
+// Retrieves, compresses and stores the pipeline cache data in a worker thread.  For large caches,
+// vkGetPipelineCacheData alone can take several milliseconds, so it is not done on the thread
+// that renders the frame.
+class SyncPipelineCacheTask : public vk::ErrorContext, public angle::Closure
 {
   public:
-    CompressAndStorePipelineCacheTask(vk::GlobalOps *globalOps,
-                                      Renderer *renderer,
-                                      std::vector<uint8_t> &&cacheData,
-                                      size_t kMaxTotalSize)
-        : mGlobalOps(globalOps),
-          mRenderer(renderer),
-          mCacheData(std::move(cacheData)),
-          mMaxTotalSize(kMaxTotalSize)
+    SyncPipelineCacheTask(vk::GlobalOps *globalOps, Renderer *renderer, size_t kMaxTotalSize)
+        : ErrorContext(renderer), mGlobalOps(globalOps), mMaxTotalSize(kMaxTotalSize)
     {}
 
     void operator()() override
     {
+        ANGLE_TRACE_EVENT0("gpu.angle", "SyncPipelineCacheTask");
+
+        std::vector<uint8_t> cacheData;
+        if (mRenderer->getPipelineCacheDataForSync(this, &cacheData) != angle::Result::Continue ||
+            cacheData.empty())
+        {
+            return;
+        }
+
         ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndStorePipelineCacheVk");
-        CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, mCacheData, mMaxTotalSize);
+        CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, cacheData, mMaxTotalSize);
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        WARN() << "Skip syncing pipeline cache data as it could not be retrieved: "
+               << VulkanResultString(result) << " (" << file << ":" << line << ")";
     }
 
   private:
     vk::GlobalOps *mGlobalOps;
-    Renderer *mRenderer;
-    std::vector<uint8_t> mCacheData;
     size_t mMaxTotalSize;
 };
 
@@ -2116,6 +2209,8 @@ Renderer::Renderer()
       mCurrentPipelineCacheBlobCacheSlotIndex(0),
       mPipelineCacheChunkCount(0),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
+      mMemoryBudgetPollTimeout(kMemoryBudgetPollPeriod),
+      mIsUnderMemoryBudgetPressure(false),
       mPipelineCacheSizeAtLastSync(0),
       mPipelineCacheInitialized(false),
       mValidationMessageCount(0),
@@ -2185,6 +2280,7 @@ void Renderer::onDestroy(vk::ErrorContext *context)
     ASSERT(mOrphanedBufferBlockList.empty());
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mShaderModuleCache.destroy(this);
 
     mRefCountedEventRecycler.destroy(mDevice);
 
@@ -2193,6 +2289,13 @@ void Renderer::onDestroy(vk::ErrorContext *context)
         oneOffCommandPool.destroy(mDevice);
     }
 
+    // The pipeline cache sync task reads from the pipeline cache, so it must finish first.
+    if (mCompressEvent)
+    {
+        mCompressEvent->wait();
+        mCompressEvent.reset();
+    }
+
     mPipelineCacheInitialized = false;
     mPipelineCache.destroy(mDevice);
 
@@ -2227,12 +2330,6 @@ void Renderer::onDestroy(vk::ErrorContext *context)
         mInstance = VK_NULL_HANDLE;
     }
 
-    if (mCompressEvent)
-    {
-        mCompressEvent->wait();
-        mCompressEvent.reset();
-    }
-
     mMemoryProperties.destroy();
     mPhysicalDevice = VK_NULL_HANDLE;
 
@@ -2455,6 +2552,8 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
                                    angle::NativeWindowSystem nativeWindowSystem,
                                    const angle::FeatureOverrides &featureOverrides)
 {
+    InitializeStageTimer stageTimer;
+
     bool canLoadDebugUtils = true;
 #if defined(ANGLE_SHARED_LIBVULKAN)
     {
@@ -2638,6 +2737,7 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
         // For promoted extensions, initialize their entry points from the core version.
         initializeInstanceExtensionEntryPointsFromCore();
     }
+    stageTimer.endStage("GPU.ANGLE.VulkanCreateInstanceUs");
 
     if (mEnableDebugUtils)
     {
@@ -2772,8 +2872,30 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
 
     // Determine the threshold for pending garbage sizes.
     calculatePendingGarbageSizeLimit();
+    stageTimer.endStage("GPU.ANGLE.VulkanSelectPhysicalDeviceUs");
 
     ANGLE_TRY(setupDevice(context, featureOverrides, useVulkanSwapchain, nativeWindowSystem));
+    stageTimer.endStage("GPU.ANGLE.VulkanSetupDeviceUs");
+
+    // Initialize the format table.  The format properties it needs are loaded from the blob cache
+    // if a previous display has stored them, instead of being queried from the device one by one.
+    // Otherwise, the format table only depends on the physical device and the features, so it is
+    // initialized on another thread while the device is created, which can take a long time on
+    // some drivers.
+    const bool formatPropertiesLoaded = loadFormatPropertiesFromBlobCache();
+    const bool initializeFormatTableInParallel =
+        !formatPropertiesLoaded && mFeatures.initializeFormatTableInParallel.enabled;
+    double formatTableStartTime = 0;
+    double formatTableEndTime   = 0;
+    std::thread formatTableThread;
+    if (initializeFormatTableInParallel)
+    {
+        formatTableThread = std::thread([this, &formatTableStartTime, &formatTableEndTime]() {
+            formatTableStartTime = InitializeStageTimer::Now();
+            mFormatTable.initialize(this, &mNativeTextureCaps);
+            formatTableEndTime = InitializeStageTimer::Now();
+        });
+    }
 
     // If only one queue family, that's the only choice and the device is initialize with that.
     // If there is more than one queue, we still create the device with the first queue family
@@ -2781,10 +2903,29 @@ angle::Result Renderer::initialize(vk::ErrorContext *context,
     // present because of EGL_KHR_surfaceless_context or simply pbuffers.  So far, only MoltenVk
     // seems to expose multiple queue families, and using the first queue family is fine with
     // it.
-    ANGLE_TRY(createDeviceAndQueue(context, firstQueueFamily, globalPriority));
+    const angle::Result createDeviceResult =
+        createDeviceAndQueue(context, firstQueueFamily, globalPriority);
+
+    if (initializeFormatTableInParallel)
+    {
+        // Any time spent waiting for the format table is counted as part of the device creation.
+        formatTableThread.join();
+    }
+    stageTimer.endStage("GPU.ANGLE.VulkanCreateDeviceUs");
+    ANGLE_TRY(createDeviceResult);
 
-    // Initialize the format table.
-    mFormatTable.initialize(this, &mNativeTextureCaps);
+    if (!initializeFormatTableInParallel)
+    {
+        formatTableStartTime = InitializeStageTimer::Now();
+        mFormatTable.initialize(this, &mNativeTextureCaps);
+        formatTableEndTime = InitializeStageTimer::Now();
+    }
+    InitializeStageTimer::RecordDuration("GPU.ANGLE.VulkanInitializeFormatTableUs",
+                                         formatTableStartTime, formatTableEndTime);
+    if (!formatPropertiesLoaded)
+    {
+        storeFormatPropertiesInBlobCache();
+    }
 
     // Null terminate the extension list returned for EGL_VULKAN_INSTANCE_EXTENSIONS_ANGLE.
     mEnabledInstanceExtensions.push_back(nullptr);
@@ -2981,6 +3122,9 @@ angle::Result Renderer::initializeMemoryAllocator(vk::ErrorContext *context)
 // - VK_EXT_primitive_topology_list_restart:           primitiveTopologyListRestart (feature)
 // - VK_EXT_graphics_pipeline_library:                 graphicsPipelineLibrary (feature),
 //                                                     graphicsPipelineLibraryFastLinking (property)
+// - VK_EXT_shader_object:                             shaderObject (feature)
+// - VK_EXT_extended_dynamic_state3:                   extendedDynamicState3ColorBlendEquation
+//                                                                                   (feature)
 // - VK_KHR_fragment_shading_rate:                     pipelineFragmentShadingRate (feature)
 // - VK_EXT_fragment_shader_interlock:                 fragmentShaderPixelInterlock (feature)
 // - VK_EXT_pipeline_robustness:                       pipelineRobustness (feature)
@@ -3017,6 +3161,7 @@ angle::Result Renderer::initializeMemoryAllocator(vk::ErrorContext *context)
 //                                                     tileMemoryHeapProperties (property)
 // - VK_EXT_texture_compression_astc_3d                textureCompressionASTC_3D (feature)
 // - VK_AMD_shader_core_properties
+// - VK_KHR_push_descriptor                            maxPushDescriptors (property)
 //
 
 void Renderer::appendDeviceExtensionFeaturesNotPromoted(
@@ -3076,6 +3221,11 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceFeatures, &mDepthClampZeroOneFeatures);
     }
 
+    if (ExtensionFound(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mConditionalRenderingFeatures);
+    }
+
     if (ExtensionFound(VK_EXT_DEPTH_CLIP_CONTROL_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceFeatures, &mDepthClipControlFeatures);
@@ -3097,6 +3247,16 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceProperties, &mGraphicsPipelineLibraryProperties);
     }
 
+    if (ExtensionFound(VK_EXT_SHADER_OBJECT_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mShaderObjectFeatures);
+    }
+
+    if (ExtensionFound(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mExtendedDynamicState3Features);
+    }
+
     if (ExtensionFound(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceFeatures, &mFragmentShadingRateFeatures);
@@ -3238,6 +3398,11 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
     {
         vk::AddToPNextChain(deviceProperties, &mShaderCorePropertiesAMD);
     }
+
+    if (ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceProperties, &mPushDescriptorProperties);
+    }
 }
 
 // The following features and properties used by ANGLE have been promoted to Vulkan 1.1:
@@ -3529,6 +3694,10 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mDepthClampZeroOneFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_EXT;
 
+    mConditionalRenderingFeatures = {};
+    mConditionalRenderingFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT;
+
     mDepthClipControlFeatures = {};
     mDepthClipControlFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT;
@@ -3557,6 +3726,13 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mGraphicsPipelineLibraryProperties.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
 
+    mShaderObjectFeatures       = {};
+    mShaderObjectFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT;
+
+    mExtendedDynamicState3Features = {};
+    mExtendedDynamicState3Features.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+
     mVertexInputDynamicStateFeatures = {};
     mVertexInputDynamicStateFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT;
@@ -3722,6 +3898,10 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mShaderCorePropertiesAMD       = {};
     mShaderCorePropertiesAMD.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD;
 
+    mPushDescriptorProperties = {};
+    mPushDescriptorProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+
     // Query features and properties.
     VkPhysicalDeviceFeatures2KHR deviceFeatures = {};
     deviceFeatures.sType                        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
@@ -3763,6 +3943,7 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mProtectedMemoryFeatures.pNext                    = nullptr;
     mHostQueryResetFeatures.pNext                     = nullptr;
     mDepthClampZeroOneFeatures.pNext                  = nullptr;
+    mConditionalRenderingFeatures.pNext               = nullptr;
     mDepthClipControlFeatures.pNext                   = nullptr;
     mPrimitivesGeneratedQueryFeatures.pNext           = nullptr;
     mPrimitiveTopologyListRestartFeatures.pNext       = nullptr;
@@ -3770,6 +3951,8 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mExtendedDynamicState2Features.pNext              = nullptr;
     mGraphicsPipelineLibraryFeatures.pNext            = nullptr;
     mGraphicsPipelineLibraryProperties.pNext          = nullptr;
+    mShaderObjectFeatures.pNext                       = nullptr;
+    mExtendedDynamicState3Features.pNext              = nullptr;
     mVertexInputDynamicStateFeatures.pNext            = nullptr;
     mDynamicRenderingFeatures.pNext                   = nullptr;
     mDynamicRenderingLocalReadFeatures.pNext          = nullptr;
@@ -3816,6 +3999,7 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mTileMemoryHeapFeatures.pNext   = nullptr;
     mTileMemoryHeapProperties.pNext = nullptr;
     mShaderCorePropertiesAMD.pNext  = nullptr;
+    mPushDescriptorProperties.pNext = nullptr;
 }
 
 // See comment above appendDeviceExtensionFeaturesNotPromoted.  Additional extensions are enabled
@@ -3857,6 +4041,12 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mDepthClampZeroOneFeatures);
     }
 
+    if (mFeatures.supportsConditionalRendering.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mConditionalRenderingFeatures);
+    }
+
     if (mFeatures.supportsMemoryBudget.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
@@ -4017,6 +4207,17 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mBlendOperationAdvancedFeatures);
     }
 
+    if (mFeatures.useColorBlendEquationDynamicState.enabled)
+    {
+        // Only enable the part of VK_EXT_extended_dynamic_state3 that is used.
+        mEnabledDeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+        mExtendedDynamicState3Features       = {};
+        mExtendedDynamicState3Features.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+        mExtendedDynamicState3Features.extendedDynamicState3ColorBlendEquation = VK_TRUE;
+        vk::AddToPNextChain(&mEnabledFeatures, &mExtendedDynamicState3Features);
+    }
+
     if (mFeatures.supportsGraphicsPipelineLibrary.enabled)
     {
         // VK_EXT_graphics_pipeline_library requires VK_KHR_pipeline_library
@@ -4209,6 +4410,11 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
     {
         mEnabledDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME);
     }
+
+    if (getFeatures().supportsPushDescriptor.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    }
 }
 
 // See comment above appendDeviceExtensionFeaturesPromotedTo11.
@@ -4495,6 +4701,10 @@ void Renderer::initDeviceExtensionEntryPoints()
     {
         InitTransformFeedbackEXTFunctions(mDevice);
     }
+    if (mFeatures.supportsConditionalRendering.enabled)
+    {
+        InitConditionalRenderingEXTFunctions(mDevice);
+    }
     if (getFeatures().supportsLogicOpDynamicState.enabled)
     {
         // VK_EXT_extended_dynamic_state2 is only partially core in Vulkan 1.3.  If the logicOp
@@ -4502,6 +4712,10 @@ void Renderer::initDeviceExtensionEntryPoints()
         // extension
         InitExtendedDynamicState2EXTFunctions(mDevice);
     }
+    if (mFeatures.useColorBlendEquationDynamicState.enabled)
+    {
+        InitExtendedDynamicState3EXTFunctions(mDevice);
+    }
     if (mFeatures.supportsFragmentShadingRate.enabled)
     {
         InitFragmentShadingRateKHRDeviceFunction(mDevice);
@@ -4559,6 +4773,10 @@ void Renderer::initDeviceExtensionEntryPoints()
     {
         InitTileMemoryHeapFunctions(mDevice);
     }
+    if (mFeatures.supportsPushDescriptor.enabled)
+    {
+        InitPushDescriptorFunctions(mDevice);
+    }
     // Extensions promoted to Vulkan 1.2
     {
         if (mFeatures.supportsHostQueryReset.enabled)
@@ -4573,6 +4791,10 @@ void Renderer::initDeviceExtensionEntryPoints()
         {
             InitBufferDeviceAddressFunctions(mDevice);
         }
+        if (mFeatures.supportsTimelineSemaphore.enabled)
+        {
+            InitTimelineSemaphoreFunctions(mDevice);
+        }
     }
     // Extensions promoted to Vulkan 1.3
     {
@@ -5378,6 +5600,28 @@ bool Renderer::canPreferDeviceLocalMemoryHostVisible(VkPhysicalDeviceType device
     return deviceType != VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
 }
 
+bool Renderer::hasLargeDeviceLocalHostVisibleHeap()
+{
+    // Without resizable BAR, only a 256MB window of the device local memory of discrete GPUs can
+    // be mapped.  A larger host visible device local heap means that it is enabled.
+    constexpr VkDeviceSize kBARWindowSize = 256 * 1024 * 1024;
+    static constexpr VkMemoryPropertyFlags kHostVisibleDeviceLocalFlags =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    const vk::MemoryProperties &memoryProperties = getMemoryProperties();
+    for (uint32_t i = 0; i < memoryProperties.getMemoryTypeCount(); ++i)
+    {
+        if ((memoryProperties.getMemoryType(i).propertyFlags & kHostVisibleDeviceLocalFlags) ==
+                kHostVisibleDeviceLocalFlags &&
+            memoryProperties.getHeapSizeForMemoryType(i) > kBARWindowSize)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             const angle::FeatureOverrides &featureOverrides,
                             UseVulkanSwapchain useVulkanSwapchain,
@@ -5568,6 +5812,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, clampFragDepth,
                             isNvidia && !mFeatures.supportsDepthClampZeroOne.enabled);
 
+    // Conditional rendering is recorded in the render pass command buffer itself, so
+    // inheritedConditionalRendering is not needed.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsConditionalRendering,
+                            mConditionalRenderingFeatures.conditionalRendering == VK_TRUE);
+
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsRenderpass2,
         ExtensionFound(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, deviceExtensionNames));
@@ -5872,6 +6121,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // specified.
     ANGLE_FEATURE_CONDITION(&mFeatures, preferAggregateBarrierCalls, isImmediateModeRenderer);
 
+    // Back-to-back transfers to different images, such as texture streaming, would otherwise each
+    // be preceded by their own barrier.
+    ANGLE_FEATURE_CONDITION(&mFeatures, batchOutsideRenderPassImageBarriers, true);
+
     // For IMR devices, it's more efficient to ignore invalidate of framebuffer attachments with
     // emulated formats that have extra channels.  For TBR devices, the invalidate will be followed
     // by a clear to retain valid values in said extra channels.
@@ -5978,6 +6231,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         &mFeatures, preferDrawClearOverVkCmdClearAttachments,
         isQualcommProprietary && driverVersion < angle::VersionTriple(512, 762, 12));
 
+    // Turning a scissored clear into a loadOp means the render pass cannot grow after being drawn
+    // to, so applications that scissor many regions of the framebuffer get more render passes.
+    // Until it's known where that's a win, it's only done when asked for.
+    ANGLE_FEATURE_CONDITION(&mFeatures, preferLoadOpForScissoredClear, false);
+
     // R32F imageAtomicExchange emulation is done if shaderImageFloat32Atomics feature is not
     // supported.
     ANGLE_FEATURE_CONDITION(&mFeatures, emulateR32fImageAtomicExchange,
@@ -6000,6 +6258,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         &mFeatures, supportsMemoryBudget,
         ExtensionFound(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, deviceExtensionNames));
 
+    // Low memory Android devices are the ones where the application risks being killed before an
+    // allocation ever fails, so react to the memory budget there.
+    ANGLE_FEATURE_CONDITION(&mFeatures, trimMemoryOnBudgetPressure,
+                            mFeatures.supportsMemoryBudget.enabled && IsAndroid());
+
+    // Spread the destruction of large amounts of garbage over several frames to avoid frame time
+    // spikes, which are most visible on mobile.
+    ANGLE_FEATURE_CONDITION(&mFeatures, limitGarbageCleanupPerFrame, IsAndroid());
+
     // TODO: Delete these two feature flags (https://issuetracker.google.com/422507974). More
     // frequent submission may help benchmark score improvement, and in certain cases helps real
     // performance as well (for things like bufferSubData able to go down faster path), but it
@@ -6011,6 +6278,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, forceSubmitExceptionsAtFBOBoundary,
                             mFeatures.preferSubmitAtFBOBoundary.enabled && !isQualcommProprietary);
 
+    // Applications that interop with Vulkan typically flush or swap right after signaling the
+    // semaphore, but GL doesn't require that, so deferring the signal is opt-in.
+    ANGLE_FEATURE_CONDITION(&mFeatures, deferExternalSemaphoreSignal, false);
+
     // The number of minimum write commands in the command buffer to trigger one submission of
     // pending commands at draw call time
     if (isARMProprietary)
@@ -6194,6 +6465,14 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         &mFeatures, preferDeviceLocalMemoryHostVisible,
         canPreferDeviceLocalMemoryHostVisible(mPhysicalDeviceProperties.deviceType));
 
+    // With resizable BAR, persistently mapped buffers can be written to by the CPU directly in
+    // device local memory, which the GPU reads faster than host memory over PCIe.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, preferDeviceLocalMemoryForPersistentWriteBuffers,
+        mPhysicalDeviceProperties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU &&
+            !mFeatures.preferDeviceLocalMemoryHostVisible.enabled &&
+            hasLargeDeviceLocalHostVisibleHeap());
+
     // Multiple dynamic state issues on ARM have been fixed.
     // http://issuetracker.google.com/285124778
     // http://issuetracker.google.com/285196249
@@ -6314,6 +6593,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
             !(IsLinux() && isIntel && driverVersion < angle::VersionTriple(22, 2, 0)) &&
             !(IsAndroid() && isGalaxyS23));
 
+    // With the blend factors and equations set dynamically, changing them doesn't require a new
+    // pipeline.  Advanced blend equations cannot be set with vkCmdSetColorBlendEquationEXT, so
+    // this is not used when they are supported natively (they are otherwise emulated in the
+    // shader, with blending disabled).
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, useColorBlendEquationDynamicState,
+        mExtendedDynamicState3Features.extendedDynamicState3ColorBlendEquation == VK_TRUE &&
+            !mFeatures.supportsBlendOperationAdvanced.enabled);
+
     // Older Samsung drivers with version < 24.0.0 have a bug in imageless framebuffer support.
     const bool isSamsungDriverWithImagelessFramebufferBug =
         isSamsung && driverVersion < angle::VersionTriple(24, 0, 0);
@@ -6376,6 +6664,12 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             mPipelineRobustnessFeatures.pipelineRobustness == VK_TRUE &&
                                 mPhysicalDeviceFeatures.robustBufferAccess);
 
+    // Without VK_EXT_pipeline_robustness, robustBufferAccess is enabled for the whole device when
+    // available.  With it, the contexts that share shaders with a robust context use robust
+    // pipelines when this feature is enabled.
+    ANGLE_FEATURE_CONDITION(&mFeatures, preferRobustBufferAccessToIndexClamping,
+                            mPhysicalDeviceFeatures.robustBufferAccess == VK_TRUE);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsPipelineProtectedAccess,
                             mPipelineProtectedAccessFeatures.pipelineProtectedAccess == VK_TRUE &&
                                 mProtectedMemoryFeatures.protectedMemory == VK_TRUE);
@@ -6396,6 +6690,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 (!isNvidia || driverVersion >= angle::VersionTriple(531, 0, 0)) &&
                                 !isRADV && !isARMProprietary && !isPowerVR);
 
+    // VK_EXT_shader_object would let programs be drawn without any VkPipeline, with all state set
+    // dynamically.  It is only detected for now; the extension is not enabled as nothing uses it.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsShaderObject,
+                            mShaderObjectFeatures.shaderObject == VK_TRUE);
+
     // When VK_EXT_graphics_pipeline_library is not used:
     //
     //   The following drivers are known to key the pipeline cache blobs with vertex input and
@@ -6426,6 +6725,14 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
             (libraryBlobsAreReusedByMonolithicPipelines && !isQualcommProprietary &&
              !(IsLinux() && isIntel) && !(IsChromeOS() && isSwiftShader)));
 
+    // The link-time warm up can only guess the state the program is drawn with.  Remembering the
+    // pipelines that were actually created at draw time allows a later run to create them ahead of
+    // the first draw.  With VK_EXT_graphics_pipeline_library, draw-time misses are already cheap
+    // thanks to fast linking, so this is only done for monolithic pipelines.
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpRecordedGraphicsPipelines,
+                            mFeatures.warmUpPipelineCacheAtLink.enabled &&
+                                !mFeatures.supportsGraphicsPipelineLibrary.enabled);
+
     // On SwiftShader, no data is retrieved from the pipeline cache, so there is no reason to
     // serialize it or put it in the blob cache.
     // For Windows NVIDIA Vulkan driver, Vulkan pipeline cache will only generate one
@@ -6452,6 +6759,13 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, preferMonolithicPipelinesOverLibraries,
                             mFeatures.supportsGraphicsPipelineLibrary.enabled && false);
 
+    // When monolithic pipelines are created in the background, the pipelines that the application
+    // has previously transitioned to from the bound pipeline are likely to be used next.  Their
+    // monolithic pipelines are created ahead of need, which avoids a linked pipeline being used at
+    // all after the state change.
+    ANGLE_FEATURE_CONDITION(&mFeatures, prewarmMonolithicPipelineTransitions,
+                            mFeatures.preferMonolithicPipelinesOverLibraries.enabled);
+
     // To avoid memory bloating due to using pipeline caches per program, the pipeline cache in the
     // renderer can be used.
     ANGLE_FEATURE_CONDITION(&mFeatures, preferGlobalPipelineCache,
@@ -6523,6 +6837,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, verifyPipelineCacheInBlobCache,
                             !mFeatures.hasBlobCacheThatEvictsOldItemsFirst.enabled);
 
+    // Querying the format properties is a large part of the time spent in eglInitialize on some
+    // drivers, and the results only change with the driver.
+    ANGLE_FEATURE_CONDITION(&mFeatures, cacheFormatPropertiesInBlobCache, true);
+    ANGLE_FEATURE_CONDITION(&mFeatures, initializeFormatTableInParallel, true);
+
     // On ARM proprietary driver, dynamic state for stencil write mask doesn't work correctly in the
     // presence of discard or alpha to coverage, if the static state provided when creating the
     // pipeline has a value of 0. Fixed in r43p0 release.
@@ -6573,6 +6892,26 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                     kRequiredSubgroupOp &&
                                 (limitsVk.maxTexelBufferElements >= kMaxTexelBufferSize));
 
+    // Without native ETC support, ETC textures are otherwise decompressed to RGBA8 (or R16/RG16 for
+    // EAC), using 4 to 8 times as much memory.  Transcoding to BC keeps them compressed, but BC is
+    // re-encoded from the decoded texels and loses precision compared to the ETC data, so it's
+    // only done when requested.  Note that the compute transcoder also needs textures to be
+    // stored as BC, see isEtcToBcTranscodingEnabled().
+    ANGLE_FEATURE_CONDITION(&mFeatures, transcodeEtcToBc, false);
+
+    // Decoding ASTC on the CPU takes long enough that the upload call shouldn't wait for it.
+    ANGLE_FEATURE_CONDITION(&mFeatures, decodeAstcUploadsAsynchronously, true);
+
+    // Expanding RGB texture uploads to RGBA on the GPU trades CPU time and staging memory for a
+    // compute dispatch per upload.  Whether that is a win depends on the upload sizes and the
+    // device, so it is left to be enabled explicitly.
+    ANGLE_FEATURE_CONDITION(&mFeatures, expandRgbUploadsWithCompute, false);
+
+    // Leaving small sub-image updates staged lets them be copied to the image with one command when
+    // the texture is used, but holds on to their staging memory until then.  That also moves the
+    // copies next to the texture's first use, so it is left to be enabled explicitly.
+    ANGLE_FEATURE_CONDITION(&mFeatures, batchSubImageUpdates, false);
+
     // Limit GL_MAX_SHADER_STORAGE_BLOCK_SIZE to 256MB on older ARM hardware.
     ANGLE_FEATURE_CONDITION(&mFeatures, limitMaxStorageBufferSize, isMaliJobManagerBasedGPU);
 
@@ -6614,6 +6953,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         &mFeatures, forceWaitForSubmissionToCompleteForQueryResult,
         isARMProprietary || (isNvidia && driverVersion < angle::VersionTriple(470, 0, 0)));
 
+    // Copying occlusion query results relies on the GPU waiting for them, so keep it off where the
+    // wait for query results is known to misbehave.
+    ANGLE_FEATURE_CONDITION(&mFeatures, copyOcclusionQueryResultsToBuffer,
+                            !mFeatures.forceWaitForSubmissionToCompleteForQueryResult.enabled);
+
+    // Measuring the GPU time of every command buffer costs two timestamps each, so it's only done
+    // when asked for.  The queries are not created if the queue doesn't support timestamps.
+    ANGLE_FEATURE_CONDITION(&mFeatures, measurePassGpuTime, false);
+
     // Some ARM proprietary drivers may not free memory in "vkFreeCommandBuffers()" without
     // VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT flag.
     ANGLE_FEATURE_CONDITION(&mFeatures, useResetCommandBufferBitForSecondaryPools,
@@ -6631,9 +6979,18 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
 
     ANGLE_FEATURE_CONDITION(&mFeatures, enablePipelineCacheDataCompression, true);
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, useSmallImageMemoryPools, true);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
                             mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
 
+    // Signal a per-queue timeline semaphore with each submission, so that completed batches can be
+    // found with a single counter query instead of a fence per batch.  The extra submit fence
+    // workaround relies on per-batch fences, so the two are not used together.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useTimelineSemaphoreForQueueSerials,
+                            mFeatures.supportsTimelineSemaphore.enabled &&
+                                !mFeatures.enableExtraSubmitFence.enabled);
+
 #if defined(ANGLE_PLATFORM_ANDROID)
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsExternalFormatResolve,
                             mExternalFormatResolveFeatures.externalFormatResolve == VK_TRUE);
@@ -6748,6 +7105,25 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // Disable descriptorSet cache for testing drivers to ensure the code path gets tested.
     ANGLE_FEATURE_CONDITION(&mFeatures, descriptorSetCache, !isSoftwareRenderer);
 
+    // Baking the samplers in the descriptor set layout recreates the pipeline layout (and thus the
+    // pipelines) of a program the first time it is drawn with, and whenever a sampler is seen
+    // changing.  Disabled by default until the trade-off is measured.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useImmutableSamplersForTextures, false);
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsPushDescriptor,
+        ExtensionFound(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, deviceExtensionNames));
+
+    // Pushing small descriptor sets skips the descriptor set cache and pool entirely, which helps
+    // programs whose textures, uniform buffers or storage buffers change every draw.  Only one set
+    // per program can be pushed, see ProgramExecutableVk::createPipelineLayout.
+    ANGLE_FEATURE_CONDITION(&mFeatures, usePushDescriptorsForTextures,
+                            mFeatures.supportsPushDescriptor.enabled);
+    ANGLE_FEATURE_CONDITION(&mFeatures, usePushDescriptorsForUniformBuffers,
+                            mFeatures.supportsPushDescriptor.enabled);
+    ANGLE_FEATURE_CONDITION(&mFeatures, usePushDescriptorsForStorageBuffers,
+                            mFeatures.supportsPushDescriptor.enabled);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsImageCompressionControl,
                             mImageCompressionControlFeatures.imageCompressionControl == VK_TRUE);
 
@@ -6808,6 +7184,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // Force enable sample usage for AHB images for Samsung
     ANGLE_FEATURE_CONDITION(&mFeatures, forceSampleUsageForAhbBackedImages, isSamsung);
 
+    // Video players and compositors create EGL images from the same few recycled buffers over and
+    // over, each time importing the buffer into a new VkImage.
+    ANGLE_FEATURE_CONDITION(&mFeatures, recycleExternalBufferImports,
+                            IsAndroid() || IsLinux() || IsChromeOS());
+
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsAstcDecodeMode,
         ExtensionFound(VK_EXT_ASTC_DECODE_MODE_EXTENSION_NAME, deviceExtensionNames));
@@ -6868,6 +7249,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // 2. GL_ANGLE_shader_pixel_local_storage_coherent
     ANGLE_FEATURE_CONDITION(&mFeatures, supportShaderPixelLocalStorageAngle, !isSamsung);
 
+    // Whether PLS planes live in input attachments even when only shader images give coherence.
+    // Off by default, as it removes GL_ANGLE_shader_pixel_local_storage_coherent;
+    // PixelLocalStoragePerf compares the two implementations.
+    ANGLE_FEATURE_CONDITION(&mFeatures, preferFramebufferFetchPixelLocalStorage, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportFragmentShadingRateExtExtensions,
                             mFeatures.supportsFragmentShadingRate.enabled && !isSamsung);
 
@@ -6895,6 +7281,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, enableMergeClientAttribBuffer,
                             !isSamsungDriverWithVertexAttributePackingBug);
 
+    // Streaming all client attributes of a draw into one allocation saves the per-attribute
+    // allocation and flush.  Left disabled until it has been measured on more devices.
+    ANGLE_FEATURE_CONDITION(&mFeatures, shareStreamedVertexBufferAcrossAttribs, false);
+
     // Enable this feature to avoid image allocation overhead when repeatedly uploading the same
     // texture that has already been uploaded, outside a render pass.
     ANGLE_FEATURE_CONDITION(&mFeatures, avoidImageGhostOutsideRenderPass, true);
@@ -7237,6 +7627,22 @@ angle::Result Renderer::getLockedPipelineCacheDataIfNew(vk::ErrorContext *contex
     return angle::Result::Continue;
 }
 
+angle::Result Renderer::getPipelineCacheDataForSync(vk::ErrorContext *context,
+                                                    std::vector<uint8_t> *pipelineCacheDataOut)
+{
+    std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
+
+    size_t pipelineCacheSize = 0;
+    ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, &pipelineCacheSize,
+                                              mPipelineCacheSizeAtLastSync, pipelineCacheDataOut));
+    if (!pipelineCacheDataOut->empty())
+    {
+        mPipelineCacheSizeAtLastSync = pipelineCacheSize;
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result Renderer::syncPipelineCacheVk(const gl::Context *contextGL)
 {
     // Skip syncing until pipeline cache is initialized.
@@ -7270,19 +7676,6 @@ angle::Result Renderer::syncPipelineCacheVk(const gl::Context *contextGL)
         return angle::Result::Continue;
     }
 
-    size_t pipelineCacheSize = 0;
-    std::vector<uint8_t> pipelineCacheData;
-    {
-        std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
-        ANGLE_TRY(getLockedPipelineCacheDataIfNew(
-            contextVk, &pipelineCacheSize, mPipelineCacheSizeAtLastSync, &pipelineCacheData));
-    }
-    if (pipelineCacheData.empty())
-    {
-        return angle::Result::Continue;
-    }
-    mPipelineCacheSizeAtLastSync = pipelineCacheSize;
-
     vk::GlobalOps *globalOps = getGlobalOps();
     ASSERT(globalOps);
     if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
@@ -7291,13 +7684,21 @@ angle::Result Renderer::syncPipelineCacheVk(const gl::Context *contextGL)
         // ensure the size can fit into the 32MB blob cache limit on supported platforms.
         constexpr size_t kMaxTotalSize = 64 * 1024 * 1024;
 
-        // Create task to compress.
+        // Create task to retrieve the data and compress it.  Only one such task is in flight at a
+        // time, so the size at last sync is only updated by one thread.
         mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
-            std::make_shared<CompressAndStorePipelineCacheTask>(
-                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize));
+            std::make_shared<SyncPipelineCacheTask>(globalOps, this, kMaxTotalSize),
+            angle::WorkerTaskPriority::Background);
     }
     else
     {
+        std::vector<uint8_t> pipelineCacheData;
+        ANGLE_TRY(getPipelineCacheDataForSync(contextVk, &pipelineCacheData));
+        if (pipelineCacheData.empty())
+        {
+            return angle::Result::Continue;
+        }
+
         // If enableAsyncPipelineCacheCompression is disabled, to avoid the risk, set kMaxTotalSize
         // to 64k.
         constexpr size_t kMaxTotalSize = 64 * 1024;
@@ -7307,9 +7708,58 @@ angle::Result Renderer::syncPipelineCacheVk(const gl::Context *contextGL)
     return angle::Result::Continue;
 }
 
+void Renderer::updateMemoryBudgetPressure(const gl::Context *contextGL)
+{
+    if (--mMemoryBudgetPollTimeout > 0)
+    {
+        return;
+    }
+    mMemoryBudgetPollTimeout = kMemoryBudgetPollPeriod;
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT memoryBudgetProperties = {};
+    memoryBudgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryProperties = {};
+    memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    vk::AddToPNextChain(&memoryProperties, &memoryBudgetProperties);
+
+    vkGetPhysicalDeviceMemoryProperties2(mPhysicalDevice, &memoryProperties);
+
+    bool isUnderPressure = false;
+    for (uint32_t heapIndex = 0; heapIndex < memoryProperties.memoryProperties.memoryHeapCount;
+         ++heapIndex)
+    {
+        const VkDeviceSize budget = memoryBudgetProperties.heapBudget[heapIndex];
+        const VkDeviceSize usage  = memoryBudgetProperties.heapUsage[heapIndex];
+        if (budget > 0 && usage * 100 > budget * kMemoryBudgetPressurePercent)
+        {
+            isUnderPressure = true;
+            break;
+        }
+    }
+
+    if (isUnderPressure && !mIsUnderMemoryBudgetPressure)
+    {
+        ANGLE_PERF_WARNING(vk::GetImpl(contextGL)->getDebug(), GL_DEBUG_SEVERITY_LOW,
+                           "Memory usage is close to the budget; freeing cached memory.");
+    }
+    mIsUnderMemoryBudgetPressure = isUnderPressure;
+}
+
 angle::Result Renderer::onFrameBoundary(const gl::Context *contextGL)
 {
     ASSERT(contextGL);
+
+    if (mFeatures.trimMemoryOnBudgetPressure.enabled)
+    {
+        updateMemoryBudgetPressure(contextGL);
+    }
+
+    if (mFeatures.limitGarbageCleanupPerFrame.enabled)
+    {
+        resetGarbageCleanupBudget(vk::GetImpl(contextGL));
+    }
+
     return syncPipelineCacheVk(contextGL);
 }
 
@@ -7413,6 +7863,72 @@ angle::Result Renderer::queueSubmitWaitSemaphore(vk::ErrorContext *context,
     return angle::Result::Continue;
 }
 
+bool Renderer::loadFormatPropertiesFromBlobCache()
+{
+    if (!mFeatures.cacheFormatPropertiesInBlobCache.enabled)
+    {
+        return false;
+    }
+
+    angle::BlobCacheKey cacheKey;
+    ComputeFormatPropertiesCacheKey(mPhysicalDeviceProperties, mFeatures.forceD16TexFilter.enabled,
+                                    &cacheKey);
+
+    angle::BlobCacheValue cacheValue;
+    if (!mGlobalOps->getBlob(cacheKey, &cacheValue) ||
+        cacheValue.size() != sizeof(VkFormatProperties) * angle::kNumANGLEFormats)
+    {
+        return false;
+    }
+
+    // The blob is not necessarily aligned, so the properties are copied out one by one.
+    const uint8_t *cachedProperties = cacheValue.data();
+    for (size_t formatIndex = 0; formatIndex < angle::kNumANGLEFormats; ++formatIndex)
+    {
+        const angle::FormatID formatID = static_cast<angle::FormatID>(formatIndex);
+        // The external YUV formats depend on the AHardwareBuffers seen so far, and are never
+        // taken from the cache.
+        if (formatID != angle::FormatID::NONE && !vk::IsYUVExternalFormat(formatID))
+        {
+            memcpy(&mFormatProperties[formatID],
+                   cachedProperties + formatIndex * sizeof(VkFormatProperties),
+                   sizeof(VkFormatProperties));
+        }
+    }
+
+    return true;
+}
+
+void Renderer::storeFormatPropertiesInBlobCache() const
+{
+    if (!mFeatures.cacheFormatPropertiesInBlobCache.enabled)
+    {
+        return;
+    }
+
+    angle::MemoryBuffer cacheData;
+    if (!cacheData.resize(sizeof(VkFormatProperties) * angle::kNumANGLEFormats))
+    {
+        return;
+    }
+
+    // Formats that were not queried are stored as invalid, and are still queried lazily once the
+    // snapshot is loaded.
+    const VkFormatProperties invalid = {0, 0, kInvalidFormatFeatureFlags};
+    VkFormatProperties *properties   = reinterpret_cast<VkFormatProperties *>(cacheData.data());
+    for (size_t formatIndex = 0; formatIndex < angle::kNumANGLEFormats; ++formatIndex)
+    {
+        const angle::FormatID formatID = static_cast<angle::FormatID>(formatIndex);
+        properties[formatIndex] =
+            vk::IsYUVExternalFormat(formatID) ? invalid : mFormatProperties[formatID];
+    }
+
+    angle::BlobCacheKey cacheKey;
+    ComputeFormatPropertiesCacheKey(mPhysicalDeviceProperties, mFeatures.forceD16TexFilter.enabled,
+                                    &cacheKey);
+    mGlobalOps->putBlob(cacheKey, cacheData);
+}
+
 template <VkFormatFeatureFlags VkFormatProperties::*features>
 VkFormatFeatureFlags Renderer::getFormatFeatureBits(angle::FormatID formatID,
                                                     const VkFormatFeatureFlags featureBits) const
@@ -7482,12 +7998,13 @@ bool Renderer::haveSameFormatFeatureBits(angle::FormatID formatID1, angle::Forma
            hasImageFormatFeatureBits(formatID2, fmt1OptimalFeatureBits);
 }
 
-void Renderer::cleanupGarbage(bool *anyGarbageCleanedOut)
+void Renderer::cleanupGarbage(bool *anyGarbageCleanedOut, vk::GarbageCleanupBudget budget)
 {
     bool anyCleaned = false;
 
-    // Clean up general garbage
-    anyCleaned = mSharedGarbageList.cleanupSubmittedGarbage(this) > 0 || anyCleaned;
+    // Clean up general garbage.  This is where most of the vkDestroy* and vkFreeMemory calls are
+    // made, so it is the only list bound by the per-frame budget.
+    anyCleaned = mSharedGarbageList.cleanupSubmittedGarbage(this, budget) > 0 || anyCleaned;
 
     // Clean up suballocation garbages
     anyCleaned = mSuballocationGarbageList.cleanupSubmittedGarbage(this) > 0 || anyCleaned;
@@ -7505,6 +8022,29 @@ void Renderer::cleanupGarbage(bool *anyGarbageCleanedOut)
     }
 }
 
+void Renderer::resetGarbageCleanupBudget(vk::ErrorContext *context)
+{
+    const size_t backlog = mSharedGarbageList.getSubmittedGarbageCount();
+    mSharedGarbageList.resetCleanupBudget(
+        std::max(kMinGarbageCleanupPerFrame, backlog / kGarbageBacklogFrameCount));
+
+    if (backlog == 0)
+    {
+        return;
+    }
+
+    // Garbage that didn't fit in the previous frame's budget is destroyed now, preferably off the
+    // application thread.
+    if (mFeatures.asyncGarbageCleanup.enabled)
+    {
+        requestAsyncCommandsAndGarbageCleanup(context);
+    }
+    else
+    {
+        cleanupGarbage(nullptr, vk::GarbageCleanupBudget::Limited);
+    }
+}
+
 void Renderer::cleanupPendingSubmissionGarbage()
 {
     // Check if pending garbage is still pending. If not, move them to the garbage list.
@@ -7780,6 +8320,14 @@ VkResult Renderer::queuePresent(vk::ErrorContext *context,
     if (getFeatures().logMemoryReportStats.enabled)
     {
         mMemoryReport.logMemoryReportStats();
+
+        VkDeviceSize smallImagePoolBlockBytes      = 0;
+        VkDeviceSize smallImagePoolAllocationBytes = 0;
+        mImageMemorySuballocator.getSmallImagePoolStats(this, &smallImagePoolBlockBytes,
+                                                        &smallImagePoolAllocationBytes);
+        mMemoryReport.logSmallImagePoolStats(smallImagePoolBlockBytes,
+                                             smallImagePoolAllocationBytes);
+        mMemoryReport.logLazilyAllocatedMemoryStats(mDevice);
     }
 
     return result;
@@ -7973,7 +8521,79 @@ const char *Renderer::GetVulkanObjectTypeName(VkObjectType type)
 ImageMemorySuballocator::ImageMemorySuballocator() {}
 ImageMemorySuballocator::~ImageMemorySuballocator() {}
 
-void ImageMemorySuballocator::destroy(Renderer *renderer) {}
+void ImageMemorySuballocator::destroy(Renderer *renderer)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mSmallImagePoolsMutex);
+    for (const auto &pool : mSmallImagePools)
+    {
+        vma::DestroyPool(renderer->getAllocator().getHandle(), pool.second);
+    }
+    mSmallImagePools.clear();
+}
+
+VmaPool ImageMemorySuballocator::getSmallImagePool(Renderer *renderer,
+                                                   uint32_t memoryTypeBits,
+                                                   VkMemoryPropertyFlags requiredFlags,
+                                                   VkMemoryPropertyFlags preferredFlags,
+                                                   VkDeviceSize alignment)
+{
+    const Allocator &allocator = renderer->getAllocator();
+
+    uint32_t memoryTypeIndex = 0;
+    if (vma::FindMemoryTypeIndex(allocator.getHandle(), memoryTypeBits, requiredFlags,
+                                 preferredFlags, &memoryTypeIndex) != VK_SUCCESS)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    // Lazily allocated memory is only committed when used, there is nothing to gain from packing
+    // it.
+    const VkMemoryPropertyFlags memoryFlags =
+        renderer->getMemoryProperties().getMemoryType(memoryTypeIndex).propertyFlags;
+    if ((memoryFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0)
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    // The alignment of a small image is not larger than its size.
+    ASSERT(alignment <= kSmallImageSizeThreshold);
+    const uint64_t key = (static_cast<uint64_t>(memoryTypeIndex) << 32) | alignment;
+
+    std::lock_guard<angle::SimpleMutex> lock(mSmallImagePoolsMutex);
+    auto iter = mSmallImagePools.find(key);
+    if (iter != mSmallImagePools.end())
+    {
+        return iter->second;
+    }
+
+    VmaPool pool = VK_NULL_HANDLE;
+    if (vma::CreateImagePool(allocator.getHandle(), memoryTypeIndex, kSmallImagePoolBlockSize,
+                             &pool) != VK_SUCCESS)
+    {
+        return VK_NULL_HANDLE;
+    }
+    mSmallImagePools[key] = pool;
+    return pool;
+}
+
+void ImageMemorySuballocator::getSmallImagePoolStats(Renderer *renderer,
+                                                     VkDeviceSize *blockBytesOut,
+                                                     VkDeviceSize *allocationBytesOut)
+{
+    *blockBytesOut      = 0;
+    *allocationBytesOut = 0;
+
+    std::lock_guard<angle::SimpleMutex> lock(mSmallImagePoolsMutex);
+    for (const auto &pool : mSmallImagePools)
+    {
+        VkDeviceSize blockBytes      = 0;
+        VkDeviceSize allocationBytes = 0;
+        vma::GetPoolStatistics(renderer->getAllocator().getHandle(), pool.second, &blockBytes,
+                               &allocationBytes);
+        *blockBytesOut += blockBytes;
+        *allocationBytesOut += allocationBytes;
+    }
+}
 
 VkResult ImageMemorySuballocator::allocateAndBindMemory(
     ErrorContext *context,
@@ -8014,10 +8634,32 @@ VkResult ImageMemorySuballocator::allocateAndBindMemory(
                                                                memoryRequirements->memoryTypeBits);
     }
 
+    VmaPool smallImagePool = VK_NULL_HANDLE;
+    if (renderer->getFeatures().useSmallImageMemoryPools.enabled && !allocateDedicatedMemory &&
+        imageCreateInfo->tiling == VK_IMAGE_TILING_OPTIMAL &&
+        memoryRequirements->size <= kSmallImageSizeThreshold)
+    {
+        smallImagePool = getSmallImagePool(renderer, memoryTypeBits, requiredFlags, preferredFlags,
+                                           memoryRequirements->alignment);
+    }
+
     // Allocate and bind memory for the image. Try allocating on the device first.
-    VkResult result = vma::AllocateAndBindMemoryForImage(
-        allocator.getHandle(), &image->mHandle, requiredFlags, preferredFlags, memoryTypeBits,
-        allocateDedicatedMemory, &allocationOut->mHandle, memoryTypeIndexOut, sizeOut);
+    VkResult result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    if (smallImagePool != VK_NULL_HANDLE)
+    {
+        result = vma::AllocateAndBindMemoryForImage(
+            allocator.getHandle(), &image->mHandle, requiredFlags, preferredFlags, memoryTypeBits,
+            false, smallImagePool, &allocationOut->mHandle, memoryTypeIndexOut, sizeOut);
+    }
+
+    // If the pool's memory type is out of memory, let VMA pick another memory type.
+    if (result != VK_SUCCESS)
+    {
+        result = vma::AllocateAndBindMemoryForImage(
+            allocator.getHandle(), &image->mHandle, requiredFlags, preferredFlags, memoryTypeBits,
+            allocateDedicatedMemory, VK_NULL_HANDLE, &allocationOut->mHandle, memoryTypeIndexOut,
+            sizeOut);
+    }
 
     // We need to get the property flags of the allocated memory if successful.
     if (result == VK_SUCCESS)
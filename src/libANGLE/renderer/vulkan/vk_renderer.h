@@ -93,6 +93,25 @@ class ImageMemorySuballocator : angle::NonCopyable
 
     // Determines if dedicated memory is required for the allocation.
     bool needsDedicatedMemory(VkDeviceSize size) const;
+
+    // Returns the total size of the blocks of the small image pools, and how much of it is used.
+    void getSmallImagePoolStats(vk::Renderer *renderer,
+                                VkDeviceSize *blockBytesOut,
+                                VkDeviceSize *allocationBytesOut);
+
+  private:
+    // Small optimal-tiling images are placed in pools of their own, one per memory type and
+    // alignment, so they are packed together instead of among the buffers and large images.
+    // Returns VK_NULL_HANDLE if the image should use the default VMA path.
+    VmaPool getSmallImagePool(vk::Renderer *renderer,
+                              uint32_t memoryTypeBits,
+                              VkMemoryPropertyFlags requiredFlags,
+                              VkMemoryPropertyFlags preferredFlags,
+                              VkDeviceSize alignment);
+
+    angle::SimpleMutex mSmallImagePoolsMutex;
+    // Keyed by the memory type index in the high bits and the alignment in the low bits.
+    angle::HashMap<uint64_t, VmaPool> mSmallImagePools;
 };
 
 // Supports one semaphore from current surface, and one semaphore passed to
@@ -210,6 +229,15 @@ class Renderer : angle::NonCopyable
         return mPhysicalDeviceFeatures;
     }
     const VkPhysicalDeviceFeatures2KHR &getEnabledFeatures() const { return mEnabledFeatures; }
+
+    // Whether ETC textures are stored as BC, either transcoded on upload by the CPU or with a
+    // compute shader.
+    bool isEtcToBcTranscodingEnabled() const
+    {
+        return !mPhysicalDeviceFeatures.textureCompressionETC2 &&
+               (mFeatures.transcodeEtcToBc.enabled ||
+                mFeatures.supportsComputeTranscodeEtcToBc.enabled);
+    }
     VkDevice getDevice() const { return mDevice; }
 
     const vk::Allocator &getAllocator() const { return mAllocator; }
@@ -263,9 +291,15 @@ class Renderer : angle::NonCopyable
                                                   size_t *pipelineCacheSizeOut,
                                                   size_t lastSyncSize,
                                                   std::vector<uint8_t> *pipelineCacheDataOut);
+    // Get the pipeline cache data if it has grown since it was last synced to the blob cache, and
+    // record its new size.  Takes the |mPipelineCacheMutex| lock, and may be called from a worker
+    // thread.  |pipelineCacheDataOut| is left empty if there is nothing new to sync.
+    angle::Result getPipelineCacheDataForSync(vk::ErrorContext *context,
+                                              std::vector<uint8_t> *pipelineCacheDataOut);
 
     const angle::FeaturesVk &getFeatures() const { return mFeatures; }
     uint32_t getMaxVertexAttribDivisor() const { return mMaxVertexAttribDivisor; }
+    uint32_t getMaxPushDescriptors() const { return mPushDescriptorProperties.maxPushDescriptors; }
     VkDeviceSize padVertexAttribBufferSizeIfNeeded(VkDeviceSize bufferSize);
     uint32_t getMaxColorInputAttachmentCount() const { return mMaxColorInputAttachmentCount; }
     ANGLE_INLINE bool isInFlightCommandsEmpty() const
@@ -434,8 +468,12 @@ class Renderer : angle::NonCopyable
 
     bool haveSameFormatFeatureBits(angle::FormatID formatID1, angle::FormatID formatID2) const;
 
-    void cleanupGarbage(bool *anyGarbageCleanedOut);
+    void cleanupGarbage(bool *anyGarbageCleanedOut,
+                        vk::GarbageCleanupBudget budget = vk::GarbageCleanupBudget::Unlimited);
     void cleanupPendingSubmissionGarbage();
+    // Refills the garbage cleanup budget at frame boundaries, and destroys garbage left over from
+    // the previous frame.
+    void resetGarbageCleanupBudget(vk::ErrorContext *context);
 
     angle::Result submitCommands(vk::ErrorContext *context,
                                  const vk::Semaphore *signalSemaphore,
@@ -595,6 +633,7 @@ class Renderer : angle::NonCopyable
 
     void addBufferBlockToOrphanList(vk::BufferBlock *block) { mOrphanedBufferBlockList.add(block); }
     SamplerCache &getSamplerCache() { return mSamplerCache; }
+    ShaderModuleCache &getShaderModuleCache() { return mShaderModuleCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
 
     VkDeviceSize getSuballocationDestroyedSize() const
@@ -615,6 +654,10 @@ class Renderer : angle::NonCopyable
     {
         return mSharedGarbageList.getUnsubmittedGarbageSize();
     }
+    size_t getSubmittedGarbageCount() const
+    {
+        return mSharedGarbageList.getSubmittedGarbageCount();
+    }
 
     ANGLE_INLINE VkFilter getPreferredFilterForYUV(VkFilter defaultFilter)
     {
@@ -662,6 +705,18 @@ class Renderer : angle::NonCopyable
                                                      reinterpret_cast<void *>(handle));
     }
 
+    template <typename HandleT>
+    void onLazilyAllocatedMemoryAlloc(HandleT handle, VkDeviceMemory memory, VkDeviceSize size)
+    {
+        mMemoryReport.onLazilyAllocatedMemoryAlloc(reinterpret_cast<void *>(handle), memory, size);
+    }
+
+    template <typename HandleT>
+    void onLazilyAllocatedMemoryDealloc(HandleT handle)
+    {
+        mMemoryReport.onLazilyAllocatedMemoryDealloc(reinterpret_cast<void *>(handle));
+    }
+
     MemoryAllocationTracker *getMemoryAllocationTracker() { return &mMemoryAllocationTracker; }
 
     VkDeviceSize getPendingGarbageSizeLimit() const { return mPendingGarbageSizeLimit; }
@@ -719,6 +774,10 @@ class Renderer : angle::NonCopyable
 
     angle::Result onFrameBoundary(const gl::Context *contextGL);
 
+    // Whether memory usage is close to the budget reported by VK_EXT_memory_budget.  When true,
+    // memory that is only cached for reuse is freed at frame boundaries.
+    bool isUnderMemoryBudgetPressure() const { return mIsUnderMemoryBudgetPressure; }
+
     uint32_t getMinRenderPassWriteCommandCountToEarlySubmit() const
     {
         return mMinRPWriteCommandCountToEarlySubmit;
@@ -786,6 +845,11 @@ class Renderer : angle::NonCopyable
                                     bool *success);
     angle::Result ensurePipelineCacheInitialized(vk::ErrorContext *context);
     angle::Result syncPipelineCacheVk(const gl::Context *contextGL);
+    void updateMemoryBudgetPressure(const gl::Context *contextGL);
+
+    // Load or store the snapshot of mFormatProperties kept in the blob cache.
+    bool loadFormatPropertiesFromBlobCache();
+    void storeFormatPropertiesInBlobCache() const;
 
     template <VkFormatFeatureFlags VkFormatProperties::*features>
     VkFormatFeatureFlags getFormatFeatureBits(angle::FormatID formatID,
@@ -806,6 +870,7 @@ class Renderer : angle::NonCopyable
     bool canSupportFoveatedRendering() const;
     // Prefer host visible device local via device local based on device type and heap size.
     bool canPreferDeviceLocalMemoryHostVisible(VkPhysicalDeviceType deviceType);
+    bool hasLargeDeviceLocalHostVisibleHeap();
 
     // Find the threshold for pending suballocation and image garbage sizes before the context
     // should be flushed.
@@ -882,6 +947,7 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceProtectedMemoryFeatures mProtectedMemoryFeatures;
     VkPhysicalDeviceHostQueryResetFeaturesEXT mHostQueryResetFeatures;
     VkPhysicalDeviceDepthClampZeroOneFeaturesEXT mDepthClampZeroOneFeatures;
+    VkPhysicalDeviceConditionalRenderingFeaturesEXT mConditionalRenderingFeatures;
     VkPhysicalDeviceDepthClipControlFeaturesEXT mDepthClipControlFeatures;
     VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT mBlendOperationAdvancedFeatures;
     VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT mPrimitivesGeneratedQueryFeatures;
@@ -891,6 +957,8 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceExtendedDynamicState2FeaturesEXT mExtendedDynamicState2Features;
     VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT mGraphicsPipelineLibraryFeatures;
     VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT mGraphicsPipelineLibraryProperties;
+    VkPhysicalDeviceShaderObjectFeaturesEXT mShaderObjectFeatures;
+    VkPhysicalDeviceExtendedDynamicState3FeaturesEXT mExtendedDynamicState3Features;
     VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT mVertexInputDynamicStateFeatures;
     VkPhysicalDeviceDynamicRenderingFeaturesKHR mDynamicRenderingFeatures;
     VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR mDynamicRenderingLocalReadFeatures;
@@ -941,6 +1009,7 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceTileMemoryHeapPropertiesQCOM mTileMemoryHeapProperties;
     VkPhysicalDeviceTextureCompressionASTC3DFeaturesEXT mTextureCompressionASTC3DFeatures;
     VkPhysicalDeviceShaderCorePropertiesAMD mShaderCorePropertiesAMD;
+    VkPhysicalDevicePushDescriptorPropertiesKHR mPushDescriptorProperties;
 
     uint32_t mLegacyDitheringVersion = 0;
 
@@ -969,6 +1038,7 @@ class Renderer : angle::NonCopyable
     vk::RefCountedEventRecycler mRefCountedEventRecycler;
 
     SamplerCache mSamplerCache;
+    ShaderModuleCache mShaderModuleCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
 
     VkDeviceSize mPendingGarbageSizeLimit;
@@ -1008,9 +1078,13 @@ class Renderer : angle::NonCopyable
     size_t mCurrentPipelineCacheBlobCacheSlotIndex;
     size_t mPipelineCacheChunkCount;
     uint32_t mPipelineCacheVkUpdateTimeout;
+    // Protected by |mPipelineCacheMutex|, as the pipeline cache may be synced from a worker thread.
     size_t mPipelineCacheSizeAtLastSync;
     std::atomic<bool> mPipelineCacheInitialized;
 
+    uint32_t mMemoryBudgetPollTimeout;
+    std::atomic<bool> mIsUnderMemoryBudgetPressure;
+
     // Latest validation data for debug overlay.
     std::string mLastValidationMessage;
     uint32_t mValidationMessageCount;
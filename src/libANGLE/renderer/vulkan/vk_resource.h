@@ -15,6 +15,7 @@
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+#include <limits>
 #include <queue>
 
 namespace rx
@@ -65,6 +66,8 @@ class ResourceUse final
 
     void reset() { mSerials.clear(); }
 
+    bool operator==(const ResourceUse &other) const { return mSerials == other.mSerials; }
+
     const Serials &getSerials() const { return mSerials; }
 
     void setSerial(SerialIndex index, Serial serial)
@@ -174,6 +177,14 @@ class SharedGarbage final : angle::NonCopyable
     GarbageObjects mGarbage;
 };
 
+// Whether a cleanup of submitted garbage is bound by the budget of the garbage list, which limits
+// the number of objects destroyed per frame.  Cleanups done to recover memory ignore the budget.
+enum class GarbageCleanupBudget
+{
+    Unlimited,
+    Limited,
+};
+
 // SharedGarbageList list tracks garbage using angle::FixedQueue. It allows concurrent add (i.e.,
 // enqueue) and cleanup (i.e. dequeue) operations from two threads. Add call from two threads are
 // synchronized using a mutex and cleanup call from two threads are synchronized with a separate
@@ -187,7 +198,8 @@ class SharedGarbageList final : angle::NonCopyable
           mUnsubmittedQueue(kInitialQueueCapacity),
           mTotalSubmittedGarbageBytes(0),
           mTotalUnsubmittedGarbageBytes(0),
-          mTotalGarbageDestroyed(0)
+          mTotalGarbageDestroyed(0),
+          mCleanupBudget(std::numeric_limits<size_t>::max())
     {}
     ~SharedGarbageList()
     {
@@ -234,13 +246,27 @@ class SharedGarbageList final : angle::NonCopyable
         return mTotalGarbageDestroyed.load(std::memory_order_consume);
     }
     void resetDestroyedGarbageSize() { mTotalGarbageDestroyed = 0; }
+    size_t getSubmittedGarbageCount() const { return mSubmittedQueue.size(); }
+
+    // Sets the number of garbage that can be destroyed by limited cleanups until the next call.
+    void resetCleanupBudget(size_t budget)
+    {
+        std::unique_lock<angle::SimpleMutex> lock(mSubmittedQueueDequeueMutex);
+        mCleanupBudget = budget;
+    }
 
     // Number of bytes destroyed is returned.
-    VkDeviceSize cleanupSubmittedGarbage(Renderer *renderer)
+    VkDeviceSize cleanupSubmittedGarbage(
+        Renderer *renderer,
+        GarbageCleanupBudget budget = GarbageCleanupBudget::Unlimited)
     {
         std::unique_lock<angle::SimpleMutex> lock(mSubmittedQueueDequeueMutex);
         VkDeviceSize bytesDestroyed = 0;
-        while (!mSubmittedQueue.empty())
+        size_t garbageDestroyed     = 0;
+        const size_t maxGarbageToDestroy =
+            budget == GarbageCleanupBudget::Limited ? mCleanupBudget
+                                                    : std::numeric_limits<size_t>::max();
+        while (!mSubmittedQueue.empty() && garbageDestroyed < maxGarbageToDestroy)
         {
             T &garbage        = mSubmittedQueue.front();
             VkDeviceSize size = garbage.getSize();
@@ -249,8 +275,10 @@ class SharedGarbageList final : angle::NonCopyable
                 break;
             }
             bytesDestroyed += size;
+            ++garbageDestroyed;
             mSubmittedQueue.pop();
         }
+        mCleanupBudget -= std::min(mCleanupBudget, garbageDestroyed);
         mTotalSubmittedGarbageBytes -= bytesDestroyed;
         mTotalGarbageDestroyed += bytesDestroyed;
         return bytesDestroyed;
@@ -315,6 +343,9 @@ class SharedGarbageList final : angle::NonCopyable
     std::atomic<VkDeviceSize> mTotalUnsubmittedGarbageBytes;
     // Total bytes of garbage been destroyed since last resetDestroyedGarbageSize call.
     std::atomic<VkDeviceSize> mTotalGarbageDestroyed;
+    // Number of garbage that limited cleanups can still destroy.  Protected by
+    // mSubmittedQueueDequeueMutex.
+    size_t mCleanupBudget;
 };
 
 // This is a helper class for back-end objects used in Vk command buffers. They keep a record
@@ -795,6 +795,13 @@ angle::Result InitExternalHostMemory(ErrorContext *context,
     ANGLE_TRY(
         GetHostPointerMemoryRequirements(context, hostPtr, externalMemoryRequirements, buffer));
 
+    // The size of imported host memory must be a multiple of minImportedHostPointerAlignment.
+    externalMemoryRequirements.size =
+        roundUp(externalMemoryRequirements.size,
+                context->getRenderer()
+                    ->getPhysicalDeviceExternalMemoryHostProperties()
+                    .minImportedHostPointerAlignment);
+
     // Import memory from a host pointer by using VK_EXT_external_memory_host extension
     VkImportMemoryHostPointerInfoEXT importInfo = {};
     importInfo.sType        = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
@@ -1133,6 +1140,10 @@ PFN_vkGetDeviceFaultInfoEXT vkGetDeviceFaultInfoEXT = nullptr;
 // VK_EXT_host_query_reset
 PFN_vkResetQueryPoolEXT vkResetQueryPoolEXT = nullptr;
 
+// VK_EXT_conditional_rendering
+PFN_vkCmdBeginConditionalRenderingEXT vkCmdBeginConditionalRenderingEXT = nullptr;
+PFN_vkCmdEndConditionalRenderingEXT vkCmdEndConditionalRenderingEXT     = nullptr;
+
 // VK_EXT_transform_feedback
 PFN_vkCmdBindTransformFeedbackBuffersEXT vkCmdBindTransformFeedbackBuffersEXT = nullptr;
 PFN_vkCmdBeginTransformFeedbackEXT vkCmdBeginTransformFeedbackEXT             = nullptr;
@@ -1156,6 +1167,9 @@ PFN_vkGetImageSubresourceLayout2KHR vkGetImageSubresourceLayout2KHR = nullptr;
 // VK_QCOM_tile_memory_heap
 PFN_vkCmdBindTileMemoryQCOM vkCmdBindTileMemoryQCOM = nullptr;
 
+// VK_KHR_push_descriptor
+PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
 // VK_KHR_external_fence_capabilities
 PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR vkGetPhysicalDeviceExternalFencePropertiesKHR =
     nullptr;
@@ -1224,6 +1238,9 @@ PFN_vkCmdSetPatchControlPointsEXT vkCmdSetPatchControlPointsEXT           = null
 PFN_vkCmdSetPrimitiveRestartEnableEXT vkCmdSetPrimitiveRestartEnableEXT   = nullptr;
 PFN_vkCmdSetRasterizerDiscardEnableEXT vkCmdSetRasterizerDiscardEnableEXT = nullptr;
 
+// VK_EXT_extended_dynamic_state3
+PFN_vkCmdSetColorBlendEquationEXT vkCmdSetColorBlendEquationEXT = nullptr;
+
 // VK_EXT_vertex_input_dynamic_state
 PFN_vkCmdSetVertexInputEXT vkCmdSetVertexInputEXT = nullptr;
 
@@ -1263,6 +1280,10 @@ PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT = nu
 // VK_KHR_buffer_device_address
 PFN_vkGetBufferDeviceAddressKHR vkGetBufferDeviceAddressKHR = nullptr;
 
+// VK_KHR_timeline_semaphore
+PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR                     = nullptr;
+
 void InitDebugUtilsEXTFunctions(VkInstance instance)
 {
     GET_INSTANCE_FUNC(vkCreateDebugUtilsMessengerEXT);
@@ -1319,6 +1340,12 @@ void InitHostQueryResetFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkResetQueryPoolEXT);
 }
 
+void InitConditionalRenderingEXTFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdBeginConditionalRenderingEXT);
+    GET_DEVICE_FUNC(vkCmdEndConditionalRenderingEXT);
+}
+
 // VK_KHR_external_fence_fd
 void InitExternalFenceFdFunctions(VkDevice device)
 {
@@ -1359,6 +1386,12 @@ void InitExtendedDynamicState2EXTFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdSetRasterizerDiscardEnableEXT);
 }
 
+// VK_EXT_extended_dynamic_state3
+void InitExtendedDynamicState3EXTFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdSetColorBlendEquationEXT);
+}
+
 // VK_EXT_vertex_input_dynamic_state
 void InitVertexInputDynamicStateEXTFunctions(VkDevice device)
 {
@@ -1403,6 +1436,12 @@ void InitTileMemoryHeapFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdBindTileMemoryQCOM);
 }
 
+// VK_KHR_push_descriptor
+void InitPushDescriptorFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdPushDescriptorSetKHR);
+}
+
 // VK_GOOGLE_display_timing
 void InitGetPastPresentationTimingGoogleFunction(VkDevice device)
 {
@@ -1447,6 +1486,12 @@ void InitBufferDeviceAddressFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkGetBufferDeviceAddressKHR);
 }
 
+void InitTimelineSemaphoreFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetSemaphoreCounterValueKHR);
+    GET_DEVICE_FUNC(vkWaitSemaphoresKHR);
+}
+
 #    undef GET_INSTANCE_FUNC
 #    undef GET_DEVICE_FUNC
 
@@ -396,7 +396,8 @@ class GlobalOps : angle::NonCopyable
     virtual bool getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut)  = 0;
 
     virtual std::shared_ptr<angle::WaitableEvent> postMultiThreadWorkerTask(
-        const std::shared_ptr<angle::Closure> &task) = 0;
+        const std::shared_ptr<angle::Closure> &task,
+        angle::WorkerTaskPriority priority) = 0;
 
     virtual void notifyDeviceLost() = 0;
 
@@ -1211,7 +1212,9 @@ class Recycler final : angle::NonCopyable
 };
 
 
-using ShaderModulePtr = SharedPtr<ShaderModule>;
+// Shader modules are shared between programs through the renderer's ShaderModuleCache, and may be
+// created and released by link jobs.
+using ShaderModulePtr = AtomicSharedPtr<ShaderModule>;
 using ShaderModuleMap = gl::ShaderMap<ShaderModulePtr>;
 
 angle::Result InitShaderModule(ErrorContext *context,
@@ -1427,7 +1430,10 @@ enum class PipelineStage : uint32_t
     // Host specific pipeline stage
     Host = 16,
 
-    InvalidEnum = 17,
+    // VK_EXT_conditional_rendering predicate read
+    ConditionalRendering = 17,
+
+    InvalidEnum = 18,
     EnumCount   = InvalidEnum,
 };
 using PipelineStagesMask = angle::PackedEnumBitSet<PipelineStage, uint32_t>;
@@ -1460,6 +1466,9 @@ void InitDeviceFaultFunctions(VkDevice device);
 // VK_EXT_host_query_reset
 void InitHostQueryResetFunctions(VkDevice device);
 
+// VK_EXT_conditional_rendering
+void InitConditionalRenderingEXTFunctions(VkDevice device);
+
 // VK_KHR_external_fence_fd
 void InitExternalFenceFdFunctions(VkDevice device);
 
@@ -1472,6 +1481,9 @@ void InitExtendedDynamicStateEXTFunctions(VkDevice device);
 // VK_EXT_extended_dynamic_state2
 void InitExtendedDynamicState2EXTFunctions(VkDevice device);
 
+// VK_EXT_extended_dynamic_state3
+void InitExtendedDynamicState3EXTFunctions(VkDevice device);
+
 // VK_EXT_vertex_input_dynamic_state
 void InitVertexInputDynamicStateEXTFunctions(VkDevice device);
 
@@ -1491,6 +1503,9 @@ void InitMaintenance5Functions(VkDevice device);
 // VK_QCOM_tile_memory_heap
 void InitTileMemoryHeapFunctions(VkDevice device);
 
+// VK_KHR_push_descriptor
+void InitPushDescriptorFunctions(VkDevice device);
+
 // VK_GOOGLE_display_timing
 void InitGetPastPresentationTimingGoogleFunction(VkDevice device);
 
@@ -1512,6 +1527,9 @@ void InitExternalMemoryHostFunctions(VkDevice device);
 // VK_KHR_buffer_device_address
 void InitBufferDeviceAddressFunctions(VkDevice device);
 
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreFunctions(VkDevice device);
+
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
 // Promoted to Vulkan 1.1
@@ -1665,6 +1683,7 @@ enum class RenderPassClosureReason
     EndNonRenderPassQuery,
     TimestampQuery,
     EndRenderPassQuery,
+    ConditionalRenderingQueryCopy,
 
     // Synchronization
     BufferUseThenReleaseToExternal,
@@ -1684,6 +1703,7 @@ enum class RenderPassClosureReason
     CopyTextureOnCPU,
     TextureReformatToRenderable,
     OutOfReservedQueueSerialForOutsideCommands,
+    RenderAreaGrowthAfterScissoredClear,
 
     // VK_QCOM_tile_memory_heap
     TileMemorySimulatedClear,
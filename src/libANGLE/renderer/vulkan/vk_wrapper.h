@@ -287,6 +287,14 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                    uint32_t regionCount,
                    const VkImageCopy *regions);
 
+    void copyQueryPoolResults(const QueryPool &queryPool,
+                              uint32_t firstQuery,
+                              uint32_t queryCount,
+                              VkBuffer dstBuffer,
+                              VkDeviceSize dstOffset,
+                              VkDeviceSize stride,
+                              VkQueryResultFlags flags);
+
     void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
     void dispatchIndirect(const Buffer &buffer, VkDeviceSize offset);
 
@@ -364,7 +372,16 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                        uint32_t size,
                        const void *data);
 
+    void pushDescriptorSet(const PipelineLayout &layout,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           DescriptorSetIndex set,
+                           uint32_t descriptorWriteCount,
+                           const VkWriteDescriptorSet *descriptorWrites);
+
     void setBlendConstants(const float blendConstants[4]);
+    void setColorBlendEquation(uint32_t firstAttachment,
+                               uint32_t attachmentCount,
+                               const VkColorBlendEquationEXT *colorBlendEquations);
     void setCullMode(VkCullModeFlags cullMode);
     void setDepthBias(float depthBiasConstantFactor,
                       float depthBiasClamp,
@@ -442,6 +459,10 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                                       const VkDeviceSize *offsets,
                                       const VkDeviceSize *sizes);
 
+    // VK_EXT_conditional_rendering
+    void beginConditionalRendering(const VkConditionalRenderingBeginInfoEXT &beginInfo);
+    void endConditionalRendering();
+
     // VK_EXT_debug_utils
     void beginDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT &labelInfo);
     void endDebugUtilsLabelEXT();
@@ -967,8 +988,8 @@ ANGLE_INLINE void CommandBuffer::copyBufferToImage(VkBuffer srcBuffer,
 {
     ASSERT(valid() && dstImage.valid());
     ASSERT(srcBuffer != VK_NULL_HANDLE);
-    ASSERT(regionCount == 1);
-    vkCmdCopyBufferToImage(mHandle, srcBuffer, dstImage.getHandle(), dstImageLayout, 1, regions);
+    vkCmdCopyBufferToImage(mHandle, srcBuffer, dstImage.getHandle(), dstImageLayout, regionCount,
+                           regions);
 }
 
 ANGLE_INLINE void CommandBuffer::copyImageToBuffer(const Image &srcImage,
@@ -979,8 +1000,22 @@ ANGLE_INLINE void CommandBuffer::copyImageToBuffer(const Image &srcImage,
 {
     ASSERT(valid() && srcImage.valid());
     ASSERT(dstBuffer != VK_NULL_HANDLE);
-    ASSERT(regionCount == 1);
-    vkCmdCopyImageToBuffer(mHandle, srcImage.getHandle(), srcImageLayout, dstBuffer, 1, regions);
+    vkCmdCopyImageToBuffer(mHandle, srcImage.getHandle(), srcImageLayout, dstBuffer, regionCount,
+                           regions);
+}
+
+ANGLE_INLINE void CommandBuffer::copyQueryPoolResults(const QueryPool &queryPool,
+                                                      uint32_t firstQuery,
+                                                      uint32_t queryCount,
+                                                      VkBuffer dstBuffer,
+                                                      VkDeviceSize dstOffset,
+                                                      VkDeviceSize stride,
+                                                      VkQueryResultFlags flags)
+{
+    ASSERT(valid() && queryPool.valid());
+    ASSERT(dstBuffer != VK_NULL_HANDLE);
+    vkCmdCopyQueryPoolResults(mHandle, queryPool.getHandle(), firstQuery, queryCount, dstBuffer,
+                              dstOffset, stride, flags);
 }
 
 ANGLE_INLINE void CommandBuffer::clearColorImage(const Image &image,
@@ -1118,12 +1153,34 @@ ANGLE_INLINE void CommandBuffer::pushConstants(const PipelineLayout &layout,
     vkCmdPushConstants(mHandle, layout.getHandle(), flag, offset, size, data);
 }
 
+ANGLE_INLINE void CommandBuffer::pushDescriptorSet(const PipelineLayout &layout,
+                                                   VkPipelineBindPoint pipelineBindPoint,
+                                                   DescriptorSetIndex set,
+                                                   uint32_t descriptorWriteCount,
+                                                   const VkWriteDescriptorSet *descriptorWrites)
+{
+    ASSERT(valid() && layout.valid());
+    ASSERT(vkCmdPushDescriptorSetKHR);
+    vkCmdPushDescriptorSetKHR(mHandle, pipelineBindPoint, layout.getHandle(), ToUnderlying(set),
+                              descriptorWriteCount, descriptorWrites);
+}
+
 ANGLE_INLINE void CommandBuffer::setBlendConstants(const float blendConstants[4])
 {
     ASSERT(valid());
     vkCmdSetBlendConstants(mHandle, blendConstants);
 }
 
+ANGLE_INLINE void CommandBuffer::setColorBlendEquation(
+    uint32_t firstAttachment,
+    uint32_t attachmentCount,
+    const VkColorBlendEquationEXT *colorBlendEquations)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdSetColorBlendEquationEXT);
+    vkCmdSetColorBlendEquationEXT(mHandle, firstAttachment, attachmentCount, colorBlendEquations);
+}
+
 ANGLE_INLINE void CommandBuffer::setCullMode(VkCullModeFlags cullMode)
 {
     ASSERT(valid());
@@ -1525,6 +1582,21 @@ ANGLE_INLINE void CommandBuffer::bindTransformFeedbackBuffers(uint32_t firstBind
                                          sizes);
 }
 
+ANGLE_INLINE void CommandBuffer::beginConditionalRendering(
+    const VkConditionalRenderingBeginInfoEXT &beginInfo)
+{
+    ASSERT(valid());
+    ASSERT(vkCmdBeginConditionalRenderingEXT);
+    vkCmdBeginConditionalRenderingEXT(mHandle, &beginInfo);
+}
+
+ANGLE_INLINE void CommandBuffer::endConditionalRendering()
+{
+    ASSERT(valid());
+    ASSERT(vkCmdEndConditionalRenderingEXT);
+    vkCmdEndConditionalRenderingEXT(mHandle);
+}
+
 ANGLE_INLINE void CommandBuffer::beginDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT &labelInfo)
 {
     ASSERT(valid());
@@ -92,9 +92,11 @@ angle::Result BufferWgpu::setData(const gl::Context *context,
     bool hasData = dataForImpl && size > 0;
 
     // Allocate a new buffer if the current one is invalid, the size is different, or the current
-    // buffer cannot be mapped for writing when data needs to be uploaded.
+    // buffer is not already mapped when data needs to be uploaded.  The whole contents are
+    // replaced, so a new buffer mapped at creation avoids waiting for the GPU to be done with the
+    // current one.
     if (!mBuffer.valid() || mBuffer.requestedSize() != size ||
-        (hasData && !mBuffer.canMapForWrite()))
+        (hasData && !mBuffer.isMappedForWrite()))
     {
         // Allocate a new buffer
         ANGLE_TRY(mBuffer.initBuffer(wgpu, device, size,
@@ -104,12 +106,7 @@ angle::Result BufferWgpu::setData(const gl::Context *context,
 
     if (hasData)
     {
-        ASSERT(mBuffer.canMapForWrite());
-
-        if (!mBuffer.getMappedState().has_value())
-        {
-            ANGLE_TRY(mBuffer.mapImmediate(contextWgpu, WGPUMapMode_Write, 0, size));
-        }
+        ASSERT(mBuffer.isMappedForWrite());
 
         uint8_t *mappedData = mBuffer.getMapWritePointer(0, size);
         memcpy(mappedData, dataForImpl, size);
@@ -125,7 +122,8 @@ angle::Result BufferWgpu::setSubData(const gl::Context *context,
                                      size_t offset,
                                      BufferFeedback *feedback)
 {
-    ContextWgpu *contextWgpu = webgpu::GetImpl(context);
+    ContextWgpu *contextWgpu  = webgpu::GetImpl(context);
+    const DawnProcTable *wgpu = webgpu::GetProcs(context);
 
     ASSERT(mBuffer.valid());
     if (mBuffer.canMapForWrite())
@@ -138,11 +136,29 @@ angle::Result BufferWgpu::setSubData(const gl::Context *context,
         uint8_t *mappedData = mBuffer.getMapWritePointer(offset, size);
         memcpy(mappedData, data, size);
     }
+    else if (offset % webgpu::kBufferCopyToBufferAlignment == 0 &&
+             size % webgpu::kBufferCopyToBufferAlignment == 0)
+    {
+        // Write into staging memory and copy it to the buffer in the command encoder, so the
+        // update is ordered after the commands already recorded without waiting for the GPU.
+        uint8_t *stagingData = nullptr;
+        webgpu::BufferHandle stagingBuffer;
+        size_t stagingOffset = 0;
+        ANGLE_TRY(contextWgpu->getStagingBufferRing()->allocate(contextWgpu, size, &stagingData,
+                                                                &stagingBuffer, &stagingOffset));
+        memcpy(stagingData, data, size);
+
+        webgpu::CommandEncoderHandle commandEncoder;
+        ANGLE_TRY(contextWgpu->getCurrentCommandEncoder(
+            webgpu::RenderPassClosureReason::BufferSubData, &commandEncoder));
+        wgpu->commandEncoderCopyBufferToBuffer(commandEncoder.get(), stagingBuffer.get(),
+                                               stagingOffset, mBuffer.getBuffer().get(), offset,
+                                               size);
+    }
     else
     {
-        const DawnProcTable *wgpu = webgpu::GetProcs(context);
-        // TODO: Upload into a staging buffer and copy to the destination buffer so that the copy
-        // happens at the right point in time for command buffer recording.
+        // TODO: Handle updates that are not aligned for buffer copies in the staging path too, so
+        // that they happen at the right point in time for command buffer recording.
         webgpu::QueueHandle queue = contextWgpu->getQueue();
         wgpu->queueWriteBuffer(queue.get(), mBuffer.getBuffer().get(), offset, data, size);
     }
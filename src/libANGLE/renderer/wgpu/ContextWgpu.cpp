@@ -72,6 +72,8 @@ constexpr angle::PackedEnumMap<webgpu::RenderPassClosureReason, const char *>
         {webgpu::RenderPassClosureReason::CopyImage, "Render pass closed to copy image"},
         {webgpu::RenderPassClosureReason::ClearWithDraw,
          "Render pass closed to clear with a draw call (e.g. for scissored or masked clears)"},
+        {webgpu::RenderPassClosureReason::BufferSubData,
+         "Render pass closed to copy staged buffer data"},
     }};
 
 }  // namespace
@@ -97,6 +99,7 @@ ContextWgpu::~ContextWgpu() {}
 void ContextWgpu::onDestroy(const gl::Context *context)
 {
     mImageLoadContext = {};
+    mStagingBufferRing.destroy();
 }
 
 angle::Result ContextWgpu::initialize(const angle::ImageLoadContext &imageLoadContext)
@@ -158,7 +161,9 @@ angle::Result ContextWgpu::flush(webgpu::RenderPassClosureReason closureReason)
             wgpu, wgpu->commandEncoderFinish(mCurrentCommandEncoder.get(), nullptr));
         mCurrentCommandEncoder            = nullptr;
 
+        mStagingBufferRing.onBeforeSubmit();
         wgpu->queueSubmit(getQueue().get(), 1, &commandBuffer.get());
+        mStagingBufferRing.onAfterSubmit();
     }
 
     return angle::Result::Continue;
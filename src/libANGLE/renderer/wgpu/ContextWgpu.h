@@ -343,6 +343,7 @@ class ContextWgpu : public ContextImpl
     }
 
     webgpu::UtilsWgpu *getUtils() { return &mUtils; }
+    webgpu::StagingBufferRing *getStagingBufferRing() { return &mStagingBufferRing; }
     webgpu::CommandBuffer &getCommandBuffer() { return mCommandBuffer; }
 
   private:
@@ -443,6 +444,9 @@ class ContextWgpu : public ContextImpl
     webgpu::BindGroupHandle mDriverUniformsBindGroup;
 
     webgpu::UtilsWgpu mUtils;
+
+    // Source of the staging memory for buffer updates recorded in mCurrentCommandEncoder.
+    webgpu::StagingBufferRing mStagingBufferRing;
 };
 
 }  // namespace rx
@@ -107,6 +107,8 @@ egl::Error DisplayWgpu::initialize(egl::Display *display)
 
 void DisplayWgpu::terminate()
 {
+    mShaderModuleCache.clear();
+
     mAdapter  = nullptr;
     mInstance = nullptr;
     mDevice   = nullptr;
@@ -347,6 +349,14 @@ ShareGroupImpl *DisplayWgpu::createShareGroup(const egl::ShareGroupState &state)
     return new ShareGroupWgpu(state);
 }
 
+void DisplayWgpu::initializeFrontendFeatures(angle::FrontendFeatures *features) const
+{
+    // The translated WGSL and reflection data are entirely held in the front-end's compiled shader
+    // state, so compiled shaders can be cached in the blob cache and loaded back without
+    // involving the translator.
+    ANGLE_FEATURE_CONDITION(features, cacheCompiledShader, true);
+}
+
 void DisplayWgpu::populateFeatureList(angle::FeatureList *features)
 {
     mFeatures.populateFeatureList(features);
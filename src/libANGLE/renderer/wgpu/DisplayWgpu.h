@@ -15,6 +15,7 @@
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "libANGLE/renderer/ShareGroupImpl.h"
 #include "libANGLE/renderer/wgpu/wgpu_format_utils.h"
+#include "libANGLE/renderer/wgpu/wgpu_pipeline_state.h"
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 #include "platform/autogen/FeaturesWgpu_autogen.h"
 
@@ -102,6 +103,8 @@ class DisplayWgpu : public DisplayImpl
 
     ShareGroupImpl *createShareGroup(const egl::ShareGroupState &state) override;
 
+    void initializeFrontendFeatures(angle::FrontendFeatures *features) const override;
+
     void populateFeatureList(angle::FeatureList *features) override;
 
     angle::NativeWindowSystem getWindowSystem() const override;
@@ -113,6 +116,8 @@ class DisplayWgpu : public DisplayImpl
     webgpu::QueueHandle getQueue() { return mQueue; }
     webgpu::InstanceHandle getInstance() { return mInstance; }
 
+    webgpu::ShaderModuleCache *getShaderModuleCache() { return &mShaderModuleCache; }
+
     const WGPULimits &getLimitsWgpu() const { return mLimitsWgpu; }
 
     const gl::Caps &getGLCaps() const { return mGLCaps; }
@@ -160,6 +165,8 @@ class DisplayWgpu : public DisplayImpl
 
     webgpu::FormatTable mFormatTable;
 
+    webgpu::ShaderModuleCache mShaderModuleCache;
+
     angle::FeaturesWgpu mFeatures;
 };
 
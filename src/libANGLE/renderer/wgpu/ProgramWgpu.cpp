@@ -20,6 +20,7 @@
 #include "common/log_utils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/ProgramExecutable.h"
+#include "libANGLE/renderer/wgpu/DisplayWgpu.h"
 #include "libANGLE/renderer/wgpu/ProgramExecutableWgpu.h"
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 #include "libANGLE/renderer/wgpu/wgpu_wgsl_util.h"
@@ -98,6 +99,7 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
                                webgpu::InstanceHandle instance,
                                webgpu::DeviceHandle device,
                                const angle::FeaturesWgpu &features,
+                               webgpu::ShaderModuleCache *shaderModuleCache,
                                const gl::SharedCompiledShaderState &compiledShaderState,
                                const gl::ProgramExecutable &executable,
                                gl::ProgramMergedVaryings mergedVaryings,
@@ -106,6 +108,7 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
           mInstance(instance),
           mDevice(device),
           mFeatures(features),
+          mShaderModuleCache(shaderModuleCache),
           mCompiledShaderState(compiledShaderState),
           mExecutable(executable),
           mMergedVaryings(std::move(mergedVaryings)),
@@ -149,6 +152,13 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
             std::cout << finalShaderSource;
         }
 
+        // Modules are only cached once their compilation has been checked, so a hit can skip it.
+        mShaderModule.module = mShaderModuleCache->get(finalShaderSource);
+        if (mShaderModule.module)
+        {
+            return;
+        }
+
         WGPUShaderSourceWGSL shaderModuleWGSLDescriptor = WGPU_SHADER_SOURCE_WGSL_INIT;
         shaderModuleWGSLDescriptor.code = {finalShaderSource.c_str(), finalShaderSource.length()};
 
@@ -246,6 +256,11 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
                 mResult = angle::Result::Stop;
             }
         }
+
+        if (mResult == angle::Result::Continue)
+        {
+            mShaderModuleCache->insert(finalShaderSource, mShaderModule.module);
+        }
     }
 
   private:
@@ -253,6 +268,7 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
     webgpu::InstanceHandle mInstance;
     webgpu::DeviceHandle mDevice;
     const angle::FeaturesWgpu &mFeatures;
+    webgpu::ShaderModuleCache *mShaderModuleCache;
     gl::SharedCompiledShaderState mCompiledShaderState;
     const gl::ProgramExecutable &mExecutable;
     gl::ProgramMergedVaryings mMergedVaryings;
@@ -270,11 +286,13 @@ class LinkTaskWgpu : public LinkTask
                  webgpu::InstanceHandle instance,
                  webgpu::DeviceHandle device,
                  const angle::FeaturesWgpu &features,
+                 webgpu::ShaderModuleCache *shaderModuleCache,
                  ProgramWgpu *program)
         : mProcTable(wgpu),
           mInstance(instance),
           mDevice(device),
           mFeatures(features),
+          mShaderModuleCache(shaderModuleCache),
           mProgram(program),
           mExecutable(&mProgram->getState().getExecutable())
     {}
@@ -298,7 +316,8 @@ class LinkTaskWgpu : public LinkTask
             if (shaders[shaderType])
             {
                 auto task = std::make_shared<CreateWGPUShaderModuleTask>(
-                    mProcTable, mInstance, mDevice, mFeatures, shaders[shaderType],
+                    mProcTable, mInstance, mDevice, mFeatures, mShaderModuleCache,
+                    shaders[shaderType],
                     *executable->getExecutable(), mergedVaryings,
                     executable->getShaderModule(shaderType));
                 linkSubTasksOut->push_back(task);
@@ -415,6 +434,7 @@ class LinkTaskWgpu : public LinkTask
     webgpu::InstanceHandle mInstance;
     webgpu::DeviceHandle mDevice;
     const angle::FeaturesWgpu &mFeatures;
+    webgpu::ShaderModuleCache *mShaderModuleCache;
     ProgramWgpu *mProgram = nullptr;
     const gl::ProgramExecutable *mExecutable;
     angle::Result mLinkResult = angle::Result::Stop;
@@ -447,9 +467,11 @@ angle::Result ProgramWgpu::link(const gl::Context *context, std::shared_ptr<Link
     const angle::FeaturesWgpu &features = webgpu::GetFeatures(context);
     webgpu::DeviceHandle device     = webgpu::GetDevice(context);
     webgpu::InstanceHandle instance = webgpu::GetInstance(context);
+    webgpu::ShaderModuleCache *shaderModuleCache =
+        webgpu::GetDisplay(context)->getShaderModuleCache();
 
-    *linkTaskOut =
-        std::shared_ptr<LinkTask>(new LinkTaskWgpu(wgpu, instance, device, features, this));
+    *linkTaskOut = std::shared_ptr<LinkTask>(
+        new LinkTaskWgpu(wgpu, instance, device, features, shaderModuleCache, this));
     return angle::Result::Continue;
 }
 
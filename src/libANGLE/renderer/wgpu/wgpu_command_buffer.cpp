@@ -19,10 +19,15 @@ namespace
 const bool kLogCommandRecording = false;
 
 template <typename T>
-T::ObjectType GetReferencedObject(std::unordered_set<T> &referenceList, const T &item)
+T::ObjectType GetReferencedObject(std::vector<T> *referenceList, const T &item)
 {
-    auto iter = referenceList.insert(item).first;
-    return (*iter).get();
+    // Draws tend to reuse the objects of the previous draw, so only adjacent duplicates are
+    // filtered out.  Any remaining duplicates just hold an extra reference until clear().
+    if (referenceList->empty() || referenceList->back() != item)
+    {
+        referenceList->push_back(item);
+    }
+    return item.get();
 }
 
 // Get the packed command ID from the current command data
@@ -143,9 +148,18 @@ void CommandBuffer::drawIndexed(uint32_t indexCount,
 
 void CommandBuffer::setBindGroup(uint32_t groupIndex, BindGroupHandle bindGroup)
 {
+    if (groupIndex < kMaxTrackedBindGroups)
+    {
+        if (mState.boundBindGroups[groupIndex] == bindGroup.get())
+        {
+            return;
+        }
+        mState.boundBindGroups[groupIndex] = bindGroup.get();
+    }
+
     SetBindGroupCommand *setBindGroupCommand = initCommand<CommandID::SetBindGroup>();
     setBindGroupCommand->groupIndex          = groupIndex;
-    setBindGroupCommand->bindGroup = GetReferencedObject(mState.referencedBindGroups, bindGroup);
+    setBindGroupCommand->bindGroup = GetReferencedObject(&mReferencedBindGroups, bindGroup);
 }
 
 void CommandBuffer::setBlendConstant(float r, float g, float b, float a)
@@ -161,8 +175,14 @@ void CommandBuffer::setBlendConstant(float r, float g, float b, float a)
 
 void CommandBuffer::setPipeline(RenderPipelineHandle pipeline)
 {
+    if (mState.boundPipeline == pipeline.get())
+    {
+        return;
+    }
+    mState.boundPipeline = pipeline.get();
+
     SetPipelineCommand *setPiplelineCommand = initCommand<CommandID::SetPipeline>();
-    setPiplelineCommand->pipeline = GetReferencedObject(mState.referencedRenderPipelines, pipeline);
+    setPiplelineCommand->pipeline = GetReferencedObject(&mReferencedRenderPipelines, pipeline);
 }
 
 void CommandBuffer::setScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -208,8 +228,19 @@ void CommandBuffer::setIndexBuffer(BufferHandle buffer,
                                    uint64_t offset,
                                    uint64_t size)
 {
+    IndexBufferBinding &binding = mState.boundIndexBuffer;
+    if (binding.buffer == buffer.get() && binding.format == format && binding.offset == offset &&
+        binding.size == size)
+    {
+        return;
+    }
+    binding.buffer = buffer.get();
+    binding.format = format;
+    binding.offset = offset;
+    binding.size   = size;
+
     SetIndexBufferCommand *setIndexBufferCommand = initCommand<CommandID::SetIndexBuffer>();
-    setIndexBufferCommand->buffer = GetReferencedObject(mState.referencedBuffers, buffer);
+    setIndexBufferCommand->buffer = GetReferencedObject(&mReferencedBuffers, buffer);
     setIndexBufferCommand->format                = format;
     setIndexBufferCommand->offset                = offset;
     setIndexBufferCommand->size                  = size;
@@ -220,9 +251,21 @@ void CommandBuffer::setVertexBuffer(uint32_t slot,
                                     uint64_t offset,
                                     uint64_t size)
 {
+    if (slot < mState.boundVertexBuffers.size())
+    {
+        VertexBufferBinding &binding = mState.boundVertexBuffers[slot];
+        if (binding.buffer == buffer.get() && binding.offset == offset && binding.size == size)
+        {
+            return;
+        }
+        binding.buffer = buffer.get();
+        binding.offset = offset;
+        binding.size   = size;
+    }
+
     SetVertexBufferCommand *setVertexBufferCommand = initCommand<CommandID::SetVertexBuffer>();
     setVertexBufferCommand->slot                   = slot;
-    setVertexBufferCommand->buffer = GetReferencedObject(mState.referencedBuffers, buffer);
+    setVertexBufferCommand->buffer = GetReferencedObject(&mReferencedBuffers, buffer);
     setVertexBufferCommand->offset                 = offset;
     setVertexBufferCommand->size                   = size;
 }
@@ -238,6 +281,10 @@ void CommandBuffer::clear()
         }
     }
     mState = PerSubmissionData();
+
+    mReferencedRenderPipelines.clear();
+    mReferencedBuffers.clear();
+    mReferencedBindGroups.clear();
 }
 
 void CommandBuffer::recordCommands(const DawnProcTable *wgpu, RenderPassEncoderHandle encoder)
@@ -15,7 +15,8 @@
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 
 #include <webgpu/webgpu.h>
-#include <unordered_set>
+#include <array>
+#include <vector>
 
 namespace rx
 {
@@ -270,6 +271,23 @@ class CommandBuffer
     void recordCommands(const DawnProcTable *wgpu, RenderPassEncoderHandle encoder);
 
   private:
+    static constexpr size_t kMaxTrackedBindGroups = 4;
+
+    struct VertexBufferBinding
+    {
+        WGPUBuffer buffer = nullptr;
+        uint64_t offset   = 0;
+        uint64_t size     = 0;
+    };
+
+    struct IndexBufferBinding
+    {
+        WGPUBuffer buffer      = nullptr;
+        WGPUIndexFormat format = WGPUIndexFormat_Undefined;
+        uint64_t offset        = 0;
+        uint64_t size          = 0;
+    };
+
     struct CommandBlock
     {
         static constexpr size_t kCommandBlockDataSize = kCommandBlockSize - (sizeof(size_t) * 2);
@@ -315,14 +333,23 @@ class CommandBuffer
         bool hasSetViewportCommand      = false;
         bool hasSetBlendConstantCommand = false;
 
-        // std::unordered_set required because it does not move elements and stored command
-        // reference addresses in the set
-        std::unordered_set<RenderPipelineHandle> referencedRenderPipelines;
-        std::unordered_set<BufferHandle> referencedBuffers;
-        std::unordered_set<BindGroupHandle> referencedBindGroups;
+        // The objects last bound by the recorded commands, used to skip re-binding the same
+        // object.  Commands are recorded into a fresh render pass encoder after every clear(), so
+        // this matches the encoder's state at each point of the command stream.
+        WGPURenderPipeline boundPipeline                                           = nullptr;
+        std::array<WGPUBindGroup, kMaxTrackedBindGroups> boundBindGroups           = {};
+        std::array<VertexBufferBinding, gl::MAX_VERTEX_ATTRIBS> boundVertexBuffers = {};
+        IndexBufferBinding boundIndexBuffer;
     };
     PerSubmissionData mState;
 
+    // References to the objects used by the recorded commands, keeping them alive until the
+    // commands are recorded.  Commands store the raw object, so these may be reallocated freely.
+    // They are cleared in place so their storage is reused from one render pass to the next.
+    std::vector<RenderPipelineHandle> mReferencedRenderPipelines;
+    std::vector<BufferHandle> mReferencedBuffers;
+    std::vector<BindGroupHandle> mReferencedBindGroups;
+
     void nextCommandBlock();
 
     void ensureCommandSpace(size_t space)
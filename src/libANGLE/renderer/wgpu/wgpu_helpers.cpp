@@ -27,6 +27,15 @@ namespace webgpu
 {
 namespace
 {
+// Size of the buffers recycled by StagingBufferRing.  Larger uploads get a dedicated buffer which
+// is released after it is submitted.
+constexpr size_t kStagingBufferSize = 256 * 1024;
+// Mapped staging buffers kept around for reuse, beyond which recycled buffers are released.
+constexpr size_t kMaxFreeStagingBuffers = 16;
+// Staging allocations must be usable both as a copy source offset and as a mapped range offset.
+constexpr size_t kStagingBufferAlignment =
+    std::max(kBufferCopyToBufferAlignment, kBufferMapOffsetAlignment);
+
 WGPUTextureDescriptor TextureDescriptorFromTexture(const DawnProcTable *wgpu,
                                                    const webgpu::TextureHandle &texture)
 {
@@ -948,5 +957,146 @@ angle::Result BufferHelper::readDataImmediate(ContextWgpu *context,
     return angle::Result::Continue;
 }
 
+StagingBufferRing::StagingBufferRing() {}
+
+StagingBufferRing::~StagingBufferRing() {}
+
+void StagingBufferRing::destroy()
+{
+    // Dropping the buffers aborts their pending maps.  The map callbacks have no user data, so
+    // they are harmless if they are still invoked later.
+    mWriteBuffers.clear();
+    mSubmittingBuffers.clear();
+    mMappingBuffers.clear();
+    mFreeBuffers.clear();
+}
+
+angle::Result StagingBufferRing::allocate(ContextWgpu *context,
+                                          size_t size,
+                                          uint8_t **dataOut,
+                                          BufferHandle *bufferOut,
+                                          size_t *offsetOut)
+{
+    mProcTable = webgpu::GetProcs(context);
+
+    const size_t allocationSize = roundUpPow2(size, kStagingBufferAlignment);
+    if (mWriteBuffers.empty() ||
+        mWriteBuffers.back().size - mWriteBuffers.back().used < allocationSize)
+    {
+        StagingBuffer newBuffer;
+        ANGLE_TRY(acquireBuffer(context, allocationSize, &newBuffer));
+        mWriteBuffers.push_back(std::move(newBuffer));
+    }
+
+    StagingBuffer &stagingBuffer = mWriteBuffers.back();
+    void *mapPtr = mProcTable->bufferGetMappedRange(stagingBuffer.buffer.get(), stagingBuffer.used,
+                                                    allocationSize);
+    ASSERT(mapPtr);
+
+    *dataOut   = static_cast<uint8_t *>(mapPtr);
+    *bufferOut = stagingBuffer.buffer;
+    *offsetOut = stagingBuffer.used;
+
+    stagingBuffer.used += allocationSize;
+
+    return angle::Result::Continue;
+}
+
+void StagingBufferRing::onBeforeSubmit()
+{
+    for (StagingBuffer &stagingBuffer : mWriteBuffers)
+    {
+        mProcTable->bufferUnmap(stagingBuffer.buffer.get());
+        mSubmittingBuffers.push_back(std::move(stagingBuffer));
+    }
+    mWriteBuffers.clear();
+}
+
+void StagingBufferRing::onAfterSubmit()
+{
+    WGPUBufferMapCallbackInfo mapAsyncCallback = WGPU_BUFFER_MAP_CALLBACK_INFO_INIT;
+    mapAsyncCallback.mode                      = WGPUCallbackMode_AllowProcessEvents;
+    mapAsyncCallback.callback = [](WGPUMapAsyncStatus status, struct WGPUStringView message,
+                                   void *userdata1, void *userdata2) {
+        // Completion is polled with bufferGetMapState in recycleMappedBuffers.
+        ASSERT(userdata1 == nullptr);
+        ASSERT(userdata2 == nullptr);
+    };
+
+    for (StagingBuffer &stagingBuffer : mSubmittingBuffers)
+    {
+        // Dedicated buffers for large uploads are not worth keeping around.
+        if (stagingBuffer.size != kStagingBufferSize)
+        {
+            continue;
+        }
+
+        // The map completes once the GPU is done with the submission that was just made.
+        mProcTable->bufferMapAsync(stagingBuffer.buffer.get(), WGPUMapMode_Write, 0,
+                                   stagingBuffer.size, mapAsyncCallback);
+        mMappingBuffers.push_back(std::move(stagingBuffer));
+    }
+    mSubmittingBuffers.clear();
+}
+
+angle::Result StagingBufferRing::acquireBuffer(ContextWgpu *context,
+                                               size_t size,
+                                               StagingBuffer *bufferOut)
+{
+    if (size <= kStagingBufferSize)
+    {
+        recycleMappedBuffers(context);
+        if (!mFreeBuffers.empty())
+        {
+            *bufferOut = std::move(mFreeBuffers.back());
+            mFreeBuffers.pop_back();
+            return angle::Result::Continue;
+        }
+        size = kStagingBufferSize;
+    }
+
+    WGPUBufferDescriptor descriptor = WGPU_BUFFER_DESCRIPTOR_INIT;
+    descriptor.size                 = size;
+    descriptor.usage                = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+    descriptor.mappedAtCreation     = true;
+
+    bufferOut->buffer = webgpu::BufferHandle::Acquire(
+        mProcTable, mProcTable->deviceCreateBuffer(context->getDevice().get(), &descriptor));
+    bufferOut->size = size;
+    bufferOut->used = 0;
+
+    return angle::Result::Continue;
+}
+
+void StagingBufferRing::recycleMappedBuffers(ContextWgpu *context)
+{
+    if (mMappingBuffers.empty())
+    {
+        return;
+    }
+
+    mProcTable->instanceProcessEvents(context->getInstance().get());
+
+    // Submissions complete in order, so stop at the first buffer that is still in use.
+    while (!mMappingBuffers.empty())
+    {
+        StagingBuffer &stagingBuffer = mMappingBuffers.front();
+        const WGPUBufferMapState mapState =
+            mProcTable->bufferGetMapState(stagingBuffer.buffer.get());
+        if (mapState == WGPUBufferMapState_Pending)
+        {
+            break;
+        }
+
+        // A failed map leaves the buffer unmapped, in which case it is simply dropped.
+        if (mapState == WGPUBufferMapState_Mapped && mFreeBuffers.size() < kMaxFreeStagingBuffers)
+        {
+            stagingBuffer.used = 0;
+            mFreeBuffers.push_back(std::move(stagingBuffer));
+        }
+        mMappingBuffers.pop_front();
+    }
+}
+
 }  // namespace webgpu
 }  // namespace rx
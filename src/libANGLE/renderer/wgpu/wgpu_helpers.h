@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include <webgpu/webgpu.h>
 #include <algorithm>
+#include <deque>
 
 #include "libANGLE/Error.h"
 #include "libANGLE/ImageIndex.h"
@@ -304,6 +305,54 @@ struct BufferReadback
     const uint8_t *data = nullptr;
 };
 
+// A ring of MapWrite | CopySrc buffers used to upload data with commandEncoderCopyBufferToBuffer.
+// Buffers are created mapped and sub-allocated until full.  They are unmapped for the submission
+// that copies from them and asynchronously mapped again after it, so they are recycled once the
+// GPU is done with them without ever waiting on a MapAsync.
+class StagingBufferRing : angle::NonCopyable
+{
+  public:
+    StagingBufferRing();
+    ~StagingBufferRing();
+
+    void destroy();
+
+    // Returns a pointer to |size| bytes of mapped staging memory along with the buffer and offset
+    // the data should be copied from.  The copy must be recorded before the next submission.
+    angle::Result allocate(ContextWgpu *context,
+                           size_t size,
+                           uint8_t **dataOut,
+                           BufferHandle *bufferOut,
+                           size_t *offsetOut);
+
+    // Must be called around the queue submission of the commands that copy from the staging
+    // buffers.
+    void onBeforeSubmit();
+    void onAfterSubmit();
+
+  private:
+    struct StagingBuffer
+    {
+        BufferHandle buffer;
+        size_t size = 0;
+        size_t used = 0;
+    };
+
+    angle::Result acquireBuffer(ContextWgpu *context, size_t size, StagingBuffer *bufferOut);
+    void recycleMappedBuffers(ContextWgpu *context);
+
+    const DawnProcTable *mProcTable = nullptr;
+
+    // Mapped buffers being written to.  Only the last one has space left.
+    std::vector<StagingBuffer> mWriteBuffers;
+    // Unmapped buffers read by the submission being made.
+    std::vector<StagingBuffer> mSubmittingBuffers;
+    // Buffers waiting for their MapAsync to complete, in submission order.
+    std::deque<StagingBuffer> mMappingBuffers;
+    // Mapped, empty buffers ready to be reused.
+    std::vector<StagingBuffer> mFreeBuffers;
+};
+
 }  // namespace webgpu
 }  // namespace rx
 #endif  // LIBANGLE_RENDERER_WGPU_WGPU_HELPERS_H_
@@ -512,6 +512,36 @@ angle::Result PipelineCache::getRenderPipeline(ContextWgpu *context,
     return angle::Result::Continue;
 }
 
+ShaderModuleCache::ShaderModuleCache() : mShaderModules(kMaxCachedShaderModules) {}
+ShaderModuleCache::~ShaderModuleCache() = default;
+
+ShaderModuleHandle ShaderModuleCache::get(const std::string &wgslSource)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    auto iter = mShaderModules.Get(wgslSource);
+    if (iter == mShaderModules.end())
+    {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+void ShaderModuleCache::insert(const std::string &wgslSource,
+                               const ShaderModuleHandle &shaderModule)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    angle::TrimCache(kMaxCachedShaderModules, kGCLimit, "shader module", &mShaderModules);
+    mShaderModules.Put(wgslSource, shaderModule);
+}
+
+void ShaderModuleCache::clear()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    mShaderModules.Clear();
+}
+
 }  // namespace webgpu
 
 }  // namespace rx
@@ -13,10 +13,12 @@
 
 #include "libANGLE/Constants.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 
 #include "common/PackedEnums.h"
+#include "common/SimpleMutex.h"
 
 namespace rx
 {
@@ -222,6 +224,29 @@ class PipelineCache final
     std::unordered_map<RenderPipelineDesc, RenderPipelineHandle> mRenderPipelines;
 };
 
+// Shader modules created by program links, keyed by their final WGSL source.  Programs of the
+// display that end up with the same WGSL share one module.  Links run on worker threads, so the
+// cache is locked.
+class ShaderModuleCache final
+{
+  public:
+    ShaderModuleCache();
+    ~ShaderModuleCache();
+
+    ShaderModuleHandle get(const std::string &wgslSource);
+    void insert(const std::string &wgslSource, const ShaderModuleHandle &shaderModule);
+    void clear();
+
+  private:
+    static constexpr size_t kMaxCachedShaderModules = 256;
+
+    // The cache tries to clean up this many modules at once.
+    static constexpr size_t kGCLimit = 32;
+
+    angle::SimpleMutex mMutex;
+    angle::base::HashingMRUCache<std::string, ShaderModuleHandle> mShaderModules;
+};
+
 }  // namespace webgpu
 
 }  // namespace rx
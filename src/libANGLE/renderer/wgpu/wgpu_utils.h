@@ -332,6 +332,7 @@ enum class RenderPassClosureReason
     CopyTextureToTexture,
     CopyImage,
     ClearWithDraw,
+    BufferSubData,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
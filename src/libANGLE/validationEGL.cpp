@@ -2758,6 +2758,23 @@ bool ValidateCreateWindowSurfaceAttributes(const ValidationContext *val,
                 }
                 break;
 
+            case EGL_SURFACE_LOW_LATENCY_ANGLE:
+                if (!displayExtensions.surfaceLowLatencyANGLE)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "Attribute EGL_SURFACE_LOW_LATENCY_ANGLE requires "
+                                  "extension EGL_ANGLE_surface_low_latency.");
+                    return false;
+                }
+                if (value != EGL_TRUE && value != EGL_FALSE)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "EGL_SURFACE_LOW_LATENCY_ANGLE must "
+                                  "be either EGL_TRUE or EGL_FALSE.");
+                    return false;
+                }
+                break;
+
             case EGL_PROTECTED_CONTENT_EXT:
                 if (!displayExtensions.protectedContentEXT)
                 {
@@ -6138,6 +6155,16 @@ bool ValidateQuerySurface(const ValidationContext *val,
             }
             break;
 
+        case EGL_SURFACE_LOW_LATENCY_ANGLE:
+            if (!display->getExtensions().surfaceLowLatencyANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE,
+                              "EGL_SURFACE_LOW_LATENCY_ANGLE cannot be used without "
+                              "EGL_ANGLE_surface_low_latency support.");
+                return false;
+            }
+            break;
+
         case EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE:
             if (!display->getExtensions().robustResourceInitializationANGLE)
             {
@@ -6212,6 +6239,18 @@ bool ValidateQuerySurface(const ValidationContext *val,
             }
             break;
 
+        case EGL_SURFACE_ACQUIRE_LATENCY_ANGLE:
+        case EGL_SURFACE_THROTTLE_WAIT_TIME_ANGLE:
+        case EGL_SURFACE_PRESENT_LATENCY_ANGLE:
+        case EGL_SURFACE_PRESENT_QUEUE_DEPTH_ANGLE:
+            if (!display->getExtensions().surfacePresentStatisticsANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE,
+                              "EGL_ANGLE_surface_present_statistics not supported");
+                return false;
+            }
+            break;
+
         default:
             val->setError(EGL_BAD_ATTRIBUTE, "Invalid query surface attribute: 0x%04X", attribute);
             return false;
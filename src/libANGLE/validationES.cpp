@@ -999,16 +999,10 @@ bool ValidateDrawInstancedANGLE(const Context *context, angle::EntryPoint entryP
         return true;
     }
 
-    const auto &attribs  = state.getVertexArray()->getVertexAttributes();
-    const auto &bindings = state.getVertexArray()->getVertexBindings();
-    for (size_t attributeIndex = 0; attributeIndex < attribs.size(); attributeIndex++)
+    const AttributesMask instancedAttribs = state.getVertexArray()->getInstancedAttributesMask();
+    if ((executable->getActiveAttribLocationsMask() & ~instancedAttribs).any())
     {
-        const VertexAttribute &attrib = attribs[attributeIndex];
-        const VertexBinding &binding  = bindings[attrib.bindingIndex];
-        if (executable->isAttribLocationActive(attributeIndex) && binding.getDivisor() == 0)
-        {
-            return true;
-        }
+        return true;
     }
 
     ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, kNoZeroDivisor);
@@ -2324,6 +2318,14 @@ bool ValidateBeginQueryBase(const Context *context,
         return false;
     }
 
+    // From NV_conditional_render: the query used for conditional rendering cannot be restarted
+    // until EndConditionalRenderNV is called.
+    if (queryObject && queryObject == context->getState().getConditionalRenderQuery())
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, kConditionalRenderQueryInUse);
+        return false;
+    }
+
     return true;
 }
 
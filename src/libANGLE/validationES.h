@@ -386,6 +386,12 @@ ANGLE_INLINE bool ValidateDrawBase(const Context *context,
                                    angle::EntryPoint entryPoint,
                                    PrimitiveMode mode)
 {
+    if (ANGLE_LIKELY(
+            context->getStateCache().isDrawModeKnownValid(context->getPrivateStateCache(), mode)))
+    {
+        return true;
+    }
+
     intptr_t drawStatesError = context->getStateCache().getBasicDrawStatesErrorString(
         context, &context->getPrivateStateCache());
     if (ANGLE_UNLIKELY(drawStatesError))
@@ -4331,6 +4331,7 @@ bool ValidateGetString(const Context *context, angle::EntryPoint entryPoint, GLe
             break;
 
         case GL_SERIALIZED_CONTEXT_STRING_ANGLE:
+        case GL_SERIALIZED_CONTEXT_DIGEST_ANGLE:
             if (!context->getExtensions().getSerializedContextStringANGLE)
             {
                 ANGLE_VALIDATION_ERROR(GL_INVALID_ENUM, kInvalidName);
@@ -17,6 +17,7 @@
 #include "libANGLE/ErrorStrings.h"
 #include "libANGLE/MemoryObject.h"
 #include "libANGLE/PixelLocalStorage.h"
+#include "libANGLE/Query.h"
 #include "libANGLE/validationES.h"
 #include "libANGLE/validationES2.h"
 #include "libANGLE/validationES3.h"
@@ -2938,6 +2939,65 @@ bool ValidatePolygonModeANGLE(const PrivateState &state,
     return true;
 }
 
+// GL_NV_conditional_render
+bool ValidateBeginConditionalRenderNV(const Context *context,
+                                      angle::EntryPoint entryPoint,
+                                      QueryID idPacked,
+                                      GLenum mode)
+{
+    switch (mode)
+    {
+        case GL_QUERY_WAIT_NV:
+        case GL_QUERY_NO_WAIT_NV:
+        case GL_QUERY_BY_REGION_WAIT_NV:
+        case GL_QUERY_BY_REGION_NO_WAIT_NV:
+            break;
+        default:
+            ANGLE_VALIDATION_ERROR(GL_INVALID_ENUM, kInvalidConditionalRenderMode);
+            return false;
+    }
+
+    if (context->getState().getConditionalRenderQuery() != nullptr)
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, kConditionalRenderActive);
+        return false;
+    }
+
+    // A generated name only becomes a query object once it is first passed to BeginQuery.
+    Query *queryObject = context->getQuery(idPacked);
+    if (queryObject == nullptr)
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, kInvalidQueryId);
+        return false;
+    }
+
+    if (queryObject->getType() != QueryType::AnySamples &&
+        queryObject->getType() != QueryType::AnySamplesConservative)
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, kConditionalRenderQueryType);
+        return false;
+    }
+
+    if (context->getState().isQueryActive(queryObject))
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, kQueryActive);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateEndConditionalRenderNV(const Context *context, angle::EntryPoint entryPoint)
+{
+    if (context->getState().getConditionalRenderQuery() == nullptr)
+    {
+        ANGLE_VALIDATION_ERROR(GL_INVALID_OPERATION, kConditionalRenderInactive);
+        return false;
+    }
+
+    return true;
+}
+
 // GL_NV_polygon_mode
 bool ValidatePolygonModeNV(const PrivateState &state,
                            ErrorSet *errors,
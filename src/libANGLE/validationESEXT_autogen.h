@@ -2057,6 +2057,13 @@ bool ValidateGetFramebufferParameterivMESA(const Context *context,
                                            GLenum pname,
                                            const GLint *params);
 
+// GL_NV_conditional_render
+bool ValidateBeginConditionalRenderNV(const Context *context,
+                                      angle::EntryPoint entryPoint,
+                                      QueryID idPacked,
+                                      GLenum mode);
+bool ValidateEndConditionalRenderNV(const Context *context, angle::EntryPoint entryPoint);
+
 // GL_NV_fence
 bool ValidateDeleteFencesNV(const Context *context,
                             angle::EntryPoint entryPoint,
@@ -167,6 +167,7 @@ const ProcEntry g_procTable[] = {
     {"glAlphaFunc", P(GL_AlphaFunc)},
     {"glAlphaFuncx", P(GL_AlphaFuncx)},
     {"glAttachShader", P(GL_AttachShader)},
+    {"glBeginConditionalRenderNV", P(GL_BeginConditionalRenderNV)},
     {"glBeginPerfMonitorAMD", P(GL_BeginPerfMonitorAMD)},
     {"glBeginPixelLocalStorageANGLE", P(GL_BeginPixelLocalStorageANGLE)},
     {"glBeginQuery", P(GL_BeginQuery)},
@@ -361,6 +362,7 @@ const ProcEntry g_procTable[] = {
     {"glEnablei", P(GL_Enablei)},
     {"glEnableiEXT", P(GL_EnableiEXT)},
     {"glEnableiOES", P(GL_EnableiOES)},
+    {"glEndConditionalRenderNV", P(GL_EndConditionalRenderNV)},
     {"glEndPerfMonitorAMD", P(GL_EndPerfMonitorAMD)},
     {"glEndPixelLocalStorageANGLE", P(GL_EndPixelLocalStorageANGLE)},
     {"glEndPixelLocalStorageImplicitANGLE", P(GL_EndPixelLocalStorageImplicitANGLE)},
@@ -608,7 +608,10 @@ EGLBoolean EGLAPIENTRY EGL_MakeCurrent(EGLDisplay dpy,
                                        EGLSurface read,
                                        EGLContext ctx)
 {
-
+    if (egl::IsMakeCurrentNoOp(egl::GetCurrentThread(), dpy, draw, read, ctx))
+    {
+        return EGL_TRUE;
+    }
     Thread *thread = egl::GetCurrentThread();
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
     EGLBoolean returnValue;
@@ -15169,6 +15169,93 @@ void GL_APIENTRY GL_GetFramebufferParameterivMESA(GLenum target, GLenum pname, G
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
 }
 
+// GL_NV_conditional_render
+void GL_APIENTRY GL_BeginConditionalRenderNV(GLuint id, GLenum mode)
+{
+    ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
+    Context *context = GetValidGlobalContext();
+    ANGLE_UNSAFE_TODO(EVENT(context, GLBeginConditionalRenderNV,
+                            "context = %d, id = %u, mode = %s", CID(context), id,
+                            GLenumToString(GLESEnum::ConditionalRenderMode, mode)));
+
+    if (ANGLE_LIKELY(context != nullptr))
+    {
+        QueryID idPacked = PackParam<QueryID>(id);
+        SCOPED_SHARE_CONTEXT_LOCK(context);
+        bool isCallValid = context->skipValidation();
+        if (!isCallValid)
+        {
+            if (ANGLE_LIKELY(context->getExtensions().conditionalRenderNV))
+            {
+#if defined(ANGLE_ENABLE_ASSERTS)
+                const uint32_t errorCount = context->getPushedErrorCount();
+#endif
+                isCallValid = ValidateBeginConditionalRenderNV(
+                    context, angle::EntryPoint::GLBeginConditionalRenderNV, idPacked, mode);
+#if defined(ANGLE_ENABLE_ASSERTS)
+                ASSERT(context->getPushedErrorCount() - errorCount == (isCallValid ? 0 : 1));
+#endif
+            }
+            else
+            {
+                RecordVersionErrorESEXT(context, angle::EntryPoint::GLBeginConditionalRenderNV);
+            }
+        }
+        if (ANGLE_LIKELY(isCallValid))
+        {
+            context->beginConditionalRender(idPacked, mode);
+        }
+        ANGLE_CAPTURE_GL(BeginConditionalRenderNV, isCallValid, context, idPacked, mode);
+    }
+    else
+    {
+        GenerateContextLostErrorOnCurrentGlobalContext(
+            angle::EntryPoint::GLBeginConditionalRenderNV);
+    }
+    ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
+}
+
+void GL_APIENTRY GL_EndConditionalRenderNV()
+{
+    ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
+    Context *context = GetValidGlobalContext();
+    ANGLE_UNSAFE_TODO(EVENT(context, GLEndConditionalRenderNV, "context = %d", CID(context)));
+
+    if (ANGLE_LIKELY(context != nullptr))
+    {
+        SCOPED_SHARE_CONTEXT_LOCK(context);
+        bool isCallValid = context->skipValidation();
+        if (!isCallValid)
+        {
+            if (ANGLE_LIKELY(context->getExtensions().conditionalRenderNV))
+            {
+#if defined(ANGLE_ENABLE_ASSERTS)
+                const uint32_t errorCount = context->getPushedErrorCount();
+#endif
+                isCallValid = ValidateEndConditionalRenderNV(
+                    context, angle::EntryPoint::GLEndConditionalRenderNV);
+#if defined(ANGLE_ENABLE_ASSERTS)
+                ASSERT(context->getPushedErrorCount() - errorCount == (isCallValid ? 0 : 1));
+#endif
+            }
+            else
+            {
+                RecordVersionErrorESEXT(context, angle::EntryPoint::GLEndConditionalRenderNV);
+            }
+        }
+        if (ANGLE_LIKELY(isCallValid))
+        {
+            context->endConditionalRender();
+        }
+        ANGLE_CAPTURE_GL(EndConditionalRenderNV, isCallValid, context);
+    }
+    else
+    {
+        GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint::GLEndConditionalRenderNV);
+    }
+    ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
+}
+
 // GL_NV_fence
 void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences)
 {
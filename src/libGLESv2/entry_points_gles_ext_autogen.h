@@ -1447,6 +1447,10 @@ ANGLE_EXPORT void GL_APIENTRY GL_GetFramebufferParameterivMESA(GLenum target,
                                                                GLenum pname,
                                                                GLint *params);
 
+// GL_NV_conditional_render
+ANGLE_EXPORT void GL_APIENTRY GL_BeginConditionalRenderNV(GLuint id, GLenum mode);
+ANGLE_EXPORT void GL_APIENTRY GL_EndConditionalRenderNV();
+
 // GL_NV_fence
 ANGLE_EXPORT void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences);
 ANGLE_EXPORT void GL_APIENTRY GL_FinishFenceNV(GLuint fence);
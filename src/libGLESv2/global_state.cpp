@@ -12,6 +12,7 @@
 #include "common/platform.h"
 #include "common/system_utils.h"
 #include "libANGLE/ErrorStrings.h"
+#include "libANGLE/Surface.h"
 #include "libANGLE/Thread.h"
 #include "libGLESv2/egl_stubs_autogen.h"
 #include "libGLESv2/resource.h"
@@ -186,6 +187,51 @@ bool IsEGLValidationEnabled()
     return g_EGLValidationEnabled;
 }
 
+bool IsMakeCurrentNoOp(Thread *thread,
+                       EGLDisplay dpy,
+                       EGLSurface draw,
+                       EGLSurface read,
+                       EGLContext ctx)
+{
+#if ANGLE_CAPTURE_ENABLED || defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
+    // Frame capture needs to see every call, and forced context checks rely on eglMakeCurrent() to
+    // resync with the native context.
+    return false;
+#else
+    // Only state that belongs to this thread is used, except for the destroyed and lost flags that
+    // other threads may set, which are atomic.  Anything else that can make the call fail is
+    // reported through those flags, which send the call down the regular path.
+    const gl::Context *context = thread->getContext();
+    if (context == nullptr || context->getDisplay() != PackParam<Display *>(dpy) ||
+        context->id() != PackParam<gl::ContextID>(ctx))
+    {
+        return false;
+    }
+
+    const Surface *drawSurface = thread->getCurrentDrawSurface();
+    const Surface *readSurface = thread->getCurrentReadSurface();
+    auto isSameSurface         = [](const Surface *surface, EGLSurface handle) {
+        return surface == nullptr ? handle == EGL_NO_SURFACE
+                                  : surface->id() == PackParam<SurfaceID>(handle);
+    };
+    if (!isSameSurface(drawSurface, draw) || !isSameSurface(readSurface, read))
+    {
+        return false;
+    }
+
+    if (context->isDestroyed() || context->isContextLost() ||
+        context->getDisplay()->isTerminatedByApi() ||
+        (drawSurface != nullptr && drawSurface->isDestroyed()) ||
+        (readSurface != nullptr && readSurface->isDestroyed()))
+    {
+        return false;
+    }
+
+    thread->setSuccess();
+    return true;
+#endif
+}
+
 }  // namespace egl
 
 namespace gl
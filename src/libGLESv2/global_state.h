@@ -47,6 +47,14 @@ Debug *GetDebug();
 void SetEGLValidationEnabled(bool enabled);
 bool IsEGLValidationEnabled();
 
+// Whether eglMakeCurrent() with these parameters would rebind what is already current to the
+// calling thread.  In that case, the call is successfully completed without taking any locks.
+bool IsMakeCurrentNoOp(Thread *thread,
+                       EGLDisplay dpy,
+                       EGLSurface draw,
+                       EGLSurface read,
+                       EGLContext ctx);
+
 // Sync the current context from Thread to global state.
 class [[nodiscard]] ScopedSyncCurrentContextFromThread
 {
@@ -91,6 +99,7 @@ ANGLE_INLINE ScopedContextMutexLock LockAndTryMergeContextMutexes(gl::Context *c
         if (imageMutex != nullptr)
         {
             ContextMutex::Merge(&context->getContextMutex(), imageMutex);
+            context->disableShareContextLockElision();
         }
     }
     return lock;
@@ -185,7 +194,7 @@ static ANGLE_INLINE void DirtyContextIfNeeded(Context *context)
 #        define SCOPED_EGL_IMAGE_SHARE_CONTEXT_LOCK(context, imageID) ANGLE_SCOPED_GLOBAL_LOCK()
 #    else
 #        define SCOPED_SHARE_CONTEXT_LOCK(context) \
-            egl::ScopedContextMutexLock shareContextLock(context->getContextMutex())
+            egl::ScopedContextMutexLock shareContextLock(context->getShareContextMutex())
 #        define SCOPED_EGL_IMAGE_SHARE_CONTEXT_LOCK(context, imageID) \
             ANGLE_SCOPED_GLOBAL_LOCK();                               \
             egl::ScopedContextMutexLock shareContextLock =            \
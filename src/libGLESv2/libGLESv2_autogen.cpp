@@ -5168,6 +5168,17 @@ void GL_APIENTRY glGetFramebufferParameterivMESA(GLenum target, GLenum pname, GL
     return GL_GetFramebufferParameterivMESA(target, pname, params);
 }
 
+// GL_NV_conditional_render
+void GL_APIENTRY glBeginConditionalRenderNV(GLuint id, GLenum mode)
+{
+    return GL_BeginConditionalRenderNV(id, mode);
+}
+
+void GL_APIENTRY glEndConditionalRenderNV()
+{
+    return GL_EndConditionalRenderNV();
+}
+
 // GL_NV_fence
 void GL_APIENTRY glDeleteFencesNV(GLsizei n, const GLuint *fences)
 {
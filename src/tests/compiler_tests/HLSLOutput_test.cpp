@@ -287,3 +287,31 @@ TEST_F(HLSLOutputTest, DefaultHLSLWarningsSuppressed)
     compile(shaderString);
     EXPECT_TRUE(foundInCode("#pragma warning( disable: 3081 3556 3557 3571 )"));
 }
+
+// Test that a function whose only call is folded away after the first pruning of unused functions
+// is not output, nor the texture function it uses.
+TEST_F(HLSLOutputTest, FunctionCallFoldedAwayIsPruned)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+precision highp float;
+uniform sampler2D s;
+out vec4 my_FragColor;
+
+float unreachable()
+{
+    return texture(s, vec2(0.5)).x;
+}
+
+void main()
+{
+    float a[2];
+    float b[2] = float[2](1.0, 2.0);
+    int i = (a = b).length() == 2 ? 1 : int(unreachable());
+    my_FragColor = vec4(i);
+})";
+
+    compile(shaderString);
+    EXPECT_FALSE(foundInCode("unreachable"));
+    EXPECT_FALSE(foundInCode("gl_texture2D"));
+}
@@ -0,0 +1,140 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IntermRebuild_test.cpp:
+//   Tests for fusing several TIntermRebuild passes into a single traversal.
+//
+
+#include <set>
+
+#include "compiler/translator/IntermRebuild.h"
+#include "compiler/translator/SymbolTable.h"
+#include "tests/test_utils/ShaderCompileTreeTest.h"
+
+using namespace sh;
+
+namespace
+{
+
+constexpr char kShader[] = R"(#version 300 es
+precision mediump float;
+uniform float u;
+out vec4 color;
+float f(float x)
+{
+    return x + u * x;
+}
+void main()
+{
+    color = vec4(f(u) + u);
+})";
+
+// Replaces additions with multiplications.
+class AddToMul : public TIntermRebuild
+{
+  public:
+    explicit AddToMul(TCompiler &compiler) : TIntermRebuild(compiler, false, true) {}
+
+    PostResult visitBinaryPost(TIntermBinary &node) override
+    {
+        if (node.getOp() != EOpAdd)
+        {
+            return node;
+        }
+        return *new TIntermBinary(EOpMul, node.getLeft(), node.getRight());
+    }
+};
+
+// Counts multiplications, and records the functions they are found in.
+class CountMul : public TIntermRebuild
+{
+  public:
+    explicit CountMul(TCompiler &compiler) : TIntermRebuild(compiler, false, true) {}
+
+    PostResult visitBinaryPost(TIntermBinary &node) override
+    {
+        if (node.getOp() == EOpMul)
+        {
+            ++mCount;
+            const TFunction *parentFunction = getParentFunction();
+            if (parentFunction)
+            {
+                mParentFunctions.insert(parentFunction->name().data());
+            }
+        }
+        return node;
+    }
+
+    size_t mCount = 0;
+    std::set<std::string> mParentFunctions;
+};
+
+class IntermRebuildTest : public ShaderCompileTreeTest
+{
+  public:
+    IntermRebuildTest() {}
+
+  protected:
+    ::GLenum getShaderType() const override { return GL_FRAGMENT_SHADER; }
+    ShShaderSpec getShaderSpec() const override { return SH_GLES3_SPEC; }
+};
+
+// Test that fused rebuilds see the nodes returned by the rebuilds fused before them, like they
+// would if they were run one after the other.
+TEST_F(IntermRebuildTest, FusedRebuildsRunInOrder)
+{
+    compileAssumeSuccess(kShader);
+
+    AddToMul addToMul(getCompiler());
+    CountMul countMul(getCompiler());
+
+    TIntermFusedRebuild fused(getCompiler());
+    fused.add(addToMul);
+    fused.add(countMul);
+    ASSERT_TRUE(fused.rebuildRoot(*mASTRoot));
+
+    // The original multiplication, plus the two additions that were replaced.
+    EXPECT_EQ(3u, countMul.mCount);
+
+    // Running the count again on its own finds the same multiplications.
+    CountMul recount(getCompiler());
+    ASSERT_TRUE(recount.rebuildRoot(*mASTRoot));
+    EXPECT_EQ(3u, recount.mCount);
+}
+
+// Test that a fused rebuild doesn't see the effects of the rebuilds fused after it.
+TEST_F(IntermRebuildTest, FusedRebuildsDoNotSeeLaterRebuilds)
+{
+    compileAssumeSuccess(kShader);
+
+    CountMul countMul(getCompiler());
+    AddToMul addToMul(getCompiler());
+
+    TIntermFusedRebuild fused(getCompiler());
+    fused.add(countMul);
+    fused.add(addToMul);
+    ASSERT_TRUE(fused.rebuildRoot(*mASTRoot));
+
+    EXPECT_EQ(1u, countMul.mCount);
+}
+
+// Test that fused rebuilds can query the function enclosing the visited node.
+TEST_F(IntermRebuildTest, FusedRebuildsSeeParentFunction)
+{
+    compileAssumeSuccess(kShader);
+
+    AddToMul addToMul(getCompiler());
+    CountMul countMul(getCompiler());
+
+    TIntermFusedRebuild fused(getCompiler());
+    fused.add(addToMul);
+    fused.add(countMul);
+    ASSERT_TRUE(fused.rebuildRoot(*mASTRoot));
+
+    const std::set<std::string> expected = {"f", "main"};
+    EXPECT_EQ(expected, countMul.mParentFunctions);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,139 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV_test.cpp:
+//   Test that the optimizeSPIRVForSize and optimizeSPIRVForPerformance compile options produce
+//   valid and smaller SPIR-V.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+#include "gtest/gtest.h"
+
+namespace spirv = angle::spirv;
+
+namespace
+{
+enum class OptimizeMode
+{
+    None,
+    Size,
+    Performance,
+};
+
+class OptimizeSPIRVTest : public testing::Test
+{
+  public:
+    void SetUp() override { sh::InitBuiltInResources(&mResources); }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    // Compiles the shader with the given optimization mode and returns the generated SPIR-V.
+    spirv::Blob compile(GLenum shaderType, const char *shaderSource, OptimizeMode mode)
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+        }
+        mCompiler = sh::ConstructCompiler(shaderType, SH_GLES3_SPEC, SH_SPIRV_VULKAN_OUTPUT,
+                                          &mResources);
+        EXPECT_NE(mCompiler, nullptr);
+        if (mCompiler == nullptr)
+        {
+            return {};
+        }
+
+        ShCompileOptions options            = {};
+        options.objectCode                  = true;
+        options.removeInactiveVariables     = true;
+        options.optimizeSPIRVForSize        = mode == OptimizeMode::Size;
+        options.optimizeSPIRVForPerformance = mode == OptimizeMode::Performance;
+
+        const char *shaderStrings[] = {shaderSource};
+        EXPECT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options))
+            << sh::GetInfoLog(mCompiler);
+
+        return sh::GetObjectBinaryBlob(mCompiler);
+    }
+
+    // Counts the instructions of the given opcode in the SPIR-V.
+    static size_t CountInstructions(const spirv::Blob &blob, spv::Op op)
+    {
+        size_t count       = 0;
+        size_t currentWord = spirv::kHeaderIndexInstructions;
+        while (currentWord < blob.size())
+        {
+            uint32_t wordCount;
+            spv::Op opCode;
+            spirv::GetInstructionOpAndLength(&blob[currentWord], &opCode, &wordCount);
+            currentWord += wordCount;
+
+            if (opCode == op)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+  private:
+    ShBuiltInResources mResources;
+    ShHandle mCompiler = nullptr;
+};
+
+constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform float u;
+out vec4 color;
+
+float scale(float x)
+{
+    float s = 2.0;
+    float t = s * 3.0;
+    return x * t;
+}
+
+void main()
+{
+    float value = scale(u);
+    // Not a constant expression, so only the SPIR-V optimizer can remove the branch.
+    bool debug = false;
+    if (debug)
+    {
+        value += 1.0;
+    }
+    color = vec4(value, value, value, 1.0);
+})";
+
+// Test that the size mode shrinks the output and removes the constant branch.
+TEST_F(OptimizeSPIRVTest, SizeMode)
+{
+    const spirv::Blob unoptimized = compile(GL_FRAGMENT_SHADER, kFS, OptimizeMode::None);
+    const spirv::Blob optimized   = compile(GL_FRAGMENT_SHADER, kFS, OptimizeMode::Size);
+
+    EXPECT_LT(optimized.size(), unoptimized.size());
+    EXPECT_LT(CountInstructions(optimized, spv::OpBranchConditional),
+              CountInstructions(unoptimized, spv::OpBranchConditional));
+}
+
+// Test that the performance mode removes the function-local loads and stores.
+TEST_F(OptimizeSPIRVTest, PerformanceMode)
+{
+    const spirv::Blob unoptimized = compile(GL_FRAGMENT_SHADER, kFS, OptimizeMode::None);
+    const spirv::Blob optimized   = compile(GL_FRAGMENT_SHADER, kFS, OptimizeMode::Performance);
+
+    EXPECT_LT(optimized.size(), unoptimized.size());
+    EXPECT_LT(CountInstructions(optimized, spv::OpLoad),
+              CountInstructions(unoptimized, spv::OpLoad));
+}
+}  // namespace
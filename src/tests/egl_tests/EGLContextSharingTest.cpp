@@ -206,6 +206,85 @@ TEST_P(EGLContextSharingTest, BindTextureAfterShareContextFree)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that rebinding the current context and surfaces succeeds and clears the EGL error, but
+// fails once the context is destroyed.
+TEST_P(EGLContextSharingTest, RebindCurrentContext)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLConfig config   = getEGLWindow()->getConfig();
+    EGLSurface surface = getEGLWindow()->getSurface();
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                     getEGLWindow()->getClientMajorVersion(), EGL_NONE};
+
+    mContexts[0] = eglCreateContext(display, config, nullptr, contextAttribs);
+    ASSERT_EGL_SUCCESS();
+    ASSERT_NE(EGL_NO_CONTEXT, mContexts[0]);
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+
+    // Generate an error, which the rebind must clear.
+    EGLint value = 0;
+    EXPECT_EGL_FALSE(eglQueryContext(display, mContexts[0], EGL_NONE, &value));
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    EXPECT_EGL_SUCCESS();
+
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // The destroyed context stays current, but can no longer be bound.
+    EXPECT_EGL_TRUE(eglDestroyContext(display, mContexts[0]));
+    EXPECT_EGL_FALSE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    EXPECT_EGL_ERROR(EGL_BAD_CONTEXT);
+    mContexts[0] = EGL_NO_CONTEXT;
+
+    getEGLWindow()->makeCurrent();
+    ASSERT_EGL_SUCCESS();
+}
+
+// Tests switching back and forth between contexts of the same share group.
+TEST_P(EGLContextSharingTest, SwitchBetweenSharedContexts)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLConfig config   = getEGLWindow()->getConfig();
+    EGLSurface surface = getEGLWindow()->getSurface();
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION,
+                                     getEGLWindow()->getClientMajorVersion(), EGL_NONE};
+
+    mContexts[0] = eglCreateContext(display, config, nullptr, contextAttribs);
+    ASSERT_NE(EGL_NO_CONTEXT, mContexts[0]);
+    mContexts[1] = eglCreateContext(display, config, mContexts[0], contextAttribs);
+    ASSERT_NE(EGL_NO_CONTEXT, mContexts[1]);
+    ASSERT_EGL_SUCCESS();
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[0]));
+    glGenTextures(1, &mTexture);
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    const GLColor clearColors[] = {GLColor::green, GLColor::blue};
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+        for (size_t contextIndex = 0; contextIndex < 2; ++contextIndex)
+        {
+            ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, mContexts[contextIndex]));
+            EXPECT_GL_TRUE(glIsTexture(mTexture));
+
+            const GLColor &color = clearColors[contextIndex];
+            glClearColor(color.R / 255.0f, color.G / 255.0f, color.B / 255.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+        }
+    }
+
+    // Delete the texture while a context of its share group is current.
+    glDeleteTextures(1, &mTexture);
+    mTexture = 0;
+    ASSERT_GL_NO_ERROR();
+}
+
 // Tests the creation of contexts using EGL_ANGLE_display_texture_share_group
 TEST_P(EGLContextSharingTest, DisplayShareGroupContextCreation)
 {
@@ -1905,7 +1984,8 @@ ANGLE_INSTANTIATE_TEST(EGLContextSharingTest,
                        ES2_OPENGL(),
                        ES3_OPENGL(),
                        ES2_VULKAN(),
-                       ES3_VULKAN());
+                       ES3_VULKAN(),
+                       ES3_VULKAN().enable(Feature::ElideShareContextLockForUnsharedContexts));
 
 ANGLE_INSTANTIATE_TEST(EGLContextSharingTestNoFixture,
                        WithNoFixture(ES2_METAL()),
@@ -0,0 +1,70 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLSurfacePresentStatisticsTest:
+//   Tests pertaining to EGL_ANGLE_surface_present_statistics extension.
+//
+
+#include <gtest/gtest.h>
+
+#include "test_utils/ANGLETest.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+class EGLSurfacePresentStatisticsTest : public ANGLETest<>
+{
+  protected:
+    bool hasPresentStatisticsExtension() const
+    {
+        return IsEGLDisplayExtensionEnabled(getEGLWindow()->getDisplay(),
+                                            "EGL_ANGLE_surface_present_statistics");
+    }
+};
+
+// Tests that the present statistics can be queried after a few swaps.
+TEST_P(EGLSurfacePresentStatisticsTest, QueryAfterSwap)
+{
+    ANGLE_SKIP_TEST_IF(!hasPresentStatisticsExtension());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLSurface surface = getEGLWindow()->getSurface();
+
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        swapBuffers();
+    }
+    ASSERT_GL_NO_ERROR();
+
+    constexpr EGLint kAttributes[] = {
+        EGL_SURFACE_ACQUIRE_LATENCY_ANGLE,
+        EGL_SURFACE_THROTTLE_WAIT_TIME_ANGLE,
+        EGL_SURFACE_PRESENT_LATENCY_ANGLE,
+        EGL_SURFACE_PRESENT_QUEUE_DEPTH_ANGLE,
+    };
+    for (EGLint attribute : kAttributes)
+    {
+        EGLint value = -1;
+        EXPECT_EGL_TRUE(eglQuerySurface(display, surface, attribute, &value));
+        EXPECT_EGL_SUCCESS();
+        EXPECT_GE(value, 0);
+    }
+}
+
+// Tests that querying the present statistics without the extension generates an error.
+TEST_P(EGLSurfacePresentStatisticsTest, QueryWithoutExtension)
+{
+    ANGLE_SKIP_TEST_IF(hasPresentStatisticsExtension());
+
+    EGLint value = 0;
+    EXPECT_EGL_FALSE(eglQuerySurface(getEGLWindow()->getDisplay(), getEGLWindow()->getSurface(),
+                                     EGL_SURFACE_PRESENT_QUEUE_DEPTH_ANGLE, &value));
+    EXPECT_EGL_ERROR(EGL_BAD_ATTRIBUTE);
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLSurfacePresentStatisticsTest);
+ANGLE_INSTANTIATE_TEST_ES3(EGLSurfacePresentStatisticsTest);
@@ -1107,6 +1107,40 @@ TEST_P(EGLSurfaceTest, FixedSizeWindow)
     EXPECT_EQ(kUpdateSize, queryUpdatedWidth);
 }
 
+// Test that a low-latency window surface can be created, rendered to and swapped.
+TEST_P(EGLSurfaceTest, LowLatencyWindow)
+{
+    initializeDisplay();
+    ANGLE_SKIP_TEST_IF(!IsEGLDisplayExtensionEnabled(mDisplay, "EGL_ANGLE_surface_low_latency"));
+
+    mConfig = chooseDefaultConfig(true);
+    ANGLE_SKIP_TEST_IF(mConfig == EGL_NO_CONFIG_KHR);
+
+    initializeWindowSurfaceWithAttribs(mConfig, {EGL_SURFACE_LOW_LATENCY_ANGLE, EGL_TRUE},
+                                       EGL_SUCCESS);
+    ASSERT_NE(EGL_NO_SURFACE, mWindowSurface);
+
+    initializeMainContext();
+    EXPECT_EGL_TRUE(eglMakeCurrent(mDisplay, mWindowSurface, mWindowSurface, mContext));
+    ASSERT_EGL_SUCCESS();
+
+    EGLint queryIsLowLatency = 0;
+    EXPECT_EGL_TRUE(eglQuerySurface(mDisplay, mWindowSurface, EGL_SURFACE_LOW_LATENCY_ANGLE,
+                                    &queryIsLowLatency));
+    ASSERT_EGL_SUCCESS();
+    EXPECT_EGL_TRUE(queryIsLowLatency);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+        EXPECT_EGL_TRUE(eglSwapBuffers(mDisplay, mWindowSurface));
+        ASSERT_EGL_SUCCESS();
+    }
+}
+
 TEST_P(EGLSurfaceTest3, MakeCurrentDifferentSurfaces)
 {
     const EGLint configAttributes[] = {
@@ -0,0 +1,173 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// D3D11RenderStateCacheTest:
+//   Tests for the hit and miss counters of the D3D11 render state cache, and for prewarming the
+//   cache from the states stored in the blob cache.
+//
+
+#include <map>
+#include <vector>
+
+#include "common/unsafe_buffers.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
+#include "libANGLE/renderer/d3d/d3d11/Context11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
+
+void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsizeiANDROID valueSize)
+{
+    std::vector<uint8_t> keyVec(keySize);
+    ANGLE_UNSAFE_TODO(memcpy(keyVec.data(), key, keySize));
+
+    std::vector<uint8_t> valueVec(valueSize);
+    ANGLE_UNSAFE_TODO(memcpy(valueVec.data(), value, valueSize));
+
+    gApplicationCache[keyVec] = valueVec;
+}
+
+EGLsizeiANDROID GetBlob(const void *key,
+                        EGLsizeiANDROID keySize,
+                        void *value,
+                        EGLsizeiANDROID valueSize)
+{
+    std::vector<uint8_t> keyVec(keySize);
+    ANGLE_UNSAFE_TODO(memcpy(keyVec.data(), key, keySize));
+
+    auto entry = gApplicationCache.find(keyVec);
+    if (entry == gApplicationCache.end())
+    {
+        return 0;
+    }
+
+    if (entry->second.size() <= static_cast<size_t>(valueSize))
+    {
+        ANGLE_UNSAFE_TODO(memcpy(value, entry->second.data(), entry->second.size()));
+    }
+
+    return entry->second.size();
+}
+
+class D3D11RenderStateCacheTest : public ANGLETest<>
+{
+  protected:
+    D3D11RenderStateCacheTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+
+        // Blob cache functions can only be set once per display.
+        forceNewDisplay();
+    }
+
+    void testTearDown() override { gApplicationCache.clear(); }
+
+    gl::Context *getContext()
+    {
+        egl::Display *display   = static_cast<egl::Display *>(getEGLWindow()->getDisplay());
+        gl::ContextID contextID = {
+            static_cast<GLuint>(reinterpret_cast<uintptr_t>(getEGLWindow()->getContext()))};
+        return display->getContext(contextID);
+    }
+
+    rx::Renderer11 *getRenderer11()
+    {
+        return rx::GetImplAs<rx::Context11>(getContext())->getRenderer();
+    }
+
+    // Each blend function gives a different blend state.
+    void drawWithBlendFunc(GLuint program, GLenum sourceFactor)
+    {
+        glBlendFunc(sourceFactor, GL_ZERO);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    }
+};
+
+// Tests that the blend state cache counters are exposed through GL_AMD_performance_monitor, and
+// that going back to an earlier blend state is counted as a hit rather than a miss.
+TEST_P(D3D11RenderStateCacheTest, CountsBlendStateCacheHits)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glEnable(GL_BLEND);
+
+    drawWithBlendFunc(program, GL_ONE);
+    drawWithBlendFunc(program, GL_SRC_ALPHA);
+    ASSERT_GL_NO_ERROR();
+
+    CounterNameToValueMap before = BuildCounterNameToValueMap();
+    ASSERT_EQ(1u, before.count("blendStateCacheHits"));
+    ASSERT_EQ(1u, before.count("blendStateCacheMisses"));
+
+    drawWithBlendFunc(program, GL_ONE);
+    ASSERT_GL_NO_ERROR();
+
+    CounterNameToValueMap after = BuildCounterNameToValueMap();
+    EXPECT_GT(after["blendStateCacheHits"], before["blendStateCacheHits"]);
+    EXPECT_EQ(after["blendStateCacheMisses"], before["blendStateCacheMisses"]);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Tests that the render states stored in the blob cache on flush are created up front the next
+// time the cache is prewarmed, so that drawing with them is a cache hit.
+TEST_P(D3D11RenderStateCacheTest, PrewarmCreatesStoredStates)
+{
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    ANGLE_SKIP_TEST_IF(!IsEGLDisplayExtensionEnabled(display, "EGL_ANDROID_blob_cache"));
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    rx::Renderer11 *renderer11         = getRenderer11();
+    angle::D3D11PerfCounters &counters = renderer11->getPerfCounters();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glEnable(GL_BLEND);
+
+    const uint64_t missesBeforeDraw = counters.blendStateCacheMisses;
+    drawWithBlendFunc(program, GL_DST_COLOR);
+    EXPECT_GT(counters.blendStateCacheMisses, missesBeforeDraw);
+
+    // Flushing stores the keys of the new states in the blob cache.
+    glFlush();
+    ASSERT_GL_NO_ERROR();
+    ASSERT_FALSE(gApplicationCache.empty());
+
+    // Start over with an empty cache, as the next run would.
+    renderer11->resetRenderStateCacheForTesting();
+    const uint64_t prewarmedBefore = counters.prewarmedRenderStates;
+    ASSERT_EQ(angle::Result::Continue, renderer11->prewarmRenderStateCache(getContext()));
+    EXPECT_GT(counters.prewarmedRenderStates, prewarmedBefore);
+
+    // Switch away from the blend state so that it is looked up again.
+    drawWithBlendFunc(program, GL_ONE);
+    const uint64_t missesBeforeRedraw = counters.blendStateCacheMisses;
+    const uint64_t hitsBeforeRedraw   = counters.blendStateCacheHits;
+    drawWithBlendFunc(program, GL_DST_COLOR);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(counters.blendStateCacheMisses, missesBeforeRedraw);
+    EXPECT_GT(counters.blendStateCacheHits, hitsBeforeRedraw);
+}
+
+ANGLE_INSTANTIATE_TEST(D3D11RenderStateCacheTest,
+                       ES2_D3D11().enable(Feature::WarmUpRenderStateCache),
+                       ES3_D3D11().enable(Feature::WarmUpRenderStateCache));
+
+}  // anonymous namespace
@@ -563,7 +563,85 @@ TEST_P(ETCToBCTextureTest, ETC2Rgb8a1UnormToBC1)
     }
 }
 
+// Tests CPU transcode ETC2_RGB8 to BC1
+TEST_P(ETCToBCTextureTest, ETC2Rgb8UnormToBC1_CPU)
+{
+    ANGLE_SKIP_TEST_IF(!IsVulkan() ||
+                       !getEGLWindow()->isFeatureEnabled(Feature::TranscodeEtcToBc) ||
+                       getEGLWindow()->isFeatureEnabled(Feature::SupportsComputeTranscodeEtcToBc) ||
+                       !IsGLExtensionEnabled("GL_EXT_texture_compression_dxt1"));
+    glViewport(0, 0, kWidth, kHeight);
+    glBindTexture(GL_TEXTURE_2D, mEtcTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_RGB8_ETC2, kTexSize, kTexSize);
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTexSize, kTexSize, GL_COMPRESSED_RGB8_ETC2,
+                              sizeof(kEtcRGBData), kEtcRGBData);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    draw2DTexturedQuad(0.5f, 1.0f, false);
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            ANGLE_UNSAFE_TODO(
+                EXPECT_PIXEL_COLOR_NEAR(j, i, GLColor(kExpectedRGBColor[i * 4 + j]), kAbsError));
+        }
+    }
+}
+
+// Tests CPU transcode ETC2_RGBA8 to BC3
+TEST_P(ETCToBCTextureTest, ETC2Rgba8UnormToBC3_CPU)
+{
+    ANGLE_SKIP_TEST_IF(!IsVulkan() ||
+                       !getEGLWindow()->isFeatureEnabled(Feature::TranscodeEtcToBc) ||
+                       getEGLWindow()->isFeatureEnabled(Feature::SupportsComputeTranscodeEtcToBc) ||
+                       !IsGLExtensionEnabled("GL_EXT_texture_compression_s3tc"));
+    glViewport(0, 0, kWidth, kHeight);
+    glBindTexture(GL_TEXTURE_2D, mEtcTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_RGBA8_ETC2_EAC, kTexSize, kTexSize);
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTexSize, kTexSize,
+                              GL_COMPRESSED_RGBA8_ETC2_EAC, sizeof(kEtcRGBAData), kEtcRGBAData);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    draw2DTexturedQuad(0.5f, 1.0f, false);
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            ANGLE_UNSAFE_TODO(
+                EXPECT_PIXEL_COLOR_NEAR(j, i, GLColor(kExpectedRGBAColor[i * 4 + j]), kAbsError));
+        }
+    }
+}
+
+// Tests CPU transcode RGB8A1 to BC1_RGBA
+TEST_P(ETCToBCTextureTest, ETC2Rgb8a1UnormToBC1_CPU)
+{
+    ANGLE_SKIP_TEST_IF(!IsVulkan() ||
+                       !getEGLWindow()->isFeatureEnabled(Feature::TranscodeEtcToBc) ||
+                       getEGLWindow()->isFeatureEnabled(Feature::SupportsComputeTranscodeEtcToBc) ||
+                       !IsGLExtensionEnabled("GL_EXT_texture_compression_s3tc"));
+    glViewport(0, 0, kWidth, kHeight);
+    glBindTexture(GL_TEXTURE_2D, mEtcTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, kTexSize,
+                   kTexSize);
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTexSize, kTexSize,
+                              GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, sizeof(kRgb8a1),
+                              kRgb8a1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    draw2DTexturedQuad(0.5f, 1.0f, false);
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            ANGLE_UNSAFE_TODO(
+                EXPECT_PIXEL_COLOR_NEAR(j, i, GLColor(kExpectedRgb8a1[i * 4 + j]), kAbsError));
+        }
+    }
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(ETCTextureTest);
 ANGLE_INSTANTIATE_TEST_ES3_AND(ETCToBCTextureTest,
-                               ES3_VULKAN().enable(Feature::SupportsComputeTranscodeEtcToBc));
+                               ES3_VULKAN().enable(Feature::SupportsComputeTranscodeEtcToBc),
+                               ES3_VULKAN().enable(Feature::TranscodeEtcToBc));
 }  // anonymous namespace
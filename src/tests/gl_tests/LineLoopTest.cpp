@@ -375,6 +375,99 @@ TEST_P(LineLoopTest, LineLoopUIntIndexBufferNoBlend)
     runTestNoBlend(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
 }
 
+// Test that a line loop drawn repeatedly from a static index buffer picks up updates to the buffer.
+TEST_P(LineLoopTest, LineLoopStaticIndexBufferUpdate)
+{
+    // http://anglebug.com/42265165: Disable D3D11 SDK Layers warnings checks.
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLubyte indices[] = {0, 7, 6, 9, 8, 0};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        runTestBlend(GL_UNSIGNED_BYTE, buf, reinterpret_cast<const void *>(sizeof(GLubyte)));
+    }
+
+    // Collapse the loop into the center vertex, so that nothing is drawn.
+    static const GLubyte collapsedIndices[] = {0, 0, 0, 0, 0, 0};
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(collapsedIndices), collapsedIndices);
+
+    static const GLfloat loopPositions[] = {0.0f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,  0.0f,
+                                            0.0f,  0.0f, 0.0f, 0.0f, 0.0f, -0.5f, -0.5f,
+                                            -0.5f, 0.5f, 0.5f, 0.5f, 0.5f, -0.5f};
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, loopPositions);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_BYTE, reinterpret_cast<const void *>(1));
+    ASSERT_GL_NO_ERROR();
+
+    // The edges of the previous loop must be gone.
+    const int left  = getWindowWidth() / 4;
+    const int right = getWindowWidth() * 3 / 4;
+    for (int y = getWindowHeight() / 4 + 2; y < getWindowHeight() * 3 / 4 - 2; ++y)
+    {
+        for (int x : {left - 1, left, left + 1, right - 1, right, right + 1})
+        {
+            EXPECT_PIXEL_COLOR_EQ(x, y, GLColor::black);
+        }
+    }
+}
+
+// Test that updating one part of an index buffer only affects the line loops drawn from that part.
+TEST_P(LineLoopTest, LineLoopIndexBufferPartialUpdate)
+{
+    // http://anglebug.com/42265165: Disable D3D11 SDK Layers warnings checks.
+    ignoreD3D11SDKLayersWarnings();
+
+    // Two loops, the second one of which is collapsed into the center vertex.
+    static const GLushort indices[] = {0, 7, 6, 9, 8, 0, 0, 0, 0};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    runTestBlend(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+
+    // Modify the second loop, which must not affect the first one.
+    static const GLushort secondLoopIndices[] = {1, 1, 1, 1};
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * 5, sizeof(secondLoopIndices),
+                    secondLoopIndices);
+
+    runTestBlend(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+
+    // Collapse the first loop, so that nothing is drawn.
+    static const GLushort firstLoopIndices[] = {0, 0, 0, 0};
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort), sizeof(firstLoopIndices),
+                    firstLoopIndices);
+
+    static const GLfloat loopPositions[] = {0.0f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,  0.0f,
+                                            0.0f,  0.0f, 0.0f, 0.0f, 0.0f, -0.5f, -0.5f,
+                                            -0.5f, 0.5f, 0.5f, 0.5f, 0.5f, -0.5f};
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, loopPositions);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(sizeof(GLushort)));
+    ASSERT_GL_NO_ERROR();
+
+    const int left  = getWindowWidth() / 4;
+    const int right = getWindowWidth() * 3 / 4;
+    for (int y = getWindowHeight() / 4 + 2; y < getWindowHeight() * 3 / 4 - 2; ++y)
+    {
+        for (int x : {left - 1, left, left + 1, right - 1, right, right + 1})
+        {
+            EXPECT_PIXEL_COLOR_EQ(x, y, GLColor::black);
+        }
+    }
+}
+
 // Test that drawing elements between line loop arrays using the same array buffer does not result
 // in incorrect rendering.
 TEST_P(LineLoopTest, DrawTriangleElementsBetweenArrays)
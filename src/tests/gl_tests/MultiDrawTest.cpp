@@ -775,6 +775,28 @@ TEST_P(MultiDrawTest, MultiDrawElements)
     checkDrawResult(DrawIDOptionOverride::Default);
 }
 
+// Tests that glMultiDrawElementsANGLE followed by glDrawElements with offsets into the same index
+// buffer works.
+TEST_P(MultiDrawTest, MultiDrawElementsThenDrawElementsWithOffset)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(isInstancedTest());
+    setupBuffers();
+    setupProgram();
+    doDrawElements();
+    EXPECT_GL_NO_ERROR();
+    checkDrawResult(DrawIDOptionOverride::Default);
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    const GLsizei indexCount     = static_cast<GLsizei>(3 * kTriCount);
+    const GLsizei firstHalfCount = indexCount / 2;
+    glDrawElements(GL_TRIANGLES, firstHalfCount, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, indexCount - firstHalfCount, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(firstHalfCount * sizeof(GLushort)));
+    ASSERT_GL_NO_ERROR();
+    checkDrawResult(DrawIDOptionOverride::NoDrawID);
+}
+
 // Bool uniform does not have a precision. If the "uniform sort by precision" places bool uniform
 // in front of uniforms added by ANGLE (e.g. ANGLE_angle_DrawID), it can cause uniforms not
 // interpreted correctly on Mac. e.g. http://crbug.com/437678149 For example, following uniform
@@ -1248,6 +1248,92 @@ TEST_P(OcclusionQueriesTestES3, QueryReuseWithMultipleFBOs)
     EXPECT_GL_TRUE(result);
 }
 
+// Test that draws inside GL_NV_conditional_render are discarded when the query failed.
+TEST_P(OcclusionQueriesTest, ConditionalRender)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_NV_conditional_render"));
+
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    glDepthMask(GL_TRUE);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Draw an occluder, then a quad that's occluded and one that isn't, each with a query.
+    glEnable(GL_DEPTH_TEST);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.3f);
+
+    GLQueryEXT occludedQuery;
+    glBeginQueryEXT(GL_ANY_SAMPLES_PASSED_EXT, occludedQuery);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.8f);
+    glEndQueryEXT(GL_ANY_SAMPLES_PASSED_EXT);
+
+    GLQueryEXT visibleQuery;
+    glBeginQueryEXT(GL_ANY_SAMPLES_PASSED_EXT, visibleQuery);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), -0.5f);
+    glEndQueryEXT(GL_ANY_SAMPLES_PASSED_EXT);
+    glDisable(GL_DEPTH_TEST);
+    EXPECT_GL_NO_ERROR();
+
+    // The draw predicated on the occluded quad should be discarded.
+    glBeginConditionalRenderNV(occludedQuery, GL_QUERY_WAIT_NV);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    glEndConditionalRenderNV();
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+
+    // So should clears.
+    glBeginConditionalRenderNV(occludedQuery, GL_QUERY_NO_WAIT_NV);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEndConditionalRenderNV();
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+
+    // The draw predicated on the visible quad should go through.
+    glBeginConditionalRenderNV(visibleQuery, GL_QUERY_WAIT_NV);
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    glEndConditionalRenderNV();
+    EXPECT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+}
+
+// Test the errors generated by GL_NV_conditional_render.
+TEST_P(OcclusionQueriesTest, ConditionalRenderErrors)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_NV_conditional_render"));
+
+    GLQueryEXT query;
+    glBeginQueryEXT(GL_ANY_SAMPLES_PASSED_EXT, query);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+
+    // The query can't be used while it's active.
+    glBeginConditionalRenderNV(query, GL_QUERY_WAIT_NV);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+    glEndQueryEXT(GL_ANY_SAMPLES_PASSED_EXT);
+
+    // The query must exist and the mode must be valid.
+    glBeginConditionalRenderNV(0, GL_QUERY_WAIT_NV);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+    glBeginConditionalRenderNV(query, GL_ANY_SAMPLES_PASSED_EXT);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // Conditional rendering can't be ended unless it has begun.
+    glEndConditionalRenderNV();
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBeginConditionalRenderNV(query, GL_QUERY_BY_REGION_WAIT_NV);
+    EXPECT_GL_NO_ERROR();
+
+    // Conditional rendering can't be nested, and the query can't be restarted.
+    glBeginConditionalRenderNV(query, GL_QUERY_WAIT_NV);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+    glBeginQueryEXT(GL_ANY_SAMPLES_PASSED_EXT, query);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glEndConditionalRenderNV();
+    EXPECT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(OcclusionQueriesTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OcclusionQueriesTestES3);
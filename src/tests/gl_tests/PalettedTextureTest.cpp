@@ -14,6 +14,7 @@
 #include "util/random_utils.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include <vector>
 
@@ -148,6 +149,95 @@ TEST_P(PalettedTextureTest, PalettedTextureSampling)
     }
 }
 
+// Check that sampling paletted textures with 16-bit palettes works.  These may be kept in the
+// 16-bit format of their palette instead of being expanded to RGBA8.
+TEST_P(PalettedTextureTest, Packed16PalettedTextureSampling)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_OES_compressed_paletted_texture"));
+
+    struct Packed16Format
+    {
+        GLenum palette4Format;
+        GLenum palette8Format;
+        // Red, green, blue, and white or transparent black.
+        uint16_t colors[4];
+        GLColor lastColor;
+    };
+
+    const Packed16Format kFormats[] = {
+        {GL_PALETTE4_R5_G6_B5_OES,
+         GL_PALETTE8_R5_G6_B5_OES,
+         {0xF800, 0x07E0, 0x001F, 0xFFFF},
+         GLColor::white},
+        {GL_PALETTE4_RGBA4_OES,
+         GL_PALETTE8_RGBA4_OES,
+         {0xF00F, 0x0F0F, 0x00FF, 0x0000},
+         GLColor::transparentBlack},
+        {GL_PALETTE4_RGB5_A1_OES,
+         GL_PALETTE8_RGB5_A1_OES,
+         {0xF801, 0x07C1, 0x003F, 0x0000},
+         GLColor::transparentBlack},
+    };
+
+    struct Vertex
+    {
+        GLfloat position[3];
+        GLfloat uv[2];
+    };
+
+    const Vertex kVertices[] = {
+        {{-1.0f, -1.0f, 0.0f}, {0.0f, 0.0f}},
+        {{-1.0f, 1.0f, 0.0f}, {0.0f, 1.0f}},
+        {{1.0f, -1.0f, 0.0f}, {1.0f, 0.0f}},
+        {{1.0f, 1.0f, 0.0f}, {1.0f, 1.0f}},
+    };
+
+    glEnable(GL_TEXTURE_2D);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof kVertices[0], &kVertices[0].position);
+    glTexCoordPointer(2, GL_FLOAT, sizeof kVertices[0], &kVertices[0].uv);
+
+    for (const Packed16Format &format : kFormats)
+    {
+        for (uint32_t indexBits : {4u, 8u})
+        {
+            // The palette, followed by the 2x2 texels using its first four entries.
+            std::vector<uint8_t> data((size_t(1) << indexBits) * sizeof(uint16_t), 0);
+            memcpy(data.data(), format.colors, sizeof(format.colors));
+            if (indexBits == 4)
+            {
+                data.insert(data.end(), {0x01, 0x23});
+            }
+            else
+            {
+                data.insert(data.end(), {0x00, 0x01, 0x02, 0x03});
+            }
+
+            const GLenum internalFormat =
+                indexBits == 4 ? format.palette4Format : format.palette8Format;
+
+            GLTexture texture;
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glCompressedTexImage2D(GL_TEXTURE_2D, 0, internalFormat, 2, 2, 0,
+                                   static_cast<GLsizei>(data.size()), data.data());
+            ASSERT_GL_NO_ERROR();
+
+            glClearColor(0.4f, 0.4f, 0.4f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            ASSERT_GL_NO_ERROR();
+
+            EXPECT_PIXEL_COLOR_EQ(8, 8, GLColor::red) << internalFormat;
+            EXPECT_PIXEL_COLOR_EQ(24, 8, GLColor::green) << internalFormat;
+            EXPECT_PIXEL_COLOR_EQ(8, 24, GLColor::blue) << internalFormat;
+            EXPECT_PIXEL_COLOR_EQ(24, 24, format.lastColor) << internalFormat;
+        }
+    }
+}
+
 // Check that mipmap validation for paletted formats is correct.
 TEST_P(PalettedTextureTest, LevelValidation)
 {
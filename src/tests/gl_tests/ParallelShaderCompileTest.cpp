@@ -478,6 +478,41 @@ void main()
     EXPECT_GL_NO_ERROR();
 }
 
+// Tests that deleting programs and shaders while their compile and link jobs are in flight works,
+// and that programs built from the same sources afterwards are unaffected.
+TEST_P(ParallelShaderCompileTest, DeleteProgramsWhileCompileAndLinkInProgress)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    constexpr int kProgramCount = 16;
+    for (int i = 0; i < kProgramCount; ++i)
+    {
+        GLuint vs      = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+        GLuint fs      = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+        GLuint program = glCreateProgram();
+        ASSERT_NE(0u, vs);
+        ASSERT_NE(0u, fs);
+
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+
+        // Recompile one of the shaders while its previous compile may still be pending, and delete
+        // everything without waiting for the results.
+        const char *source = essl1_shaders::vs::Simple();
+        glShaderSource(vs, 1, &source, nullptr);
+        glCompileShader(vs);
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+        glDeleteProgram(program);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+}
+
 class ParallelShaderCompileTestES31 : public ParallelShaderCompileTest
 {};
 
@@ -755,6 +755,26 @@ TEST_P(ProvokingVertexBufferUpdateTest, DrawFlatWithPartialBufferSubUpdatesBetwe
     checkFlatQuadColors(kWidth, kHeight, GLColor::red, GLColor::green);
 }
 
+// Tests that drawing the same range of an index buffer over several frames, which lets the backend
+// reuse the indices it rewrote for the provoking vertex, still sees a later BufferSubData update.
+TEST_P(ProvokingVertexBufferUpdateTest, DrawFlatRepeatedThenBufferSubUpdate)
+{
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeOfVectorContents(mIndicesBlueYellow),
+                 mIndicesBlueYellow.data(), GL_STATIC_DRAW);
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        glDrawElements(GL_TRIANGLES, mNumVertsToDraw, GL_UNSIGNED_SHORT, nullptr);
+        checkFlatQuadColors(kWidth, kHeight, GLColor::blue, GLColor::yellow);
+    }
+
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeOfVectorContents(mIndicesRedGreen),
+                    mIndicesRedGreen.data());
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, mNumVertsToDraw, GL_UNSIGNED_SHORT, nullptr);
+    checkFlatQuadColors(kWidth, kHeight, GLColor::red, GLColor::green);
+}
+
 // Only run these tests on Metal. Other backends tend to time out the test suite but not crash.
 class ProvokingVertexTestMetal : public ProvokingVertexTest
 {};
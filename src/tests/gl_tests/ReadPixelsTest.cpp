@@ -1714,6 +1714,52 @@ TEST_P(ReadPixelsFloat32TypePBOTest, Basic)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test reading into a PBO with GL_ANGLE_pack_reverse_row_order, where the rows have to be flipped
+// while copying.
+TEST_P(ReadPixelsFloat32TypePBOTest, ReverseRowOrder)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_ANGLE_pack_reverse_row_order"));
+
+    constexpr GLuint kWidth  = 4;
+    constexpr GLuint kHeight = 3;
+    reset(kWidth * kHeight * sizeof(GLColor32F), kWidth, kHeight);
+
+    // Clear each row to a different color.
+    const GLColor32F kRowColors[kHeight] = {GLColor32F(0.5f, 0.2f, 0.3f, 0.4f),
+                                            GLColor32F(0.1f, 0.6f, 0.7f, 0.8f),
+                                            GLColor32F(0.9f, 0.0f, 0.25f, 1.0f)};
+    glEnable(GL_SCISSOR_TEST);
+    for (GLuint row = 0; row < kHeight; ++row)
+    {
+        glScissor(0, row, kWidth, 1);
+        glClearColor(kRowColors[row].R, kRowColors[row].G, kRowColors[row].B, kRowColors[row].A);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+    glDisable(GL_SCISSOR_TEST);
+    EXPECT_GL_NO_ERROR();
+
+    glPixelStorei(GL_PACK_REVERSE_ROW_ORDER_ANGLE, GL_TRUE);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    glReadPixels(0, 0, kWidth, kHeight, GL_RGBA, GL_FLOAT, 0);
+    glPixelStorei(GL_PACK_REVERSE_ROW_ORDER_ANGLE, GL_FALSE);
+    EXPECT_GL_NO_ERROR();
+
+    void *mappedPtr = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mPBOBufferSize, GL_MAP_READ_BIT);
+    GLColor32F *dataColor = static_cast<GLColor32F *>(mappedPtr);
+    EXPECT_GL_NO_ERROR();
+
+    for (GLuint row = 0; row < kHeight; ++row)
+    {
+        for (GLuint x = 0; x < kWidth; ++x)
+        {
+            EXPECT_EQ(kRowColors[kHeight - 1 - row], dataColor[row * kWidth + x]);
+        }
+    }
+
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    EXPECT_GL_NO_ERROR();
+}
+
 // a test class to be used for error checking of glReadPixels with WebGLCompatibility
 class ReadPixelsWebGLErrorTest : public ReadPixelsTest
 {
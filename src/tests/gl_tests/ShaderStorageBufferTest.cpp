@@ -377,6 +377,72 @@ TEST_P(ShaderStorageBufferTest31, ShaderStorageBufferReadWrite)
     EXPECT_GL_NO_ERROR();
 }
 
+// Tests rebinding shader storage buffers and buffer ranges between dispatches without waiting.
+// Every dispatch must see its own bindings.
+TEST_P(ShaderStorageBufferTest31, RebindBetweenDispatches)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) readonly buffer Input {
+    uint value;
+} inputBlock;
+layout(std430, binding = 1) buffer Output {
+    uint value;
+} outputBlock;
+void main()
+{
+    outputBlock.value = inputBlock.value + 1u;
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kCS);
+    glUseProgram(program);
+
+    GLint offsetAlignment = 0;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+    ASSERT_GT(offsetAlignment, 0);
+
+    constexpr uint32_t kDispatchCount = 8;
+    const GLsizeiptr kStride          = offsetAlignment;
+
+    std::vector<GLuint> inputData(kDispatchCount * kStride / sizeof(GLuint), 0);
+    for (uint32_t dispatch = 0; dispatch < kDispatchCount; ++dispatch)
+    {
+        inputData[dispatch * kStride / sizeof(GLuint)] = dispatch * 10;
+    }
+
+    GLBuffer inputBuffer;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, inputBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, inputData.size() * sizeof(GLuint), inputData.data(),
+                 GL_STATIC_DRAW);
+
+    GLBuffer outputBuffers[kDispatchCount];
+    for (uint32_t dispatch = 0; dispatch < kDispatchCount; ++dispatch)
+    {
+        constexpr GLuint kZero = 0;
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, outputBuffers[dispatch]);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(kZero), &kZero, GL_STATIC_DRAW);
+
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 0, inputBuffer, dispatch * kStride,
+                          sizeof(GLuint));
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, outputBuffers[dispatch]);
+        glDispatchCompute(1, 1, 1);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    for (uint32_t dispatch = 0; dispatch < kDispatchCount; ++dispatch)
+    {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, outputBuffers[dispatch]);
+        const GLuint *ptr = reinterpret_cast<const GLuint *>(
+            glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), GL_MAP_READ_BIT));
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(dispatch * 10 + 1, *ptr);
+        glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    }
+
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test shader storage buffer write followed by glTexSUbData and followed by shader storage write
 // again.
 TEST_P(ShaderStorageBufferTest31, ShaderStorageBufferReadWriteAndBufferSubData)
@@ -3540,6 +3606,10 @@ void main() {
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ShaderStorageBufferTest31);
 ANGLE_INSTANTIATE_TEST_ES31_AND(ShaderStorageBufferTest31,
-                                ES31_VULKAN().enable(Feature::PreferCPUForBufferSubData));
+                                ES31_VULKAN().enable(Feature::PreferCPUForBufferSubData),
+                                ES31_VULKAN()
+                                    .enable(Feature::UsePushDescriptorsForStorageBuffers)
+                                    .disable(Feature::UsePushDescriptorsForTextures)
+                                    .disable(Feature::UsePushDescriptorsForUniformBuffers));
 
 }  // namespace
@@ -1589,6 +1589,82 @@ TEST_P(SimpleOperationTest, DrawSingleMultiSampleWithAlphaToCoverage)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
 }
 
+// Draw many quads in one render pass, switching program and uniforms between them.  On Metal with
+// enableParallelRenderEncoding, this splits the pass into several chunks that are encoded
+// concurrently, each of which has to replay the state left by the previous one.
+TEST_P(SimpleOperationTest, DrawManyQuadsInOneRenderPass)
+{
+    constexpr int kCellSize  = 4;
+    constexpr int kGridSize  = 32;
+    constexpr int kCellCount = kGridSize * kGridSize;
+    ASSERT_EQ(getWindowWidth(), kCellSize * kGridSize);
+    ASSERT_EQ(getWindowHeight(), kCellSize * kGridSize);
+
+    ANGLE_GL_PROGRAM(uniformProgram, essl1_shaders::vs::Simple(),
+                     essl1_shaders::fs::UniformColor());
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    GLint colorLocation = glGetUniformLocation(uniformProgram, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    const std::array<Vector3, 6> quadVertices = GetQuadVertices();
+    GLBuffer vertexBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+    for (GLuint program : {uniformProgram.get(), greenProgram.get()})
+    {
+        ASSERT_EQ(0, glGetAttribLocation(program, essl1_shaders::PositionAttrib()));
+    }
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(0);
+
+    auto cellColor = [](int x, int y) {
+        return GLColor(static_cast<GLubyte>(x * 8), static_cast<GLubyte>(y * 8),
+                       static_cast<GLubyte>((x + y) % 2 * 255), 255);
+    };
+    auto isGreenCell = [](int x, int y) { return (x + y) % 3 == 0; };
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glEnable(GL_SCISSOR_TEST);
+    for (int cell = 0; cell < kCellCount; ++cell)
+    {
+        const int x = cell % kGridSize;
+        const int y = cell / kGridSize;
+        glScissor(x * kCellSize, y * kCellSize, kCellSize, kCellSize);
+
+        if (isGreenCell(x, y))
+        {
+            glUseProgram(greenProgram);
+        }
+        else
+        {
+            glUseProgram(uniformProgram);
+            glUniform4fv(colorLocation, 1, cellColor(x, y).toNormalizedVector().data());
+        }
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    std::vector<GLColor> pixels(kCellCount * kCellSize * kCellSize);
+    glReadPixels(0, 0, getWindowWidth(), getWindowHeight(), GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels.data());
+    ASSERT_GL_NO_ERROR();
+
+    for (int y = 0; y < kGridSize; ++y)
+    {
+        for (int x = 0; x < kGridSize; ++x)
+        {
+            const int pixelX        = x * kCellSize + kCellSize / 2;
+            const int pixelY        = y * kCellSize + kCellSize / 2;
+            const GLColor &expected = isGreenCell(x, y) ? GLColor::green : cellColor(x, y);
+            EXPECT_EQ(expected, pixels[pixelY * getWindowWidth() + pixelX])
+                << "cell (" << x << ", " << y << ")";
+        }
+    }
+}
+
 // Test glGetRenderbufferParameteriv returned value for different render buffer
 TEST_P(SimpleOperationTest, GetRenderbufferParameter)
 {
@@ -1691,6 +1767,7 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     SimpleOperationTest,
     ES3_METAL().enable(Feature::ForceBufferGPUStorage),
     ES3_METAL().disable(Feature::HasExplicitMemBarrier).disable(Feature::HasCheapRenderPass),
+    ES3_METAL().enable(Feature::EnableParallelRenderEncoding),
     WithVulkanSecondaries(ES3_VULKAN_SWIFTSHADER()));
 
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
@@ -2341,6 +2341,48 @@ TEST_P(Texture2DTest, ManySupersedingTextureUpdates)
     EXPECT_PIXEL_COLOR_EQ(0, 0, kGray);
 }
 
+// Test that alternating whole and partial updates of a texture, as streamed textures do, keep the
+// untouched parts of the partial updates.
+TEST_P(Texture2DTest, StreamedWholeAndPartialUpdates)
+{
+    constexpr GLsizei kSize = 16;
+    const GLColor kColors[] = {GLColor::red, GLColor::green, GLColor::blue, GLColor::yellow};
+
+    setUpProgram();
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+
+    for (uint32_t iteration = 0; iteration < 2; ++iteration)
+    {
+        GLTexture texture;
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     nullptr);
+
+        for (size_t colorIndex = 0; colorIndex + 1 < ArraySize(kColors); ++colorIndex)
+        {
+            const GLColor &wholeColor   = kColors[colorIndex];
+            const GLColor &partialColor = kColors[colorIndex + 1];
+
+            std::vector<GLColor> wholeData(kSize * kSize, wholeColor);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                            wholeData.data());
+            drawQuad(mProgram, "position", 0.5f);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, wholeColor);
+
+            std::vector<GLColor> partialData((kSize / 2) * (kSize / 2), partialColor);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize / 2, kSize / 2, GL_RGBA,
+                            GL_UNSIGNED_BYTE, partialData.data());
+            drawQuad(mProgram, "position", 0.5f);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, partialColor);
+            EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, wholeColor);
+        }
+    }
+    EXPECT_GL_NO_ERROR();
+}
+
 TEST_P(Texture2DTest, DefineMultipleLevelsWithoutMipmapping)
 {
     setUpProgram();
@@ -16459,6 +16501,45 @@ TEST_P(Texture2DTestES3Foveation, FoveatedTextureDraw)
     EXPECT_PIXEL_COLOR_EQ(0, 0, angle::GLColor::blue);
 }
 
+// QCOM framebuffer foveated rendering to the default framebuffer, across swaps
+TEST_P(Texture2DTestES3Foveation, DefaultFramebufferDraw)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_QCOM_framebuffer_foveated"));
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Just need 1 focal point
+    GLuint providedFeatures = 0;
+    glFramebufferFoveationConfigQCOM(0, 1, 1, GL_FOVEATION_ENABLE_BIT_QCOM, &providedFeatures);
+    ASSERT_NE(providedFeatures & GL_FOVEATION_ENABLE_BIT_QCOM, 0u);
+    // Set foveation parameters
+    glFramebufferFoveationParametersQCOM(0, 0, 0, 0.0f, 0.0f, 8.0f, 8.0f, 0.0f);
+    EXPECT_GL_NO_ERROR();
+
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    ANGLE_GL_PROGRAM(blueProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Blue());
+
+    const int width  = getWindowWidth();
+    const int height = getWindowHeight();
+    for (GLuint program : {greenProgram.get(), blueProgram.get()})
+    {
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_GL_NO_ERROR();
+
+        const GLColor expected =
+            program == greenProgram.get() ? angle::GLColor::green : angle::GLColor::blue;
+        EXPECT_PIXEL_COLOR_EQ(0, 0, expected);
+        EXPECT_PIXEL_COLOR_EQ(width / 2, height / 2, expected);
+        EXPECT_PIXEL_COLOR_EQ(width - 1, height - 1, expected);
+
+        // Move the focal point for the next frame
+        glFramebufferFoveationParametersQCOM(0, 0, 0, 0.5f, -0.5f, 8.0f, 8.0f, 0.0f);
+        swapBuffers();
+    }
+}
+
 // QCOM texture foveated rendering to MSAA texture followed by a blit
 TEST_P(Texture2DTestES31Foveation, MsaaTextureDrawThenUseAsBlitSource)
 {
@@ -20785,7 +20866,9 @@ void main()
 ANGLE_INSTANTIATE_TEST_ES2_AND(Texture2DTest,
                                ES2_EMULATE_COPY_TEX_IMAGE_VIA_SUB(),
                                ES2_EMULATE_COPY_TEX_IMAGE(),
-                               ES2_OPENGLES().enable(Feature::ForcePassthroughShaders));
+                               ES2_OPENGLES().enable(Feature::ForcePassthroughShaders),
+                               ES2_VULKAN().enable(Feature::UsePushDescriptorsForTextures),
+                               ES2_VULKAN().disable(Feature::UsePushDescriptorsForTextures));
 ANGLE_INSTANTIATE_TEST_ES2(TextureCubeTest);
 ANGLE_INSTANTIATE_TEST_ES2(Texture2DTestWithDrawScale);
 ANGLE_INSTANTIATE_TEST_ES2(Sampler2DAsFunctionParameterTest);
@@ -20796,7 +20879,11 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3,
                                ES3_VULKAN().enable(Feature::AllocateNonZeroMemory),
                                ES3_VULKAN().enable(Feature::ForceFallbackFormat),
-                               ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferBGR565ToRGB565));
+                               ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferBGR565ToRGB565),
+                               ES3_VULKAN().enable(Feature::UsePushDescriptorsForTextures),
+                               ES3_VULKAN()
+                                   .enable(Feature::UseImmutableSamplersForTextures)
+                                   .disable(Feature::UsePushDescriptorsForTextures));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DMemoryTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(Texture2DMemoryTestES3);
@@ -21484,6 +21571,113 @@ TEST_P(Texture2DTestES3, ClearMidRenderPassThenSample)
     ASSERT_GL_NO_ERROR();
 }
 
+constexpr char kSampleLevelOneFS[] = R"(#version 300 es
+precision highp float;
+uniform highp sampler2D tex;
+in vec2 texcoord;
+out vec4 fragColor;
+void main()
+{
+    fragColor = textureLod(tex, texcoord, 1.0);
+})";
+
+// Create a 2x2 texture whose level 0 is red and level 1 is green.  Sampling level 1 yields red
+// with a GL_NEAREST min filter and green with a mipmapped min filter.
+void SetupRedGreenMipTexture(GLuint texture)
+{
+    const std::vector<GLColor> level0(4, GLColor::red);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 2, GL_RGBA8, 2, 2);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, level0.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 1, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::green);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+}
+
+// Test that changing the texture's sampler state between draws is honored.  With the
+// useImmutableSamplersForTextures feature, this changes the binding's immutable sampler.
+TEST_P(Texture2DTestES3, SamplerStateChangeBetweenDraws)
+{
+    ANGLE_GL_PROGRAM(program, getVertexShaderSource(), kSampleLevelOneFS);
+
+    GLTexture texture;
+    SetupRedGreenMipTexture(texture);
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::red);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::green);
+
+    // Change the sampler state between draws of the same render pass.
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, w / 2, h);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    drawQuad(program, "position", 0.5f);
+    glScissor(w / 2, 0, w - w / 2, h);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    drawQuad(program, "position", 0.5f);
+    glDisable(GL_SCISSOR_TEST);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, w / 2, h, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(w / 2, 0, w - w / 2, h, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that binding, unbinding and deleting sampler objects between draws is honored.  With the
+// useImmutableSamplersForTextures feature, this changes the binding's immutable sampler.
+TEST_P(Texture2DTestES3, SamplerObjectChangeBetweenDraws)
+{
+    ANGLE_GL_PROGRAM(program, getVertexShaderSource(), kSampleLevelOneFS);
+
+    GLTexture texture;
+    SetupRedGreenMipTexture(texture);
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::red);
+
+    GLSampler mipmapSampler;
+    glSamplerParameteri(mipmapSampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glSamplerParameteri(mipmapSampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glBindSampler(0, mipmapSampler);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::green);
+
+    glBindSampler(0, 0);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::red);
+
+    // Deleting a bound sampler unbinds it, so the texture's own sampler state is used again.
+    GLuint deletedSampler = 0;
+    glGenSamplers(1, &deletedSampler);
+    glSamplerParameteri(deletedSampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glSamplerParameteri(deletedSampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindSampler(0, deletedSampler);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::green);
+
+    glDeleteSamplers(1, &deletedSampler);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::red);
+
+    // A new sampler with the same state as the deleted one should work as well.
+    GLSampler newSampler;
+    glSamplerParameteri(newSampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glSamplerParameteri(newSampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindSampler(0, newSampler);
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, w, h, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TextureSizeLimitTest);
 ANGLE_INSTANTIATE_TEST(TextureSizeLimitTest,
                        ES2_D3D11().enable(Feature::LimitMaxTextureBytesTo1MB),
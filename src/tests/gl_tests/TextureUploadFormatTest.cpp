@@ -681,6 +681,67 @@ TEST_P(TextureUploadFormatTest_ES3, AllWithPBO)
     TestAll(UploadSource::PBO);
 }
 
+// Test large RGB8 uploads, which may be staged as RGB and expanded to RGBA on the GPU.
+TEST_P(TextureUploadFormatTest_ES3, LargeRGB8)
+{
+    constexpr GLsizei kSize   = 128;
+    constexpr GLsizei kLayers = 3;
+
+    std::vector<uint8_t> data(kSize * kSize * kLayers * 3);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + i / 3);
+    }
+
+    auto verifyLayer = [&](GLint layer) {
+        std::vector<GLColor> actual(kSize * kSize);
+        glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, actual.data());
+        ASSERT_GL_NO_ERROR();
+
+        const uint8_t *layerData = data.data() + layer * kSize * kSize * 3;
+        for (GLsizei i = 0; i < kSize * kSize; ++i)
+        {
+            const GLColor expected(layerData[i * 3], layerData[i * 3 + 1], layerData[i * 3 + 2],
+                                   255);
+            ASSERT_EQ(expected, actual[i]) << "layer " << layer << " pixel " << i;
+        }
+    };
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    // Full 2D upload.
+    GLTexture texture2D;
+    glBindTexture(GL_TEXTURE_2D, texture2D);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, kSize, kSize, 0, GL_RGB, GL_UNSIGNED_BYTE, data.data());
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture2D, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    verifyLayer(0);
+
+    // Sub-image upload over the second half of the texture, with the unpack row length set.
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, kSize);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, kSize / 2);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, kSize / 2, kSize, kSize / 2, GL_RGB, GL_UNSIGNED_BYTE,
+                    data.data() + kSize * kSize * 3);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    std::copy(data.begin() + kSize * kSize * 3 + kSize * (kSize / 2) * 3,
+              data.begin() + kSize * kSize * 3 * 2, data.begin() + kSize * (kSize / 2) * 3);
+    verifyLayer(0);
+
+    // Multi-layer upload.
+    GLTexture texture2DArray;
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texture2DArray);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGB8, kSize, kSize, kLayers, 0, GL_RGB,
+                 GL_UNSIGNED_BYTE, data.data());
+    for (GLint layer = 0; layer < kLayers; ++layer)
+    {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture2DArray, 0, layer);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+        verifyLayer(layer);
+    }
+}
+
 // Test invalid upload format combinations in ES2
 TEST_P(TextureUploadFormatTest, InvalidTypeAndFormat)
 {
@@ -710,4 +771,5 @@ TEST_P(TextureUploadFormatTest, InvalidTypeAndFormat)
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(TextureUploadFormatTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TextureUploadFormatTest_ES3);
-ANGLE_INSTANTIATE_TEST_ES3(TextureUploadFormatTest_ES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(TextureUploadFormatTest_ES3,
+                               ES3_VULKAN().enable(Feature::ExpandRgbUploadsWithCompute));
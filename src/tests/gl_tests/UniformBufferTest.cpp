@@ -3118,6 +3118,96 @@ TEST_P(UniformBufferTest, ManyBlocks)
     EXPECT_PIXEL_NEAR(getWindowWidth() / 2, 0, 78, 98, 78, 255, 2);
 }
 
+// Test that a program with more uniform blocks than fit in a single push descriptor set works.
+// With push descriptors enabled, the Vulkan backend falls back to regular descriptor sets here.
+TEST_P(UniformBufferTest, MoreBlocksThanPushDescriptorLimit)
+{
+    // http://anglebug.com/42263608
+    ANGLE_SKIP_TEST_IF(IsD3D11());
+
+    constexpr int kBlocksPerStage = 9;
+    constexpr int kTotalBlocks    = kBlocksPerStage * 2;
+
+    GLint maxVertexBlocks   = 0;
+    GLint maxFragmentBlocks = 0;
+    GLint maxBindings       = 0;
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_BLOCKS, &maxVertexBlocks);
+    glGetIntegerv(GL_MAX_FRAGMENT_UNIFORM_BLOCKS, &maxFragmentBlocks);
+    glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxBindings);
+    ANGLE_SKIP_TEST_IF(maxVertexBlocks < kBlocksPerStage || maxFragmentBlocks < kBlocksPerStage ||
+                       maxBindings < kTotalBlocks);
+
+    constexpr char kVS[] =
+        R"(#version 300 es
+
+        in vec4 a_position;
+        out vec4 v_color;
+
+        layout(std140) uniform vsBlock { vec4 color; } vsBlocks[9];
+
+        void main()
+        {
+            v_color = vec4(0);
+            for (int i = 0; i < 9; ++i)
+            {
+                v_color += vsBlocks[i].color;
+            }
+            gl_Position = a_position;
+        })";
+
+    constexpr char kFS[] =
+        R"(#version 300 es
+
+        precision highp float;
+        in vec4 v_color;
+        out vec4 my_FragColor;
+
+        layout(std140) uniform fsBlock { vec4 color; } fsBlocks[9];
+
+        void main()
+        {
+            vec4 color = v_color;
+            for (int i = 0; i < 9; ++i)
+            {
+                color += fsBlocks[i].color;
+            }
+            my_FragColor = vec4(color.rgb, 1.0);
+        })";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+
+    GLBuffer buffers[kTotalBlocks];
+    std::vector<GLubyte> v(16, 0);
+    float *vAsFloat = reinterpret_cast<float *>(v.data());
+
+    for (int i = 0; i < kTotalBlocks; ++i)
+    {
+        const bool isVertexBlock = i < kBlocksPerStage;
+        const std::string blockName =
+            std::string(isVertexBlock ? "vsBlock[" : "fsBlock[") +
+            std::to_string(isVertexBlock ? i : i - kBlocksPerStage) + "]";
+        GLuint blockIndex = glGetUniformBlockIndex(program, blockName.c_str());
+        ASSERT_NE(blockIndex, GL_INVALID_INDEX);
+
+        glBindBuffer(GL_UNIFORM_BUFFER, buffers[i]);
+        vAsFloat[0] = (i + 1) / 255.0f;
+        vAsFloat[1] = (i + 1) / 255.0f;
+        vAsFloat[2] = (i + 1) / 255.0f;
+        vAsFloat[3] = .0f;
+
+        glBufferData(GL_UNIFORM_BUFFER, v.size(), v.data(), GL_STATIC_DRAW);
+
+        glBindBufferBase(GL_UNIFORM_BUFFER, i, buffers[i]);
+        glUniformBlockBinding(program, blockIndex, i);
+    }
+
+    drawQuad(program, "a_position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    // The sum of 1..18 is 171.
+    EXPECT_PIXEL_COLOR_NEAR(0, 0, GLColor(171, 171, 171, 255), 2);
+}
+
 // These suite cases test the uniform blocks with a large array member. Unlike other uniform
 // blocks that will be translated to cbuffer type on D3D backend, we will tranlate these
 // uniform blocks to StructuredBuffer for slow fxc compile performance issue with dynamic
@@ -4989,7 +5079,10 @@ void main()
 }
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformBufferTest);
-ANGLE_INSTANTIATE_TEST_ES3(UniformBufferTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(UniformBufferTest,
+                               ES3_VULKAN()
+                                   .enable(Feature::UsePushDescriptorsForUniformBuffers)
+                                   .disable(Feature::UsePushDescriptorsForTextures));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformBufferShadowBufferTest);
 ANGLE_INSTANTIATE_TEST_ES3_AND(UniformBufferShadowBufferTest,
@@ -6168,6 +6168,75 @@ void main() {
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that two vertex arrays reading the same buffer with an emulated format both see updates
+// to the buffer.  Backends may share the converted data between the vertex arrays.
+TEST_P(VertexAttributeTestES3, MultipleVertexArraysSameConvertedBuffer)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_OES_vertex_type_10_10_10_2"));
+
+    constexpr char kVS[] = R"(attribute vec2 position;
+attribute vec4 attrib;
+varying vec4 color;
+void main() {
+    gl_Position = vec4(position, 0, 1);
+    color = attrib;
+})";
+    constexpr char kFS[] = R"(varying lowp vec4 color;
+void main() {
+    gl_FragColor = color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    const GLint posLoc    = glGetAttribLocation(program, "position");
+    const GLint attribLoc = glGetAttribLocation(program, "attrib");
+
+    constexpr std::array<float, 6> kTriangle = {-1, -1, 3, -1, -1, 3};
+    GLBuffer posBuf;
+    glBindBuffer(GL_ARRAY_BUFFER, posBuf);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kTriangle), kTriangle.data(), GL_STATIC_DRAW);
+
+    // Blue, with alpha:
+    std::array<uint32_t, 3> attribs = {0x000007FD, 0x000007FD, 0x000007FD};
+    GLBuffer attribBuf;
+    glBindBuffer(GL_ARRAY_BUFFER, attribBuf);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(attribs), attribs.data(), GL_STATIC_DRAW);
+
+    // Set up two vertex arrays that are identical, so the format conversion of |attribBuf| can be
+    // reused between them.
+    GLVertexArray vaos[2];
+    for (GLVertexArray &vao : vaos)
+    {
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, posBuf);
+        glEnableVertexAttribArray(posLoc);
+        glVertexAttribPointer(posLoc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glBindBuffer(GL_ARRAY_BUFFER, attribBuf);
+        glEnableVertexAttribArray(attribLoc);
+        glVertexAttribPointer(attribLoc, 4, GL_INT_10_10_10_2_OES, GL_TRUE, 0, nullptr);
+    }
+
+    for (GLVertexArray &vao : vaos)
+    {
+        glBindVertexArray(vao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::blue);
+    }
+
+    // Change the data to green (with alpha), and make sure both vertex arrays observe the change.
+    attribs.fill(0x001FF001);
+    glBindBuffer(GL_ARRAY_BUFFER, attribBuf);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(attribs), attribs.data());
+
+    for (GLVertexArray &vao : vaos)
+    {
+        glBindVertexArray(vao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::green);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 class VertexAttributeUint8Test : public VertexAttributeTestES3
 {};
 
@@ -6764,6 +6833,8 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     ES3_VULKAN_SWIFTSHADER().enable(Feature::ForceFallbackFormat),
     ES3_VULKAN().disable(Feature::ForceSizePointerForBoundVertexBuffers),
     ES3_VULKAN_SWIFTSHADER().disable(Feature::ForceSizePointerForBoundVertexBuffers),
+    ES2_VULKAN().enable(Feature::ShareStreamedVertexBufferAcrossAttribs),
+    ES3_VULKAN().enable(Feature::ShareStreamedVertexBufferAcrossAttribs),
     ES3_METAL().disable(Feature::HasExplicitMemBarrier).disable(Feature::HasCheapRenderPass),
     ES3_METAL().disable(Feature::HasExplicitMemBarrier).enable(Feature::HasCheapRenderPass),
     ES2_OPENGL().enable(Feature::ForceMinimumMaxVertexAttributes),
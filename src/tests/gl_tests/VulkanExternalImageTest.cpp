@@ -255,6 +255,9 @@ class VulkanExternalRGB565ImageTest : public VulkanExternalImageTest
 class VulkanExternalImageTestES31 : public VulkanExternalImageTest
 {};
 
+class VulkanExternalImageDeferredSignalTest : public VulkanExternalImageTest
+{};
+
 template <typename Traits>
 void RunShouldImportMemoryTest(VkImageCreateFlags createFlags,
                                VkImageUsageFlags usageFlags,
@@ -777,7 +780,8 @@ void RunShouldClearWithSemaphoresTest(bool useMemoryObjectFlags,
                                       VkImageCreateFlags createFlags,
                                       VkImageUsageFlags usageFlags,
                                       bool isSwiftshader,
-                                      bool enableDebugLayers)
+                                      bool enableDebugLayers,
+                                      bool flushAfterSignal = false)
 {
     ASSERT(EnsureGLExtensionEnabled(Traits::MemoryObjectExtension()));
     ASSERT(EnsureGLExtensionEnabled(Traits::SemaphoreExtension()));
@@ -882,6 +886,10 @@ void RunShouldClearWithSemaphoresTest(bool useMemoryObjectFlags,
                       "barrierTextures and textureDstLayouts must be the same length");
         glSignalSemaphoreEXT(glReleaseSemaphore, 0, nullptr, textureBarriersCount, barrierTextures,
                              textureDstLayouts);
+        if (flushAfterSignal)
+        {
+            glFlush();
+        }
 
         helper.waitSemaphoreAndAcquireImage(image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
@@ -920,6 +928,17 @@ TEST_P(VulkanExternalImageTest, ShouldClearOpaqueFdWithSemaphores)
                                                      enableDebugLayers());
 }
 
+// Test that a semaphore signal deferred to the next submission is submitted by glFlush.
+TEST_P(VulkanExternalImageDeferredSignalTest, ShouldClearOpaqueFdWithSemaphoresAndFlush)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_memory_object_fd"));
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_semaphore_fd"));
+
+    RunShouldClearWithSemaphoresTest<OpaqueFdTraits>(false, kDefaultImageCreateFlags,
+                                                     kDefaultImageUsageFlags, isSwiftshader(),
+                                                     enableDebugLayers(), true);
+}
+
 // Test creating and clearing RGBA8 texture in opaque fd with acquire/release, using
 // GL_ANGLE_memory_object_flags.
 TEST_P(VulkanExternalImageTest, ShouldClearOpaqueFdWithSemaphoresWithFlags)
@@ -1907,6 +1926,9 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(VulkanExternalImageTest,
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     VulkanExternalRGB565ImageTest,
     ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferBGR565ToRGB565));
+ANGLE_INSTANTIATE_TEST(VulkanExternalImageDeferredSignalTest,
+                       ES3_VULKAN(),
+                       ES3_VULKAN().enable(Feature::DeferExternalSemaphoreSignal));
 ANGLE_INSTANTIATE_TEST_ES31_AND(VulkanExternalImageTestES31,
                                 ES31_VULKAN().enable(Feature::ForceRenderableFallbackFormat));
 }  // namespace angle
@@ -797,6 +797,62 @@ TEST_P(VulkanPerformanceCounterTest, NewTextureDoesNotBreakRenderPass)
     EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
 }
 
+// Tests that every render pass is counted either as executed inline in the primary command buffer
+// or as executed from secondary command buffers.
+TEST_P(VulkanPerformanceCounterTest, RenderPassExecutionIsCounted)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    const angle::VulkanPerfCounters before = getPerfCounters();
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    const angle::VulkanPerfCounters after = getPerfCounters();
+    EXPECT_EQ(after.renderPasses - before.renderPasses, 1u);
+    EXPECT_EQ(after.renderPassesExecutedInline + after.renderPassesExecutedFromSecondaries -
+                  before.renderPassesExecutedInline - before.renderPassesExecutedFromSecondaries,
+              1u);
+}
+
+// Tests that switching a framebuffer back and forth between attachments hits the completeness
+// cache.
+TEST_P(VulkanPerformanceCounterTest, PingPongAttachmentsHitCompletenessCache)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    std::array<GLTexture, 2> textures;
+    for (GLTexture &texture : textures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    // The first time each texture is attached, the completeness is checked in full.
+    for (GLTexture &texture : textures)
+    {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        EXPECT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    }
+    const uint64_t expectedMisses = getPerfCounters().framebufferCompletenessCacheMisses;
+    const uint64_t initialHits    = getPerfCounters().framebufferCompletenessCacheHits;
+
+    constexpr uint32_t kSwitchCount = 8;
+    for (uint32_t switchIndex = 0; switchIndex < kSwitchCount; ++switchIndex)
+    {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               textures[switchIndex % textures.size()], 0);
+        EXPECT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(getPerfCounters().framebufferCompletenessCacheMisses, expectedMisses);
+    EXPECT_GE(getPerfCounters().framebufferCompletenessCacheHits, initialHits + kSwitchCount);
+}
+
 // Tests that each update for a large cube map face results in outside command buffer submission.
 TEST_P(VulkanPerformanceCounterTest, LargeCubeMapUpdatesSubmitsOutsideCommandBuffer)
 {
@@ -1129,6 +1185,41 @@ TEST_P(VulkanPerformanceCounterTest, ClearTextureEXTFullColorImageClear3D)
     EXPECT_EQ(getPerfCounters().fullImageClears, expectedFullImageClears);
 }
 
+// Tests that uploads that need format conversion are converted and copied to the image on the host
+// when VK_EXT_host_image_copy is used.
+TEST_P(VulkanPerformanceCounterTest, HostImageCopyWithConversion)
+{
+    ANGLE_SKIP_TEST_IF(!hasSupportsHostImageCopy());
+
+    constexpr GLsizei kTexDim = 16;
+
+    // RGB8 is stored as RGBA8, so the data is expanded on upload.
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGB8, kTexDim, kTexDim);
+
+    const uint64_t expectedRegions = getPerfCounters().bufferToImageCopyRegions;
+
+    std::vector<GLubyte> data(kTexDim * kTexDim * 3);
+    for (size_t pixel = 0; pixel < data.size() / 3; ++pixel)
+    {
+        data[pixel * 3 + 0] = 0;
+        data[pixel * 3 + 1] = 255;
+        data[pixel * 3 + 2] = 0;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTexDim, kTexDim, GL_RGB, GL_UNSIGNED_BYTE,
+                    data.data());
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+    EXPECT_PIXEL_RECT_EQ(0, 0, kTexDim, kTexDim, GLColor::green);
+
+    EXPECT_EQ(getPerfCounters().bufferToImageCopyRegions, expectedRegions);
+}
+
 // Tests that mutable texture is uploaded with appropriate mip level attributes.
 TEST_P(VulkanPerformanceCounterTest, MutableTextureCompatibleMipLevelsInit)
 {
@@ -1738,6 +1829,124 @@ TEST_P(VulkanPerformanceCounterTest, RenderToRGBTextureDoesNotBreakRenderPass)
     EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
 }
 
+// Tests that switching between framebuffers with the same attachments does not break the render
+// pass.
+TEST_P(VulkanPerformanceCounterTest, FramebuffersWithSameAttachmentsDoNotBreakRenderPass)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorUniformLocation =
+        glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorUniformLocation);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 256, 256);
+
+    GLFramebuffer framebuffers[2];
+    for (GLuint framebuffer : framebuffers)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    }
+    GLFramebuffer otherFramebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, otherFramebuffer);
+    GLRenderbuffer otherRenderbuffer;
+    glBindRenderbuffer(GL_RENDERBUFFER, otherRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 256, 256);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                              otherRenderbuffer);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    ASSERT_GL_NO_ERROR();
+
+    uint64_t expectedRenderPassCount = getPerfCounters().renderPasses + 1;
+
+    // Draw red on the left half with the first framebuffer.
+    glViewport(0, 0, 256, 256);
+    glEnable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[0]);
+    glScissor(0, 0, 128, 256);
+    glUniform4fv(colorUniformLocation, 1, GLColor::red.toNormalizedVector().data());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    // Bind an unrelated framebuffer without using it, then draw green on the right half with the
+    // second framebuffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, otherFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[1]);
+    glScissor(128, 0, 128, 256);
+    glUniform4fv(colorUniformLocation, 1, GLColor::green.toNormalizedVector().data());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    // Draw blue on the top with the first framebuffer again.
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[0]);
+    glScissor(0, 192, 256, 64);
+    glUniform4fv(colorUniformLocation, 1, GLColor::blue.toNormalizedVector().data());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    EXPECT_EQ(getPerfCounters().renderPasses, expectedRenderPassCount);
+
+    glDisable(GL_SCISSOR_TEST);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(255, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(0, 255, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(255, 255, GLColor::blue);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that the estimated attachment bandwidth follows the final load and store ops of the render
+// passes.
+TEST_P(VulkanPerformanceCounterTest, AttachmentBandwidthFollowsLoadStoreOps)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr GLsizei kSize           = 64;
+    constexpr uint64_t kColorDataSize = kSize * kSize * 4;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    glViewport(0, 0, kSize, kSize);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    uint64_t expectedLoadBytes  = getPerfCounters().attachmentLoadBytes;
+    uint64_t expectedStoreBytes = getPerfCounters().attachmentStoreBytes;
+
+    // A cleared attachment is not loaded, but is stored.
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glFinish();
+    expectedStoreBytes += kColorDataSize;
+    EXPECT_EQ(getPerfCounters().attachmentLoadBytes, expectedLoadBytes);
+    EXPECT_EQ(getPerfCounters().attachmentStoreBytes, expectedStoreBytes);
+
+    // Without a clear, the attachment is loaded too.
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glFinish();
+    expectedLoadBytes += kColorDataSize;
+    expectedStoreBytes += kColorDataSize;
+    EXPECT_EQ(getPerfCounters().attachmentLoadBytes, expectedLoadBytes);
+    EXPECT_EQ(getPerfCounters().attachmentStoreBytes, expectedStoreBytes);
+
+    // If the attachment is invalidated, it is not stored.
+    const GLenum discard[] = {GL_COLOR_ATTACHMENT0};
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, discard);
+    glFinish();
+    expectedLoadBytes += kColorDataSize;
+    EXPECT_EQ(getPerfCounters().attachmentLoadBytes, expectedLoadBytes);
+    EXPECT_EQ(getPerfCounters().attachmentStoreBytes, expectedStoreBytes);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Tests that changing a Texture's max level hits the descriptor set cache.
 TEST_P(VulkanPerformanceCounterTest, ChangingMaxLevelHitsDescriptorCache)
 {
@@ -1950,6 +2159,61 @@ TEST_P(VulkanPerformanceCounterTest_ES31, ResolveToFBOWithInvalidate)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that resolving a multisampled framebuffer whose render pass has a smaller render area than
+// the blit area (due to a scissored draw) still uses a resolve attachment.
+TEST_P(VulkanPerformanceCounterTest_ES31, ResolveToFBOAfterScissoredDraw)
+{
+    constexpr int kSize = 16;
+
+    GLRenderbuffer resolveColor;
+    glBindRenderbuffer(GL_RENDERBUFFER, resolveColor);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer resolveFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, resolveFBO);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, resolveColor);
+
+    GLRenderbuffer msaaColor;
+    glBindRenderbuffer(GL_RENDERBUFFER, msaaColor);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, 4, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer msaaFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, msaaFBO);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, msaaColor);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // Fill the multisampled image with green in a render pass of its own.
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    glFinish();
+
+    angle::VulkanPerfCounters expected;
+    expected.colorAttachmentResolves = getPerfCounters().colorAttachmentResolves + 1;
+    expected.resolveImageCommands    = getPerfCounters().resolveImageCommands;
+
+    // Draw red in a corner only, so the render area is smaller than the framebuffer.
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, kSize / 2, kSize / 2);
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    glDisable(GL_SCISSOR_TEST);
+
+    // Resolve the whole framebuffer.
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, resolveFBO);
+    glBlitFramebuffer(0, 0, kSize, kSize, 0, 0, kSize, kSize, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, resolveFBO);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - 1, kSize / 2 - 1, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(0, kSize - 1, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::green);
+
+    EXPECT_EQ(expected.colorAttachmentResolves, getPerfCounters().colorAttachmentResolves);
+    EXPECT_EQ(expected.resolveImageCommands, getPerfCounters().resolveImageCommands);
+}
+
 // Test resolving different attachments of an FBO to separate FBOs then invalidate
 TEST_P(VulkanPerformanceCounterTest_ES31, MultisampleResolveBothAttachments)
 {
@@ -3361,6 +3625,84 @@ TEST_P(VulkanPerformanceCounterTest_DepthStencilLoadStoreOps, DepthStencilPartia
     EXPECT_DEPTH_STENCIL_OP_COUNTERS(getPerfCounters(), expected);
 }
 
+// Similar to DepthStencilPartialInvalidateSub, but the render pass after the invalidate is
+// scissored to within the invalidated area.  Even though the invalidated render pass was closed,
+// depth/stencil should not be loaded.
+TEST_P(VulkanPerformanceCounterTest_DepthStencilLoadStoreOps,
+       DepthStencilPartialInvalidateSubThenScissoredDraw)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    // disallowMixedDepthStencilLoadOpNoneAndLoad makes it quite complicated to set expectations
+    // correct.
+    ANGLE_SKIP_TEST_IF(hasSupportsTileMemoryOrSimulation() &&
+                       hasDisallowMixedDepthStencilLoadOpNoneAndLoad());
+
+    angle::VulkanPerfCounters expected;
+
+    // Expect rpCount+1, depth(Clears+1, Loads+0, LoadNones+0, Stores+1, StoreNones+0),
+    // stencil(Clears+1, Loads+0, LoadNones+0, Stores+1, StoreNones+0)
+    setExpectedCountersForDepthOps(getPerfCounters(), 1, 1, 0, 0, 1, 0, &expected);
+    setExpectedCountersForStencilOps(getPerfCounters(), 1, 0, 0, 1, 0, &expected);
+
+    // Create the framebuffer and make sure depth/stencil have valid contents.
+    ANGLE_GL_PROGRAM(drawRed, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    GLFramebuffer framebuffer;
+    GLTexture texture;
+    GLRenderbuffer renderbuffer;
+    setupClearAndDrawForDepthStencilOpsTest(&drawRed, &framebuffer, &texture, &renderbuffer, true);
+
+    // Break the render pass so depth/stencil values are stored.
+    EXPECT_EQ(expected.renderPasses, getPerfCounters().renderPasses);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    adjustExpectedDepthStencilLoadStoreOpsForTileMemoryFallback(getPerfCounters(), &expected);
+    EXPECT_DEPTH_STENCIL_OP_COUNTERS(getPerfCounters(), expected);
+
+    // Start a new render pass that is scissored.  Depth/stencil should be loaded.  The draw call is
+    // followed by an invalidate, so store shouldn't happen.
+
+    // Expect rpCount+1, depth(Clears+0, Loads+1, LoadNones+0, Stores+0, StoreNones+0),
+    // stencil(Clears+0, Loads+1, LoadNones+0, Stores+0, StoreNones+0)
+    setExpectedCountersForDepthOps(getPerfCounters(), 1, 0, 1, 0, 0, 0, &expected);
+    setExpectedCountersForStencilOps(getPerfCounters(), 0, 1, 0, 0, 0, &expected);
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(kOpsTestSize / 8, kOpsTestSize / 4, kOpsTestSize / 2, kOpsTestSize / 3);
+
+    glStencilOp(GL_REPLACE, GL_REPLACE, GL_REPLACE);
+    glStencilFunc(GL_ALWAYS, 0x55, 0xFF);
+    glDepthFunc(GL_ALWAYS);
+
+    ANGLE_GL_PROGRAM(drawGreen, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    drawQuad(drawGreen, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    const GLenum discards[] = {GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT};
+    glInvalidateSubFramebuffer(GL_FRAMEBUFFER, 2, discards, kOpsTestSize / 8, kOpsTestSize / 8,
+                               7 * kOpsTestSize / 8, 7 * kOpsTestSize / 8);
+
+    // Break the render pass so depth/stencil values are discarded.
+    EXPECT_EQ(expected.renderPasses, getPerfCounters().renderPasses);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize / 2, kOpsTestSize / 2, GLColor::green);
+    EXPECT_DEPTH_STENCIL_OP_COUNTERS(getPerfCounters(), expected);
+
+    // Start another render pass with the same scissor.  The render area is entirely within the
+    // invalidated area, so depth/stencil should not be loaded.
+
+    // Expect rpCount+1, depth(Clears+0, Loads+0, LoadNones+0, Stores+1, StoreNones+0),
+    // stencil(Clears+0, Loads+0, LoadNones+0, Stores+1, StoreNones+0)
+    setExpectedCountersForDepthOps(getPerfCounters(), 1, 0, 0, 0, 1, 0, &expected);
+    setExpectedCountersForStencilOps(getPerfCounters(), 0, 0, 0, 1, 0, &expected);
+
+    ANGLE_GL_PROGRAM(drawBlue, essl1_shaders::vs::Simple(), essl1_shaders::fs::Blue());
+    drawQuad(drawBlue, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    // Verify results
+    EXPECT_EQ(expected.renderPasses, getPerfCounters().renderPasses);
+    EXPECT_PIXEL_COLOR_EQ(kOpsTestSize / 2, kOpsTestSize / 2, GLColor::blue);
+    EXPECT_DEPTH_STENCIL_OP_COUNTERS(getPerfCounters(), expected);
+}
+
 // Tests that another case does not break render pass, and that counts are correct:
 //
 // - Scenario: invalidate, draw
@@ -6031,6 +6373,8 @@ TEST_P(VulkanPerformanceCounterTest, ScissorDoesNotBreakRenderPass)
 TEST_P(VulkanPerformanceCounterTest, ChangingUBOsHitsDescriptorSetCache)
 {
     ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    // Pushed uniform buffer descriptors don't use descriptor sets.
+    ANGLE_SKIP_TEST_IF(isFeatureEnabled(Feature::UsePushDescriptorsForUniformBuffers));
 
     // Set up two UBOs, one filled with "1" and the second with "2".
     constexpr GLsizei kCount = 64;
@@ -7858,6 +8202,8 @@ TEST_P(VulkanPerformanceCounterTest_SingleBuffer, SwapBuffersAfterFlushIgnored)
 TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsAreShared)
 {
     ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    // Pushed texture descriptors don't use descriptor sets.
+    ANGLE_SKIP_TEST_IF(isFeatureEnabled(Feature::UsePushDescriptorsForTextures));
 
     ANGLE_GL_PROGRAM(testProgram1, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
     ANGLE_GL_PROGRAM(testProgram2, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
@@ -7918,6 +8264,8 @@ TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsAreShared)
 TEST_P(VulkanPerformanceCounterTest, UniformBufferDescriptorsAreShared)
 {
     ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    // Pushed uniform buffer descriptors don't use descriptor sets.
+    ANGLE_SKIP_TEST_IF(isFeatureEnabled(Feature::UsePushDescriptorsForUniformBuffers));
 
     constexpr char kFS[] = R"(#version 300 es
 precision mediump float;
@@ -8164,6 +8512,8 @@ TEST_P(VulkanPerformanceCounterTest, Source2DAndRepeatedlyRespecifyTarget2DWithS
     ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_OES_EGL_image") ||
                        !IsEGLDisplayExtensionEnabled(dpy, "EGL_KHR_image_base") ||
                        !IsEGLDisplayExtensionEnabled(dpy, "EGL_KHR_gl_texture_2D_image"));
+    // Pushed texture descriptors don't use descriptor sets.
+    ANGLE_SKIP_TEST_IF(isFeatureEnabled(Feature::UsePushDescriptorsForTextures));
 
     ANGLE_GL_PROGRAM(textureProgram, essl1_shaders::vs::Texture2D(),
                      essl1_shaders::fs::Texture2D());
@@ -8588,6 +8938,154 @@ TEST_P(VulkanPerformanceCounterTest, AsyncMonolithicPipelineCreation)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+// Verify that with prewarmMonolithicPipelineTransitions, the monolithic pipeline of a transition
+// target is created while only the source pipeline is being used.
+TEST_P(VulkanPerformanceCounterTest, PrewarmMonolithicPipelineTransitions)
+{
+    const bool hasPrewarmMonolithicPipelineTransitions =
+        isFeatureEnabled(Feature::SupportsGraphicsPipelineLibrary) &&
+        isFeatureEnabled(Feature::PreferMonolithicPipelinesOverLibraries) &&
+        isFeatureEnabled(Feature::PrewarmMonolithicPipelineTransitions);
+    ANGLE_SKIP_TEST_IF(!hasPrewarmMonolithicPipelineTransitions);
+
+    ANGLE_GL_PROGRAM(drawRed, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+
+    const uint64_t expectedPrewarmCount = getPerfCounters().monolithicPipelinePrewarms + 1;
+
+    // Record a transition from the pipeline without blending to the one with blending.  The blend
+    // function is chosen so that the output is unaffected.
+    drawQuad(drawRed, essl3_shaders::PositionAttrib(), 0.0f);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ZERO);
+    drawQuad(drawRed, essl3_shaders::PositionAttrib(), 0.0f);
+    glDisable(GL_BLEND);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // Keep drawing with the first pipeline only.  Once its own monolithic pipeline is in place,
+    // the monolithic pipeline of the blending pipeline should be created ahead of need.
+    uint32_t drawCount                 = 0;
+    constexpr uint32_t kDrawCountLimit = 200;
+
+    while (getPerfCounters().monolithicPipelinePrewarms < expectedPrewarmCount)
+    {
+        drawQuad(drawRed, essl3_shaders::PositionAttrib(), 0.0f);
+
+        ++drawCount;
+        if (drawCount > kDrawCountLimit)
+        {
+            drawCount = 0;
+            EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+        }
+    }
+
+    // Make sure the transition target still renders correctly once its monolithic pipeline
+    // replaces the linked one.
+    const uint64_t expectedMonolithicPipelineCreationCount =
+        getPerfCounters().monolithicPipelineCreation + 1;
+    glEnable(GL_BLEND);
+    while (getPerfCounters().monolithicPipelineCreation < expectedMonolithicPipelineCreationCount)
+    {
+        drawQuad(drawRed, essl3_shaders::PositionAttrib(), 0.0f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    }
+
+    drawQuad(drawRed, essl3_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
+// Verify that a pipeline recorded at draw time only counts as warmed up at the next link for draws
+// that use the same shader permutation.
+TEST_P(VulkanPerformanceCounterTest, RecordedPipelineWarmUpMatchesPermutation)
+{
+    // With transform feedback emulation, the permutation depends on whether transform feedback is
+    // active, which doesn't affect the GraphicsPipelineDesc.
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::WarmUpRecordedGraphicsPipelines) ||
+                       !isFeatureEnabled(Feature::WarmUpPipelineCacheAtLink) ||
+                       !isFeatureEnabled(Feature::EmulateTransformFeedback));
+
+    // Use a framebuffer with a depth/stencil attachment, so the draws don't match the default
+    // warm up pipeline.
+    GLTexture color;
+    glBindTexture(GL_TEXTURE_2D, color);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kOpsTestSize, kOpsTestSize);
+    GLRenderbuffer depthStencil;
+    glBindRenderbuffer(GL_RENDERBUFFER, depthStencil);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, kOpsTestSize, kOpsTestSize);
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                              depthStencil);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    const std::vector<std::string> tfVaryings = {"gl_Position"};
+    GLBuffer xfbBuffer;
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, xfbBuffer);
+    glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, 6 * sizeof(float) * 4, nullptr, GL_STATIC_DRAW);
+    GLTransformFeedback xfb;
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, xfb);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, xfbBuffer);
+
+    // Draw without transform feedback, which records the pipeline with that permutation.
+    {
+        ANGLE_GL_PROGRAM_TRANSFORM_FEEDBACK(program, essl3_shaders::vs::Simple(),
+                                            essl3_shaders::fs::Red(), tfVaryings,
+                                            GL_INTERLEAVED_ATTRIBS);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    }
+
+    // The same program is warmed up with the recorded pipeline and the same draw uses it.
+    uint64_t expectedWarmUpHits = getPerfCounters().graphicsPipelineWarmUpHits + 1;
+    {
+        ANGLE_GL_PROGRAM_TRANSFORM_FEEDBACK(program, essl3_shaders::vs::Simple(),
+                                            essl3_shaders::fs::Red(), tfVaryings,
+                                            GL_INTERLEAVED_ATTRIBS);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    }
+    EXPECT_EQ(getPerfCounters().graphicsPipelineWarmUpHits, expectedWarmUpHits);
+
+    // The same draw with transform feedback active uses a different permutation, so it doesn't
+    // match the recorded pipeline.
+    expectedWarmUpHits = getPerfCounters().graphicsPipelineWarmUpHits;
+    {
+        ANGLE_GL_PROGRAM_TRANSFORM_FEEDBACK(program, essl3_shaders::vs::Simple(),
+                                            essl3_shaders::fs::Red(), tfVaryings,
+                                            GL_INTERLEAVED_ATTRIBS);
+        glUseProgram(program);
+        glBeginTransformFeedback(GL_TRIANGLES);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        glEndTransformFeedback();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    }
+    EXPECT_EQ(getPerfCounters().graphicsPipelineWarmUpHits, expectedWarmUpHits);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Verify that identical shaders in different programs share their shader modules.
+TEST_P(VulkanPerformanceCounterTest, IdenticalProgramsShareShaderModules)
+{
+    // With warm up, the shader modules are created by the link job, whose counters are not
+    // visible to the context.
+    ANGLE_SKIP_TEST_IF(isFeatureEnabled(Feature::WarmUpPipelineCacheAtLink));
+
+    ANGLE_GL_PROGRAM(drawRed, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+    drawQuad(drawRed, essl3_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    const uint64_t expectedShaderModuleCreations = getPerfCounters().shaderModuleCreations;
+    const uint64_t expectedShaderModuleCacheHits = getPerfCounters().shaderModuleCacheHits + 2;
+
+    // A second program with the same shaders should reuse the vertex and fragment modules.
+    ANGLE_GL_PROGRAM(drawRedAgain, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+    drawQuad(drawRedAgain, essl3_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    EXPECT_EQ(getPerfCounters().shaderModuleCreations, expectedShaderModuleCreations);
+    EXPECT_GE(getPerfCounters().shaderModuleCacheHits, expectedShaderModuleCacheHits);
+}
+
 // Verify that changing framebuffer and back doesn't break the render pass.
 TEST_P(VulkanPerformanceCounterTest, FBOChangeAndBackDoesNotBreakRenderPass)
 {
@@ -10074,6 +10572,41 @@ TEST_P(VulkanPerformanceCounterTest, RedundantAllAttachmentsClearDepthMaskOff)
     EXPECT_PIXEL_RECT_EQ(0, 0, kOpsTestSize, kOpsTestSize, GLColor::green);
 }
 
+// Tests that the "vulkan_frame" counter group holds the counters of the last presented frame, and
+// that they don't change while the next frame is being recorded.
+TEST_P(VulkanPerformanceCounterTest, FrameCountersHoldLastPresentedFrame)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr GLuint kFrameGroup = 1;
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    GLFramebuffer framebuffer;
+    GLTexture texture;
+    setupForColorOpsTest(&framebuffer, &texture);
+
+    // Start from a new frame, then render to both the user and the default framebuffers.
+    swapBuffers();
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    const uint64_t frameRenderPasses = getPerfCounters().renderPasses;
+    EXPECT_GE(frameRenderPasses, 2u);
+
+    swapBuffers();
+    EXPECT_EQ(GetPerfCounters(mIndexMap, kFrameGroup).renderPasses, frameRenderPasses);
+    EXPECT_EQ(getPerfCounters().renderPasses, 0u);
+
+    // Work in the next frame only shows up in the live counters.
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(GetPerfCounters(mIndexMap, kFrameGroup).renderPasses, frameRenderPasses);
+    EXPECT_EQ(getPerfCounters().renderPasses, 1u);
+}
+
 // Verifies whether, when GL_RASTERIZER_DISCARD is enabled and no glClear is issued,
 // the Vulkan color attachment uses VK_ATTACHMENT_LOAD_OP_NONE and VK_ATTACHMENT_STORE_OP_NONE,
 // as no actual rendering or clearing is expected.
@@ -11011,6 +11544,98 @@ TEST_P(VulkanPerformanceCounterTest_ClipDistance, ToggleClipDistanceShouldUpdate
     ASSERT_GL_NO_ERROR();
 }
 
+class VulkanPerformanceCounterTest_PassGpuTime : public VulkanPerformanceCounterTest
+{};
+
+// Tests that the GPU time of finished render passes is reported in the counters of the frame.
+TEST_P(VulkanPerformanceCounterTest_PassGpuTime, RenderPassGpuTimeIsReported)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    // Timestamps are only measured if the queue supports them.
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_EXT_disjoint_timer_query"));
+
+    constexpr GLuint kFrameGroup = 1;
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    swapBuffers();
+    EXPECT_EQ(getPerfCounters().appRenderPassGpuTimeNs, 0u);
+
+    // Wait for the render pass to finish, so that its GPU time is read back on swap.
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glFinish();
+    ASSERT_GL_NO_ERROR();
+
+    swapBuffers();
+    EXPECT_GT(GetPerfCounters(mIndexMap, kFrameGroup).appRenderPassGpuTimeNs, 0u);
+    EXPECT_EQ(getPerfCounters().appRenderPassGpuTimeNs, 0u);
+}
+
+class VulkanPerformanceCounterTest_DirtyBitProfile : public VulkanPerformanceCounterTest
+{};
+
+// Tests that the calls to and cycles spent in the dirty bit handlers of the last frame are
+// reported.
+TEST_P(VulkanPerformanceCounterTest_DirtyBitProfile, HandlerCallsAreReported)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr GLuint kDirtyBitsGroup = 2;
+
+    GLint counterCount = 0;
+    glGetPerfMonitorCountersAMD(kDirtyBitsGroup, &counterCount, nullptr, 0, nullptr);
+    std::vector<GLuint> counters(counterCount);
+    glGetPerfMonitorCountersAMD(kDirtyBitsGroup, nullptr, nullptr, counterCount, counters.data());
+    ASSERT_GL_NO_ERROR();
+
+    GLuint callsCounter  = GL_INVALID_INDEX;
+    GLuint cyclesCounter = GL_INVALID_INDEX;
+    for (GLuint counter : counters)
+    {
+        char name[100] = {};
+        glGetPerfMonitorCounterStringAMD(kDirtyBitsGroup, counter, sizeof(name), nullptr, name);
+        if (std::string(name) == "renderPassCalls")
+        {
+            callsCounter = counter;
+        }
+        else if (std::string(name) == "renderPassCycles")
+        {
+            cyclesCounter = counter;
+        }
+    }
+    ASSERT_NE(callsCounter, GL_INVALID_INDEX);
+    ASSERT_NE(cyclesCounter, GL_INVALID_INDEX);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    GLFramebuffer framebuffer;
+    GLTexture texture;
+    setupForColorOpsTest(&framebuffer, &texture);
+
+    // Start two render passes in a frame.
+    swapBuffers();
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    swapBuffers();
+
+    GLuint64 calls  = 0;
+    GLuint64 cycles = 0;
+    for (const angle::PerfMonitorTriplet &triplet : GetPerfMonitorTriplets())
+    {
+        if (triplet.group == kDirtyBitsGroup && triplet.counter == callsCounter)
+        {
+            calls = triplet.value;
+        }
+        else if (triplet.group == kDirtyBitsGroup && triplet.counter == cyclesCounter)
+        {
+            cycles = triplet.value;
+        }
+    }
+    EXPECT_GE(calls, 2u);
+    EXPECT_GT(cycles, 0u);
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest);
 ANGLE_INSTANTIATE_TEST(
     VulkanPerformanceCounterTest,
@@ -11022,7 +11647,14 @@ ANGLE_INSTANTIATE_TEST(
         .enable(Feature::SlowDownMonolithicPipelineCreationForTesting),
     ES3_VULKAN_SWIFTSHADER()
         .enable(Feature::PreferMonolithicPipelinesOverLibraries)
-        .disable(Feature::MergeProgramPipelineCachesToGlobalCache));
+        .disable(Feature::MergeProgramPipelineCachesToGlobalCache),
+    ES3_VULKAN_SWIFTSHADER()
+        .enable(Feature::PreferMonolithicPipelinesOverLibraries)
+        .enable(Feature::PrewarmMonolithicPipelineTransitions),
+    ES3_VULKAN_SWIFTSHADER()
+        .enable(Feature::WarmUpRecordedGraphicsPipelines)
+        .disable(Feature::SupportsTransformFeedbackExtension)
+        .enable(Feature::EmulateTransformFeedback));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(
     VulkanPerformanceCounterTest_DepthStencilLoadStoreOps);
@@ -11204,6 +11836,189 @@ TEST_P(VulkanPerformanceCounterTest_TileMemory, RedefineSharedDepthTextureWithOp
     ASSERT_NE(currentStep, Step::Abort);
 }
 
+class VulkanPerformanceCounterTest_ScissoredClearLoadOp : public VulkanPerformanceCounterTest
+{
+  protected:
+    static constexpr GLsizei kSize = 16;
+
+    void setupFramebuffer(GLTexture &texture, GLFramebuffer &framebuffer)
+    {
+        std::vector<GLColor> redData(kSize * kSize, GLColor::red);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     redData.data());
+
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+        glViewport(0, 0, kSize, kSize);
+        glEnable(GL_SCISSOR_TEST);
+    }
+};
+
+// Tests that a scissored clear that starts a render pass uses loadOp=Clear.
+TEST_P(VulkanPerformanceCounterTest_ScissoredClearLoadOp, ScissoredClearUsesLoadOp)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(hasPreferDrawOverClearAttachments());
+
+    GLTexture texture;
+    GLFramebuffer framebuffer;
+    setupFramebuffer(texture, framebuffer);
+
+    angle::VulkanPerfCounters expected;
+    // Expect rpCount+1, color(Clears+1, Loads+0, LoadNones+0, Stores+1, StoreNones+0)
+    setExpectedCountersForColorOps(getPerfCounters(), 1, 1, 0, 0, 1, 0, &expected);
+    expected.colorClearAttachments = getPerfCounters().colorClearAttachments;
+
+    // Clear the center to green, then draw blue in the left half of it.
+    glScissor(kSize / 4, kSize / 4, kSize / 2, kSize / 2);
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glScissor(kSize / 4, kSize / 4, kSize / 4, kSize / 2);
+    ANGLE_GL_PROGRAM(drawBlue, essl1_shaders::vs::Simple(), essl1_shaders::fs::Blue());
+    drawQuad(drawBlue, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(kSize / 4, kSize / 4, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - 1, 3 * kSize / 4 - 1, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 4, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(3 * kSize / 4 - 1, 3 * kSize / 4 - 1, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::red);
+
+    EXPECT_COLOR_OP_COUNTERS(getPerfCounters(), expected);
+    EXPECT_EQ(expected.colorClearAttachments, getPerfCounters().colorClearAttachments);
+}
+
+// Tests that if the render area grows after a scissored clear with loadOp=Clear but before anything
+// is drawn, the clear is done with vkCmdClearAttachments and the render pass stays open.
+TEST_P(VulkanPerformanceCounterTest_ScissoredClearLoadOp, GrowthBeforeDrawRevertsToClearAttachments)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(hasPreferDrawOverClearAttachments());
+
+    GLTexture texture;
+    GLFramebuffer framebuffer;
+    setupFramebuffer(texture, framebuffer);
+
+    angle::VulkanPerfCounters expected;
+    // Expect rpCount+1, color(Clears+0, Loads+1, LoadNones+0, Stores+1, StoreNones+0)
+    setExpectedCountersForColorOps(getPerfCounters(), 1, 0, 1, 0, 1, 0, &expected);
+    expected.colorClearAttachments = getPerfCounters().colorClearAttachments + 2;
+
+    // Clear the bottom left quarter to green and the top right quarter to blue.
+    glScissor(0, 0, kSize / 2, kSize / 2);
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glScissor(kSize / 2, kSize / 2, kSize / 2, kSize / 2);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - 1, kSize / 2 - 1, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(0, kSize - 1, GLColor::red);
+
+    EXPECT_COLOR_OP_COUNTERS(getPerfCounters(), expected);
+    EXPECT_EQ(expected.colorClearAttachments, getPerfCounters().colorClearAttachments);
+}
+
+// Tests that if the render area grows after a scissored clear with loadOp=Clear and a draw, a new
+// render pass is started.
+TEST_P(VulkanPerformanceCounterTest_ScissoredClearLoadOp, GrowthAfterDrawStartsNewRenderPass)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    ANGLE_SKIP_TEST_IF(hasPreferDrawOverClearAttachments());
+
+    GLTexture texture;
+    GLFramebuffer framebuffer;
+    setupFramebuffer(texture, framebuffer);
+
+    uint64_t expectedRenderPassCount = getPerfCounters().renderPasses + 2;
+
+    // Clear the bottom left quarter to green and draw blue in its left half.
+    glScissor(0, 0, kSize / 2, kSize / 2);
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glScissor(0, 0, kSize / 4, kSize / 2);
+    ANGLE_GL_PROGRAM(drawBlue, essl1_shaders::vs::Simple(), essl1_shaders::fs::Blue());
+    drawQuad(drawBlue, essl1_shaders::PositionAttrib(), 0.5f);
+
+    // Draw blue in the top right quarter, which needs a larger render area.
+    glScissor(kSize / 2, kSize / 2, kSize / 2, kSize / 2);
+    drawQuad(drawBlue, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 4 - 1, kSize / 2 - 1, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 4, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2 - 1, kSize / 2 - 1, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(0, kSize - 1, GLColor::red);
+
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+}
+
+class VulkanPerformanceCounterTest_BatchSubImageUpdates : public VulkanPerformanceCounterTest
+{};
+
+// Tests that many small sub-image updates to a texture are copied to it with a few copy commands.
+TEST_P(VulkanPerformanceCounterTest_BatchSubImageUpdates, SubImageUpdatesAreBatched)
+{
+    // If VK_EXT_host_image_copy is used, uploads will all be done on the CPU.
+    ANGLE_SKIP_TEST_IF(hasSupportsHostImageCopy());
+
+    constexpr GLsizei kTexDim    = 16;
+    constexpr GLsizei kTileDim   = 4;
+    constexpr GLsizei kTileCount = (kTexDim / kTileDim) * (kTexDim / kTileDim);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kTexDim, kTexDim);
+
+    const std::vector<GLColor> kRed(kTileDim * kTileDim, GLColor::red);
+    const std::vector<GLColor> kGreen(kTileDim * kTileDim, GLColor::green);
+
+    const uint64_t expectedRegions     = getPerfCounters().bufferToImageCopyRegions + kTileCount;
+    const uint64_t maxExpectedCommands = getPerfCounters().bufferToImageCopyCommands + 2;
+
+    for (GLsizei y = 0; y < kTexDim; y += kTileDim)
+    {
+        for (GLsizei x = 0; x < kTexDim; x += kTileDim)
+        {
+            const bool isRed = ((x + y) / kTileDim) % 2 == 0;
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, kTileDim, kTileDim, GL_RGBA, GL_UNSIGNED_BYTE,
+                            isRed ? kRed.data() : kGreen.data());
+        }
+    }
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kTileDim, kTileDim, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(kTileDim, 0, kTileDim, kTileDim, GLColor::green);
+    EXPECT_PIXEL_RECT_EQ(0, kTileDim, kTileDim, kTileDim, GLColor::green);
+    EXPECT_PIXEL_RECT_EQ(kTexDim - kTileDim, kTexDim - kTileDim, kTileDim, kTileDim,
+                         GLColor::red);
+
+    // The staging allocations of the updates normally come from the same buffer, but the buffer
+    // could run out of space in the middle.
+    EXPECT_EQ(getPerfCounters().bufferToImageCopyRegions, expectedRegions);
+    EXPECT_LE(getPerfCounters().bufferToImageCopyCommands, maxExpectedCommands);
+}
+
 // Enable SimulateTileMemoryForTesting feature to get some test coverage on bots. Note that if both
 // SimulateTileMemoryForTesting and SupportsTileMemoryHeap are enabled, SupportsTileMemoryHeap will
 // take precedence.
@@ -11218,4 +12033,23 @@ ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_TileMemory,
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_ClipDistance);
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_ClipDistance, ES3_VULKAN_SWIFTSHADER());
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_PassGpuTime);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_PassGpuTime,
+                       ES3_VULKAN().enable(Feature::MeasurePassGpuTime));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_DirtyBitProfile);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_DirtyBitProfile,
+                       ES3_VULKAN().enable(Feature::ProfileDirtyBitHandlers),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::ProfileDirtyBitHandlers));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_ScissoredClearLoadOp);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_ScissoredClearLoadOp,
+                       ES3_VULKAN().enable(Feature::PreferLoadOpForScissoredClear),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::PreferLoadOpForScissoredClear));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_BatchSubImageUpdates);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_BatchSubImageUpdates,
+                       ES3_VULKAN().enable(Feature::BatchSubImageUpdates),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::BatchSubImageUpdates));
 }  // anonymous namespace
@@ -943,6 +943,47 @@ TEST_P(WebGL1CompatibilityTest, EnableInstancedArraysExtensionEXT)
     }
 }
 
+// Test that instanced draws in WebGL 1 require an active attribute with a zero divisor, and that
+// changing the divisor is taken into account.
+TEST_P(WebGL1CompatibilityTest, InstancedDrawRequiresZeroDivisor)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionRequestable("GL_ANGLE_instanced_arrays"));
+    glRequestExtensionANGLE("GL_ANGLE_instanced_arrays");
+    ASSERT_GL_NO_ERROR();
+
+    constexpr char kVS[] =
+        R"(attribute float a_pos;
+void main()
+{
+    gl_Position = vec4(a_pos, a_pos, a_pos, 1.0);
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, essl1_shaders::fs::Red());
+
+    GLint posLocation = glGetAttribLocation(program, "a_pos");
+    ASSERT_NE(-1, posLocation);
+
+    glUseProgram(program);
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(posLocation);
+    glVertexAttribPointer(posLocation, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, nullptr);
+
+    glDrawArraysInstancedANGLE(GL_POINTS, 0, 1, 4);
+    EXPECT_GL_NO_ERROR();
+
+    glVertexAttribDivisorANGLE(posLocation, 1);
+    glDrawArraysInstancedANGLE(GL_POINTS, 0, 1, 4);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glVertexAttribDivisorANGLE(posLocation, 0);
+    glDrawArraysInstancedANGLE(GL_POINTS, 0, 1, 4);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test enabling the GL_ANGLE_pack_reverse_row_order extension
 TEST_P(WebGLCompatibilityTest, EnablePackReverseRowOrderExtension)
 {
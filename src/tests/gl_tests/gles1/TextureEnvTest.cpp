@@ -372,4 +372,49 @@ TEST_P(TextureEnvTest, Set)
     }
 }
 
-ANGLE_INSTANTIATE_TEST_ES1(TextureEnvTest);
+// Checks that drawing with several texture environment modes, and going back to an earlier one,
+// produces the expected colors.  This exercises the programs that may be precompiled for the modes
+// that were not yet used.
+TEST_P(TextureEnvTest, DrawWithChangingModes)
+{
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_GL_NO_ERROR();
+
+    const std::array<float, 12> positions = {
+        -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, -1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    };
+    const std::array<float, 8> texCoords = {
+        0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,
+    };
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, positions.data());
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glTexCoordPointer(2, GL_FLOAT, 0, texCoords.data());
+    glColor4f(0.0f, 1.0f, 0.0f, 1.0f);
+
+    const std::array<std::pair<GLenum, GLColor>, 5> modes = {{
+        {GL_MODULATE, GLColor::black},
+        {GL_REPLACE, GLColor::red},
+        {GL_ADD, GLColor::yellow},
+        {GL_DECAL, GLColor::red},
+        {GL_MODULATE, GLColor::black},
+    }};
+
+    for (const auto &modeAndColor : modes)
+    {
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, modeAndColor.first);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(16, 16, modeAndColor.second);
+    }
+}
+
+ANGLE_INSTANTIATE_TEST(TextureEnvTest,
+                       ANGLE_ALL_TEST_PLATFORMS_ES1,
+                       ES1_VULKAN().enable(Feature::PrecompileGLES1NeighborVariants));
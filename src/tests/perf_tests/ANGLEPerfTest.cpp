@@ -62,6 +62,16 @@ constexpr double kNanoSecondsPerSecond                   = 1e9;
 constexpr size_t kNumberOfStepsPerformedToComputeGPUTime = 16;
 constexpr char kPeakMemoryMetric[]                       = ".memory_max";
 constexpr char kMedianMemoryMetric[]                     = ".memory_median";
+// A frame that takes more than this many times the median frame time counts as a hitch.
+constexpr double kHitchFrameTimeFactor = 2.0;
+
+// Nearest-rank percentile of sorted samples.
+double GetPercentile(const std::vector<double> &sortedSamples, double percentile)
+{
+    ASSERT(!sortedSamples.empty());
+    size_t rank = static_cast<size_t>(std::ceil(percentile * sortedSamples.size()));
+    return sortedSamples[std::max<size_t>(rank, 1) - 1];
+}
 
 struct TraceCategory
 {
@@ -433,6 +443,8 @@ void ANGLEPerfTest::runTrial(double maxRunTime, int maxStepsToRun, RunTrialPolic
     mFrameWallTimeSec       = 0.0;
     mBusyWaitCpuTimeSec     = 0.0;
     int stepAlignment       = getStepAlignment();
+    mFrameWallTimeSamples.clear();
+    mGPUTimeSamplesSeconds.clear();
     mTrialTimer.start();
     startTest();
 
@@ -627,6 +639,23 @@ void ANGLEPerfTest::processResults()
         processClockResult(".gpu_time", mGPUTimeNs * 1e-9);
     }
 
+    if (!mFrameWallTimeSamples.empty())
+    {
+        std::vector<double> wallTimes;
+        wallTimes.reserve(mFrameWallTimeSamples.size());
+        for (const FrameTimeSample &sample : mFrameWallTimeSamples)
+        {
+            wallTimes.push_back(sample.wallTimeSeconds);
+        }
+        double median = processFrameTimeDistribution(".frame_wall_time", std::move(wallTimes));
+        processFrameHitches(median);
+    }
+
+    if (!mGPUTimeSamplesSeconds.empty())
+    {
+        processFrameTimeDistribution(".gpu_time", mGPUTimeSamplesSeconds);
+    }
+
     if (gVerboseLogging)
     {
         double fps = static_cast<double>(mTrialNumStepsPerformed * mIterationsPerStep) /
@@ -736,6 +765,104 @@ void ANGLEPerfTest::processMemoryResult(const char *metric, uint64_t resultKB)
                        "sizeInBytes_smallerIsBetter");
 }
 
+double ANGLEPerfTest::processFrameTimeDistribution(const char *metric,
+                                                   std::vector<double> samplesSeconds)
+{
+    ASSERT(!samplesSeconds.empty());
+    std::sort(samplesSeconds.begin(), samplesSeconds.end());
+
+    auto recordMs = [this, metric](const char *suffix, double valueMs, const char *units) {
+        std::string name = std::string(metric) + suffix;
+        perf_test::MetricInfo metricInfo;
+        if (!mReporter->GetMetricInfo(name, &metricInfo))
+        {
+            mReporter->RegisterImportantMetric(name, units);
+        }
+        recordDoubleMetric(name.c_str(), valueMs, units);
+        addHistogramSample(name.c_str(), valueMs, "msBestFitFormat_smallerIsBetter");
+    };
+
+    const double median = GetPercentile(samplesSeconds, 0.5);
+    recordMs("_p50", median * kMilliSecondsPerSecond, "ms");
+    recordMs("_p95", GetPercentile(samplesSeconds, 0.95) * kMilliSecondsPerSecond, "ms");
+    recordMs("_p99", GetPercentile(samplesSeconds, 0.99) * kMilliSecondsPerSecond, "ms");
+
+    double mean     = ComputeMean(samplesSeconds) * kMilliSecondsPerSecond;
+    double variance = 0;
+    for (double sample : samplesSeconds)
+    {
+        double difference = sample * kMilliSecondsPerSecond - mean;
+        variance += difference * difference;
+    }
+    variance /= static_cast<double>(samplesSeconds.size());
+
+    std::string varianceName = std::string(metric) + "_variance";
+    perf_test::MetricInfo metricInfo;
+    if (!mReporter->GetMetricInfo(varianceName, &metricInfo))
+    {
+        mReporter->RegisterFyiMetric(varianceName, "ms^2");
+    }
+    recordDoubleMetric(varianceName.c_str(), variance, "ms^2");
+    recordMs("_stddev", std::sqrt(variance), "ms");
+
+    return median;
+}
+
+void ANGLEPerfTest::processFrameHitches(double medianFrameTimeSeconds)
+{
+    const double hitchThreshold = medianFrameTimeSeconds * kHitchFrameTimeFactor;
+
+    // Counters are cumulative, so a counter contributed to a hitch if it went up during the frame.
+    size_t hitchCount = 0;
+    std::map<GLuint, size_t> counterHitchCounts;
+    for (const FrameTimeSample &sample : mFrameWallTimeSamples)
+    {
+        if (sample.wallTimeSeconds <= hitchThreshold)
+        {
+            continue;
+        }
+        ++hitchCount;
+
+        const size_t index = sample.perfCounterSampleIndex;
+        for (const auto &iter : mPerfCounterInfo)
+        {
+            const std::vector<GLuint64> &samples = iter.second.samples;
+            if (index > 0 && index < samples.size() && samples[index] > samples[index - 1])
+            {
+                ++counterHitchCounts[iter.first];
+            }
+        }
+    }
+
+    auto recordCount = [this](const std::string &name, size_t count) {
+        perf_test::MetricInfo metricInfo;
+        if (!mReporter->GetMetricInfo(name, &metricInfo))
+        {
+            mReporter->RegisterImportantMetric(name, "count");
+        }
+        recordIntegerMetric(name.c_str(), count, "count");
+        addHistogramSample(name.c_str(), static_cast<double>(count), "count");
+    };
+
+    recordCount(".frame_wall_time_hitches", hitchCount);
+    for (const auto &iter : mPerfCounterInfo)
+    {
+        recordCount("." + iter.second.name + "_hitches", counterHitchCounts[iter.first]);
+    }
+}
+
+void ANGLEPerfTest::recordFrameWallTime(double frameWallTimeSeconds)
+{
+    // All counters are sampled together, so any of them gives the index of the current sample.
+    size_t perfCounterSampleIndex = 0;
+    if (!mPerfCounterInfo.empty())
+    {
+        const std::vector<GLuint64> &samples = mPerfCounterInfo.begin()->second.samples;
+        perfCounterSampleIndex               = samples.empty() ? 0 : samples.size() - 1;
+    }
+    mFrameWallTimeSamples.push_back({frameWallTimeSeconds, perfCounterSampleIndex});
+}
+
 double ANGLEPerfTest::normalizedTime(size_t value) const
 {
     return static_cast<double>(value) / static_cast<double>(mTrialNumStepsPerformed);
@@ -814,6 +941,11 @@ std::string RenderTestParams::backend() const
         case EGL_PLATFORM_ANGLE_TYPE_WEBGPU_ANGLE:
             strstr << "_webgpu";
             break;
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+            // The null back-end does no work of its own, so only the front-end is measured.  The
+            // device type is irrelevant.
+            strstr << "_frontend_only";
+            return strstr.str();
         default:
             assert(0);
             return "_unk";
@@ -1434,6 +1566,8 @@ void ANGLERenderTest::computeGPUTime()
 
             // compute GPU time
             mGPUTimeNs += endGLTimeNs - beginGLTimeNs;
+            mGPUTimeSamplesSeconds.push_back(static_cast<double>(endGLTimeNs - beginGLTimeNs) *
+                                             1e-9);
         }
     }
 }
@@ -1520,6 +1654,11 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mConfigParams.robustResourceInit = enabled;
 }
 
+void ANGLERenderTest::setNoErrorEnabled(bool enabled)
+{
+    mConfigParams.noError = enabled;
+}
+
 std::vector<TraceEvent> &ANGLERenderTest::getTraceEventBuffer()
 {
     return mTraceEventBuffer;
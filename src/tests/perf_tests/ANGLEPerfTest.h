@@ -118,6 +118,13 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     void processResults();
     void processClockResult(const char *metric, double resultSeconds);
     void processMemoryResult(const char *metric, uint64_t resultKB);
+    // Reports percentiles and variance of per-frame times, and returns the median in seconds.
+    double processFrameTimeDistribution(const char *metric, std::vector<double> samplesSeconds);
+    void processFrameHitches(double medianFrameTimeSeconds);
+
+    // Called by tests that time their frames individually once a frame is complete, after the
+    // frame's perf counters are sampled.
+    void recordFrameWallTime(double frameWallTimeSeconds);
 
     void skipTest(const std::string &reason)
     {
@@ -158,6 +165,16 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     std::map<GLuint, CounterInfo> mPerfCounterInfo;
     GLuint mPerfMonitor;
     std::vector<uint64_t> mProcessMemoryUsageKBSamples;
+
+    // Per-frame samples of the current trial.  Each frame time sample remembers the index of the
+    // perf counter samples taken in the same frame, so hitches can be attributed to counters.
+    struct FrameTimeSample
+    {
+        double wallTimeSeconds;
+        size_t perfCounterSampleIndex;
+    };
+    std::vector<FrameTimeSample> mFrameWallTimeSamples;
+    std::vector<double> mGPUTimeSamplesSeconds;
 };
 
 enum class SurfaceType
@@ -223,6 +240,7 @@ class ANGLERenderTest : public ANGLEPerfTest
     void setWebGLCompatibilityEnabled(bool webglCompatibility);
     void setHardenedContextEnabled(bool hardenedContext);
     void setRobustResourceInit(bool enabled);
+    void setNoErrorEnabled(bool enabled);
 
     virtual void startGpuTimer();
     virtual void stopGpuTimer(bool mayNeedFlush = true);
@@ -317,6 +335,17 @@ ParamsT NullDevice(const ParamsT &input)
     return output;
 }
 
+// Runs on the null back-end, which measures the cost of the entry points, validation and state
+// tracking without any back-end or driver work.
+template <typename ParamsT>
+ParamsT FrontendOnly(const ParamsT &input)
+{
+    ParamsT output       = input;
+    output.eglParameters = angle::egl_platform::NULL_BACKEND();
+    output.trackGpuTime  = false;
+    return output;
+}
+
 template <typename ParamsT>
 ParamsT Passthrough(const ParamsT &input)
 {
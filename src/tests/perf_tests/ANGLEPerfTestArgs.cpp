@@ -60,6 +60,9 @@ bool gIncludeInactiveResources     = false;
 bool gTrackGPUTime                 = false;
 bool gAddSwapIntoGPUTime           = false;
 bool gAddSwapIntoFrameWallTime     = false;
+int gBinaryDataResidentSizeMB      = 0;
+bool gPrefetchBinaryData           = false;
+const char *gShaderCorpusDir       = nullptr;
 
 namespace
 {
@@ -74,6 +77,7 @@ bool PerfTestArg(int *argc, char **argv, int argIndex)
            ParseFlag("--warmup", argc, argv, argIndex, &gWarmup) ||
            ParseCStringArg("--trace-file", argc, argv, argIndex, &gTraceFile) ||
            ParseCStringArg("--perf-counters", argc, argv, argIndex, &gPerfCounters) ||
+           ParseCStringArg("--shader-corpus-dir", argc, argv, argIndex, &gShaderCorpusDir) ||
            ParseIntArg("--steps-per-trial", argc, argv, argIndex, &gStepsPerTrial) ||
            ParseIntArg("--max-steps-performed", argc, argv, argIndex, &gMaxStepsPerformed) ||
            ParseIntArg("--fixed-test-time", argc, argv, argIndex, &gFixedTestTime) ||
@@ -111,7 +115,10 @@ bool TraceTestArg(int *argc, char **argv, int argIndex)
            ParseFlag("--track-gpu-time", argc, argv, argIndex, &gTrackGPUTime) ||
            ParseFlag("--add-swap-into-gpu-time", argc, argv, argIndex, &gAddSwapIntoGPUTime) ||
            ParseFlag("--add-swap-into-frame-wall-time", argc, argv, argIndex,
-                     &gAddSwapIntoFrameWallTime);
+                     &gAddSwapIntoFrameWallTime) ||
+           ParseIntArg("--binary-data-resident-size-mb", argc, argv, argIndex,
+                       &gBinaryDataResidentSizeMB) ||
+           ParseFlag("--prefetch-binary-data", argc, argv, argIndex, &gPrefetchBinaryData);
 }
 }  // namespace
 }  // namespace angle
@@ -48,6 +48,9 @@ extern bool gIncludeInactiveResources;
 extern bool gTrackGPUTime;
 extern bool gAddSwapIntoGPUTime;
 extern bool gAddSwapIntoFrameWallTime;
+extern int gBinaryDataResidentSizeMB;
+extern bool gPrefetchBinaryData;
+extern const char *gShaderCorpusDir;
 
 // Constant for when trace's frame count should be used
 constexpr int kAllFrames = -1;
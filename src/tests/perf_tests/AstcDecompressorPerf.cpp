@@ -10,7 +10,10 @@
 
 #include <gmock/gmock.h>
 
+#include <thread>
+
 #include "common/WorkerThread.h"
+#include "common/system_utils.h"
 #include "image_util/AstcDecompressor.h"
 #include "image_util/AstcDecompressorTestUtils.h"
 
@@ -23,15 +26,24 @@ using angle::WorkerThreadPool;
 
 struct AstcDecompressorParams
 {
-    AstcDecompressorParams(uint32_t width, uint32_t height) : width(width), height(height) {}
+    AstcDecompressorParams(uint32_t width, uint32_t height, uint32_t concurrentUploads = 1)
+        : width(width), height(height), concurrentUploads(concurrentUploads)
+    {}
 
     uint32_t width;
     uint32_t height;
+    // Number of images decompressed at the same time from different threads, sharing the same
+    // worker thread pool.
+    uint32_t concurrentUploads;
 };
 
 std::ostream &operator<<(std::ostream &os, const AstcDecompressorParams &params)
 {
     os << params.width << "x" << params.height;
+    if (params.concurrentUploads > 1)
+    {
+        os << "_" << params.concurrentUploads << "_concurrent";
+    }
     return os;
 }
 
@@ -45,9 +57,14 @@ class AstcDecompressorPerfTest : public ANGLEPerfTest,
 
     std::string getName();
 
+    // Records the average time it took to decompress a single image.
+    void recordUploadTime();
+
     AstcDecompressor &mDecompressor;
     std::vector<uint8_t> mInput;
-    std::vector<uint8_t> mOutput;
+    std::vector<std::vector<uint8_t>> mOutputs;
+    double mTotalUploadTimeSec = 0;
+    size_t mUploadCount        = 0;
     std::shared_ptr<WorkerThreadPool> mSingleThreadPool;
     std::shared_ptr<WorkerThreadPool> mMultiThreadPool;
 };
@@ -56,17 +73,63 @@ AstcDecompressorPerfTest::AstcDecompressorPerfTest()
     : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
       mDecompressor(AstcDecompressor::get()),
       mInput(makeAstcCheckerboard(GetParam().width, GetParam().height)),
-      mOutput(GetParam().width * GetParam().height * 4),
+      mOutputs(GetParam().concurrentUploads,
+               std::vector<uint8_t>(GetParam().width * GetParam().height * 4)),
       mSingleThreadPool(
           WorkerThreadPool::Create(angle::ThreadPoolType::Synchronous, 0, ANGLEPlatformCurrent())),
       mMultiThreadPool(
           WorkerThreadPool::Create(angle::ThreadPoolType::Asynchronous, 0, ANGLEPlatformCurrent()))
-{}
+{
+    mReporter->RegisterImportantMetric(".upload_time", "us");
+}
 
 void AstcDecompressorPerfTest::step()
 {
-    mDecompressor.decompress(mSingleThreadPool, mMultiThreadPool, GetParam().width,
-                             GetParam().height, 8, 8, mInput.data(), mInput.size(), mOutput.data());
+    const AstcDecompressorParams &params = GetParam();
+    std::vector<double> uploadTimes(params.concurrentUploads);
+
+    auto upload = [&](uint32_t uploadIndex) {
+        // Each upload decompresses on its own thread, with its own single-thread pool.
+        std::shared_ptr<WorkerThreadPool> singleThreadPool =
+            uploadIndex == 0 ? mSingleThreadPool
+                             : WorkerThreadPool::Create(angle::ThreadPoolType::Synchronous, 0,
+                                                        ANGLEPlatformCurrent());
+
+        double startTime = angle::GetCurrentSystemTime();
+        mDecompressor.decompress(singleThreadPool, mMultiThreadPool, params.width, params.height,
+                                 8, 8, mInput.data(), mInput.size(),
+                                 mOutputs[uploadIndex].data());
+        uploadTimes[uploadIndex] = angle::GetCurrentSystemTime() - startTime;
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t uploadIndex = 1; uploadIndex < params.concurrentUploads; ++uploadIndex)
+    {
+        threads.emplace_back(upload, uploadIndex);
+    }
+    upload(0);
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (double uploadTime : uploadTimes)
+    {
+        mTotalUploadTimeSec += uploadTime;
+    }
+    mUploadCount += params.concurrentUploads;
+}
+
+void AstcDecompressorPerfTest::recordUploadTime()
+{
+    if (mUploadCount == 0)
+    {
+        return;
+    }
+
+    constexpr double kMicroSecondsPerSecond = 1e6;
+    const double uploadTimeUs = mTotalUploadTimeSec / mUploadCount * kMicroSecondsPerSecond;
+    recordDoubleMetric(".upload_time", uploadTimeUs, "us");
 }
 
 std::string AstcDecompressorPerfTest::getName()
@@ -83,13 +146,15 @@ TEST_P(AstcDecompressorPerfTest, Run)
         skipTest("ASTC decompressor not available");
 
     this->run();
+    recordUploadTime();
 }
 
 INSTANTIATE_TEST_SUITE_P(,
                          AstcDecompressorPerfTest,
                          Values(AstcDecompressorParams(16, 16),
                                 AstcDecompressorParams(256, 256),
-                                AstcDecompressorParams(1024, 1024)),
+                                AstcDecompressorParams(1024, 1024),
+                                AstcDecompressorParams(1024, 1024, 4)),
                          PrintToStringParamName());
 
 }  // anonymous namespace
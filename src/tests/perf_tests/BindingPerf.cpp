@@ -243,6 +243,15 @@ BindingsParams VulkanParams(AllocationStyle allocationStyle, TestMode testMode)
     return params;
 }
 
+BindingsParams FrontendOnlyParams(AllocationStyle allocationStyle, TestMode testMode)
+{
+    BindingsParams params;
+    params.eglParameters   = egl_platform::NULL_BACKEND();
+    params.allocationStyle = allocationStyle;
+    params.testMode        = testMode;
+    return params;
+}
+
 TEST_P(BindingsBenchmark, Run)
 {
     run();
@@ -256,6 +265,8 @@ ANGLE_INSTANTIATE_TEST(BindingsBenchmark,
                        OpenGLOrGLESParams(AT_INITIALIZATION),
                        VulkanParams(EVERY_ITERATION, TestMode::MultipleBindings),
                        VulkanParams(AT_INITIALIZATION, TestMode::MultipleBindings),
-                       VulkanParams(AT_INITIALIZATION, TestMode::VertexArray));
+                       VulkanParams(AT_INITIALIZATION, TestMode::VertexArray),
+                       FrontendOnlyParams(EVERY_ITERATION, TestMode::MultipleBindings),
+                       FrontendOnlyParams(AT_INITIALIZATION, TestMode::VertexArray));
 
 }  // namespace angle
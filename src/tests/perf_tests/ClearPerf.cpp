@@ -23,6 +23,9 @@ using namespace angle;
 namespace
 {
 constexpr unsigned int kIterationsPerStep = 256;
+// In the scissored clear then draw scenario, the framebuffer is split in a grid of tiles that are
+// each cleared and drawn to, similarly to what UIs do.
+constexpr GLsizei kTileGridSize = 8;
 
 struct ClearParams final : public RenderTestParams
 {
@@ -36,6 +39,9 @@ struct ClearParams final : public RenderTestParams
         internalFormat = GL_RGBA8;
 
         scissoredClear = false;
+
+        scissoredClearThenDraw  = false;
+        loadOpForScissoredClear = false;
     }
 
     std::string story() const override;
@@ -46,6 +52,9 @@ struct ClearParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool scissoredClear;
+
+    bool scissoredClearThenDraw;
+    bool loadOpForScissoredClear;
 };
 
 std::ostream &operator<<(std::ostream &os, const ClearParams &params)
@@ -70,6 +79,16 @@ std::string ClearParams::story() const
         strstr << "_scissoredClear";
     }
 
+    if (scissoredClearThenDraw)
+    {
+        strstr << "_scissoredClearThenDraw";
+    }
+
+    if (loadOpForScissoredClear)
+    {
+        strstr << "_loadOp";
+    }
+
     return strstr.str();
 }
 
@@ -176,6 +195,25 @@ void ClearBenchmark::drawBenchmark()
             glClear(GL_COLOR_BUFFER_BIT);
         }
     }
+    else if (params.scissoredClearThenDraw)
+    {
+        const GLsizei tileSize = params.fboSize / kTileGridSize;
+        glEnable(GL_SCISSOR_TEST);
+        for (size_t it = 0; it < params.iterationsPerStep; ++it)
+        {
+            for (GLsizei tileY = 0; tileY < kTileGridSize; ++tileY)
+            {
+                for (GLsizei tileX = 0; tileX < kTileGridSize; ++tileX)
+                {
+                    glScissor(tileX * tileSize, tileY * tileSize, tileSize, tileSize);
+                    float clearValue = ((it + tileX + tileY) % 2) * 0.5f + 0.2f;
+                    glClearColor(clearValue, clearValue, clearValue, clearValue);
+                    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                    glDrawArrays(GL_TRIANGLES, 0, 3);
+                }
+            }
+        }
+    }
     else
     {
         for (size_t it = 0; it < params.iterationsPerStep; ++it)
@@ -225,6 +263,20 @@ ClearParams VulkanParams(bool emulatedFormat, bool scissoredClear)
     return params;
 }
 
+ClearParams VulkanScissoredClearThenDrawParams(bool loadOpForScissoredClear)
+{
+    ClearParams params;
+    params.eglParameters          = egl_platform::VULKAN();
+    params.iterationsPerStep      = 4;
+    params.scissoredClearThenDraw = true;
+    if (loadOpForScissoredClear)
+    {
+        params.eglParameters.enable(Feature::PreferLoadOpForScissoredClear);
+        params.loadOpForScissoredClear = true;
+    }
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(ClearBenchmark, Run)
@@ -238,4 +290,6 @@ ANGLE_INSTANTIATE_TEST(ClearBenchmark,
                        OpenGLOrGLESParams(),
                        VulkanParams(false, false),
                        VulkanParams(true, false),
-                       VulkanParams(false, true));
+                       VulkanParams(false, true),
+                       VulkanScissoredClearThenDrawParams(false),
+                       VulkanScissoredClearThenDrawParams(true));
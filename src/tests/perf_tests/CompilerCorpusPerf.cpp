@@ -0,0 +1,293 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerCorpusPerfTest:
+//   Performance test for the shader translator over a corpus of real shaders, such as the ones
+//   extracted from captured traces.  The corpus is the directory given with --shader-corpus-dir,
+//   holding one shader per file and named by stage (.vert, .tesc, .tese, .geom, .frag or .comp).
+//   Every step compiles the whole corpus.  Besides the time per step, the time spent parsing,
+//   transforming the AST and translating it is reported separately, along with the peak memory
+//   used by a compile.
+//
+
+#include "ANGLEPerfTest.h"
+#include "ANGLEPerfTestArgs.h"
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/string_utils.h"
+#include "compiler/translator/Compiler.h"
+#include "compiler/translator/InitializeGlobals.h"
+#include "compiler/translator/PoolAlloc.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+
+namespace
+{
+struct CorpusShader
+{
+    sh::GLenum shaderType;
+    std::string source;
+};
+
+bool GetShaderTypeFromExtension(const std::string &extension, sh::GLenum *shaderTypeOut)
+{
+    static const std::map<std::string, sh::GLenum> kShaderTypes = {
+        {".vert", GL_VERTEX_SHADER},
+        {".tesc", GL_TESS_CONTROL_SHADER_EXT},
+        {".tese", GL_TESS_EVALUATION_SHADER_EXT},
+        {".geom", GL_GEOMETRY_SHADER_EXT},
+        {".frag", GL_FRAGMENT_SHADER},
+        {".comp", GL_COMPUTE_SHADER},
+    };
+    auto iter = kShaderTypes.find(extension);
+    if (iter == kShaderTypes.end())
+    {
+        return false;
+    }
+    *shaderTypeOut = iter->second;
+    return true;
+}
+
+struct CompilerCorpusParameters
+{
+    CompilerCorpusParameters(ShShaderOutput output, const char *outputName)
+        : output(output), outputName(outputName)
+    {}
+
+    ShShaderOutput output;
+    const char *outputName;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CompilerCorpusParameters &p)
+{
+    stream << p.outputName;
+    return stream;
+}
+
+bool IsPlatformAvailable(const CompilerCorpusParameters &param)
+{
+    angle::PoolAllocator allocator;
+    InitializePoolIndex();
+    SetGlobalPoolAllocator(&allocator);
+    ShHandle translator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_2_SPEC, param.output);
+    bool success        = translator != nullptr;
+    SafeDelete(translator);
+    SetGlobalPoolAllocator(nullptr);
+    FreePoolIndex();
+    return success;
+}
+
+class CompilerCorpusPerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<CompilerCorpusParameters>
+{
+  public:
+    CompilerCorpusPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    ShCompileOptions getCompileOptions() const;
+    sh::TCompiler *getTranslator(sh::GLenum shaderType);
+
+    std::vector<CorpusShader> mShaders;
+    size_t mFailedShaderCount;
+
+    ShBuiltInResources mResources;
+    angle::PoolAllocator mAllocator;
+    // One translator per shader stage in the corpus.
+    std::map<sh::GLenum, sh::TCompiler *> mTranslators;
+};
+
+CompilerCorpusPerfTest::CompilerCorpusPerfTest()
+    : ANGLEPerfTest("CompilerCorpusPerf", "", GetParam().outputName, 1), mFailedShaderCount(0)
+{}
+
+ShCompileOptions CompilerCorpusPerfTest::getCompileOptions() const
+{
+    ShCompileOptions compileOptions              = {};
+    compileOptions.objectCode                    = true;
+    compileOptions.initializeUninitializedLocals = true;
+    compileOptions.initOutputVariables           = true;
+    return compileOptions;
+}
+
+sh::TCompiler *CompilerCorpusPerfTest::getTranslator(sh::GLenum shaderType)
+{
+    auto iter = mTranslators.find(shaderType);
+    if (iter != mTranslators.end())
+    {
+        return iter->second;
+    }
+
+    sh::TCompiler *translator =
+        sh::ConstructCompiler(shaderType, SH_GLES3_2_SPEC, GetParam().output);
+    if (translator != nullptr && !translator->Init(mResources))
+    {
+        SafeDelete(translator);
+    }
+    mTranslators[shaderType] = translator;
+    return translator;
+}
+
+void CompilerCorpusPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    if (angle::gShaderCorpusDir == nullptr)
+    {
+        skipTest("No shader corpus given with --shader-corpus-dir");
+        return;
+    }
+
+    InitializePoolIndex();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    sh::InitBuiltInResources(&mResources);
+
+    // Read the corpus in a stable order, so steps are comparable between runs.
+    std::vector<std::filesystem::path> paths;
+    std::error_code error;
+    for (const std::filesystem::directory_entry &entry :
+         std::filesystem::directory_iterator(angle::gShaderCorpusDir, error))
+    {
+        if (entry.is_regular_file())
+        {
+            paths.push_back(entry.path());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    const ShCompileOptions compileOptions = getCompileOptions();
+    for (const std::filesystem::path &path : paths)
+    {
+        CorpusShader shader;
+        if (!GetShaderTypeFromExtension(path.extension().string(), &shader.shaderType) ||
+            !angle::ReadFileToString(path.string(), &shader.source))
+        {
+            continue;
+        }
+
+        sh::TCompiler *translator = getTranslator(shader.shaderType);
+        if (translator == nullptr)
+        {
+            skipTest("The translator for this output is not available");
+            return;
+        }
+
+        // Leave out the shaders that don't compile, for example because they need an extension
+        // that isn't enabled, so that the corpus measures complete compiles only.
+        const char *shaderStrings[] = {shader.source.c_str()};
+        if (!translator->compile(shaderStrings, compileOptions))
+        {
+            ++mFailedShaderCount;
+            continue;
+        }
+        mShaders.push_back(std::move(shader));
+    }
+
+    if (mShaders.empty())
+    {
+        skipTest("No shader in the corpus compiles");
+        return;
+    }
+
+    for (auto &translator : mTranslators)
+    {
+        translator.second->setMeasureCompilePhaseTimes(true);
+    }
+}
+
+void CompilerCorpusPerfTest::TearDown()
+{
+    if (!mShaders.empty() && mTotalNumStepsPerformed > 0)
+    {
+        sh::CompilePhaseTimes phaseTimes;
+        size_t peakAllocatedBytes = 0;
+        for (const auto &translator : mTranslators)
+        {
+            const sh::CompilePhaseTimes &translatorTimes =
+                translator.second->getCompilePhaseTimes();
+            phaseTimes.parseSeconds += translatorTimes.parseSeconds;
+            phaseTimes.transformSeconds += translatorTimes.transformSeconds;
+            phaseTimes.translateSeconds += translatorTimes.translateSeconds;
+
+            peakAllocatedBytes =
+                std::max(peakAllocatedBytes,
+                         translator.second->getCompileAllocatorStatistics().peakAllocatedBytes);
+        }
+
+        // Report the time of each phase per step, like the step time itself.
+        constexpr double kMicroSecondsPerSecond = 1e6;
+        const double secondsToUsPerStep = kMicroSecondsPerSecond / mTotalNumStepsPerformed;
+        const struct
+        {
+            const char *metric;
+            double seconds;
+        } phaseMetrics[] = {
+            {".parse_time", phaseTimes.parseSeconds},
+            {".transform_time", phaseTimes.transformSeconds},
+            {".translate_time", phaseTimes.translateSeconds},
+        };
+        for (const auto &phaseMetric : phaseMetrics)
+        {
+            mReporter->RegisterFyiMetric(phaseMetric.metric, "us");
+            recordDoubleMetric(phaseMetric.metric, phaseMetric.seconds * secondsToUsPerStep,
+                               "us");
+        }
+
+        mReporter->RegisterFyiMetric(".pool_peak_allocated_bytes", "sizeInBytes");
+        recordIntegerMetric(".pool_peak_allocated_bytes", peakAllocatedBytes, "sizeInBytes");
+        mReporter->RegisterFyiMetric(".shaders", "count");
+        recordIntegerMetric(".shaders", mShaders.size(), "count");
+        mReporter->RegisterFyiMetric(".failed_shaders", "count");
+        recordIntegerMetric(".failed_shaders", mFailedShaderCount, "count");
+    }
+
+    for (auto &translator : mTranslators)
+    {
+        SafeDelete(translator.second);
+    }
+    mTranslators.clear();
+
+    if (angle::gShaderCorpusDir != nullptr)
+    {
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator.reset();
+
+        FreePoolIndex();
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerCorpusPerfTest::step()
+{
+    const ShCompileOptions compileOptions = getCompileOptions();
+    for (const CorpusShader &shader : mShaders)
+    {
+        const char *shaderStrings[] = {shader.source.c_str()};
+        mTranslators[shader.shaderType]->compile(shaderStrings, compileOptions);
+    }
+}
+
+TEST_P(CompilerCorpusPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerCorpusPerfTest,
+                       CompilerCorpusParameters(SH_SPIRV_VULKAN_OUTPUT, "SPIRV"),
+                       CompilerCorpusParameters(SH_MSL_METAL_OUTPUT, "MSL"),
+                       CompilerCorpusParameters(SH_WGSL_OUTPUT, "WGSL"),
+                       CompilerCorpusParameters(SH_HLSL_4_1_OUTPUT, "HLSL_4_1"),
+                       CompilerCorpusParameters(SH_GLSL_450_CORE_OUTPUT, "GLSL_4_50"),
+                       CompilerCorpusParameters(SH_ESSL_OUTPUT, "ESSL"));
+
+}  // anonymous namespace
@@ -16,6 +16,8 @@
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
 
+#include <sstream>
+
 namespace
 {
 
@@ -162,6 +164,77 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// A large generated shader with long identifiers and no preprocessor directive besides #version,
+// like the shaders that some engines generate.  Its compile time is dominated by lexing and
+// parsing.
+const char *GetLargeESSL300FragSource()
+{
+    constexpr int kFunctionCount = 200;
+
+    static const std::string source = [] {
+        std::stringstream stream;
+        stream << "#version 300 es\n"
+                  "precision highp float;\n"
+                  "uniform vec4 generatedUniformInputValue;\n"
+                  "out vec4 generatedFragmentOutputColor;\n";
+        for (int function = 0; function < kFunctionCount; ++function)
+        {
+            stream << "float generatedHelperFunction" << function
+                   << "(float generatedInputParameter, vec4 generatedVectorParameter)\n"
+                      "{\n"
+                      "    // Comments are removed by the preprocessor.\n"
+                      "    float generatedTemporaryValue = generatedInputParameter * 1.5 + "
+                      "generatedVectorParameter.y;\n"
+                      "    vec4 generatedTemporaryVector = generatedVectorParameter.wzyx * "
+                      "generatedTemporaryValue;\n"
+                      "    return dot(generatedTemporaryVector, generatedVectorParameter) + "
+                   << function << ".0;\n"
+                   << "}\n";
+        }
+        stream << "void main()\n"
+                  "{\n"
+                  "    float generatedAccumulator = 0.0;\n";
+        for (int function = 0; function < kFunctionCount; ++function)
+        {
+            stream << "    generatedAccumulator += generatedHelperFunction" << function
+                   << "(generatedAccumulator, generatedUniformInputValue);\n";
+        }
+        stream << "    generatedFragmentOutputColor = vec4(generatedAccumulator);\n"
+                  "}\n";
+        return stream.str();
+    }();
+
+    return source.c_str();
+}
+
+const char *kLargeESSL300Id = "LargeESSL300";
+
+// Indexes arrays in a uniform block dynamically, as done to loop over lights or bones.
+const char *kBufferIndexingESSL300FragSource = R"(#version 300 es
+precision highp float;
+uniform Lights
+{
+    vec4 positions[64];
+    vec4 colors[64];
+    mat4 transforms[16];
+} lights;
+uniform int uCount;
+in vec3 vPosition;
+out vec4 outColor;
+void main()
+{
+    vec3 color = vec3(0);
+    for (int i = 0; i < uCount; ++i)
+    {
+        vec4 position = lights.transforms[i % 16] * lights.positions[i];
+        vec3 toLight = position.xyz - vPosition;
+        color += lights.colors[i].rgb / (1.0 + dot(toLight, toLight));
+    }
+    outColor = vec4(color, 1.0);
+})";
+
+const char *kBufferIndexingESSL300Id = "BufferIndexingESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -180,6 +253,10 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_SPIRV_VULKAN_OUTPUT:
+                return "SPIRV";
+            case SH_WGSL_OUTPUT:
+                return "WGSL";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -195,6 +272,8 @@ bool IsPlatformAvailable(const CompilerParameters &param)
     {
         case SH_HLSL_4_1_OUTPUT:
         case SH_HLSL_3_0_OUTPUT:
+        case SH_SPIRV_VULKAN_OUTPUT:
+        case SH_WGSL_OUTPUT:
         {
             angle::PoolAllocator allocator;
             InitializePoolIndex();
@@ -216,19 +295,53 @@ bool IsPlatformAvailable(const CompilerParameters &param)
     return true;
 }
 
+// Variations of the SPIR-V output, which also report the size of the generated SPIR-V.
+enum class SpirvVariant
+{
+    Default,
+    // Generate the SPIR-V from the IR, see ShCompileOptions::useIR.
+    IR,
+    // Generate the SPIR-V from the IR and optimize it, see
+    // ShCompileOptions::optimizeSPIRVForPerformance.
+    IROptimized,
+    // Clamp dynamic indices, see ShCompileOptions::clampIndirectArrayBounds.
+    ClampedIndices,
+    // Same, except for arrays in buffer blocks, see
+    // ShCompileOptions::skipClampingIndirectIndicesInBufferBlocks.
+    RobustBufferAccess,
+};
+
 struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           SpirvVariant spirvVariant = SpirvVariant::Default)
+        : CompilerParameters(output), shaderSource(shaderSource), spirvVariant(spirvVariant)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
+        if (spirvVariant == SpirvVariant::IR)
+        {
+            testId += "_IR";
+        }
+        else if (spirvVariant == SpirvVariant::IROptimized)
+        {
+            testId += "_IR_optimized";
+        }
+        else if (spirvVariant == SpirvVariant::ClampedIndices)
+        {
+            testId += "_clamped_indices";
+        }
+        else if (spirvVariant == SpirvVariant::RobustBufferAccess)
+        {
+            testId += "_robust_buffer_access";
+        }
     }
 
     const char *shaderSource;
+    SpirvVariant spirvVariant;
     std::string testId;
 };
 
@@ -285,6 +398,59 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator)
+    {
+        // Report how the compile allocator behaved, which helps tune its page size.  Once warmed
+        // up, compiles should recycle pages rather than create new ones.
+        const angle::PoolAllocatorStatistics &stats = mTranslator->getCompileAllocatorStatistics();
+        const struct
+        {
+            const char *metric;
+            size_t value;
+            const char *units;
+        } poolMetrics[] = {
+            {".pool_peak_allocated_bytes", stats.peakAllocatedBytes, "sizeInBytes"},
+            {".pool_peak_pages_in_use", stats.peakPagesInUse, "count"},
+            {".pool_pages_created", stats.pagesCreated, "count"},
+            {".pool_pages_recycled", stats.pagesRecycled, "count"},
+            {".pool_multi_page_allocations", stats.multiPageAllocations, "count"},
+        };
+        for (const auto &poolMetric : poolMetrics)
+        {
+            mReporter->RegisterFyiMetric(poolMetric.metric, poolMetric.units);
+            recordIntegerMetric(poolMetric.metric, poolMetric.value, poolMetric.units);
+        }
+
+        // Report the size of the generated SPIR-V, which shows the effect of the optimizations.
+        const sh::TInfoSinkBase &objectSink = mTranslator->getInfoSink().obj;
+        if (GetParam().output == SH_SPIRV_VULKAN_OUTPUT && objectSink.isBinary())
+        {
+            const sh::BinaryBlob &spirv = objectSink.getBinary();
+
+            // Skip the 5-word header.  The high 16 bits of the first word of each instruction
+            // hold its word count.
+            size_t instructionCount = 0;
+            size_t word             = 5;
+            while (word < spirv.size() && (spirv[word] >> 16) != 0)
+            {
+                word += spirv[word] >> 16;
+                ++instructionCount;
+            }
+
+            mReporter->RegisterFyiMetric(".spirv_instruction_count", "count");
+            recordIntegerMetric(".spirv_instruction_count", instructionCount, "count");
+            mReporter->RegisterFyiMetric(".spirv_size", "sizeInBytes");
+            recordIntegerMetric(".spirv_size", spirv.size() * sizeof(uint32_t), "sizeInBytes");
+        }
+
+        // Report the size of the generated WGSL, which the WGSL compiler has to parse again.
+        if (GetParam().output == SH_WGSL_OUTPUT)
+        {
+            mReporter->RegisterFyiMetric(".wgsl_size", "sizeInBytes");
+            recordIntegerMetric(".wgsl_size", objectSink.str().size(), "sizeInBytes");
+        }
+    }
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -304,6 +470,20 @@ void CompilerPerfTest::step()
     compileOptions.initializeUninitializedLocals = true;
     compileOptions.initOutputVariables           = true;
 
+    const SpirvVariant spirvVariant = GetParam().spirvVariant;
+    if (spirvVariant == SpirvVariant::IR || spirvVariant == SpirvVariant::IROptimized)
+    {
+        compileOptions.useIR                       = true;
+        compileOptions.optimizeSPIRVForPerformance = spirvVariant == SpirvVariant::IROptimized;
+    }
+    if (spirvVariant == SpirvVariant::ClampedIndices ||
+        spirvVariant == SpirvVariant::RobustBufferAccess)
+    {
+        compileOptions.clampIndirectArrayBounds = true;
+        compileOptions.skipClampingIndirectIndicesInBufferBlocks =
+            spirvVariant == SpirvVariant::RobustBufferAccess;
+    }
+
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
     if (!mTranslator->compile(shaderStrings, compileOptions))
@@ -330,15 +510,50 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           SpirvVariant::IR),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           SpirvVariant::IROptimized),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kTrickyESSL300FragSource,
+                           kTrickyESSL300Id,
+                           SpirvVariant::IR),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kTrickyESSL300FragSource,
+                           kTrickyESSL300Id,
+                           SpirvVariant::IROptimized),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kBufferIndexingESSL300FragSource,
+                           kBufferIndexingESSL300Id,
+                           SpirvVariant::ClampedIndices),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kBufferIndexingESSL300FragSource,
+                           kBufferIndexingESSL300Id,
+                           SpirvVariant::RobustBufferAccess),
+    CompilerPerfParameters(SH_WGSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_WGSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_WGSL_OUTPUT, GetLargeESSL300FragSource(), kLargeESSL300Id));
 
 }  // anonymous namespace
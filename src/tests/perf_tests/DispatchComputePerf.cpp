@@ -29,6 +29,9 @@ struct DispatchComputePerfParams final : public RenderTestParams
     unsigned int localSizeY    = 16;
     unsigned int textureWidth  = 32;
     unsigned int textureHeight = 32;
+
+    // Issued after each dispatch.
+    GLbitfield memoryBarrierBits = GL_TEXTURE_FETCH_BARRIER_BIT;
 };
 
 std::string DispatchComputePerfParams::story() const
@@ -40,6 +43,10 @@ std::string DispatchComputePerfParams::story() const
     {
         storyStr << "_null";
     }
+    if (memoryBarrierBits == GL_SHADER_IMAGE_ACCESS_BARRIER_BIT)
+    {
+        storyStr << "_image_barrier";
+    }
     return storyStr.str();
 }
 
@@ -150,7 +157,7 @@ void DispatchComputePerfBenchmark::drawBenchmark()
     for (unsigned int it = 0; it < params.iterationsPerStep; it++)
     {
         glDispatchCompute(mDispatchX, mDispatchY, 1);
-        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+        glMemoryBarrier(params.memoryBarrierBits);
     }
     ASSERT_GL_NO_ERROR();
 }
@@ -162,12 +169,30 @@ DispatchComputePerfParams DispatchComputePerfOpenGLOrGLESParams()
     return params;
 }
 
+DispatchComputePerfParams DispatchComputePerfVulkanParams()
+{
+    DispatchComputePerfParams params;
+    params.eglParameters = angle::egl_platform::VULKAN();
+    return params;
+}
+
+// Only orders the image writes of consecutive dispatches.
+DispatchComputePerfParams DispatchComputePerfVulkanImageBarrierParams()
+{
+    DispatchComputePerfParams params = DispatchComputePerfVulkanParams();
+    params.memoryBarrierBits         = GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+    return params;
+}
+
 TEST_P(DispatchComputePerfBenchmark, Run)
 {
     run();
 }
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DispatchComputePerfBenchmark);
-ANGLE_INSTANTIATE_TEST(DispatchComputePerfBenchmark, DispatchComputePerfOpenGLOrGLESParams());
+ANGLE_INSTANTIATE_TEST(DispatchComputePerfBenchmark,
+                       DispatchComputePerfOpenGLOrGLESParams(),
+                       DispatchComputePerfVulkanParams(),
+                       DispatchComputePerfVulkanImageBarrierParams());
 
 }  // namespace
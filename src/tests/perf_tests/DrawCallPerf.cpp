@@ -45,6 +45,9 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+    // Use a KHR_no_error context, so that comparing against the default tracks the cost of draw
+    // call validation.
+    bool noError = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -86,6 +89,11 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     return strstr.str();
 }
 
@@ -159,6 +167,8 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    setNoErrorEnabled(params.noError);
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -655,15 +665,34 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams CombineNoError(const DrawArraysPerfParams &in, bool noError)
+{
+    DrawArraysPerfParams out = in;
+    out.noError              = noError;
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
 std::vector<P> gTestsWithStateChange =
     CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
+std::vector<P> gTestsWithNoError =
+    CombineWithValues(gTestsWithStateChange, {false, true}, CombineNoError);
 std::vector<P> gTestsWithRenderer =
-    CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
+    CombineWithFuncs(gTestsWithNoError, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WebGPU<P>, WGL<P>});
 std::vector<P> gTestsWithDevice =
     CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+std::vector<P> gTestsFrontendOnly = CombineWithFuncs(gTestsWithNoError, {FrontendOnly<P>});
+
+std::vector<P> CombineTests()
+{
+    std::vector<P> tests = gTestsWithDevice;
+    tests.insert(tests.end(), gTestsFrontendOnly.begin(), gTestsFrontendOnly.end());
+    return tests;
+}
+
+std::vector<P> gTests = CombineTests();
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTests);
 
 }  // anonymous namespace
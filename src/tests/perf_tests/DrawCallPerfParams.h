@@ -85,6 +85,14 @@ ParamsT VulkanSwiftShader(const ParamsT &in)
     return out;
 }
 
+template <typename ParamsT>
+ParamsT WebGPU(const ParamsT &in)
+{
+    ParamsT out       = in;
+    out.eglParameters = angle::egl_platform::WEBGPU();
+    return out;
+}
+
 template <typename ParamsT>
 ParamsT WGL(const ParamsT &in)
 {
@@ -0,0 +1,289 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLContextContentionPerfTest:
+//   Performance test for GL calls made concurrently from several threads, each with its own
+//   context.  The contexts are either all in one share group or each in their own, which shows
+//   how much independent share groups are serialized by entry point locking.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/platform.h"
+#include "common/system_utils.h"
+#include "platform/PlatformMethods.h"
+#include "test_utils/angle_test_configs.h"
+#include "test_utils/angle_test_instantiate.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace testing;
+
+namespace
+{
+constexpr size_t kThreadCount          = 4;
+constexpr uint32_t kCallsPerThreadStep = 1000;
+
+struct EGLContextContentionParams final : public angle::PlatformParameters
+{
+    EGLContextContentionParams(const angle::PlatformParameters &platform, bool sharedContexts)
+        : angle::PlatformParameters(platform), sharedContexts(sharedContexts)
+    {}
+
+    std::string story() const
+    {
+        return sharedContexts ? "_shared_share_group" : "_independent_share_groups";
+    }
+
+    bool sharedContexts;
+};
+
+std::ostream &operator<<(std::ostream &os, const EGLContextContentionParams &params)
+{
+    os << static_cast<const angle::PlatformParameters &>(params) << params.story();
+    return os;
+}
+
+class EGLContextContentionPerfTest : public ANGLEPerfTest,
+                                     public WithParamInterface<EGLContextContentionParams>
+{
+  public:
+    EGLContextContentionPerfTest();
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    void workerThread(size_t threadIndex);
+
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    EGLConfig mConfig;
+    EGLContext mMainContext;
+    EGLSurface mMainSurface;
+    std::array<EGLContext, kThreadCount> mContexts;
+    std::array<EGLSurface, kThreadCount> mSurfaces;
+    std::array<std::thread, kThreadCount> mThreads;
+    std::unique_ptr<angle::Library> mEGLLibrary;
+
+    // Each step bumps mStepSerial to release the workers, then waits for all of them to report
+    // back through mFinishedThreads.
+    std::mutex mStepMutex;
+    std::condition_variable mStepCondition;
+    uint64_t mStepSerial;
+    size_t mFinishedThreads;
+    bool mStopping;
+};
+
+EGLContextContentionPerfTest::EGLContextContentionPerfTest()
+    : ANGLEPerfTest("EGLContextContention", "", GetParam().story(), 1),
+      mOSWindow(nullptr),
+      mDisplay(EGL_NO_DISPLAY),
+      mConfig(nullptr),
+      mMainContext(EGL_NO_CONTEXT),
+      mMainSurface(EGL_NO_SURFACE),
+      mContexts({}),
+      mSurfaces({}),
+      mStepSerial(0),
+      mFinishedThreads(0),
+      mStopping(false)
+{
+    auto platform = GetParam().eglParameters;
+
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("EGLContextContention Test", 64, 64);
+    const EGLenum platformType = mOSWindow->getNativeDisplayPlatformType();
+
+    std::vector<EGLAttrib> displayAttributes;
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.renderer);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_NATIVE_PLATFORM_TYPE_ANGLE);
+    displayAttributes.push_back(platformType);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
+    displayAttributes.push_back(platform.majorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
+    displayAttributes.push_back(platform.minorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.deviceType);
+    displayAttributes.push_back(EGL_NONE);
+
+    mEGLLibrary.reset(
+        angle::OpenSharedLibrary(ANGLE_EGL_LIBRARY_NAME, angle::SearchType::ModuleDir));
+
+    LoadProc getProc = reinterpret_cast<LoadProc>(mEGLLibrary->getSymbol("eglGetProcAddress"));
+
+    if (!getProc)
+    {
+        abortTest();
+    }
+    else
+    {
+        LoadUtilEGL(getProc);
+        // Test harness warmup calls glFinish so we need GLES too.
+        LoadUtilGLES(getProc);
+
+        if (!eglGetPlatformDisplay)
+        {
+            abortTest();
+        }
+        else
+        {
+            mDisplay = eglGetPlatformDisplay(
+                EGL_PLATFORM_ANGLE_ANGLE, reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
+                &displayAttributes[0]);
+        }
+    }
+}
+
+void EGLContextContentionPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+    EGLint majorVersion, minorVersion;
+    ASSERT_TRUE(eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    EGLint numConfigs;
+    EGLint configAttrs[] = {EGL_RED_SIZE,
+                            8,
+                            EGL_GREEN_SIZE,
+                            8,
+                            EGL_BLUE_SIZE,
+                            8,
+                            EGL_RENDERABLE_TYPE,
+                            GetParam().majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT,
+                            EGL_SURFACE_TYPE,
+                            EGL_PBUFFER_BIT,
+                            EGL_NONE};
+
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
+
+    const EGLint pbufferAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+
+    mMainContext = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, nullptr);
+    ASSERT_NE(EGL_NO_CONTEXT, mMainContext);
+    mMainSurface = eglCreatePbufferSurface(mDisplay, mConfig, pbufferAttribs);
+    ASSERT_NE(EGL_NO_SURFACE, mMainSurface);
+
+    const EGLContext shareContext = GetParam().sharedContexts ? mMainContext : EGL_NO_CONTEXT;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        mContexts[threadIndex] = eglCreateContext(mDisplay, mConfig, shareContext, nullptr);
+        ASSERT_NE(EGL_NO_CONTEXT, mContexts[threadIndex]);
+        mSurfaces[threadIndex] = eglCreatePbufferSurface(mDisplay, mConfig, pbufferAttribs);
+        ASSERT_NE(EGL_NO_SURFACE, mSurfaces[threadIndex]);
+    }
+
+    ASSERT_TRUE(eglMakeCurrent(mDisplay, mMainSurface, mMainSurface, mMainContext));
+
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        mThreads[threadIndex] =
+            std::thread(&EGLContextContentionPerfTest::workerThread, this, threadIndex);
+    }
+}
+
+void EGLContextContentionPerfTest::TearDown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mStepMutex);
+        mStopping = true;
+    }
+    mStepCondition.notify_all();
+    for (std::thread &thread : mThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    ANGLEPerfTest::TearDown();
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        eglDestroySurface(mDisplay, mSurfaces[threadIndex]);
+        eglDestroyContext(mDisplay, mContexts[threadIndex]);
+    }
+    eglDestroySurface(mDisplay, mMainSurface);
+    eglDestroyContext(mDisplay, mMainContext);
+}
+
+void EGLContextContentionPerfTest::workerThread(size_t threadIndex)
+{
+    eglMakeCurrent(mDisplay, mSurfaces[threadIndex], mSurfaces[threadIndex],
+                   mContexts[threadIndex]);
+
+    // Binding buffers is cheap in every backend, so the cost of each call is dominated by the
+    // entry point and its locking.
+    std::array<GLuint, 2> buffers = {};
+    glGenBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+
+    uint64_t stepSerial = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mStepMutex);
+            mStepCondition.wait(lock, [&] { return mStopping || mStepSerial != stepSerial; });
+            if (mStopping)
+            {
+                break;
+            }
+            stepSerial = mStepSerial;
+        }
+
+        for (uint32_t call = 0; call < kCallsPerThreadStep; ++call)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffers[call % buffers.size()]);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mStepMutex);
+            ++mFinishedThreads;
+        }
+        mStepCondition.notify_all();
+    }
+
+    glDeleteBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+void EGLContextContentionPerfTest::step()
+{
+    std::unique_lock<std::mutex> lock(mStepMutex);
+    mFinishedThreads = 0;
+    ++mStepSerial;
+    mStepCondition.notify_all();
+    mStepCondition.wait(lock, [this] { return mFinishedThreads == kThreadCount; });
+}
+
+TEST_P(EGLContextContentionPerfTest, Run)
+{
+    run();
+}
+
+std::vector<EGLContextContentionParams> GetTestParams()
+{
+    std::vector<EGLContextContentionParams> params;
+    for (const angle::PlatformParameters &platform :
+         {angle::ES2_D3D11(), angle::ES2_METAL(), angle::ES2_OPENGL(), angle::ES2_OPENGLES(),
+          angle::ES2_VULKAN()})
+    {
+        params.emplace_back(platform, false);
+        params.emplace_back(platform, true);
+    }
+    return params;
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLContextContentionPerfTest);
+// Like EGLMakeCurrentPerfTest, run on GL(ES) and Vulkan everywhere except Android.
+#if !defined(ANGLE_PLATFORM_ANDROID)
+ANGLE_INSTANTIATE_TEST_ARRAY(EGLContextContentionPerfTest, GetTestParams());
+#endif
+
+}  // namespace
@@ -18,13 +18,21 @@ using namespace testing;
 
 namespace
 {
-// Only applies to D3D11
 struct Captures final : private angle::NonCopyable
 {
     Timer timer;
+
+    // Only applies to D3D11
     size_t loadDLLsMS      = 0;
     size_t createDeviceMS  = 0;
     size_t initResourcesMS = 0;
+
+    // Only applies to Vulkan
+    size_t vulkanCreateInstanceUS        = 0;
+    size_t vulkanSelectPhysicalDeviceUS  = 0;
+    size_t vulkanSetupDeviceUS           = 0;
+    size_t vulkanCreateDeviceUS          = 0;
+    size_t vulkanInitializeFormatTableUS = 0;
 };
 
 double CapturePlatform_currentTime(angle::PlatformMethods *platformMethods)
@@ -56,6 +64,28 @@ void CapturePlatform_histogramCustomCounts(angle::PlatformMethods *platformMetho
     {
         captures->initResourcesMS += static_cast<size_t>(sample);
     }
+    else if (ANGLE_UNSAFE_TODO(strcmp(name, "GPU.ANGLE.VulkanCreateInstanceUs")) == 0)
+    {
+        captures->vulkanCreateInstanceUS += static_cast<size_t>(sample);
+    }
+    else if (ANGLE_UNSAFE_TODO(strcmp(name, "GPU.ANGLE.VulkanSelectPhysicalDeviceUs")) == 0)
+    {
+        captures->vulkanSelectPhysicalDeviceUS += static_cast<size_t>(sample);
+    }
+    else if (ANGLE_UNSAFE_TODO(strcmp(name, "GPU.ANGLE.VulkanSetupDeviceUs")) == 0)
+    {
+        captures->vulkanSetupDeviceUS += static_cast<size_t>(sample);
+    }
+    // Note: the format table may be initialized in parallel with the device creation, so the two
+    // don't necessarily add up.
+    else if (ANGLE_UNSAFE_TODO(strcmp(name, "GPU.ANGLE.VulkanCreateDeviceUs")) == 0)
+    {
+        captures->vulkanCreateDeviceUS += static_cast<size_t>(sample);
+    }
+    else if (ANGLE_UNSAFE_TODO(strcmp(name, "GPU.ANGLE.VulkanInitializeFormatTableUs")) == 0)
+    {
+        captures->vulkanInitializeFormatTableUS += static_cast<size_t>(sample);
+    }
 }
 
 class EGLInitializePerfTest : public ANGLEPerfTest,
@@ -129,6 +159,11 @@ void EGLInitializePerfTest::SetUp()
     mReporter->RegisterImportantMetric(".LoadDLLs", "ms");
     mReporter->RegisterImportantMetric(".D3D11CreateDevice", "ms");
     mReporter->RegisterImportantMetric(".InitResources", "ms");
+    mReporter->RegisterImportantMetric(".VulkanCreateInstance", "us");
+    mReporter->RegisterImportantMetric(".VulkanSelectPhysicalDevice", "us");
+    mReporter->RegisterImportantMetric(".VulkanSetupDevice", "us");
+    mReporter->RegisterImportantMetric(".VulkanCreateDevice", "us");
+    mReporter->RegisterImportantMetric(".VulkanInitializeFormatTable", "us");
 }
 
 EGLInitializePerfTest::~EGLInitializePerfTest()
@@ -152,6 +187,13 @@ void EGLInitializePerfTest::TearDown()
     mReporter->AddResult(".LoadDLLs", normalizedTime(mCaptures.loadDLLsMS));
     mReporter->AddResult(".D3D11CreateDevice", normalizedTime(mCaptures.createDeviceMS));
     mReporter->AddResult(".InitResources", normalizedTime(mCaptures.initResourcesMS));
+    mReporter->AddResult(".VulkanCreateInstance", normalizedTime(mCaptures.vulkanCreateInstanceUS));
+    mReporter->AddResult(".VulkanSelectPhysicalDevice",
+                         normalizedTime(mCaptures.vulkanSelectPhysicalDeviceUS));
+    mReporter->AddResult(".VulkanSetupDevice", normalizedTime(mCaptures.vulkanSetupDeviceUS));
+    mReporter->AddResult(".VulkanCreateDevice", normalizedTime(mCaptures.vulkanCreateDeviceUS));
+    mReporter->AddResult(".VulkanInitializeFormatTable",
+                         normalizedTime(mCaptures.vulkanInitializeFormatTableUS));
 
     ANGLEResetDisplayPlatform(mDisplay);
 }
@@ -0,0 +1,486 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLShareGroupWorkloadPerfTest:
+//   Performance test for contexts of one share group working on shared textures from several
+//   threads at once.  Two workloads are measured:
+//
+//   - UploadWhileDraw: one thread keeps uploading to the shared textures while the others draw
+//     with them, like a streaming or decoder thread feeding a renderer.
+//   - SyncHandoff: threads are paired; the producer of each pair updates a texture and hands it
+//     to the consumer with an EGLSync, which the consumer waits on before drawing with it.
+//
+//   The time per step is the throughput of the whole share group.  The number of handed off syncs
+//   that weren't signaled yet when the consumer got them is reported on the side.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/platform.h"
+#include "common/system_utils.h"
+#include "test_utils/angle_test_configs.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "util/shader_utils.h"
+#include "util/util_gl.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace testing;
+
+namespace
+{
+constexpr GLsizei kTextureCount         = 4;
+constexpr GLsizei kTextureSize          = 256;
+constexpr uint32_t kDrawsPerThreadStep  = 100;
+constexpr uint32_t kHandoffsPerPairStep = 20;
+constexpr GLsizei kHandoffUpdateSize    = 64;
+
+enum class ShareGroupWorkload
+{
+    UploadWhileDraw,
+    SyncHandoff,
+};
+
+struct EGLShareGroupWorkloadParams final : public angle::PlatformParameters
+{
+    EGLShareGroupWorkloadParams(const angle::PlatformParameters &platform,
+                                ShareGroupWorkload workload,
+                                size_t threadCount)
+        : angle::PlatformParameters(platform), workload(workload), threadCount(threadCount)
+    {}
+
+    std::string story() const
+    {
+        std::stringstream strstr;
+        strstr << (workload == ShareGroupWorkload::UploadWhileDraw ? "_upload_while_draw"
+                                                                   : "_sync_handoff");
+        strstr << "_" << threadCount << "_threads";
+        return strstr.str();
+    }
+
+    ShareGroupWorkload workload;
+    size_t threadCount;
+};
+
+std::ostream &operator<<(std::ostream &os, const EGLShareGroupWorkloadParams &params)
+{
+    os << static_cast<const angle::PlatformParameters &>(params) << params.story();
+    return os;
+}
+
+// The sync of the last update a producer handed to its consumer.  It holds at most one sync, so
+// the producer waits for the consumer to take the previous one before handing off the next.
+struct HandoffSlot
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    EGLSync sync = EGL_NO_SYNC;
+};
+
+class EGLShareGroupWorkloadPerfTest : public ANGLEPerfTest,
+                                      public WithParamInterface<EGLShareGroupWorkloadParams>
+{
+  public:
+    EGLShareGroupWorkloadPerfTest();
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    void workerThread(size_t threadIndex);
+    void uploadTextures();
+    void drawWithTextures(uint32_t drawCount);
+    void produceHandoffs(HandoffSlot *slot, GLuint texture);
+    void consumeHandoffs(HandoffSlot *slot, GLuint texture);
+    void draw(GLuint texture);
+
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    EGLConfig mConfig;
+    EGLContext mMainContext;
+    EGLSurface mMainSurface;
+    std::vector<EGLContext> mContexts;
+    std::vector<EGLSurface> mSurfaces;
+    std::vector<std::thread> mThreads;
+    std::vector<std::unique_ptr<HandoffSlot>> mHandoffSlots;
+    std::unique_ptr<angle::Library> mEGLLibrary;
+
+    // The textures are created by the main context and used by all the worker contexts.
+    std::array<GLuint, kTextureCount> mSharedTextures;
+    std::vector<uint8_t> mUploadData;
+    std::atomic<size_t> mUnsignaledHandoffs;
+
+    // Each step bumps mStepSerial to release the workers, then waits for all of them to report
+    // back through mFinishedThreads.
+    std::mutex mStepMutex;
+    std::condition_variable mStepCondition;
+    uint64_t mStepSerial;
+    size_t mFinishedThreads;
+    bool mStopping;
+};
+
+EGLShareGroupWorkloadPerfTest::EGLShareGroupWorkloadPerfTest()
+    : ANGLEPerfTest("EGLShareGroupWorkload", "", GetParam().story(), 1),
+      mOSWindow(nullptr),
+      mDisplay(EGL_NO_DISPLAY),
+      mConfig(nullptr),
+      mMainContext(EGL_NO_CONTEXT),
+      mMainSurface(EGL_NO_SURFACE),
+      mSharedTextures({}),
+      mUnsignaledHandoffs(0),
+      mStepSerial(0),
+      mFinishedThreads(0),
+      mStopping(false)
+{
+    auto platform = GetParam().eglParameters;
+
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("EGLShareGroupWorkload Test", 64, 64);
+    const EGLenum platformType = mOSWindow->getNativeDisplayPlatformType();
+
+    std::vector<EGLAttrib> displayAttributes;
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.renderer);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_NATIVE_PLATFORM_TYPE_ANGLE);
+    displayAttributes.push_back(platformType);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MAJOR_ANGLE);
+    displayAttributes.push_back(platform.majorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_MAX_VERSION_MINOR_ANGLE);
+    displayAttributes.push_back(platform.minorVersion);
+    displayAttributes.push_back(EGL_PLATFORM_ANGLE_DEVICE_TYPE_ANGLE);
+    displayAttributes.push_back(platform.deviceType);
+    displayAttributes.push_back(EGL_NONE);
+
+    mEGLLibrary.reset(
+        angle::OpenSharedLibrary(ANGLE_EGL_LIBRARY_NAME, angle::SearchType::ModuleDir));
+
+    LoadProc getProc = reinterpret_cast<LoadProc>(mEGLLibrary->getSymbol("eglGetProcAddress"));
+
+    if (!getProc)
+    {
+        abortTest();
+    }
+    else
+    {
+        LoadUtilEGL(getProc);
+        // Test harness warmup calls glFinish so we need GLES too.
+        LoadUtilGLES(getProc);
+
+        if (!eglGetPlatformDisplay)
+        {
+            abortTest();
+        }
+        else
+        {
+            mDisplay = eglGetPlatformDisplay(
+                EGL_PLATFORM_ANGLE_ANGLE, reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
+                &displayAttributes[0]);
+        }
+    }
+}
+
+void EGLShareGroupWorkloadPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+    EGLint majorVersion, minorVersion;
+    ASSERT_TRUE(eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    const size_t threadCount = GetParam().threadCount;
+    if (GetParam().workload == ShareGroupWorkload::SyncHandoff)
+    {
+        const char *extensions = eglQueryString(mDisplay, EGL_EXTENSIONS);
+        if (!CheckExtensionExists(extensions, "EGL_KHR_fence_sync") ||
+            !CheckExtensionExists(extensions, "EGL_KHR_wait_sync"))
+        {
+            skipTest("EGL_KHR_fence_sync or EGL_KHR_wait_sync is not supported");
+            return;
+        }
+        ASSERT_EQ(threadCount % 2, 0u);
+    }
+
+    EGLint numConfigs;
+    const EGLint configAttrs[] = {EGL_RED_SIZE,        8,
+                                  EGL_GREEN_SIZE,      8,
+                                  EGL_BLUE_SIZE,       8,
+                                  EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+                                  EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+                                  EGL_NONE};
+
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
+
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
+    const EGLint pbufferAttribs[] = {EGL_WIDTH, 64, EGL_HEIGHT, 64, EGL_NONE};
+
+    mMainContext = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttribs);
+    ASSERT_NE(EGL_NO_CONTEXT, mMainContext);
+    mMainSurface = eglCreatePbufferSurface(mDisplay, mConfig, pbufferAttribs);
+    ASSERT_NE(EGL_NO_SURFACE, mMainSurface);
+    ASSERT_TRUE(eglMakeCurrent(mDisplay, mMainSurface, mMainSurface, mMainContext));
+
+    mUploadData.assign(kTextureSize * kTextureSize * 4, 0x80);
+    glGenTextures(kTextureCount, mSharedTextures.data());
+    for (GLuint texture : mSharedTextures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, mUploadData.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    glFinish();
+
+    mContexts.resize(threadCount, EGL_NO_CONTEXT);
+    mSurfaces.resize(threadCount, EGL_NO_SURFACE);
+    for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        mContexts[threadIndex] = eglCreateContext(mDisplay, mConfig, mMainContext, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, mContexts[threadIndex]);
+        mSurfaces[threadIndex] = eglCreatePbufferSurface(mDisplay, mConfig, pbufferAttribs);
+        ASSERT_NE(EGL_NO_SURFACE, mSurfaces[threadIndex]);
+    }
+
+    for (size_t pairIndex = 0; pairIndex < threadCount / 2; ++pairIndex)
+    {
+        mHandoffSlots.push_back(std::make_unique<HandoffSlot>());
+    }
+
+    for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back(&EGLShareGroupWorkloadPerfTest::workerThread, this, threadIndex);
+    }
+}
+
+void EGLShareGroupWorkloadPerfTest::TearDown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mStepMutex);
+        mStopping = true;
+    }
+    mStepCondition.notify_all();
+    for (std::thread &thread : mThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    if (GetParam().workload == ShareGroupWorkload::SyncHandoff && !mSkipTest)
+    {
+        mReporter->RegisterFyiMetric(".unsignaled_handoffs", "count");
+        recordIntegerMetric(".unsignaled_handoffs", mUnsignaledHandoffs.load(), "count");
+    }
+
+    ANGLEPerfTest::TearDown();
+    if (mMainContext != EGL_NO_CONTEXT)
+    {
+        glDeleteTextures(kTextureCount, mSharedTextures.data());
+    }
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    for (size_t threadIndex = 0; threadIndex < mContexts.size(); ++threadIndex)
+    {
+        eglDestroySurface(mDisplay, mSurfaces[threadIndex]);
+        eglDestroyContext(mDisplay, mContexts[threadIndex]);
+    }
+    eglDestroySurface(mDisplay, mMainSurface);
+    eglDestroyContext(mDisplay, mMainContext);
+}
+
+void EGLShareGroupWorkloadPerfTest::workerThread(size_t threadIndex)
+{
+    eglMakeCurrent(mDisplay, mSurfaces[threadIndex], mSurfaces[threadIndex],
+                   mContexts[threadIndex]);
+
+    // Programs and buffers are shared too, but every thread makes its own so that only the
+    // textures are used by several contexts.
+    GLuint program = CompileProgram(angle::essl1_shaders::vs::Texture2D(),
+                                    angle::essl1_shaders::fs::Texture2D());
+    glUseProgram(program);
+
+    const GLfloat kQuad[] = {-1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 1, 1};
+    GLuint buffer         = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kQuad), kQuad, GL_STATIC_DRAW);
+
+    const GLint positionLocation =
+        glGetAttribLocation(program, angle::essl1_shaders::PositionAttrib());
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+    glViewport(0, 0, 64, 64);
+
+    const ShareGroupWorkload workload = GetParam().workload;
+    const size_t threadCount          = GetParam().threadCount;
+    HandoffSlot *handoffSlot          = nullptr;
+    GLuint handoffTexture             = 0;
+    if (workload == ShareGroupWorkload::SyncHandoff)
+    {
+        handoffSlot    = mHandoffSlots[threadIndex / 2].get();
+        handoffTexture = mSharedTextures[(threadIndex / 2) % kTextureCount];
+    }
+
+    uint64_t stepSerial = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mStepMutex);
+            mStepCondition.wait(lock, [&] { return mStopping || mStepSerial != stepSerial; });
+            if (mStopping)
+            {
+                break;
+            }
+            stepSerial = mStepSerial;
+        }
+
+        if (workload == ShareGroupWorkload::UploadWhileDraw)
+        {
+            // The first thread uploads, and if it's alone, it draws too.
+            if (threadIndex == 0)
+            {
+                uploadTextures();
+            }
+            if (threadIndex != 0 || threadCount == 1)
+            {
+                drawWithTextures(kDrawsPerThreadStep);
+            }
+        }
+        else if (threadIndex % 2 == 0)
+        {
+            produceHandoffs(handoffSlot, handoffTexture);
+        }
+        else
+        {
+            consumeHandoffs(handoffSlot, handoffTexture);
+        }
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> lock(mStepMutex);
+            ++mFinishedThreads;
+        }
+        mStepCondition.notify_all();
+    }
+
+    glFinish();
+    glDeleteBuffers(1, &buffer);
+    glDeleteProgram(program);
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+void EGLShareGroupWorkloadPerfTest::uploadTextures()
+{
+    for (GLuint texture : mSharedTextures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTextureSize, kTextureSize, GL_RGBA,
+                        GL_UNSIGNED_BYTE, mUploadData.data());
+    }
+}
+
+void EGLShareGroupWorkloadPerfTest::drawWithTextures(uint32_t drawCount)
+{
+    for (uint32_t drawIndex = 0; drawIndex < drawCount; ++drawIndex)
+    {
+        draw(mSharedTextures[drawIndex % kTextureCount]);
+    }
+}
+
+void EGLShareGroupWorkloadPerfTest::produceHandoffs(HandoffSlot *slot, GLuint texture)
+{
+    glBindTexture(GL_TEXTURE_2D, texture);
+    for (uint32_t handoff = 0; handoff < kHandoffsPerPairStep; ++handoff)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kHandoffUpdateSize, kHandoffUpdateSize, GL_RGBA,
+                        GL_UNSIGNED_BYTE, mUploadData.data());
+        EGLSync sync = eglCreateSync(mDisplay, EGL_SYNC_FENCE, nullptr);
+        glFlush();
+
+        std::unique_lock<std::mutex> lock(slot->mutex);
+        slot->condition.wait(lock, [slot] { return slot->sync == EGL_NO_SYNC; });
+        slot->sync = sync;
+        lock.unlock();
+        slot->condition.notify_one();
+    }
+}
+
+void EGLShareGroupWorkloadPerfTest::consumeHandoffs(HandoffSlot *slot, GLuint texture)
+{
+    for (uint32_t handoff = 0; handoff < kHandoffsPerPairStep; ++handoff)
+    {
+        EGLSync sync = EGL_NO_SYNC;
+        {
+            std::unique_lock<std::mutex> lock(slot->mutex);
+            slot->condition.wait(lock, [slot] { return slot->sync != EGL_NO_SYNC; });
+            std::swap(sync, slot->sync);
+        }
+        slot->condition.notify_one();
+
+        EGLAttrib status = EGL_SIGNALED;
+        eglGetSyncAttrib(mDisplay, sync, EGL_SYNC_STATUS, &status);
+        if (status != EGL_SIGNALED)
+        {
+            ++mUnsignaledHandoffs;
+        }
+
+        eglWaitSync(mDisplay, sync, 0);
+        draw(texture);
+        eglDestroySync(mDisplay, sync);
+    }
+}
+
+void EGLShareGroupWorkloadPerfTest::draw(GLuint texture)
+{
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+}
+
+void EGLShareGroupWorkloadPerfTest::step()
+{
+    std::unique_lock<std::mutex> lock(mStepMutex);
+    mFinishedThreads = 0;
+    ++mStepSerial;
+    mStepCondition.notify_all();
+    mStepCondition.wait(lock, [this] { return mFinishedThreads == GetParam().threadCount; });
+}
+
+TEST_P(EGLShareGroupWorkloadPerfTest, Run)
+{
+    run();
+}
+
+std::vector<EGLShareGroupWorkloadParams> GetTestParams()
+{
+    std::vector<EGLShareGroupWorkloadParams> params;
+    for (const angle::PlatformParameters &platform :
+         {angle::ES2_D3D11(), angle::ES2_METAL(), angle::ES2_OPENGL(), angle::ES2_OPENGLES(),
+          angle::ES2_VULKAN()})
+    {
+        for (size_t threadCount : {1, 2, 4, 8, 16})
+        {
+            params.emplace_back(platform, ShareGroupWorkload::UploadWhileDraw, threadCount);
+            if (threadCount % 2 == 0)
+            {
+                params.emplace_back(platform, ShareGroupWorkload::SyncHandoff, threadCount);
+            }
+        }
+    }
+    return params;
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLShareGroupWorkloadPerfTest);
+// Like EGLContextContentionPerfTest, run on GL(ES) and Vulkan everywhere except Android.
+#if !defined(ANGLE_PLATFORM_ANDROID)
+ANGLE_INSTANTIATE_TEST_ARRAY(EGLShareGroupWorkloadPerfTest, GetTestParams());
+#endif
+
+}  // namespace
@@ -24,12 +24,14 @@ enum class TestedFormat
     RGBA8,
     RGB8,
     RGB565,
+    ETC2_RGB8,
 };
 
 constexpr const char *kTestedFormatString[] = {
     "rgba8",
     "rgb8",
     "rgb565",
+    "etc2_rgb8",
 };
 
 template <typename E>
@@ -60,6 +62,10 @@ std::string FormatUploadDrawPerfParams::story() const
 
     strstr << RenderTestParams::story() << "_"
            << ANGLE_UNSAFE_TODO(kTestedFormatString[ToUnderlying(testedFormat)]);
+    if (isEnableRequested(Feature::TranscodeEtcToBc))
+    {
+        strstr << "_transcode_bc";
+    }
 
     return strstr.str();
 }
@@ -81,6 +87,8 @@ class FormatUploadDrawPerfBenchmark
     TestedFormat mTestedFormat;
     uint32_t mTextureSize;
     uint32_t mPixelSize;
+    // Compressed formats are uploaded in blocks of 4x4 pixels of mPixelSize bytes.
+    bool mIsCompressed;
     GLuint mFormat;
     GLuint mType;
     GLuint mProgram;
@@ -91,6 +99,7 @@ FormatUploadDrawPerfBenchmark::FormatUploadDrawPerfBenchmark()
 {
     mTestedFormat = GetParam().testedFormat;
     mTextureSize  = 256;
+    mIsCompressed = false;
     switch (mTestedFormat)
     {
         case TestedFormat::RGBA8:
@@ -108,6 +117,12 @@ FormatUploadDrawPerfBenchmark::FormatUploadDrawPerfBenchmark()
             mType      = GL_UNSIGNED_SHORT_5_6_5;
             mPixelSize = 2;
             break;
+        case TestedFormat::ETC2_RGB8:
+            mFormat       = GL_COMPRESSED_RGB8_ETC2;
+            mType         = GL_NONE;
+            mPixelSize    = 8;
+            mIsCompressed = true;
+            break;
         default:
             UNREACHABLE();
             break;
@@ -123,11 +138,23 @@ void FormatUploadDrawPerfBenchmark::initializeBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexImage2D(GL_TEXTURE_2D, 0, mFormat, mTextureSize, mTextureSize, 0, mFormat, mType, nullptr);
 
     // Initialize color data.
-    mColors.resize(mTextureSize * mTextureSize * mPixelSize);
-    ANGLE_UNSAFE_TODO(memset(mColors.data(), 0, mTextureSize * mTextureSize * mPixelSize));
+    const uint32_t unitCount =
+        mIsCompressed ? (mTextureSize / 4) * (mTextureSize / 4) : mTextureSize * mTextureSize;
+    mColors.resize(unitCount * mPixelSize);
+    ANGLE_UNSAFE_TODO(memset(mColors.data(), 0, unitCount * mPixelSize));
+
+    if (mIsCompressed)
+    {
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, mFormat, mTextureSize, mTextureSize, 0,
+                               static_cast<GLsizei>(mColors.size()), mColors.data());
+    }
+    else
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, mFormat, mTextureSize, mTextureSize, 0, mFormat, mType,
+                     nullptr);
+    }
 
     // Set up program.
     std::string vs = R"(#version 300 es
@@ -163,8 +190,16 @@ void FormatUploadDrawPerfBenchmark::drawBenchmark()
     // Upload and draw many times.
     for (uint32_t i = 0; i < 100; i++)
     {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mTextureSize, mTextureSize, mFormat, mType,
-                        mColors.data());
+        if (mIsCompressed)
+        {
+            glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mTextureSize, mTextureSize, mFormat,
+                                      static_cast<GLsizei>(mColors.size()), mColors.data());
+        }
+        else
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mTextureSize, mTextureSize, mFormat, mType,
+                            mColors.data());
+        }
         glDrawArrays(GL_TRIANGLES, 0, 6);
     }
     ASSERT_GL_NO_ERROR();
@@ -180,6 +215,13 @@ FormatUploadDrawPerfParams VulkanParams(TestedFormat testedFormat)
     return params;
 }
 
+FormatUploadDrawPerfParams VulkanTranscodeEtcToBcParams(TestedFormat testedFormat)
+{
+    FormatUploadDrawPerfParams params = VulkanParams(testedFormat);
+    params.enable(Feature::TranscodeEtcToBc);
+    return params;
+}
+
 FormatUploadDrawPerfParams OpenGLOrGLESParams(TestedFormat testedFormat)
 {
     FormatUploadDrawPerfParams params;
@@ -223,9 +265,12 @@ ANGLE_INSTANTIATE_TEST(FormatUploadDrawPerfBenchmark,
                        VulkanParams(TestedFormat::RGBA8),
                        VulkanParams(TestedFormat::RGB8),
                        VulkanParams(TestedFormat::RGB565),
+                       VulkanParams(TestedFormat::ETC2_RGB8),
+                       VulkanTranscodeEtcToBcParams(TestedFormat::ETC2_RGB8),
                        OpenGLOrGLESParams(TestedFormat::RGBA8),
                        OpenGLOrGLESParams(TestedFormat::RGB8),
                        OpenGLOrGLESParams(TestedFormat::RGB565),
+                       OpenGLOrGLESParams(TestedFormat::ETC2_RGB8),
                        MetalParams(TestedFormat::RGBA8),
                        MetalParams(TestedFormat::RGB8),
                        MetalParams(TestedFormat::RGB565),
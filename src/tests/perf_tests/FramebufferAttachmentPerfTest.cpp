@@ -4,7 +4,8 @@
 // found in the LICENSE file.
 //
 // FramebufferAttachPerfTest:
-//   Performance test for attaching and detaching resources to a Framebuffer.
+//   Performance test for attaching and detaching resources to a Framebuffer, and for updating
+//   resources that are attached to many Framebuffers.
 //
 
 #include "ANGLEPerfTest.h"
@@ -21,6 +22,8 @@ constexpr unsigned int kTextureSize       = 256;
 constexpr std::size_t kTextureCount       = 4;
 constexpr std::size_t kFboCount           = kTextureCount;
 constexpr std::size_t kAdditionalFboCount = kFboCount * kFboCount;
+constexpr unsigned int kUploadsPerClear    = 8;
+constexpr unsigned int kUploadSize         = 16;
 
 struct FramebufferAttachmentParams final : public RenderTestParams
 {
@@ -208,6 +211,80 @@ void FramebufferAttachmentStateUpdateBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+// Streams small uploads into textures that are attached to many framebuffers, one of which is
+// bound.  Every upload notifies each of these framebuffers, which in turn notify the context.
+class FramebufferAttachmentContentsUpdateBenchmark : public FramebufferAttachmentBenchmark
+{
+  public:
+    FramebufferAttachmentContentsUpdateBenchmark() : FramebufferAttachmentBenchmark() {}
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    std::array<GLFramebuffer, kAdditionalFboCount> mAdditionalFbo;
+    std::vector<GLubyte> mUploadData;
+};
+
+void FramebufferAttachmentContentsUpdateBenchmark::initializeBenchmark()
+{
+    FramebufferAttachmentBenchmark::initializeBenchmark();
+
+    for (size_t fboIndex = 0; fboIndex < mAdditionalFbo.size(); fboIndex++)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, mAdditionalFbo[fboIndex]);
+        for (size_t textureIndex = 0; textureIndex < mTextures.size(); textureIndex++)
+        {
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + textureIndex,
+                                   GL_TEXTURE_2D, mTextures[textureIndex], 0);
+        }
+    }
+    // The last framebuffer is left bound, so the context observes it.
+
+    mUploadData.resize(kUploadSize * kUploadSize * 4, 0x7F);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void FramebufferAttachmentContentsUpdateBenchmark::destroyBenchmark()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    for (size_t fboIndex = 0; fboIndex < mAdditionalFbo.size(); fboIndex++)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, mAdditionalFbo[fboIndex]);
+        for (size_t index = 0; index < mTextures.size(); index++)
+        {
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, GL_TEXTURE_2D, 0,
+                                   0);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    FramebufferAttachmentBenchmark::destroyBenchmark();
+}
+
+void FramebufferAttachmentContentsUpdateBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (size_t it = 0; it < params.iterationsPerStep; ++it)
+    {
+        for (unsigned int upload = 0; upload < kUploadsPerClear; ++upload)
+        {
+            const GLint offset = (upload * kUploadSize) % (kTextureSize - kUploadSize);
+            glBindTexture(GL_TEXTURE_2D, mTextures[upload % mTextures.size()]);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, offset, offset, kUploadSize, kUploadSize, GL_RGBA,
+                            GL_UNSIGNED_BYTE, mUploadData.data());
+        }
+
+        // Syncs the bound framebuffer, after which the next upload notifies it again.
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 FramebufferAttachmentParams VulkanParams()
 {
     FramebufferAttachmentParams params;
@@ -226,9 +303,17 @@ TEST_P(FramebufferAttachmentStateUpdateBenchmark, Run)
     run();
 }
 
+TEST_P(FramebufferAttachmentContentsUpdateBenchmark, Run)
+{
+    run();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FramebufferAttachmentBenchmark);
 ANGLE_INSTANTIATE_TEST(FramebufferAttachmentBenchmark, VulkanParams());
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FramebufferAttachmentStateUpdateBenchmark);
 ANGLE_INSTANTIATE_TEST(FramebufferAttachmentStateUpdateBenchmark, VulkanParams());
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FramebufferAttachmentContentsUpdateBenchmark);
+ANGLE_INSTANTIATE_TEST(FramebufferAttachmentContentsUpdateBenchmark, VulkanParams());
 }  // namespace angle
@@ -33,6 +33,8 @@ struct GenerateMipmapParams final : public RenderTestParams
         textureHeight = 1080;
 
         internalFormat = GL_RGBA;
+        format         = GL_RGBA;
+        type           = GL_UNSIGNED_BYTE;
 
         webgl = false;
     }
@@ -43,6 +45,8 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLsizei textureHeight;
 
     GLenum internalFormat;
+    GLenum format;
+    GLenum type;
 
     bool webgl;
 };
@@ -63,23 +67,47 @@ std::string GenerateMipmapParams::story() const
         strstr << "_webgl";
     }
 
-    if (internalFormat == GL_RGB)
+    switch (internalFormat)
     {
-        strstr << "_rgb";
+        case GL_RGB:
+            strstr << "_rgb";
+            break;
+        case GL_SRGB8_ALPHA8:
+            strstr << "_srgb";
+            break;
+        case GL_RGBA16F:
+            strstr << "_rgba16f";
+            break;
+        case GL_RGB10_A2:
+            strstr << "_rgb10_a2";
+            break;
+        default:
+            break;
     }
 
     return strstr.str();
 }
 
 template <typename T>
-void FillWithRandomData(T *storage)
+void FillWithRandomData(T *storage, GLenum type)
 {
-    for (uint8_t &u : *storage)
+    for (size_t index = 0; index < storage->size(); ++index)
     {
-        u = rand() & 0xFF;
+        (*storage)[index] = rand() & 0xFF;
+
+        // Keep half floats finite by clearing the top bits of their exponent.
+        if (type == GL_HALF_FLOAT && index % 2 == 1)
+        {
+            (*storage)[index] &= 0x3F;
+        }
     }
 }
 
+size_t GetPixelBytes(GLenum type)
+{
+    return type == GL_HALF_FLOAT ? 8 : 4;
+}
+
 class GenerateMipmapBenchmarkBase : public ANGLERenderTest,
                                     public ::testing::WithParamInterface<GenerateMipmapParams>
 {
@@ -154,11 +182,11 @@ void GenerateMipmapBenchmarkBase::initializeBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-    mTextureData.resize(params.textureWidth * params.textureHeight * 4);
-    FillWithRandomData(&mTextureData);
+    mTextureData.resize(params.textureWidth * params.textureHeight * GetPixelBytes(params.type));
+    FillWithRandomData(&mTextureData, params.type);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, params.type, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -216,10 +244,10 @@ void GenerateMipmapBenchmark::drawBenchmark()
     for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
     {
         // Slightly modify the base texture so the mipmap is definitely regenerated.
-        std::array<uint8_t, 4> randomData;
-        FillWithRandomData(&randomData);
+        std::array<uint8_t, 8> randomData;
+        FillWithRandomData(&randomData, params.type);
 
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.internalFormat, GL_UNSIGNED_BYTE,
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.format, params.type,
                         randomData.data());
 
         // Generate mipmaps
@@ -248,7 +276,7 @@ void GenerateMipmapWithRedefineBenchmark::drawBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, params.type, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -324,6 +352,7 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
+        params.format         = GL_RGB;
     }
     if (singleIteration)
     {
@@ -332,6 +361,15 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+// Formats that are not supported by the compute path, so they exercise the fallbacks.
+GenerateMipmapParams VulkanFormatParams(GLenum internalFormat, GLenum type)
+{
+    GenerateMipmapParams params = VulkanParams(false, false, false);
+    params.internalFormat       = internalFormat;
+    params.type                 = type;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -356,7 +394,10 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       VulkanFormatParams(GL_SRGB8_ALPHA8, GL_UNSIGNED_BYTE),
+                       VulkanFormatParams(GL_RGBA16F, GL_HALF_FLOAT),
+                       VulkanFormatParams(GL_RGB10_A2, GL_UNSIGNED_INT_2_10_10_10_REV));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -0,0 +1,137 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HashMapLookupPerfTest:
+//   Performance benchmark for lookups in angle::HashMap compared to std::unordered_map, using
+//   angle::ComputeGenericHash(...) for the keys like the Vulkan backend caches do.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/unsafe_buffers.h"
+
+#include <array>
+#include <unordered_map>
+
+#include "common/hash_containers.h"
+#include "common/hash_utils.h"
+#include "util/random_utils.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 5;
+constexpr size_t kKeyCount                = 1000;
+
+template <size_t N>
+using HashKey = std::array<uint8_t, N>;
+
+struct HashKeyHasher
+{
+    template <size_t N>
+    size_t operator()(const HashKey<N> &key) const
+    {
+        return angle::ComputeGenericHash(angle::Span(key));
+    }
+};
+
+template <size_t N>
+using StdMap = std::unordered_map<HashKey<N>, uint32_t, HashKeyHasher>;
+template <size_t N>
+using AngleMap = angle::HashMap<HashKey<N>, uint32_t, HashKeyHasher>;
+
+template <typename MapT>
+class HashMapLookupPerfTest : public ANGLEPerfTest
+{
+  public:
+    HashMapLookupPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    using KeyType = typename MapT::key_type;
+
+    angle::RNG mRNG;
+    MapT mMap;
+    // Half of the lookups are hits and the other half are misses, in random order.
+    std::vector<KeyType> mLookUpKeys;
+    // Accumulates the looked up values so the lookups can't be optimized out.
+    uint32_t mLookUpValueSum;
+};
+
+template <typename MapT>
+HashMapLookupPerfTest<MapT>::HashMapLookupPerfTest()
+    : ANGLEPerfTest("HashMapLookupPerfTest", "", "", kIterationsPerStep),
+      mRNG(0x12345678u),
+      mLookUpValueSum(0)
+{}
+
+template <typename MapT>
+void HashMapLookupPerfTest<MapT>::SetUp()
+{
+    constexpr size_t kKeySize = std::tuple_size<KeyType>::value;
+    std::vector<uint8_t> bytes(kKeySize);
+
+    for (size_t keyIndex = 0; keyIndex < kKeyCount * 2; keyIndex++)
+    {
+        KeyType key;
+        FillVectorWithRandomUBytes(&mRNG, &bytes);
+        ANGLE_UNSAFE_TODO(memcpy(key.data(), bytes.data(), kKeySize));
+
+        if (keyIndex % 2 == 0)
+        {
+            mMap.emplace(key, static_cast<uint32_t>(keyIndex));
+        }
+        mLookUpKeys.push_back(key);
+    }
+
+    for (size_t keyIndex = mLookUpKeys.size() - 1; keyIndex > 0; keyIndex--)
+    {
+        const int swapIndex = mRNG.randomIntBetween(0, static_cast<int>(keyIndex));
+        std::swap(mLookUpKeys[keyIndex], mLookUpKeys[swapIndex]);
+    }
+}
+
+template <typename MapT>
+void HashMapLookupPerfTest<MapT>::step()
+{
+    for (const KeyType &key : mLookUpKeys)
+    {
+        auto iter = mMap.find(key);
+        if (iter != mMap.end())
+        {
+            mLookUpValueSum += iter->second;
+        }
+    }
+}
+
+using TestTypes =
+    Types<StdMap<16>, AngleMap<16>, StdMap<64>, AngleMap<64>, StdMap<256>, AngleMap<256>>;
+
+constexpr char kTestTypeNames[][100] = {
+    "unordered_map_KeySize_16_bytes",  "HashMap_KeySize_16_bytes",
+    "unordered_map_KeySize_64_bytes",  "HashMap_KeySize_64_bytes",
+    "unordered_map_KeySize_256_bytes", "HashMap_KeySize_256_bytes"};
+
+class MapTypeNames
+{
+  public:
+    template <typename MapType>
+    static std::string GetName(int typeIndex)
+    {
+        return ANGLE_UNSAFE_TODO(kTestTypeNames[typeIndex]);
+    }
+};
+
+TYPED_TEST_SUITE(HashMapLookupPerfTest, TestTypes, MapTypeNames);
+
+// Test lookup throughput for maps with keys of different sizes
+TYPED_TEST(HashMapLookupPerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
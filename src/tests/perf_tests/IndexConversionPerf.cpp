@@ -22,7 +22,12 @@ struct IndexConversionPerfParams final : public RenderTestParams
     {
         std::stringstream strstr;
 
-        if (indexRangeOffset > 0)
+        if (indexRangeScan)
+        {
+            strstr << "_index_range_scan";
+            strstr << (indexType == GL_UNSIGNED_INT ? "_uint" : "_ushort");
+        }
+        else if (indexRangeOffset > 0)
         {
             strstr << "_index_range";
         }
@@ -36,6 +41,11 @@ struct IndexConversionPerfParams final : public RenderTestParams
 
     // A second test, which covers using index ranges with an offset.
     unsigned int indexRangeOffset;
+
+    // A third test, which covers computing the index range of a large index buffer after each
+    // update, i.e. on index range cache misses.
+    bool indexRangeScan = false;
+    GLenum indexType    = GL_UNSIGNED_SHORT;
 };
 
 // Provide a custom gtest parameter name function for IndexConversionPerfParams.
@@ -59,11 +69,13 @@ class IndexConversionPerfTest : public ANGLERenderTest,
     void updateBufferData();
     void drawConversion();
     void drawIndexRange();
+    void drawIndexRangeScan();
 
     GLuint mProgram;
     GLuint mVertexBuffer;
     GLuint mIndexBuffer;
     std::vector<GLushort> mIndexData;
+    std::vector<GLuint> mIndexData32;
 };
 
 IndexConversionPerfTest::IndexConversionPerfTest()
@@ -109,6 +121,11 @@ void IndexConversionPerfTest::initializeBenchmark()
         mIndexData.push_back(2);
     }
 
+    if (params.indexType == GL_UNSIGNED_INT)
+    {
+        mIndexData32.assign(mIndexData.begin(), mIndexData.end());
+    }
+
     glGenBuffers(1, &mIndexBuffer);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
     updateBufferData();
@@ -121,6 +138,13 @@ void IndexConversionPerfTest::initializeBenchmark()
 
 void IndexConversionPerfTest::updateBufferData()
 {
+    if (!mIndexData32.empty())
+    {
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexData32.size() * sizeof(mIndexData32[0]),
+                     mIndexData32.data(), GL_STATIC_DRAW);
+        return;
+    }
+
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexData.size() * sizeof(mIndexData[0]), &mIndexData[0],
                  GL_STATIC_DRAW);
 }
@@ -136,7 +160,11 @@ void IndexConversionPerfTest::drawBenchmark()
 {
     const auto &params = GetParam();
 
-    if (params.indexRangeOffset == 0)
+    if (params.indexRangeScan)
+    {
+        drawIndexRangeScan();
+    }
+    else if (params.indexRangeOffset == 0)
     {
         drawConversion();
     }
@@ -183,6 +211,22 @@ void IndexConversionPerfTest::drawIndexRange()
     ASSERT_GL_NO_ERROR();
 }
 
+void IndexConversionPerfTest::drawIndexRangeScan()
+{
+    const auto &params = GetParam();
+
+    // Every draw needs the range of all the indices, after an update that invalidates the cached
+    // ranges.
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        updateBufferData();
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(params.numIndexTris * 3),
+                       params.indexType, reinterpret_cast<void *>(0));
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 IndexConversionPerfParams IndexConversionPerfD3D11Params()
 {
     IndexConversionPerfParams params;
@@ -211,6 +255,24 @@ IndexConversionPerfParams IndexRangeOffsetPerfD3D11Params()
     return params;
 }
 
+IndexConversionPerfParams IndexRangeScanPerfParams(const EGLPlatformParameters &eglParameters,
+                                                   GLenum indexType)
+{
+    IndexConversionPerfParams params;
+    params.eglParameters     = eglParameters;
+    params.majorVersion      = 3;
+    params.minorVersion      = 0;
+    params.windowWidth       = 256;
+    params.windowHeight      = 256;
+    params.iterationsPerStep = 4;
+    params.numIndexTris      = 300000;
+    // Non-zero to avoid the D3D11 index conversion triggered by a -1 index.
+    params.indexRangeOffset  = 1;
+    params.indexRangeScan    = true;
+    params.indexType         = indexType;
+    return params;
+}
+
 TEST_P(IndexConversionPerfTest, Run)
 {
     run();
@@ -218,7 +280,11 @@ TEST_P(IndexConversionPerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(IndexConversionPerfTest,
                        IndexConversionPerfD3D11Params(),
-                       IndexRangeOffsetPerfD3D11Params());
+                       IndexRangeOffsetPerfD3D11Params(),
+                       IndexRangeScanPerfParams(egl_platform::D3D11_NULL(), GL_UNSIGNED_SHORT),
+                       IndexRangeScanPerfParams(egl_platform::D3D11_NULL(), GL_UNSIGNED_INT),
+                       IndexRangeScanPerfParams(egl_platform::VULKAN_NULL(), GL_UNSIGNED_SHORT),
+                       IndexRangeScanPerfParams(egl_platform::VULKAN_NULL(), GL_UNSIGNED_INT));
 
 // This test suite is not instantiated on some OSes.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IndexConversionPerfTest);
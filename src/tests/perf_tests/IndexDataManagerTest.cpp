@@ -5,6 +5,8 @@
 //
 // IndexDataManagerPerfTest:
 //   Performance test for index buffer management.
+// VertexDataManagerPerfTest:
+//   Performance test for streaming the same client memory vertex data on every draw.
 //
 
 #include "ANGLEPerfTest.h"
@@ -16,6 +18,8 @@
 #include "libANGLE/renderer/d3d/BufferD3D.h"
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
+#include "libANGLE/renderer/d3d/VertexBuffer.h"
+#include "libANGLE/renderer/d3d/VertexDataManager.h"
 
 using namespace testing;
 
@@ -219,4 +223,157 @@ TEST_F(IndexDataManagerPerfTest, Run)
     run();
 }
 
+// Streams into system memory, so that only the cost of the vertex data management is measured.
+class FakeVertexBuffer : public rx::VertexBuffer
+{
+  public:
+    angle::Result initialize(const gl::Context *context,
+                             unsigned int size,
+                             bool dynamicUsage) override
+    {
+        mData.resize(size);
+        return angle::Result::Continue;
+    }
+
+    angle::Result storeVertexAttributes(const gl::Context *context,
+                                        const gl::VertexAttribute &attrib,
+                                        const gl::VertexBinding &binding,
+                                        gl::VertexAttribType currentValueType,
+                                        size_t start,
+                                        size_t count,
+                                        GLsizei instances,
+                                        unsigned int offset,
+                                        const uint8_t *sourceData) override
+    {
+        const size_t stride      = gl::ComputeVertexAttributeStride(attrib, binding);
+        const size_t elementSize = gl::ComputeVertexAttributeTypeSize(attrib);
+        for (size_t element = 0; element < count; ++element)
+        {
+            ANGLE_UNSAFE_TODO(memcpy(&mData[offset + element * elementSize],
+                                     sourceData + (start + element) * stride, elementSize));
+        }
+        return angle::Result::Continue;
+    }
+
+    unsigned int getBufferSize() const override { return static_cast<unsigned int>(mData.size()); }
+
+    angle::Result setBufferSize(const gl::Context *context, unsigned int size) override
+    {
+        mData.resize(size);
+        return angle::Result::Continue;
+    }
+
+    angle::Result discard(const gl::Context *context) override { return angle::Result::Continue; }
+
+  private:
+    std::vector<uint8_t> mData;
+};
+
+class FakeVertexBufferFactoryD3D : public rx::BufferFactoryD3D
+{
+  public:
+    rx::VertexBuffer *createVertexBuffer() override { return new FakeVertexBuffer; }
+    rx::IndexBuffer *createIndexBuffer() override { return nullptr; }
+
+    rx::VertexConversionType getVertexConversionType(angle::FormatID vertexFormatID) const override
+    {
+        return rx::VERTEX_CONVERT_NONE;
+    }
+    GLenum getVertexComponentType(angle::FormatID vertexFormatID) const override
+    {
+        return GL_FLOAT;
+    }
+
+    angle::Result getVertexSpaceRequired(const gl::Context *context,
+                                         const gl::VertexAttribute &attrib,
+                                         const gl::VertexBinding &binding,
+                                         size_t count,
+                                         GLsizei instances,
+                                         uint64_t baseInstance,
+                                         unsigned int *bytesRequiredOut) const override
+    {
+        const size_t elementCount = gl::ComputeVertexBindingElementCount(
+            binding.getDivisor(), count, static_cast<size_t>(instances), baseInstance);
+        *bytesRequiredOut =
+            static_cast<unsigned int>(elementCount * gl::ComputeVertexAttributeTypeSize(attrib));
+        return angle::Result::Continue;
+    }
+};
+
+class VertexDataManagerPerfTest : public ANGLEPerfTest
+{
+  public:
+    VertexDataManagerPerfTest();
+
+    void step() override;
+
+    static constexpr size_t kAttribCount = 2;
+
+    FakeVertexBufferFactoryD3D mBufferFactory;
+    rx::VertexDataManager mVertexDataManager;
+    GLsizei mVertexCount;
+    std::vector<GLfloat> mVertexData;
+    std::vector<gl::VertexAttribute> mAttribs;
+    std::vector<gl::VertexBinding> mBindings;
+    gl::BindingPointer<gl::Buffer> mNullBuffer;
+    std::vector<rx::TranslatedAttribute> mTranslatedAttribs;
+    gl::AttributesMask mDynamicAttribsMask;
+};
+
+VertexDataManagerPerfTest::VertexDataManagerPerfTest()
+    : ANGLEPerfTest("VertexDataManager", "", "_client_data", kIterationsPerStep),
+      mVertexDataManager(&mBufferFactory),
+      mVertexCount(4000),
+      mVertexData(mVertexCount * 4 * kAttribCount),
+      mTranslatedAttribs(kAttribCount)
+{
+    for (size_t index = 0; index < mVertexData.size(); ++index)
+    {
+        mVertexData[index] = static_cast<GLfloat>(index);
+    }
+
+    EXPECT_EQ(angle::Result::Continue, mVertexDataManager.initialize(nullptr));
+
+    // Two interleaved vec4 client arrays, as drawn by immediate mode UI libraries.
+    const GLuint stride = static_cast<GLuint>(kAttribCount * 4 * sizeof(GLfloat));
+    for (size_t attribIndex = 0; attribIndex < kAttribCount; ++attribIndex)
+    {
+        mAttribs.emplace_back(static_cast<GLuint>(attribIndex));
+        gl::VertexAttribute &attrib = mAttribs.back();
+
+        attrib.enabled = true;
+        attrib.format  = &angle::Format::Get(angle::FormatID::R32G32B32A32_FLOAT);
+        attrib.pointer = &mVertexData[attribIndex * 4];
+
+        mBindings.emplace_back(static_cast<GLuint>(attribIndex));
+        mBindings.back().setStride(stride);
+
+        mDynamicAttribsMask.set(attribIndex);
+    }
+
+    for (size_t attribIndex = 0; attribIndex < kAttribCount; ++attribIndex)
+    {
+        rx::TranslatedAttribute &translated = mTranslatedAttribs[attribIndex];
+        translated.active                   = true;
+        translated.attribute                = &mAttribs[attribIndex];
+        translated.binding                  = &mBindings[attribIndex];
+        translated.bufferBindingPointer     = &mNullBuffer;
+        translated.currentValueType         = gl::VertexAttribType::Float;
+    }
+}
+
+void VertexDataManagerPerfTest::step()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        (void)mVertexDataManager.storeDynamicAttribs(nullptr, &mTranslatedAttribs,
+                                                     mDynamicAttribsMask, 0, mVertexCount, 0, 0);
+    }
+}
+
+TEST_F(VertexDataManagerPerfTest, Run)
+{
+    run();
+}
+
 }  // anonymous namespace
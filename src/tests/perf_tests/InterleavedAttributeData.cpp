@@ -25,17 +25,45 @@ struct InterleavedAttributeDataParams final : public RenderTestParams
         iterationsPerStep = 1;
 
         // Common default values
-        majorVersion = 2;
-        minorVersion = 0;
-        windowWidth  = 512;
-        windowHeight = 512;
-        numSprites   = 3000;
+        majorVersion               = 2;
+        minorVersion               = 0;
+        windowWidth                = 512;
+        windowHeight               = 512;
+        numSprites                 = 3000;
+        clientArrays               = false;
+        sharedStreamedVertexBuffer = false;
     }
 
+    std::string story() const override;
+
     // static parameters
     unsigned int numSprites;
+
+    // Source the attributes from client memory instead of vertex buffers.
+    bool clientArrays;
+    // Enable shareStreamedVertexBufferAcrossAttribs.
+    bool sharedStreamedVertexBuffer;
 };
 
+std::string InterleavedAttributeDataParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    if (clientArrays)
+    {
+        strstr << "_client_arrays";
+    }
+
+    if (sharedStreamedVertexBuffer)
+    {
+        strstr << "_shared_streamed_vertex_buffer";
+    }
+
+    return strstr.str();
+}
+
 std::ostream &operator<<(std::ostream &os, const InterleavedAttributeDataParams &params)
 {
     os << params.backendAndStory().substr(1);
@@ -62,6 +90,8 @@ class InterleavedAttributeDataBenchmark
   private:
     GLuint mPointSpriteProgram;
     GLuint mPositionColorBuffer[2];
+    // Used instead of mPositionColorBuffer with client arrays.
+    std::vector<uint8_t> mPositionColorData[2];
 
     // The buffers contain two floats and 3 unsigned bytes per point sprite
     // Has to be aligned for float access on arm
@@ -140,6 +170,13 @@ void InterleavedAttributeDataBenchmark::initializeBenchmark()
             positionColorData[j * mBytesPerSprite + 2 * sizeof(float) + 2] = pointSpriteBlue;   // B
         }
 
+        if (params.clientArrays)
+        {
+            ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]) = 0;
+            ANGLE_UNSAFE_TODO(mPositionColorData[i])   = std::move(positionColorData);
+            continue;
+        }
+
         // Generate the GL buffer with the position/color data
         glGenBuffers(1, &ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]));
         glBindBuffer(GL_ARRAY_BUFFER, ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]));
@@ -175,20 +212,28 @@ void InterleavedAttributeDataBenchmark::drawBenchmark()
             GLint colorLocation = glGetAttribLocation(mPointSpriteProgram, "aColor");
             ASSERT_NE(colorLocation, -1);
 
+            // With client arrays, no buffer is bound and the attributes point at the client data.
+            const size_t colorIndex     = (i + 1) % ArraySize(mPositionColorBuffer);
+            const void *positionPointer = nullptr;
+            const void *colorPointer    = reinterpret_cast<void *>(2 * sizeof(float));
+            if (GetParam().clientArrays)
+            {
+                positionPointer = ANGLE_UNSAFE_TODO(mPositionColorData[i]).data();
+                colorPointer =
+                    ANGLE_UNSAFE_TODO(mPositionColorData[colorIndex]).data() + 2 * sizeof(float);
+            }
+
             // Bind the position data from one buffer
             glBindBuffer(GL_ARRAY_BUFFER, ANGLE_UNSAFE_TODO(mPositionColorBuffer[i]));
             glEnableVertexAttribArray(positionLocation);
             glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE,
-                                  static_cast<GLsizei>(mBytesPerSprite), 0);
+                                  static_cast<GLsizei>(mBytesPerSprite), positionPointer);
 
             // But bind the color data from the other buffer.
-            glBindBuffer(
-                GL_ARRAY_BUFFER,
-                ANGLE_UNSAFE_TODO(mPositionColorBuffer[(i + 1) % ArraySize(mPositionColorBuffer)]));
+            glBindBuffer(GL_ARRAY_BUFFER, ANGLE_UNSAFE_TODO(mPositionColorBuffer[colorIndex]));
             glEnableVertexAttribArray(colorLocation);
             glVertexAttribPointer(colorLocation, 3, GL_UNSIGNED_BYTE, GL_TRUE,
-                                  static_cast<GLsizei>(mBytesPerSprite),
-                                  reinterpret_cast<void *>(2 * sizeof(float)));
+                                  static_cast<GLsizei>(mBytesPerSprite), colorPointer);
 
             // Then draw the colored pointsprites
             glDrawArrays(GL_POINTS, 0, GetParam().numSprites);
@@ -234,10 +279,29 @@ InterleavedAttributeDataParams VulkanParams()
     return params;
 }
 
+InterleavedAttributeDataParams ClientArrays(const InterleavedAttributeDataParams &in)
+{
+    InterleavedAttributeDataParams out = in;
+    out.clientArrays                   = true;
+    return out;
+}
+
+InterleavedAttributeDataParams SharedStreamedVertexBuffer(const InterleavedAttributeDataParams &in)
+{
+    InterleavedAttributeDataParams out = ClientArrays(in);
+    out.sharedStreamedVertexBuffer     = true;
+    out.enable(Feature::ShareStreamedVertexBufferAcrossAttribs);
+    return out;
+}
+
 ANGLE_INSTANTIATE_TEST(InterleavedAttributeDataBenchmark,
                        D3D11Params(),
                        MetalParams(),
                        OpenGLOrGLESParams(),
-                       VulkanParams());
+                       VulkanParams(),
+                       ClientArrays(D3D11Params()),
+                       ClientArrays(OpenGLOrGLESParams()),
+                       ClientArrays(VulkanParams()),
+                       SharedStreamedVertexBuffer(VulkanParams()));
 
 }  // anonymous namespace
@@ -10,6 +10,7 @@
 #include "ANGLEPerfTest.h"
 
 #include <array>
+#include <sstream>
 
 #include "common/vector_utils.h"
 #include "util/shader_utils.h"
@@ -23,6 +24,9 @@ enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    // Links a program with many uniforms, varyings and uniform blocks, where the link time is
+    // dominated by the front-end validation of the program interface.
+    CompileAndLinkLargeInterface,
 
     Unspecified
 };
@@ -41,7 +45,7 @@ struct LinkProgramParams final : public RenderTestParams
     {
         iterationsPerStep = 1;
 
-        majorVersion = 2;
+        majorVersion = taskOptionIn == TaskOption::CompileAndLinkLargeInterface ? 3 : 2;
         minorVersion = 0;
         windowWidth  = 256;
         windowHeight = 256;
@@ -62,6 +66,10 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::CompileAndLinkLargeInterface)
+        {
+            strstr << "_compile_and_link_large_interface";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -102,10 +110,76 @@ class LinkProgramBenchmark : public ANGLERenderTest,
 
   protected:
     GLuint mVertexBuffer = 0;
+    std::string mVertexShader;
+    std::string mFragmentShader;
 };
 
 LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", GetParam()) {}
 
+constexpr uint32_t kLargeInterfaceVaryingCount      = 12;
+constexpr uint32_t kLargeInterfaceUniformCount      = 64;
+constexpr uint32_t kLargeInterfaceUniformBlockCount = 8;
+
+// Generates a shader pair whose interface is large enough for the link to take a noticeable time.
+// Every varying, uniform and uniform block is used, so none of them is removed as inactive.
+void GenerateLargeInterfaceShaders(std::string *vertexShaderOut, std::string *fragmentShaderOut)
+{
+    std::stringstream vs;
+    std::stringstream fs;
+    std::stringstream blocks;
+
+    vs << "#version 300 es\n"
+          "in vec2 position;\n";
+    fs << "#version 300 es\n"
+          "precision highp float;\n"
+          "out vec4 color;\n";
+
+    for (uint32_t index = 0; index < kLargeInterfaceUniformBlockCount; ++index)
+    {
+        blocks << "uniform Block" << index << " { vec4 blockValue" << index << "[4]; };\n";
+    }
+    vs << blocks.str();
+    fs << blocks.str();
+
+    for (uint32_t index = 0; index < kLargeInterfaceVaryingCount; ++index)
+    {
+        vs << "out vec4 varying" << index << ";\n";
+        fs << "in vec4 varying" << index << ";\n";
+    }
+    for (uint32_t index = 0; index < kLargeInterfaceUniformCount; ++index)
+    {
+        vs << "uniform vec4 vsUniform" << index << ";\n";
+        fs << "uniform vec4 fsUniform" << index << ";\n";
+    }
+
+    vs << "void main() {\n"
+          "    vec4 sum = vec4(0);\n";
+    fs << "void main() {\n"
+          "    vec4 sum = vec4(0);\n";
+    for (uint32_t index = 0; index < kLargeInterfaceUniformCount; ++index)
+    {
+        vs << "    sum += vsUniform" << index << ";\n";
+        fs << "    sum += fsUniform" << index << ";\n";
+    }
+    for (uint32_t index = 0; index < kLargeInterfaceUniformBlockCount; ++index)
+    {
+        vs << "    sum += blockValue" << index << "[" << (index % 4) << "];\n";
+        fs << "    sum += blockValue" << index << "[" << ((index + 1) % 4) << "];\n";
+    }
+    for (uint32_t index = 0; index < kLargeInterfaceVaryingCount; ++index)
+    {
+        vs << "    varying" << index << " = sum * " << (index + 1) << ".0;\n";
+        fs << "    sum += varying" << index << ";\n";
+    }
+    vs << "    gl_Position = vec4(position, 0, 1) + sum * 0.0;\n"
+          "}";
+    fs << "    color = sum;\n"
+          "}";
+
+    *vertexShaderOut   = vs.str();
+    *fragmentShaderOut = fs.str();
+}
+
 void LinkProgramBenchmark::initializeBenchmark()
 {
     if (GetParam().threadOption != ThreadOption::SingleThread &&
@@ -129,6 +203,24 @@ void LinkProgramBenchmark::initializeBenchmark()
     glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
     glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vector3), vertices.data(),
                  GL_STATIC_DRAW);
+
+    if (GetParam().taskOption == TaskOption::CompileAndLinkLargeInterface)
+    {
+        GenerateLargeInterfaceShaders(&mVertexShader, &mFragmentShader);
+    }
+    else
+    {
+        mVertexShader =
+            "attribute vec2 position;\n"
+            "void main() {\n"
+            "    gl_Position = vec4(position, 0, 1);\n"
+            "}";
+        mFragmentShader =
+            "precision mediump float;\n"
+            "void main() {\n"
+            "    gl_FragColor = vec4(1, 0, 0, 1);\n"
+            "}";
+    }
 }
 
 void LinkProgramBenchmark::destroyBenchmark()
@@ -138,18 +230,8 @@ void LinkProgramBenchmark::destroyBenchmark()
 
 void LinkProgramBenchmark::drawBenchmark()
 {
-    static const char *vertexShader =
-        "attribute vec2 position;\n"
-        "void main() {\n"
-        "    gl_Position = vec4(position, 0, 1);\n"
-        "}";
-    static const char *fragmentShader =
-        "precision mediump float;\n"
-        "void main() {\n"
-        "    gl_FragColor = vec4(1, 0, 0, 1);\n"
-        "}";
-    GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
-    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, mVertexShader.c_str());
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, mFragmentShader.c_str());
 
     ASSERT_NE(0u, vs);
     ASSERT_NE(0u, fs);
@@ -232,6 +314,16 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramMetalParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramD3D11Params(TaskOption::CompileAndLinkLargeInterface, ThreadOption::MultiThread),
+    LinkProgramMetalParams(TaskOption::CompileAndLinkLargeInterface, ThreadOption::MultiThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLinkLargeInterface,
+                                  ThreadOption::MultiThread),
+    LinkProgramVulkanParams(TaskOption::CompileAndLinkLargeInterface, ThreadOption::MultiThread),
+    LinkProgramD3D11Params(TaskOption::CompileAndLinkLargeInterface, ThreadOption::SingleThread),
+    LinkProgramMetalParams(TaskOption::CompileAndLinkLargeInterface, ThreadOption::SingleThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLinkLargeInterface,
+                                  ThreadOption::SingleThread),
+    LinkProgramVulkanParams(TaskOption::CompileAndLinkLargeInterface, ThreadOption::SingleThread));
 
 }  // anonymous namespace
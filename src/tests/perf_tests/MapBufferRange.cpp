@@ -37,6 +37,7 @@ struct MapBufferRangeParams final : public RenderTestParams
         bufferSize        = 1048576;
         iterationsPerStep = kIterationsPerStep;
         access            = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+        persistent        = false;
     }
 
     std::string story() const override;
@@ -50,6 +51,8 @@ struct MapBufferRangeParams final : public RenderTestParams
     GLsizeiptr updateOffset;
     GLsizeiptr bufferSize;
     GLbitfield access;
+    // Map the buffer once with GL_MAP_PERSISTENT_BIT_EXT and write to it as a ring buffer.
+    bool persistent;
 };
 
 std::ostream &operator<<(std::ostream &os, const MapBufferRangeParams &params)
@@ -71,6 +74,8 @@ class MapBufferRangeBenchmark : public ANGLERenderTest,
   private:
     GLuint mProgram;
     GLuint mBuffer;
+    uint8_t *mPersistentMapPtr;
+    GLsizeiptr mRingOffset;
     std::vector<uint8_t> mVertexData;
     int mTriSize;
     int mNumUpdateTris;
@@ -260,6 +265,11 @@ std::string MapBufferRangeParams::story() const
     strstr << "_bufferSize" << bufferSize;
     strstr << "_access0x" << std::hex << access;
 
+    if (persistent)
+    {
+        strstr << "_persistent";
+    }
+
     return strstr.str();
 }
 
@@ -267,9 +277,16 @@ MapBufferRangeBenchmark::MapBufferRangeBenchmark()
     : ANGLERenderTest("MapBufferRange", GetParam()),
       mProgram(0),
       mBuffer(0),
+      mPersistentMapPtr(nullptr),
+      mRingOffset(0),
       mTriSize(0),
       mNumUpdateTris(0)
-{}
+{
+    if (GetParam().persistent)
+    {
+        addExtensionPrerequisite("GL_EXT_buffer_storage");
+    }
+}
 
 void MapBufferRangeBenchmark::initializeBenchmark()
 {
@@ -295,7 +312,17 @@ void MapBufferRangeBenchmark::initializeBenchmark()
 
     glGenBuffers(1, &mBuffer);
     glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
-    glBufferData(GL_ARRAY_BUFFER, params.bufferSize, nullptr, GL_DYNAMIC_DRAW);
+    if (params.persistent)
+    {
+        glBufferStorageEXT(GL_ARRAY_BUFFER, params.bufferSize, nullptr, params.access);
+        mPersistentMapPtr = static_cast<uint8_t *>(
+            glMapBufferRange(GL_ARRAY_BUFFER, 0, params.bufferSize, params.access));
+        ASSERT_NE(nullptr, mPersistentMapPtr);
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, params.bufferSize, nullptr, GL_DYNAMIC_DRAW);
+    }
 
     glVertexAttribPointer(0, params.vertexComponentCount, params.vertexType,
                           params.vertexNormalized, 0, 0);
@@ -314,7 +341,7 @@ void MapBufferRangeBenchmark::initializeBenchmark()
         ANGLE_UNSAFE_TODO(memcpy(mVertexData.data() + i * mTriSize, mVertexData.data(), mTriSize));
     }
 
-    if (params.updateSize == 0)
+    if (params.updateSize == 0 && !params.persistent)
     {
         mNumUpdateTris = 1;
         glBufferSubData(GL_ARRAY_BUFFER, 0, mVertexData.size(), mVertexData.data());
@@ -328,6 +355,10 @@ void MapBufferRangeBenchmark::initializeBenchmark()
 
 void MapBufferRangeBenchmark::destroyBenchmark()
 {
+    if (mPersistentMapPtr != nullptr)
+    {
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
     glDeleteProgram(mProgram);
     glDeleteBuffers(1, &mBuffer);
 }
@@ -340,6 +371,24 @@ void MapBufferRangeBenchmark::drawBenchmark()
 
     for (unsigned int it = 0; it < params.iterationsPerStep; it++)
     {
+        if (params.persistent)
+        {
+            // Write the next part of the ring buffer directly through the persistent mapping.  The
+            // same triangles are written every time, so overwriting data that the GPU may still be
+            // reading is harmless and no fence is needed.
+            if (mRingOffset + params.updateSize > params.bufferSize)
+            {
+                mRingOffset = 0;
+            }
+            ANGLE_UNSAFE_TODO(memcpy(mPersistentMapPtr + mRingOffset, mVertexData.data(),
+                                     params.updateSize));
+            const GLsizeiptr vertexSize = mTriSize / 3;
+            glDrawArrays(GL_TRIANGLES, static_cast<GLint>(mRingOffset / vertexSize),
+                         3 * mNumUpdateTris);
+            mRingOffset += params.updateSize;
+            continue;
+        }
+
         if (params.updateSize > 0)
         {
             void *mapPtr = glMapBufferRange(GL_ARRAY_BUFFER, params.updateOffset, params.updateSize,
@@ -485,6 +534,26 @@ MapBufferRangeParams BufferUpdateVulkanParamsLargeUpdateUnsynchronized()
     return params;
 }
 
+MapBufferRangeParams BufferUpdateVulkanParamsPersistentCoherent()
+{
+    MapBufferRangeParams params;
+    params.eglParameters        = egl_platform::VULKAN();
+    params.vertexType           = GL_FLOAT;
+    params.vertexComponentCount = 4;
+    params.vertexNormalized     = GL_FALSE;
+    params.access               = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT |
+                                  GL_MAP_COHERENT_BIT_EXT;
+    params.persistent           = true;
+    return params;
+}
+
+MapBufferRangeParams BufferUpdateVulkanParamsLargeUpdatePersistentCoherent()
+{
+    MapBufferRangeParams params = BufferUpdateVulkanParamsPersistentCoherent();
+    params.updateSize           = 524288;
+    return params;
+}
+
 TEST_P(MapBufferRangeBenchmark, Run)
 {
     run();
@@ -502,6 +571,8 @@ ANGLE_INSTANTIATE_TEST(MapBufferRangeBenchmark,
                        BufferUpdateVulkanParamsTinyUpdate(),
                        BufferUpdateVulkanParamsNonPowerOf2(),
                        BufferUpdateVulkanParamsUnsynchronized(),
-                       BufferUpdateVulkanParamsLargeUpdateUnsynchronized());
+                       BufferUpdateVulkanParamsLargeUpdateUnsynchronized(),
+                       BufferUpdateVulkanParamsPersistentCoherent(),
+                       BufferUpdateVulkanParamsLargeUpdatePersistentCoherent());
 
 }  // namespace
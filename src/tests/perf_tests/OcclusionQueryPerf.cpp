@@ -0,0 +1,156 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OcclusionQueryPerf:
+//   Performance test for occlusion queries whose results are polled one frame later, the way
+//   applications use them for visibility culling.  Besides the time per step, the number of polls
+//   that found the result unavailable is reported.
+
+#include "ANGLEPerfTest.h"
+
+#include "util/shader_utils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+constexpr unsigned int kQueriesPerStep    = 16;
+
+struct OcclusionQueryParams final : public RenderTestParams
+{
+    OcclusionQueryParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 256;
+        windowHeight      = 256;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const OcclusionQueryParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class OcclusionQueryPerf : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<OcclusionQueryParams>
+{
+  public:
+    OcclusionQueryPerf() : ANGLERenderTest("OcclusionQueryPerf", GetParam()) {}
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram = 0;
+    GLuint mBuffer  = 0;
+    // Two sets of queries; the results of one set are polled while the other is being issued.
+    GLuint mQueries[2][kQueriesPerStep] = {};
+    uint32_t mCurrentSet                = 0;
+    bool mPreviousSetIssued             = false;
+    size_t mUnavailablePolls            = 0;
+};
+
+void OcclusionQueryPerf::initializeBenchmark()
+{
+    mProgram = CompileProgram(essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    const GLfloat kQuad[] = {-1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 1, 1};
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kQuad), kQuad, GL_STATIC_DRAW);
+
+    const GLint positionLocation = glGetAttribLocation(mProgram, essl1_shaders::PositionAttrib());
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+
+    glGenQueries(kQueriesPerStep, mQueries[0]);
+    glGenQueries(kQueriesPerStep, mQueries[1]);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+    ASSERT_GL_NO_ERROR();
+}
+
+void OcclusionQueryPerf::destroyBenchmark()
+{
+    mReporter->RegisterFyiMetric(".unavailable_polls", "count");
+    recordIntegerMetric(".unavailable_polls", mUnavailablePolls, "count");
+
+    glDeleteQueries(kQueriesPerStep, mQueries[0]);
+    glDeleteQueries(kQueriesPerStep, mQueries[1]);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteProgram(mProgram);
+}
+
+void OcclusionQueryPerf::drawBenchmark()
+{
+    for (unsigned int iteration = 0; iteration < GetParam().iterationsPerStep; ++iteration)
+    {
+        // Poll the queries of the previous frame without waiting for them.
+        if (mPreviousSetIssued)
+        {
+            for (GLuint query : mQueries[mCurrentSet ^ 1])
+            {
+                GLuint available = GL_FALSE;
+                glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+                if (available == GL_FALSE)
+                {
+                    ++mUnavailablePolls;
+                }
+            }
+        }
+
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (GLuint query : mQueries[mCurrentSet])
+        {
+            glBeginQuery(GL_ANY_SAMPLES_PASSED, query);
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+            glEndQuery(GL_ANY_SAMPLES_PASSED);
+        }
+        glFlush();
+
+        mCurrentSet ^= 1;
+        mPreviousSetIssued = true;
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test the cost of issuing occlusion queries and polling their results a frame later.
+TEST_P(OcclusionQueryPerf, Run)
+{
+    run();
+}
+
+OcclusionQueryParams Vulkan()
+{
+    OcclusionQueryParams params;
+    params.eglParameters = angle::egl_platform::VULKAN();
+    return params;
+}
+
+OcclusionQueryParams Metal()
+{
+    OcclusionQueryParams params;
+    params.eglParameters = angle::egl_platform::METAL();
+    return params;
+}
+
+OcclusionQueryParams GL()
+{
+    OcclusionQueryParams params;
+    params.eglParameters = angle::egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(OcclusionQueryPerf, Vulkan(), Metal(), GL());
+
+// This test suite is not instantiated on some OSes.
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OcclusionQueryPerf);
@@ -30,6 +30,9 @@ enum class CompileLinkOrder
     // program's shaders are compiled, the program is linked, and the link status is immediately
     // queried (causing the main thread to block on the link task).
     InterleavedAndImmediateQuery,
+    // No link at all; all shaders are compiled and then their compile status is queried.  This
+    // measures the throughput of shader translation alone.
+    CompileOnly,
 
     Unspecified,
 };
@@ -64,6 +67,10 @@ struct ParallelLinkProgramParams final : public RenderTestParams
         {
             strstr << "_interleaved_compile_and_link_with_immediate_query";
         }
+        else if (compileLinkOrder == CompileLinkOrder::CompileOnly)
+        {
+            strstr << "_compile_only";
+        }
 
         if (std::find(eglParameters.disabledFeatureOverrides.begin(),
                       eglParameters.disabledFeatureOverrides.end(),
@@ -248,7 +255,8 @@ void ParallelLinkProgramBenchmark::drawBenchmark()
         // Compile the shaders, and if interleaved, link the corresponding programs.
         glCompileShader(mPrograms[i].vs);
         glCompileShader(mPrograms[i].fs);
-        if (params.compileLinkOrder != CompileLinkOrder::AllCompilesFirst)
+        if (params.compileLinkOrder != CompileLinkOrder::AllCompilesFirst &&
+            params.compileLinkOrder != CompileLinkOrder::CompileOnly)
         {
             glLinkProgram(mPrograms[i].program);
 
@@ -279,6 +287,11 @@ void ParallelLinkProgramBenchmark::drawBenchmark()
         glGetShaderiv(mPrograms[i].fs, GL_COMPILE_STATUS, &compileResult);
         EXPECT_NE(compileResult, 0) << i;
 
+        if (params.compileLinkOrder == CompileLinkOrder::CompileOnly)
+        {
+            continue;
+        }
+
         GLint linkStatus = GL_TRUE;
         glGetProgramiv(mPrograms[i].program, GL_LINK_STATUS, &linkStatus);
         EXPECT_TRUE(linkStatus) << i;
@@ -350,8 +363,10 @@ ANGLE_INSTANTIATE_TEST(
     ParallelLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
     ParallelLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
     ParallelLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery),
+    ParallelLinkProgramVulkanParams(CompileLinkOrder::CompileOnly),
     SerialLinkProgramVulkanParams(CompileLinkOrder::AllCompilesFirst),
     SerialLinkProgramVulkanParams(CompileLinkOrder::Interleaved),
-    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery));
+    SerialLinkProgramVulkanParams(CompileLinkOrder::InterleavedAndImmediateQuery),
+    SerialLinkProgramVulkanParams(CompileLinkOrder::CompileOnly));
 
 }  // anonymous namespace
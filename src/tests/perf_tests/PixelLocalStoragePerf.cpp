@@ -0,0 +1,194 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PixelLocalStoragePerf:
+//   Performance test for ANGLE_shader_pixel_local_storage, drawing overlapping full-screen quads
+//   that accumulate into a few PLS planes, with a PLS barrier between draws.  The variant with
+//   preferFramebufferFetchPixelLocalStorage keeps the planes in input attachments on devices that
+//   would otherwise use shader images, so comparing the GPU time of the two variants shows the
+//   memory bandwidth of the image implementation.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+constexpr unsigned int kDrawsPerIteration = 16;
+constexpr GLsizei kPlaneCount             = 3;
+
+struct PixelLocalStorageParams final : public RenderTestParams
+{
+    PixelLocalStorageParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 1;
+        windowWidth       = 1024;
+        windowHeight      = 1024;
+    }
+
+    std::string story() const override;
+};
+
+std::string PixelLocalStorageParams::story() const
+{
+    std::stringstream strstr;
+    strstr << RenderTestParams::story();
+    if (isEnableRequested(Feature::PreferFramebufferFetchPixelLocalStorage))
+    {
+        strstr << "_framebuffer_fetch";
+    }
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const PixelLocalStorageParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class PixelLocalStoragePerf : public ANGLERenderTest,
+                              public ::testing::WithParamInterface<PixelLocalStorageParams>
+{
+  public:
+    PixelLocalStoragePerf() : ANGLERenderTest("PixelLocalStoragePerf", GetParam())
+    {
+        addExtensionPrerequisite("GL_ANGLE_shader_pixel_local_storage");
+    }
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram             = 0;
+    GLuint mBuffer              = 0;
+    GLuint mFramebuffer         = 0;
+    GLuint mPlanes[kPlaneCount] = {};
+};
+
+void PixelLocalStoragePerf::initializeBenchmark()
+{
+    constexpr char kVS[] = R"(#version 310 es
+in vec4 a_position;
+void main()
+{
+    gl_Position = a_position;
+})";
+
+    constexpr char kFS[] = R"(#version 310 es
+#extension GL_ANGLE_shader_pixel_local_storage : require
+layout(binding=0, rgba8, noncoherent) uniform lowp pixelLocalANGLE plane0;
+layout(binding=1, rgba8, noncoherent) uniform lowp pixelLocalANGLE plane1;
+layout(binding=2, rgba8, noncoherent) uniform lowp pixelLocalANGLE plane2;
+void main()
+{
+    lowp vec4 value0 = pixelLocalLoadANGLE(plane0);
+    lowp vec4 value1 = pixelLocalLoadANGLE(plane1);
+    lowp vec4 value2 = pixelLocalLoadANGLE(plane2);
+    pixelLocalStoreANGLE(plane0, fract(value0 + vec4(1.0 / 255.0)));
+    pixelLocalStoreANGLE(plane1, fract(value1 + value0 * 0.5));
+    pixelLocalStoreANGLE(plane2, fract(value2 + value1 * 0.25));
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    const GLfloat kQuad[] = {-1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 1, 1};
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kQuad), kQuad, GL_STATIC_DRAW);
+
+    const GLint positionLocation = glGetAttribLocation(mProgram, "a_position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+
+    const GLsizei width  = getWindow()->getWidth();
+    const GLsizei height = getWindow()->getHeight();
+
+    glGenFramebuffers(1, &mFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+    glGenTextures(kPlaneCount, mPlanes);
+    for (GLsizei plane = 0; plane < kPlaneCount; ++plane)
+    {
+        glBindTexture(GL_TEXTURE_2D, mPlanes[plane]);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+        glFramebufferTexturePixelLocalStorageANGLE(
+            plane, mPlanes[plane], 0, 0, GL_PIXEL_LOCAL_USAGE_ALWAYS_NONCOHERENT_BIT_ANGLE);
+    }
+
+    glViewport(0, 0, width, height);
+    ASSERT_GL_NO_ERROR();
+}
+
+void PixelLocalStoragePerf::destroyBenchmark()
+{
+    glDeleteTextures(kPlaneCount, mPlanes);
+    glDeleteFramebuffers(1, &mFramebuffer);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteProgram(mProgram);
+}
+
+void PixelLocalStoragePerf::drawBenchmark()
+{
+    constexpr GLenum kLoadOps[kPlaneCount]  = {GL_LOAD_OP_LOAD_ANGLE, GL_LOAD_OP_LOAD_ANGLE,
+                                               GL_LOAD_OP_LOAD_ANGLE};
+    constexpr GLenum kStoreOps[kPlaneCount] = {GL_STORE_OP_STORE_ANGLE, GL_STORE_OP_STORE_ANGLE,
+                                               GL_STORE_OP_STORE_ANGLE};
+
+    for (unsigned int iteration = 0; iteration < GetParam().iterationsPerStep; ++iteration)
+    {
+        glBeginPixelLocalStorageANGLE(kPlaneCount, kLoadOps);
+        for (unsigned int draw = 0; draw < kDrawsPerIteration; ++draw)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+            glPixelLocalStorageBarrierANGLE();
+        }
+        glEndPixelLocalStorageANGLE(kPlaneCount, kStoreOps);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test the cost of overlapping draws that read and write pixel local storage.
+TEST_P(PixelLocalStoragePerf, Run)
+{
+    run();
+}
+
+PixelLocalStorageParams Vulkan()
+{
+    PixelLocalStorageParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+PixelLocalStorageParams VulkanFramebufferFetch()
+{
+    PixelLocalStorageParams params = Vulkan();
+    params.enable(Feature::PreferFramebufferFetchPixelLocalStorage);
+    return params;
+}
+
+PixelLocalStorageParams GL()
+{
+    PixelLocalStorageParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(PixelLocalStoragePerf, Vulkan(), VulkanFramebufferFetch(), GL());
+
+// This test suite is not instantiated on some OSes.
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PixelLocalStoragePerf);
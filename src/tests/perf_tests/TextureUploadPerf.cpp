@@ -33,7 +33,9 @@ struct TextureUploadParams final : public RenderTestParams
         baseSize     = 1024;
         subImageSize = 64;
 
-        webgl = false;
+        webgl                = false;
+        parallelLoads        = false;
+        batchSubImageUpdates = false;
     }
 
     std::string story() const override;
@@ -42,6 +44,8 @@ struct TextureUploadParams final : public RenderTestParams
     GLsizei subImageSize;
 
     bool webgl;
+    bool parallelLoads;
+    bool batchSubImageUpdates;
 };
 
 std::ostream &operator<<(std::ostream &os, const TextureUploadParams &params)
@@ -61,6 +65,16 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    if (parallelLoads)
+    {
+        strstr << "_parallel_loads";
+    }
+
+    if (batchSubImageUpdates)
+    {
+        strstr << "_batched";
+    }
+
     return strstr.str();
 }
 
@@ -108,6 +122,27 @@ class TextureUploadSubImageBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+// Fills a texture atlas with many small sub-image updates before it's used, which the backend can
+// batch into a few copies.
+class TextureUploadAtlasBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadAtlasBenchmark() : TextureUploadBenchmarkBase("TextureUploadAtlas")
+    {
+        addExtensionPrerequisite("GL_EXT_texture_storage");
+    }
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params = GetParam();
+        glTexStorage2DEXT(GL_TEXTURE_2D, 1, GL_RGBA8, params.baseSize, params.baseSize);
+    }
+
+    void drawBenchmark() override;
+};
+
 class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -116,6 +151,27 @@ class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+// Uploads a large RGB8 image, which the backend has to convert to RGBA8 on the CPU.
+class TextureUploadConversionBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadConversionBenchmark() : TextureUploadBenchmarkBase("TextureUploadConversion")
+    {
+        addExtensionPrerequisite("GL_EXT_texture_storage");
+    }
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params = GetParam();
+        glTexStorage2DEXT(GL_TEXTURE_2D, 1, GL_RGB8, params.baseSize, params.baseSize);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    }
+
+    void drawBenchmark() override;
+};
+
 class PBOSubImageBenchmark : public TextureUploadBenchmarkBase
 {
   public:
@@ -379,6 +435,31 @@ void TextureUploadSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadAtlasBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        for (GLsizei y = 0; y < params.baseSize; y += params.subImageSize)
+        {
+            for (GLsizei x = 0; x < params.baseSize; x += params.subImageSize)
+            {
+                glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, params.subImageSize, params.subImageSize,
+                                GL_RGBA, GL_UNSIGNED_BYTE, mTextureData.data());
+            }
+        }
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void TextureUploadFullMipBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -403,6 +484,25 @@ void TextureUploadFullMipBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadConversionBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.baseSize, params.baseSize, GL_RGB,
+                        GL_UNSIGNED_BYTE, mTextureData.data());
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void PBOSubImageBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
@@ -488,6 +588,40 @@ TextureUploadParams ES3VulkanParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams VulkanConversionParams(bool parallelLoads)
+{
+    TextureUploadParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.trackGpuTime  = false;
+    params.baseSize      = 4096;
+    params.parallelLoads = parallelLoads;
+    if (parallelLoads)
+    {
+        params.enable(Feature::ParallelImageLoads);
+    }
+    return params;
+}
+
+TextureUploadParams AtlasParams(const EGLPlatformParameters &eglParameters)
+{
+    TextureUploadParams params;
+    params.eglParameters = eglParameters;
+    params.baseSize      = 512;
+    params.subImageSize  = 16;
+    return params;
+}
+
+TextureUploadParams VulkanAtlasParams(bool batchSubImageUpdates)
+{
+    TextureUploadParams params  = AtlasParams(egl_platform::VULKAN());
+    params.batchSubImageUpdates = batchSubImageUpdates;
+    if (batchSubImageUpdates)
+    {
+        params.enable(Feature::BatchSubImageUpdates);
+    }
+    return params;
+}
+
 TextureUploadParams MetalPBOParams(GLsizei baseSize, GLsizei subImageSize)
 {
     TextureUploadParams params;
@@ -541,6 +675,18 @@ TEST_P(TextureUploadFullMipBenchmark, Run)
     run();
 }
 
+// Test the cost of many small uploads to the same texture before it's used.
+TEST_P(TextureUploadAtlasBenchmark, Run)
+{
+    run();
+}
+
+// Test the CPU cost of uploads that need format conversion, with and without parallel loads.
+TEST_P(TextureUploadConversionBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(PBOSubImageBenchmark, Run)
 {
     run();
@@ -576,6 +722,19 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        VulkanParams(true));
 
+ANGLE_INSTANTIATE_TEST(TextureUploadAtlasBenchmark,
+                       AtlasParams(egl_platform::OPENGL_OR_GLES()),
+                       VulkanAtlasParams(false),
+                       VulkanAtlasParams(true),
+                       NullDevice(VulkanAtlasParams(false)),
+                       NullDevice(VulkanAtlasParams(true)));
+
+ANGLE_INSTANTIATE_TEST(TextureUploadConversionBenchmark,
+                       VulkanConversionParams(false),
+                       VulkanConversionParams(true),
+                       NullDevice(VulkanConversionParams(false)),
+                       NullDevice(VulkanConversionParams(true)));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
                        ES3OpenGLPBOParams(1024, 128),
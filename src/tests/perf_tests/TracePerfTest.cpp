@@ -1460,6 +1460,9 @@ void TracePerfTest::initializeBenchmark()
     mEndFrame   = traceInfo.frameEnd;
     mTraceReplay->setValidateSerializedStateCallback(ValidateSerializedState);
     mTraceReplay->setBinaryDataDir(testDataDir);
+    const size_t residentSize = static_cast<size_t>(gBinaryDataResidentSizeMB) * 1024 * 1024;
+    mTraceReplay->setBinaryDataResidentSize(residentSize);
+    mTraceReplay->setPrefetchBinaryData(gPrefetchBinaryData);
     mTraceReplay->setReplayResourceMode(gIncludeInactiveResources);
     if (gScreenshotDir)
     {
@@ -1674,7 +1677,7 @@ void TracePerfTest::drawBenchmark()
 
     const double beginReplayFrameTimeSec = mTrialTimer.getElapsedWallClockTime();
     mTraceReplay->replayFrame(mCurrentFrame);
-    mFrameWallTimeSec += mTrialTimer.getElapsedWallClockTime() - beginReplayFrameTimeSec;
+    double frameWallTimeSec = mTrialTimer.getElapsedWallClockTime() - beginReplayFrameTimeSec;
 
     if (!gAddSwapIntoGPUTime && mParams->trackGpuTime)
     {
@@ -1807,8 +1810,10 @@ void TracePerfTest::drawBenchmark()
     if (gAddSwapIntoFrameWallTime)
     {
         const double endSwapTimeSec = mTrialTimer.getElapsedWallClockTime();
-        mFrameWallTimeSec += endSwapTimeSec - beginSwapTimeSec;
+        frameWallTimeSec += endSwapTimeSec - beginSwapTimeSec;
     }
+    mFrameWallTimeSec += frameWallTimeSec;
+    recordFrameWallTime(frameWallTimeSec);
 
     if (gAddSwapIntoGPUTime && mParams->trackGpuTime)
     {
@@ -0,0 +1,182 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UniformBufferRangePerf:
+//   Performance test for the common pattern of keeping the uniform data of many draws in one
+//   large uniform buffer and calling glBindBufferRange before each draw.  Only the offset of the
+//   binding changes between draws.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <vector>
+
+#include "util/shader_utils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 4;
+constexpr unsigned int kDrawsPerIteration = 256;
+
+struct UniformBufferRangeParams final : public RenderTestParams
+{
+    UniformBufferRangeParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 256;
+        windowHeight      = 256;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const UniformBufferRangeParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class UniformBufferRangePerf : public ANGLERenderTest,
+                               public ::testing::WithParamInterface<UniformBufferRangeParams>
+{
+  public:
+    UniformBufferRangePerf() : ANGLERenderTest("UniformBufferRangePerf", GetParam()) {}
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram         = 0;
+    GLuint mVertexBuffer    = 0;
+    GLuint mUniformBuffer   = 0;
+    GLsizeiptr mBlockStride = 0;
+};
+
+void UniformBufferRangePerf::initializeBenchmark()
+{
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 a_position;
+uniform Block
+{
+    vec4 offsetScale;
+    vec4 color;
+};
+out vec4 v_color;
+void main()
+{
+    gl_Position = vec4(a_position.xy * offsetScale.zw + offsetScale.xy, 0, 1);
+    v_color = color;
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+in vec4 v_color;
+out vec4 color;
+void main()
+{
+    color = v_color;
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+    glUniformBlockBinding(mProgram, glGetUniformBlockIndex(mProgram, "Block"), 0);
+
+    const GLfloat kQuad[] = {-1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 1, 1};
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kQuad), kQuad, GL_STATIC_DRAW);
+
+    const GLint positionLocation = glGetAttribLocation(mProgram, "a_position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(positionLocation);
+
+    // Lay out the data of each draw at the offset alignment required by glBindBufferRange.
+    constexpr GLsizeiptr kBlockSize = 8 * sizeof(GLfloat);
+    GLint offsetAlignment           = 1;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+    mBlockStride = (kBlockSize + offsetAlignment - 1) / offsetAlignment * offsetAlignment;
+
+    const size_t floatsPerBlock = static_cast<size_t>(mBlockStride) / sizeof(GLfloat);
+    std::vector<GLfloat> uniformData(floatsPerBlock * kDrawsPerIteration, 0.0f);
+    for (unsigned int draw = 0; draw < kDrawsPerIteration; ++draw)
+    {
+        GLfloat *block = &uniformData[draw * floatsPerBlock];
+        const float t  = static_cast<float>(draw) / kDrawsPerIteration;
+        block[0]       = t * 1.8f - 0.9f;
+        block[1]       = 0.9f - t * 1.8f;
+        block[2]       = 0.1f;
+        block[3]       = 0.1f;
+        block[4]       = t;
+        block[5]       = 1.0f - t;
+        block[6]       = 0.5f;
+        block[7]       = 1.0f;
+    }
+
+    glGenBuffers(1, &mUniformBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, uniformData.size() * sizeof(GLfloat), uniformData.data(),
+                 GL_STATIC_DRAW);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+    ASSERT_GL_NO_ERROR();
+}
+
+void UniformBufferRangePerf::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mUniformBuffer);
+    glDeleteBuffers(1, &mVertexBuffer);
+    glDeleteProgram(mProgram);
+}
+
+void UniformBufferRangePerf::drawBenchmark()
+{
+    for (unsigned int iteration = 0; iteration < GetParam().iterationsPerStep; ++iteration)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (unsigned int draw = 0; draw < kDrawsPerIteration; ++draw)
+        {
+            glBindBufferRange(GL_UNIFORM_BUFFER, 0, mUniformBuffer, draw * mBlockStride,
+                              mBlockStride);
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test the cost of draws that only change the offset of a uniform buffer binding.
+TEST_P(UniformBufferRangePerf, Run)
+{
+    run();
+}
+
+UniformBufferRangeParams Vulkan()
+{
+    UniformBufferRangeParams params;
+    params.eglParameters = angle::egl_platform::VULKAN();
+    return params;
+}
+
+UniformBufferRangeParams VulkanNull()
+{
+    UniformBufferRangeParams params;
+    params.eglParameters = angle::egl_platform::VULKAN_NULL();
+    return params;
+}
+
+UniformBufferRangeParams GL()
+{
+    UniformBufferRangeParams params;
+    params.eglParameters = angle::egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(UniformBufferRangePerf, Vulkan(), VulkanNull(), GL());
+
+// This test suite is not instantiated on some OSes.
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformBufferRangePerf);
@@ -25,11 +25,13 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 4;
 
-// Controls when we call glUniform, if the data is the same as last frame.
+// Controls when we call glUniform, if the data is the same as last frame.  With PARTIAL_UPDATE,
+// every uniform is set before each draw but only one of them changes value.
 enum DataMode
 {
     UPDATE,
     REPEAT,
+    PARTIAL_UPDATE,
 };
 
 // TODO(jmadill): Use an ANGLE enum for this?
@@ -121,6 +123,10 @@ std::string UniformsParams::story() const
     {
         strstr << "_repeating";
     }
+    else if (dataMode == DataMode::PARTIAL_UPDATE)
+    {
+        strstr << "_partial_update";
+    }
 
     return strstr.str();
 }
@@ -402,6 +408,15 @@ void UniformsBenchmark::drawLoop(const SetUniformFunc &setUniformsFunc)
                 setUniformsFunc(mUniformLocations, mMatrixData, uniform, frameIndex);
             }
         }
+        else if (params.dataMode == DataMode::PARTIAL_UPDATE)
+        {
+            // Only the first uniform alternates between the two data sets.
+            for (size_t uniform = 0; uniform < mUniformLocations.size(); ++uniform)
+            {
+                setUniformsFunc(mUniformLocations, mMatrixData, uniform,
+                                uniform == 0 ? frameIndex : 0);
+            }
+        }
         glDrawArrays(GL_TRIANGLES, 0, 3);
     }
 }
@@ -451,7 +466,7 @@ void UniformsBenchmark::drawBenchmark()
         {
             auto setFunc = [](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                               size_t uniform, size_t frameIndex) {
-                float value = static_cast<float>(uniform);
+                float value = static_cast<float>(uniform + frameIndex * locations.size());
                 glUniform4f(locations[uniform], value, value, value, value);
             };
 
@@ -535,4 +550,14 @@ ANGLE_INSTANTIATE_TEST(
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
-    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
+    MatrixUniforms(VULKAN(),
+                   DataMode::PARTIAL_UPDATE,
+                   DataType::MAT4x4,
+                   MatrixLayout::NO_TRANSPOSE),
+    VectorUniforms(VULKAN(), DataMode::UPDATE),
+    VectorUniforms(VULKAN(), DataMode::PARTIAL_UPDATE),
+    VectorUniforms(VULKAN_NULL(), DataMode::PARTIAL_UPDATE),
+    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE),
+    VectorUniforms(NULL_BACKEND(), DataMode::UPDATE),
+    VectorUniforms(NULL_BACKEND(), DataMode::REPEAT, ProgramMode::MULTIPLE),
+    MatrixUniforms(NULL_BACKEND(), DataMode::UPDATE, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE));
@@ -22,7 +22,10 @@ constexpr unsigned int kIterationsPerStep = 10;
 
 struct VulkanBarriersPerfParams final : public RenderTestParams
 {
-    VulkanBarriersPerfParams(bool bufferCopy, bool largeTransfers, bool slowFS)
+    VulkanBarriersPerfParams(bool bufferCopy,
+                             bool largeTransfers,
+                             bool slowFS,
+                             bool textureStreaming)
     {
         iterationsPerStep = kIterationsPerStep;
 
@@ -37,6 +40,8 @@ struct VulkanBarriersPerfParams final : public RenderTestParams
         doBufferCopy          = bufferCopy;
         doLargeTransfers      = largeTransfers;
         doSlowFragmentShaders = slowFS;
+        doTextureStreaming    = textureStreaming;
+        batchImageBarriers    = true;
     }
 
     std::string story() const override;
@@ -45,9 +50,15 @@ struct VulkanBarriersPerfParams final : public RenderTestParams
     static constexpr int kImageSizes[3] = {256, 512, 4096};
     static constexpr int kBufferSize    = 4096 * 4096;
 
+    // Texture streaming uploads to many small textures, each sampled by a draw right after.
+    static constexpr int kStreamingTextureCount = 16;
+    static constexpr int kStreamingTextureSize  = 64;
+
     bool doBufferCopy;
     bool doLargeTransfers;
     bool doSlowFragmentShaders;
+    bool doTextureStreaming;
+    bool batchImageBarriers;
 };
 
 constexpr int VulkanBarriersPerfParams::kImageSizes[];
@@ -86,6 +97,8 @@ class VulkanBarriersPerfBenchmark : public ANGLERenderTest,
 
     // Texture handles
     GLTexture mTextures[4];
+    GLTexture mStreamingTextures[VulkanBarriersPerfParams::kStreamingTextureCount];
+    std::vector<GLubyte> mStreamingData;
 
     // Uniform buffer handles
     GLBuffer mUniformBuffers[2];
@@ -131,6 +144,14 @@ std::string VulkanBarriersPerfParams::story() const
     {
         sout << "_slowfs";
     }
+    if (doTextureStreaming)
+    {
+        sout << "_texture_streaming";
+    }
+    if (!batchImageBarriers)
+    {
+        sout << "_unbatched_image_barriers";
+    }
 
     return sout.str();
 }
@@ -270,6 +291,20 @@ void VulkanBarriersPerfBenchmark::createResources()
         createTexture(kTransferTexture1Index, kHugeSizeIndex, true);
         createTexture(kTransferTexture2Index, kHugeSizeIndex, true);
     }
+
+    if (params.doTextureStreaming)
+    {
+        mStreamingData.resize(params.kStreamingTextureSize * params.kStreamingTextureSize * 4,
+                              0x80);
+        for (GLTexture &texture : mStreamingTextures)
+        {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, params.kStreamingTextureSize,
+                           params.kStreamingTextureSize);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        }
+    }
 }
 
 void VulkanBarriersPerfBenchmark::initializeBenchmark()
@@ -353,6 +388,9 @@ void VulkanBarriersPerfBenchmark::drawBenchmark()
      *
      * + |------------------draw------------------|                                 |-...draw...-|
      * + |--------------copy----------------|       |-------------copy-------------|
+     *
+     * Texture streaming measures the cost of the barriers of many back-to-back small uploads to
+     * different textures, which would ideally be issued together instead of one per upload.
      */
 
     startGpuTimer();
@@ -394,12 +432,32 @@ void VulkanBarriersPerfBenchmark::drawBenchmark()
         ASSERT_GL_NO_ERROR();
 
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0);
+
+        if (params.doTextureStreaming)
+        {
+            // Update each texture right before the draw that samples it.
+            for (GLTexture &texture : mStreamingTextures)
+            {
+                glBindTexture(GL_TEXTURE_2D, texture);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.kStreamingTextureSize,
+                                params.kStreamingTextureSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                                mStreamingData.data());
+                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0);
+            }
+        }
     }
     stopGpuTimer();
 
     ASSERT_GL_NO_ERROR();
 }
 
+VulkanBarriersPerfParams UnbatchedImageBarriers(VulkanBarriersPerfParams params)
+{
+    params.eglParameters.disable(Feature::BatchOutsideRenderPassImageBarriers);
+    params.batchImageBarriers = false;
+    return params;
+}
+
 }  // namespace
 
 TEST_P(VulkanBarriersPerfBenchmark, Run)
@@ -409,7 +467,9 @@ TEST_P(VulkanBarriersPerfBenchmark, Run)
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanBarriersPerfBenchmark);
 ANGLE_INSTANTIATE_TEST(VulkanBarriersPerfBenchmark,
-                       VulkanBarriersPerfParams(false, false, false),
-                       VulkanBarriersPerfParams(true, false, false),
-                       VulkanBarriersPerfParams(false, true, false),
-                       VulkanBarriersPerfParams(false, true, true));
+                       VulkanBarriersPerfParams(false, false, false, false),
+                       VulkanBarriersPerfParams(true, false, false, false),
+                       VulkanBarriersPerfParams(false, true, false, false),
+                       VulkanBarriersPerfParams(false, true, true, false),
+                       VulkanBarriersPerfParams(false, false, false, true),
+                       UnbatchedImageBarriers(VulkanBarriersPerfParams(false, false, false, true)));
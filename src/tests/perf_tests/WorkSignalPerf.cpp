@@ -0,0 +1,138 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkSignalPerfTest:
+//   Performance benchmark for waking up a worker thread with angle::WorkSignal compared to a
+//   mutex and condition variable, like the Vulkan clean up thread used to.  Each round trip wakes
+//   the other thread and waits for it to answer.
+//
+
+#include "ANGLEPerfTest.h"
+#include "common/unsafe_buffers.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "common/WorkerThread.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 1;
+constexpr uint32_t kRoundTripsPerStep     = 100;
+
+// The same interface as angle::WorkSignal, implemented with a mutex and condition variable.
+class ConditionVariableSignal final : angle::NonCopyable
+{
+  public:
+    void raise()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRaised = true;
+        }
+        mCondition.notify_one();
+    }
+    void terminate()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTerminated = true;
+        }
+        mCondition.notify_one();
+    }
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mRaised || mTerminated; });
+        mRaised = false;
+        return !mTerminated;
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mRaised     = false;
+    bool mTerminated = false;
+};
+
+template <typename SignalT>
+class WorkSignalPerfTest : public ANGLEPerfTest
+{
+  public:
+    WorkSignalPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    SignalT mPing;
+    SignalT mPong;
+    std::thread mThread;
+};
+
+template <typename SignalT>
+WorkSignalPerfTest<SignalT>::WorkSignalPerfTest()
+    : ANGLEPerfTest("WorkSignalPerfTest", "", "", kIterationsPerStep)
+{}
+
+template <typename SignalT>
+void WorkSignalPerfTest<SignalT>::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    mThread = std::thread([this]() {
+        while (mPing.wait())
+        {
+            mPong.raise();
+        }
+    });
+}
+
+template <typename SignalT>
+void WorkSignalPerfTest<SignalT>::TearDown()
+{
+    mPing.terminate();
+    mThread.join();
+
+    ANGLEPerfTest::TearDown();
+}
+
+template <typename SignalT>
+void WorkSignalPerfTest<SignalT>::step()
+{
+    for (uint32_t roundTrip = 0; roundTrip < kRoundTripsPerStep; ++roundTrip)
+    {
+        mPing.raise();
+        mPong.wait();
+    }
+}
+
+using TestTypes = Types<ConditionVariableSignal, angle::WorkSignal>;
+
+constexpr char kTestTypeNames[][100] = {"condition_variable", "work_signal"};
+
+class SignalTypeNames
+{
+  public:
+    template <typename SignalType>
+    static std::string GetName(int typeIndex)
+    {
+        return ANGLE_UNSAFE_TODO(kTestTypeNames[typeIndex]);
+    }
+};
+
+TYPED_TEST_SUITE(WorkSignalPerfTest, TestTypes, SignalTypeNames);
+
+// Test the round trip latency of waking up another thread
+TYPED_TEST(WorkSignalPerfTest, Run)
+{
+    this->run();
+}
+
+}  // anonymous namespace
@@ -1303,4 +1303,15 @@ f
     preprocess(kInput, kExpected);
 }
 
+// Tests that predefined macros are expanded in a shader without any directives, which skips the
+// macro lookup of other identifiers.
+TEST_F(DefineTest, PredefinedWithoutDirectives)
+{
+    const char *input    = "__LINE__ __FILE__ __VERSION__ GL_ES foo GL_foo __foo\n";
+    const char *expected = "1 0 100 1 foo GL_foo __foo\n";
+    EXPECT_CALL(mDirectiveHandler, handleVersion(pp::SourceLocation(0, 1), 100, SH_GLES2_SPEC, _))
+        .Times(1);
+    preprocess(input, expected);
+}
+
 }  // namespace angle
@@ -8,6 +8,7 @@
 #   Runs ANGLE perf tests using some statistical averaging.
 
 import argparse
+import collections
 import contextlib
 import glob
 import importlib
@@ -21,6 +22,7 @@ import pathlib
 import re
 import subprocess
 import shutil
+import statistics
 import sys
 
 SCRIPT_DIR = str(pathlib.Path(__file__).resolve().parent)
@@ -241,6 +243,38 @@ def _wall_times_stats(wall_times):
     return None
 
 
+def _frame_time_stats(metrics):
+    # Per-trial frame time percentiles are reported by tests that time individual frames (e.g.
+    # TracePerfTest). Summarize them across all trials of the test as the median of each
+    # percentile, and the total number of hitches.
+    def values(metric):
+        return [float(m['value']) for m in metrics if m['metric'] == metric]
+
+    percentiles = []
+    for percentile in ['p50', 'p95', 'p99']:
+        trial_values = values('.frame_wall_time_%s' % percentile)
+        if trial_values:
+            percentiles.append('%s = %.2f ms' % (percentile, statistics.median(trial_values)))
+
+    if not percentiles:
+        return None
+
+    stats = 'frame_wall_time ' + ', '.join(percentiles)
+    hitches = values('.frame_wall_time_hitches')
+    if hitches:
+        stats += ', hitches = %d' % sum(hitches)
+        hitch_counters = [(m['metric'][1:-len('_hitches')], float(m['value']))
+                          for m in metrics
+                          if m['metric'].endswith('_hitches') and
+                          m['metric'] != '.frame_wall_time_hitches']
+        counter_totals = collections.defaultdict(float)
+        for counter, value in hitch_counters:
+            counter_totals[counter] += value
+        for counter, total in sorted(counter_totals.items()):
+            stats += ', hitches with %s = %d' % (counter, total)
+    return stats
+
+
 def _run_test_suite(args, cmd_args, env):
     return angle_test_util.RunTestSuite(
         args.test_suite,
@@ -419,6 +453,11 @@ def _run_tests(tests, args, extra_flags, env):
             stats = _wall_times_stats(wall_times)
             if stats:
                 logging.info('Test %d/%d: %s: %s' % (test_index + 1, len(tests), test, stats))
+            frame_stats = _frame_time_stats(
+                [m for sample_metrics in metrics[-args.samples_per_test:] for m in sample_metrics])
+            if frame_stats:
+                logging.info('Test %d/%d: %s: %s' %
+                             (test_index + 1, len(tests), test, frame_stats))
             histograms.Merge(_merge_into_one_histogram(test_histogram_set))
             results.result_pass(test)
 
@@ -162,6 +162,11 @@ const std::vector<sh::ShaderVariable> &ShaderCompileTreeTest::getAttributes() co
     return mTranslator->getAttributes();
 }
 
+TCompiler &ShaderCompileTreeTest::getCompiler()
+{
+    return *mTranslator;
+}
+
 bool IsZero(TIntermNode *node)
 {
     if (!node->getAsTyped())
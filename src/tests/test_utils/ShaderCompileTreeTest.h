@@ -18,6 +18,7 @@
 namespace sh
 {
 
+class TCompiler;
 class TIntermBlock;
 class TIntermNode;
 class TranslatorESSL;
@@ -41,6 +42,9 @@ class ShaderCompileTreeTest : public testing::Test
     const std::vector<sh::ShaderVariable> &getUniforms() const;
     const std::vector<sh::ShaderVariable> &getAttributes() const;
 
+    // For running tree transformations on mASTRoot.
+    TCompiler &getCompiler();
+
     virtual void initResources(ShBuiltInResources *resources) {}
     virtual ::GLenum getShaderType() const     = 0;
     virtual ShShaderSpec getShaderSpec() const = 0;
@@ -474,6 +474,11 @@ EGLPlatformParameters WEBGPU()
     return EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_WEBGPU_ANGLE);
 }
 
+EGLPlatformParameters NULL_BACKEND()
+{
+    return EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+}
+
 }  // namespace egl_platform
 
 // ANGLE tests platforms
@@ -108,6 +108,8 @@ EGLPlatformParameters D3D11_FL10_0_REFERENCE();
 
 EGLPlatformParameters METAL();
 
+EGLPlatformParameters NULL_BACKEND();
+
 EGLPlatformParameters OPENGL();
 EGLPlatformParameters OPENGL(EGLint major, EGLint minor);
 
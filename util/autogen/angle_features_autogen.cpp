@@ -23,6 +23,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AdjustSrcDstRegionForBlitFramebuffer, "adjustSrcDstRegionForBlitFramebuffer"},
     {Feature::AllocateNonZeroMemory, "allocateNonZeroMemory"},
     {Feature::AllocateNonZeroTextures, "allocateNonZeroTextures"},
+    {Feature::AllocateStreamingBuffersFromHeap, "allocateStreamingBuffersFromHeap"},
     {Feature::AllowAstcFormats, "allowAstcFormats"},
     {Feature::AllowBufferReadWrite, "allowBufferReadWrite"},
     {Feature::AllowClearForRobustResourceInit, "allowClearForRobustResourceInit"},
@@ -61,13 +62,17 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AvoidOpSelectWithMismatchingRelaxedPrecision, "avoidOpSelectWithMismatchingRelaxedPrecision"},
     {Feature::AvoidStencilTextureSwizzle, "avoidStencilTextureSwizzle"},
     {Feature::AvoidWaitAny, "avoidWaitAny"},
+    {Feature::BatchOutsideRenderPassImageBarriers, "batchOutsideRenderPassImageBarriers"},
+    {Feature::BatchSubImageUpdates, "batchSubImageUpdates"},
     {Feature::BgraTexImageFormatsBroken, "bgraTexImageFormatsBroken"},
     {Feature::BindCompleteFramebufferForTimerQueries, "bindCompleteFramebufferForTimerQueries"},
     {Feature::BindTransformFeedbackBufferBeforeBindBufferRange, "bindTransformFeedbackBufferBeforeBindBufferRange"},
     {Feature::BorderColorSrgb, "borderColorSrgb"},
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
     {Feature::BresenhamLineRasterization, "bresenhamLineRasterization"},
+    {Feature::CacheCompiledHlsl, "cacheCompiledHlsl"},
     {Feature::CacheCompiledShader, "cacheCompiledShader"},
+    {Feature::CacheFormatPropertiesInBlobCache, "cacheFormatPropertiesInBlobCache"},
     {Feature::CallClearTwice, "callClearTwice"},
     {Feature::ClampArrayAccess, "clampArrayAccess"},
     {Feature::ClampFragDepth, "clampFragDepth"},
@@ -82,10 +87,13 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::CompileJobIsThreadSafe, "compileJobIsThreadSafe"},
     {Feature::ConvertLowpAndMediumpFloatUniformsTo16Bits, "convertLowpAndMediumpFloatUniformsTo16Bits"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization, "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
+    {Feature::CopyOcclusionQueryResultsToBuffer, "copyOcclusionQueryResultsToBuffer"},
     {Feature::CopyTextureToBufferForReadOptimization, "copyTextureToBufferForReadOptimization"},
     {Feature::CorruptProgramBinaryForTesting, "corruptProgramBinaryForTesting"},
     {Feature::DebugClDumpCommandStream, "debugClDumpCommandStream"},
+    {Feature::DecodeAstcUploadsAsynchronously, "decodeAstcUploadsAsynchronously"},
     {Feature::DecodeEncodeSRGBForGenerateMipmap, "decodeEncodeSRGBForGenerateMipmap"},
+    {Feature::DeferExternalSemaphoreSignal, "deferExternalSemaphoreSignal"},
     {Feature::DepthStencilBlitExtraCopy, "depthStencilBlitExtraCopy"},
     {Feature::DescriptorSetCache, "descriptorSetCache"},
     {Feature::DestroyOldSwapchainInSharedPresentMode, "destroyOldSwapchainInSharedPresentMode"},
@@ -132,6 +140,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::DumpShaderSource, "dumpShaderSource"},
     {Feature::DumpTranslatedShaders, "dumpTranslatedShaders"},
     {Feature::EglColorspaceAttributePassthrough, "eglColorspaceAttributePassthrough"},
+    {Feature::ElideShareContextLockForUnsharedContexts, "elideShareContextLockForUnsharedContexts"},
     {Feature::EmitMaxGlsl400ForTesting, "emitMaxGlsl400ForTesting"},
     {Feature::EmulateAbsIntFunction, "emulateAbsIntFunction"},
     {Feature::EmulateAdvancedBlendEquations, "emulateAdvancedBlendEquations"},
@@ -166,6 +175,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::EnableMultisampledRenderToTextureOnNonTilers, "enableMultisampledRenderToTextureOnNonTilers"},
     {Feature::EnableParallelCompileAndLink, "enableParallelCompileAndLink"},
     {Feature::EnableParallelMtlLibraryCompilation, "enableParallelMtlLibraryCompilation"},
+    {Feature::EnableParallelRenderEncoding, "enableParallelRenderEncoding"},
     {Feature::EnablePipelineCacheDataCompression, "enablePipelineCacheDataCompression"},
     {Feature::EnablePortabilityEnumeration, "enablePortabilityEnumeration"},
     {Feature::EnablePrecisionQualifiers, "enablePrecisionQualifiers"},
@@ -177,6 +187,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::EnsureNonEmptyBufferIsBoundForDraw, "ensureNonEmptyBufferIsBoundForDraw"},
     {Feature::ExpandFragmentOutputsToVec4, "expandFragmentOutputsToVec4"},
     {Feature::ExpandIntegerPowExpressions, "expandIntegerPowExpressions"},
+    {Feature::ExpandRgbUploadsWithCompute, "expandRgbUploadsWithCompute"},
     {Feature::ExplicitFragmentLocations, "explicitFragmentLocations"},
     {Feature::ExplicitlyEnablePerSampleShading, "explicitlyEnablePerSampleShading"},
     {Feature::ExposeES32ForTesting, "exposeES32ForTesting"},
@@ -235,9 +246,11 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::InitFragmentOutputVariables, "initFragmentOutputVariables"},
     {Feature::InitializeColorAttachmentWithWhite, "initializeColorAttachmentWithWhite"},
     {Feature::InitializeCurrentVertexAttributes, "initializeCurrentVertexAttributes"},
+    {Feature::InitializeFormatTableInParallel, "initializeFormatTableInParallel"},
     {Feature::InjectAsmStatementIntoLoopBodies, "injectAsmStatementIntoLoopBodies"},
     {Feature::IsVertexSyncDeferred, "isVertexSyncDeferred"},
     {Feature::KeepBufferShadowCopy, "keepBufferShadowCopy"},
+    {Feature::LimitGarbageCleanupPerFrame, "limitGarbageCleanupPerFrame"},
     {Feature::LimitMax3dArrayTextureSizeTo1024, "limitMax3dArrayTextureSizeTo1024"},
     {Feature::LimitMaxBufferBytesTo1MB, "limitMaxBufferBytesTo1MB"},
     {Feature::LimitMaxBufferSizeTo1gb, "limitMaxBufferSizeTo1gb"},
@@ -254,6 +267,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::LogMemoryReportStats, "logMemoryReportStats"},
     {Feature::LoseContextOnOutOfMemory, "loseContextOnOutOfMemory"},
     {Feature::MapUnspecifiedColorSpaceToPassThrough, "mapUnspecifiedColorSpaceToPassThrough"},
+    {Feature::MeasurePassGpuTime, "measurePassGpuTime"},
     {Feature::MergeProgramPipelineCachesToGlobalCache, "mergeProgramPipelineCachesToGlobalCache"},
     {Feature::MrtPerfWorkaround, "mrtPerfWorkaround"},
     {Feature::MultisampleColorFormatShaderReadWorkaround, "multisampleColorFormatShaderReadWorkaround"},
@@ -264,30 +278,38 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PackLastRowSeparatelyForPaddingInclusion, "packLastRowSeparatelyForPaddingInclusion"},
     {Feature::PackOverlappingRowsSeparatelyPackBuffer, "packOverlappingRowsSeparatelyPackBuffer"},
     {Feature::PadBuffersToMaxVertexAttribStride, "padBuffersToMaxVertexAttribStride"},
+    {Feature::ParallelImageLoads, "parallelImageLoads"},
     {Feature::PassHighpToPackUnormSnormBuiltins, "passHighpToPackUnormSnormBuiltins"},
     {Feature::PermanentlySwitchToFramebufferFetchMode, "permanentlySwitchToFramebufferFetchMode"},
     {Feature::PersistentlyMappedBuffers, "persistentlyMappedBuffers"},
     {Feature::PreAddTexelFetchOffsets, "preAddTexelFetchOffsets"},
+    {Feature::PrecompileGLES1NeighborVariants, "precompileGLES1NeighborVariants"},
     {Feature::PreemptivelyStartProvokingVertexCommandBuffer, "preemptivelyStartProvokingVertexCommandBuffer"},
     {Feature::PreferAggregateBarrierCalls, "preferAggregateBarrierCalls"},
     {Feature::PreferBGR565ToRGB565, "preferBGR565ToRGB565"},
     {Feature::PreferCachedNoncoherentForDynamicStreamBufferUsage, "preferCachedNoncoherentForDynamicStreamBufferUsage"},
     {Feature::PreferCpuForBuffersubdata, "preferCpuForBuffersubdata"},
     {Feature::PreferCPUForBufferSubData, "preferCPUForBufferSubData"},
+    {Feature::PreferDeviceLocalMemoryForPersistentWriteBuffers, "preferDeviceLocalMemoryForPersistentWriteBuffers"},
     {Feature::PreferDeviceLocalMemoryHostVisible, "preferDeviceLocalMemoryHostVisible"},
     {Feature::PreferDoubleBufferSwapchainOnFifoMode, "preferDoubleBufferSwapchainOnFifoMode"},
     {Feature::PreferDrawClearOverVkCmdClearAttachments, "preferDrawClearOverVkCmdClearAttachments"},
     {Feature::PreferDynamicRendering, "preferDynamicRendering"},
+    {Feature::PreferFramebufferFetchPixelLocalStorage, "preferFramebufferFetchPixelLocalStorage"},
     {Feature::PreferGlobalPipelineCache, "preferGlobalPipelineCache"},
     {Feature::PreferGPUForCopyBufferSubData, "preferGPUForCopyBufferSubData"},
     {Feature::PreferHostCachedForNonStaticBufferUsage, "preferHostCachedForNonStaticBufferUsage"},
     {Feature::PreferLinearFilterForYUV, "preferLinearFilterForYUV"},
+    {Feature::PreferLoadOpForScissoredClear, "preferLoadOpForScissoredClear"},
     {Feature::PreferMonolithicPipelinesOverLibraries, "preferMonolithicPipelinesOverLibraries"},
     {Feature::PreferMSRTSSFlagByDefault, "preferMSRTSSFlagByDefault"},
+    {Feature::PreferRobustBufferAccessToIndexClamping, "preferRobustBufferAccessToIndexClamping"},
     {Feature::PreferSkippingInvalidateForEmulatedFormats, "preferSkippingInvalidateForEmulatedFormats"},
     {Feature::PreferSubmitAtFBOBoundary, "preferSubmitAtFBOBoundary"},
     {Feature::PreferSubmitOnAnySamplesPassedQueryEnd, "preferSubmitOnAnySamplesPassedQueryEnd"},
     {Feature::PreTransformTextureCubeGradDerivatives, "preTransformTextureCubeGradDerivatives"},
+    {Feature::PrewarmMonolithicPipelineTransitions, "prewarmMonolithicPipelineTransitions"},
+    {Feature::ProfileDirtyBitHandlers, "profileDirtyBitHandlers"},
     {Feature::PromotePackedFormatsTo8BitPerChannel, "promotePackedFormatsTo8BitPerChannel"},
     {Feature::ProvokingVertex, "provokingVertex"},
     {Feature::QueryCounterBitsGeneratesErrors, "queryCounterBitsGeneratesErrors"},
@@ -295,6 +317,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ReapplyUBOBindingsAfterUsingBinaryProgram, "reapplyUBOBindingsAfterUsingBinaryProgram"},
     {Feature::ReattachFboDepthStencilOnReallocation, "reattachFboDepthStencilOnReallocation"},
     {Feature::RecreateMipmapLevelsBeforeGenerate, "recreateMipmapLevelsBeforeGenerate"},
+    {Feature::RecycleExternalBufferImports, "recycleExternalBufferImports"},
     {Feature::RecycleVkEvent, "recycleVkEvent"},
     {Feature::RegenerateStructNames, "regenerateStructNames"},
     {Feature::RemoveDynamicIndexingOfSwizzledVector, "removeDynamicIndexingOfSwizzledVector"},
@@ -318,6 +341,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SetNeedInitOnInvalidation, "setNeedInitOnInvalidation"},
     {Feature::SetPrimitiveRestartFixedIndexForDrawArrays, "setPrimitiveRestartFixedIndexForDrawArrays"},
     {Feature::SetZeroLevelBeforeGenerateMipmap, "setZeroLevelBeforeGenerateMipmap"},
+    {Feature::ShareStreamedVertexBufferAcrossAttribs, "shareStreamedVertexBufferAcrossAttribs"},
     {Feature::ShiftInstancedArrayDataWithOffset, "shiftInstancedArrayDataWithOffset"},
     {Feature::SimulateTileMemoryForTesting, "simulateTileMemoryForTesting"},
     {Feature::SingleThreadedTextureDecompression, "singleThreadedTextureDecompression"},
@@ -352,6 +376,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsClKhrSubgroups, "supportsClKhrSubgroups"},
     {Feature::SupportsColorWriteEnable, "supportsColorWriteEnable"},
     {Feature::SupportsComputeTranscodeEtcToBc, "supportsComputeTranscodeEtcToBc"},
+    {Feature::SupportsConditionalRendering, "supportsConditionalRendering"},
     {Feature::SupportsCustomBorderColor, "supportsCustomBorderColor"},
     {Feature::SupportsDenormFtzFp16, "supportsDenormFtzFp16"},
     {Feature::SupportsDenormFtzFp32, "supportsDenormFtzFp32"},
@@ -424,6 +449,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsPrimitivesGeneratedQuery, "supportsPrimitivesGeneratedQuery"},
     {Feature::SupportsPrimitiveTopologyListRestart, "supportsPrimitiveTopologyListRestart"},
     {Feature::SupportsProtectedMemory, "supportsProtectedMemory"},
+    {Feature::SupportsPushDescriptor, "supportsPushDescriptor"},
     {Feature::SupportsRasterizationOrderAttachmentAccess, "supportsRasterizationOrderAttachmentAccess"},
     {Feature::SupportsRenderpass2, "supportsRenderpass2"},
     {Feature::SupportsRenderPassLoadStoreOpNone, "supportsRenderPassLoadStoreOpNone"},
@@ -448,6 +474,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsShaderInt8, "supportsShaderInt8"},
     {Feature::SupportsShaderIntegerDotProduct, "supportsShaderIntegerDotProduct"},
     {Feature::SupportsShaderNonSemanticInfo, "supportsShaderNonSemanticInfo"},
+    {Feature::SupportsShaderObject, "supportsShaderObject"},
     {Feature::SupportsShaderStencilExport, "supportsShaderStencilExport"},
     {Feature::SupportsSharedPresentableImageExtension, "supportsSharedPresentableImageExtension"},
     {Feature::SupportsSignedZeroInfNanPreserveFp16, "supportsSignedZeroInfNanPreserveFp16"},
@@ -478,6 +505,8 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SyncDefaultVertexArraysToDefault, "syncDefaultVertexArraysToDefault"},
     {Feature::SyncMonolithicPipelinesToBlobCache, "syncMonolithicPipelinesToBlobCache"},
     {Feature::SyncPipelineCacheToBlobCacheEveryFrame, "syncPipelineCacheToBlobCacheEveryFrame"},
+    {Feature::TranscodeEtcToBc, "transcodeEtcToBc"},
+    {Feature::TrimMemoryOnBudgetPressure, "trimMemoryOnBudgetPressure"},
     {Feature::UnbindFBOBeforeSwitchingContext, "unbindFBOBeforeSwitchingContext"},
     {Feature::UncurrentEglSurfaceUponSurfaceDestroy, "uncurrentEglSurfaceUponSurfaceDestroy"},
     {Feature::UnfoldShortCircuits, "unfoldShortCircuits"},
@@ -486,6 +515,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UnsizedSRGBReadPixelsDoesntTransform, "unsizedSRGBReadPixelsDoesntTransform"},
     {Feature::UploadDataToIosurfacesWithStagingBuffers, "uploadDataToIosurfacesWithStagingBuffers"},
     {Feature::UploadTextureDataInChunks, "uploadTextureDataInChunks"},
+    {Feature::UseColorBlendEquationDynamicState, "useColorBlendEquationDynamicState"},
     {Feature::UseCullModeDynamicState, "useCullModeDynamicState"},
     {Feature::UseDepthBiasEnableDynamicState, "useDepthBiasEnableDynamicState"},
     {Feature::UseDepthCompareOpDynamicState, "useDepthCompareOpDynamicState"},
@@ -494,6 +524,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseDualPipelineBlobCacheSlots, "useDualPipelineBlobCacheSlots"},
     {Feature::UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache, "useEmptyBlobsToEraseOldPipelineCacheFromBlobCache"},
     {Feature::UseFrontFaceDynamicState, "useFrontFaceDynamicState"},
+    {Feature::UseImmutableSamplersForTextures, "useImmutableSamplersForTextures"},
     {Feature::UseIntermediateTextureForGenerateMipmap, "useIntermediateTextureForGenerateMipmap"},
     {Feature::UseIr, "useIr"},
     {Feature::UseLargeSizeForDynamicBuffers, "useLargeSizeForDynamicBuffers"},
@@ -501,14 +532,20 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseNonZeroStencilWriteMaskStaticState, "useNonZeroStencilWriteMaskStaticState"},
     {Feature::UsePrimitiveRestartEnableDynamicState, "usePrimitiveRestartEnableDynamicState"},
     {Feature::UsePrimitiveTopologyDynamicState, "usePrimitiveTopologyDynamicState"},
+    {Feature::UsePushDescriptorsForStorageBuffers, "usePushDescriptorsForStorageBuffers"},
+    {Feature::UsePushDescriptorsForTextures, "usePushDescriptorsForTextures"},
+    {Feature::UsePushDescriptorsForUniformBuffers, "usePushDescriptorsForUniformBuffers"},
     {Feature::UseRasterizerDiscardEnableDynamicState, "useRasterizerDiscardEnableDynamicState"},
+    {Feature::UseRenderPipelineBinaryArchive, "useRenderPipelineBinaryArchive"},
     {Feature::UseResetCommandBufferBitForSecondaryPools, "useResetCommandBufferBitForSecondaryPools"},
     {Feature::UseShadowBuffersWhenAppropriate, "useShadowBuffersWhenAppropriate"},
+    {Feature::UseSmallImageMemoryPools, "useSmallImageMemoryPools"},
     {Feature::UsesNativeBuiltinClKernel, "usesNativeBuiltinClKernel"},
     {Feature::UsesSecondComponentForStencilBorderColor, "usesSecondComponentForStencilBorderColor"},
     {Feature::UseStencilOpDynamicState, "useStencilOpDynamicState"},
     {Feature::UseStencilTestEnableDynamicState, "useStencilTestEnableDynamicState"},
     {Feature::UseSystemMemoryForConstantBuffers, "useSystemMemoryForConstantBuffers"},
+    {Feature::UseTimelineSemaphoreForQueueSerials, "useTimelineSemaphoreForQueueSerials"},
     {Feature::UseUnusedBlocksWithStandardOrSharedLayout, "useUnusedBlocksWithStandardOrSharedLayout"},
     {Feature::UseVertexInputBindingStrideDynamicState, "useVertexInputBindingStrideDynamicState"},
     {Feature::UseVkEventForBufferBarrier, "useVkEventForBufferBarrier"},
@@ -519,6 +556,8 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::VerifyPipelineCacheInBlobCache, "verifyPipelineCacheInBlobCache"},
     {Feature::VertexIDDoesNotIncludeBaseVertex, "vertexIDDoesNotIncludeBaseVertex"},
     {Feature::WarmUpPipelineCacheAtLink, "warmUpPipelineCacheAtLink"},
+    {Feature::WarmUpRecordedGraphicsPipelines, "warmUpRecordedGraphicsPipelines"},
+    {Feature::WarmUpRenderStateCache, "warmUpRenderStateCache"},
     {Feature::WrapSwitchInIfTrue, "wrapSwitchInIfTrue"},
     {Feature::WriteHelperSampleMask, "writeHelperSampleMask"},
 }};
@@ -23,6 +23,7 @@ enum class Feature
     AdjustSrcDstRegionForBlitFramebuffer,
     AllocateNonZeroMemory,
     AllocateNonZeroTextures,
+    AllocateStreamingBuffersFromHeap,
     AllowAstcFormats,
     AllowBufferReadWrite,
     AllowClearForRobustResourceInit,
@@ -61,13 +62,17 @@ enum class Feature
     AvoidOpSelectWithMismatchingRelaxedPrecision,
     AvoidStencilTextureSwizzle,
     AvoidWaitAny,
+    BatchOutsideRenderPassImageBarriers,
+    BatchSubImageUpdates,
     BgraTexImageFormatsBroken,
     BindCompleteFramebufferForTimerQueries,
     BindTransformFeedbackBufferBeforeBindBufferRange,
     BorderColorSrgb,
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
+    CacheCompiledHlsl,
     CacheCompiledShader,
+    CacheFormatPropertiesInBlobCache,
     CallClearTwice,
     ClampArrayAccess,
     ClampFragDepth,
@@ -82,10 +87,13 @@ enum class Feature
     CompileJobIsThreadSafe,
     ConvertLowpAndMediumpFloatUniformsTo16Bits,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
+    CopyOcclusionQueryResultsToBuffer,
     CopyTextureToBufferForReadOptimization,
     CorruptProgramBinaryForTesting,
     DebugClDumpCommandStream,
+    DecodeAstcUploadsAsynchronously,
     DecodeEncodeSRGBForGenerateMipmap,
+    DeferExternalSemaphoreSignal,
     DepthStencilBlitExtraCopy,
     DescriptorSetCache,
     DestroyOldSwapchainInSharedPresentMode,
@@ -132,6 +140,7 @@ enum class Feature
     DumpShaderSource,
     DumpTranslatedShaders,
     EglColorspaceAttributePassthrough,
+    ElideShareContextLockForUnsharedContexts,
     EmitMaxGlsl400ForTesting,
     EmulateAbsIntFunction,
     EmulateAdvancedBlendEquations,
@@ -166,6 +175,7 @@ enum class Feature
     EnableMultisampledRenderToTextureOnNonTilers,
     EnableParallelCompileAndLink,
     EnableParallelMtlLibraryCompilation,
+    EnableParallelRenderEncoding,
     EnablePipelineCacheDataCompression,
     EnablePortabilityEnumeration,
     EnablePrecisionQualifiers,
@@ -177,6 +187,7 @@ enum class Feature
     EnsureNonEmptyBufferIsBoundForDraw,
     ExpandFragmentOutputsToVec4,
     ExpandIntegerPowExpressions,
+    ExpandRgbUploadsWithCompute,
     ExplicitFragmentLocations,
     ExplicitlyEnablePerSampleShading,
     ExposeES32ForTesting,
@@ -235,9 +246,11 @@ enum class Feature
     InitFragmentOutputVariables,
     InitializeColorAttachmentWithWhite,
     InitializeCurrentVertexAttributes,
+    InitializeFormatTableInParallel,
     InjectAsmStatementIntoLoopBodies,
     IsVertexSyncDeferred,
     KeepBufferShadowCopy,
+    LimitGarbageCleanupPerFrame,
     LimitMax3dArrayTextureSizeTo1024,
     LimitMaxBufferBytesTo1MB,
     LimitMaxBufferSizeTo1gb,
@@ -254,6 +267,7 @@ enum class Feature
     LogMemoryReportStats,
     LoseContextOnOutOfMemory,
     MapUnspecifiedColorSpaceToPassThrough,
+    MeasurePassGpuTime,
     MergeProgramPipelineCachesToGlobalCache,
     MrtPerfWorkaround,
     MultisampleColorFormatShaderReadWorkaround,
@@ -264,30 +278,38 @@ enum class Feature
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
     PadBuffersToMaxVertexAttribStride,
+    ParallelImageLoads,
     PassHighpToPackUnormSnormBuiltins,
     PermanentlySwitchToFramebufferFetchMode,
     PersistentlyMappedBuffers,
     PreAddTexelFetchOffsets,
+    PrecompileGLES1NeighborVariants,
     PreemptivelyStartProvokingVertexCommandBuffer,
     PreferAggregateBarrierCalls,
     PreferBGR565ToRGB565,
     PreferCachedNoncoherentForDynamicStreamBufferUsage,
     PreferCpuForBuffersubdata,
     PreferCPUForBufferSubData,
+    PreferDeviceLocalMemoryForPersistentWriteBuffers,
     PreferDeviceLocalMemoryHostVisible,
     PreferDoubleBufferSwapchainOnFifoMode,
     PreferDrawClearOverVkCmdClearAttachments,
     PreferDynamicRendering,
+    PreferFramebufferFetchPixelLocalStorage,
     PreferGlobalPipelineCache,
     PreferGPUForCopyBufferSubData,
     PreferHostCachedForNonStaticBufferUsage,
     PreferLinearFilterForYUV,
+    PreferLoadOpForScissoredClear,
     PreferMonolithicPipelinesOverLibraries,
     PreferMSRTSSFlagByDefault,
+    PreferRobustBufferAccessToIndexClamping,
     PreferSkippingInvalidateForEmulatedFormats,
     PreferSubmitAtFBOBoundary,
     PreferSubmitOnAnySamplesPassedQueryEnd,
     PreTransformTextureCubeGradDerivatives,
+    PrewarmMonolithicPipelineTransitions,
+    ProfileDirtyBitHandlers,
     PromotePackedFormatsTo8BitPerChannel,
     ProvokingVertex,
     QueryCounterBitsGeneratesErrors,
@@ -295,6 +317,7 @@ enum class Feature
     ReapplyUBOBindingsAfterUsingBinaryProgram,
     ReattachFboDepthStencilOnReallocation,
     RecreateMipmapLevelsBeforeGenerate,
+    RecycleExternalBufferImports,
     RecycleVkEvent,
     RegenerateStructNames,
     RemoveDynamicIndexingOfSwizzledVector,
@@ -318,6 +341,7 @@ enum class Feature
     SetNeedInitOnInvalidation,
     SetPrimitiveRestartFixedIndexForDrawArrays,
     SetZeroLevelBeforeGenerateMipmap,
+    ShareStreamedVertexBufferAcrossAttribs,
     ShiftInstancedArrayDataWithOffset,
     SimulateTileMemoryForTesting,
     SingleThreadedTextureDecompression,
@@ -352,6 +376,7 @@ enum class Feature
     SupportsClKhrSubgroups,
     SupportsColorWriteEnable,
     SupportsComputeTranscodeEtcToBc,
+    SupportsConditionalRendering,
     SupportsCustomBorderColor,
     SupportsDenormFtzFp16,
     SupportsDenormFtzFp32,
@@ -424,6 +449,7 @@ enum class Feature
     SupportsPrimitivesGeneratedQuery,
     SupportsPrimitiveTopologyListRestart,
     SupportsProtectedMemory,
+    SupportsPushDescriptor,
     SupportsRasterizationOrderAttachmentAccess,
     SupportsRenderpass2,
     SupportsRenderPassLoadStoreOpNone,
@@ -448,6 +474,7 @@ enum class Feature
     SupportsShaderInt8,
     SupportsShaderIntegerDotProduct,
     SupportsShaderNonSemanticInfo,
+    SupportsShaderObject,
     SupportsShaderStencilExport,
     SupportsSharedPresentableImageExtension,
     SupportsSignedZeroInfNanPreserveFp16,
@@ -478,6 +505,8 @@ enum class Feature
     SyncDefaultVertexArraysToDefault,
     SyncMonolithicPipelinesToBlobCache,
     SyncPipelineCacheToBlobCacheEveryFrame,
+    TranscodeEtcToBc,
+    TrimMemoryOnBudgetPressure,
     UnbindFBOBeforeSwitchingContext,
     UncurrentEglSurfaceUponSurfaceDestroy,
     UnfoldShortCircuits,
@@ -486,6 +515,7 @@ enum class Feature
     UnsizedSRGBReadPixelsDoesntTransform,
     UploadDataToIosurfacesWithStagingBuffers,
     UploadTextureDataInChunks,
+    UseColorBlendEquationDynamicState,
     UseCullModeDynamicState,
     UseDepthBiasEnableDynamicState,
     UseDepthCompareOpDynamicState,
@@ -494,6 +524,7 @@ enum class Feature
     UseDualPipelineBlobCacheSlots,
     UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache,
     UseFrontFaceDynamicState,
+    UseImmutableSamplersForTextures,
     UseIntermediateTextureForGenerateMipmap,
     UseIr,
     UseLargeSizeForDynamicBuffers,
@@ -501,14 +532,20 @@ enum class Feature
     UseNonZeroStencilWriteMaskStaticState,
     UsePrimitiveRestartEnableDynamicState,
     UsePrimitiveTopologyDynamicState,
+    UsePushDescriptorsForStorageBuffers,
+    UsePushDescriptorsForTextures,
+    UsePushDescriptorsForUniformBuffers,
     UseRasterizerDiscardEnableDynamicState,
+    UseRenderPipelineBinaryArchive,
     UseResetCommandBufferBitForSecondaryPools,
     UseShadowBuffersWhenAppropriate,
+    UseSmallImageMemoryPools,
     UsesNativeBuiltinClKernel,
     UsesSecondComponentForStencilBorderColor,
     UseStencilOpDynamicState,
     UseStencilTestEnableDynamicState,
     UseSystemMemoryForConstantBuffers,
+    UseTimelineSemaphoreForQueueSerials,
     UseUnusedBlocksWithStandardOrSharedLayout,
     UseVertexInputBindingStrideDynamicState,
     UseVkEventForBufferBarrier,
@@ -519,6 +556,8 @@ enum class Feature
     VerifyPipelineCacheInBlobCache,
     VertexIDDoesNotIncludeBaseVertex,
     WarmUpPipelineCacheAtLink,
+    WarmUpRecordedGraphicsPipelines,
+    WarmUpRenderStateCache,
     WrapSwitchInIfTrue,
     WriteHelperSampleMask,
 
@@ -48,6 +48,10 @@ void ReplayTraceFunctionCall(const CallCapture &call, const TraceFunctionMap &cu
             glAttachShader(gShaderProgramMap[captures[0].value.GLuintVal],
                            gShaderProgramMap[captures[1].value.GLuintVal]);
             break;
+        case angle::EntryPoint::GLBeginConditionalRenderNV:
+            glBeginConditionalRenderNV(gQueryMap[captures[0].value.GLuintVal],
+                                       captures[1].value.GLenumVal);
+            break;
         case angle::EntryPoint::GLBeginPerfMonitorAMD:
             glBeginPerfMonitorAMD(captures[0].value.GLuintVal);
             break;
@@ -913,6 +917,9 @@ void ReplayTraceFunctionCall(const CallCapture &call, const TraceFunctionMap &cu
         case angle::EntryPoint::GLEnableiOES:
             glEnableiOES(captures[0].value.GLenumVal, captures[1].value.GLuintVal);
             break;
+        case angle::EntryPoint::GLEndConditionalRenderNV:
+            glEndConditionalRenderNV();
+            break;
         case angle::EntryPoint::GLEndPerfMonitorAMD:
             glEndPerfMonitorAMD(captures[0].value.GLuintVal);
             break;
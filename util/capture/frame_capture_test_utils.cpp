@@ -18,6 +18,7 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
+#include <algorithm>
 #include <fstream>
 
 namespace angle
@@ -432,11 +433,18 @@ FrameCaptureBinaryData *TraceLibrary::ConfigureBinaryDataLoader(const char *file
 
     FrameCaptureBinaryData *binaryData = new FrameCaptureBinaryData;
 
+    const size_t blockSize = static_cast<size_t>(mTraceInfo.binaryBlockSize);
+    size_t residentSize    = static_cast<size_t>(mTraceInfo.binaryResidentSize);
+    if (mBinaryDataResidentSize != 0)
+    {
+        // At least one resident block is needed besides the swap block.
+        residentSize = std::max(mBinaryDataResidentSize, 2 * blockSize);
+    }
+
     binaryData->configureBinaryDataLoader(
-        mTraceInfo.isBinaryDataCompressed, mTraceInfo.binaryBlockCount,
-        static_cast<size_t>(mTraceInfo.binaryBlockSize),
-        static_cast<size_t>(mTraceInfo.binaryResidentSize),
+        mTraceInfo.isBinaryDataCompressed, mTraceInfo.binaryBlockCount, blockSize, residentSize,
         static_cast<size_t>(mTraceInfo.binaryIndexOffset), pathBuffer.str());
+    binaryData->setPrefetchEnabled(mPrefetchBinaryData);
 
     return binaryData;
 }
@@ -71,6 +71,12 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
 
     void setDebugOutputDir(const char *dataDir) { mDebugOutputDir = dataDir; }
 
+    // Overrides the amount of memory used to keep binary data blocks resident.  Zero uses the
+    // size the trace was captured with.
+    void setBinaryDataResidentSize(size_t residentSize) { mBinaryDataResidentSize = residentSize; }
+
+    void setPrefetchBinaryData(bool prefetch) { mPrefetchBinaryData = prefetch; }
+
     void replayFrame(uint32_t frameIndex) { mTraceFunctions->ReplayFrame(frameIndex); }
 
     void setupReplay() { mTraceFunctions->SetupReplay(); }
@@ -90,6 +96,17 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
         return callFunc<GetSerializedContextStateFunc>("GetSerializedContextState", frameIndex);
     }
 
+    // Returns nullptr if the trace doesn't have digests, like older traces.
+    const char *getSerializedContextStateDigest(uint32_t frameIndex)
+    {
+        void *untypedFunc = mTraceLibrary->getSymbol("GetSerializedContextStateDigest");
+        if (!untypedFunc)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<GetSerializedContextStateFunc>(untypedFunc)(frameIndex);
+    }
+
     void setValidateSerializedStateCallback(ValidateSerializedStateCallback callback)
     {
         return callFunc<SetValidateSerializedStateCallbackFunc>(
@@ -122,6 +139,8 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
     std::vector<uint8_t> mBinaryData;
     std::string mBinaryDataDir;
     std::string mDebugOutputDir;
+    size_t mBinaryDataResidentSize = 0;
+    bool mPrefetchBinaryData       = false;
     angle::TraceInfo mTraceInfo;
     angle::TraceFunctions *mTraceFunctions = nullptr;
 };
@@ -65,6 +65,7 @@ ANGLE_REPLAY_EXPORT void SetValidateSerializedStateCallback(
 
 // Only defined if serialization is enabled.
 ANGLE_REPLAY_EXPORT const char *GetSerializedContextState(uint32_t frameIndex);
+ANGLE_REPLAY_EXPORT const char *GetSerializedContextStateDigest(uint32_t frameIndex);
 
 ANGLE_REPLAY_EXPORT void SetupEntryPoints(angle::TraceCallbacks *traceCallbacks,
                                           angle::TraceFunctions **traceFunctions);
@@ -789,6 +789,8 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLGETNUNIFORMUIVKHRPROC t_glGetnUniformuivKHR;
 ANGLE_TRACE_LOADER_EXPORT PFNGLREADNPIXELSKHRPROC t_glReadnPixelsKHR;
 ANGLE_TRACE_LOADER_EXPORT PFNGLFRAMEBUFFERPARAMETERIMESAPROC t_glFramebufferParameteriMESA;
 ANGLE_TRACE_LOADER_EXPORT PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC t_glGetFramebufferParameterivMESA;
+ANGLE_TRACE_LOADER_EXPORT PFNGLBEGINCONDITIONALRENDERNVPROC t_glBeginConditionalRenderNV;
+ANGLE_TRACE_LOADER_EXPORT PFNGLENDCONDITIONALRENDERNVPROC t_glEndConditionalRenderNV;
 ANGLE_TRACE_LOADER_EXPORT PFNGLDELETEFENCESNVPROC t_glDeleteFencesNV;
 ANGLE_TRACE_LOADER_EXPORT PFNGLFINISHFENCENVPROC t_glFinishFenceNV;
 ANGLE_TRACE_LOADER_EXPORT PFNGLGENFENCESNVPROC t_glGenFencesNV;
@@ -2117,6 +2119,10 @@ void LoadTraceGLES(LoadProc loadProc)
         loadProc("glFramebufferParameteriMESA"));
     t_glGetFramebufferParameterivMESA = reinterpret_cast<PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC>(
         loadProc("glGetFramebufferParameterivMESA"));
+    t_glBeginConditionalRenderNV =
+        reinterpret_cast<PFNGLBEGINCONDITIONALRENDERNVPROC>(loadProc("glBeginConditionalRenderNV"));
+    t_glEndConditionalRenderNV =
+        reinterpret_cast<PFNGLENDCONDITIONALRENDERNVPROC>(loadProc("glEndConditionalRenderNV"));
     t_glDeleteFencesNV = reinterpret_cast<PFNGLDELETEFENCESNVPROC>(loadProc("glDeleteFencesNV"));
     t_glFinishFenceNV  = reinterpret_cast<PFNGLFINISHFENCENVPROC>(loadProc("glFinishFenceNV"));
     t_glGenFencesNV    = reinterpret_cast<PFNGLGENFENCESNVPROC>(loadProc("glGenFencesNV"));
@@ -756,6 +756,8 @@
 #define glReadnPixelsKHR t_glReadnPixelsKHR
 #define glFramebufferParameteriMESA t_glFramebufferParameteriMESA
 #define glGetFramebufferParameterivMESA t_glGetFramebufferParameterivMESA
+#define glBeginConditionalRenderNV t_glBeginConditionalRenderNV
+#define glEndConditionalRenderNV t_glEndConditionalRenderNV
 #define glDeleteFencesNV t_glDeleteFencesNV
 #define glFinishFenceNV t_glFinishFenceNV
 #define glGenFencesNV t_glGenFencesNV
@@ -1680,6 +1682,8 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLREADNPIXELSKHRPROC t_glReadnPixelsKHR;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLFRAMEBUFFERPARAMETERIMESAPROC t_glFramebufferParameteriMESA;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC
     t_glGetFramebufferParameterivMESA;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLBEGINCONDITIONALRENDERNVPROC t_glBeginConditionalRenderNV;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLENDCONDITIONALRENDERNVPROC t_glEndConditionalRenderNV;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLDELETEFENCESNVPROC t_glDeleteFencesNV;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLFINISHFENCENVPROC t_glFinishFenceNV;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLGENFENCESNVPROC t_glGenFencesNV;
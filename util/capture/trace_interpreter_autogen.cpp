@@ -819,6 +819,13 @@ CallCapture ParseCallCapture(const Token &nameToken,
             ParseParameters<std::remove_pointer<PFNGLATTACHSHADERPROC>::type>(paramTokens, strings);
         return CallCapture(EntryPoint::GLAttachShader, std::move(params));
     }
+    if (strcmp(nameToken, "glBeginConditionalRenderNV") == 0)
+    {
+        ParamBuffer params =
+            ParseParameters<std::remove_pointer<PFNGLBEGINCONDITIONALRENDERNVPROC>::type>(
+                paramTokens, strings);
+        return CallCapture(EntryPoint::GLBeginConditionalRenderNV, std::move(params));
+    }
     if (strcmp(nameToken, "glBeginPerfMonitorAMD") == 0)
     {
         ParamBuffer params =
@@ -2080,6 +2087,13 @@ CallCapture ParseCallCapture(const Token &nameToken,
             ParseParameters<std::remove_pointer<PFNGLENABLEIOESPROC>::type>(paramTokens, strings);
         return CallCapture(EntryPoint::GLEnableiOES, std::move(params));
     }
+    if (strcmp(nameToken, "glEndConditionalRenderNV") == 0)
+    {
+        ParamBuffer params =
+            ParseParameters<std::remove_pointer<PFNGLENDCONDITIONALRENDERNVPROC>::type>(
+                paramTokens, strings);
+        return CallCapture(EntryPoint::GLEndConditionalRenderNV, std::move(params));
+    }
     if (strcmp(nameToken, "glEndPerfMonitorAMD") == 0)
     {
         ParamBuffer params = ParseParameters<std::remove_pointer<PFNGLENDPERFMONITORAMDPROC>::type>(
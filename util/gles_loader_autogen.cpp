@@ -769,6 +769,8 @@ ANGLE_UTIL_EXPORT PFNGLGETNUNIFORMUIVKHRPROC l_glGetnUniformuivKHR;
 ANGLE_UTIL_EXPORT PFNGLREADNPIXELSKHRPROC l_glReadnPixelsKHR;
 ANGLE_UTIL_EXPORT PFNGLFRAMEBUFFERPARAMETERIMESAPROC l_glFramebufferParameteriMESA;
 ANGLE_UTIL_EXPORT PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC l_glGetFramebufferParameterivMESA;
+ANGLE_UTIL_EXPORT PFNGLBEGINCONDITIONALRENDERNVPROC l_glBeginConditionalRenderNV;
+ANGLE_UTIL_EXPORT PFNGLENDCONDITIONALRENDERNVPROC l_glEndConditionalRenderNV;
 ANGLE_UTIL_EXPORT PFNGLDELETEFENCESNVPROC l_glDeleteFencesNV;
 ANGLE_UTIL_EXPORT PFNGLFINISHFENCENVPROC l_glFinishFenceNV;
 ANGLE_UTIL_EXPORT PFNGLGENFENCESNVPROC l_glGenFencesNV;
@@ -2092,6 +2094,10 @@ void LoadUtilGLES(LoadProc loadProc)
         loadProc("glFramebufferParameteriMESA"));
     l_glGetFramebufferParameterivMESA = reinterpret_cast<PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC>(
         loadProc("glGetFramebufferParameterivMESA"));
+    l_glBeginConditionalRenderNV =
+        reinterpret_cast<PFNGLBEGINCONDITIONALRENDERNVPROC>(loadProc("glBeginConditionalRenderNV"));
+    l_glEndConditionalRenderNV =
+        reinterpret_cast<PFNGLENDCONDITIONALRENDERNVPROC>(loadProc("glEndConditionalRenderNV"));
     l_glDeleteFencesNV = reinterpret_cast<PFNGLDELETEFENCESNVPROC>(loadProc("glDeleteFencesNV"));
     l_glFinishFenceNV  = reinterpret_cast<PFNGLFINISHFENCENVPROC>(loadProc("glFinishFenceNV"));
     l_glGenFencesNV    = reinterpret_cast<PFNGLGENFENCESNVPROC>(loadProc("glGenFencesNV"));
@@ -756,6 +756,8 @@
 #define glReadnPixelsKHR l_glReadnPixelsKHR
 #define glFramebufferParameteriMESA l_glFramebufferParameteriMESA
 #define glGetFramebufferParameterivMESA l_glGetFramebufferParameterivMESA
+#define glBeginConditionalRenderNV l_glBeginConditionalRenderNV
+#define glEndConditionalRenderNV l_glEndConditionalRenderNV
 #define glDeleteFencesNV l_glDeleteFencesNV
 #define glFinishFenceNV l_glFinishFenceNV
 #define glGenFencesNV l_glGenFencesNV
@@ -1629,6 +1631,8 @@ ANGLE_UTIL_EXPORT extern PFNGLGETNUNIFORMUIVKHRPROC l_glGetnUniformuivKHR;
 ANGLE_UTIL_EXPORT extern PFNGLREADNPIXELSKHRPROC l_glReadnPixelsKHR;
 ANGLE_UTIL_EXPORT extern PFNGLFRAMEBUFFERPARAMETERIMESAPROC l_glFramebufferParameteriMESA;
 ANGLE_UTIL_EXPORT extern PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC l_glGetFramebufferParameterivMESA;
+ANGLE_UTIL_EXPORT extern PFNGLBEGINCONDITIONALRENDERNVPROC l_glBeginConditionalRenderNV;
+ANGLE_UTIL_EXPORT extern PFNGLENDCONDITIONALRENDERNVPROC l_glEndConditionalRenderNV;
 ANGLE_UTIL_EXPORT extern PFNGLDELETEFENCESNVPROC l_glDeleteFencesNV;
 ANGLE_UTIL_EXPORT extern PFNGLFINISHFENCENVPROC l_glFinishFenceNV;
 ANGLE_UTIL_EXPORT extern PFNGLGENFENCESNVPROC l_glGenFencesNV;
@@ -130,6 +130,7 @@ void KHRONOS_APIENTRY DebugMessageCallback(GLenum source,
 
 void GetPerfCounterValue(const CounterNameToIndexMap &counterIndexMap,
                          std::vector<angle::PerfMonitorTriplet> &triplets,
+                         GLuint group,
                          const char *name,
                          GLuint64 *counterOut)
 {
@@ -139,8 +140,7 @@ void GetPerfCounterValue(const CounterNameToIndexMap &counterIndexMap,
 
     for (const angle::PerfMonitorTriplet &triplet : triplets)
     {
-        ASSERT(triplet.group == 0);
-        if (triplet.counter == counterIndex)
+        if (triplet.group == group && triplet.counter == counterIndex)
         {
             *counterOut = triplet.value;
             return;
@@ -459,14 +459,14 @@ std::vector<angle::PerfMonitorTriplet> GetPerfMonitorTriplets()
     return perfResults;
 }
 
-angle::VulkanPerfCounters GetPerfCounters(const CounterNameToIndexMap &indexMap)
+angle::VulkanPerfCounters GetPerfCounters(const CounterNameToIndexMap &indexMap, GLuint group)
 {
     std::vector<angle::PerfMonitorTriplet> perfResults = GetPerfMonitorTriplets();
 
     angle::VulkanPerfCounters counters;
 
 #define ANGLE_UNPACK_PERF_COUNTER(COUNTER) \
-    GetPerfCounterValue(indexMap, perfResults, #COUNTER, &counters.COUNTER);
+    GetPerfCounterValue(indexMap, perfResults, group, #COUNTER, &counters.COUNTER);
 
     ANGLE_VK_PERF_COUNTERS_X(ANGLE_UNPACK_PERF_COUNTER)
 
@@ -57,7 +57,10 @@ using CounterNameToIndexMap = std::map<std::string, GLuint>;
 using CounterNameToValueMap = std::map<std::string, GLuint64>;
 
 ANGLE_UTIL_EXPORT CounterNameToIndexMap BuildCounterNameToIndexMap();
-ANGLE_UTIL_EXPORT angle::VulkanPerfCounters GetPerfCounters(const CounterNameToIndexMap &indexMap);
+// The Vulkan backend exposes the live counters in group 0, and the counters as they were when the
+// last frame was presented in group 1.  Both groups have the same counters.
+ANGLE_UTIL_EXPORT angle::VulkanPerfCounters GetPerfCounters(const CounterNameToIndexMap &indexMap,
+                                                            GLuint group = 0);
 ANGLE_UTIL_EXPORT CounterNameToValueMap BuildCounterNameToValueMap();
 ANGLE_UTIL_EXPORT std::vector<angle::PerfMonitorTriplet> GetPerfMonitorTriplets();
 